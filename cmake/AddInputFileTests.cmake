@@ -26,6 +26,14 @@ else()
     "Possible values are: high, normal, low")
 endif()
 
+option(SPECTRE_INPUT_FILE_PERFORMANCE_TESTS "Add the 'performance' checks of \
+input file tests, which compare the performance of the runs to stored \
+baselines. See 'spectre.tools.CheckPerformance' for details." OFF)
+set(SPECTRE_PERFORMANCE_BASELINES_DIR
+  "${CMAKE_BINARY_DIR}/tests/PerformanceBaselines" CACHE PATH
+  "Directory where the baselines of the 'performance' input file checks are \
+stored. Baselines that don't exist yet are recorded by the first run.")
+
 # Environment variables for test
 set(_TEST_ENV_VARS "")
 # - Disable ASAN's leak sanitizer because Charm++ has false positives
@@ -67,9 +75,11 @@ function(add_single_input_file_test INPUT_FILE EXECUTABLE COMMAND_LINE_ARGS
     "${EXECUTABLE_DIR_NAME}.${INPUT_FILE_NAME}.${CHECK_TYPE}"
     )
   if("${CHECK_TYPE}" STREQUAL "execute_check_output")
-    set(_CHECK_OUTPUT_FILES "true")
+    set(_CHECK_OUTPUT "output")
+  elseif("${CHECK_TYPE}" STREQUAL "performance")
+    set(_CHECK_OUTPUT "performance")
   else()
-    set(_CHECK_OUTPUT_FILES "false")
+    set(_CHECK_OUTPUT "none")
   endif()
 
   if ("${CHECK_TYPE}" STREQUAL "parse")
@@ -79,18 +89,19 @@ function(add_single_input_file_test INPUT_FILE EXECUTABLE COMMAND_LINE_ARGS
       --check-options --input-file ${INPUT_FILE}
       )
   elseif("${CHECK_TYPE}" STREQUAL "execute" OR
-         "${CHECK_TYPE}" STREQUAL "execute_check_output")
+         "${CHECK_TYPE}" STREQUAL "execute_check_output" OR
+         "${CHECK_TYPE}" STREQUAL "performance")
     add_test(
       NAME ${CTEST_NAME}
       # This script is written below, and only once
       COMMAND sh ${PROJECT_BINARY_DIR}/tmp/RunInputFileTest.sh
       ${EXECUTABLE} ${INPUT_FILE} ${RUN_DIRECTORY}
-      ${EXPECTED_EXIT_CODE} ${_CHECK_OUTPUT_FILES}
+      ${EXPECTED_EXIT_CODE} ${_CHECK_OUTPUT}
       "${COMMAND_LINE_ARGS}"
       )
   else()
     message(FATAL_ERROR "Unknown check for input file: ${CHECK_TYPE}."
-      "Known checks are: execute")
+      "Known checks are: parse, execute, execute_check_output, performance")
   endif()
 
   # Triple timeout if address sanitizer is enabled.
@@ -106,6 +117,10 @@ function(add_single_input_file_test INPUT_FILE EXECUTABLE COMMAND_LINE_ARGS
     TIMEOUT ${TIMEOUT}
     LABELS "${TAGS}"
     ENVIRONMENT "${_TEST_ENV_VARS}")
+  # Don't let other tests compete for the cores while measuring performance
+  if ("${CHECK_TYPE}" STREQUAL "performance")
+    set_tests_properties(${CTEST_NAME} PROPERTIES RUN_SERIAL TRUE)
+  endif()
 endfunction()
 
 # Searches the directory INPUT_FILE_DIR for .yaml files and adds a test for each
@@ -215,6 +230,11 @@ function(add_input_file_tests INPUT_FILE_DIR)
       string(STRIP "${INPUT_FILE_TIMEOUT}" INPUT_FILE_TIMEOUT)
     endif()
 
+    # Performance checks are opt-in
+    if (NOT SPECTRE_INPUT_FILE_PERFORMANCE_TESTS)
+      list(REMOVE_ITEM INPUT_FILE_CHECKS "performance")
+    endif()
+
     foreach(CHECK_TYPE ${INPUT_FILE_CHECKS})
       add_single_input_file_test(
         ${INPUT_FILE}
@@ -17,9 +17,11 @@ if(NOT GoogleBenchmark_ROOT)
   set(GoogleBenchmark_ROOT $ENV{GoogleBenchmark_ROOT})
 endif()
 
-find_path(GoogleBenchmark_INCLUDE_DIRS benchmark.h
-    PATH_SUFFIXES include/benchmark
-    HINTS ${GOOGLE_BENCHMARK_ROOT})
+# Search for the directory containing `benchmark/benchmark.h` so that sources
+# can use the `#include <benchmark/benchmark.h>` form documented upstream.
+find_path(GoogleBenchmark_INCLUDE_DIRS benchmark/benchmark.h
+    PATH_SUFFIXES include
+    HINTS ${GOOGLE_BENCHMARK_ROOT} ${GoogleBenchmark_ROOT})
 
 find_library(GoogleBenchmark_LIBRARIES
     NAMES benchmark
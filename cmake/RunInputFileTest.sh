@@ -8,7 +8,8 @@
 # - $2: path to input file
 # - $3: directory name
 # - $4: expected exit code
-# - $5: "true" to check output files or "false" to skip the check
+# - $5: "output" to check output files, "performance" to compare the
+#   performance to the stored baselines, or "none" to skip these checks
 # - $6: additional command-line arguments forwarded to the executable
 
 # Set up test directory
@@ -25,10 +26,15 @@ if [ $exit_code -ne $4 ]; then
 fi
 
 # Check output and clean up
-if [ "$5" = "true" ]; then
+if [ "$5" = "output" ]; then
     @Python_EXECUTABLE@ @CMAKE_SOURCE_DIR@/tools/CheckOutputFiles.py \
         --input-file $2 --run-directory $test_dir \
         || exit 1
+elif [ "$5" = "performance" ]; then
+    @Python_EXECUTABLE@ -m spectre.tools.CheckPerformance $2 \
+        --run-directory $test_dir \
+        --baselines-dir @SPECTRE_PERFORMANCE_BASELINES_DIR@ \
+        || exit 1
 fi
 @Python_EXECUTABLE@ -m spectre.tools.CleanOutput \
     --output-dir $test_dir $2 \
@@ -5,8 +5,12 @@ option(ENABLE_PROFILING "Enables various options to make profiling easier" OFF)
 
 option(KEEP_FRAME_POINTER "Add keep frame pointer for profiling" OFF)
 
+option(ENABLE_DATABOX_PROFILING
+  "Count evaluations and time of DataBox compute and reference items" OFF)
+
 add_library(Profiling::KeepFramePointer IMPORTED INTERFACE)
 add_library(Profiling::EnableProfiling IMPORTED INTERFACE)
+add_library(Profiling::DataBoxProfiling IMPORTED INTERFACE)
 
 if (KEEP_FRAME_POINTER OR ENABLE_PROFILING)
   set_property(
@@ -27,9 +31,19 @@ if (ENABLE_PROFILING)
     )
 endif()
 
+if (ENABLE_DATABOX_PROFILING)
+  set_property(
+    TARGET Profiling::DataBoxProfiling
+    APPEND PROPERTY
+    INTERFACE_COMPILE_DEFINITIONS
+    $<$<COMPILE_LANGUAGE:CXX>:SPECTRE_DATABOX_PROFILING>
+    )
+endif()
+
 target_link_libraries(
   SpectreFlags
   INTERFACE
+  Profiling::DataBoxProfiling
   Profiling::EnableProfiling
   Profiling::KeepFramePointer
   )
@@ -86,6 +86,8 @@ struct Initialize {
   using const_global_cache_tags = tmpl::flatten<tmpl::list<
       control_system::Tags::SystemToCombinedNames,
       control_system::Tags::MeasurementsPerUpdate,
+      control_system::Tags::MeasurementsBeforeExpiration,
+      control_system::Tags::QuiescentStretchFactor,
       control_system::Tags::WriteDataToDisk,
       control_system::Tags::ObserveCenters, control_system::Tags::Verbosity,
       control_system::Tags::IsActiveMap,
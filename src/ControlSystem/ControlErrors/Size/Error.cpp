@@ -19,8 +19,6 @@
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "NumericalAlgorithms/Interpolation/ZeroCrossingPredictor.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
-#include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
-#include "NumericalAlgorithms/SphericalHarmonics/TagsTypeAliases.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/AreaElement.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/RadialDistance.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/SurfaceIntegralOfScalar.hpp"
@@ -46,18 +44,16 @@ ErrorDiagnostics control_error(
         inverse_spatial_metric_on_excision_boundary) {
   const double Y00 = 0.25 * M_2_SQRTPI;
 
-  // Define various quantities on excision boundary.
+  // The geometric quantities on the excision boundary only change when the
+  // excision boundary does, so they are cached on the Strahlkorper.
+  const auto excision_quantities = excision_boundary.derived_quantities();
+  const auto& excision_radius = excision_quantities->radius;
+  const auto& excision_rhat = excision_quantities->rhat;
+  const auto& excision_normal_one_form = excision_quantities->normal_one_form;
+  const auto& excision_jacobian = excision_quantities->jacobian;
+
+  // Define various other quantities on excision boundary.
   // Declare a TempBuffer to do this with a single memory allocation.
-  using excision_theta_phi_tag =
-      ::Tags::Tempi<0, 2, ::Frame::Spherical<Frame>, DataVector>;
-  using excision_radius_tag = ::Tags::TempScalar<0, DataVector>;
-  using excision_rhat_tag = ::Tags::Tempi<1, 3, Frame, DataVector>;
-  using excision_normal_one_form_tag = ::Tags::Tempi<2, 3, Frame, DataVector>;
-  using excision_jacobian_tag =
-      ::Tags::TempTensor<0, ylm::Tags::aliases::Jacobian<Frame>>;
-  using excision_inv_jacobian_tag =
-      ::Tags::TempTensor<1, ylm::Tags::aliases::InvJacobian<Frame>>;
-  using excision_dx_radius_tag = Tags::Tempi<3, 3, Frame, DataVector>;
   using area_element_tag = ::Tags::TempScalar<1, DataVector>;
   using distorted_normal_dot_unit_coord_vector_tag =
       ::Tags::TempScalar<3, DataVector>;
@@ -68,20 +64,10 @@ ErrorDiagnostics control_error(
   using char_speed_tag = ::Tags::TempScalar<8, DataVector>;
 
   TempBuffer<
-      tmpl::list<excision_theta_phi_tag, excision_radius_tag, excision_rhat_tag,
-                 excision_normal_one_form_tag, excision_jacobian_tag,
-                 excision_inv_jacobian_tag, excision_dx_radius_tag,
-                 area_element_tag, distorted_normal_dot_unit_coord_vector_tag,
+      tmpl::list<area_element_tag, distorted_normal_dot_unit_coord_vector_tag,
                  comoving_char_speed_tag, radial_distance_tag,
                  excision_normal_one_form_norm_tag, unity_tag, char_speed_tag>>
       buffer(excision_boundary.ylm_spherepack().physical_size());
-  auto& excision_radius = get<excision_radius_tag>(buffer);
-  auto& excision_theta_phi = get<excision_theta_phi_tag>(buffer);
-  auto& excision_rhat = get<excision_rhat_tag>(buffer);
-  auto& excision_normal_one_form = get<excision_normal_one_form_tag>(buffer);
-  auto& excision_jacobian = get<excision_jacobian_tag>(buffer);
-  auto& excision_inv_jacobian = get<excision_inv_jacobian_tag>(buffer);
-  auto& excision_dx_radius = get<excision_dx_radius_tag>(buffer);
   auto& area_element = get<area_element_tag>(buffer);
   auto& distorted_normal_dot_unit_coord_vector =
       get<distorted_normal_dot_unit_coord_vector_tag>(buffer);
@@ -92,18 +78,7 @@ ErrorDiagnostics control_error(
   auto& unity = get<unity_tag>(buffer);
   auto& characteristic_speed_on_excision_boundary = get<char_speed_tag>(buffer);
 
-  // Compute the quantities on the excision boundary.
-  ylm::theta_phi(make_not_null(&excision_theta_phi), excision_boundary);
-  ylm::radius(make_not_null(&excision_radius), excision_boundary);
-  // rhat is x^i/r
-  ylm::rhat(make_not_null(&excision_rhat), excision_theta_phi);
-  ylm::jacobian(make_not_null(&excision_jacobian), excision_theta_phi);
-  ylm::inv_jacobian(make_not_null(&excision_inv_jacobian), excision_theta_phi);
-  ylm::cartesian_derivs_of_scalar(make_not_null(&excision_dx_radius),
-                                  excision_radius, excision_boundary,
-                                  excision_radius, excision_inv_jacobian);
-  ylm::normal_one_form(make_not_null(&excision_normal_one_form),
-                       excision_dx_radius, excision_rhat);
+  // Compute the quantities on the excision boundary. Note that rhat is x^i/r.
   magnitude(make_not_null(&excision_normal_one_form_norm),
             excision_normal_one_form,
             inverse_spatial_metric_on_excision_boundary);
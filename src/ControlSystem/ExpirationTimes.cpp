@@ -9,18 +9,21 @@ namespace control_system {
 double function_of_time_expiration_time(
     const double time, const DataVector& old_measurement_timescales,
     const DataVector& new_measurement_timescales,
-    const int measurements_per_update) {
-  return time + min(old_measurement_timescales) +
+    const int measurements_per_update,
+    const int measurements_before_expiration) {
+  return time +
+         measurements_before_expiration * min(old_measurement_timescales) +
          measurements_per_update * min(new_measurement_timescales);
 }
 
 double measurement_expiration_time(const double time,
                                    const DataVector& old_measurement_timescales,
                                    const DataVector& new_measurement_timescales,
-                                   const int measurements_per_update) {
-  return function_of_time_expiration_time(time, old_measurement_timescales,
-                                          new_measurement_timescales,
-                                          measurements_per_update) -
+                                   const int measurements_per_update,
+                                   const int measurements_before_expiration) {
+  return function_of_time_expiration_time(
+             time, old_measurement_timescales, new_measurement_timescales,
+             measurements_per_update, measurements_before_expiration) -
          0.5 * min(new_measurement_timescales);
 }
 }  // namespace control_system
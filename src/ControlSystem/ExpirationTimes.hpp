@@ -24,22 +24,32 @@ namespace control_system {
  * \brief Calculate the next expiration time for the FunctionsOfTime.
  *
  * \f{align}
- * T_\mathrm{expr}^\mathrm{FoT} &= t + \tau_\mathrm{m}^\mathrm{old}
+ * T_\mathrm{expr}^\mathrm{FoT} &= t + M * \tau_\mathrm{m}^\mathrm{old}
  *      + N * \tau_\mathrm{m}^\mathrm{new} \\
  * \f}
  *
  * where \f$T_\mathrm{expr}^\mathrm{FoT}\f$ is the expiration time for the
  * FunctionsOfTime, \f$t\f$ is the update time,
- * \f$\tau_\mathrm{m}^\mathrm{old/new}\f$ is the measurement timescale, and
- * \f$N\f$ is the number of measurements per update.
+ * \f$\tau_\mathrm{m}^\mathrm{old/new}\f$ is the measurement timescale,
+ * \f$N\f$ is the number of measurements per update, and \f$M\f$ is the
+ * number of measurements before expiration.
  *
  * The expiration is calculated this way because we update the functions of time
- * one (old) measurement before they actually expire.
+ * \f$M\f$ (old) measurements before they actually expire. The measurements
+ * between the update and the expiration still use the old measurement
+ * timescale, see `measurement_expiration_time()`. The measurement and the
+ * horizon finds or reductions it needs therefore have the time the evolution
+ * takes to advance by \f$M\f$ measurements to arrive at the control systems
+ * before the DG elements reach the expiration time. The default of
+ * \f$M=1\f$ works if the measurements are fast compared to the evolution.
+ * Otherwise increase \f$M\f$, at the price of a control signal that is based
+ * on older measurements.
  *
  * The choice of having the functions of time expire exactly one old measurement
  * after they are updated is arbitrary. They could expire any time between the
  * update time and one old measurement after the update. This decision was made
- * to minimize time spent waiting for the functions of time to be valid.
+ * to minimize time spent waiting for the functions of time to be valid. The
+ * same holds for \f$M>1\f$ with the last of the \f$M\f$ measurements.
  *
  * Since functions of time are valid at their expiration time, we are actually
  * able to do the next measurement if the expiration time is at that
@@ -53,7 +63,8 @@ namespace control_system {
 double function_of_time_expiration_time(
     const double time, const DataVector& old_measurement_timescales,
     const DataVector& new_measurement_timescales,
-    const int measurements_per_update);
+    const int measurements_per_update,
+    const int measurements_before_expiration);
 
 /*!
  * \ingroup ControlSystemGroup
@@ -70,9 +81,9 @@ double function_of_time_expiration_time(
  * \f$\tau_\mathrm{m}^\mathrm{new}\f$ is the new measurement timescale. The
  * reason for the factor of a half is as follows:
  *
- * We update the functions of time one (old) measurement before the expiration
- * time. Based on how dense triggers are set up, which control_system::Trigger
- * is a dense trigger, you calculate the next trigger (measurement) time at the
+ * We update the functions of time \f$M\f$ (old) measurements before the
+ * expiration time. Based on how dense triggers are set up, which
+ * control_system::Trigger is a dense trigger, you calculate the next trigger (measurement) time at the
  * current measurement time. However, at the function of time expiration time we
  * need updated damping timescales from all control systems in order to
  * calculate when the next measurement is going to be (and in turn, the next
@@ -87,7 +98,8 @@ double function_of_time_expiration_time(
 double measurement_expiration_time(const double time,
                                    const DataVector& old_measurement_timescales,
                                    const DataVector& new_measurement_timescales,
-                                   const int measurements_per_update);
+                                   const int measurements_per_update,
+                                   const int measurements_before_expiration);
 
 /*!
  * \ingroup ControlSystemGroup
@@ -120,10 +132,17 @@ double measurement_expiration_time(const double time,
  * If the control system isn't active then expiration time is
  * `std::numeric_limits<double>::infinity()`, regardless of what the groups'
  * expiration time is.
+ *
+ * The first update happens at the \f$N\f$-th measurement, which is
+ * \f$N-1\f$ measurements after the initial time, so the initial functions of
+ * time are valid for \f$M - 1\f$ measurements longer than the
+ * $\tau_\mathrm{exp}$ above, where \f$M\f$ is the number of measurements
+ * before expiration.
  */
 template <size_t Dim, typename... OptionHolders>
 std::unordered_map<std::string, double> initial_expiration_times(
     const double initial_time, const int measurements_per_update,
+    const int measurements_before_expiration,
     const std::unique_ptr<::DomainCreator<Dim>>& domain_creator,
     const OptionHolders&... option_holders) {
   std::unordered_map<std::string, double> initial_expiration_times{};
@@ -146,7 +165,8 @@ std::unordered_map<std::string, double> initial_expiration_times(
   }
 
   [[maybe_unused]] const auto combine_expiration_times =
-      [&initial_time, &measurements_per_update, &domain_creator, &map_of_names,
+      [&initial_time, &measurements_per_update,
+       &measurements_before_expiration, &domain_creator, &map_of_names,
        &combined_expiration_times,
        &infinite_expiration_times](const auto& option_holder) {
         const std::string& control_system_name =
@@ -164,8 +184,10 @@ std::unordered_map<std::string, double> initial_expiration_times(
         const double min_measurement_timescale = min(measurement_timescales);
 
         double initial_expiration_time = function_of_time_expiration_time(
-            initial_time, DataVector{1, 0.0},
-            DataVector{1, min_measurement_timescale}, measurements_per_update);
+            initial_time + (measurements_before_expiration - 1) *
+                               min_measurement_timescale,
+            DataVector{1, 0.0}, DataVector{1, min_measurement_timescale},
+            measurements_per_update, measurements_before_expiration);
         initial_expiration_time = option_holder.is_active
                                       ? initial_expiration_time
                                       : std::numeric_limits<double>::infinity();
@@ -3,6 +3,16 @@
 
 #include "BNSCenterOfMass.hpp"
 
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
 namespace control_system::measurements {
 
 void center_of_mass_integral_on_element(
@@ -12,23 +22,46 @@ void center_of_mass_integral_on_element(
     const Mesh<3>& mesh, const Scalar<DataVector>& inv_det_jacobian,
     const Scalar<DataVector>& tilde_d,
     const tnsr::I<DataVector, 3, Frame::Grid>& x_grid) {
-  // Get Jacobian and mask for left/right stars
-  const DataVector det_jacobian = 1. / get(inv_det_jacobian);
-  const DataVector positive_x = step_function(get<0>(x_grid));
-  const DataVector negative_x = (1.0 - positive_x);
-
-  // Integrals of the density and its first moment (on local element).
-  // Suffix A/B for positive/negative x-coordinate (proxy for stars A and B)
-  const DataVector integrand_a = det_jacobian * positive_x * get(tilde_d);
-  const DataVector integrand_b = det_jacobian * negative_x * get(tilde_d);
+  ASSERT(get(tilde_d).size() == mesh.number_of_grid_points(),
+         "num_grid_points = " << mesh.number_of_grid_points()
+                              << ", tilde_d size = " << get(tilde_d).size());
+  // All eight integrals of the density and its first moment (on local element)
+  // are accumulated in a single pass over the grid points, so no temporary
+  // integrands are allocated. The quadrature is the same as in
+  // `definite_integral`. Suffix A/B for positive/negative x-coordinate (proxy
+  // for stars A and B)
+  const auto sliced_meshes = mesh.slices();
+  const size_t x_size = sliced_meshes[0].number_of_grid_points();
+  const size_t y_size = sliced_meshes[1].number_of_grid_points();
+  const size_t z_size = sliced_meshes[2].number_of_grid_points();
+  const DataVector& w_x = Spectral::quadrature_weights(sliced_meshes[0]);
+  const DataVector& w_y = Spectral::quadrature_weights(sliced_meshes[1]);
+  const DataVector& w_z = Spectral::quadrature_weights(sliced_meshes[2]);
 
-  (*mass_a) = definite_integral(integrand_a, mesh);
-  (*mass_b) = definite_integral(integrand_b, mesh);
-  for (size_t i = 0; i < 3; i++) {
-    gsl::at(*first_moment_a, i) =
-        definite_integral(integrand_a * x_grid.get(i), mesh);
-    gsl::at(*first_moment_b, i) =
-        definite_integral(integrand_b * x_grid.get(i), mesh);
+  *mass_a = 0.;
+  *mass_b = 0.;
+  *first_moment_a = {0., 0., 0.};
+  *first_moment_b = {0., 0., 0.};
+  for (size_t k = 0; k < z_size; ++k) {
+    for (size_t j = 0; j < y_size; ++j) {
+      const double prod = w_z[k] * w_y[j];
+      const size_t offset = x_size * (j + y_size * k);
+      for (size_t i = 0; i < x_size; ++i) {
+        const size_t p = i + offset;
+        const double det_jacobian = 1. / get(inv_det_jacobian)[p];
+        const double integrand =
+            prod * w_x[i] * (det_jacobian * get(tilde_d)[p]);
+        // Theta(0) = 1, as for `step_function`
+        const bool positive_x = get<0>(x_grid)[p] >= 0.;
+        double& mass = positive_x ? *mass_a : *mass_b;
+        std::array<double, 3>& first_moment =
+            positive_x ? *first_moment_a : *first_moment_b;
+        mass += integrand;
+        for (size_t d = 0; d < 3; ++d) {
+          gsl::at(first_moment, d) += integrand * x_grid.get(d)[p];
+        }
+      }
+    }
   }
 }
 }  // namespace control_system::measurements
@@ -73,7 +73,8 @@ struct NeutronStarCenter : db::SimpleTag {
  * \details This function computes the integral of tildeD (assumed to be the
  * conservative baryon density in the inertial frame), as well as its first
  * moment in the grid frame. The integrals are limited to \f$x>0\f$ (label A) or
- * \f$x<0\f$ (label B).
+ * \f$x<0\f$ (label B). All integrals are accumulated in a single pass over
+ * the grid points of the element.
  *
  * \param mass_a Integral of tildeD (x > 0)
  * \param mass_b Integral of tildeD (x < 0)
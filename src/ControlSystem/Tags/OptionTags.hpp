@@ -152,6 +152,37 @@ struct MeasurementsPerUpdate {
   using group = ControlSystemGroup;
 };
 
+/// \ingroup OptionTagsGroup
+/// \ingroup ControlSystemGroup
+/// Option tag that determines how many measurements before the functions of
+/// time expire the control systems update them.
+struct MeasurementsBeforeExpiration {
+  using type = int;
+  static constexpr Options::String help = {
+      "How many measurements before the functions of time expire the control "
+      "systems update them. Increase this if the measurements take longer "
+      "than the evolution needs to reach the next measurement, so the "
+      "elements don't wait for the updated functions of time."};
+  static int lower_bound() { return 1; }
+  using group = ControlSystemGroup;
+};
+
+/// \ingroup OptionTagsGroup
+/// \ingroup ControlSystemGroup
+/// Option tag for the factor by which quiescent control systems stretch the
+/// time between their measurements and updates.
+struct QuiescentStretchFactor {
+  using type = double;
+  static constexpr Options::String help = {
+      "Factor by which the time between measurements, and so between updates "
+      "of the functions of time, is stretched while the control errors of all "
+      "components of a control system are below the IncreaseThreshold of its "
+      "TimescaleTuner. The time between updates never exceeds the damping "
+      "timescale. Set to 1 to disable."};
+  static double lower_bound() { return 1.0; }
+  using group = ControlSystemGroup;
+};
+
 /// \ingroup OptionTagsGroup
 /// \ingroup ControlSystemGroup
 /// Verbosity tag for printing diagnostics about the control system algorithm.
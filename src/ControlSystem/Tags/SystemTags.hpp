@@ -192,6 +192,36 @@ struct MeasurementsPerUpdate : db::SimpleTag {
   }
 };
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ControlSystemGroup
+/// Tag that determines how many measurements before the functions of time
+/// expire the control systems update them. This will usually be stored in the
+/// global cache.
+struct MeasurementsBeforeExpiration : db::SimpleTag {
+  using type = int;
+
+  using option_tags = tmpl::list<OptionTags::MeasurementsBeforeExpiration>;
+  static constexpr bool pass_metavariables = false;
+  static int create_from_options(const int measurements_before_expiration) {
+    return measurements_before_expiration;
+  }
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ControlSystemGroup
+/// Tag for the factor by which quiescent control systems stretch the time
+/// between their measurements and updates. This will usually be stored in the
+/// global cache.
+struct QuiescentStretchFactor : db::SimpleTag {
+  using type = double;
+
+  using option_tags = tmpl::list<OptionTags::QuiescentStretchFactor>;
+  static constexpr bool pass_metavariables = false;
+  static double create_from_options(const double quiescent_stretch_factor) {
+    return quiescent_stretch_factor;
+  }
+};
+
 /// \ingroup DataBoxTagsGroup
 /// \ingroup ControlSystemGroup
 /// DataBox tag that keeps track of which measurement we are on.
@@ -153,6 +153,25 @@ void TimescaleTuner::update_timescale(
   }
 }
 
+bool TimescaleTuner::is_quiescent(
+    const std::array<DataVector, 2>& q_and_dtq) const {
+  check_if_timescales_have_been_set();
+  ASSERT(q_and_dtq[0].size() == timescale_.size() and
+             q_and_dtq[1].size() == timescale_.size(),
+         "One or both of the number of components in q_and_dtq("
+             << q_and_dtq[0].size() << "," << q_and_dtq[1].size()
+             << ") is inconsistent with the number of timescales("
+             << timescale_.size() << ")");
+  for (size_t i = 0; i < timescale_.size(); i++) {
+    if (fabs(q_and_dtq[0][i]) >= increase_timescale_threshold_ or
+        fabs(q_and_dtq[1][i] * timescale_[i]) >=
+            increase_timescale_threshold_) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void TimescaleTuner::check_if_timescales_have_been_set() const {
   ASSERT(timescales_have_been_set_,
          "Damping timescales in the TimescaleTuner have not been set yet.");
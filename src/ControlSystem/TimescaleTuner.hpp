@@ -117,6 +117,9 @@ class TimescaleTuner {
   /// The update function responsible for modifying the timescale based on
   /// the control system errors
   void update_timescale(const std::array<DataVector, 2>& q_and_dtq);
+  /// Whether the control errors of all components are below the increase
+  /// threshold, so `update_timescale` would increase all timescales
+  bool is_quiescent(const std::array<DataVector, 2>& q_and_dtq) const;
 
   /// Return whether the timescales have been set
   bool timescales_have_been_set() const { return timescales_have_been_set_; }
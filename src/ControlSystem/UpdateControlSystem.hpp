@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 #include "ControlSystem/Averager.hpp"
 #include "ControlSystem/CalculateMeasurementTimescales.hpp"
@@ -55,8 +57,10 @@ namespace control_system {
  * - \link Tags::CurrentNumberOfMeasurements CurrentNumberOfMeasurements
  *   \endlink
  *
- * And the \link control_system::Tags::MeasurementsPerUpdate \endlink must be in
- * the GlobalCache. If these tags are not present, a build error will occur.
+ * And the \link control_system::Tags::MeasurementsPerUpdate \endlink,
+ * \link control_system::Tags::MeasurementsBeforeExpiration \endlink, and
+ * \link control_system::Tags::QuiescentStretchFactor \endlink must be in the
+ * GlobalCache. If these tags are not present, a build error will occur.
  *
  * The algorithm to determine whether or not to update the functions of time is
  * as follows:
@@ -86,7 +90,14 @@ namespace control_system {
  *    step after we update the damping timescale. See
  *    `control_system::size::update_tuner` for this step.
  * 7. Calculate the new measurement timescale based off the updated damping
- *    timescales and the number of measurements per update.
+ *    timescales and the number of measurements per update. If the control
+ *    errors of all components were below the increase threshold of the
+ *    TimescaleTuner (see `TimescaleTuner::is_quiescent`), stretch the
+ *    measurement timescale by the
+ *    `control_system::Tags::QuiescentStretchFactor`, but not beyond a time
+ *    between updates of one damping timescale. This reduces the number of
+ *    measurements and of updates of the functions of time, which are broadcast
+ *    to all nodes, while the control system has nothing to correct.
  * 8. Determine the new expiration times for the
  *    `::domain::Tags::FunctionsOfTime` and
  *    `control_system::Tags::MeasurementTimescales`. Call the
@@ -217,6 +228,9 @@ struct UpdateControlSystem {
         controller(time, current_timescale, opt_avg_values.value(),
                    time_offset_0th, time_offset);
 
+    // This has to be checked with the damping timescales the control errors
+    // were measured with
+    const bool is_quiescent = tuner.is_quiescent(q_and_dtq);
     tuner.update_timescale(q_and_dtq);
 
     if constexpr (size::is_size_v<ControlSystem>) {
@@ -226,9 +240,25 @@ struct UpdateControlSystem {
 
     // Begin step 7
     // Calculate new measurement timescales with updated damping timescales
-    const DataVector new_measurement_timescale =
-        calculate_measurement_timescales(controller, tuner,
-                                         measurements_per_update);
+    DataVector new_measurement_timescale = calculate_measurement_timescales(
+        controller, tuner, measurements_per_update);
+    const double quiescent_stretch_factor =
+        get<control_system::Tags::QuiescentStretchFactor>(cache);
+    if (is_quiescent and quiescent_stretch_factor > 1.0) {
+      for (size_t i = 0; i < new_measurement_timescale.size(); ++i) {
+        new_measurement_timescale[i] = std::max(
+            new_measurement_timescale[i],
+            std::min(quiescent_stretch_factor * new_measurement_timescale[i],
+                     tuner.current_timescale()[i] /
+                         static_cast<double>(measurements_per_update)));
+      }
+      if (Parallel::get<Tags::Verbosity>(cache) >= ::Verbosity::Verbose) {
+        Parallel::printf(
+            "%s, time = %.16f: Control errors are quiescent. Stretched "
+            "measurement timescale = %s\n",
+            function_of_time_name, time, new_measurement_timescale);
+      }
+    }
 
     const auto& measurement_timescales =
         Parallel::get<Tags::MeasurementTimescales>(cache);
@@ -241,8 +271,8 @@ struct UpdateControlSystem {
     const double current_measurement_expiration_time =
         measurement_timescale->time_bounds()[1];
     // This call is ok because the measurement timescales are still valid
-    // because the measurement timescales expire half a measurement after this
-    // time.
+    // because the measurement timescales expire at least half a measurement
+    // after this time.
     const DataVector old_measurement_timescale =
         measurement_timescale->func(time)[0];
 
@@ -250,13 +280,15 @@ struct UpdateControlSystem {
     // Calculate the next expiration times for both the functions of time and
     // the measurement timescales based on the current time. Then, actually
     // update the functions of time and measurement timescales
+    const int measurements_before_expiration =
+        get<control_system::Tags::MeasurementsBeforeExpiration>(cache);
     const double new_fot_expiration_time = function_of_time_expiration_time(
         time, old_measurement_timescale, new_measurement_timescale,
-        measurements_per_update);
+        measurements_per_update, measurements_before_expiration);
 
     const double new_measurement_expiration_time = measurement_expiration_time(
         time, old_measurement_timescale, new_measurement_timescale,
-        measurements_per_update);
+        measurements_per_update, measurements_before_expiration);
 
     if (Parallel::get<Tags::Verbosity>(cache) >= ::Verbosity::Verbose) {
       Parallel::printf("%s, time = %.16f: Control signal = %s\n",
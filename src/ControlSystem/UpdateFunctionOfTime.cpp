@@ -3,6 +3,7 @@
 
 #include "ControlSystem/UpdateFunctionOfTime.hpp"
 
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <pup.h>
@@ -129,9 +130,22 @@ UpdateAggregator::combined_measurement_expiration_time() {
   return std::make_pair(min_measurement_timescale, min_expiration_time);
 }
 
+void UpdateAggregator::record_broadcast(const size_t bytes) {
+  ++number_of_broadcasts_;
+  bytes_broadcast_ += bytes;
+}
+
+size_t UpdateAggregator::number_of_broadcasts() const {
+  return number_of_broadcasts_;
+}
+
+size_t UpdateAggregator::bytes_broadcast() const { return bytes_broadcast_; }
+
 void UpdateAggregator::pup(PUP::er& p) {
   p | expiration_times_;
   p | active_names_;
   p | combined_name_;
+  p | number_of_broadcasts_;
+  p | bytes_broadcast_;
 }
 }  // namespace control_system
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <pup.h>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -13,8 +15,11 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "IO/Logging/Verbosity.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Printf.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -26,6 +31,7 @@ namespace control_system::Tags {
 struct UpdateAggregators;
 struct SystemToCombinedNames;
 struct MeasurementTimescales;
+struct Verbosity;
 }  // namespace control_system::Tags
 /// \endcond
 
@@ -143,6 +149,18 @@ struct UpdateAggregator {
    */
   std::pair<double, double> combined_measurement_expiration_time();
 
+  /*!
+   * \brief Records that an update of the global cache of size `bytes` was
+   * broadcast for this measurement.
+   */
+  void record_broadcast(size_t bytes);
+
+  /// The number of global cache updates recorded with `record_broadcast`
+  size_t number_of_broadcasts() const;
+
+  /// The total size in bytes of the updates recorded with `record_broadcast`
+  size_t bytes_broadcast() const;
+
   /// \cond
   void pup(PUP::er& p);
   /// \endcond
@@ -153,6 +171,8 @@ struct UpdateAggregator {
       expiration_times_{};
   std::unordered_set<std::string> active_names_{};
   std::string combined_name_{};
+  size_t number_of_broadcasts_{0};
+  size_t bytes_broadcast_{0};
 };
 
 /*!
@@ -168,7 +188,11 @@ struct UpdateAggregator {
  *
  * When the `UpdateAggregator::is_ready`, the measurement timescale is mutated
  * with `UpdateSingleFunctionOfTime` and the functions of time are mutated with
- * `UpdateMultipleFunctionsOfTime`, both using `Parallel::mutate`.
+ * `UpdateMultipleFunctionsOfTime`, both using `Parallel::mutate`. Each of these
+ * broadcasts only the new highest derivatives and expiration times, and the
+ * functions of time of all control systems sharing the measurement are updated
+ * in a single broadcast. The number and size of the broadcasts are recorded in
+ * the `UpdateAggregator` and printed with `::Verbosity::Verbose`.
  *
  * The "appropriate" `UpdateAggregator` is chosen from the
  * `control_system::Tags::SystemToCombinedNames` for the templated
@@ -218,9 +242,26 @@ struct AggregateUpdate {
       const std::pair<double, double> combined_measurement_expiration_time =
           aggregator.combined_measurement_expiration_time();
 
+      DataVector combined_measurement_timescale{
+          1, combined_measurement_expiration_time.first};
+      aggregator.record_broadcast(size_of_object_in_bytes(std::make_tuple(
+          combined_name, old_measurement_expiration_time,
+          combined_measurement_timescale,
+          combined_measurement_expiration_time.second)));
+      aggregator.record_broadcast(size_of_object_in_bytes(std::make_tuple(
+          old_fot_expiration_time, combined_fot_expiration_times)));
+
+      if (Parallel::get<Tags::Verbosity>(cache) >= ::Verbosity::Verbose) {
+        Parallel::printf(
+            "%s: Broadcasting updates. Total so far: %zu broadcasts, %zu "
+            "bytes\n",
+            combined_name, aggregator.number_of_broadcasts(),
+            aggregator.bytes_broadcast());
+      }
+
       Parallel::mutate<Tags::MeasurementTimescales, UpdateSingleFunctionOfTime>(
           cache, combined_name, old_measurement_expiration_time,
-          DataVector{1, combined_measurement_expiration_time.first},
+          std::move(combined_measurement_timescale),
           combined_measurement_expiration_time.second);
 
       Parallel::mutate<::domain::Tags::FunctionsOfTime,
@@ -7,6 +7,8 @@
 #include <complex>
 #include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -88,15 +90,166 @@ std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
   }
   return result;
 }
+
+// Fixing the number of columns at compile time lets the compiler fully unroll
+// the contraction and vectorize over the contiguous offsets.
+template <size_t Columns>
+void contract_dimension_impl(const gsl::not_null<double*> result,
+                        const Matrix& matrix, const double* const data,
+                        const size_t stride, const size_t number_of_stripes) {
+  const size_t rows = matrix.rows();
+  // Copy the matrix into a dense row-major buffer so the unrolled loop reads
+  // contiguous coefficients.
+  std::array<double, apply_matrices_detail::max_extent_for_small_kernels *
+                         Columns>
+      coefficients{};
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t column = 0; column < Columns; ++column) {
+      gsl::at(coefficients, row * Columns + column) = matrix(row, column);
+    }
+  }
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t stripe = 0; stripe < number_of_stripes; ++stripe) {
+    const double* const stripe_data = data + stripe * Columns * stride;
+    double* const stripe_result = result.get() + stripe * rows * stride;
+    for (size_t row = 0; row < rows; ++row) {
+      const double* const row_coefficients =
+          &gsl::at(coefficients, row * Columns);
+      double* const row_result = stripe_result + row * stride;
+      for (size_t offset = 0; offset < stride; ++offset) {
+        double sum = 0.0;
+        for (size_t column = 0; column < Columns; ++column) {
+          sum +=
+              row_coefficients[column] * stripe_data[column * stride + offset];
+        }
+        row_result[offset] = sum;
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+using ContractDimension = void (*)(gsl::not_null<double*>, const Matrix&,
+                                   const double*, size_t, size_t);
+
+template <size_t... Columns>
+constexpr std::array<ContractDimension, sizeof...(Columns)>
+make_contract_dimension_table(std::index_sequence<Columns...> /*meta*/) {
+  return {{&contract_dimension_impl<Columns + 1>...}};
+}
+
+constexpr std::array<ContractDimension,
+                     apply_matrices_detail::max_extent_for_small_kernels>
+    contract_dimension_table = make_contract_dimension_table(
+        std::make_index_sequence<
+            apply_matrices_detail::max_extent_for_small_kernels>{});
+
+// Apply the matrices one dimension at a time with the kernels specialized on
+// the number of columns.  Complex data is handled by treating the real and
+// imaginary parts as an extra innermost dimension of size
+// `doubles_per_element`.  Returns `false` without touching `result` if any
+// matrix is too large for the specialized kernels or if all the matrices are
+// identities, in which case the general implementation must be used.
+template <typename MatrixType, size_t Dim>
+bool apply_with_small_kernels(const gsl::not_null<double*> result,
+                              const std::array<MatrixType, Dim>& matrices,
+                              const double* const data,
+                              const Index<Dim>& extents,
+                              const size_t number_of_independent_components,
+                              const size_t doubles_per_element) {
+  size_t number_of_contractions = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      continue;
+    }
+    if (matrix.rows() > apply_matrices_detail::max_extent_for_small_kernels or
+        matrix.columns() >
+            apply_matrices_detail::max_extent_for_small_kernels) {
+      return false;
+    }
+    ++number_of_contractions;
+  }
+  if (number_of_contractions == 0) {
+    return false;
+  }
+
+  // Intermediate results are only needed when more than one dimension is
+  // contracted; the final contraction always writes directly into `result`.
+  Scratch scratch{};
+  if (number_of_contractions > 1) {
+    scratch = get_scratch(matrices, extents,
+                          number_of_independent_components *
+                              doubles_per_element);
+  }
+
+  auto current_extents = extents;
+  const double* current_data = data;
+  size_t stride = doubles_per_element;
+  size_t contractions_done = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      stride *= current_extents[d];
+      continue;
+    }
+    size_t number_of_stripes = number_of_independent_components;
+    for (size_t outer = d + 1; outer < Dim; ++outer) {
+      number_of_stripes *= current_extents[outer];
+    }
+    ++contractions_done;
+    double* const destination =
+        contractions_done == number_of_contractions
+            ? result.get()
+            : (contractions_done % 2 == 1 ? scratch.a : scratch.b);
+    apply_matrices_detail::contract_dimension(
+        destination, matrix, current_data, stride, number_of_stripes);
+    current_extents[d] = matrix.rows();
+    stride *= matrix.rows();
+    current_data = destination;
+  }
+  return true;
+}
 }  // namespace
 
 namespace apply_matrices_detail {
+void contract_dimension(const gsl::not_null<double*> result,
+                        const Matrix& matrix, const double* const data,
+                        const size_t stride, const size_t number_of_stripes) {
+  ASSERT(matrix.rows() <= max_extent_for_small_kernels and
+             matrix.columns() <= max_extent_for_small_kernels and
+             matrix.columns() > 0,
+         "contract_dimension requires a non-empty matrix with at most "
+             << max_extent_for_small_kernels
+             << " rows and columns, but got a " << matrix.rows() << "x"
+             << matrix.columns() << " matrix.");
+  gsl::at(contract_dimension_table, matrix.columns() - 1)(
+      result, matrix, data, stride, number_of_stripes);
+}
+
 template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
 template <typename MatrixType>
 void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
     const gsl::not_null<ElementType*> result,
     const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
     const Index<Dim>& extents, const size_t number_of_independent_components) {
+  if constexpr (sizeof...(DimensionIsIdentity) == 0) {
+    if constexpr (std::is_same_v<ElementType, double>) {
+      if (apply_with_small_kernels(result, matrices, data, extents,
+                                   number_of_independent_components, 1)) {
+        return;
+      }
+    } else {
+      // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+      if (apply_with_small_kernels(
+              make_not_null(reinterpret_cast<double*>(result.get())),
+              matrices, reinterpret_cast<const double*>(data), extents,
+              number_of_independent_components, 2)) {
+        return;
+      }
+      // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+  }
   if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
       Matrix{}) {
     Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
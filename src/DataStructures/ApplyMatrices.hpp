@@ -20,6 +20,22 @@ class Index;
 /// \endcond
 
 namespace apply_matrices_detail {
+// Matrices with at most this many rows and columns in every non-identity
+// dimension are applied with sum-factorization kernels specialized on the
+// number of columns.  Larger matrices are applied with BLAS.
+constexpr size_t max_extent_for_small_kernels = 10;
+
+// Contract `matrix` with every stripe of `data` in a single dimension, without
+// transposing.  The data is laid out as
+// `data[(stripe * matrix.columns() + column) * stride + offset]` with
+// `offset < stride` and the result as
+// `result[(stripe * matrix.rows() + row) * stride + offset]`.  The matrix must
+// be non-empty and have at most `max_extent_for_small_kernels` rows and
+// columns.
+void contract_dimension(gsl::not_null<double*> result, const Matrix& matrix,
+                        const double* data, size_t stride,
+                        size_t number_of_stripes);
+
 template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
 struct Impl {
   template <typename MatrixType>
@@ -59,6 +75,13 @@ size_t result_size(const std::array<MatrixType, Dim>& matrices,
 /// will be treated as the identity, but the matrix multiplications
 /// will be skipped for increased efficiency.
 ///
+/// When every non-identity matrix has at most
+/// `apply_matrices_detail::max_extent_for_small_kernels` rows and columns the
+/// contractions are done one dimension at a time by loops specialized at
+/// compile time on the number of columns, which avoids the BLAS call and
+/// transpose overhead that dominates for the small meshes typical of DG.
+/// Larger matrices are applied with `dgemm`.
+///
 /// \note The element type stored in the vectors to be transformed may be either
 /// `double` or `std::complex<double>`. The matrix, however, must be real. In
 /// the case of acting on a vector of complex values, the matrix is treated as
@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include "Utilities/Gsl.hpp"
+
+namespace db {
+/*!
+ * \ingroup DataBoxGroup
+ * \brief How often and for how long an immutable (compute or reference) item
+ * of a DataBox was evaluated.
+ *
+ * Only recorded when SpECTRE is configured with
+ * `-D ENABLE_DATABOX_PROFILING=ON`. Retrieve the profiles of a DataBox with
+ * `db::compute_item_profiles`.
+ */
+struct ComputeItemProfile {
+  std::string name{};
+  size_t number_of_evaluations{0};
+  /// Total wall time spent evaluating the item in seconds, including the
+  /// time spent evaluating its arguments for the first time.
+  double total_time{0.0};
+};
+
+namespace detail {
+// Adds the wall time between construction and destruction and one evaluation
+// to the counters.
+class ComputeItemTimer {
+ public:
+  ComputeItemTimer(const gsl::not_null<size_t*> number_of_evaluations,
+                   const gsl::not_null<double*> total_time)
+      : number_of_evaluations_(number_of_evaluations),
+        total_time_(total_time),
+        start_(std::chrono::steady_clock::now()) {}
+
+  ComputeItemTimer(const ComputeItemTimer&) = delete;
+  ComputeItemTimer& operator=(const ComputeItemTimer&) = delete;
+  ComputeItemTimer(ComputeItemTimer&&) = delete;
+  ComputeItemTimer& operator=(ComputeItemTimer&&) = delete;
+
+  ~ComputeItemTimer() {
+    ++(*number_of_evaluations_);
+    *total_time_ += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start_)
+                        .count();
+  }
+
+ private:
+  gsl::not_null<size_t*> number_of_evaluations_;
+  gsl::not_null<double*> total_time_;
+  std::chrono::steady_clock::time_point start_;
+};
+}  // namespace detail
+}  // namespace db
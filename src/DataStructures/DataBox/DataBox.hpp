@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
@@ -15,7 +16,9 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/Item.hpp"
 #include "DataStructures/DataBox/SubitemTag.hpp"
@@ -245,7 +248,14 @@ class DataBox<tmpl::list<Tags...>> : private detail::Item<Tags>... {
    * \note the default constructor is only used for serialization
    */
   DataBox() = default;
-  constexpr DataBox(DataBox&& rhs) : detail::Item<Tags>(std::move(rhs))... {
+  constexpr DataBox(DataBox&& rhs)
+      : detail::Item<Tags>(std::move(rhs))...
+#ifdef SPECTRE_DATABOX_PROFILING
+        ,
+        number_of_evaluations_(rhs.number_of_evaluations_),
+        evaluation_times_(rhs.evaluation_times_)
+#endif  // SPECTRE_DATABOX_PROFILING
+  {
     reset_all_subitems();
   }
   constexpr DataBox& operator=(DataBox&& rhs) {
@@ -263,6 +273,10 @@ class DataBox<tmpl::list<Tags...>> : private detail::Item<Tags>... {
 #pragma GCC diagnostic pop
 #endif  // defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 8 ||
         // (__GNUC__ > 10 && __GNUC__ < 12))
+#ifdef SPECTRE_DATABOX_PROFILING
+      number_of_evaluations_ = rhs.number_of_evaluations_;
+      evaluation_times_ = rhs.evaluation_times_;
+#endif  // SPECTRE_DATABOX_PROFILING
       reset_all_subitems();
     }
     return *this;
@@ -284,6 +298,10 @@ class DataBox<tmpl::list<Tags...>> : private detail::Item<Tags>... {
   template <typename Tag>
   const auto& get() const;
 
+  /// The evaluation profiles of the `immutable_item_tags`, should be called by
+  /// the free function db::compute_item_profiles
+  std::vector<ComputeItemProfile> compute_item_profiles() const;
+
   /// \brief Copy the items with tags `TagsOfItemsToCopy` from the DataBox
   /// into a TaggedTuple, should be called by the free function db::copy_items
   template <typename... TagsOfItemsToCopy>
@@ -410,6 +428,17 @@ class DataBox<tmpl::list<Tags...>> : private detail::Item<Tags>... {
                                                immutable_item_tags>::type;
 
   bool mutate_locked_box_{false};
+
+#ifdef SPECTRE_DATABOX_PROFILING
+  // Indexed like `immutable_item_tags`. These are not serialized, so they
+  // restart from zero after a checkpoint or migration.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::array<size_t, tmpl::size<immutable_item_tags>::value>
+      number_of_evaluations_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::array<double, tmpl::size<immutable_item_tags>::value>
+      evaluation_times_{};
+#endif  // SPECTRE_DATABOX_PROFILING
 };
 
 template <typename... Tags>
@@ -800,6 +829,13 @@ template <typename... Tags>
 template <typename ComputeTag, typename... ArgumentTags>
 void DataBox<tmpl::list<Tags...>>::evaluate_compute_item(
     tmpl::list<ArgumentTags...> /*meta*/) const {
+#ifdef SPECTRE_DATABOX_PROFILING
+  constexpr size_t index =
+      tmpl::index_of<immutable_item_tags, ComputeTag>::value;
+  const detail::ComputeItemTimer timer{
+      make_not_null(&std::get<index>(number_of_evaluations_)),
+      make_not_null(&std::get<index>(evaluation_times_))};
+#endif  // SPECTRE_DATABOX_PROFILING
   get_item<ComputeTag>().evaluate(get<ArgumentTags>()...);
 }
 
@@ -807,9 +843,34 @@ template <typename... Tags>
 template <typename ReferenceTag, typename... ArgumentTags>
 const auto& DataBox<tmpl::list<Tags...>>::get_reference_item(
     tmpl::list<ArgumentTags...> /*meta*/) const {
+#ifdef SPECTRE_DATABOX_PROFILING
+  constexpr size_t index =
+      tmpl::index_of<immutable_item_tags, ReferenceTag>::value;
+  const detail::ComputeItemTimer timer{
+      make_not_null(&std::get<index>(number_of_evaluations_)),
+      make_not_null(&std::get<index>(evaluation_times_))};
+#endif  // SPECTRE_DATABOX_PROFILING
   return ReferenceTag::get(get<ArgumentTags>()...);
 }
 
+template <typename... Tags>
+std::vector<ComputeItemProfile>
+DataBox<tmpl::list<Tags...>>::compute_item_profiles() const {
+  std::vector<ComputeItemProfile> result{};
+#ifdef SPECTRE_DATABOX_PROFILING
+  result.reserve(tmpl::size<immutable_item_tags>::value);
+  size_t index = 0;
+  tmpl::for_each<immutable_item_tags>([this, &index, &result](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    result.push_back(ComputeItemProfile{db::tag_name<tag>(),
+                                        gsl::at(number_of_evaluations_, index),
+                                        gsl::at(evaluation_times_, index)});
+    ++index;
+  });
+#endif  // SPECTRE_DATABOX_PROFILING
+  return result;
+}
+
 template <typename... Tags>
 template <typename Tag>
 const auto& DataBox<tmpl::list<Tags...>>::get() const {
@@ -873,6 +934,26 @@ SPECTRE_ALWAYS_INLINE const auto& get(const DataBox<TagList>& box) {
   return box.template get<Tag>();
 }
 
+/*!
+ * \ingroup DataBoxGroup
+ * \brief How often and for how long each compute and reference item of the
+ * DataBox was evaluated
+ *
+ * A compute item is evaluated when it is retrieved for the first time after
+ * one of its arguments was mutated, and a reference item every time it is
+ * retrieved. The times are inclusive, i.e. they include the time spent
+ * evaluating arguments that were not up to date.
+ *
+ * The profiles are only recorded if SpECTRE is configured with
+ * `-D ENABLE_DATABOX_PROFILING=ON`, otherwise an empty `std::vector` is
+ * returned. They can be written to disk with `Events::ObserveDataBoxProfile`.
+ */
+template <typename TagList>
+std::vector<ComputeItemProfile> compute_item_profiles(
+    const DataBox<TagList>& box) {
+  return box.compute_item_profiles();
+}
+
 ////////////////////////////////////////////////////////////////
 // Copy mutable creation items from the DataBox
 
@@ -912,6 +993,45 @@ SPECTRE_ALWAYS_INLINE auto copy_items(const DataBox<DbTagList>& box) {
   return box.copy_items(CopiedItemsTagList{});
 }
 
+/// \cond
+namespace detail {
+template <typename DbTagList, typename... MovedItemsTags>
+tuples::TaggedTuple<MovedItemsTags...> move_items(
+    const gsl::not_null<DataBox<DbTagList>*> box,
+    tmpl::list<MovedItemsTags...> /*meta*/) {
+  static_assert(
+      tmpl2::flat_all_v<tmpl::list_contains_v<
+          typename DataBox<DbTagList>::mutable_item_creation_tags,
+          MovedItemsTags>...>,
+      "Can only move mutable creation items");
+  return mutate<MovedItemsTags...>(
+      [](const gsl::not_null<typename MovedItemsTags::type*>... items) {
+        return tuples::TaggedTuple<MovedItemsTags...>{std::move(*items)...};
+      },
+      box);
+}
+}  // namespace detail
+/// \endcond
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Move the items out of the DataBox into a TaggedTuple
+ *
+ * \details Unlike `db::copy_items`, which copies each item by serializing
+ * and deserializing it, this leaves the items in `box` in a moved-from state.
+ * It is meant for a DataBox that is about to be destroyed, e.g. that of an
+ * element that is removed by adaptive mesh refinement.
+ *
+ * \return The objects corresponding to MovedItemsTagList
+ *
+ * \note The tags in MovedItemsTagList must be a subset of
+ * the mutable_item_creation_tags of the DataBox
+ */
+template <typename MovedItemsTagList, typename DbTagList>
+auto move_items(const gsl::not_null<DataBox<DbTagList>*> box) {
+  return detail::move_items(box, MovedItemsTagList{});
+}
+
 ////////////////////////////////////////////////////////////////
 // Get mutable reference from the DataBox
 template <typename... Tags>
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ScratchArena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+
+ScratchArena::Scope::Scope(const gsl::not_null<ScratchArena*> arena)
+    : arena_(arena),
+      block_index_(arena->current_block_),
+      used_in_block_(arena->blocks_.empty()
+                         ? 0
+                         : arena->blocks_[arena->current_block_].used) {
+  ++arena_->number_of_active_scopes_;
+}
+
+ScratchArena::Scope::~Scope() {
+  ASSERT(arena_->number_of_active_scopes_ > 0,
+         "Destroying a ScratchArena::Scope without an active scope.");
+  ASSERT(arena_->current_block_ >= block_index_,
+         "ScratchArena::Scope objects must be destroyed in the reverse order "
+         "of their creation.");
+  for (size_t i = block_index_ + 1; i < arena_->blocks_.size(); ++i) {
+    arena_->blocks_[i].used = 0;
+  }
+  if (not arena_->blocks_.empty()) {
+    arena_->blocks_[block_index_].used = used_in_block_;
+  }
+  arena_->current_block_ = block_index_;
+  --arena_->number_of_active_scopes_;
+  if (arena_->number_of_active_scopes_ == 0 and arena_->blocks_.size() > 1) {
+    arena_->merge_blocks();
+  }
+}
+
+gsl::span<double> ScratchArena::Scope::allocate(const size_t size) {
+  ASSERT(arena_->current_block_ >= block_index_,
+         "Allocating from a ScratchArena::Scope that is not the innermost "
+         "active scope.");
+  if (size == 0) {
+    return {};
+  }
+  auto& blocks = arena_->blocks_;
+  size_t& current = arena_->current_block_;
+  const auto fits = [&blocks, &size](const size_t block_index) {
+    return blocks[block_index].capacity - blocks[block_index].used >= size;
+  };
+  // Blocks after the current one are unused, so they can be skipped to if the
+  // current block is too full.
+  while (not blocks.empty() and not fits(current) and
+         current + 1 < blocks.size()) {
+    ++current;
+  }
+  if (blocks.empty() or not fits(current)) {
+    // Grow geometrically so that a kernel that keeps asking for more memory
+    // only allocates a logarithmic number of times.
+    arena_->add_block(std::max(size, arena_->capacity()));
+    current = blocks.size() - 1;
+  }
+  auto& block = blocks[current];
+  double* const start = &block.data[block.used];
+  block.used += size;
+#ifdef SPECTRE_DEBUG
+  std::fill(start, start + size, std::numeric_limits<double>::signaling_NaN());
+#endif
+  return {start, size};
+}
+
+ScratchArena& ScratchArena::local() {
+  thread_local ScratchArena arena{};
+  return arena;
+}
+
+size_t ScratchArena::capacity() const {
+  size_t result = 0;
+  for (const auto& block : blocks_) {
+    result += block.capacity;
+  }
+  return result;
+}
+
+size_t ScratchArena::size_in_use() const {
+  size_t result = 0;
+  for (const auto& block : blocks_) {
+    result += block.used;
+  }
+  return result;
+}
+
+void ScratchArena::add_block(const size_t capacity) {
+  blocks_.push_back(
+      Block{cpp20::make_unique_for_overwrite<double[]>(capacity), capacity, 0});
+  ++number_of_heap_allocations_;
+}
+
+void ScratchArena::merge_blocks() {
+  ASSERT(size_in_use() == 0,
+         "Can only merge the blocks of a ScratchArena when no memory is in "
+         "use.");
+  const size_t total_capacity = capacity();
+  blocks_.clear();
+  current_block_ = 0;
+  add_block(total_capacity);
+}
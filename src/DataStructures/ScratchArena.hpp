@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief A stack-like bump allocator of `double`s that is reused between
+ * invocations of a kernel so that repeated invocations do not allocate heap
+ * memory.
+ *
+ * \details Memory is obtained from the arena through a `ScratchArena::Scope`.
+ * All memory handed out by `Scope::allocate()` remains valid until the `Scope`
+ * is destroyed, at which point it can be reused. Scopes may be nested, but
+ * must be destroyed in the reverse order of their creation (which is
+ * automatic if they are only ever created on the stack).
+ *
+ * When the arena does not have enough capacity for an allocation it allocates
+ * an additional block from the heap and increments
+ * `number_of_heap_allocations()`. When the outermost `Scope` is destroyed, all
+ * blocks are merged into a single block that is large enough to hold
+ * everything that was allocated at once. A kernel that requests the same
+ * amount of memory every time it is invoked therefore only allocates during
+ * its first invocation, which can be confirmed by checking that
+ * `number_of_heap_allocations()` does not change during steady-state
+ * operation.
+ *
+ * `Variables` and `TempBuffer`s that use memory from the arena can be
+ * constructed with `Scope::make_variables()`. These are non-owning, so they
+ * must not outlive the `Scope` they were created from.
+ *
+ * The arena returned by `ScratchArena::local()` is shared by everything
+ * running on the current thread (i.e. the current PE when running with
+ * Charm++). Since actions cannot be interrupted, it is safe to use it for
+ * temporaries that are only needed during a single action invocation.
+ *
+ * \note The arena is not serialized. It only holds temporary data, and a
+ * migrated element simply uses the arena of its new PE.
+ */
+class ScratchArena {
+ public:
+  /*!
+   * \brief Grants access to the memory of a `ScratchArena`. All memory
+   * allocated through the `Scope` is released when the `Scope` is destroyed.
+   */
+  class Scope {
+   public:
+    explicit Scope(gsl::not_null<ScratchArena*> arena);
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+    Scope(Scope&&) = delete;
+    Scope& operator=(Scope&&) = delete;
+    ~Scope();
+
+    /// \brief Returns `size` contiguous `double`s.
+    ///
+    /// \warning The memory is not initialized. In Debug builds it is filled
+    /// with signaling NaNs.
+    gsl::span<double> allocate(size_t size);
+
+    /// \brief Returns a non-owning `Variables` (or `TempBuffer`) of
+    /// `VariablesType` that uses memory from the arena.
+    template <typename VariablesType>
+    VariablesType make_variables(const size_t number_of_grid_points) {
+      const size_t size =
+          VariablesType::number_of_independent_components *
+          number_of_grid_points;
+      return VariablesType{allocate(size).data(), size};
+    }
+
+   private:
+    ScratchArena* arena_;
+    size_t block_index_;
+    size_t used_in_block_;
+  };
+
+  ScratchArena() = default;
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+  ScratchArena(ScratchArena&&) = default;
+  ScratchArena& operator=(ScratchArena&&) = default;
+  ~ScratchArena() = default;
+
+  /// The arena shared by all code running on the current thread.
+  static ScratchArena& local();
+
+  /// Total number of `double`s the arena can hand out without allocating.
+  size_t capacity() const;
+
+  /// Number of `double`s currently handed out to active `Scope`s.
+  size_t size_in_use() const;
+
+  /// Number of times the arena allocated memory from the heap. This includes
+  /// the allocations done when merging blocks.
+  size_t number_of_heap_allocations() const {
+    return number_of_heap_allocations_;
+  }
+
+  /// Number of currently active `Scope`s.
+  size_t number_of_active_scopes() const { return number_of_active_scopes_; }
+
+ private:
+  struct Block {
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    std::unique_ptr<double[]> data{};
+    size_t capacity{0};
+    size_t used{0};
+  };
+
+  void add_block(size_t capacity);
+  void merge_blocks();
+
+  std::vector<Block> blocks_{};
+  size_t current_block_{0};
+  size_t number_of_heap_allocations_{0};
+  size_t number_of_active_scopes_{0};
+};
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <blaze/math/Subvector.h>
 #include <complex>
 #include <cstddef>
 #include <type_traits>
@@ -115,6 +117,12 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
  * entire RHS expression as one expression. See`TensorExpression` documentation
  * on equation splitting for more details on what this means.
  *
+ * If `EvaluateInChunks == true`, the entire RHS expression is evaluated for
+ * all LHS components on one chunk of `chunk_size` grid points before moving on
+ * to the next chunk, so that the operands of each chunk stay in cache. This
+ * requires `EvaluateSubtrees == false` and vector LHS components. See
+ * `tenex::evaluate_chunked`.
+ *
  * If `EvaluateSubtrees == false`, then it's safe if the LHS tensor is used in
  * the RHS expression, so long as the generic index orders are the same. This
  * means that the callee of this function needs to first verify this is true
@@ -138,21 +146,27 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
  *
  * @tparam EvaluateSubtrees whether or not to evaluate subtrees of RHS
  * expression
+ * @tparam EvaluateInChunks whether or not to evaluate the RHS expression one
+ * chunk of grid points at a time
  * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
  * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
  * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
  * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ * @param chunk_size the number of grid points per chunk, only used if
+ * `EvaluateInChunks == true`
  */
-template <bool EvaluateSubtrees, auto&... LhsTensorIndices,
-          typename LhsDataType, typename LhsSymmetry, typename LhsIndexList,
-          typename Derived, typename RhsDataType, typename RhsSymmetry,
-          typename RhsIndexList, typename... RhsTensorIndices>
+template <bool EvaluateSubtrees, bool EvaluateInChunks,
+          auto&... LhsTensorIndices, typename LhsDataType, typename LhsSymmetry,
+          typename LhsIndexList, typename Derived, typename RhsDataType,
+          typename RhsSymmetry, typename RhsIndexList,
+          typename... RhsTensorIndices>
 void evaluate_impl(
     const gsl::not_null<Tensor<LhsDataType, LhsSymmetry, LhsIndexList>*>
         lhs_tensor,
     const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
                            tmpl::list<RhsTensorIndices...>>&
-        rhs_tensorexpression) {
+        rhs_tensorexpression,
+    const size_t chunk_size = 0) {
   constexpr size_t num_lhs_indices = sizeof...(LhsTensorIndices);
   constexpr size_t num_rhs_indices = sizeof...(RhsTensorIndices);
 
@@ -231,8 +245,15 @@ void evaluate_impl(
                 "size_t value, then there is a flaw in the logic for computing "
                 "the derived TensorExpression types' member, "
                 "height_relative_to_closest_tensor_leaf_in_subtree.");
-
-  if constexpr (EvaluateSubtrees) {
+  static_assert(not(EvaluateSubtrees and EvaluateInChunks),
+                "Chunked evaluation evaluates the RHS expression as a whole, "
+                "so it cannot be combined with evaluating subtrees.");
+  static_assert(not EvaluateInChunks or
+                    is_derived_of_vector_impl_v<LhsDataType>,
+                "Chunked evaluation is only possible when the LHS Tensor "
+                "holds vector components, e.g. DataVector.");
+
+  if constexpr (EvaluateSubtrees or EvaluateInChunks) {
     // Make sure the LHS tensor doesn't also appear in the RHS tensor expression
     (~rhs_tensorexpression).assert_lhs_tensor_not_in_rhs_expression(lhs_tensor);
     // If the LHS data type is a vector, size the LHS tensor components if their
@@ -271,6 +292,15 @@ void evaluate_impl(
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
+  // Only used for chunked evaluation: the storage indices of the LHS
+  // components to evaluate and the corresponding RHS multi-indices
+  [[maybe_unused]] std::array<size_t, lhs_tensor_type::size()>
+      lhs_storage_indices{};
+  [[maybe_unused]] std::array<std::array<size_t, num_rhs_indices>,
+                              lhs_tensor_type::size()>
+      rhs_multi_indices{};
+  [[maybe_unused]] size_t number_of_evaluated_components = 0;
+
   for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
     auto lhs_multi_index =
         lhs_tensor_type::structure::get_canonical_tensor_index(i);
@@ -307,12 +337,35 @@ void evaluate_impl(
               (~rhs_tensorexpression)
                   .get_primary((*lhs_tensor)[i], rhs_multi_index);
         }
+      } else if constexpr (EvaluateInChunks) {
+        // defer the evaluation until all components are known so that the
+        // loop over chunks can be the outer loop
+        gsl::at(lhs_storage_indices, number_of_evaluated_components) = i;
+        gsl::at(rhs_multi_indices, number_of_evaluated_components) =
+            rhs_multi_index;
+        ++number_of_evaluated_components;
       } else {
         // the expression is not split up, so evaluate full expression
         (*lhs_tensor)[i] = (~rhs_tensorexpression).get(rhs_multi_index);
       }
     }
   }
+
+  if constexpr (EvaluateInChunks) {
+    ASSERT(chunk_size > 0, "The chunk size must be positive.");
+    const size_t component_size = (*lhs_tensor)[0].size();
+    for (size_t offset = 0; offset < component_size; offset += chunk_size) {
+      const size_t size_of_chunk =
+          std::min(chunk_size, component_size - offset);
+      for (size_t k = 0; k < number_of_evaluated_components; ++k) {
+        blaze::subvector((*lhs_tensor)[gsl::at(lhs_storage_indices, k)], offset,
+                         size_of_chunk) =
+            blaze::subvector(
+                (~rhs_tensorexpression).get(gsl::at(rhs_multi_indices, k)),
+                offset, size_of_chunk);
+      }
+    }
+  }
 }
 
 /*!
@@ -456,10 +509,64 @@ void evaluate(
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
   constexpr bool evaluate_subtrees =
       rhs_expression_type::primary_subtree_contains_primary_start;
-  detail::evaluate_impl<evaluate_subtrees, LhsTensorIndices...>(
+  detail::evaluate_impl<evaluate_subtrees, false, LhsTensorIndices...>(
       lhs_tensor, rhs_tensorexpression);
 }
 
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Default number of grid points per chunk used by
+ * `tenex::evaluate_chunked`
+ *
+ * \details With this many points a chunk of a `DataVector` occupies 2 KB, so
+ * the chunks of a few dozen operands fit in L1 or L2 cache.
+ */
+constexpr size_t default_evaluation_chunk_size = 256;
+
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief Assign the result of a RHS tensor expression to a tensor with the LHS
+ * index order set in the template parameters, evaluating the expression one
+ * chunk of grid points at a time
+ *
+ * \details See documentation for `tenex::evaluate` for basic functionality.
+ *
+ * `tenex::evaluate` evaluates each LHS component over all grid points before
+ * moving on to the next component, so for long equations every operand is
+ * streamed through memory once for each LHS component.
+ * `tenex::evaluate_chunked` instead evaluates all LHS components on a chunk of `chunk_size` grid points
+ * before moving on to the next chunk, so that the operands of each chunk are
+ * reused from cache. The RHS expression is always evaluated as a whole, i.e. it
+ * is never split into subtrees (see the `TensorExpression` documentation).
+ *
+ * This overload may only be used with LHS tensors holding vector components,
+ * e.g. `DataVector`. As with `tenex::evaluate`, the LHS `Tensor` cannot be part
+ * of the RHS expression.
+ *
+ * \note `LhsTensorIndices` must be passed by reference because non-type
+ * template parameters cannot be class types until C++20.
+ *
+ * @tparam LhsTensorIndices the `TensorIndex`s of the `Tensor` on the LHS of the
+ * tensor expression, e.g. `ti::a`, `ti::b`, `ti::c`
+ * @param lhs_tensor pointer to the resultant LHS `Tensor` to fill
+ * @param rhs_tensorexpression the RHS TensorExpression to be evaluated
+ * @param chunk_size the number of grid points per chunk
+ */
+template <auto&... LhsTensorIndices, typename LhsDataType, typename LhsSymmetry,
+          typename LhsIndexList, typename Derived, typename RhsDataType,
+          typename RhsSymmetry, typename RhsIndexList,
+          typename... RhsTensorIndices>
+void evaluate_chunked(
+    const gsl::not_null<Tensor<LhsDataType, LhsSymmetry, LhsIndexList>*>
+        lhs_tensor,
+    const TensorExpression<Derived, RhsDataType, RhsSymmetry, RhsIndexList,
+                           tmpl::list<RhsTensorIndices...>>&
+        rhs_tensorexpression,
+    const size_t chunk_size = default_evaluation_chunk_size) {
+  detail::evaluate_impl<false, true, LhsTensorIndices...>(
+      lhs_tensor, rhs_tensorexpression, chunk_size);
+}
+
 /// @{
 /*!
  * \ingroup TensorExpressionsGroup
@@ -625,7 +732,7 @@ void update(
       .template assert_lhs_tensorindices_same_in_rhs<lhs_tensorindex_list>(
           lhs_tensor);
 
-  detail::evaluate_impl<false, LhsTensorIndices...>(lhs_tensor,
-                                                    rhs_tensorexpression);
+  detail::evaluate_impl<false, false, LhsTensorIndices...>(
+      lhs_tensor, rhs_tensorexpression);
 }
 }  // namespace tenex
@@ -2,11 +2,15 @@
 // See LICENSE.txt for details.
 
 /// \file
-/// Defines function transpose
+/// Defines functions transpose and transpose_in_place
 
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
@@ -15,8 +19,10 @@
 namespace detail {
 void transpose_impl(double* matrix_transpose, const double* matrix,
                     int32_t number_of_rows, int32_t number_of_columns);
-}  // namespace detail
 
+void transpose_in_place_impl(double* matrix, int32_t number_of_rows,
+                             int32_t number_of_columns);
+}  // namespace detail
 
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Function to compute transposed data.
@@ -108,3 +114,32 @@ T transpose(const U& u, const size_t chunk_size,
   return t;
 }
 /// @}
+
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Transpose the data in `u` in place.
+///
+/// Equivalent to `*u = transpose(*u, chunk_size, number_of_chunks)` but
+/// without allocating a new `U`. Square transposes of `double`s are done by
+/// swapping across the diagonal, all others transpose out of a copy in the
+/// thread's `ScratchArena`.
+///
+/// \requires `u->size()` to be the product of `number_of_chunks` and
+/// `chunk_size`.
+template <typename U>
+void transpose_in_place(const gsl::not_null<U*> u, const size_t chunk_size,
+                        const size_t number_of_chunks) {
+  ASSERT(chunk_size * number_of_chunks == u->size(),
+         "chunk_size = " << chunk_size << ", number_of_chunks = "
+                         << number_of_chunks << ", size = " << u->size());
+  using value_type = std::decay_t<decltype(*u->data())>;
+  if constexpr (std::is_same_v<double, value_type>) {
+    detail::transpose_in_place_impl(u->data(),
+                                    static_cast<int32_t>(number_of_chunks),
+                                    static_cast<int32_t>(chunk_size));
+  } else {
+    const std::vector<value_type> copy(u->data(),
+                                       u->data() + u->size());  // NOLINT
+    raw_transpose(make_not_null(u->data()), copy.data(), chunk_size,
+                  number_of_chunks);
+  }
+}
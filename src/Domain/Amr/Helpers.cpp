@@ -7,6 +7,7 @@
 #include <boost/rational.hpp>
 #include <cstddef>
 #include <deque>
+#include <unordered_set>
 
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Structure/Direction.hpp"
@@ -169,6 +170,18 @@ std::deque<ElementId<VolumeDim>> ids_of_joining_neighbors(
   return result;
 }
 
+template <size_t VolumeDim>
+std::unordered_set<ElementId<VolumeDim>> ids_of_neighbors(
+    const Element<VolumeDim>& element) {
+  std::unordered_set<ElementId<VolumeDim>> result{};
+  result.reserve(element.number_of_neighbors());
+  for (const auto& [direction, neighbors] : element.neighbors()) {
+    (void)direction;
+    result.insert(neighbors.ids().begin(), neighbors.ids().end());
+  }
+  return result;
+}
+
 template <size_t VolumeDim>
 bool is_child_that_creates_parent(const ElementId<VolumeDim>& element_id,
                                   const std::array<Flag, VolumeDim>& flags) {
@@ -224,6 +237,8 @@ bool prevent_element_from_joining_while_splitting(
   template std::deque<ElementId<DIM(data)>> ids_of_joining_neighbors(          \
       const Element<DIM(data)>& element,                                       \
       const std::array<Flag, DIM(data)>& flags);                               \
+  template std::unordered_set<ElementId<DIM(data)>> ids_of_neighbors(          \
+      const Element<DIM(data)>& element);                                      \
   template bool is_child_that_creates_parent(                                  \
       const ElementId<DIM(data)>& element_id,                                  \
       const std::array<Flag, DIM(data)>& flags);                               \
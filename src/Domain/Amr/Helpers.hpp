@@ -10,6 +10,7 @@
 #include <boost/rational.hpp>
 #include <cstddef>
 #include <deque>
+#include <unordered_set>
 #include <vector>
 
 #include "Domain/Amr/Flag.hpp"
@@ -107,6 +108,16 @@ std::deque<ElementId<VolumeDim>> ids_of_joining_neighbors(
     const Element<VolumeDim>& element,
     const std::array<Flag, VolumeDim>& flags);
 
+/// \ingroup AmrGroup
+/// \brief The ElementIds of all face neighbors of `element`
+///
+/// \details An Element that is a neighbor in several directions (e.g. in a
+/// periodic domain with two elements) is listed only once, so sending one
+/// message to each of the returned ids sends no duplicate messages.
+template <size_t VolumeDim>
+std::unordered_set<ElementId<VolumeDim>> ids_of_neighbors(
+    const Element<VolumeDim>& element);
+
 /// \ingroup AmrGroup
 /// \brief Whether or not the Element is the child that should create the parent
 /// Element when joining elements
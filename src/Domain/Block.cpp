@@ -11,6 +11,7 @@
 #include <typeinfo>
 #include <utility>
 
+#include "Domain/CoordinateMaps/PupSharedMap.hpp"
 #include "Domain/Structure/BlockNeighbor.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
@@ -124,11 +125,12 @@ void Block<VolumeDim>::pup(PUP::er& p) {
   // function. Retain support for unpacking data written by previous versions
   // whenever possible. See `Domain` docs for details.
   if (version >= 0) {
-    p | stationary_map_;
-    p | moving_mesh_logical_to_grid_map_;
-    p | moving_mesh_grid_to_inertial_map_;
-    p | moving_mesh_grid_to_distorted_map_;
-    p | moving_mesh_distorted_to_inertial_map_;
+    // Serialized like the `std::unique_ptr`s these used to be
+    domain::pup_shared_map(p, stationary_map_);
+    domain::pup_shared_map(p, moving_mesh_logical_to_grid_map_);
+    domain::pup_shared_map(p, moving_mesh_grid_to_inertial_map_);
+    domain::pup_shared_map(p, moving_mesh_grid_to_distorted_map_);
+    domain::pup_shared_map(p, moving_mesh_distorted_to_inertial_map_);
     p | id_;
     p | neighbors_;
     p | external_boundaries_;
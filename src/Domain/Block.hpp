@@ -101,6 +101,24 @@ class Block {
   const domain::CoordinateMapBase<Frame::Distorted, Frame::Inertial, VolumeDim>&
   moving_mesh_distorted_to_inertial_map() const;
 
+  /// \brief The stationary_map() and moving_mesh_logical_to_grid_map(), or
+  /// `nullptr` if they don't exist, for sharing them instead of cloning them.
+  ///
+  /// The `ElementMap`s of the elements in the block should share these maps,
+  /// so that the maps are stored once per block rather than once per element.
+  /// @{
+  const std::shared_ptr<const domain::CoordinateMapBase<
+      Frame::BlockLogical, Frame::Inertial, VolumeDim>>&
+  shared_stationary_map() const {
+    return stationary_map_;
+  }
+  const std::shared_ptr<const domain::CoordinateMapBase<
+      Frame::BlockLogical, Frame::Grid, VolumeDim>>&
+  shared_moving_mesh_logical_to_grid_map() const {
+    return moving_mesh_logical_to_grid_map_;
+  }
+  /// @}
+
   /// \brief Returns `true` if the block has time-dependent maps.
   bool is_time_dependent() const { return stationary_map_ == nullptr; }
 
@@ -169,20 +187,21 @@ class Block {
   friend bool operator==(const Block<LocalVolumeDim>& lhs,
                          const Block<LocalVolumeDim>& rhs);
 
-  std::unique_ptr<domain::CoordinateMapBase<Frame::BlockLogical,
-                                            Frame::Inertial, VolumeDim>>
+  // The maps are immutable, so they can be shared with e.g. the ElementMaps
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                  Frame::Inertial, VolumeDim>>
       stationary_map_{nullptr};
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::BlockLogical, Frame::Grid, VolumeDim>>
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                  Frame::Grid, VolumeDim>>
       moving_mesh_logical_to_grid_map_{nullptr};
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>>
+  std::shared_ptr<
+      const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, VolumeDim>>
       moving_mesh_grid_to_inertial_map_{nullptr};
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::Grid, Frame::Distorted, VolumeDim>>
+  std::shared_ptr<
+      const domain::CoordinateMapBase<Frame::Grid, Frame::Distorted, VolumeDim>>
       moving_mesh_grid_to_distorted_map_{nullptr};
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::Distorted, Frame::Inertial, VolumeDim>>
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::Distorted,
+                                                  Frame::Inertial, VolumeDim>>
       moving_mesh_distorted_to_inertial_map_{nullptr};
 
   size_t id_{0};
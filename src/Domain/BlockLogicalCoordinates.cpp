@@ -3,17 +3,26 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Block.hpp"
 #include "Domain/Domain.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/BlockId.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -23,6 +32,200 @@ using block_logical_coord_holder =
                          tnsr::I<double, Dim, typename ::Frame::BlockLogical>>>;
 using functions_of_time_type = std::unordered_map<
     std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+template <size_t Dim>
+using BoundingBox = std::array<std::pair<double, double>, Dim>;
+
+// The block logical coordinates of the points `x_frame` that are in `block`.
+// All components of the points that are not in `block` are NaN.
+template <size_t Dim, typename Frame>
+tnsr::I<DataVector, Dim, ::Frame::BlockLogical> logical_coordinates_in_block(
+    const Block<Dim>& block, tnsr::I<DataVector, Dim, Frame> x_frame,
+    const double time, const functions_of_time_type& functions_of_time) {
+  const size_t num_points = get<0>(x_frame).size();
+  tnsr::I<DataVector, Dim, ::Frame::BlockLogical> x_logical{};
+  if (block.is_time_dependent()) {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      // Points are in the inertial frame, so we need to map to the grid
+      // frame and then the logical frame.
+      // logical to grid map is time-independent.
+      x_logical = block.moving_mesh_logical_to_grid_map().inverse(
+          block.moving_mesh_grid_to_inertial_map().inverse(
+              std::move(x_frame), time, functions_of_time));
+    } else if constexpr (std::is_same_v<Frame, ::Frame::Distorted>) {
+      // Points are in the distorted frame, so we need to map to the grid
+      // frame and then the logical frame.
+      if (not block.has_distorted_frame()) {
+        // Note that block.has_distorted_frame() can be different for
+        // different Blocks.  However, the template parameter Frame is
+        // compile-time and is the same for all Blocks.
+        //
+        // Explanation of the logic here:
+        // 1. Recall that block_logical_coordinates loops through all the
+        //    Blocks, and skips all the Blocks except for the first Block
+        //    it finds that contains the point x.
+        // 2. If Frame is ::Frame::Distorted but
+        //    block.has_distorted_frame() is false, then this block
+        //    cannot contain the point x. Therefore, we should simply
+        //    skip this block.  If it turns out that no blocks contain
+        //    the point x, then we will get an error later.
+        //    (Note that our primary use case for ::Frame::Distorted is to
+        //    find an apparent horizon in the distorted frame. In that
+        //    case, only the Blocks near a horizon have a distorted frame
+        //    because only those Blocks have distortion maps. Thus,
+        //    the Blocks that are skipped here are those that are far
+        //    from horizons).
+        return tnsr::I<DataVector, Dim, ::Frame::BlockLogical>{
+            num_points, std::numeric_limits<double>::quiet_NaN()};
+      }
+      // logical to grid map is time-independent.
+      x_logical = block.moving_mesh_logical_to_grid_map().inverse(
+          block.moving_mesh_grid_to_distorted_map().inverse(
+              std::move(x_frame), time, functions_of_time));
+    } else {
+      // frame is different than ::Frame::Inertial or ::Frame::Distorted.
+      // Currently 'time' is unused in this branch.
+      // To make the compiler happy, need to trick it to think that
+      // 'time' is used.
+      (void) time;
+      // Currently we only support Grid, Distorted and Inertial
+      // frames in the block, so make sure Frame is
+      // ::Frame::Grid. (The Inertial and Distorted cases were
+      // handled above.)
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+
+      // Points are in the grid frame, just map to logical frame.
+      x_logical =
+          block.moving_mesh_logical_to_grid_map().inverse(std::move(x_frame));
+    }
+  } else {  // not block.is_time_dependent()
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      x_logical = block.stationary_map().inverse(std::move(x_frame));
+    } else {
+      // If the map is time-independent, then the grid, distorted, and
+      // inertial frames are the same.  So if we are in the grid
+      // or distorted frames, convert to the inertial frame
+      // (this conversion is just a type conversion).
+      // Otherwise throw a static_assert.
+      static_assert(std::is_same_v<Frame, ::Frame::Grid> or
+                        std::is_same_v<Frame, ::Frame::Distorted>,
+                    "Cannot convert from given frame to Inertial frame");
+      tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+      for (size_t d = 0; d < Dim; ++d) {
+        x_inertial.get(d) = std::move(x_frame.get(d));
+      }
+      x_logical = block.stationary_map().inverse(std::move(x_inertial));
+    }
+  }
+  for (size_t s = 0; s < num_points; ++s) {
+    bool is_contained = true;
+    for (size_t d = 0; d < Dim; ++d) {
+      double& x = x_logical.get(d)[s];
+      // The inverse failed at this point.
+      if (std::isnan(x)) {
+        is_contained = false;
+        break;
+      }
+      // Map inverses may report logical coordinates outside [-1, 1] due to
+      // numerical roundoff error. In that case we clamp them to -1 or 1 so
+      // that a consistent block is chosen here independent of roundoff
+      // error. Without this correction, points on block boundaries where
+      // both blocks report logical coordinates outside [-1, 1] by roundoff
+      // error would not be assigned to any block at all, even though they
+      // lie in the domain.
+      if (equal_within_roundoff(x, 1.0)) {
+        x = 1.0;
+        continue;
+      }
+      if (equal_within_roundoff(x, -1.0)) {
+        x = -1.0;
+        continue;
+      }
+      is_contained = is_contained and abs(x) <= 1.0;
+    }
+    if (not is_contained) {
+      for (size_t d = 0; d < Dim; ++d) {
+        x_logical.get(d)[s] = std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
+  return x_logical;
+}
+
+// The number of points per dimension at which the map of a block is sampled
+// to find its bounding box.
+constexpr size_t samples_per_dim = 5;
+
+// Points found in a block within this distance of its boundary in logical
+// coordinates are also looked for in the blocks with smaller block_ids.
+constexpr double boundary_tolerance = 1.0e-10;
+
+// An approximate bounding box of `block` in `Frame` at `time`, found by mapping
+// a grid of block logical points, or `std::nullopt` if the block cannot contain
+// points in `Frame`. Curved blocks can bulge past the samples, so the box is
+// padded, and it is only used to choose which blocks to try first.
+template <typename Frame, size_t Dim>
+std::optional<BoundingBox<Dim>> approximate_bounding_box(
+    const Block<Dim>& block, const size_t num_samples, const double time,
+    const functions_of_time_type& functions_of_time) {
+  tnsr::I<DataVector, Dim, ::Frame::BlockLogical> x_logical{num_samples};
+  for (size_t i = 0; i < num_samples; ++i) {
+    size_t index = i;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto sample = static_cast<double>(index % samples_per_dim);
+      x_logical.get(d)[i] =
+          -1.0 + 2.0 * sample / static_cast<double>(samples_per_dim - 1);
+      index /= samples_per_dim;
+    }
+  }
+  tnsr::I<DataVector, Dim, Frame> x_frame{};
+  if (block.is_time_dependent()) {
+    auto x_grid = block.moving_mesh_logical_to_grid_map()(x_logical);
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      x_frame = block.moving_mesh_grid_to_inertial_map()(x_grid, time,
+                                                         functions_of_time);
+    } else if constexpr (std::is_same_v<Frame, ::Frame::Distorted>) {
+      if (not block.has_distorted_frame()) {
+        return std::nullopt;
+      }
+      x_frame = block.moving_mesh_grid_to_distorted_map()(x_grid, time,
+                                                          functions_of_time);
+    } else {
+      x_frame = std::move(x_grid);
+    }
+  } else {
+    const auto x_inertial = block.stationary_map()(x_logical);
+    for (size_t d = 0; d < Dim; ++d) {
+      x_frame.get(d) = x_inertial.get(d);
+    }
+  }
+  BoundingBox<Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const double lower = min(x_frame.get(d));
+    const double upper = max(x_frame.get(d));
+    const double padding = 0.1 * (upper - lower);
+    gsl::at(result, d) = {lower - padding, upper + padding};
+  }
+  return result;
+}
+
+// Whether the point `s` of `x_frame` is in `box`.
+template <size_t Dim, typename Frame>
+bool is_in_bounding_box(const std::optional<BoundingBox<Dim>>& box,
+                        const tnsr::I<DataVector, Dim, Frame>& x_frame,
+                        const size_t s) {
+  if (not box.has_value()) {
+    return false;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    if (x_frame.get(d)[s] < gsl::at(*box, d).first or
+        x_frame.get(d)[s] > gsl::at(*box, d).second) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace
 
 template <size_t Dim, typename Frame>
@@ -30,153 +233,111 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
     const double time, const functions_of_time_type& functions_of_time) {
   const size_t num_pts = get<0>(x).size();
+  const auto& blocks = domain.blocks();
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
-    tnsr::I<double, Dim, Frame> x_frame(0.0);
-    for (size_t d = 0; d < Dim; ++d) {
-      x_frame.get(d) = x.get(d)[s];
-    }
-    tnsr::I<double, Dim, typename ::Frame::BlockLogical> x_logical{};
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
-      if (block.is_time_dependent()) {
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          // Point is in the inertial frame, so we need to map to the grid
-          // frame and then the logical frame.
-          const auto moving_inv =
-              block.moving_mesh_grid_to_inertial_map().inverse(
-                  x_frame, time, functions_of_time);
-          if (not moving_inv.has_value()) {
-            continue;
-          }
-          // logical to grid map is time-independent.
-          const auto inv = block.moving_mesh_logical_to_grid_map().inverse(
-              moving_inv.value());
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else if constexpr (std::is_same_v<Frame, ::Frame::Distorted>) {
-          // Point is in the distorted frame, so we need to map to the grid
-          // frame and then the logical frame.
-          if (not block.has_distorted_frame()) {
-            // Note that block.has_distorted_frame() can be different for
-            // different Blocks.  However, the template parameter Frame is
-            // compile-time and is the same for all Blocks.
-            //
-            // Explanation of the logic here:
-            // 1. Recall that block_logical_coordinates loops through all the
-            //    Blocks, and skips all the Blocks except for the first Block
-            //    it finds that contains the point x.
-            // 2. If Frame is ::Frame::Distorted but
-            //    block.has_distorted_frame() is false, then this block
-            //    cannot contain the point x. Therefore, we should simply
-            //    skip this block.  If it turns out that no blocks contain
-            //    the point x, then we will get an error later.
-            //    (Note that our primary use case for ::Frame::Distorted is to
-            //    find an apparent horizon in the distorted frame. In that
-            //    case, only the Blocks near a horizon have a distorted frame
-            //    because only those Blocks have distortion maps. Thus,
-            //    the Blocks that are skipped here are those that are far
-            //    from horizons).
-            continue; // Not in this block
-          }
-          const auto moving_inv =
-              block.moving_mesh_grid_to_distorted_map().inverse(
-                  x_frame, time, functions_of_time);
-          if (not moving_inv.has_value()) {
-            continue; // Not in this block
-          }
-          // logical to grid map is time-independent.
-          const auto inv = block.moving_mesh_logical_to_grid_map().inverse(
-              moving_inv.value());
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {
-          // frame is different than ::Frame::Inertial or ::Frame::Distorted.
-          // Currently 'time' is unused in this branch.
-          // To make the compiler happy, need to trick it to think that
-          // 'time' is used.
-          (void) time;
-          // Currently we only support Grid, Distorted and Inertial
-          // frames in the block, so make sure Frame is
-          // ::Frame::Grid. (The Inertial and Distorted cases were
-          // handled above.)
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-
-          // Point is in the grid frame, just map to logical frame.
-          const auto inv =
-              block.moving_mesh_logical_to_grid_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        }
-      } else {  // not block.is_time_dependent()
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          const auto inv = block.stationary_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {
-          // If the map is time-independent, then the grid, distorted, and
-          // inertial frames are the same.  So if we are in the grid
-          // or distorted frames, convert to the inertial frame
-          // (this conversion is just a type conversion).
-          // Otherwise throw a static_assert.
-          static_assert(std::is_same_v<Frame, ::Frame::Grid> or
-                            std::is_same_v<Frame, ::Frame::Distorted>,
-                        "Cannot convert from given frame to Inertial frame");
-          tnsr::I<double, Dim, ::Frame::Inertial> x_inertial(0.0);
-          for (size_t d = 0; d < Dim; ++d) {
-            x_inertial.get(d) = x_frame.get(d);
-          }
-          const auto inv = block.stationary_map().inverse(x_inertial);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        }
+
+  // The bounding boxes of the blocks propose which blocks to try first.
+  // Building them costs one map evaluation per sample, so they pay off only
+  // if there are at least as many points as samples in a block.
+  size_t num_samples = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    num_samples *= samples_per_dim;
+  }
+  std::vector<std::optional<BoundingBox<Dim>>> bounding_boxes{};
+  if (num_pts >= num_samples) {
+    bounding_boxes.reserve(blocks.size());
+    for (const auto& block : blocks) {
+      bounding_boxes.push_back(approximate_bounding_box<Frame>(
+          block, num_samples, time, functions_of_time));
+    }
+  }
+
+  // The index of the block that each point was found in.
+  std::vector<std::optional<size_t>> found_in(num_pts);
+  // Looks for all the points `indices` in the block `block_index` at once.
+  std::vector<size_t> indices{};
+  const auto try_block = [&block_coord_holders, &blocks, &found_in,
+                          &functions_of_time, &indices, &time,
+                          &x](const size_t block_index) {
+    if (indices.empty()) {
+      return;
+    }
+    tnsr::I<DataVector, Dim, Frame> x_frame(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      for (size_t d = 0; d < Dim; ++d) {
+        x_frame.get(d)[i] = x.get(d)[indices[i]];
       }
-      bool is_contained = true;
+    }
+    const auto x_logical = logical_coordinates_in_block(
+        blocks[block_index], std::move(x_frame), time, functions_of_time);
+    for (size_t i = 0; i < indices.size(); ++i) {
+      if (std::isnan(get<0>(x_logical)[i])) {
+        continue;
+      }
+      tnsr::I<double, Dim, ::Frame::BlockLogical> x_logical_point{};
       for (size_t d = 0; d < Dim; ++d) {
-        // Map inverses may report logical coordinates outside [-1, 1] due to
-        // numerical roundoff error. In that case we clamp them to -1 or 1 so
-        // that a consistent block is chosen here independent of roundoff error.
-        // Without this correction, points on block boundaries where both blocks
-        // report logical coordinates outside [-1, 1] by roundoff error would
-        // not be assigned to any block at all, even though they lie in the
-        // domain.
-        if (equal_within_roundoff(x_logical.get(d), 1.0)) {
-          x_logical.get(d) = 1.0;
-          continue;
-        }
-        if (equal_within_roundoff(x_logical.get(d), -1.0)) {
-          x_logical.get(d) = -1.0;
-          continue;
-        }
-        is_contained = is_contained and abs(x_logical.get(d)) <= 1.0;
+        x_logical_point.get(d) = x_logical.get(d)[i];
       }
-      if (is_contained) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
-        block_coord_holders[s] =
-            make_id_pair(domain::BlockId(block.id()), std::move(x_logical));
-        break;
+      block_coord_holders[indices[i]] =
+          make_id_pair(domain::BlockId(blocks[block_index].id()),
+                       std::move(x_logical_point));
+      found_in[indices[i]] = block_index;
+    }
+  };
+
+  // Check which block each point is in. Each point will be in one
+  // and only one block, unless it is on a shared boundary.  In that
+  // case, choose the first matching block (and this block will have
+  // the smallest block_id).  The blocks are tried in order, each for all
+  // the points that are not yet found at once, so that the map inverses
+  // are evaluated for many points at a time.  With bounding boxes, a block
+  // is first tried only for the points in its box.
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    indices.clear();
+    for (size_t s = 0; s < num_pts; ++s) {
+      if (not found_in[s].has_value() and
+          (bounding_boxes.empty() or
+           is_in_bounding_box(bounding_boxes[i], x, s))) {
+        indices.push_back(s);
+      }
+    }
+    try_block(i);
+  }
+  if (bounding_boxes.empty()) {
+    return block_coord_holders;
+  }
+
+  // The points that were not found may be in a block whose approximate
+  // bounding box does not contain them.  A point on (or, given the
+  // roundoff error of the map inverses, near) the boundary of its block may
+  // also be in a block with a smaller block_id whose box does not contain
+  // it.  Try the remaining blocks in order for these points.
+  std::vector<size_t> remaining{};
+  for (size_t s = 0; s < num_pts; ++s) {
+    if (not found_in[s].has_value()) {
+      remaining.push_back(s);
+      continue;
+    }
+    const auto& x_logical = block_coord_holders[s]->data;
+    bool is_on_boundary = false;
+    for (size_t d = 0; d < Dim; ++d) {
+      is_on_boundary = is_on_boundary or
+                       equal_within_roundoff(abs(x_logical.get(d)), 1.0,
+                                             boundary_tolerance);
+    }
+    if (is_on_boundary and *found_in[s] > 0) {
+      remaining.push_back(s);
+    }
+  }
+  for (size_t i = 0; i < blocks.size() and not remaining.empty(); ++i) {
+    indices.clear();
+    for (const size_t s : remaining) {
+      if ((not found_in[s].has_value() or *found_in[s] > i) and
+          not is_in_bounding_box(bounding_boxes[i], x, s)) {
+        indices.push_back(s);
       }
     }
+    try_block(i);
   }
   return block_coord_holders;
 }
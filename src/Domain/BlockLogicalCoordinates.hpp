@@ -36,6 +36,11 @@ class Domain;
 /// returned only once, and is considered to belong to the `Block`
 /// with the smaller `BlockId`.
 ///
+/// For many points, the blocks whose bounding boxes (found by mapping a few
+/// block logical points to `Frame` at `time`) contain a point are tried first,
+/// so usually only one map inverse is needed per point. The boxes only
+/// reorder the search, so the result is the same as checking all blocks.
+///
 /// \warning Since map inverses can involve numerical roundoff error, care must
 /// be taken with points on shared block boundaries. They will be assigned to
 /// the first block (by block ID) that contains the point _within roundoff
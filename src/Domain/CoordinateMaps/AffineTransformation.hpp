@@ -0,0 +1,106 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace domain::FunctionsOfTime {
+class FunctionOfTime;
+}  // namespace domain::FunctionsOfTime
+/// \endcond
+
+namespace domain {
+namespace CoordinateMaps {
+/*!
+ * \ingroup CoordinateMapsGroup
+ * \brief The affine transformation \f$x^i \to M^i{}_j x^j + b^i\f$.
+ *
+ * \details Time-dependent maps that are affine at a given time, such as rigid
+ * rotations and uniform translations, can provide the member function
+ *
+ * \code
+ * std::optional<AffineTransformation<Dim>> affine_transformation(
+ *     double time,
+ *     const std::unordered_map<
+ *         std::string,
+ *         std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+ *         functions_of_time) const;
+ * \endcode
+ *
+ * which returns the transformation at `time`, or `std::nullopt` if the map is
+ * not affine, e.g. because of a radial falloff. `domain::CoordinateMap` then
+ * composes consecutive affine maps into a single transformation before
+ * applying them to the points, and uses the matrix \f$M\f$ as their Jacobian.
+ * This way a chain like an expansion, a rotation, and a translation passes over
+ * the points only once.
+ */
+template <size_t Dim>
+struct AffineTransformation {
+  std::array<std::array<double, Dim>, Dim> matrix{};
+  std::array<double, Dim> offset{};
+
+  /// The transformation that applies `first` and then `*this`
+  AffineTransformation after(const AffineTransformation& first) const {
+    AffineTransformation result{};
+    result.offset = offset;
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t k = 0; k < Dim; ++k) {
+        const double matrix_ik = gsl::at(gsl::at(matrix, i), k);
+        for (size_t j = 0; j < Dim; ++j) {
+          gsl::at(gsl::at(result.matrix, i), j) +=
+              matrix_ik * gsl::at(gsl::at(first.matrix, k), j);
+        }
+        gsl::at(result.offset, i) += matrix_ik * gsl::at(first.offset, k);
+      }
+    }
+    return result;
+  }
+
+  template <typename T>
+  std::array<T, Dim> operator()(const std::array<T, Dim>& source_coords) const {
+    std::array<T, Dim> result{};
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(result, i) = gsl::at(offset, i) +
+                           gsl::at(matrix, i)[0] * source_coords[0];
+      for (size_t j = 1; j < Dim; ++j) {
+        gsl::at(result, i) +=
+            gsl::at(gsl::at(matrix, i), j) * gsl::at(source_coords, j);
+      }
+    }
+    return result;
+  }
+};
+
+namespace detail {
+template <typename Map, typename = std::void_t<>>
+struct has_affine_transformation : std::false_type {};
+
+using FunctionsOfTimeMap = std::unordered_map<
+    std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+template <typename Map>
+struct has_affine_transformation<
+    Map, std::void_t<decltype(std::declval<const Map&>().affine_transformation(
+             std::declval<double>(),
+             std::declval<const FunctionsOfTimeMap&>()))>> : std::true_type {};
+}  // namespace detail
+}  // namespace CoordinateMaps
+
+/// \ingroup CoordinateMapsGroup
+/// Whether the time-dependent coordinate map `Map` provides an
+/// `affine_transformation`, see `CoordinateMaps::AffineTransformation`
+template <typename Map>
+constexpr bool has_affine_transformation_v =
+    CoordinateMaps::detail::has_affine_transformation<
+        std::decay_t<Map>>::value;
+}  // namespace domain
@@ -37,6 +37,15 @@ bool Composition<Frames, Dim, std::index_sequence<Is...>>::is_identity() const {
   return result;
 }
 
+template <typename Frames, size_t Dim, size_t... Is>
+bool Composition<Frames, Dim, std::index_sequence<Is...>>::preserves_distances()
+    const {
+  bool result = true;
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (result = result and get<Is>(maps_)->preserves_distances()));
+  return result;
+}
+
 template <typename Frames, size_t Dim, size_t... Is>
 bool Composition<Frames, Dim,
                  std::index_sequence<Is...>>::inv_jacobian_is_time_dependent()
@@ -81,6 +90,38 @@ Composition<Frames, Dim, std::index_sequence<Is...>>::inverse(
   return inverse_impl(std::move(target_point), time, functions_of_time);
 }
 
+template <typename Frames, size_t Dim, size_t... Is>
+tnsr::I<DataVector, Dim, tmpl::front<Frames>>
+Composition<Frames, Dim, std::index_sequence<Is...>>::inverse(
+    tnsr::I<DataVector, Dim, tmpl::back<Frames>> target_points,
+    const double time, const FuncOfTimeMap& functions_of_time) const {
+  std::tuple<tnsr::I<DataVector, Dim, SourceFrame>,
+             tnsr::I<DataVector, Dim,
+                     tmpl::at<frames, tmpl::size_t<Is + 1>>>...>
+      points{};
+  get<num_frames - 1>(points) = std::move(target_points);
+  const auto apply_inverse = [&points, &time, &functions_of_time,
+                              this](const auto index_v) {
+    constexpr size_t index = decltype(index_v)::value;
+    // index runs from 0 to num_frames - 2. We evaluate maps in reverse order.
+    // Points at which an inverse failed are NaN and stay NaN.
+    auto& local_target_points = get<num_frames - index - 1>(points);
+    auto& local_source_points = get<num_frames - index - 2>(points);
+    const auto& map = *get<num_frames - index - 2>(maps_);
+    if (UNLIKELY(map.is_identity())) {
+      for (size_t d = 0; d < Dim; ++d) {
+        local_source_points.get(d) = std::move(local_target_points.get(d));
+      }
+    } else {
+      local_source_points = map.inverse(std::move(local_target_points), time,
+                                        functions_of_time);
+    }
+    return '0';
+  };
+  EXPAND_PACK_LEFT_TO_RIGHT(apply_inverse(tmpl::size_t<Is>{}));
+  return std::move(get<0>(points));
+}
+
 template <typename Frames, size_t Dim, size_t... Is>
 InverseJacobian<double, Dim, tmpl::front<Frames>, tmpl::back<Frames>>
 Composition<Frames, Dim, std::index_sequence<Is...>>::inv_jacobian(
@@ -112,6 +112,8 @@ struct Composition<Frames, Dim, std::index_sequence<Is...>>
 
   bool is_identity() const override;
 
+  bool preserves_distances() const override;
+
   bool inv_jacobian_is_time_dependent() const override;
 
   bool jacobian_is_time_dependent() const override;
@@ -136,6 +138,11 @@ struct Composition<Frames, Dim, std::index_sequence<Is...>>
       double time = std::numeric_limits<double>::signaling_NaN(),
       const FuncOfTimeMap& functions_of_time = {}) const override;
 
+  tnsr::I<DataVector, Dim, SourceFrame> inverse(
+      tnsr::I<DataVector, Dim, TargetFrame> target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const FuncOfTimeMap& functions_of_time = {}) const override;
+
   InverseJacobian<double, Dim, SourceFrame, TargetFrame> inv_jacobian(
       tnsr::I<double, Dim, SourceFrame> source_point,
       double time = std::numeric_limits<double>::signaling_NaN(),
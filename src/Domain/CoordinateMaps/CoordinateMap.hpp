@@ -78,6 +78,11 @@ class CoordinateMapBase : public PUP::able {
   /// Returns `true` if the map is the identity
   virtual bool is_identity() const = 0;
 
+  /// Returns `true` if the map is known to preserve the distances between
+  /// points at all times, i.e. it is a rigid motion such as a rotation or a
+  /// uniform translation.
+  virtual bool preserves_distances() const = 0;
+
   /// Returns `true` if the inverse Jacobian depends on time.
   virtual bool inv_jacobian_is_time_dependent() const = 0;
 
@@ -134,6 +139,24 @@ class CoordinateMapBase : public PUP::able {
       const = 0;
   /// @}
 
+  /// @{
+  /// Apply the inverse `Maps` to all of the points `target_points`.
+  /// The components of the points at which the inverse fails, as it would
+  /// for the `std::optional` returned by the inverse for a single point, are
+  /// set to NaN. The maps that have an inverse for a `DataVector` of points
+  /// invert all points at once, and the others one point at a time.
+  virtual tnsr::I<DataVector, Dim, SourceFrame> inverse(
+      tnsr::I<DataVector, Dim, TargetFrame> target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const = 0;
+  /// @}
+
   /// @{
   /// Compute the inverse Jacobian of the `Maps` at the point(s)
   /// `source_point`
@@ -288,6 +311,10 @@ class CoordinateMap
   /// Returns `true` if the map is the identity
   bool is_identity() const override;
 
+  /// Returns `true` if each of the `Maps` is the identity or has a
+  /// `preserves_distances()` member function that returns `true`.
+  bool preserves_distances() const override;
+
   /// Returns `true` if the inverse Jacobian depends on time.
   bool inv_jacobian_is_time_dependent() const override;
 
@@ -345,6 +372,21 @@ class CoordinateMap
     return inverse_impl(std::move(target_point), time, functions_of_time,
                         std::make_index_sequence<sizeof...(Maps)>{});
   }
+
+  tnsr::I<DataVector, dim, SourceFrame> inverse(
+      tnsr::I<DataVector, dim, TargetFrame> target_points,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const override {
+    return batched_inverse_impl(std::move(target_points), time,
+                                functions_of_time,
+                                std::make_index_sequence<sizeof...(Maps)>{});
+  }
   /// @}
 
   /// @{
@@ -535,6 +577,15 @@ class CoordinateMap
           functions_of_time,
       std::index_sequence<Is...> /*meta*/) const;
 
+  template <size_t... Is>
+  tnsr::I<DataVector, dim, SourceFrame> batched_inverse_impl(
+      tnsr::I<DataVector, dim, TargetFrame>&& target_points, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time,
+      std::index_sequence<Is...> /*meta*/) const;
+
   template <typename T>
   InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jacobian_impl(
       tnsr::I<T, dim, SourceFrame>&& source_point, double time,
@@ -21,9 +21,12 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/AffineTransformation.hpp"
 #include "Domain/CoordinateMaps/CoordinateMapHelpers.hpp"
+#include "Domain/CoordinateMaps/HasDiagonalJacobian.hpp"
 #include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -40,6 +43,8 @@ namespace domain {
 namespace CoordinateMap_detail {
 CREATE_IS_CALLABLE(function_of_time_names)
 CREATE_IS_CALLABLE_V(function_of_time_names)
+CREATE_IS_CALLABLE(preserves_distances)
+CREATE_IS_CALLABLE_V(preserves_distances)
 
 template <typename T>
 struct map_type {
@@ -110,6 +115,22 @@ bool CoordinateMap<SourceFrame, TargetFrame, Maps...>::is_identity() const {
       maps_, std::make_index_sequence<sizeof...(Maps)>{});
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+bool CoordinateMap<SourceFrame, TargetFrame, Maps...>::preserves_distances()
+    const {
+  bool result = true;
+  tuple_fold(maps_, [&result](const auto& map) {
+    using Map = std::decay_t<decltype(map)>;
+    if constexpr (CoordinateMap_detail::is_preserves_distances_callable_v<
+                      Map>) {
+      result = result and (map.is_identity() or map.preserves_distances());
+    } else {
+      result = result and map.is_identity();
+    }
+  });
+  return result;
+}
+
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
 bool CoordinateMap<SourceFrame, TargetFrame,
                    Maps...>::inv_jacobian_is_time_dependent() const {
@@ -153,22 +174,47 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::call_impl(
   check_functions_of_time(functions_of_time);
   std::array<T, dim> mapped_point = make_array<T, dim>(std::move(source_point));
 
+  // Consecutive maps that are affine at `time` are composed into a single
+  // transformation, which is applied to the points once.
+  std::optional<CoordinateMaps::AffineTransformation<dim>> affine_maps{};
+  const auto apply_affine_maps = [&affine_maps](std::array<T, dim>& point) {
+    if (affine_maps.has_value()) {
+      point = (*affine_maps)(point);
+      affine_maps.reset();
+    }
+  };
+
   EXPAND_PACK_LEFT_TO_RIGHT(
-      [](const auto& the_map, std::array<T, dim>& point, const double t,
-         const std::unordered_map<
-             std::string,
-             std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
-             funcs_of_time) {
+      [&affine_maps, &apply_affine_maps](
+          const auto& the_map, std::array<T, dim>& point, const double t,
+          const std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+              funcs_of_time) {
         if constexpr (domain::is_map_time_dependent_t<decltype(the_map)>{}) {
+          if constexpr (domain::has_affine_transformation_v<
+                            decltype(the_map)>) {
+            auto transformation =
+                the_map.affine_transformation(t, funcs_of_time);
+            if (transformation.has_value()) {
+              affine_maps = affine_maps.has_value()
+                                ? transformation->after(*affine_maps)
+                                : *transformation;
+              return;
+            }
+          }
+          apply_affine_maps(point);
           point = the_map(point, t, funcs_of_time);
         } else {
           (void)t;
           (void)funcs_of_time;
           if (LIKELY(not the_map.is_identity())) {
+            apply_affine_maps(point);
             point = the_map(point);
           }
         }
       }(std::get<Is>(maps_), mapped_point, time, functions_of_time));
+  apply_affine_maps(mapped_point);
 
   return tnsr::I<T, dim, TargetFrame>(std::move(mapped_point));
 }
@@ -217,6 +263,31 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
              : std::optional<tnsr::I<T, dim, SourceFrame>>{};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+template <size_t... Is>
+tnsr::I<DataVector, CoordinateMap<SourceFrame, TargetFrame, Maps...>::dim,
+        SourceFrame>
+CoordinateMap<SourceFrame, TargetFrame, Maps...>::batched_inverse_impl(
+    tnsr::I<DataVector, dim, TargetFrame>&& target_points, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    std::index_sequence<Is...> /*meta*/) const {
+  check_functions_of_time(functions_of_time);
+  std::array<DataVector, dim> mapped_points =
+      make_array<DataVector, dim>(std::move(target_points));
+
+  // this is the inverse function, so the iterator sequence below is reversed
+  EXPAND_PACK_LEFT_TO_RIGHT([&mapped_points, &time,
+                             &functions_of_time](const auto& the_map) {
+    CoordinateMap_detail::apply_batched_inverse_map(
+        make_not_null(&mapped_points), the_map, time, functions_of_time,
+        domain::is_map_time_dependent_t<decltype(the_map)>{});
+  }(std::get<sizeof...(Maps) - 1 - Is>(maps_)));
+
+  return tnsr::I<DataVector, dim, SourceFrame>(std::move(mapped_points));
+}
+
 namespace detail {
 template <typename T, typename Map, size_t Dim>
 void get_jacobian(
@@ -273,7 +344,8 @@ void get_inv_jacobian(
 template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
 void multiply_jacobian(
     const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> jac,
-    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_jac) {
+    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_jac,
+    std::false_type /*noframe_jac_is_diagonal*/) {
   std::array<T, Dim> temp{};
   for (size_t source = 0; source < Dim; ++source) {
     for (size_t target = 0; target < Dim; ++target) {
@@ -289,10 +361,44 @@ void multiply_jacobian(
   }
 }
 
+template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+void multiply_jacobian(
+    const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> jac,
+    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_jac,
+    std::true_type /*noframe_jac_is_diagonal*/) {
+  for (size_t target = 0; target < Dim; ++target) {
+    for (size_t source = 0; source < Dim; ++source) {
+      jac->get(target, source) *= noframe_jac.get(target, target);
+    }
+  }
+}
+
+template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+void multiply_jacobian(
+    const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> jac,
+    const std::array<std::array<double, Dim>, Dim>& affine_matrix) {
+  std::array<T, Dim> temp{};
+  for (size_t source = 0; source < Dim; ++source) {
+    for (size_t target = 0; target < Dim; ++target) {
+      gsl::at(temp, target) =
+          gsl::at(affine_matrix, target)[0] * jac->get(0, source);
+      for (size_t dummy = 1; dummy < Dim; ++dummy) {
+        gsl::at(temp, target) +=
+            gsl::at(gsl::at(affine_matrix, target), dummy) *
+            jac->get(dummy, source);
+      }
+    }
+    for (size_t target = 0; target < Dim; ++target) {
+      jac->get(target, source) = std::move(gsl::at(temp, target));
+    }
+  }
+}
+
 template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
 void multiply_inv_jacobian(
     const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> inv_jac,
-    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_inv_jac) {
+    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_inv_jac,
+    std::false_type /*noframe_inv_jac_is_diagonal*/) {
   std::array<T, Dim> temp{};
   for (size_t source = 0; source < Dim; ++source) {
     for (size_t target = 0; target < Dim; ++target) {
@@ -308,6 +414,18 @@ void multiply_inv_jacobian(
     }
   }
 }
+
+template <typename T, size_t Dim, typename SourceFrame, typename TargetFrame>
+void multiply_inv_jacobian(
+    const gsl::not_null<Jacobian<T, Dim, SourceFrame, TargetFrame>*> inv_jac,
+    const tnsr::Ij<T, Dim, Frame::NoFrame>& noframe_inv_jac,
+    std::true_type /*noframe_inv_jac_is_diagonal*/) {
+  for (size_t source = 0; source < Dim; ++source) {
+    for (size_t target = 0; target < Dim; ++target) {
+      inv_jac->get(source, target) *= noframe_inv_jac.get(target, target);
+    }
+  }
+}
 }  // namespace detail
 
 template <typename SourceFrame, typename TargetFrame, typename... Maps>
@@ -344,7 +462,9 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::inv_jacobian_impl(
       detail::get_inv_jacobian(make_not_null(&noframe_inv_jac), map,
                                mapped_point, time, functions_of_time,
                                domain::is_jacobian_time_dependent_t<Map, T>{});
-      detail::multiply_inv_jacobian(make_not_null(&inv_jac), noframe_inv_jac);
+      detail::multiply_inv_jacobian(
+          make_not_null(&inv_jac), noframe_inv_jac,
+          std::bool_constant<domain::has_diagonal_jacobian_v<Map>>{});
     }
 
     // Compute the source coordinates for the next map, only if we are not
@@ -386,10 +506,24 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::jacobian_impl(
         }
       }
     } else if (LIKELY(not map.is_identity())) {
+      if constexpr (domain::has_affine_transformation_v<Map>) {
+        const auto transformation =
+            map.affine_transformation(time, functions_of_time);
+        if (transformation.has_value()) {
+          detail::multiply_jacobian(make_not_null(&jac),
+                                    transformation->matrix);
+          if (count + 1 != sizeof...(Maps)) {
+            mapped_point = (*transformation)(mapped_point);
+          }
+          return;
+        }
+      }
       detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point, time,
                            functions_of_time,
                            domain::is_jacobian_time_dependent_t<Map, T>{});
-      detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
+      detail::multiply_jacobian(
+          make_not_null(&jac), noframe_jac,
+          std::bool_constant<domain::has_diagonal_jacobian_v<Map>>{});
     }
 
     // Compute the source coordinates for the next map, only if we are not
@@ -441,27 +575,24 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
                   tnsr::I<T, dim, TargetFrame>> {
   check_functions_of_time(functions_of_time);
   std::array<T, dim> mapped_point = make_array<T, dim>(std::move(source_point));
-  InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jac{};
   Jacobian<T, dim, SourceFrame, TargetFrame> jac{};
   tnsr::I<T, dim, TargetFrame> frame_velocity{};
 
+  // The inverse Jacobian is not composed map by map, but computed from the
+  // composed Jacobian once all the maps have been applied. That saves the
+  // evaluation of the inverse Jacobian of every map, which for many maps
+  // inverts their Jacobian anyway, and the products of the inverse Jacobians.
   tuple_transform(
       maps_,
-      [&frame_velocity, &inv_jac, &jac, &mapped_point, time,
-       &functions_of_time](const auto& map, auto index,
-                           const std::tuple<Maps...>& maps) {
+      [&frame_velocity, &jac, &mapped_point, time, &functions_of_time](
+          const auto& map, auto index, const std::tuple<Maps...>& maps) {
         constexpr size_t count = decltype(index)::value;
         using Map = std::decay_t<decltype(map)>;
 
         tnsr::Ij<T, dim, Frame::NoFrame> noframe_jac{};
-        tnsr::Ij<T, dim, Frame::NoFrame> noframe_inv_jac{};
 
         if (UNLIKELY(count == 0)) {
-          // Set Jacobian and inverse Jacobian
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
+          // Set Jacobian
           detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
                                time, functions_of_time,
                                domain::is_jacobian_time_dependent_t<Map, T>{});
@@ -469,8 +600,6 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
             for (size_t source = 0; source < dim; ++source) {
               jac.get(target, source) =
                   std::move(noframe_jac.get(target, source));
-              inv_jac.get(source, target) =
-                  std::move(noframe_inv_jac.get(source, target));
             }
           }
 
@@ -496,18 +625,39 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
           // velocity is also zero. That is, we do not optimize for the map
           // being instantaneously zero.
 
-          detail::get_inv_jacobian(
-              make_not_null(&noframe_inv_jac), map, mapped_point, time,
-              functions_of_time,
-              domain::is_jacobian_time_dependent_t<Map, T>{});
+          if constexpr (domain::has_affine_transformation_v<Map>) {
+            const auto transformation =
+                map.affine_transformation(time, functions_of_time);
+            if (transformation.has_value()) {
+              detail::multiply_jacobian(make_not_null(&jac),
+                                        transformation->matrix);
+              std::array<T, dim> noframe_frame_velocity =
+                  map.frame_velocity(mapped_point, time, functions_of_time);
+              for (size_t i = 0; i < dim; ++i) {
+                for (size_t j = 0; j < dim; ++j) {
+                  gsl::at(noframe_frame_velocity, i) +=
+                      gsl::at(gsl::at(transformation->matrix, i), j) *
+                      frame_velocity.get(j);
+                }
+              }
+              for (size_t i = 0; i < dim; ++i) {
+                using std::swap;
+                swap(gsl::at(noframe_frame_velocity, i),
+                     frame_velocity.get(i));
+              }
+              mapped_point = (*transformation)(mapped_point);
+              return;
+            }
+          }
+
           detail::get_jacobian(make_not_null(&noframe_jac), map, mapped_point,
                                time, functions_of_time,
                                domain::is_jacobian_time_dependent_t<Map, T>{});
 
-          // Perform matrix multiplication for Jacobian and inverse Jacobian
-          detail::multiply_inv_jacobian(make_not_null(&inv_jac),
-                                        noframe_inv_jac);
-          detail::multiply_jacobian(make_not_null(&jac), noframe_jac);
+          // Perform matrix multiplication for Jacobian
+          detail::multiply_jacobian(
+              make_not_null(&jac), noframe_jac,
+              std::bool_constant<domain::has_diagonal_jacobian_v<Map>>{});
 
           // Set frame velocity, only if map is time-dependent
           std::array<T, dim> noframe_frame_velocity{};
@@ -548,11 +698,30 @@ auto CoordinateMap<SourceFrame, TargetFrame, Maps...>::
         }
 
         // Update to the next mapped point
-        CoordinateMap_detail::apply_map(
-            make_not_null(&mapped_point), map, time, functions_of_time,
-            domain::is_map_time_dependent_t<decltype(map)>{});
+        if (not map.is_identity()) {
+          CoordinateMap_detail::apply_map(
+              make_not_null(&mapped_point), map, time, functions_of_time,
+              domain::is_map_time_dependent_t<decltype(map)>{});
+        }
       },
       maps_);
+  auto inv_jac = [&jac]() {
+    if constexpr ((domain::has_diagonal_jacobian_v<Maps> and ...)) {
+      InverseJacobian<T, dim, SourceFrame, TargetFrame> result{};
+      for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim; ++j) {
+          if (i == j) {
+            result.get(i, i) = 1.0 / jac.get(i, i);
+          } else {
+            result.get(i, j) = make_with_value<T>(jac.get(i, j), 0.0);
+          }
+        }
+      }
+      return result;
+    } else {
+      return determinant_and_inverse(jac).second;
+    }
+  }();
   return std::tuple<tnsr::I<T, dim, TargetFrame>,
                     InverseJacobian<T, dim, SourceFrame, TargetFrame>,
                     Jacobian<T, dim, SourceFrame, TargetFrame>,
@@ -4,11 +4,16 @@
 #pragma once
 
 #include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
@@ -138,6 +143,64 @@ auto apply_inverse_map(
 }
 /// @}
 
+/// Whether the time-independent `Map` has an `inverse` for all points in a
+/// `std::array<DataVector, Dim>` at once
+template <typename Map, size_t Dim, typename = std::void_t<>>
+struct has_batched_inverse : std::false_type {};
+
+/// \cond
+template <typename Map, size_t Dim>
+struct has_batched_inverse<
+    Map, Dim,
+    std::void_t<decltype(std::declval<const Map&>().inverse(
+        std::declval<const std::array<DataVector, Dim>&>()))>>
+    : std::true_type {};
+/// \endcond
+
+/// Apply the inverse of `the_map` to all of the points `target_points`.
+///
+/// The inverse is applied to all points at once if the map has a batched
+/// `inverse`, and one point at a time otherwise. The components of the points
+/// at which the inverse fails are set to NaN, and points that are already NaN
+/// are skipped.
+template <size_t Dim, typename Map, bool IsTimeDependent>
+void apply_batched_inverse_map(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_points,
+    const Map& the_map, const double t,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    const std::bool_constant<IsTimeDependent> is_time_dependent) {
+  if constexpr (not IsTimeDependent) {
+    if (UNLIKELY(the_map.is_identity())) {
+      return;
+    }
+    if constexpr (has_batched_inverse<Map, Dim>::value) {
+      *target_points = the_map.inverse(*target_points);
+      return;
+    }
+  }
+  const size_t num_points = (*target_points)[0].size();
+  std::array<double, Dim> point{};
+  for (size_t s = 0; s < num_points; ++s) {
+    bool is_masked = false;
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(point, d) = gsl::at(*target_points, d)[s];
+      is_masked = is_masked or std::isnan(gsl::at(point, d));
+    }
+    if (is_masked) {
+      continue;
+    }
+    const auto source_point = apply_inverse_map(
+        the_map, point, t, functions_of_time, is_time_dependent);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(*target_points, d)[s] =
+          source_point.has_value() ? gsl::at(*source_point, d)
+                                   : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+}
+
 /// @{
 /// Compute the frame velocity
 template <typename T, size_t Dim, typename Map>
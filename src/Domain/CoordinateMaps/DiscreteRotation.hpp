@@ -64,6 +64,7 @@ class DiscreteRotation {
   void pup(PUP::er& p);
 
   bool is_identity() const { return is_identity_; }
+  static bool preserves_distances() { return true; }
 
  private:
   friend bool operator==(const DiscreteRotation& lhs,
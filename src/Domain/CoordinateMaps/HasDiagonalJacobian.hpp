@@ -0,0 +1,36 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <type_traits>
+
+namespace domain {
+namespace CoordinateMaps::detail {
+template <typename Map, typename = std::void_t<>>
+struct declares_diagonal_jacobian : std::false_type {};
+
+template <typename Map>
+struct declares_diagonal_jacobian<
+    Map, std::void_t<decltype(Map::has_diagonal_jacobian)>>
+    : std::bool_constant<Map::has_diagonal_jacobian> {};
+}  // namespace CoordinateMaps::detail
+
+/*!
+ * \ingroup CoordinateMapsGroup
+ * \brief Whether the Jacobian of the coordinate map `Map` is diagonal at every
+ * point.
+ *
+ * \details This is true for all one-dimensional maps, such as
+ * `CoordinateMaps::Affine` and `CoordinateMaps::Equiangular`, and for maps that
+ * declare `static constexpr bool has_diagonal_jacobian = true;`, such as
+ * products of one-dimensional maps. The Jacobians of these maps are still
+ * returned as full tensors, but the `CoordinateMap` skips the off-diagonal
+ * components when composing them and inverts them component by component.
+ */
+template <typename Map>
+constexpr bool has_diagonal_jacobian_v =
+    std::decay_t<Map>::dim == 1 or
+    CoordinateMaps::detail::declares_diagonal_jacobian<
+        std::decay_t<Map>>::value;
+}  // namespace domain
@@ -28,6 +28,7 @@ template <size_t Dim>
 class Identity {
  public:
   static constexpr size_t dim = Dim;
+  static constexpr bool has_diagonal_jacobian = true;
 
   Identity() = default;
   ~Identity() = default;
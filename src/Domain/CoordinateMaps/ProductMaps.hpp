@@ -13,6 +13,7 @@
 #include <utility>
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/HasDiagonalJacobian.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -35,6 +36,8 @@ template <typename Map1, typename Map2>
 class ProductOf2Maps {
  public:
   static constexpr size_t dim = Map1::dim + Map2::dim;
+  static constexpr bool has_diagonal_jacobian =
+      has_diagonal_jacobian_v<Map1> and has_diagonal_jacobian_v<Map2>;
   using map_list = tmpl::list<Map1, Map2>;
   static_assert(dim == 2 or dim == 3,
                 "Only 2D and 3D maps are supported by ProductOf2Maps");
@@ -89,6 +92,9 @@ template <typename Map1, typename Map2, typename Map3>
 class ProductOf3Maps {
  public:
   static constexpr size_t dim = Map1::dim + Map2::dim + Map3::dim;
+  static constexpr bool has_diagonal_jacobian =
+      has_diagonal_jacobian_v<Map1> and has_diagonal_jacobian_v<Map2> and
+      has_diagonal_jacobian_v<Map3>;
   using map_list = tmpl::list<Map1, Map2, Map3>;
   static_assert(dim == 3, "Only 3D maps are implemented for ProductOf3Maps");
 
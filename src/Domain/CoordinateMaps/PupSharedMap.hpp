@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace domain {
+/*!
+ * \ingroup CoordinateMapsGroup
+ * \brief Serializes a coordinate map that is shared by several owners, e.g. a
+ * `Block` and the `ElementMap`s of its elements.
+ *
+ * \details The map is serialized like a `std::unique_ptr` to it, so owners can
+ * switch between the two without changing their serialization. When unpacking,
+ * a map that serializes to the same data as a map already unpacked in this
+ * process, and still in use, is replaced by that map. This way the maps stay
+ * shared after e.g. loading a checkpoint or migrating elements.
+ *
+ * `Map` must be a `PUP::able` type such as `domain::CoordinateMapBase`. The
+ * maps must not be modified after they are shared.
+ */
+template <typename Map>
+void pup_shared_map(PUP::er& p,  // NOLINT(google-runtime-references)
+                    std::shared_ptr<const Map>& map) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto* map_ptr = const_cast<Map*>(map.get());
+  p | map_ptr;
+  if (not p.isUnpacking()) {
+    return;
+  }
+  map.reset(map_ptr);
+  if (map == nullptr) {
+    return;
+  }
+
+  PUP::sizer sizer;
+  sizer | map_ptr;
+  std::string serialized_map(sizer.size(), '\0');
+  PUP::toMem writer(serialized_map.data());
+  writer | map_ptr;
+
+  static std::mutex unpacked_maps_mutex{};
+  static std::unordered_map<std::string, std::weak_ptr<const Map>>
+      unpacked_maps{};
+  const std::lock_guard lock(unpacked_maps_mutex);
+  if (const auto unpacked_map = unpacked_maps.find(serialized_map);
+      unpacked_map != unpacked_maps.end()) {
+    if (auto shared_map = unpacked_map->second.lock(); shared_map != nullptr) {
+      map = std::move(shared_map);
+      return;
+    }
+  }
+  for (auto it = unpacked_maps.begin(); it != unpacked_maps.end();) {
+    it = it->second.expired() ? unpacked_maps.erase(it) : std::next(it);
+  }
+  unpacked_maps.insert_or_assign(std::move(serialized_map), map);
+}
+}  // namespace domain
@@ -82,6 +82,7 @@ class Rotation<2> {
   void pup(PUP::er& p);
 
   bool is_identity() const { return is_identity_; }
+  static bool preserves_distances() { return true; }
 
  private:
   friend bool operator==(const Rotation<2>& lhs, const Rotation<2>& rhs);
@@ -156,6 +157,7 @@ class Rotation<3> {
   void pup(PUP::er& p);
 
   bool is_identity() const { return is_identity_; }
+  static bool preserves_distances() { return true; }
 
  private:
   friend bool operator==(const Rotation<3>& lhs, const Rotation<3>& rhs);
@@ -322,6 +322,23 @@ CubicScale<Dim>::inv_jacobian(
   return inv_jac;
 }
 
+template <size_t Dim>
+std::optional<AffineTransformation<Dim>> CubicScale<Dim>::affine_transformation(
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  if (not functions_of_time_equal_) {
+    return std::nullopt;
+  }
+  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  AffineTransformation<Dim> result{};
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(gsl::at(result.matrix, i), i) = a_of_t;
+  }
+  return result;
+}
+
 template <size_t Dim>
 void CubicScale<Dim>::pup(PUP::er& p) {
   size_t version = 0;
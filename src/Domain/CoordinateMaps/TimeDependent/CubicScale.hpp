@@ -13,6 +13,7 @@
 #include <unordered_set>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/CoordinateMaps/AffineTransformation.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
@@ -155,6 +156,15 @@ class CubicScale {
 
   static bool is_identity() { return false; }
 
+  /// The expansion at `time` if the scaling is linear, see
+  /// `CoordinateMaps::AffineTransformation`
+  std::optional<AffineTransformation<Dim>> affine_transformation(
+      double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time) const;
+
   const std::unordered_set<std::string>& function_of_time_names() const {
     return f_of_t_names_;
   }
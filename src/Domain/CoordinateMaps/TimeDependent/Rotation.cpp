@@ -140,6 +140,23 @@ Rotation<Dim>::inv_jacobian(
   return inv_jacobian_matrix;
 }
 
+template <size_t Dim>
+std::optional<AffineTransformation<Dim>> Rotation<Dim>::affine_transformation(
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  const Matrix rot_matrix =
+      rotation_matrix<Dim>(time, *(functions_of_time.at(f_of_t_name_)));
+  AffineTransformation<Dim> result{};
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      gsl::at(gsl::at(result.matrix, i), j) = rot_matrix(i, j);
+    }
+  }
+  return result;
+}
+
 template <size_t Dim>
 void Rotation<Dim>::pup(PUP::er& p) {
   size_t version = 0;
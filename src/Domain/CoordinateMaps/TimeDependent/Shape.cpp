@@ -11,6 +11,7 @@
 #include <pup.h>
 #include <pup_stl.h>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 
 #include "DataStructures/DataVector.hpp"
@@ -46,6 +47,7 @@ Shape::Shape(
       l_max_(l_max),
       m_max_(m_max),
       ylm_(l_max, m_max),
+      extended_ylm_(l_max + 1, m_max + 1),
       transition_func_(std::move(transition_func)) {
   f_of_t_names_.insert(shape_f_of_t_name_);
   if (size_f_of_t_name_.has_value()) {
@@ -66,33 +68,63 @@ Shape& Shape::operator=(const Shape& rhs) {
     l_max_ = rhs.l_max_;
     m_max_ = rhs.m_max_;
     ylm_ = rhs.ylm_;
+    extended_ylm_ = rhs.extended_ylm_;
     transition_func_ = rhs.transition_func_->get_clone();
+    std::atomic_store(&interpolation_cache_,
+                      std::atomic_load(&rhs.interpolation_cache_));
   }
   return *this;
 }
 
 Shape::Shape(const Shape& rhs) { *this = rhs; }
 
+template <typename T>
+std::shared_ptr<const Shape::InterpolationCache> Shape::interpolation_cache(
+    const std::array<T, 3>& source_coords,
+    const std::array<DataVector, 2>& theta_phis) const {
+  auto cache = std::atomic_load(&interpolation_cache_);
+  if (cache != nullptr and
+      cache->source_coords[0] == dereference_wrapper(source_coords[0]) and
+      cache->source_coords[1] == dereference_wrapper(source_coords[1]) and
+      cache->source_coords[2] == dereference_wrapper(source_coords[2])) {
+    return cache;
+  }
+  cache = std::make_shared<const InterpolationCache>(InterpolationCache{
+      {{dereference_wrapper(source_coords[0]),
+        dereference_wrapper(source_coords[1]),
+        dereference_wrapper(source_coords[2])}},
+      ylm_.set_up_interpolation_info(theta_phis),
+      extended_ylm_.set_up_interpolation_info(theta_phis)});
+  std::atomic_store(&interpolation_cache_, cache);
+  return cache;
+}
+
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::operator()(
     const std::array<T, 3>& source_coords, const double time,
     const FunctionsOfTimeMap& functions_of_time) const {
+  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const auto centered_coords = center_coordinates(source_coords);
   auto theta_phis = cartesian_to_spherical(centered_coords);
-  const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
   DataVector coefs = functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
   check_size(make_not_null(&coefs), functions_of_time, time, false);
   check_coefficients(coefs);
   // re-use allocation
   auto& distorted_radii = get<0>(theta_phis);
   // evaluate the spherical harmonic expansion at the angles of `source_coords`
-  ylm_.interpolate_from_coefs(make_not_null(&distorted_radii), coefs,
-                              interpolation_info);
+  if constexpr (std::is_same_v<ReturnType, DataVector>) {
+    const auto cache = interpolation_cache(source_coords, theta_phis);
+    ylm_.interpolate_from_coefs(make_not_null(&distorted_radii), coefs,
+                                cache->interpolation_info);
+  } else {
+    const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
+    ylm_.interpolate_from_coefs(make_not_null(&distorted_radii), coefs,
+                                interpolation_info);
+  }
 
   // this should be taken care of by the control system but is very hard to
   // debug
 #ifdef SPECTRE_DEBUG
-  using ReturnType = tt::remove_cvref_wrap_t<T>;
   const ReturnType shift_radii =
       distorted_radii * transition_func_->operator()(centered_coords);
   if constexpr (std::is_same_v<ReturnType, double>) {
@@ -135,15 +167,21 @@ std::array<tt::remove_cvref_wrap_t<T>, 3> Shape::frame_velocity(
     const FunctionsOfTimeMap& functions_of_time) const {
   const auto centered_coords = center_coordinates(source_coords);
   auto theta_phis = cartesian_to_spherical(centered_coords);
-  const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
   DataVector coef_derivs =
       functions_of_time.at(shape_f_of_t_name_)->func_and_deriv(time)[1];
   check_size(make_not_null(&coef_derivs), functions_of_time, time, true);
   check_coefficients(coef_derivs);
   // re-use allocation
   auto& radii_velocities = get<0>(theta_phis);
-  ylm_.interpolate_from_coefs(make_not_null(&radii_velocities), coef_derivs,
-                              interpolation_info);
+  if constexpr (std::is_same_v<tt::remove_cvref_wrap_t<T>, DataVector>) {
+    const auto cache = interpolation_cache(source_coords, theta_phis);
+    ylm_.interpolate_from_coefs(make_not_null(&radii_velocities), coef_derivs,
+                                cache->interpolation_info);
+  } else {
+    const auto interpolation_info = ylm_.set_up_interpolation_info(theta_phis);
+    ylm_.interpolate_from_coefs(make_not_null(&radii_velocities), coef_derivs,
+                                interpolation_info);
+  }
   return -centered_coords * radii_velocities *
          transition_func_->operator()(centered_coords);
 }
@@ -161,14 +199,10 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
   // `m_max_` which causes an aliasing error. We need an additional order to
   // represent it. This is in theory not needed for the distorted_radii
   // calculation but saves calculating the `interpolation_info` twice.
-  const ylm::Spherepack extended_ylm(l_max_ + 1, m_max_ + 1);
-  const auto interpolation_info =
-      extended_ylm.set_up_interpolation_info(theta_phis);
-
   const DataVector coefs =
       functions_of_time.at(shape_f_of_t_name_)->func(time)[0];
   check_coefficients(coefs);
-  DataVector extended_coefs(extended_ylm.spectral_size(), 0.);
+  DataVector extended_coefs(extended_ylm_.spectral_size(), 0.);
 
   // Copy over the coefficients. The additional coefficients of order `l_max_
   // +1` are zero and will only have an effect in the interpolation of the
@@ -186,25 +220,21 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
 
   check_size(make_not_null(&extended_coefs), functions_of_time, time, false);
 
-  // Re-use allocation
-  auto& distorted_radii = get<0>(theta_phis);
-  extended_ylm.interpolate_from_coefs(make_not_null(&distorted_radii),
-                                      extended_coefs, interpolation_info);
   // Calculates the Pfaffian derivative at the internal collocation points of
   // YlmSpherePack. We can't interpolate these directly as they are not smooth
   // across the poles, so we convert them to the Cartesian gradients first,
   // which are smooth.
   const auto angular_gradient =
-      extended_ylm.gradient_from_coefs(extended_coefs);
+      extended_ylm_.gradient_from_coefs(extended_coefs);
 
   tnsr::i<DataVector, 3, Frame::Inertial> cartesian_gradient(
-      extended_ylm.physical_size());
+      extended_ylm_.physical_size());
 
   // Re-use allocations
   std::array<DataVector, 2> collocation_theta_phis{};
   collocation_theta_phis[0].set_data_ref(&get<2>(cartesian_gradient));
   collocation_theta_phis[1].set_data_ref(&get<1>(cartesian_gradient));
-  collocation_theta_phis = extended_ylm.theta_phi_points();
+  collocation_theta_phis = extended_ylm_.theta_phi_points();
 
   const auto& col_thetas = collocation_theta_phis[0];
   const auto& col_phis = collocation_theta_phis[1];
@@ -226,22 +256,39 @@ tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> Shape::jacobian(
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 3, Frame::NoFrame> result(
       get_size(centered_coords[0]));
 
-  // re-use allocation
+  // Re-use allocations
+  auto& distorted_radii = get<0>(theta_phis);
   auto& target_gradient_x = get<2, 0>(result);
   auto& target_gradient_y = get<2, 1>(result);
   auto& target_gradient_z = get<2, 2>(result);
 
-  // interpolate the cartesian gradient to the thetas and phis of the
-  // `source_coords`
-  extended_ylm.interpolate(make_not_null(&target_gradient_x),
-                           get<0>(cartesian_gradient).data(),
-                           interpolation_info);
-  extended_ylm.interpolate(make_not_null(&target_gradient_y),
-                           get<1>(cartesian_gradient).data(),
-                           interpolation_info);
-  extended_ylm.interpolate(make_not_null(&target_gradient_z),
-                           get<2>(cartesian_gradient).data(),
-                           interpolation_info);
+  // Evaluate the distorted radii and interpolate the cartesian gradient to the
+  // thetas and phis of the `source_coords`
+  const auto interpolate_to_source_coords =
+      [this, &extended_coefs, &cartesian_gradient, &distorted_radii,
+       &target_gradient_x, &target_gradient_y,
+       &target_gradient_z](const auto& interpolation_info) {
+        extended_ylm_.interpolate_from_coefs(make_not_null(&distorted_radii),
+                                             extended_coefs,
+                                             interpolation_info);
+        extended_ylm_.interpolate(make_not_null(&target_gradient_x),
+                                  get<0>(cartesian_gradient).data(),
+                                  interpolation_info);
+        extended_ylm_.interpolate(make_not_null(&target_gradient_y),
+                                  get<1>(cartesian_gradient).data(),
+                                  interpolation_info);
+        extended_ylm_.interpolate(make_not_null(&target_gradient_z),
+                                  get<2>(cartesian_gradient).data(),
+                                  interpolation_info);
+      };
+  if constexpr (std::is_same_v<tt::remove_cvref_wrap_t<T>, DataVector>) {
+    interpolate_to_source_coords(
+        interpolation_cache(source_coords, theta_phis)
+            ->extended_interpolation_info);
+  } else {
+    interpolate_to_source_coords(
+        extended_ylm_.set_up_interpolation_info(theta_phis));
+  }
 
   // re-use allocation
   auto& transition_func = get<1>(theta_phis);
@@ -375,6 +422,9 @@ void Shape::pup(PUP::er& p) {
   // No need to pup these because they are uniquely determined by other members
   if (p.isUnpacking()) {
     ylm_ = ylm::Spherepack(l_max_, m_max_);
+    extended_ylm_ = ylm::Spherepack(l_max_ + 1, m_max_ + 1);
+    std::atomic_store(&interpolation_cache_,
+                      std::shared_ptr<const InterpolationCache>{});
     f_of_t_names_.clear();
     f_of_t_names_.insert(shape_f_of_t_name_);
     if (size_f_of_t_name_.has_value()) {
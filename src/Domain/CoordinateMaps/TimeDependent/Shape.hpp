@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_set>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ShapeMapTransitionFunctions/ShapeMapTransitionFunction.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
@@ -140,13 +142,18 @@ namespace domain::CoordinateMaps::TimeDependent {
  *
  * The inverse Jacobian is computed by numerically inverting the Jacobian.
  *
- * For future optimization, the `interpolation_info` objects calculated in all
- * functions of this class could be cached. Since every element should evaluate
- * the same grid coordinates most time steps, this might greatly decrease
- * computation. Every element has their own clone of the shape map so the
- * caching could be done with member variables. Care must be taken that
- * `jacobian` currently calculates the `interpolation_info` with an order
- * higher.
+ * ### Caching
+ *
+ * Evaluating the spherical harmonic expansions at the source points requires
+ * the `ylm::Spherepack::InterpolationInfo` of those points, which only depends
+ * on their angles. Since every element evaluates the map at the same grid
+ * coordinates most time steps, the interpolation info for the last set of
+ * `DataVector` source points is cached, together with the one for the order
+ * higher expansion used by `jacobian`. A time update then only contracts the
+ * new coefficients with the cached info. The cache is replaced whenever the
+ * map is evaluated at different points, and is shared between copies of the
+ * map since it is never modified once created. Evaluations at single `double`
+ * points are not cached.
  */
 class Shape {
  public:
@@ -208,9 +215,26 @@ class Shape {
   size_t l_max_ = 2;
   size_t m_max_ = 2;
   ylm::Spherepack ylm_{2, 2};
+  ylm::Spherepack extended_ylm_{3, 3};
   std::unique_ptr<ShapeMapTransitionFunctions::ShapeMapTransitionFunction>
       transition_func_;
 
+  struct InterpolationCache {
+    std::array<DataVector, 3> source_coords;
+    ylm::Spherepack::InterpolationInfo<DataVector> interpolation_info;
+    ylm::Spherepack::InterpolationInfo<DataVector> extended_interpolation_info;
+  };
+  // Only accessed with `std::atomic_load` and `std::atomic_store`, so that
+  // concurrent evaluations of the map are safe.
+  mutable std::shared_ptr<const InterpolationCache> interpolation_cache_{};
+
+  // The cached interpolation info for the `source_coords`, which has the
+  // angles `theta_phis` about the center, updating the cache if needed.
+  template <typename T>
+  std::shared_ptr<const InterpolationCache> interpolation_cache(
+      const std::array<T, 3>& source_coords,
+      const std::array<DataVector, 2>& theta_phis) const;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, 3> center_coordinates(
       const std::array<T, 3>& coords) const {
@@ -414,6 +414,31 @@ double Translation<Dim>::root_finder(
                                   relative_tol));
 }
 
+template <size_t Dim>
+std::optional<AffineTransformation<Dim>>
+Translation<Dim>::affine_transformation(
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  if (not preserves_distances()) {
+    return std::nullopt;
+  }
+  const DataVector function_of_time =
+      functions_of_time.at(f_of_t_name_)->func(time)[0];
+  ASSERT(function_of_time.size() == Dim,
+         "The dimension of the function of time ("
+             << function_of_time.size()
+             << ") does not match the dimension of the translation map (" << Dim
+             << ").");
+  AffineTransformation<Dim> result{};
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(gsl::at(result.matrix, i), i) = 1.0;
+    gsl::at(result.offset, i) = function_of_time[i];
+  }
+  return result;
+}
+
 template <size_t Dim>
 void Translation<Dim>::pup(PUP::er& p) {
   size_t version = 2;
@@ -12,6 +12,7 @@
 #include <unordered_set>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/CoordinateMaps/AffineTransformation.hpp"
 #include "PointwiseFunctions/MathFunctions/MathFunction.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
@@ -220,6 +221,21 @@ class Translation {
 
   static bool is_identity() { return false; }
 
+  /// Whether the translation is the same everywhere, i.e. has no radial
+  /// falloff
+  bool preserves_distances() const {
+    return f_of_r_ == nullptr and not inner_radius_.has_value();
+  }
+
+  /// The translation at `time` if it has no radial falloff, see
+  /// `CoordinateMaps::AffineTransformation`
+  std::optional<AffineTransformation<Dim>> affine_transformation(
+      double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time) const;
+
   const std::unordered_set<std::string>& function_of_time_names() const {
     return f_of_t_names_;
   }
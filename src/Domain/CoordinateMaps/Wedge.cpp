@@ -5,8 +5,12 @@
 
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <pup.h>
+#include <utility>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -15,6 +19,7 @@
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 
 namespace domain::CoordinateMaps {
@@ -242,6 +247,107 @@ std::optional<std::array<double, Dim>> Wedge<Dim>::inverse(
   return logical_coords;
 }
 
+template <size_t Dim>
+std::array<DataVector, Dim> Wedge<Dim>::inverse(
+    const std::array<DataVector, Dim>& target_coords) const {
+  std::array<DataVector, Dim> physical_coords =
+      discrete_rotation(orientation_of_wedge_.inverse_map(), target_coords);
+  const size_t num_points = physical_coords[radial_coord].size();
+
+  // The points at which the inverse is invalid are masked.  Their
+  // coordinates are replaced by valid ones while the inverse is computed, so
+  // that no floating point exceptions are raised, and the results are set to
+  // NaN at the end.  Points that are already NaN stay NaN.
+  std::vector<bool> is_masked(num_points, false);
+  DataVector& physical_z = physical_coords[radial_coord];
+  for (size_t s = 0; s < num_points; ++s) {
+    if (std::isnan(physical_z[s])) {
+      continue;
+    }
+    if (physical_z[s] < 0.0 or equal_within_roundoff(physical_z[s], 0.0)) {
+      is_masked[s] = true;
+      physical_z[s] = 1.0;
+    }
+  }
+
+  std::array<DataVector, Dim - 1> cap{};
+  cap[0] = physical_coords[polar_coord] / physical_z;
+  DataVector one_over_rho = 1.0 + square(cap[0]);
+  if constexpr (Dim == 3) {
+    cap[1] = physical_coords[azimuth_coord] / physical_z;
+    one_over_rho += square(cap[1]);
+  }
+  one_over_rho = 1.0 / sqrt(one_over_rho);
+  DataVector zeta_coefficient =
+      scaled_frustum_rate_ + sphere_rate_ * one_over_rho;
+  // See the scalar inverse for the cone on which the map is singular.
+  for (size_t s = 0; s < num_points; ++s) {
+    if (is_masked[s] or std::isnan(zeta_coefficient[s])) {
+      continue;
+    }
+    if ((scaled_frustum_rate_ > 0.0 and scaled_frustum_rate_ < -sphere_rate_ and
+         zeta_coefficient[s] > 0.0) or
+        (scaled_frustum_rate_ < 0.0 and scaled_frustum_rate_ > -sphere_rate_ and
+         zeta_coefficient[s] < 0.0) or
+        equal_within_roundoff(zeta_coefficient[s], 0.0)) {
+      is_masked[s] = true;
+      zeta_coefficient[s] = 1.0;
+    }
+  }
+
+  std::array<DataVector, Dim> logical_coords{};
+  // Radial coordinate
+  if (radial_distribution_ == Distribution::Linear) {
+    logical_coords[radial_coord] =
+        (physical_z - (scaled_frustum_zero_ + sphere_zero_ * one_over_rho)) /
+        zeta_coefficient;
+  } else if (radial_distribution_ == Distribution::Logarithmic) {
+    logical_coords[radial_coord] =
+        (log(physical_z / one_over_rho) - sphere_zero_) / sphere_rate_;
+  } else {
+    logical_coords[radial_coord] =
+        (one_over_rho / physical_z - sphere_zero_) / sphere_rate_;
+  }
+  // Polar angle
+  DataVector& xi = logical_coords[polar_coord];
+  if (with_equiangular_map_) {
+    xi = 2.0 *
+         atan(tan(0.5 * opening_angles_distribution_[0]) /
+              tan(0.5 * opening_angles_[0]) * cap[0]) /
+         opening_angles_distribution_[0];
+  } else {
+    xi = std::move(cap[0]);
+  }
+  if (halves_to_use_ == WedgeHalves::UpperOnly) {
+    xi *= 2.0;
+    xi -= 1.0;
+  } else if (halves_to_use_ == WedgeHalves::LowerOnly) {
+    xi *= 2.0;
+    xi += 1.0;
+  }
+  if constexpr (Dim == 3) {
+    if (with_equiangular_map_) {
+      logical_coords[azimuth_coord] =
+          2.0 *
+          atan(tan(0.5 * opening_angles_distribution_[1]) /
+               tan(0.5 * opening_angles_[1]) * cap[1]) /
+          opening_angles_distribution_[1];
+    } else {
+      logical_coords[azimuth_coord] = std::move(cap[1]);
+    }
+  }
+
+  for (size_t s = 0; s < num_points; ++s) {
+    if (is_masked[s]) {
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(logical_coords, d)[s] =
+            std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
+  return logical_coords;
+}
+
 template <size_t Dim>
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame> Wedge<Dim>::jacobian(
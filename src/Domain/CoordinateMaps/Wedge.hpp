@@ -14,6 +14,7 @@
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace PUP {
 class er;
 }  // namespace PUP
@@ -342,6 +343,11 @@ class Wedge {
   std::optional<std::array<double, Dim>> inverse(
       const std::array<double, Dim>& target_coords) const;
 
+  /// The inverse of all the points `target_coords` at once. The components of
+  /// the points at which the inverse is invalid (see above) are set to NaN.
+  std::array<DataVector, Dim> inverse(
+      const std::array<DataVector, Dim>& target_coords) const;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame> jacobian(
       const std::array<T, Dim>& source_coords) const;
@@ -3,18 +3,101 @@
 
 #include "Domain/Creators/Tags/Domain.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <pup_stl.h>
+#include <string>
+#include <vector>
 
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Domain.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
 
 namespace domain::Tags {
+namespace {
+// Identifies the domain a cache file was written for.  Only cheap queries of
+// the creator are used, so this cannot tell apart creators that differ only
+// in, e.g., the radii of their blocks.
+template <size_t VolumeDim>
+std::vector<char> cache_key(const ::DomainCreator<VolumeDim>& domain_creator) {
+  size_t dim = VolumeDim;
+  auto block_names = domain_creator.block_names();
+  auto initial_extents = domain_creator.initial_extents();
+  auto initial_refinement_levels = domain_creator.initial_refinement_levels();
+  PUP::sizer sizer;
+  sizer | dim;
+  sizer | block_names;
+  sizer | initial_extents;
+  sizer | initial_refinement_levels;
+  std::vector<char> result(sizer.size());
+  PUP::toMem writer(result.data());
+  writer | dim;
+  writer | block_names;
+  writer | initial_extents;
+  writer | initial_refinement_levels;
+  return result;
+}
+}  // namespace
+
 template <size_t VolumeDim>
 ::Domain<VolumeDim> Domain<VolumeDim>::create_from_options(
     const std::unique_ptr<::DomainCreator<VolumeDim>>& domain_creator) {
-  return domain_creator->create_domain();
+  const char* const cache_file_env = std::getenv("SPECTRE_DOMAIN_CACHE");
+  if (cache_file_env == nullptr or std::string{cache_file_env}.empty()) {
+    return domain_creator->create_domain();
+  }
+  const std::string cache_file{cache_file_env};
+  const std::vector<char> key = cache_key(*domain_creator);
+
+  if (std::ifstream cache{cache_file, std::ios::binary}; cache) {
+    const std::vector<char> contents{std::istreambuf_iterator<char>{cache},
+                                     std::istreambuf_iterator<char>{}};
+    size_t key_size = 0;
+    if (contents.size() > sizeof(key_size)) {
+      PUP::fromMem reader(contents.data());
+      reader | key_size;
+    }
+    if (key_size == key.size() and
+        contents.size() > sizeof(key_size) + key_size and
+        std::equal(key.begin(), key.end(),
+                   contents.begin() + sizeof(key_size))) {
+      return deserialize<::Domain<VolumeDim>>(
+          std::next(contents.data(), sizeof(key_size) + key_size));
+    }
+  }
+
+  auto domain = domain_creator->create_domain();
+  // Write to a temporary file first so an interrupted run never leaves a
+  // truncated cache behind.
+  const std::string temporary_file = cache_file + ".tmp";
+  {
+    std::ofstream cache{temporary_file, std::ios::binary | std::ios::trunc};
+    if (not cache) {
+      ERROR("Could not open the domain cache file '"
+            << temporary_file << "' for writing.");
+    }
+    const size_t key_size = key.size();
+    const std::vector<char> serialized_key_size = serialize(key_size);
+    const std::vector<char> serialized_domain = serialize(domain);
+    cache.write(serialized_key_size.data(),
+                static_cast<std::streamsize>(serialized_key_size.size()));
+    cache.write(key.data(), static_cast<std::streamsize>(key.size()));
+    cache.write(serialized_domain.data(),
+                static_cast<std::streamsize>(serialized_domain.size()));
+  }
+  if (std::rename(temporary_file.c_str(), cache_file.c_str()) != 0) {
+    ERROR("Could not move the domain cache file '" << temporary_file
+                                                   << "' to '" << cache_file
+                                                   << "'.");
+  }
+  return domain;
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
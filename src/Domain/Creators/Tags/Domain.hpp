@@ -16,6 +16,17 @@ namespace domain::Tags {
 /// \ingroup DataBoxTagsGroup
 /// \ingroup ComputationalDomainGroup
 /// The ::Domain.
+///
+/// If the environment variable `SPECTRE_DOMAIN_CACHE` is set to a file name,
+/// the domain is read from that file instead of being constructed, as long as
+/// the file was written for a domain with the same block names, initial
+/// extents, and initial refinement levels. Otherwise the domain is constructed
+/// and written to the file. This saves the serial construction of large
+/// domains in repeated runs with the same input file.
+///
+/// \warning The cache cannot detect changes to the other options of the domain
+/// creator, such as the radii of a `domain::creators::BinaryCompactObject`.
+/// Delete the cache file when changing them.
 template <size_t VolumeDim>
 struct Domain : db::SimpleTag {
   using type = ::Domain<VolumeDim>;
@@ -3,6 +3,7 @@
 
 #include "Domain/ElementDistribution.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -38,6 +39,29 @@
 
 namespace domain {
 namespace {
+// \brief Get the minimum spacing between grid points in Frame::Grid of an
+// `Element`
+template <size_t Dim>
+double get_min_grid_spacing(
+    const ElementId<Dim>& element_id, const Block<Dim>& block,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const Spectral::Quadrature quadrature) {
+  Mesh<Dim> mesh = ::domain::Initialization::create_initial_mesh(
+      initial_extents, element_id, quadrature);
+  Element<Dim> element = ::domain::Initialization::create_initial_element(
+      element_id, block, initial_refinement_levels);
+  ElementMap<Dim, Frame::Grid> element_map{
+      element_id, block.is_time_dependent()
+                      ? block.moving_mesh_logical_to_grid_map().get_clone()
+                      : block.stationary_map().get_to_grid_frame()};
+  const tnsr::I<DataVector, Dim, Frame::ElementLogical> logical_coords =
+      logical_coordinates(mesh);
+  const tnsr::I<DataVector, Dim, Frame::Grid> grid_coords =
+      element_map(logical_coords);
+  return minimum_grid_spacing(mesh.extents(), grid_coords);
+}
+
 // \brief Get the cost of an `Element` computed as
 // `(number of grid points) / sqrt(minimum grid spacing in Frame::Grid)`
 //
@@ -59,22 +83,29 @@ double get_num_points_and_grid_spacing_cost(
     const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
     const Spectral::Quadrature quadrature) {
-  Mesh<Dim> mesh = ::domain::Initialization::create_initial_mesh(
-      initial_extents, element_id, quadrature);
-  Element<Dim> element = ::domain::Initialization::create_initial_element(
-      element_id, block, initial_refinement_levels);
-  ElementMap<Dim, Frame::Grid> element_map{
-      element_id, block.is_time_dependent()
-                      ? block.moving_mesh_logical_to_grid_map().get_clone()
-                      : block.stationary_map().get_to_grid_frame()};
-  const tnsr::I<DataVector, Dim, Frame::ElementLogical> logical_coords =
-      logical_coordinates(mesh);
-  const tnsr::I<DataVector, Dim, Frame::Grid> grid_coords =
-      element_map(logical_coords);
-  const double min_grid_spacing =
-      minimum_grid_spacing(mesh.extents(), grid_coords);
+  const size_t number_of_grid_points =
+      alg::accumulate(initial_extents[block.id()], 1_st,
+                      std::multiplies<size_t>());
+  return number_of_grid_points /
+         sqrt(get_min_grid_spacing(element_id, block, initial_refinement_levels,
+                                   initial_extents, quadrature));
+}
 
-  return mesh.number_of_grid_points() / sqrt(min_grid_spacing);
+// \brief Get the number of local time steps an `Element` is expected to
+// take per step of the `Element` with the largest minimum grid spacing
+//
+// \details The step size of an element is assumed to be proportional to its
+// minimum grid spacing.  As in `choose_lts_step_size`, the step is then
+// reduced to the largest power-of-two fraction of the step of the coarsest
+// element that does not exceed it.
+double get_lts_step_rate(const double min_grid_spacing,
+                         const double largest_min_grid_spacing) {
+  const double desired_step_count = largest_min_grid_spacing / min_grid_spacing;
+  if (desired_step_count <= 1.0) {
+    return 1.0;
+  }
+  return static_cast<double>(two_to_the(
+      static_cast<size_t>(std::ceil(std::log2(desired_step_count)))));
 }
 }  //  namespace
 
@@ -86,6 +117,15 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
     const ElementWeight element_weight,
     const std::optional<Spectral::Quadrature>& quadrature) {
   std::unordered_map<ElementId<Dim>, double> element_costs{};
+  ASSERT(element_weight == ElementWeight::Uniform or
+             element_weight == ElementWeight::NumGridPoints or
+             quadrature.has_value(),
+         "Since element_weight depends on the grid spacing, quadrature must "
+         "have a value");
+
+  // Only used for ElementWeight::NumGridPointsAndLtsStepRate
+  std::unordered_map<ElementId<Dim>, double> min_grid_spacings{};
+  double largest_min_grid_spacing = 0.0;
 
   for (size_t block_number = 0; block_number < blocks.size(); block_number++) {
     const auto& block = blocks[block_number];
@@ -100,22 +140,33 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
         element_costs.insert({element_id, 1.0});
       } else if (element_weight == ElementWeight::NumGridPoints) {
         element_costs.insert({element_id, grid_points_per_element});
-      } else {
-        ASSERT(element_weight == ElementWeight::NumGridPointsAndGridSpacing,
-               "Unknown element_weight");
-        ASSERT(quadrature.has_value(),
-               "Since element_weight is "
-               "ElementWeight::NumGridPointsAndGridSpacing, quadrature must "
-               "have a value");
-
+      } else if (element_weight ==
+                 ElementWeight::NumGridPointsAndGridSpacing) {
         element_costs.insert(
             {element_id, get_num_points_and_grid_spacing_cost(
                              element_id, block, initial_refinement_levels,
                              initial_extents, quadrature.value())});
+      } else {
+        ASSERT(element_weight == ElementWeight::NumGridPointsAndLtsStepRate,
+               "Unknown element_weight");
+        const double min_grid_spacing =
+            get_min_grid_spacing(element_id, block, initial_refinement_levels,
+                                 initial_extents, quadrature.value());
+        largest_min_grid_spacing =
+            std::max(largest_min_grid_spacing, min_grid_spacing);
+        min_grid_spacings.insert({element_id, min_grid_spacing});
+        element_costs.insert({element_id, grid_points_per_element});
       }
     }
   }
 
+  // The step rates are relative to the coarsest element, so they can only
+  // be computed once all the elements have been visited.
+  for (const auto& [element_id, min_grid_spacing] : min_grid_spacings) {
+    element_costs.at(element_id) *=
+        get_lts_step_rate(min_grid_spacing, largest_min_grid_spacing);
+  }
+
   return element_costs;
 }
 
@@ -126,7 +177,8 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     const std::vector<Block<Dim>>& blocks,
     const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
-    const std::unordered_set<size_t>& global_procs_to_ignore) {
+    const std::unordered_set<size_t>& global_procs_to_ignore,
+    const size_t tile_refinement_level) {
   const size_t num_blocks = blocks.size();
 
   ASSERT(
@@ -141,11 +193,21 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
 
   size_t num_elements = 0;
   std::vector<size_t> num_elements_by_block(num_blocks);
+  // The number of consecutive elements on the Z-curve that form a tile. The
+  // lowest bits of the Z-curve index interleave the lowest bits of the segment
+  // indices, so the elements sharing an ancestor `tile_refinement_level`
+  // levels up are contiguous on the curve.
+  std::vector<size_t> num_elements_per_tile_by_block(num_blocks);
   for (size_t i = 0; i < num_blocks; i++) {
     const size_t num_elements_current_block = two_to_the(alg::accumulate(
         initial_refinement_levels[i], 0_st, std::plus<size_t>()));
     num_elements_by_block[i] = num_elements_current_block;
     num_elements += num_elements_current_block;
+    size_t tile_refinement = 0;
+    for (const size_t refinement_level : initial_refinement_levels[i]) {
+      tile_refinement += std::min(refinement_level, tile_refinement_level);
+    }
+    num_elements_per_tile_by_block[i] = two_to_the(tile_refinement);
   }
 
   ASSERT(element_costs.size() == num_elements,
@@ -202,15 +264,22 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     while (add_more_elements_to_proc and (current_block_num < num_blocks)) {
       const size_t num_elements_current_block =
           num_elements_by_block[current_block_num];
+      const size_t num_elements_per_tile =
+          num_elements_per_tile_by_block[current_block_num];
       size_t num_elements_distributed_to_proc = 0;
       // while we still have elements left on the block to distribute and we
       // still have cost allowed on the proc
       while (add_more_elements_to_proc and
              (element_num_of_block < num_elements_current_block)) {
-        const ElementId<Dim>& element_id =
-            initial_element_ids_by_block[current_block_num]
-                                        [element_num_of_block];
-        const double element_cost = element_costs.at(element_id);
+        // Elements are distributed a full tile at a time. Without tiles, a tile
+        // is a single element.
+        double element_cost = 0.0;
+        for (size_t j = 0; j < num_elements_per_tile; ++j) {
+          const ElementId<Dim>& element_id =
+              initial_element_ids_by_block[current_block_num]
+                                          [element_num_of_block + j];
+          element_cost += element_costs.at(element_id);
+        }
 
         if (total_elements_distributed_to_proc == 0) {
           // if we haven't yet assigned any elements to this proc, assign the
@@ -218,9 +287,9 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
           // element
           cost_remaining -= element_cost;
           cost_spent_on_proc = element_cost;
-          num_elements_distributed_to_proc = 1;
-          total_elements_distributed_to_proc = 1;
-          element_num_of_block++;
+          num_elements_distributed_to_proc = num_elements_per_tile;
+          total_elements_distributed_to_proc = num_elements_per_tile;
+          element_num_of_block += num_elements_per_tile;
         } else {
           const double current_cost_diff =
               abs(target_cost_per_proc - cost_spent_on_proc);
@@ -238,9 +307,9 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
             // to the current proc
             cost_spent_on_proc += element_cost;
             cost_remaining -= element_cost;
-            num_elements_distributed_to_proc++;
-            total_elements_distributed_to_proc++;
-            element_num_of_block++;
+            num_elements_distributed_to_proc += num_elements_per_tile;
+            total_elements_distributed_to_proc += num_elements_per_tile;
+            element_num_of_block += num_elements_per_tile;
           }
         }
       }
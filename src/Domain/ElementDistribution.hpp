@@ -38,7 +38,14 @@ enum class ElementWeight {
   /// by both the number of grid points and minimum spacing between grid points
   /// in that `Element` (see `get_num_points_and_grid_spacing_cost()` for
   /// details)
-  NumGridPointsAndGridSpacing
+  NumGridPointsAndGridSpacing,
+  /// A weighting scheme for local time stepping where each `Element`'s
+  /// computational cost is the number of grid points times the number of
+  /// steps the `Element` is expected to take per step of the coarsest
+  /// `Element`.  The step size is taken to be proportional to the minimum
+  /// grid spacing and is rounded down to a power-of-two fraction of the
+  /// coarsest step, as is done by `choose_lts_step_size()`.
+  NumGridPointsAndLtsStepRate
 };
 
 /// \brief Get the cost of each `Element` in a list of `Block`s where
@@ -46,7 +53,8 @@ enum class ElementWeight {
 ///
 /// \details It is only necessary to pass in a value for `quadrature` if
 /// the value for `element_weight` is
-/// `ElementWeight::NumGridPointsAndGridSpacing`. Otherwise, the argument isn't
+/// `ElementWeight::NumGridPointsAndGridSpacing` or
+/// `ElementWeight::NumGridPointsAndLtsStepRate`. Otherwise, the argument isn't
 /// needed and will have no effect if it does have a value.
 template <size_t Dim>
 std::unordered_map<ElementId<Dim>, double> get_element_costs(
@@ -129,6 +137,20 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
  * recursively, so a generalization of the present method is possible for blocks
  * with internal refinement
  *
+ * \par Element tiles
+ * If `tile_refinement_level` is non-zero, processor boundaries are only placed
+ * between "tiles" of elements: all `Element`s of a `Block` that are descendants
+ * of the same `Element` `tile_refinement_level` levels coarser in every
+ * dimension (or all `Element`s of the `Block` in dimensions that are refined
+ * less) are assigned to the same processor. These tiles are contiguous
+ * segments of the Morton curve, so the weighted assignment above is simply
+ * done in units of tiles instead of single `Element`s. Keeping small,
+ * spatially-connected groups of `Element`s on one core means that the
+ * boundary data exchanged within a tile never leaves the core, which reduces
+ * the communication overhead when the `Element`s are so small that it is
+ * comparable to the cost of the volume computation. Because children of an
+ * `Element` stay on its processor, refining a tile with AMR keeps it together.
+ *
  * \tparam Dim the number of spatial dimensions of the `Block`s
  */
 template <size_t Dim>
@@ -136,14 +158,17 @@ struct BlockZCurveProcDistribution {
   /// The `number_of_procs_with_elements` argument represents how many procs
   /// will have elements. This is not necessarily equal to the total number of
   /// procs because some global procs may be ignored by the sixth argument
-  /// `global_procs_to_ignore`.
+  /// `global_procs_to_ignore`. The `tile_refinement_level` argument controls
+  /// how many consecutive `Element`s on the Morton curve are kept together
+  /// (see the "Element tiles" section of the class documentation).
   BlockZCurveProcDistribution(
       const std::unordered_map<ElementId<Dim>, double>& element_costs,
       size_t number_of_procs_with_elements,
       const std::vector<Block<Dim>>& blocks,
       const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
       const std::vector<std::array<size_t, Dim>>& initial_extents,
-      const std::unordered_set<size_t>& global_procs_to_ignore = {});
+      const std::unordered_set<size_t>& global_procs_to_ignore = {},
+      size_t tile_refinement_level = 0);
 
   /// Gets the suggested processor number for a particular `ElementId`,
   /// determined by the Morton curve weighted element assignment described in
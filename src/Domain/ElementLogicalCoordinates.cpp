@@ -3,8 +3,11 @@
 
 #include "Domain/ElementLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <array>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -14,7 +17,10 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Structure/BlockId.hpp"    // IWYU pragma: keep
 #include "Domain/Structure/ElementId.hpp"  // IWYU pragma: keep
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -40,6 +46,32 @@ bool segment_contains(const double x_block_logical,
   return (x_block_logical >= lower_bound_block_logical and
           x_block_logical < upper_bound_block_logical);
 }
+
+// Put the element logical coordinates and offsets of the points, which were
+// collected for each of the `element_ids`, into the final data structure.
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
+assemble_coord_holders(
+    const std::vector<ElementId<Dim>>& element_ids,
+    const std::vector<std::array<std::vector<double>, Dim>>& x_element_logical,
+    std::vector<std::vector<size_t>> offsets) {
+  std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>> result;
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    const size_t num_grid_pts = x_element_logical[index][0].size();
+    if (num_grid_pts > 0) {
+      tnsr::I<DataVector, Dim, Frame::ElementLogical> tmp(num_grid_pts);
+      for (size_t s = 0; s < num_grid_pts; ++s) {
+        for (size_t d = 0; d < Dim; ++d) {
+          tmp.get(d)[s] = gsl::at(x_element_logical[index], d)[s];
+        }
+      }
+      result.emplace(element_ids[index],
+                     ElementLogicalCoordHolder<Dim>{
+                         std::move(tmp), std::move(offsets[index])});
+    }
+  }
+  return result;
+}
 }  // namespace
 
 template <size_t Dim>
@@ -98,23 +130,121 @@ element_logical_coordinates(
 
   // Now we know how many points are in each element, so we can
   // put the intermediate results into the final data structure.
-  std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>> result;
-  for (size_t index = 0; index < element_ids.size(); ++index) {
-    const size_t num_grid_pts = x_element_logical[index][0].size();
-    if (num_grid_pts > 0) {
-      tnsr::I<DataVector, Dim, Frame::ElementLogical> tmp(num_grid_pts);
-      std::vector<size_t> off(num_grid_pts);
-      for (size_t s = 0; s < num_grid_pts; ++s) {
-        for (size_t d = 0; d < Dim; ++d) {
-          tmp.get(d)[s] = gsl::at(x_element_logical[index], d)[s];
+  return assemble_coord_holders(element_ids, x_element_logical,
+                                std::move(offsets));
+}
+
+template <size_t Dim>
+ElementLocator<Dim>::ElementLocator(std::vector<ElementId<Dim>> element_ids)
+    : element_ids_(std::move(element_ids)) {
+  for (size_t position = 0; position < element_ids_.size(); ++position) {
+    const auto& element_id = element_ids_[position];
+    std::array<size_t, Dim> refinement_levels{};
+    size_t collapsed_index = 0;
+    size_t stride = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      const SegmentId& segment_id = element_id.segment_id(d);
+      gsl::at(refinement_levels, d) = segment_id.refinement_level();
+      collapsed_index += stride * segment_id.index();
+      stride *= two_to_the(segment_id.refinement_level());
+    }
+    auto& groups = groups_by_block_[element_id.block_id()];
+    auto group = alg::find_if(groups, [&refinement_levels](const auto& g) {
+      return g.refinement_levels == refinement_levels;
+    });
+    if (group == groups.end()) {
+      groups.push_back({refinement_levels, {}});
+      group = std::prev(groups.end());
+    }
+    // The first of several identical element ids is found, as in
+    // `element_logical_coordinates`
+    group->element_positions.emplace(collapsed_index, position);
+  }
+}
+
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
+ElementLocator<Dim>::element_logical_coordinates(
+    const std::vector<block_logical_coord_holder<Dim>>& block_coord_holders)
+    const {
+  std::vector<std::array<std::vector<double>, Dim>> x_element_logical(
+      element_ids_.size());
+  std::vector<std::vector<size_t>> offsets(element_ids_.size());
+
+  for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
+    if (not block_coord_holders[offset].has_value()) {
+      continue;
+    }
+    const auto& block_id = block_coord_holders[offset].value().id;
+    const auto groups = groups_by_block_.find(block_id.get_index());
+    if (groups == groups_by_block_.end()) {
+      continue;
+    }
+    const auto& x_block_logical = block_coord_holders[offset].value().data;
+    // Compute the segment containing the point directly from its block logical
+    // coordinates for each set of refinement levels in the block. If elements
+    // with different refinement levels overlap, the one that comes first in
+    // the list of element ids is chosen, as in `element_logical_coordinates`.
+    std::optional<size_t> found_position{};
+    std::array<SegmentId, Dim> found_segments{};
+    for (const auto& group : groups->second) {
+      std::array<SegmentId, Dim> segments{};
+      size_t collapsed_index = 0;
+      size_t stride = 1;
+      bool is_contained = true;
+      for (size_t d = 0; d < Dim and is_contained; ++d) {
+        const size_t refinement_level = gsl::at(group.refinement_levels, d);
+        const size_t number_of_segments = two_to_the(refinement_level);
+        const double x = x_block_logical.get(d);
+        const double scaled_x =
+            0.5 * (x + 1.0) * static_cast<double>(number_of_segments);
+        size_t index = scaled_x <= 0.0 ? 0
+                                       : std::min(static_cast<size_t>(scaled_x),
+                                                  number_of_segments - 1);
+        // Correct the index if roundoff in the computation above moved the
+        // point across an endpoint of the segment
+        SegmentId segment{refinement_level, index};
+        if (not segment_contains(x, segment.endpoint(Side::Lower),
+                                 segment.endpoint(Side::Upper))) {
+          if (x < segment.endpoint(Side::Lower) and index > 0) {
+            --index;
+          } else if (x >= segment.endpoint(Side::Upper) and
+                     index + 1 < number_of_segments) {
+            ++index;
+          }
+          segment = SegmentId{refinement_level, index};
+          is_contained = segment_contains(x, segment.endpoint(Side::Lower),
+                                          segment.endpoint(Side::Upper));
         }
-        off[s] = offsets[index][s];
+        gsl::at(segments, d) = segment;
+        collapsed_index += stride * index;
+        stride *= number_of_segments;
+      }
+      if (not is_contained) {
+        continue;
       }
-      result.emplace(element_ids[index], ElementLogicalCoordHolder<Dim>{
-                                             std::move(tmp), std::move(off)});
+      const auto element = group.element_positions.find(collapsed_index);
+      if (element != group.element_positions.end() and
+          (not found_position.has_value() or
+           element->second < *found_position)) {
+        found_position = element->second;
+        found_segments = segments;
+      }
+    }
+    if (not found_position.has_value()) {
+      continue;
     }
+    for (size_t d = 0; d < Dim; ++d) {
+      const double up = gsl::at(found_segments, d).endpoint(Side::Upper);
+      const double lo = gsl::at(found_segments, d).endpoint(Side::Lower);
+      gsl::at(x_element_logical[*found_position], d)
+          .push_back((2.0 * x_block_logical.get(d) - up - lo) / (up - lo));
+    }
+    offsets[*found_position].push_back(offset);
   }
-  return result;
+
+  return assemble_coord_holders(element_ids_, x_element_logical,
+                                std::move(offsets));
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -125,7 +255,8 @@ element_logical_coordinates(
   element_logical_coordinates(                                      \
       const std::vector<ElementId<DIM(data)>>& element_ids,         \
       const std::vector<block_logical_coord_holder<DIM(data)>>&     \
-          block_coord_holders);
+          block_coord_holders);                                     \
+  template class ElementLocator<DIM(data)>;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
@@ -3,20 +3,20 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Structure/ElementId.hpp"
 
 /// \cond
 namespace domain {
 class BlockId;
 }  // namespace domain
 class DataVector;
-template <size_t VolumeDim>
-class ElementId;
 template <typename IdType, typename DataType>
 class IdPair;
 /// \endcond
@@ -115,3 +115,46 @@ auto element_logical_coordinates(
         domain::BlockId, tnsr::I<double, Dim, typename Frame::BlockLogical>>>>&
         block_coord_holders)
     -> std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>;
+
+/// \ingroup ComputationalDomainGroup
+///
+/// Finds the `Element`s that contain a set of points in block logical
+/// coordinates, giving the same result as `element_logical_coordinates`
+/// with the same `element_ids`.
+///
+/// \details `element_logical_coordinates` checks every point against every
+/// element in its block, which is slow when there are many points and
+/// elements, such as when interpolating volume data from a file to the
+/// elements of a new domain. This class instead groups the `element_ids` by
+/// block and refinement levels once, so the element that contains a point is
+/// computed directly from the block logical coordinates of the point. The
+/// cost of finding a point is proportional to the number of distinct
+/// refinement levels in its block.
+template <size_t Dim>
+class ElementLocator {
+ public:
+  ElementLocator() = default;
+  explicit ElementLocator(std::vector<ElementId<Dim>> element_ids);
+
+  auto element_logical_coordinates(
+      const std::vector<std::optional<
+          IdPair<domain::BlockId,
+                 tnsr::I<double, Dim, typename Frame::BlockLogical>>>>&
+          block_coord_holders) const
+      -> std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>;
+
+  const std::vector<ElementId<Dim>>& element_ids() const {
+    return element_ids_;
+  }
+
+ private:
+  // The elements of a block that have the same refinement levels. Maps the
+  // collapsed index of their segments to their position in `element_ids_`.
+  struct RefinementGroup {
+    std::array<size_t, Dim> refinement_levels{};
+    std::unordered_map<size_t, size_t> element_positions{};
+  };
+
+  std::vector<ElementId<Dim>> element_ids_{};
+  std::unordered_map<size_t, std::vector<RefinementGroup>> groups_by_block_{};
+};
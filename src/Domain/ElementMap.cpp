@@ -4,6 +4,7 @@
 #include "Domain/ElementMap.hpp"
 
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"  // IWYU pragma: keep
+#include "Domain/CoordinateMaps/PupSharedMap.hpp"
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/OptimizerHacks.hpp"
@@ -14,6 +15,17 @@ ElementMap<Dim, TargetFrame>::ElementMap(
     std::unique_ptr<
         domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
         block_map)
+    : ElementMap(std::move(element_id),
+                 std::shared_ptr<const domain::CoordinateMapBase<
+                     Frame::BlockLogical, TargetFrame, Dim>>{
+                     std::move(block_map)}) {}
+
+template <size_t Dim, typename TargetFrame>
+ElementMap<Dim, TargetFrame>::ElementMap(
+    ElementId<Dim> element_id,
+    std::shared_ptr<
+        const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
+        block_map)
     : block_map_(std::move(block_map)),
       element_id_(std::move(element_id)),
       map_slope_{[](const ElementId<Dim>& id) {
@@ -55,7 +67,7 @@ ElementMap<Dim, TargetFrame>::ElementMap(
 
 template <size_t Dim, typename TargetFrame>
 void ElementMap<Dim, TargetFrame>::pup(PUP::er& p) {
-  p | block_map_;
+  domain::pup_shared_map(p, block_map_);
   p | element_id_;
   p | map_slope_;
   p | map_offset_;
@@ -28,6 +28,11 @@ class er;
  * map corresponds to the coordinate map for the Element rather than the Block.
  * This allows DomainCreators to only specify the maps for the Blocks without
  * worrying about how the domain may be decomposed beyond that.
+ *
+ * The block map is immutable and can be shared with the Block and the
+ * ElementMaps of the other elements in the Block, e.g. by passing
+ * `Block::shared_moving_mesh_logical_to_grid_map()`. Sharing is preserved
+ * through serialization within each process, see `domain::pup_shared_map`.
  */
 template <size_t Dim, typename TargetFrame>
 class ElementMap {
@@ -45,6 +50,11 @@ class ElementMap {
                                                        TargetFrame, Dim>>
                  block_map);
 
+  ElementMap(ElementId<Dim> element_id,
+             std::shared_ptr<const domain::CoordinateMapBase<
+                 Frame::BlockLogical, TargetFrame, Dim>>
+                 block_map);
+
   const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>&
   block_map() const {
     return *block_map_;
@@ -122,8 +132,8 @@ class ElementMap {
     return block_source_point;
   }
 
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
+  std::shared_ptr<
+      const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
       block_map_{nullptr};
   ElementId<Dim> element_id_{};
   // map_slope_[i] = 0.5 * (segment_ids[i].endpoint(Side::Upper) -
@@ -150,3 +160,9 @@ ElementMap(ElementId<Dim> element_id,
            std::unique_ptr<
                domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
                block_map) -> ElementMap<Dim, TargetFrame>;
+
+template <size_t Dim, typename TargetFrame>
+ElementMap(ElementId<Dim> element_id,
+           std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                           TargetFrame, Dim>>
+               block_map) -> ElementMap<Dim, TargetFrame>;
@@ -3,7 +3,12 @@
 
 #include "Domain/FunctionsOfTime/FunctionOfTimeHelpers.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <list>
+#include <memory>
 #include <pup.h>
 #include <pup_stl.h>
 
@@ -108,6 +113,86 @@ const StoredInfo<MaxDerivPlusOne, StoreCoefs>& stored_info_from_upper_bound(
   }
 }
 
+template <size_t MaxDerivPlusOne, bool StoreCoefs>
+StoredInfoIndex<MaxDerivPlusOne, StoreCoefs>::Block::Block(
+    const size_t capacity)
+    : infos(capacity, nullptr) {}
+
+template <size_t MaxDerivPlusOne, bool StoreCoefs>
+void StoredInfoIndex<MaxDerivPlusOne, StoreCoefs>::reset(
+    const std::list<Info>& all_stored_infos, const size_t size) {
+  current_block_.store(nullptr, std::memory_order_release);
+  blocks_.clear();
+  last_index_.store(0, std::memory_order_relaxed);
+  auto it = all_stored_infos.begin();
+  for (size_t i = 0; i < size; ++i, ++it) {
+    push_back(*it);
+  }
+}
+
+template <size_t MaxDerivPlusOne, bool StoreCoefs>
+void StoredInfoIndex<MaxDerivPlusOne, StoreCoefs>::push_back(
+    const Info& info) {
+  Block* const block = blocks_.empty() ? nullptr : blocks_.back().get();
+  const size_t size =
+      block == nullptr ? 0 : block->size.load(std::memory_order_relaxed);
+  if (block != nullptr and size < block->infos.size()) {
+    block->infos[size] = &info;
+    // Publishes the new pointer to the threads that see the new size
+    block->size.store(size + 1, std::memory_order_release);
+    return;
+  }
+  auto new_block = std::make_unique<Block>(std::max(2 * size, size_t{8}));
+  if (block != nullptr) {
+    std::copy(block->infos.begin(), block->infos.end(),
+              new_block->infos.begin());
+  }
+  new_block->infos[size] = &info;
+  new_block->size.store(size + 1, std::memory_order_relaxed);
+  // Publishes the filled block. The old blocks are kept alive for the threads
+  // still searching them.
+  current_block_.store(new_block.get(), std::memory_order_release);
+  blocks_.push_back(std::move(new_block));
+}
+
+template <size_t MaxDerivPlusOne, bool StoreCoefs>
+auto StoredInfoIndex<MaxDerivPlusOne, StoreCoefs>::stored_info_from_upper_bound(
+    const double t) const -> const Info& {
+  const Block* const block = current_block_.load(std::memory_order_acquire);
+  ASSERT(block != nullptr,
+         "List of StoredInfos you are trying to access is empty. Was it "
+         "constructed properly?");
+  const size_t size = block->size.load(std::memory_order_acquire);
+  const std::vector<const Info*>& infos = block->infos;
+
+  // Most evaluations are in the same interval as the previous one
+  const size_t last_index = last_index_.load(std::memory_order_relaxed);
+  if (last_index < size and infos[last_index]->time < t and
+      (last_index + 1 == size or not(infos[last_index + 1]->time < t))) {
+    return *infos[last_index];
+  }
+
+  const auto upper_bound_stored_info = std::lower_bound(
+      infos.begin(),
+      std::next(infos.begin(), static_cast<std::ptrdiff_t>(size)), t,
+      [](const Info* const info, const double time) {
+        return info->time < time;
+      });
+  if (upper_bound_stored_info == infos.begin()) {
+    // all elements of times are greater than t
+    // check if t is just less than the min element by roundoff
+    if (not equal_within_roundoff(infos.front()->time, t)) {
+      ERROR("requested time " << t << " precedes earliest time "
+                              << infos.front()->time << " of times.");
+    }
+    return *infos.front();
+  }
+  const auto index = static_cast<size_t>(
+      std::distance(infos.begin(), std::prev(upper_bound_stored_info)));
+  last_index_.store(index, std::memory_order_relaxed);
+  return *infos[index];
+}
+
 template <size_t MaxDerivPlusOne, bool StoreCoefs>
 bool operator==(
     const domain::FunctionsOfTime::FunctionOfTimeHelpers::StoredInfo<
@@ -143,15 +228,16 @@ std::ostream& operator<<(std::ostream& os,
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define STORECOEF(data) BOOST_PP_TUPLE_ELEM(1, data)
 
-#define INSTANTIATE(_, data)                             \
-  template class StoredInfo<DIM(data), STORECOEF(data)>; \
-  template bool operator==<DIM(data), STORECOEF(data)>(  \
-      const StoredInfo<DIM(data), STORECOEF(data)>&,     \
-      const StoredInfo<DIM(data), STORECOEF(data)>&);    \
-  template bool operator!=<DIM(data), STORECOEF(data)>(  \
-      const StoredInfo<DIM(data), STORECOEF(data)>&,     \
-      const StoredInfo<DIM(data), STORECOEF(data)>&);    \
-  template std::ostream& operator<<(                     \
+#define INSTANTIATE(_, data)                                  \
+  template class StoredInfo<DIM(data), STORECOEF(data)>;      \
+  template class StoredInfoIndex<DIM(data), STORECOEF(data)>; \
+  template bool operator==<DIM(data), STORECOEF(data)>(       \
+      const StoredInfo<DIM(data), STORECOEF(data)>&,          \
+      const StoredInfo<DIM(data), STORECOEF(data)>&);         \
+  template bool operator!=<DIM(data), STORECOEF(data)>(       \
+      const StoredInfo<DIM(data), STORECOEF(data)>&,          \
+      const StoredInfo<DIM(data), STORECOEF(data)>&);         \
+  template std::ostream& operator<<(                          \
       std::ostream&, const StoredInfo<DIM(data), STORECOEF(data)>&);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3, 4, 5), (true, false))
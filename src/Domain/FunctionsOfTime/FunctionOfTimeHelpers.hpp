@@ -7,10 +7,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstddef>
 #include <limits>
 #include <list>
+#include <memory>
 #include <ostream>
 #include <pup.h>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "Utilities/Gsl.hpp"
@@ -73,6 +77,60 @@ const StoredInfo<MaxDerivPlusOne, StoreCoefs>& stored_info_from_upper_bound(
     const std::list<StoredInfo<MaxDerivPlusOne, StoreCoefs>>& all_stored_infos,
     const size_t all_info_size);
 
+/*!
+ * \brief A random-access index of a `std::list` of `StoredInfo`s, sorted by
+ * time, that can be searched while infos are appended to the list.
+ *
+ * \details The index holds pointers to the infos in the list, which stay
+ * valid when the list is appended to. `stored_info_from_upper_bound()` returns
+ * the same info as the free function of that name, but finds it by bisection
+ * after checking the info found by the previous search, which is usually the
+ * right one since most evaluations are at nearby times.
+ *
+ * `push_back()` may be called by a single thread while any number of threads
+ * search the index. When the pointers no longer fit in their block of memory
+ * they are copied to a block twice as large, and the old block is kept so that
+ * searches that started in it stay valid. `reset()` must not be called while
+ * other threads search the index.
+ */
+template <size_t MaxDerivPlusOne, bool StoreCoefs = true>
+class StoredInfoIndex {
+ public:
+  using Info = StoredInfo<MaxDerivPlusOne, StoreCoefs>;
+
+  StoredInfoIndex() = default;
+  ~StoredInfoIndex() = default;
+  StoredInfoIndex(StoredInfoIndex&&) = delete;
+  StoredInfoIndex& operator=(StoredInfoIndex&&) = delete;
+  StoredInfoIndex(const StoredInfoIndex&) = delete;
+  StoredInfoIndex& operator=(const StoredInfoIndex&) = delete;
+
+  /// Index the first `size` infos of `all_stored_infos`, replacing the
+  /// current index.
+  void reset(const std::list<Info>& all_stored_infos, size_t size);
+
+  /// Append `info`, which must be the info following the last indexed one in
+  /// the list.
+  void push_back(const Info& info);
+
+  /// The indexed info with the latest time that is less than `t`, or the
+  /// earliest info if `t` is within roundoff of its time.
+  const Info& stored_info_from_upper_bound(double t) const;
+
+ private:
+  struct Block {
+    explicit Block(size_t capacity);
+    std::vector<const Info*> infos;
+    std::atomic<size_t> size{0};
+  };
+
+  std::atomic<const Block*> current_block_{nullptr};
+  // All the blocks, the current one last. Only accessed by the writing thread.
+  std::vector<std::unique_ptr<Block>> blocks_{};
+  // Only a hint, so relaxed ordering is enough
+  mutable std::atomic<size_t> last_index_{0};
+};
+
 template <size_t MaxDerivPlusOne, bool StoreCoefs>
 bool operator==(
     const domain::FunctionsOfTime::FunctionOfTimeHelpers::StoredInfo<
@@ -32,6 +32,7 @@ PiecewisePolynomial<MaxDeriv>::PiecewisePolynomial(
     : deriv_info_at_update_times_{{t, std::move(initial_func_and_derivs)}},
       expiration_time_(expiration_time) {
   deriv_info_size_.store(1, std::memory_order_release);
+  deriv_info_index_.reset(deriv_info_at_update_times_, 1);
   expiration_time_.store(expiration_time, std::memory_order_release);
 }
 
@@ -54,6 +55,11 @@ PiecewisePolynomial<MaxDeriv>& PiecewisePolynomial<MaxDeriv>::operator=(
   deriv_info_size_.store(
       rhs.deriv_info_size_.exchange(0, std::memory_order_acq_rel),
       std::memory_order_release);
+  deriv_info_index_.reset(deriv_info_at_update_times_,
+                          deriv_info_size_.load(std::memory_order_acquire));
+  rhs.deriv_info_index_.reset(rhs.deriv_info_at_update_times_, 0);
+  clear_cached_evaluations();
+  rhs.clear_cached_evaluations();
   return *this;
 }
 
@@ -75,6 +81,9 @@ PiecewisePolynomial<MaxDeriv>& PiecewisePolynomial<MaxDeriv>::operator=(
                          std::memory_order_release);
   deriv_info_size_.store(rhs.deriv_info_size_.load(std::memory_order_acquire),
                          std::memory_order_release);
+  deriv_info_index_.reset(deriv_info_at_update_times_,
+                          deriv_info_size_.load(std::memory_order_acquire));
+  clear_cached_evaluations();
   return *this;
 }
 
@@ -94,9 +103,24 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const {
           << ". The difference between times is " << t - expiration_time_
           << ".");
   }
-  const auto& deriv_info_at_t = stored_info_from_upper_bound(
-      t, deriv_info_at_update_times_,
-      deriv_info_size_.load(std::memory_order_acquire));
+  // The values requested by `update` for MaxDeriv > 2 are not cached
+  constexpr bool use_cache = MaxDerivReturned <= 2;
+  if constexpr (use_cache) {
+    for (const auto& slot : cached_evaluations_) {
+      const auto cached = std::atomic_load(&slot);
+      if (cached != nullptr and cached->time == t and
+          cached->number_of_derivs >= MaxDerivReturned) {
+        std::array<DataVector, MaxDerivReturned + 1> result{};
+        for (size_t i = 0; i < MaxDerivReturned + 1; ++i) {
+          gsl::at(result, i) = gsl::at(cached->values, i);
+        }
+        return result;
+      }
+    }
+  }
+
+  const auto& deriv_info_at_t =
+      deriv_info_index_.stored_info_from_upper_bound(t);
   const double dt = t - deriv_info_at_t.time;
   const value_type& coefs = deriv_info_at_t.stored_quantities;
 
@@ -120,6 +144,22 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const {
     gsl::at(result, j) *= fact;
   }
 
+  if constexpr (use_cache) {
+    auto cached = std::make_shared<CachedEvaluation>();
+    cached->time = t;
+    cached->number_of_derivs = MaxDerivReturned;
+    for (size_t i = 0; i < MaxDerivReturned + 1; ++i) {
+      gsl::at(cached->values, i) = gsl::at(result, i);
+    }
+    // Concurrent evaluations at new times may replace each other's entries,
+    // which only costs recomputing them.
+    std::atomic_store(
+        &gsl::at(cached_evaluations_,
+                 next_cached_evaluation_.fetch_add(
+                     1, std::memory_order_relaxed) %
+                     cached_evaluations_.size()),
+        std::shared_ptr<const CachedEvaluation>{std::move(cached)});
+  }
   return result;
 }
 
@@ -167,8 +207,8 @@ void PiecewisePolynomial<MaxDeriv>::update(
   //
   //  1. Add the updated deriv info to the back of the list, keeping the valid
   //     size of the list to use and the expiration time the same.
-  //  2. Update the valid size to match the new size of the list, keeping the
-  //     expiration time the same.
+  //  2. Update the index and the valid size to match the new size of the list,
+  //     keeping the expiration time the same.
   //  3. Update the expiration time
   //
   // The expiration time is exposed via `time_bounds` and used to determine
@@ -183,6 +223,7 @@ void PiecewisePolynomial<MaxDeriv>::update(
   // we need to update the valid size *after* we emplace the updated deriv info
   // to ensure everything is consistent. This gives us the ordering above.
   deriv_info_at_update_times_.emplace_back(time_of_update, std::move(func));
+  deriv_info_index_.push_back(deriv_info_at_update_times_.back());
   deriv_info_size_.fetch_add(1, std::memory_order_acq_rel);
   if (not expiration_time_.compare_exchange_strong(current_expiration_time,
                                                    next_expiration_time,
@@ -193,6 +234,32 @@ void PiecewisePolynomial<MaxDeriv>::update(
   }
 }
 
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::truncate_at_time(const double t) {
+  const std::lock_guard<std::mutex> update_lock{update_mutex_};
+  size_t size = deriv_info_size_.load(std::memory_order_acquire);
+  // The first entry is needed unless the next one starts before `t`
+  bool removed_entries = false;
+  while (size > 1 and
+         std::next(deriv_info_at_update_times_.begin())->time < t) {
+    deriv_info_at_update_times_.pop_front();
+    --size;
+    removed_entries = true;
+  }
+  if (removed_entries) {
+    deriv_info_size_.store(size, std::memory_order_release);
+    deriv_info_index_.reset(deriv_info_at_update_times_, size);
+    clear_cached_evaluations();
+  }
+}
+
+template <size_t MaxDeriv>
+void PiecewisePolynomial<MaxDeriv>::clear_cached_evaluations() {
+  for (auto& slot : cached_evaluations_) {
+    std::atomic_store(&slot, std::shared_ptr<const CachedEvaluation>{});
+  }
+}
+
 template <size_t MaxDeriv>
 void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
   FunctionOfTime::pup(p);
@@ -252,6 +319,9 @@ void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
         p | deriv_info;
       }
     }
+    deriv_info_index_.reset(deriv_info_at_update_times_,
+                            deriv_info_size_.load(std::memory_order_acquire));
+    clear_cached_evaluations();
   } else {
     p | expiration_time_;
     // This is guaranteed to be thread-safe for both packing and sizing
@@ -24,6 +24,13 @@ namespace FunctionsOfTime {
  * \ingroup ComputationalDomainGroup
  * \brief A function that has a piecewise-constant `MaxDeriv`th derivative.
  *
+ * \details The values and derivatives at the last few times the function was
+ * evaluated at are cached. Since all elements on a node share the function
+ * through the global cache and evaluate it at the same times, e.g. to evaluate
+ * the time-dependent maps of their blocks, the polynomial is usually evaluated
+ * once per time per node. The cache is never invalidated by `update`, since an
+ * update does not change the function at or before the update time.
+ *
  * \note This class conforms to the requirements of the
  * `Parallel::GlobalCache` for objects held by mutable global cache tags.
  */
@@ -78,6 +85,17 @@ class PiecewisePolynomial : public FunctionOfTime {
   void update(double time_of_update, DataVector updated_max_deriv,
               double next_expiration_time) override;
 
+  /// Removes the stored derivatives that are only needed to evaluate the
+  /// function before the time `t`, so that the history does not grow without
+  /// bound. After this the function can no longer be evaluated before the
+  /// first remaining update time, which is at most `t`.
+  ///
+  /// \warning This may be called concurrently with `update`, but not while
+  /// other threads evaluate the function, since it frees the removed data.
+  /// It should only be called with a `t` no later than the earliest time at
+  /// which any user of the function can still evaluate it.
+  void truncate_at_time(double t);
+
   /// Returns the domain of validity of the function,
   /// including the extrapolation region.
   std::array<double, 2> time_bounds() const override {
@@ -114,6 +132,10 @@ class PiecewisePolynomial : public FunctionOfTime {
   // to elements upon insertion or resizing. A std::list fits this requirement
   std::list<FunctionOfTimeHelpers::StoredInfo<MaxDeriv + 1>>
       deriv_info_at_update_times_;
+  // Random-access index of the first deriv_info_size_ entries of
+  // deriv_info_at_update_times_ for the evaluations. No need to pup this since
+  // it is rebuilt from the list.
+  FunctionOfTimeHelpers::StoredInfoIndex<MaxDeriv + 1> deriv_info_index_{};
   alignas(64) std::atomic<double> expiration_time_{};
   // Pad memory to avoid false-sharing when accessing expiration_time_
   char unused_padding_expr_[64 - (sizeof(std::atomic<double>) % 64)] = {};
@@ -122,6 +144,20 @@ class PiecewisePolynomial : public FunctionOfTime {
   char unused_padding_info_size_[64 - (sizeof(std::atomic_uint64_t) % 64)] = {};
   // No need to pup this since a default constructed mutex is always unlocked
   std::mutex update_mutex_{};
+
+  // The function and up to two derivatives at a time the function was
+  // evaluated at. Only the first `number_of_derivs + 1` values are set.
+  struct CachedEvaluation {
+    double time;
+    size_t number_of_derivs;
+    std::array<DataVector, 3> values;
+  };
+  void clear_cached_evaluations();
+  // The last few evaluations, which are read and replaced atomically since
+  // all threads on a node share them. Not pupped, since they are recomputed.
+  mutable std::array<std::shared_ptr<const CachedEvaluation>, 4>
+      cached_evaluations_{};
+  mutable std::atomic_size_t next_cached_evaluation_{0};
 };
 
 template <size_t MaxDeriv>
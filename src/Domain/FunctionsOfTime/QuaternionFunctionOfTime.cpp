@@ -14,6 +14,7 @@
 #include <mutex>
 #include <ostream>
 #include <pup_stl.h>
+#include <utility>
 
 #include "Domain/FunctionsOfTime/QuaternionHelpers.hpp"
 #include "NumericalAlgorithms/OdeIntegration/OdeIntegration.hpp"
@@ -56,6 +57,8 @@ QuaternionFunctionOfTime<MaxDeriv>::operator=(
   expiration_time_.store(
       rhs.expiration_time_.exchange(0, std::memory_order_acq_rel),
       std::memory_order_release);
+  clear_cached_quaternions();
+  rhs.clear_cached_quaternions();
   return *this;
 }
 
@@ -80,9 +83,18 @@ QuaternionFunctionOfTime<MaxDeriv>::operator=(
       std::memory_order_release);
   expiration_time_.store(rhs.expiration_time_.load(std::memory_order_acquire),
                          std::memory_order_release);
+  clear_cached_quaternions();
   return *this;
 }
 
+template <size_t MaxDeriv>
+void QuaternionFunctionOfTime<MaxDeriv>::clear_cached_quaternions() {
+  const std::lock_guard<std::mutex> cache_lock{cache_mutex_};
+  for (auto& [cached_time, cached_quaternion] : cached_quaternions_) {
+    cached_time = std::numeric_limits<double>::signaling_NaN();
+  }
+}
+
 template <size_t MaxDeriv>
 std::unique_ptr<FunctionOfTime> QuaternionFunctionOfTime<MaxDeriv>::get_clone()
     const {
@@ -268,6 +280,15 @@ void QuaternionFunctionOfTime<MaxDeriv>::solve_quaternion_ode(
 template <size_t MaxDeriv>
 boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
     const double t) const {
+  {
+    const std::lock_guard<std::mutex> cache_lock{cache_mutex_};
+    for (const auto& [cached_time, cached_quaternion] : cached_quaternions_) {
+      if (cached_time == t) {
+        return cached_quaternion;
+      }
+    }
+  }
+
   // Get quaternion and time at closest time before t
   const auto& stored_info_at_t0 = stored_info_from_upper_bound(
       t, stored_quaternions_and_times_,
@@ -282,6 +303,16 @@ boost::math::quaternion<double> QuaternionFunctionOfTime<MaxDeriv>::setup_func(
   // Make unit quaternion
   normalize_quaternion(make_not_null(&quat_to_integrate));
 
+  // Another thread may have integrated to the same time in the meantime, in
+  // which case the time is cached twice, which is harmless.
+  {
+    const std::lock_guard<std::mutex> cache_lock{cache_mutex_};
+    gsl::at(cached_quaternions_, next_cached_quaternion_) =
+        std::pair{t, quat_to_integrate};
+    next_cached_quaternion_ =
+        (next_cached_quaternion_ + 1) % cached_quaternions_.size();
+  }
+
   return quat_to_integrate;
 }
 
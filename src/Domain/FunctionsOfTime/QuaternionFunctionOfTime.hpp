@@ -12,12 +12,14 @@
 #include <mutex>
 #include <pup.h>
 #include <string>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTimeHelpers.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 
 namespace domain::FunctionsOfTime {
@@ -56,6 +58,13 @@ namespace domain::FunctionsOfTime {
  * are needed for the map). This is all to keep the symmetry of naming
  * `angle_func` and `quat_func` so that function calls won't be ambiguous.
  *
+ * Since all elements on a node share the function of time in the global
+ * cache and evaluate it at the same times, the quaternions integrated for the
+ * last few times are cached, so the ODE is usually solved once per time per
+ * node. The quaternion at a time never changes once it can be evaluated, so
+ * the cache is never invalidated. The derivatives of the quaternion are
+ * computed from it and the angle without integrating, so they are not cached.
+ *
  * \note This class conforms to the requirements of the
  * `Parallel::GlobalCache` for objects held by mutable global cache tags.
  */
@@ -175,6 +184,17 @@ class QuaternionFunctionOfTime : public FunctionOfTime {
 
   domain::FunctionsOfTime::PiecewisePolynomial<MaxDeriv> angle_f_of_t_;
 
+  // The quaternions integrated for the most recently evaluated times, shared
+  // by the threads evaluating this function. These are neither copied nor
+  // pupped since they are recomputed as needed.
+  void clear_cached_quaternions();
+  mutable std::mutex cache_mutex_{};
+  mutable std::array<std::pair<double, boost::math::quaternion<double>>, 4>
+      cached_quaternions_{make_array<4>(
+          std::pair{std::numeric_limits<double>::signaling_NaN(),
+                    boost::math::quaternion<double>{}})};
+  mutable size_t next_cached_quaternion_{0};
+
   /// Integrates the ODE \f$ \dot{q} = \frac{1}{2} q \times \omega \f$ from time
   /// `t0` to time `t`. On input, `quaternion_to_integrate` is the initial
   /// quaternion at time `t0` and on output, it stores the result at time `t`
@@ -13,6 +13,8 @@
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
@@ -65,6 +67,26 @@ double minimum_grid_spacing(const Index<Dim>& extents,
   return minimum_spacing;
 }
 
+namespace domain::Tags {
+template <size_t Dim>
+void MinimumInertialGridSpacingCompute<Dim>::function(
+    const gsl::not_null<double*> result, const ::Mesh<Dim>& mesh,
+    const double minimum_grid_frame_spacing,
+    const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
+        grid_to_inertial_map,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coordinates) {
+  if (grid_to_inertial_map.preserves_distances()) {
+    *result = minimum_grid_frame_spacing;
+  } else {
+    *result = minimum_grid_spacing(mesh.extents(), inertial_coordinates);
+  }
+}
+
+template struct MinimumInertialGridSpacingCompute<1>;
+template struct MinimumInertialGridSpacingCompute<2>;
+template struct MinimumInertialGridSpacingCompute<3>;
+}  // namespace domain::Tags
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
 
@@ -18,6 +18,14 @@ template <size_t Dim>
 class Index;
 template <size_t Dim>
 class Mesh;
+namespace domain {
+template <typename SourceFrame, typename TargetFrame, size_t Dim>
+class CoordinateMapBase;
+namespace CoordinateMaps::Tags {
+template <size_t VolumeDim, typename SourceFrame, typename TargetFrame>
+struct CoordinateMap;
+}  // namespace CoordinateMaps::Tags
+}  // namespace domain
 /// \endcond
 
 /// \ingroup ComputationalDomainGroup
@@ -50,5 +58,35 @@ struct MinimumGridSpacingCompute : MinimumGridSpacing<Dim, Frame>,
   using argument_tags = tmpl::list<Mesh<Dim>, Coordinates<Dim, Frame>>;
 };
 /// @}
+
+/// \ingroup ComputationalDomainGroup
+/// \ingroup DataBoxTagsGroup
+/// \brief The minimum inertial coordinate distance between grid points on a
+/// moving mesh.
+///
+/// \details If the grid to inertial map preserves distances, e.g. because it
+/// is the identity or a rigid rotation and translation, this is the minimum
+/// grid-frame spacing, which doesn't change as the mesh moves. This makes the
+/// item \f$O(1)\f$ to update, e.g. for the CFL step chooser at every step.
+/// Otherwise the spacing is computed from the inertial coordinates like
+/// `MinimumGridSpacingCompute`.
+template <size_t Dim>
+struct MinimumInertialGridSpacingCompute
+    : MinimumGridSpacing<Dim, Frame::Inertial>,
+      db::ComputeTag {
+  using base = MinimumGridSpacing<Dim, Frame::Inertial>;
+  using return_type = double;
+  static void function(
+      gsl::not_null<double*> result, const ::Mesh<Dim>& mesh,
+      double minimum_grid_frame_spacing,
+      const domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>&
+          grid_to_inertial_map,
+      const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coordinates);
+  using argument_tags =
+      tmpl::list<Mesh<Dim>, MinimumGridSpacing<Dim, Frame::Grid>,
+                 CoordinateMaps::Tags::CoordinateMap<Dim, Frame::Grid,
+                                                     Frame::Inertial>,
+                 Coordinates<Dim, Frame::Inertial>>;
+};
 }  // namespace Tags
 }  // namespace domain
@@ -4,23 +4,54 @@
 #include "Domain/TagsTimeDependent.hpp"
 
 #include <memory>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Domain.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace domain::Tags {
+namespace detail {
+template <size_t Dim>
+void GridToInertialInputs<Dim>::pup(PUP::er& p) {
+  p | source_coords;
+  p | functions_of_time_values;
+  if (p.isUnpacking()) {
+    map = nullptr;
+  }
+}
+
+void functions_of_time_values(
+    const gsl::not_null<std::vector<double>*> values,
+    const std::unordered_set<std::string>& function_of_time_names,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) {
+  values->clear();
+  for (const std::string& name : function_of_time_names) {
+    for (const DataVector& value_or_derivative :
+         functions_of_time.at(name)->func_and_deriv(time)) {
+      values->insert(values->end(), value_or_derivative.begin(),
+                     value_or_derivative.end());
+    }
+  }
+}
+}  // namespace detail
+
 template <size_t Dim>
 void InertialFromGridCoordinatesCompute<Dim>::function(
     const gsl::not_null<tnsr::I<DataVector, Dim, Frame::Inertial>*>
         target_coords,
     const tnsr::I<DataVector, Dim, Frame::Grid>& source_coords,
-    const std::optional<std::tuple<
-        tnsr::I<DataVector, Dim, Frame::Inertial>,
-        ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+    const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
         grid_to_inertial_quantities) {
   if (not grid_to_inertial_quantities.has_value()) {
     // We use a const_cast to point the data into the existing allocation
@@ -49,11 +80,7 @@ void GridToInertialInverseJacobian<Dim>::function(
     const gsl::not_null<
         ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>*>
         inv_jac_grid_to_inertial,
-    const std::optional<std::tuple<
-        tnsr::I<DataVector, Dim, Frame::Inertial>,
-        ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+    const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
         grid_to_inertial_quantities) {
   if (not grid_to_inertial_quantities.has_value()) {
     ERROR(
@@ -79,11 +106,7 @@ void ElementToInertialInverseJacobian<Dim>::function(
         inv_jac_logical_to_inertial,
     const ::InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                             Frame::Grid>& inv_jac_logical_to_grid,
-    const std::optional<std::tuple<
-        tnsr::I<DataVector, Dim, Frame::Inertial>,
-        ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+    const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
         grid_to_inertial_quantities) {
   if (not grid_to_inertial_quantities.has_value()) {
     // We use a const_cast to point the data into the existing allocation
@@ -115,11 +138,7 @@ void ElementToInertialInverseJacobian<Dim>::function(
 template <size_t Dim>
 void InertialMeshVelocityCompute<Dim>::function(
     const gsl::not_null<return_type*> mesh_velocity,
-    const std::optional<std::tuple<
-        tnsr::I<DataVector, Dim, Frame::Inertial>,
-        ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-        tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+    const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
         grid_to_inertial_quantities) {
   if (not grid_to_inertial_quantities.has_value()) {
     *mesh_velocity = std::nullopt;
@@ -143,6 +162,7 @@ void InertialMeshVelocityCompute<Dim>::function(
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                                     \
+  template struct detail::GridToInertialInputs<DIM(data)>;       \
   template struct InertialFromGridCoordinatesCompute<DIM(data)>; \
   template struct ElementToInertialInverseJacobian<DIM(data)>;   \
   template struct InertialMeshVelocityCompute<DIM(data)>;        \
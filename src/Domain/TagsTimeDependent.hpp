@@ -9,6 +9,9 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -23,6 +26,9 @@
 #include "Utilities/TMPL.hpp"
 
 /// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
 namespace Tags {
 struct Time;
 }  // namespace Tags
@@ -32,9 +38,40 @@ namespace domain {
 /// \ingroup ComputationalDomainGroup
 /// \brief %Tags for the domain.
 namespace Tags {
+namespace detail {
+/// \brief The inputs the `CoordinatesMeshVelocityAndJacobians` were last
+/// computed from.
+///
+/// Time-dependent maps only depend on time through their functions of time, so
+/// the quantities do not have to be recomputed as long as the map, the source
+/// coordinates, and the values and first derivatives of the functions of time
+/// the map uses are unchanged.
+template <size_t Dim>
+struct GridToInertialInputs {
+  /// Only compared, never dereferenced. It is not serialized so that the
+  /// quantities are always recomputed after the DataBox is unpacked.
+  const void* map = nullptr;
+  tnsr::I<DataVector, Dim, Frame::Grid> source_coords{};
+  std::vector<double> functions_of_time_values{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+/// The values and first derivatives of the functions of time named
+/// `function_of_time_names` at `time`, concatenated.
+void functions_of_time_values(
+    gsl::not_null<std::vector<double>*> values,
+    const std::unordered_set<std::string>& function_of_time_names, double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time);
+}  // namespace detail
+
 /// The Inertial coordinates, the inverse Jacobian from the Grid to the Inertial
 /// frame, the Jacobian from the Grid to the Inertial frame, and the Inertial
-/// mesh velocity.
+/// mesh velocity. The last element of the tuple records what these were
+/// computed from.
 ///
 /// The type is a `std::optional`, which, when is not valid, signals that the
 /// mesh is not moving. Thus,
@@ -46,12 +83,20 @@ struct CoordinatesMeshVelocityAndJacobians : db::SimpleTag {
       tnsr::I<DataVector, Dim, Frame::Inertial>,
       ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
       ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-      tnsr::I<DataVector, Dim, Frame::Inertial>>>;
+      tnsr::I<DataVector, Dim, Frame::Inertial>,
+      detail::GridToInertialInputs<Dim>>>;
 };
 
 /// Computes the Inertial coordinates, the inverse Jacobian from the Grid to the
 /// Inertial frame, the Jacobian from the Grid to the Inertial frame, and the
 /// Inertial mesh velocity.
+///
+/// The DataBox resets this item whenever the time changes, but the map is only
+/// evaluated again if the functions of time it depends on (or the map or the
+/// source coordinates) actually changed. Blocks whose maps use functions of
+/// time that are constant, as well as blocks with time-independent maps, keep
+/// the values computed previously. This costs a copy of the source coordinates
+/// per element.
 template <typename MapTagGridToInertial>
 struct CoordinatesMeshVelocityAndJacobiansCompute
     : CoordinatesMeshVelocityAndJacobians<MapTagGridToInertial::dim>,
@@ -72,12 +117,30 @@ struct CoordinatesMeshVelocityAndJacobiansCompute
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) {
     // Use identity to signal time-independent
-    if (not grid_to_inertial_map.is_identity()) {
-      *result = grid_to_inertial_map.coords_frame_velocity_jacobians(
-          source_coords, time, functions_of_time);
-    } else {
+    if (grid_to_inertial_map.is_identity()) {
       *result = std::nullopt;
+      return;
+    }
+    std::vector<double> functions_of_time_values{};
+    detail::functions_of_time_values(
+        make_not_null(&functions_of_time_values),
+        grid_to_inertial_map.function_of_time_names(), time, functions_of_time);
+    if (result->has_value()) {
+      const auto& inputs = std::get<4>(**result);
+      if (inputs.map == &grid_to_inertial_map and
+          inputs.functions_of_time_values == functions_of_time_values and
+          inputs.source_coords == source_coords) {
+        return;
+      }
     }
+    auto [coords, inv_jacobian, jacobian, velocity] =
+        grid_to_inertial_map.coords_frame_velocity_jacobians(
+            source_coords, time, functions_of_time);
+    *result = std::make_tuple(
+        std::move(coords), std::move(inv_jacobian), std::move(jacobian),
+        std::move(velocity),
+        detail::GridToInertialInputs<dim>{&grid_to_inertial_map, source_coords,
+                                          std::move(functions_of_time_values)});
   }
 
   using argument_tags =
@@ -97,11 +160,7 @@ struct InertialFromGridCoordinatesCompute
   static void function(
       gsl::not_null<tnsr::I<DataVector, Dim, Frame::Inertial>*> target_coords,
       const tnsr::I<DataVector, Dim, Frame::Grid>& source_coords,
-      const std::optional<std::tuple<
-          tnsr::I<DataVector, Dim, Frame::Inertial>,
-          ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+      const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
           grid_to_inertial_quantities);
 
   using argument_tags = tmpl::list<Tags::Coordinates<Dim, Frame::Grid>,
@@ -122,11 +181,7 @@ struct GridToInertialInverseJacobian
       gsl::not_null<
           ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>*>
           inv_jac_grid_to_inertial,
-      const std::optional<std::tuple<
-          tnsr::I<DataVector, Dim, Frame::Inertial>,
-          ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+      const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
           grid_to_inertial_quantities);
 
   using argument_tags = tmpl::list<CoordinatesMeshVelocityAndJacobians<Dim>>;
@@ -148,11 +203,7 @@ struct ElementToInertialInverseJacobian
           inv_jac_logical_to_inertial,
       const ::InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                               Frame::Grid>& inv_jac_logical_to_grid,
-      const std::optional<std::tuple<
-          tnsr::I<DataVector, Dim, Frame::Inertial>,
-          ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+      const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
           grid_to_inertial_quantities);
 
   using argument_tags =
@@ -181,11 +232,7 @@ struct InertialMeshVelocityCompute : MeshVelocity<Dim, Frame::Inertial>,
 
   static void function(
       gsl::not_null<return_type*> mesh_velocity,
-      const std::optional<std::tuple<
-          tnsr::I<DataVector, Dim, Frame::Inertial>,
-          ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
-          tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+      const typename CoordinatesMeshVelocityAndJacobians<Dim>::type&
           grid_to_inertial_quantities);
 
   using argument_tags = tmpl::list<CoordinatesMeshVelocityAndJacobians<Dim>>;
@@ -0,0 +1,291 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "IO/Importers/Actions/ReadVolumeData.hpp"
+#include "IO/Importers/ElementDataReader.hpp"
+#include "IO/Importers/Tags.hpp"
+#include "Options/String.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "PointwiseFunctions/InitialDataUtilities/InitialGuess.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace elliptic {
+
+/*!
+ * \brief An initial guess for the elliptic solve that is loaded from volume
+ * data files
+ *
+ * \details Use this initial guess to start the solve from a previous solution,
+ * e.g. from a solve with nearby parameters or at a lower resolution. The
+ * `FieldTags` that are solved for are read from the volume data files and,
+ * if interpolation is enabled, interpolated to the grid points of the new
+ * domain. The volume data written by the elliptic executables when they observe
+ * the fields can be loaded this way, so a sequence of solves can be chained
+ * from coarse to fine resolution by loading the solution of each solve as the
+ * initial guess for the next.
+ *
+ * The fields are set to zero by `elliptic::Actions::InitializeFields` and then
+ * imported by `elliptic::Actions::ReadNumericInitialGuess` and
+ * `elliptic::Actions::ReceiveNumericInitialGuess`.
+ *
+ * \note The elements on all multigrid levels receive the initial guess, but
+ * the observed volume data only contain the elements on the finest grid. So
+ * enable interpolation when solving with more than one multigrid level.
+ */
+template <typename FieldTags>
+class NumericInitialGuess : public elliptic::analytic_data::InitialGuess {
+ public:
+  /// Name of a variable in the volume data file
+  template <typename Tag>
+  struct VarName {
+    using tag = Tag;
+    static std::string name() { return db::tag_name<Tag>(); }
+    using type = std::string;
+    static constexpr Options::String help =
+        "Name of the variable in the volume data file";
+  };
+
+  /// The names of all fields in the volume data files
+  struct SelectedVariables : tuples::tagged_tuple_from_typelist<
+                                 db::wrap_tags_in<VarName, FieldTags>> {
+   private:
+    using base = tuples::tagged_tuple_from_typelist<
+        db::wrap_tags_in<VarName, FieldTags>>;
+
+   public:
+    static constexpr Options::String help =
+        "Names of the fields that are solved for in the volume data files.";
+    using options = typename base::tags_list;
+    using base::base;
+  };
+
+  struct Variables {
+    using type = SelectedVariables;
+    static constexpr Options::String help = SelectedVariables::help;
+  };
+
+  using options =
+      tmpl::list<importers::OptionTags::FileGlob,
+                 importers::OptionTags::Subgroup,
+                 importers::OptionTags::ObservationValue,
+                 importers::OptionTags::EnableInterpolation, Variables>;
+  static constexpr Options::String help =
+      "An initial guess loaded from volume data files, e.g. the solution of a "
+      "previous solve";
+
+  static std::string name() { return "NumericInitialGuess"; }
+
+  NumericInitialGuess() = default;
+  NumericInitialGuess(const NumericInitialGuess&) = default;
+  NumericInitialGuess& operator=(const NumericInitialGuess&) = default;
+  NumericInitialGuess(NumericInitialGuess&&) = default;
+  NumericInitialGuess& operator=(NumericInitialGuess&&) = default;
+  ~NumericInitialGuess() override = default;
+
+  NumericInitialGuess(
+      std::string file_glob, std::string subfile_name,
+      std::variant<double, importers::ObservationSelector> observation_value,
+      bool enable_interpolation, SelectedVariables selected_variables)
+      : importer_options_(std::move(file_glob), std::move(subfile_name),
+                          observation_value, enable_interpolation),
+        selected_variables_(std::move(selected_variables)) {}
+
+  /// \cond
+  explicit NumericInitialGuess(CkMigrateMessage* m)
+      : elliptic::analytic_data::InitialGuess(m) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(NumericInitialGuess);
+  /// \endcond
+
+  const importers::ImporterOptions& importer_options() const {
+    return importer_options_;
+  }
+
+  const SelectedVariables& selected_variables() const {
+    return selected_variables_;
+  }
+
+  /*!
+   * \brief Unique identifier for loading this volume data
+   *
+   * Involves a hash of the type name and the volume data file names.
+   */
+  size_t volume_data_id() const {
+    size_t hash = 0;
+    boost::hash_combine(hash, pretty_type::get_name<NumericInitialGuess>());
+    boost::hash_combine(
+        hash, get<importers::OptionTags::FileGlob>(importer_options_));
+    boost::hash_combine(
+        hash, get<importers::OptionTags::Subgroup>(importer_options_));
+    return hash;
+  }
+
+  /// Selects the datasets for all `FieldTags` in the volume data files
+  void select_for_import(
+      const gsl::not_null<tuples::tagged_tuple_from_typelist<
+          db::wrap_tags_in<importers::Tags::Selected, FieldTags>>*>
+          fields) const {
+    tmpl::for_each<FieldTags>([this, &fields](const auto tag_v) {
+      using tag = tmpl::type_from<decltype(tag_v)>;
+      get<importers::Tags::Selected<tag>>(*fields) =
+          get<VarName<tag>>(selected_variables_);
+    });
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    p | importer_options_;
+    p | selected_variables_;
+  }
+
+  friend bool operator==(const NumericInitialGuess& lhs,
+                         const NumericInitialGuess& rhs) {
+    return lhs.importer_options_ == rhs.importer_options_ and
+           lhs.selected_variables_ == rhs.selected_variables_;
+  }
+
+ private:
+  importers::ImporterOptions importer_options_{};
+  SelectedVariables selected_variables_{};
+};
+
+template <typename FieldTags>
+bool operator!=(const NumericInitialGuess<FieldTags>& lhs,
+                const NumericInitialGuess<FieldTags>& rhs) {
+  return not(lhs == rhs);
+}
+
+/// \cond
+template <typename FieldTags>
+PUP::able::PUP_ID NumericInitialGuess<FieldTags>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+
+namespace Actions {
+
+/*!
+ * \brief Dispatch loading the initial guess from volume data files if it is a
+ * `elliptic::NumericInitialGuess`.
+ *
+ * Place this action before `elliptic::Actions::ReceiveNumericInitialGuess` in
+ * the action list, e.g. in the `Parallel::Phase::ImportInitialData` phase. The
+ * elements must have registered with the `importers::ElementDataReader` in an
+ * earlier phase, see `importers::Actions::RegisterWithElementDataReader`.
+ * Other initial guesses were already set by
+ * `elliptic::Actions::InitializeFields`, so this action terminates the phase
+ * for them.
+ */
+template <typename System, typename InitialGuessTag>
+struct ReadNumericInitialGuess {
+ private:
+  using fields = typename System::primal_fields;
+
+ public:
+  using const_global_cache_tags = tmpl::list<InitialGuessTag>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto* const initial_guess =
+        dynamic_cast<const NumericInitialGuess<fields>*>(
+            &db::get<InitialGuessTag>(box));
+    if (initial_guess == nullptr) {
+      // Nothing to import, so we terminate the phase by pausing the algorithm
+      // on this element
+      return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+    }
+    tuples::tagged_tuple_from_typelist<
+        db::wrap_tags_in<importers::Tags::Selected, fields>>
+        selected_fields{};
+    initial_guess->select_for_import(make_not_null(&selected_fields));
+    // Not using `ckLocalBranch` here to make sure the simple action invocation
+    // is asynchronous
+    auto& reader_component = Parallel::get_parallel_component<
+        importers::ElementDataReader<Metavariables>>(cache);
+    Parallel::simple_action<importers::Actions::ReadAllVolumeDataAndDistribute<
+        Dim, fields, ParallelComponent>>(
+        reader_component, initial_guess->importer_options(),
+        initial_guess->volume_data_id(), std::move(selected_fields));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+/*!
+ * \brief Receive the initial guess loaded by
+ * `elliptic::Actions::ReadNumericInitialGuess`.
+ *
+ * Place this action after `elliptic::Actions::ReadNumericInitialGuess` in the
+ * action list to wait until the data for this element has arrived and store it
+ * as the initial guess for the fields.
+ *
+ * DataBox:
+ * - Modifies:
+ *   - `primal_fields`
+ */
+template <typename System, typename InitialGuessTag>
+struct ReceiveNumericInitialGuess {
+ private:
+  using fields = typename System::primal_fields;
+  using fields_tag = ::Tags::Variables<fields>;
+
+ public:
+  using inbox_tags = tmpl::list<importers::Tags::VolumeData<fields>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    auto& inbox = tuples::get<importers::Tags::VolumeData<fields>>(inboxes);
+    const auto& initial_guess =
+        dynamic_cast<const NumericInitialGuess<fields>&>(
+            db::get<InitialGuessTag>(box));
+    const size_t volume_data_id = initial_guess.volume_data_id();
+    if (inbox.find(volume_data_id) == inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    const auto numeric_data = std::move(inbox.extract(volume_data_id).mapped());
+    db::mutate<fields_tag>(
+        [&numeric_data](const gsl::not_null<typename fields_tag::type*>
+                            initial_fields) {
+          tmpl::for_each<fields>([&initial_fields, &numeric_data](
+                                     const auto tag_v) {
+            using tag = tmpl::type_from<decltype(tag_v)>;
+            get<tag>(*initial_fields) = get<tag>(numeric_data);
+          });
+        },
+        make_not_null(&box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+}  // namespace Actions
+}  // namespace elliptic
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -13,13 +14,15 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Tags.hpp"
-#include "Elliptic/Utilities/GetAnalyticData.hpp"
+#include "Elliptic/Actions/ImportInitialGuess.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/CallWithDynamicType.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
 
 namespace elliptic::Actions {
 
@@ -37,6 +40,12 @@ namespace elliptic::Actions {
  * DataBox:
  * - Adds:
  *   - `primal_fields`
+ *
+ * The initial guess can be any subclass of the `InitialGuessTag` base class
+ * that is listed in `Metavariables::factory_creation`. If it is an
+ * `elliptic::NumericInitialGuess` the fields are set to zero here and imported
+ * later by `elliptic::Actions::ReadNumericInitialGuess` and
+ * `elliptic::Actions::ReceiveNumericInitialGuess`.
  */
 template <typename System, typename InitialGuessTag>
 struct InitializeFields {
@@ -59,9 +68,22 @@ struct InitializeFields {
     const auto& inertial_coords =
         get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(box);
     const auto& initial_guess = db::get<InitialGuessTag>(box);
+    using initial_guess_classes =
+        tmpl::at<typename Metavariables::factory_creation::factory_classes,
+                 std::decay_t<decltype(initial_guess)>>;
     auto initial_fields =
-        elliptic::util::get_analytic_data<typename fields_tag::tags_list>(
-            initial_guess, box, inertial_coords);
+        call_with_dynamic_type<typename fields_tag::type,
+                               initial_guess_classes>(
+            &initial_guess, [&inertial_coords](const auto* const derived) {
+              using derived_type = std::decay_t<decltype(*derived)>;
+              if constexpr (tt::is_a_v<NumericInitialGuess, derived_type>) {
+                return typename fields_tag::type{
+                    get<0>(inertial_coords).size(), 0.};
+              } else {
+                return variables_from_tagged_tuple(derived->variables(
+                    inertial_coords, typename fields_tag::tags_list{}));
+              }
+            });
     ::Initialization::mutate_assign<simple_tags>(make_not_null(&box),
                                                  std::move(initial_fields));
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
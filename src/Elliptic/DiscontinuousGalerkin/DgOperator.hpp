@@ -356,11 +356,11 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
            "you also set 'Linearized' to 'true'.");
     const size_t num_points = mesh.number_of_grid_points();
 
-    // This function and the one below allocate various Variables to compute
-    // intermediate quantities. It could be a performance optimization to reduce
-    // the number of these allocations and/or move some of the memory buffers
-    // into the DataBox to keep them around permanently. The latter should be
-    // informed by profiling.
+    // This function and the one below compute intermediate quantities in
+    // Variables buffers that are allocated once per call and re-used on all
+    // faces and mortars. It could be a further optimization to move these
+    // memory buffers into the DataBox to keep them around permanently. That
+    // should be informed by profiling.
 
     // Compute the auxiliary variables, and from those the primal fluxes. The
     // auxiliary variables are the variables `v` in the auxiliary equations
@@ -411,7 +411,13 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
     }
 
     // Populate the mortar data on this element's side of the boundary so it's
-    // ready to be sent to neighbors.
+    // ready to be sent to neighbors. These buffers are re-used on all faces and
+    // only re-allocated when the number of points on the face changes.
+    Variables<tmpl::list<PrimalFluxesVars..., AuxiliaryFluxesVars...>>
+        fluxes_on_face{};
+    Variables<tmpl::list<::Tags::NormalDotFlux<AuxiliaryFields>...>>
+        n_dot_aux_fluxes{};
+    Variables<tmpl::list<PrimalVars...>> dirichlet_vars{};
     for (const auto& direction : [&element]() -> const auto& {
            if constexpr (AllDataIsZero) {
              // Skipping internal boundaries for all-zero data because they
@@ -445,10 +451,6 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       const auto& face_normal_magnitude = face_normal_magnitudes.at(direction);
       const auto& fluxes_args_on_face = fluxes_args_on_faces.at(direction);
       const size_t slice_index = index_to_slice_at(mesh.extents(), direction);
-      Variables<tmpl::list<PrimalFluxesVars..., AuxiliaryFluxesVars...>>
-          fluxes_on_face{};
-      Variables<tmpl::list<::Tags::NormalDotFlux<AuxiliaryFields>...>>
-          n_dot_aux_fluxes{};
       BoundaryData<tmpl::list<PrimalMortarVars...>,
                    tmpl::list<PrimalMortarFluxes...>>
           boundary_data{face_num_points};
@@ -558,10 +560,10 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
         // the boundary conditions is taken from the "interior" side of the
         // boundary, i.e. with a normal vector that points _out_ of the
         // computational domain.
-        Variables<tmpl::list<PrimalVars...>> dirichlet_vars{face_num_points};
         if constexpr (AllDataIsZero) {
           dirichlet_vars.initialize(face_num_points, 0.);
         } else {
+          dirichlet_vars.initialize(face_num_points);
           data_on_slice(make_not_null(&dirichlet_vars), primal_vars,
                         mesh.extents(), direction.dimension(), slice_index);
         }
@@ -726,11 +728,7 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
            "you also set 'Linearized' to 'true'.");
     const size_t num_points = mesh.number_of_grid_points();
 
-    // This function and the one above allocate various Variables to compute
-    // intermediate quantities. It could be a performance optimization to reduce
-    // the number of these allocations and/or move some of the memory buffers
-    // into the DataBox to keep them around permanently. The latter should be
-    // informed by profiling.
+    // See `prepare_mortar_data` for a note on the memory buffers used here.
 
     // Add boundary corrections to the auxiliary variables _before_ computing
     // the second derivative. This is called the "flux" formulation. It is
@@ -751,6 +749,11 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
     // Keeping track if any corrections were applied here, for an optimization
     // below
     bool has_any_boundary_corrections = false;
+    // Buffers for the boundary corrections on mortars and faces, re-used on all
+    // mortars
+    Variables<tmpl::list<PrimalMortarFluxes...>>
+        auxiliary_boundary_corrections{};
+    Variables<tmpl::list<PrimalMortarVars...>> primal_boundary_corrections{};
     for (const auto& [mortar_id, mortar_data] : *all_mortar_data) {
       const auto& [direction, neighbor_id] = mortar_id;
       const bool is_internal =
@@ -781,46 +784,43 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       const auto& mortar_size =
           is_internal ? all_mortar_sizes.at(mortar_id) : full_mortar_size;
 
-      // This is the _strong_ auxiliary boundary correction avg(n.F_v) - n.F_v
-      auto auxiliary_boundary_corrections_on_mortar =
-          Variables<tmpl::list<PrimalMortarFluxes...>>(
-              local_data.field_data.template extract_subset<
-                  tmpl::list<::Tags::NormalDotFlux<PrimalMortarFluxes>...>>());
-      const auto add_remote_contribution = [](auto& lhs, const auto& rhs) {
-        for (size_t i = 0; i < lhs.size(); ++i) {
-          lhs[i] += rhs[i];
+      // This is the _strong_ auxiliary boundary correction avg(n.F_v) - n.F_v,
+      // computed in a single pass over the mortar data. The sign is inverted
+      // here to account for the extra minus sign in the `dg::lift_flux`
+      // function below.
+      auxiliary_boundary_corrections.initialize(
+          mortar_mesh.number_of_grid_points());
+      const auto assign_half_sum = [](const auto result, const auto& local,
+                                      const auto& remote) {
+        for (size_t i = 0; i < local.size(); ++i) {
+          (*result)[i] = 0.5 * (local[i] + remote[i]);
         }
       };
-      EXPAND_PACK_LEFT_TO_RIGHT(add_remote_contribution(
-          get<PrimalMortarFluxes>(auxiliary_boundary_corrections_on_mortar),
+      EXPAND_PACK_LEFT_TO_RIGHT(assign_half_sum(
+          make_not_null(
+              &get<PrimalMortarFluxes>(auxiliary_boundary_corrections)),
+          get<::Tags::NormalDotFlux<PrimalMortarFluxes>>(local_data.field_data),
           get<::Tags::NormalDotFlux<PrimalMortarFluxes>>(
               remote_data.field_data)));
-      auxiliary_boundary_corrections_on_mortar *= -0.5;
 
       // Project from the mortar back down to the face if needed
-      auto auxiliary_boundary_corrections =
-          Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size)
-              ? mass_conservative_restriction(
-                    std::move(auxiliary_boundary_corrections_on_mortar),
-                    mortar_mesh, mortar_size, mortar_jacobians.at(mortar_id),
-                    face_mesh, face_jacobians.at(direction))
-              : std::move(auxiliary_boundary_corrections_on_mortar);
+      if (Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size)) {
+        auxiliary_boundary_corrections = mass_conservative_restriction(
+            std::move(auxiliary_boundary_corrections), mortar_mesh,
+            mortar_size, mortar_jacobians.at(mortar_id), face_mesh,
+            face_jacobians.at(direction));
+      }
 
       // Lift the boundary correction to the volume, but still only provide the
       // data only on the face because it is zero everywhere else. This is the
       // "massless" lifting operation, i.e. it involves an inverse mass matrix.
       // The mass matrix is diagonally approximated ("mass lumping") so it
       // reduces to a division by quadrature weights.
-      ::dg::lift_flux(make_not_null(&auxiliary_boundary_corrections),
-                      mesh.extents(direction.dimension()),
-                      face_normal_magnitude);
-      // The `dg::lift_flux` function contains an extra minus sign
-      auxiliary_boundary_corrections *= -1.;
-
-      // Add the boundary corrections to the auxiliary variables
-      add_slice_to_data(make_not_null(&primal_fluxes_corrected),
-                        auxiliary_boundary_corrections, mesh.extents(),
-                        direction.dimension(), slice_index);
+      // Add the lifted boundary corrections to the auxiliary variables.
+      ::dg::lift_flux_to_volume(make_not_null(&primal_fluxes_corrected),
+                                auxiliary_boundary_corrections, mesh.extents(),
+                                direction.dimension(), slice_index,
+                                face_normal_magnitude);
     }  // apply auxiliary boundary corrections on all mortars
 
     // Compute the primal equation, i.e. the actual DG operator, by taking the
@@ -889,49 +889,42 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
           std::max(get<Tags::PerpendicularNumPoints>(local_data.extra_data),
                    get<Tags::PerpendicularNumPoints>(remote_data.extra_data)),
           penalty_parameter);
-      // Start with the penalty term
-      auto primal_boundary_corrections_on_mortar =
-          Variables<tmpl::list<PrimalMortarVars...>>(
-              local_data.field_data.template extract_subset<tmpl::list<
-                  Tags::NormalDotFluxForJump<PrimalMortarVars>...>>());
-      const auto add_remote_jump_contribution = [](auto& lhs, const auto& rhs) {
-        for (size_t i = 0; i < lhs.size(); ++i) {
-          lhs[i] -= rhs[i];
-        }
-      };
-      EXPAND_PACK_LEFT_TO_RIGHT(add_remote_jump_contribution(
-          get<PrimalMortarVars>(primal_boundary_corrections_on_mortar),
+      // The penalty term and the average are computed in a single pass over
+      // the mortar data
+      primal_boundary_corrections.initialize(
+          mortar_mesh.number_of_grid_points());
+      const auto assign_primal_correction =
+          [penalty](const auto result, const auto& local_jump_term,
+                    const auto& remote_jump_term, const auto& local_n_dot_flux,
+                    const auto& remote_n_dot_flux) {
+            for (size_t i = 0; i < local_jump_term.size(); ++i) {
+              (*result)[i] =
+                  penalty * (remote_jump_term[i] - local_jump_term[i]) -
+                  0.5 * (local_n_dot_flux[i] + remote_n_dot_flux[i]);
+            }
+          };
+      EXPAND_PACK_LEFT_TO_RIGHT(assign_primal_correction(
+          make_not_null(&get<PrimalMortarVars>(primal_boundary_corrections)),
           get<Tags::NormalDotFluxForJump<PrimalMortarVars>>(
-              remote_data.field_data)));
-      primal_boundary_corrections_on_mortar *= penalty;
-      const auto add_remote_avg_contribution = [](auto& lhs, const auto& rhs) {
-        for (size_t i = 0; i < lhs.size(); ++i) {
-          lhs[i] += 0.5 * rhs[i];
-        }
-      };
-      EXPAND_PACK_LEFT_TO_RIGHT(add_remote_avg_contribution(
-          get<PrimalMortarVars>(primal_boundary_corrections_on_mortar),
-          get<::Tags::NormalDotFlux<PrimalMortarVars>>(local_data.field_data)));
-      EXPAND_PACK_LEFT_TO_RIGHT(add_remote_avg_contribution(
-          get<PrimalMortarVars>(primal_boundary_corrections_on_mortar),
+              local_data.field_data),
+          get<Tags::NormalDotFluxForJump<PrimalMortarVars>>(
+              remote_data.field_data),
+          get<::Tags::NormalDotFlux<PrimalMortarVars>>(local_data.field_data),
           get<::Tags::NormalDotFlux<PrimalMortarVars>>(
               remote_data.field_data)));
-      primal_boundary_corrections_on_mortar *= -1.;
 
       // Project from the mortar back down to the face if needed, lift and add
       // to operator. See auxiliary boundary corrections above for details.
-      auto primal_boundary_corrections =
-          Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size)
-              ? mass_conservative_restriction(
-                    std::move(primal_boundary_corrections_on_mortar),
-                    mortar_mesh, mortar_size, mortar_jacobians.at(mortar_id),
-                    face_mesh, face_jacobians.at(direction))
-              : std::move(primal_boundary_corrections_on_mortar);
-      ::dg::lift_flux(make_not_null(&primal_boundary_corrections),
-                      mesh.extents(direction.dimension()),
-                      face_normal_magnitude);
-      add_slice_to_data(operator_applied_to_vars, primal_boundary_corrections,
-                        mesh.extents(), direction.dimension(), slice_index);
+      if (Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size)) {
+        primal_boundary_corrections = mass_conservative_restriction(
+            std::move(primal_boundary_corrections), mortar_mesh, mortar_size,
+            mortar_jacobians.at(mortar_id), face_mesh,
+            face_jacobians.at(direction));
+      }
+      ::dg::lift_flux_to_volume(operator_applied_to_vars,
+                                primal_boundary_corrections, mesh.extents(),
+                                direction.dimension(), slice_index,
+                                face_normal_magnitude);
     }  // loop over all mortars
 
     // Apply DG mass matrix
@@ -67,7 +67,7 @@ void InitializeGeometry<Dim>::operator()(
                                                             initial_refinement);
   // Element map
   *element_map = ElementMap<Dim, Frame::Inertial>{
-      element_id, block.stationary_map().get_clone()};
+      element_id, block.shared_stationary_map()};
   // Coordinates
   *logical_coords = logical_coordinates(*mesh);
   *inertial_coords = element_map->operator()(*logical_coords);
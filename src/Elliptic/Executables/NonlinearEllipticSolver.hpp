@@ -10,6 +10,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Tags/Faces.hpp"
+#include "Elliptic/Actions/ImportInitialGuess.hpp"
 #include "Elliptic/Actions/InitializeAnalyticSolution.hpp"
 #include "Elliptic/Actions/InitializeFields.hpp"
 #include "Elliptic/Actions/InitializeFixedSources.hpp"
@@ -187,6 +188,13 @@ struct Solver {
           elliptic::Tags::BoundaryFluxesCompute<volume_dim, fields_tag,
                                                 fluxes_tag>>>>;
 
+  /// Import the initial guess from volume data files if it is an
+  /// `elliptic::NumericInitialGuess`. The elements must be registered with the
+  /// `importers::ElementDataReader` before.
+  using import_initial_guess_actions = tmpl::list<
+      elliptic::Actions::ReadNumericInitialGuess<system, initial_guess_tag>,
+      elliptic::Actions::ReceiveNumericInitialGuess<system, initial_guess_tag>>;
+
   using register_actions =
       tmpl::list<typename nonlinear_solver::register_element,
                  typename multigrid::register_element,
@@ -11,6 +11,7 @@
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
 #include "Domain/RadiallyCompressedCoordinates.hpp"
 #include "Domain/Tags.hpp"
+#include "Elliptic/Actions/ImportInitialGuess.hpp"
 #include "Elliptic/Actions/RunEventsAndTriggers.hpp"
 #include "Elliptic/BoundaryConditions/BoundaryCondition.hpp"
 #include "Elliptic/DiscontinuousGalerkin/DgElementArray.hpp"
@@ -20,6 +21,8 @@
 #include "Elliptic/Systems/Xcts/FirstOrderSystem.hpp"
 #include "Elliptic/Systems/Xcts/HydroQuantities.hpp"
 #include "Elliptic/Triggers/Factory.hpp"
+#include "IO/Importers/Actions/RegisterWithElementDataReader.hpp"
+#include "IO/Importers/ElementDataReader.hpp"
 #include "IO/Observer/Actions/RegisterEvents.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -118,7 +121,9 @@ struct Metavariables {
         tmpl::pair<elliptic::analytic_data::Background,
                    analytic_solutions_and_data>,
         tmpl::pair<elliptic::analytic_data::InitialGuess,
-                   analytic_solutions_and_data>,
+                   tmpl::push_back<analytic_solutions_and_data,
+                                   elliptic::NumericInitialGuess<
+                                       typename system::primal_fields>>>,
         tmpl::pair<elliptic::analytic_data::AnalyticSolution,
                    Xcts::Solutions::all_analytic_solutions>,
         tmpl::pair<
@@ -144,6 +149,10 @@ struct Metavariables {
       tmpl::push_back<typename solver::initialization_actions,
                       Parallel::Actions::TerminatePhase>;
 
+  using import_actions =
+      tmpl::push_back<typename solver::import_initial_guess_actions,
+                      Parallel::Actions::TerminatePhase>;
+
   using register_actions =
       tmpl::push_back<typename solver::register_actions,
                       observers::Actions::RegisterEventsWithObservers,
@@ -161,6 +170,12 @@ struct Metavariables {
       tmpl::list<
           Parallel::PhaseActions<Parallel::Phase::Initialization,
                                  initialization_actions>,
+          Parallel::PhaseActions<
+              Parallel::Phase::RegisterWithElementDataReader,
+              tmpl::list<importers::Actions::RegisterWithElementDataReader,
+                         Parallel::Actions::TerminatePhase>>,
+          Parallel::PhaseActions<Parallel::Phase::ImportInitialData,
+                                 import_actions>,
           Parallel::PhaseActions<Parallel::Phase::Register, register_actions>,
           Parallel::PhaseActions<Parallel::Phase::Solve, solve_actions>>,
       LinearSolver::multigrid::ElementsAllocator<
@@ -170,10 +185,13 @@ struct Metavariables {
   using component_list = tmpl::flatten<
       tmpl::list<dg_element_array, typename solver::component_list,
                  observers::Observer<Metavariables>,
-                 observers::ObserverWriter<Metavariables>>>;
+                 observers::ObserverWriter<Metavariables>,
+                 importers::ElementDataReader<Metavariables>>>;
 
-  static constexpr std::array<Parallel::Phase, 4> default_phase_order{
-      {Parallel::Phase::Initialization, Parallel::Phase::Register,
+  static constexpr std::array<Parallel::Phase, 6> default_phase_order{
+      {Parallel::Phase::Initialization,
+       Parallel::Phase::RegisterWithElementDataReader,
+       Parallel::Phase::ImportInitialData, Parallel::Phase::Register,
        Parallel::Phase::Solve, Parallel::Phase::Exit}};
 
   // NOLINTNEXTLINE(google-runtime-references)
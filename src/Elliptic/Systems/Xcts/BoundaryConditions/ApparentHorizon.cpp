@@ -5,7 +5,10 @@
 
 #include <array>
 #include <cstddef>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/LeviCivitaIterator.hpp"
@@ -188,6 +191,50 @@ void negative_expansion_quantities(
   get(*beta_orthogonal_correction) -= get(lapse);
 }
 
+// Evaluate the analytic solutions on the face, at coordinates centered at the
+// apparent horizon. We collect all calls into the analytic solutions in one
+// place so they don't have to compute intermediate quantities multiple times.
+detail::ApparentHorizonAnalyticValues compute_analytic_values(
+    const std::array<double, 3>& center,
+    const std::optional<
+        std::unique_ptr<elliptic::analytic_data::AnalyticSolution>>&
+        solution_for_lapse,
+    const std::optional<
+        std::unique_ptr<elliptic::analytic_data::AnalyticSolution>>&
+        solution_for_negative_expansion,
+    const tnsr::i<DataVector, 3>& face_normal,
+    const tnsr::ij<DataVector, 3>& deriv_unnormalized_face_normal,
+    const Scalar<DataVector>& face_normal_magnitude,
+    const tnsr::I<DataVector, 3>& x_offcenter) {
+  const size_t num_points = x_offcenter.begin()->size();
+  detail::ApparentHorizonAnalyticValues result{
+      x_offcenter, face_normal, Scalar<DataVector>{num_points},
+      Scalar<DataVector>{num_points}, Scalar<DataVector>{}};
+  auto x = x_offcenter;
+  for (size_t d = 0; d < 3; ++d) {
+    x.get(d) -= gsl::at(center, d);
+  }
+  if (solution_for_negative_expansion.has_value()) {
+    negative_expansion_quantities(
+        make_not_null(&result.expansion),
+        make_not_null(&result.beta_orthogonal_correction),
+        *solution_for_negative_expansion, x, face_normal, face_normal_magnitude,
+        deriv_unnormalized_face_normal);
+  }
+  if (solution_for_lapse.has_value()) {
+    result.lapse_times_conformal_factor = call_with_dynamic_type<
+        Scalar<DataVector>, Xcts::Solutions::all_analytic_solutions>(
+        solution_for_lapse.value().get(),
+        [&x](const auto* const local_solution) {
+          return get<Xcts::Tags::LapseTimesConformalFactor<DataVector>>(
+              local_solution->variables(
+                  x, tmpl::list<
+                         Xcts::Tags::LapseTimesConformalFactor<DataVector>>{}));
+        });
+  }
+  return result;
+}
+
 template <Xcts::Geometry ConformalGeometry>
 void apparent_horizon_impl(
     const gsl::not_null<Scalar<DataVector>*> conformal_factor,
@@ -205,6 +252,7 @@ void apparent_horizon_impl(
     const std::optional<
         std::unique_ptr<elliptic::analytic_data::AnalyticSolution>>&
         solution_for_negative_expansion,
+    const detail::ApparentHorizonAnalyticValues* const analytic_values,
     const tnsr::i<DataVector, 3>& face_normal,
     const tnsr::ij<DataVector, 3>& deriv_unnormalized_face_normal,
     const Scalar<DataVector>& face_normal_magnitude,
@@ -220,7 +268,7 @@ void apparent_horizon_impl(
         conformal_christoffel_second_kind) {
   // Allocate some temporary memory
   TempBuffer<tmpl::list<::Tags::TempI<0, 3>, ::Tags::TempScalar<1>,
-                        ::Tags::TempI<2, 3>, ::Tags::TempScalar<3>>>
+                        ::Tags::TempI<2, 3>>>
       buffer{face_normal.begin()->size()};
   // Center the coordinates
   tnsr::I<DataVector, 3>& x = get<::Tags::TempI<2, 3>>(buffer);
@@ -241,25 +289,12 @@ void apparent_horizon_impl(
                          inv_conformal_metric->get());
   }
 
-  // Compute quantities for negative-expansion boundary conditions. We collect
-  // all calls into the analytic solution in one place so it doesn't have to
-  // compute intermediate quantities multiple times. Possible optimization:
-  // Store the result in the DataBox and use it in repeated applications of the
-  // boundary conditions.
-  Scalar<DataVector>& expansion_of_solution =
-      get<::Tags::TempScalar<3>>(buffer);
-  Scalar<DataVector>& beta_orthogonal = get<::Tags::TempScalar<1>>(buffer);
-  if (solution_for_negative_expansion.has_value()) {
-    negative_expansion_quantities(
-        make_not_null(&expansion_of_solution), make_not_null(&beta_orthogonal),
-        *solution_for_negative_expansion, x, face_normal, face_normal_magnitude,
-        deriv_unnormalized_face_normal);
-  }
-
   // Shift
+  Scalar<DataVector>& beta_orthogonal = get<::Tags::TempScalar<1>>(buffer);
   {
     if (solution_for_negative_expansion.has_value()) {
-      get(beta_orthogonal) /= square(get(*conformal_factor));
+      get(beta_orthogonal) = get(analytic_values->beta_orthogonal_correction) /
+                             square(get(*conformal_factor));
     } else {
       get(beta_orthogonal) = 0.;
     }
@@ -295,7 +330,7 @@ void apparent_horizon_impl(
   get(*n_dot_conformal_factor_gradient) *= -0.25 * get(*conformal_factor);
   if (solution_for_negative_expansion.has_value()) {
     get(*n_dot_conformal_factor_gradient) -=
-        0.25 * cube(get(*conformal_factor)) * get(expansion_of_solution);
+        0.25 * cube(get(*conformal_factor)) * get(analytic_values->expansion);
   }
   {
     tnsr::I<DataVector, 3>& n_dot_longitudinal_shift =
@@ -318,15 +353,8 @@ void apparent_horizon_impl(
 
   // Lapse
   if (solution_for_lapse.has_value()) {
-    *lapse_times_conformal_factor = call_with_dynamic_type<
-        Scalar<DataVector>, Xcts::Solutions::all_analytic_solutions>(
-        solution_for_lapse.value().get(),
-        [&x](const auto* const local_solution) {
-          return get<Xcts::Tags::LapseTimesConformalFactor<DataVector>>(
-              local_solution->variables(
-                  x, tmpl::list<
-                         Xcts::Tags::LapseTimesConformalFactor<DataVector>>{}));
-        });
+    *lapse_times_conformal_factor =
+        analytic_values->lapse_times_conformal_factor;
   } else {
     get(*n_dot_lapse_times_conformal_factor_gradient) = 0.;
   }
@@ -344,17 +372,16 @@ void linearized_apparent_horizon_impl(
         n_dot_lapse_times_conformal_factor_gradient_correction,
     const gsl::not_null<tnsr::I<DataVector, 3>*>
         n_dot_longitudinal_shift_correction,
-    const std::array<double, 3>& center,
     const std::optional<
         std::unique_ptr<elliptic::analytic_data::AnalyticSolution>>&
         solution_for_lapse,
     const std::optional<
         std::unique_ptr<elliptic::analytic_data::AnalyticSolution>>&
         solution_for_negative_expansion,
+    const detail::ApparentHorizonAnalyticValues* const analytic_values,
     const tnsr::i<DataVector, 3>& face_normal,
     const tnsr::ij<DataVector, 3>& deriv_unnormalized_face_normal,
     const Scalar<DataVector>& face_normal_magnitude,
-    const tnsr::I<DataVector, 3>& x_offcenter,
     const Scalar<DataVector>& extrinsic_curvature_trace,
     const tnsr::II<DataVector, 3>& longitudinal_shift_background,
     const Scalar<DataVector>& conformal_factor,
@@ -367,27 +394,15 @@ void linearized_apparent_horizon_impl(
         std::reference_wrapper<const tnsr::Ijj<DataVector, 3>>>
         conformal_christoffel_second_kind) {
   // Allocate some temporary memory
-  TempBuffer<tmpl::list<::Tags::TempI<0, 3>, ::Tags::TempScalar<1>,
-                        ::Tags::TempScalar<2>>>
-      buffer{face_normal.begin()->size()};
+  TempBuffer<tmpl::list<::Tags::TempI<0, 3>, ::Tags::TempScalar<1>>> buffer{
+      face_normal.begin()->size()};
 
   // Negative-expansion quantities
-  Scalar<DataVector>& expansion_of_solution =
-      get<::Tags::TempScalar<2>>(buffer);
   Scalar<DataVector>& beta_orthogonal_correction =
       get<::Tags::TempScalar<1>>(buffer);
   if (solution_for_negative_expansion.has_value()) {
-    // Center the coordinates
-    tnsr::I<DataVector, 3>& x = get<::Tags::TempI<0, 3>>(buffer);
-    x = x_offcenter;
-    get<0>(x) -= center[0];
-    get<1>(x) -= center[1];
-    get<2>(x) -= center[2];
-    negative_expansion_quantities(make_not_null(&expansion_of_solution),
-                                  make_not_null(&beta_orthogonal_correction),
-                                  *solution_for_negative_expansion, x,
-                                  face_normal, face_normal_magnitude,
-                                  deriv_unnormalized_face_normal);
+    get(beta_orthogonal_correction) =
+        get(analytic_values->beta_orthogonal_correction);
   }
 
   tnsr::I<DataVector, 3>& face_normal_raised = get<::Tags::TempI<0, 3>>(buffer);
@@ -440,7 +455,8 @@ void linearized_apparent_horizon_impl(
       -0.25 * get(*conformal_factor_correction);
   if (solution_for_negative_expansion.has_value()) {
     get(*n_dot_conformal_factor_gradient_correction) -=
-        0.75 * square(get(conformal_factor)) * get(expansion_of_solution) *
+        0.75 * square(get(conformal_factor)) *
+            get(analytic_values->expansion) *
         get(*conformal_factor_correction);
   }
   {
@@ -484,8 +500,51 @@ void linearized_apparent_horizon_impl(
     get(*n_dot_lapse_times_conformal_factor_gradient_correction) = 0.;
   }
 }
+
+// Faces that are no longer used, e.g. because the domain was refined, are only
+// dropped from the cache when it is full
+constexpr size_t max_cached_faces = 512;
 }  // namespace
 
+template <Xcts::Geometry ConformalGeometry>
+std::shared_ptr<const detail::ApparentHorizonAnalyticValues>
+ApparentHorizon<ConformalGeometry>::analytic_values(
+    const tnsr::i<DataVector, 3>& face_normal,
+    const tnsr::ij<DataVector, 3>& deriv_unnormalized_face_normal,
+    const Scalar<DataVector>& face_normal_magnitude,
+    const tnsr::I<DataVector, 3>& x) const {
+  if (not(solution_for_lapse_.has_value() or
+          solution_for_negative_expansion_.has_value())) {
+    return nullptr;
+  }
+  ASSERT(analytic_values_cache_ != nullptr,
+         "The boundary conditions were used after they were moved from.");
+  auto& cache = *analytic_values_cache_;
+  const double* const key = get<0>(x).data();
+  {
+    const std::lock_guard lock(cache.mutex);
+    const auto cached = cache.values.find(key);
+    // The data at the address may have changed since it was cached
+    if (cached != cache.values.end() and cached->second->x == x and
+        cached->second->face_normal == face_normal) {
+      return cached->second;
+    }
+  }
+  // Evaluate the analytic solutions outside the lock so faces on other threads
+  // aren't held up
+  auto values = std::make_shared<const detail::ApparentHorizonAnalyticValues>(
+      compute_analytic_values(center_, solution_for_lapse_,
+                              solution_for_negative_expansion_, face_normal,
+                              deriv_unnormalized_face_normal,
+                              face_normal_magnitude, x));
+  const std::lock_guard lock(cache.mutex);
+  if (cache.values.size() >= max_cached_faces) {
+    cache.values.clear();
+  }
+  cache.values.insert_or_assign(key, values);
+  return values;
+}
+
 template <Xcts::Geometry ConformalGeometry>
 void ApparentHorizon<ConformalGeometry>::apply(
     const gsl::not_null<Scalar<DataVector>*> conformal_factor,
@@ -503,12 +562,14 @@ void ApparentHorizon<ConformalGeometry>::apply(
     const Scalar<DataVector>& extrinsic_curvature_trace,
     const tnsr::I<DataVector, 3>& shift_background,
     const tnsr::II<DataVector, 3>& longitudinal_shift_background) const {
+  const auto cached_values = analytic_values(
+      face_normal, deriv_unnormalized_face_normal, face_normal_magnitude, x);
   apparent_horizon_impl<ConformalGeometry>(
       conformal_factor, lapse_times_conformal_factor, shift_excess,
       n_dot_conformal_factor_gradient,
       n_dot_lapse_times_conformal_factor_gradient,
       n_dot_longitudinal_shift_excess, center_, rotation_, solution_for_lapse_,
-      solution_for_negative_expansion_, face_normal,
+      solution_for_negative_expansion_, cached_values.get(), face_normal,
       deriv_unnormalized_face_normal, face_normal_magnitude, x,
       extrinsic_curvature_trace, shift_background,
       longitudinal_shift_background, std::nullopt, std::nullopt);
@@ -533,12 +594,14 @@ void ApparentHorizon<ConformalGeometry>::apply(
     const tnsr::II<DataVector, 3>& longitudinal_shift_background,
     const tnsr::II<DataVector, 3>& inv_conformal_metric,
     const tnsr::Ijj<DataVector, 3>& conformal_christoffel_second_kind) const {
+  const auto cached_values = analytic_values(
+      face_normal, deriv_unnormalized_face_normal, face_normal_magnitude, x);
   apparent_horizon_impl<ConformalGeometry>(
       conformal_factor, lapse_times_conformal_factor, shift_excess,
       n_dot_conformal_factor_gradient,
       n_dot_lapse_times_conformal_factor_gradient,
       n_dot_longitudinal_shift_excess, center_, rotation_, solution_for_lapse_,
-      solution_for_negative_expansion_, face_normal,
+      solution_for_negative_expansion_, cached_values.get(), face_normal,
       deriv_unnormalized_face_normal, face_normal_magnitude, x,
       extrinsic_curvature_trace, shift_background,
       longitudinal_shift_background, inv_conformal_metric,
@@ -566,13 +629,15 @@ void ApparentHorizon<ConformalGeometry>::apply_linearized(
     const Scalar<DataVector>& conformal_factor,
     const Scalar<DataVector>& lapse_times_conformal_factor,
     const tnsr::I<DataVector, 3>& n_dot_longitudinal_shift_excess) const {
+  const auto cached_values = analytic_values(
+      face_normal, deriv_unnormalized_face_normal, face_normal_magnitude, x);
   linearized_apparent_horizon_impl<ConformalGeometry>(
       conformal_factor_correction, lapse_times_conformal_factor_correction,
       shift_excess_correction, n_dot_conformal_factor_gradient_correction,
       n_dot_lapse_times_conformal_factor_gradient_correction,
-      n_dot_longitudinal_shift_excess_correction, center_, solution_for_lapse_,
-      solution_for_negative_expansion_, face_normal,
-      deriv_unnormalized_face_normal, face_normal_magnitude, x,
+      n_dot_longitudinal_shift_excess_correction, solution_for_lapse_,
+      solution_for_negative_expansion_, cached_values.get(), face_normal,
+      deriv_unnormalized_face_normal, face_normal_magnitude,
       extrinsic_curvature_trace, longitudinal_shift_background,
       conformal_factor, lapse_times_conformal_factor,
       n_dot_longitudinal_shift_excess, std::nullopt, std::nullopt);
@@ -601,13 +666,15 @@ void ApparentHorizon<ConformalGeometry>::apply_linearized(
     const tnsr::I<DataVector, 3>& n_dot_longitudinal_shift_excess,
     const tnsr::II<DataVector, 3>& inv_conformal_metric,
     const tnsr::Ijj<DataVector, 3>& conformal_christoffel_second_kind) const {
+  const auto cached_values = analytic_values(
+      face_normal, deriv_unnormalized_face_normal, face_normal_magnitude, x);
   linearized_apparent_horizon_impl<ConformalGeometry>(
       conformal_factor_correction, lapse_times_conformal_factor_correction,
       shift_excess_correction, n_dot_conformal_factor_gradient_correction,
       n_dot_lapse_times_conformal_factor_gradient_correction,
-      n_dot_longitudinal_shift_excess_correction, center_, solution_for_lapse_,
-      solution_for_negative_expansion_, face_normal,
-      deriv_unnormalized_face_normal, face_normal_magnitude, x,
+      n_dot_longitudinal_shift_excess_correction, solution_for_lapse_,
+      solution_for_negative_expansion_, cached_values.get(), face_normal,
+      deriv_unnormalized_face_normal, face_normal_magnitude,
       extrinsic_curvature_trace, longitudinal_shift_background,
       conformal_factor, lapse_times_conformal_factor,
       n_dot_longitudinal_shift_excess, inv_conformal_metric,
@@ -5,13 +5,16 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <pup.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
-#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Tags.hpp"
 #include "Domain/Tags/FaceNormal.hpp"
 #include "Elliptic/BoundaryConditions/BoundaryCondition.hpp"
@@ -28,11 +31,26 @@
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
-/// \cond
-class DataVector;
-/// \endcond
-
 namespace Xcts::BoundaryConditions {
+namespace detail {
+// The values of the analytic solutions of the `ApparentHorizon` boundary
+// conditions on a face. They depend only on the geometry of the face.
+struct ApparentHorizonAnalyticValues {
+  tnsr::I<DataVector, 3> x{};
+  tnsr::i<DataVector, 3> face_normal{};
+  Scalar<DataVector> expansion{};
+  Scalar<DataVector> beta_orthogonal_correction{};
+  Scalar<DataVector> lapse_times_conformal_factor{};
+};
+
+struct ApparentHorizonAnalyticValuesCache {
+  std::mutex mutex{};
+  // Keyed by the address of the face coordinates, which live in the DataBox
+  std::unordered_map<const double*,
+                     std::shared_ptr<const ApparentHorizonAnalyticValues>>
+      values{};
+};
+}  // namespace detail
 
 /*!
  * \brief Impose the surface is a quasi-equilibrium apparent horizon.
@@ -91,11 +109,13 @@ namespace Xcts::BoundaryConditions {
  * \beta_\mathrm{Kerr}^i - \alpha_\mathrm{Kerr}\f$ to the orthogonal part
  * \f$s_i\beta_\mathrm{excess}^i\f$ of (\f$\ref{eq:ah_beta}\f$).
  *
- * \note When negative-expansion boundary conditions are selected, the Kerr
- * solution gets evaluated at every boundary-condition application. This may
- * turn out to incur a significant computational cost, in which case a future
- * optimization might be to pre-compute the negative-expansion quantities at
- * initialization time and store them in the DataBox.
+ * \note The analytic solutions for the lapse and the negative expansion depend
+ * only on the geometry of the face, so they are evaluated only the first time
+ * the boundary conditions are applied on a face and cached in this object.
+ * Repeated applications, e.g. in every nonlinear and linear solver iteration
+ * and on every multigrid level, reuse the cached values. The cache is keyed by
+ * the face coordinates, so it is correct for any face the boundary conditions
+ * are applied to, and it is not serialized.
  */
 template <Xcts::Geometry ConformalGeometry>
 class ApparentHorizon
@@ -334,6 +354,13 @@ class ApparentHorizon
   void pup(PUP::er& p) override;
 
  private:
+  // Returns `nullptr` if there are no analytic solutions to evaluate
+  std::shared_ptr<const detail::ApparentHorizonAnalyticValues> analytic_values(
+      const tnsr::i<DataVector, 3>& face_normal,
+      const tnsr::ij<DataVector, 3>& deriv_unnormalized_face_normal,
+      const Scalar<DataVector>& face_normal_magnitude,
+      const tnsr::I<DataVector, 3>& x) const;
+
   std::array<double, 3> center_ =
       make_array<3>(std::numeric_limits<double>::signaling_NaN());
   std::array<double, 3> rotation_ =
@@ -342,6 +369,9 @@ class ApparentHorizon
       solution_for_lapse_{};
   std::optional<std::unique_ptr<elliptic::analytic_data::AnalyticSolution>>
       solution_for_negative_expansion_{};
+  std::unique_ptr<detail::ApparentHorizonAnalyticValuesCache>
+      analytic_values_cache_ =
+          std::make_unique<detail::ApparentHorizonAnalyticValuesCache>();
 };
 
 }  // namespace Xcts::BoundaryConditions
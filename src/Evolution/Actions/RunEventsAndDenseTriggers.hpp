@@ -60,6 +60,11 @@ namespace evolution::Actions {
 /// provided for convenience to provide an `is_ready` function when a
 /// pure mutate-apply is desired.
 ///
+/// All triggers scheduled for the same time are processed together,
+/// so dense output and the postprocessors are evaluated at most once
+/// per time, and the result is shared by all the events run at that
+/// time, regardless of how many of them require the evolved variables.
+///
 /// At the end of the action, the values of the time, evolved
 /// variables, and anything appearing in the `return_tags` of the \p
 /// Postprocessors will be restored to their initial values.
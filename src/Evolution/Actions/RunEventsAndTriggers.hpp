@@ -3,16 +3,24 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Trigger.hpp"
 #include "Time/SelfStart.hpp"
 #include "Time/Tags/Time.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Time/Triggers/OnSubsteps.hpp"
+#include "Time/Utilities.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -22,6 +30,18 @@ struct TimeStepId;
 }  // namespace Tags
 /// \endcond
 
+namespace evolution::Tags {
+/// \ingroup EventsAndTriggersGroup
+/// \brief For each trigger in `::Tags::EventsAndTriggers`, the bound before
+/// which it can't fire, as returned by `Trigger::next_firing_bound` when it
+/// was last checked.
+///
+/// \details `std::nullopt` means the trigger must be checked.
+struct NextTriggerChecks : db::SimpleTag {
+  using type = std::vector<std::optional<::Trigger::FiringBound>>;
+};
+}  // namespace evolution::Tags
+
 namespace evolution::Actions {
 /// \ingroup ActionsGroup
 /// \ingroup EventsAndTriggersGroup
@@ -30,17 +50,27 @@ namespace evolution::Actions {
 /// Triggers will only be checked on the first step of each slab to
 /// ensure that a consistent set of events is run across all elements.
 ///
+/// Triggers that depend only on the slab and the time, such as
+/// `Triggers::Slabs` and `Triggers::Times`, report when they can fire
+/// next (see `Trigger::next_firing_bound`). They are not checked again
+/// until that slab or time is reached, so on most steps the cost of
+/// such a trigger is a single comparison. This is only done when time
+/// runs forward.
+///
 /// Uses:
 /// - GlobalCache: the EventsAndTriggers tag, as required by
 ///   events and triggers
 /// - DataBox: as required by events and triggers
 ///
 /// DataBox changes:
-/// - Adds: nothing
+/// - Adds:
+///   - evolution::Tags::NextTriggerChecks
 /// - Removes: nothing
-/// - Modifies: nothing
+/// - Modifies:
+///   - evolution::Tags::NextTriggerChecks
 struct RunEventsAndTriggers {
   using const_global_cache_tags = tmpl::list<::Tags::EventsAndTriggers>;
+  using simple_tags = tmpl::list<evolution::Tags::NextTriggerChecks>;
 
   template <typename DbTags, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -57,9 +87,55 @@ struct RunEventsAndTriggers {
     }
 
     if (time_step_id.substep() == 0) {
-      Parallel::get<::Tags::EventsAndTriggers>(cache).run_events(
+      const auto& events_and_triggers =
+          Parallel::get<::Tags::EventsAndTriggers>(cache);
+      const double time = db::get<::Tags::Time>(box);
+      const auto slab_number = time_step_id.slab_number();
+      const double sloppiness = slab_rounding_error(time_step_id.step_time());
+      const bool time_runs_forward = time_step_id.time_runs_forward();
+
+      // Moved out of the box so that the triggers can be checked on the box
+      // while the bounds are updated.
+      std::vector<std::optional<::Trigger::FiringBound>> next_checks{};
+      db::mutate<evolution::Tags::NextTriggerChecks>(
+          [&next_checks](const gsl::not_null<
+                         std::vector<std::optional<::Trigger::FiringBound>>*>
+                             stored_checks) {
+            next_checks = std::move(*stored_checks);
+          },
+          make_not_null(&box));
+      if (next_checks.size() != events_and_triggers.number_of_triggers()) {
+        next_checks.clear();
+        next_checks.resize(events_and_triggers.number_of_triggers());
+      }
+
+      size_t trigger_index = 0;
+      events_and_triggers.run_events(
           box, cache, array_index, component,
-          {db::tag_name<::Tags::Time>(), db::get<::Tags::Time>(box)});
+          {db::tag_name<::Tags::Time>(), time},
+          [&](const Trigger& trigger) {
+            auto& next_check = next_checks[trigger_index];
+            ++trigger_index;
+            if (next_check.has_value() and
+                (slab_number < next_check->slab_number or
+                 time < next_check->time - sloppiness)) {
+              return false;
+            }
+            const bool is_triggered = trigger.is_triggered(box);
+            next_check =
+                time_runs_forward
+                    ? trigger.next_firing_bound(slab_number, time)
+                    : std::nullopt;
+            return is_triggered;
+          });
+
+      db::mutate<evolution::Tags::NextTriggerChecks>(
+          [&next_checks](const gsl::not_null<
+                         std::vector<std::optional<::Trigger::FiringBound>>*>
+                             stored_checks) {
+            *stored_checks = std::move(next_checks);
+          },
+          make_not_null(&box));
     } else {
       const double substep_offset = 1.0e6;
       const double observation_value = time_step_id.step_time().value() +
@@ -0,0 +1,154 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Deadlock/ElementProgress.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace deadlock {
+namespace {
+std::optional<double> report_interval_from_environment() {
+  const char* const env = std::getenv("SPECTRE_PROGRESS_REPORT_INTERVAL");
+  if (env == nullptr or std::string{env}.empty()) {
+    return std::nullopt;
+  }
+  const double interval = std::strtod(env, nullptr);
+  return interval > 0.0 ? std::optional{interval} : std::nullopt;
+}
+
+// Maximum number of neighbors listed in a chain of elements waiting on each
+// other
+constexpr size_t maximum_chain_length = 16;
+}  // namespace
+
+template <size_t Dim>
+ProgressRegistry<Dim>::ProgressRegistry()
+    : report_interval_(report_interval_from_environment()) {}
+
+template <size_t Dim>
+void ProgressRegistry<Dim>::record(const ElementProgress<Dim>& progress) {
+  const std::lock_guard lock(mutex_);
+  progress_.insert_or_assign(progress.element_id, progress);
+}
+
+template <size_t Dim>
+std::vector<ElementProgress<Dim>> ProgressRegistry<Dim>::slowest(
+    const size_t number_of_elements) const {
+  std::vector<ElementProgress<Dim>> result{};
+  {
+    const std::lock_guard lock(mutex_);
+    result.reserve(progress_.size());
+    for (const auto& [id, progress] : progress_) {
+      result.push_back(progress);
+    }
+  }
+  const auto is_behind = [](const ElementProgress<Dim>& a,
+                            const ElementProgress<Dim>& b) {
+    if (a.time_step_id != b.time_step_id) {
+      return a.time_step_id < b.time_step_id;
+    }
+    return a.wall_time < b.wall_time;
+  };
+  const size_t size = std::min(number_of_elements, result.size());
+  std::partial_sort(result.begin(),
+                    result.begin() + static_cast<std::ptrdiff_t>(size),
+                    result.end(), is_behind);
+  result.resize(size);
+  return result;
+}
+
+template <size_t Dim>
+std::string ProgressRegistry<Dim>::report(const size_t number_of_elements,
+                                          const double now) const {
+  const auto slowest_elements = slowest(number_of_elements);
+  std::stringstream ss{};
+  const std::lock_guard lock(mutex_);
+  ss << "Progress of the " << slowest_elements.size() << " slowest of "
+     << progress_.size() << " elements on this node:\n";
+  for (const auto& progress : slowest_elements) {
+    ss << " " << progress.element_id << " at " << progress.time_step_id
+       << ", last heartbeat " << now - progress.wall_time << "s ago, "
+       << progress.pending_boundary_messages << " pending boundary messages";
+    std::unordered_set<ElementId<Dim>> visited{progress.element_id};
+    std::optional<ElementId<Dim>> waiting_on = progress.waiting_on;
+    if (waiting_on.has_value()) {
+      ss << ", waiting on";
+    }
+    while (waiting_on.has_value() and visited.size() <= maximum_chain_length) {
+      ss << " " << *waiting_on;
+      if (not visited.insert(*waiting_on).second) {
+        ss << " (cycle)";
+        break;
+      }
+      const auto neighbor = progress_.find(*waiting_on);
+      if (neighbor == progress_.end()) {
+        ss << " (not on this node)";
+        break;
+      }
+      ss << " at " << neighbor->second.time_step_id;
+      waiting_on = neighbor->second.waiting_on;
+      if (waiting_on.has_value()) {
+        ss << " ->";
+      }
+    }
+    ss << "\n";
+  }
+  return ss.str();
+}
+
+template <size_t Dim>
+bool ProgressRegistry<Dim>::claim_report(const double now) {
+  const std::lock_guard lock(mutex_);
+  if (not report_interval_.has_value()) {
+    return false;
+  }
+  if (not last_report_.has_value()) {
+    // Wait a full interval after the first heartbeat
+    last_report_ = now;
+    return false;
+  }
+  if (now - *last_report_ < *report_interval_) {
+    return false;
+  }
+  last_report_ = now;
+  return true;
+}
+
+template <size_t Dim>
+void ProgressRegistry<Dim>::set_report_interval(
+    std::optional<double> report_interval) {
+  const std::lock_guard lock(mutex_);
+  report_interval_ = report_interval;
+  last_report_.reset();
+}
+
+template <size_t Dim>
+ProgressRegistry<Dim>& progress_registry() {
+  static ProgressRegistry<Dim> registry{};
+  return registry;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                  \
+  template class ProgressRegistry<DIM(data)>; \
+  template ProgressRegistry<DIM(data)>&       \
+  progress_registry<DIM(data)>();
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
+}  // namespace deadlock
@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Time/TimeStepId.hpp"
+
+namespace deadlock {
+/*!
+ * \brief Compact record of the progress of an element, updated at the start of
+ * every step by `deadlock::Actions::RecordProgress`.
+ */
+template <size_t Dim>
+struct ElementProgress {
+  ElementId<Dim> element_id{};
+  /// The step the element was about to take
+  TimeStepId time_step_id{};
+  /// Wall time (`sys::wall_time()`) when the record was made
+  double wall_time{0.0};
+  /// Number of time step ids with boundary data waiting in the inbox
+  size_t pending_boundary_messages{0};
+  /// The neighbor with the earliest next temporal id whose boundary data for
+  /// that time had not arrived, if any
+  std::optional<ElementId<Dim>> waiting_on{};
+};
+
+/*!
+ * \brief The latest `deadlock::ElementProgress` of every element on this
+ * process.
+ *
+ * \details The records live in process memory that is shared by all PEs of
+ * the node (in SMP builds), so the progress of all elements of the node can be
+ * inspected from any of them while the simulation is running. `report` lists
+ * the elements that are furthest behind together with the chains of neighbors
+ * they were waiting on, which points to the stragglers that hold up the
+ * simulation. This complements `deadlock::PrintElementInfo`, which only runs
+ * once a deadlock was detected.
+ *
+ * Reports are printed periodically by `deadlock::Actions::RecordProgress` if
+ * the environment variable `SPECTRE_PROGRESS_REPORT_INTERVAL` is set to a
+ * positive number of seconds.
+ */
+template <size_t Dim>
+class ProgressRegistry {
+ public:
+  ProgressRegistry();
+
+  void record(const ElementProgress<Dim>& progress);
+
+  /// The `number_of_elements` records with the earliest time step ids, ordered
+  /// from the earliest. Records of elements at the same step are ordered by
+  /// the time of the record.
+  std::vector<ElementProgress<Dim>> slowest(size_t number_of_elements) const;
+
+  /// Human-readable summary of the `number_of_elements` slowest elements and
+  /// the chains of neighbors they are waiting on, relative to the wall time
+  /// `now`
+  std::string report(size_t number_of_elements, double now) const;
+
+  /// Returns `true` at most once per report interval, so only one element
+  /// prints each periodic report. Always `false` if reports are disabled.
+  bool claim_report(double now);
+
+  /// Set the interval between periodic reports in seconds, or disable them
+  /// with `std::nullopt`. Defaults to `SPECTRE_PROGRESS_REPORT_INTERVAL`.
+  void set_report_interval(std::optional<double> report_interval);
+
+ private:
+  mutable std::mutex mutex_{};
+  std::unordered_map<ElementId<Dim>, ElementProgress<Dim>> progress_{};
+  std::optional<double> report_interval_{};
+  std::optional<double> last_report_{};
+};
+
+/// The `deadlock::ProgressRegistry` shared by all PEs of this process
+template <size_t Dim>
+ProgressRegistry<Dim>& progress_registry();
+}  // namespace deadlock
@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/Deadlock/ElementProgress.hpp"
+#include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Printf.hpp"
+#include "Time/Tags/TimeStepId.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace deadlock::Actions {
+/*!
+ * \brief Record the progress of a DG element in the
+ * `deadlock::progress_registry`.
+ *
+ * \details Place this action at the start of the step actions. It records the
+ * step the element is about to take, the number of steps with boundary data
+ * already in the inbox, and the neighbor with the earliest next temporal id
+ * whose boundary data hasn't arrived yet. This is cheap enough to do on every
+ * step.
+ *
+ * If periodic reports are enabled (see `deadlock::ProgressRegistry`), the
+ * first element to record its progress after the report interval has passed
+ * prints the report of the slowest elements on its node.
+ */
+struct RecordProgress {
+  /// The number of elements listed in the periodic reports
+  static constexpr size_t number_of_reported_elements = 5;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto& inbox = tuples::get<
+        evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>>(
+        inboxes);
+    const double now = sys::wall_time();
+
+    ElementProgress<Dim> progress{};
+    progress.element_id = element_id;
+    progress.time_step_id = db::get<::Tags::TimeStepId>(box);
+    progress.wall_time = now;
+    progress.pending_boundary_messages = inbox.size();
+    std::optional<TimeStepId> earliest_missing{};
+    for (const auto& [mortar_id, next_id] :
+         db::get<evolution::dg::Tags::MortarNextTemporalId<Dim>>(box)) {
+      if (earliest_missing.has_value() and not(next_id < *earliest_missing)) {
+        continue;
+      }
+      const auto received = inbox.find(next_id);
+      if (received == inbox.end() or
+          received->second.find(mortar_id) == received->second.end()) {
+        earliest_missing = next_id;
+        progress.waiting_on = mortar_id.second;
+      }
+    }
+
+    auto& registry = progress_registry<Dim>();
+    registry.record(progress);
+    if (registry.claim_report(now)) {
+      Parallel::printf("%s", registry.report(number_of_reported_elements, now));
+    }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace deadlock::Actions
@@ -32,6 +32,7 @@
 #include "Domain/Tags.hpp"
 #include "Evolution/DgSubcell/ActiveGrid.hpp"
 #include "Evolution/DgSubcell/GhostData.hpp"
+#include "Evolution/DgSubcell/GhostDataPrecision.hpp"
 #include "Evolution/DgSubcell/NeighborRdmpAndVolumeData.hpp"
 #include "Evolution/DgSubcell/Projection.hpp"
 #include "Evolution/DgSubcell/RdmpTci.hpp"
@@ -231,6 +232,10 @@ struct SendDataForReconstruction {
                   std::prev(subcell_data_to_send.end(),
                             static_cast<int>(
                                 rdmp_tci_data.min_variables_values.size())));
+        if constexpr (send_ghost_data_as_float_v<Metavariables>) {
+          subcell_data_to_send =
+              pack_ghost_data_as_float(subcell_data_to_send, rdmp_size);
+        }
 
         std::tuple<Mesh<Dim>, Mesh<Dim - 1>, std::optional<DataVector>,
                    std::optional<DataVector>, ::TimeStepId, int>
@@ -413,6 +418,11 @@ struct ReceiveDataForReconstruction {
                          .has_value(),
                      "Received subcell data message that does not contain any "
                      "actual subcell data for reconstruction.");
+              if constexpr (send_ghost_data_as_float_v<Metavariables>) {
+                std::get<2>(received_data[directional_element_id]) =
+                    unpack_ghost_data_from_float(
+                        *std::get<2>(received_data[directional_element_id]));
+              }
               // Collect the max/min of u(t^n) for the RDMP as we receive data.
               // This reduces the memory footprint.
 
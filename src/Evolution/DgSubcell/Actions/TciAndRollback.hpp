@@ -26,6 +26,7 @@
 #include "Evolution/DgSubcell/RdmpTci.hpp"
 #include "Evolution/DgSubcell/RdmpTciData.hpp"
 #include "Evolution/DgSubcell/SubcellOptions.hpp"
+#include "Evolution/DgSubcell/TciCadence.hpp"
 #include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
 #include "Evolution/DgSubcell/Tags/Coordinates.hpp"
 #include "Evolution/DgSubcell/Tags/DataForRdmpTci.hpp"
@@ -34,6 +35,7 @@
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
+#include "Evolution/DgSubcell/Tags/TciCadence.hpp"
 #include "Evolution/DgSubcell/Tags/TciGridHistory.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
@@ -80,8 +82,20 @@ namespace evolution::dg::subcell::Actions {
  * \f$G\f$ to the subcells for the scheme to be conservative. The subcell
  * actions know if a rollback was done because the local mortar data would
  * already be computed.
+ *
+ * If `Metavariables::SubcellOptions::maximum_tci_interval` (see
+ * `maximum_tci_interval_v`) is larger than one, elements that have passed the
+ * TCI for many consecutive checks only evaluate the TCI every few time steps,
+ * as decided by `Tags::TciCadence`. A check is forced on elements that are
+ * already marked as troubled, that have a troubled neighbor, or that are
+ * self-starting. On the other steps `SkippedTciMutator` is applied instead of
+ * `TciMutator`. It must set `subcell::Tags::DataForRdmpTci` to the RDMP data of
+ * the candidate solution and do anything else the rest of the step relies on
+ * the `TciMutator` for, e.g. recovering the primitive variables. For systems
+ * whose `TciMutator` does not mutate the DataBox the system's
+ * `SetInitialRdmpData` mutator can be used.
  */
-template <typename TciMutator>
+template <typename TciMutator, typename SkippedTciMutator = void>
 struct TciAndRollback {
   template <typename DbTags, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -108,6 +122,15 @@ struct TciAndRollback {
         "Must have the BeginSubcellAfterDgRollback label exactly once in the "
         "action list of a phase.");
 
+    constexpr size_t maximum_tci_interval =
+        maximum_tci_interval_v<Metavariables>;
+    static_assert(maximum_tci_interval > 0,
+                  "The maximum TCI interval must be at least one.");
+    static_assert(maximum_tci_interval == 1 or
+                      not std::is_same_v<SkippedTciMutator, void>,
+                  "A SkippedTciMutator must be given to TciAndRollback to "
+                  "skip the TCI on some time steps.");
+
     using variables_tag = typename Metavariables::system::variables_tag;
 
     const ActiveGrid active_grid = db::get<Tags::ActiveGrid>(box);
@@ -159,6 +182,41 @@ struct TciAndRollback {
                                element.id().block_id()) and
         not bordering_dg_block;
 
+    if constexpr (maximum_tci_interval > 1) {
+      const bool force_check =
+          cell_is_troubled or
+          db::get<::Tags::TimeStepId>(box).slab_number() < 0 or
+          alg::any_of(
+              db::get<evolution::dg::subcell::Tags::NeighborTciDecisions<Dim>>(
+                  box),
+              [](const auto& neighbor_and_decision) {
+                return neighbor_and_decision.second != 0;
+              });
+      bool skip_tci = false;
+      db::mutate<Tags::TciCadence>(
+          [&force_check, &skip_tci](const gsl::not_null<TciCadence*> cadence) {
+            if (force_check) {
+              cadence->reset();
+            } else if (not cadence->check_this_step()) {
+              cadence->skip();
+              skip_tci = true;
+            }
+          },
+          make_not_null(&box));
+      if (skip_tci) {
+        db::mutate_apply<SkippedTciMutator>(make_not_null(&box));
+        db::mutate<Tags::TciDecision,
+                   subcell::Tags::GhostDataForReconstruction<Dim>>(
+            [](const gsl::not_null<int*> tci_decision_ptr,
+               const auto neighbor_data_ptr) {
+              *tci_decision_ptr = 0;
+              neighbor_data_ptr->clear();
+            },
+            make_not_null(&box));
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
+    }
+
     // The reason we pass in the persson_exponent explicitly instead of
     // leaving it to the user is because the value of the exponent that
     // should be used to decide if it is safe to switch back to DG should be
@@ -180,6 +238,22 @@ struct TciAndRollback {
 
     cell_is_troubled |= (tci_decision != 0);
 
+    if constexpr (maximum_tci_interval > 1) {
+      const bool rdmp_near =
+          not cell_is_troubled and
+          rdmp_bound_is_near(std::get<1>(tci_result),
+                             db::get<Tags::DataForRdmpTci>(box),
+                             subcell_options.rdmp_delta0(),
+                             subcell_options.rdmp_epsilon());
+      db::mutate<Tags::TciCadence>(
+          [&cell_is_troubled,
+           &rdmp_near](const gsl::not_null<TciCadence*> cadence) {
+            cadence->record_check(not cell_is_troubled, rdmp_near,
+                                  maximum_tci_interval);
+          },
+          make_not_null(&box));
+    }
+
     // If either:
     //
     // 1. we are not allowed to do subcell in this block
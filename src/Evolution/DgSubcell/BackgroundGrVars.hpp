@@ -50,12 +50,15 @@ namespace evolution::dg::subcell {
  * a curved spacetime without solving Einstein equations (e.g. ValenciaDivclean,
  * ForceFree),
  *
- * \warning This mutator assumes that the GR analytic data or solution
- * specifying background spacetime metric is time-independent.
+ * \details As for `evolution::dg::BackgroundGrVars`, the quantities are only
+ * recomputed after initialization if the block coordinate map is
+ * time-dependent or if `TimeDependentBackground` is `true`.
  *
+ * \warning Set `TimeDependentBackground` if the GR analytic data or solution
+ * specifying the background spacetime metric is time-dependent.
  */
 template <typename System, typename Metavariables, bool UsingRuntimeId,
-          bool ComputeOnlyOnRollback>
+          bool ComputeOnlyOnRollback, bool TimeDependentBackground = false>
 struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
   static constexpr size_t volume_dim = System::volume_dim;
 
@@ -109,14 +112,14 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
       // Evolution phase
 
       // Check if the mesh is actually moving i.e. block coordinate map is
-      // time-dependent. If not, we can skip the evaluation of GR variables
-      // since they may stay with their values assigned at the initialization
-      // phase.
+      // time-dependent. If not, and the background is stationary, we can skip
+      // the evaluation of GR variables since they stay with their values
+      // assigned at the initialization phase.
       const auto& element_id = element.id();
       const size_t block_id = element_id.block_id();
       const Block<volume_dim>& block = domain.blocks()[block_id];
 
-      if (block.is_time_dependent()) {
+      if (TimeDependentBackground or block.is_time_dependent()) {
         if (did_rollback or not ComputeOnlyOnRollback) {
           if (did_rollback) {
             // Right after rollback, subcell GR vars are stored in the
@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/GhostDataPrecision.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace evolution::dg::subcell {
+DataVector pack_ghost_data_as_float(const DataVector& ghost_data,
+                                    const size_t number_of_trailing_doubles) {
+  ASSERT(number_of_trailing_doubles <= ghost_data.size(),
+         "Cannot keep " << number_of_trailing_doubles
+                        << " trailing doubles of a buffer of size "
+                        << ghost_data.size());
+  const size_t number_of_floats =
+      ghost_data.size() - number_of_trailing_doubles;
+  const size_t number_of_packed_doubles =
+      (number_of_floats * sizeof(float) + sizeof(double) - 1) / sizeof(double);
+  DataVector packed_data{1 + number_of_packed_doubles +
+                         number_of_trailing_doubles};
+  packed_data[0] = static_cast<double>(number_of_floats);
+  if (number_of_packed_doubles > 0) {
+    // Zero the last packed double so any padding float is well defined.
+    packed_data[number_of_packed_doubles] = 0.0;
+  }
+  // NOLINTNEXTLINE
+  auto* const float_bytes = reinterpret_cast<char*>(packed_data.data() + 1);
+  for (size_t i = 0; i < number_of_floats; ++i) {
+    const auto value = static_cast<float>(ghost_data[i]);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(float_bytes + i * sizeof(float), &value, sizeof(float));
+  }
+  std::copy(std::next(ghost_data.begin(),
+                      static_cast<std::ptrdiff_t>(number_of_floats)),
+            ghost_data.end(),
+            std::next(packed_data.begin(), static_cast<std::ptrdiff_t>(
+                                               1 + number_of_packed_doubles)));
+  return packed_data;
+}
+
+DataVector unpack_ghost_data_from_float(const DataVector& packed_data) {
+  ASSERT(not packed_data.empty(),
+         "The packed ghost data must at least hold the number of floats.");
+  const auto number_of_floats = static_cast<size_t>(packed_data[0]);
+  const size_t number_of_packed_doubles =
+      (number_of_floats * sizeof(float) + sizeof(double) - 1) / sizeof(double);
+  ASSERT(1 + number_of_packed_doubles <= packed_data.size(),
+         "The packed ghost data claims to hold "
+             << number_of_floats << " floats but only has size "
+             << packed_data.size());
+  const size_t number_of_trailing_doubles =
+      packed_data.size() - 1 - number_of_packed_doubles;
+  DataVector ghost_data{number_of_floats + number_of_trailing_doubles};
+  const auto* const float_bytes =
+      // NOLINTNEXTLINE
+      reinterpret_cast<const char*>(packed_data.data() + 1);
+  for (size_t i = 0; i < number_of_floats; ++i) {
+    float value = 0.0f;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(&value, float_bytes + i * sizeof(float), sizeof(float));
+    ghost_data[i] = static_cast<double>(value);
+  }
+  std::copy(std::next(packed_data.begin(), static_cast<std::ptrdiff_t>(
+                                               1 + number_of_packed_doubles)),
+            packed_data.end(),
+            std::next(ghost_data.begin(),
+                      static_cast<std::ptrdiff_t>(number_of_floats)));
+  return ghost_data;
+}
+}  // namespace evolution::dg::subcell
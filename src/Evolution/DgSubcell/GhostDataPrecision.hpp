@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
+
+/// \cond
+class DataVector;
+/// \endcond
+
+namespace evolution::dg::subcell {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(send_ghost_data_as_float)
+}  // namespace detail
+
+/*!
+ * \brief Whether the ghost data sent to neighbors for reconstruction is stored
+ * in single precision while in flight.
+ *
+ * Enabled by adding
+ *
+ * \code
+ * static constexpr bool send_ghost_data_as_float = true;
+ * \endcode
+ *
+ * to `Metavariables::SubcellOptions`. Defaults to `false`.
+ *
+ * The ghost zones are only used as input to the (at most high-order)
+ * reconstruction, and so single precision is generally sufficient while
+ * halving the size of the messages. The data for the RDMP TCI that is appended
+ * to the ghost data is always sent in double precision since the TCI compares
+ * it directly against the local solution.
+ */
+template <typename Metavariables>
+constexpr bool send_ghost_data_as_float_v =
+    detail::get_send_ghost_data_as_float_or_default_v<
+        typename Metavariables::SubcellOptions, false>;
+
+/*!
+ * \brief Pack the ghost data in `ghost_data` into single precision.
+ *
+ * The last `number_of_trailing_doubles` entries (the RDMP TCI data) are copied
+ * over unchanged. The returned buffer holds the number of single-precision
+ * values, followed by the single-precision values packed two per `double`,
+ * followed by the trailing doubles. Use `unpack_ghost_data_from_float` to
+ * recover the original layout.
+ */
+DataVector pack_ghost_data_as_float(const DataVector& ghost_data,
+                                    size_t number_of_trailing_doubles);
+
+/*!
+ * \brief Undo `pack_ghost_data_as_float`, returning the ghost data in double
+ * precision followed by the unchanged trailing doubles.
+ */
+DataVector unpack_ghost_data_from_float(const DataVector& packed_data);
+}  // namespace evolution::dg::subcell
@@ -18,6 +18,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/MaxNumberOfNeighbors.hpp"
 #include "Evolution/DgSubcell/GhostData.hpp"
+#include "Evolution/DgSubcell/GhostDataPrecision.hpp"
 #include "Evolution/DgSubcell/RdmpTciData.hpp"
 #include "Evolution/DgSubcell/Tags/DataForRdmpTci.hpp"
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
@@ -94,6 +95,11 @@ void neighbor_reconstructed_face_solution(
                      << received_temporal_id_and_data->first
                      << " with mortar id (" << mortar_id.first << ','
                      << mortar_id.second << ")");
+          if constexpr (send_ghost_data_as_float_v<Metavariables>) {
+            std::get<2>(received_mortar_data.second) =
+                unpack_ghost_data_from_float(
+                    *std::get<2>(received_mortar_data.second));
+          }
           const DataVector& neighbor_ghost_and_subcell_data =
               *std::get<2>(received_mortar_data.second);
           // Compute min and max over neighbors
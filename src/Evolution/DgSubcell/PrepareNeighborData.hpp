@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <unordered_set>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -18,10 +19,10 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/OrientationMapHelpers.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/DgSubcell/GhostDataPrecision.hpp"
 #include "Evolution/DgSubcell/Projection.hpp"
 #include "Evolution/DgSubcell/RdmpTci.hpp"
 #include "Evolution/DgSubcell/RdmpTciData.hpp"
-#include "Evolution/DgSubcell/SliceData.hpp"
 #include "Evolution/DgSubcell/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/DataForRdmpTci.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
@@ -48,6 +49,17 @@ namespace evolution::dg::subcell {
  * having the mutator `GhostVariables` is to allow sending primitive or
  * characteristic variables for reconstruction.
  *
+ * If `send_ghost_data_as_float_v<Metavariables>` is `true` the data for each
+ * neighbor is packed with `pack_ghost_data_as_float` after the RDMP data has
+ * been appended.
+ *
+ * Elements in blocks listed in `SubcellOptions::only_dg_block_ids()` and
+ * their neighbors never switch to the subcells, so they never use the data
+ * for reconstruction. Only the RDMP TCI data is sent in directions where all
+ * neighbors are in DG-only blocks, and to all neighbors of an element in a
+ * DG-only block. In the latter case `GhostVariables` is not evaluated at all.
+ * The ghost data the receiver stores for these neighbors is empty.
+ *
  * \note If all neighbors are using DG then we send our DG volume data _without_
  * orienting it. This elides the expense of projection and slicing. If any
  * neighbors are doing FD, we project and slice to all neighbors. A future
@@ -88,9 +100,32 @@ void prepare_neighbor_data(
            ? 0
            : volume_fluxes.size());
 
+  const auto& subcell_options = db::get<Tags::SubcellOptions<Dim>>(*box);
+  const auto in_dg_only_block = [&subcell_options](const size_t block_id) {
+    return std::binary_search(subcell_options.only_dg_block_ids().begin(),
+                              subcell_options.only_dg_block_ids().end(),
+                              block_id);
+  };
+  // Elements in DG-only blocks and their neighbors never switch to the
+  // subcells, so they only need the RDMP TCI data from us.
+  std::unordered_set<Direction<Dim>> directions_needing_ghost_data{};
+  if (not in_dg_only_block(element.id().block_id())) {
+    for (const auto& direction : directions_to_slice) {
+      if (not alg::all_of(element.neighbors().at(direction).ids(),
+                          [&in_dg_only_block](const ElementId<Dim>& id) {
+                            return in_dg_only_block(id.block_id());
+                          })) {
+        directions_needing_ghost_data.insert(direction);
+      }
+    }
+  }
+
   if (DataVector ghost_variables =
-          [&box, &extra_size_for_ghost_data, &rdmp_size, &volume_fluxes]() {
-            if (extra_size_for_ghost_data == 0) {
+          [&box, &directions_needing_ghost_data, &extra_size_for_ghost_data,
+           &rdmp_size, &volume_fluxes]() {
+            if (directions_needing_ghost_data.empty()) {
+              return DataVector{};
+            } else if (extra_size_for_ghost_data == 0) {
               return db::mutate_apply(
                   typename Metavariables::SubcellOptions::GhostVariables{}, box,
                   rdmp_size);
@@ -108,6 +143,7 @@ void prepare_neighbor_data(
               return ghost_vars;
             }
           }();
+      directions_needing_ghost_data.empty() or
       alg::all_of(neighbor_meshes,
                   [](const auto& directional_element_id_and_mesh) {
                     ASSERT(directional_element_id_and_mesh.second.basis(0) !=
@@ -121,6 +157,11 @@ void prepare_neighbor_data(
     size_t slice_count = 0;
     for (const auto& direction : directions_to_slice) {
       ++slice_count;
+      if (not alg::found(directions_needing_ghost_data, direction)) {
+        (*all_neighbor_data_for_reconstruction)[direction] =
+            DataVector{rdmp_size};
+        continue;
+      }
       // Move instead of copy on the last iteration. Elides a memory
       // allocation and copy.
       [[maybe_unused]] const auto insert_result =
@@ -142,13 +183,16 @@ void prepare_neighbor_data(
     const DataVector data_to_project{};
     make_const_view(make_not_null(&data_to_project), ghost_variables, 0,
                     ghost_variables.size() - rdmp_size);
-    const DataVector projected_data = evolution::dg::subcell::fd::project(
-        data_to_project, dg_mesh, subcell_mesh.extents());
-    *all_neighbor_data_for_reconstruction = subcell::slice_data(
-        projected_data, db::get<subcell::Tags::Mesh<Dim>>(*box).extents(),
-        ghost_zone_size, directions_to_slice, rdmp_size);
-
-    const auto& subcell_options = db::get<Tags::SubcellOptions<Dim>>(*box);
+    *all_neighbor_data_for_reconstruction =
+        evolution::dg::subcell::fd::project_to_ghost_zones(
+            data_to_project, dg_mesh, subcell_mesh.extents(), ghost_zone_size,
+            directions_needing_ghost_data, rdmp_size);
+    for (const auto& direction : directions_to_slice) {
+      if (not alg::found(directions_needing_ghost_data, direction)) {
+        (*all_neighbor_data_for_reconstruction)[direction] =
+            DataVector{rdmp_size};
+      }
+    }
 
     const bool bordering_dg_block = alg::any_of(
         element.neighbors(),
@@ -168,6 +212,9 @@ void prepare_neighbor_data(
         not bordering_dg_block;
 
     for (const auto& [direction, neighbors] : element.neighbors()) {
+      if (not alg::found(directions_needing_ghost_data, direction)) {
+        continue;
+      }
       const auto& orientation = neighbors.orientation();
       // Note: this currently orients the data for _each_ neighbor. We can
       // instead just orient the data once for all in a particular direction.
@@ -222,6 +269,9 @@ void prepare_neighbor_data(
         rdmp_data.min_variables_values.end(),
         std::prev(neighbor_data.end(),
                   static_cast<int>(rdmp_data.min_variables_values.size())));
+    if constexpr (send_ghost_data_as_float_v<Metavariables>) {
+      neighbor_data = pack_ghost_data_as_float(neighbor_data, rdmp_size);
+    }
   }
 }
 }  // namespace evolution::dg::subcell
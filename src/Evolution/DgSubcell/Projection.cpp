@@ -3,12 +3,19 @@
 
 #include "Evolution/DgSubcell/Projection.hpp"
 
+#include <array>
 #include <cstddef>
+#include <functional>
+#include <unordered_set>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Evolution/DgSubcell/Matrices.hpp"
+#include "Evolution/DgSubcell/SliceData.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/Blas.hpp"
@@ -16,6 +23,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 
 namespace evolution::dg::subcell::fd {
 namespace detail {
@@ -63,6 +71,24 @@ void project_to_face_impl(gsl::span<double> subcell_u,
   const DataVector u{const_cast<double*>(dg_u.data()), dg_u.size()};
   apply_matrices(make_not_null(&result), projection_mat, u, dg_mesh.extents());
 }
+
+// The number of multiplications done by `apply_matrices` per component when
+// the matrix applied in dimension `d` has `rows[d]` rows.
+template <size_t Dim>
+size_t apply_matrices_cost(const std::array<size_t, Dim>& rows,
+                           const Index<Dim>& extents) {
+  size_t cost = 0;
+  auto current_extents = extents.indices();
+  for (size_t d = 0; d < Dim; ++d) {
+    size_t points = 1;
+    for (size_t i = 0; i < Dim; ++i) {
+      points *= gsl::at(current_extents, i);
+    }
+    cost += gsl::at(rows, d) * points;
+    gsl::at(current_extents, d) = gsl::at(rows, d);
+  }
+  return cost;
+}
 }  // namespace detail
 
 template <size_t Dim>
@@ -121,6 +147,60 @@ DataVector project_to_face(const DataVector& dg_u, const Mesh<Dim>& dg_mesh,
   return subcell_u;
 }
 
+template <size_t Dim>
+DirectionMap<Dim, DataVector> project_to_ghost_zones(
+    const DataVector& dg_u, const Mesh<Dim>& dg_mesh,
+    const Index<Dim>& subcell_extents, const size_t ghost_zone_size,
+    const std::unordered_set<Direction<Dim>>& directions,
+    const size_t additional_buffer) {
+  ASSERT(dg_u.size() % dg_mesh.number_of_grid_points() == 0,
+         "The vector dg_u must have size that is a multiple of the number of "
+         "grid points "
+             << dg_mesh.number_of_grid_points() << " but got " << dg_u.size());
+  const size_t fused_cost = [&dg_mesh, &directions, &ghost_zone_size,
+                             &subcell_extents]() {
+    size_t cost = 0;
+    for (const auto& direction : directions) {
+      auto rows = subcell_extents.indices();
+      gsl::at(rows, direction.dimension()) = ghost_zone_size;
+      cost += detail::apply_matrices_cost(rows, dg_mesh.extents());
+    }
+    return cost;
+  }();
+  if (fused_cost >= detail::apply_matrices_cost(subcell_extents.indices(),
+                                                dg_mesh.extents())) {
+    return slice_data(project(dg_u, dg_mesh, subcell_extents), subcell_extents,
+                      ghost_zone_size, directions, additional_buffer);
+  }
+
+  const size_t number_of_components =
+      dg_u.size() / dg_mesh.number_of_grid_points();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const DataVector u{const_cast<double*>(dg_u.data()), dg_u.size()};
+  DirectionMap<Dim, DataVector> result{};
+  for (const auto& direction : directions) {
+    const size_t dimension = direction.dimension();
+    const Matrix empty{};
+    auto projection_mat = make_array<Dim>(std::cref(empty));
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(projection_mat, d) = std::cref(
+          d == dimension
+              ? projection_matrix(dg_mesh.slice_through(d), subcell_extents[d],
+                                  ghost_zone_size, direction.side())
+              : projection_matrix(dg_mesh.slice_through(d), subcell_extents[d],
+                                  Spectral::Quadrature::CellCentered));
+    }
+    const size_t ghost_size = number_of_components * ghost_zone_size *
+                              subcell_extents.slice_away(dimension).product();
+    DataVector& ghost_data = result[direction];
+    ghost_data.destructive_resize(ghost_size + additional_buffer);
+    DataVector ghost_view{ghost_data.data(), ghost_size};
+    apply_matrices(make_not_null(&ghost_view), projection_mat, u,
+                   dg_mesh.extents());
+  }
+  return result;
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                                 \
@@ -141,7 +221,12 @@ DataVector project_to_face(const DataVector& dg_u, const Mesh<Dim>& dg_mesh,
   template void detail::project_to_face_impl(                                  \
       gsl::span<double> subcell_u, const gsl::span<const double> dg_u,         \
       const Mesh<DIM(data)>& dg_mesh, const Index<DIM(data)>& subcell_extents, \
-      const size_t& face_direction);
+      const size_t& face_direction);                                           \
+  template DirectionMap<DIM(data), DataVector> project_to_ghost_zones(         \
+      const DataVector& dg_u, const Mesh<DIM(data)>& dg_mesh,                  \
+      const Index<DIM(data)>& subcell_extents, size_t ghost_zone_size,         \
+      const std::unordered_set<Direction<DIM(data)>>& directions,              \
+      size_t additional_buffer);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
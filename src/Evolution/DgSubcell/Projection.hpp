@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <unordered_set>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/Variables.hpp"
@@ -14,6 +15,10 @@
 /// \cond
 class DataVector;
 template <size_t>
+class Direction;
+template <size_t, typename>
+class DirectionMap;
+template <size_t>
 class Index;
 template <size_t>
 class Mesh;
@@ -133,4 +138,24 @@ Variables<TagList> project_to_face(const Variables<TagList>& dg_u,
   return subcell_u;
 }
 /// @}
+
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief Project the variables `dg_u` onto the `ghost_zone_size` subcells
+ * next to each face in `directions`.
+ *
+ * The result is the same as calling `slice_data` on the projection of `dg_u`
+ * onto the subcells, including the `additional_buffer` entries at the end of
+ * each slice. Instead of projecting onto all subcells, the DG data may be
+ * projected directly onto the ghost zones by using the cached 1d ghost-zone
+ * projection matrices in the direction normal to each face. The cheaper
+ * approach is chosen by counting the operations of both, so that the fused
+ * projection is used when only some of the faces are needed.
+ */
+template <size_t Dim>
+DirectionMap<Dim, DataVector> project_to_ghost_zones(
+    const DataVector& dg_u, const Mesh<Dim>& dg_mesh,
+    const Index<Dim>& subcell_extents, size_t ghost_zone_size,
+    const std::unordered_set<Direction<Dim>>& directions,
+    size_t additional_buffer);
 }  // namespace evolution::dg::subcell::fd
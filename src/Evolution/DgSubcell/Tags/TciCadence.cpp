@@ -0,0 +1,39 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/Tags/TciCadence.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/TciCadence.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg::subcell::Tags {
+template <size_t Dim>
+void TciIntervalCompute<Dim>::function(
+    const gsl::not_null<return_type*> result,
+    const subcell::TciCadence& tci_cadence,
+    const subcell::ActiveGrid active_grid, const ::Mesh<Dim>& subcell_mesh,
+    const ::Mesh<Dim>& dg_mesh) {
+  if (active_grid == subcell::ActiveGrid::Dg) {
+    get(*result).destructive_resize(dg_mesh.number_of_grid_points());
+    get(*result) = static_cast<double>(tci_cadence.interval());
+  } else {
+    get(*result).destructive_resize(subcell_mesh.number_of_grid_points());
+    get(*result) = 0.0;
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data) template class TciIntervalCompute<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg::subcell::Tags
@@ -0,0 +1,51 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Tags.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/TciCadence.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace evolution::dg::subcell::Tags {
+/// The `subcell::TciCadence` deciding on which steps the TCI is evaluated on
+/// the DG grid.
+struct TciCadence : db::SimpleTag {
+  using type = subcell::TciCadence;
+};
+
+/// The number of time steps between evaluations of the TCI on the DG grid as a
+/// `Scalar<DataVector>` so it can be observed.
+struct TciInterval : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+/// Compute tag to get a `TciInterval` from a `TciCadence`. The interval is
+/// reported as zero while the element uses subcells.
+template <size_t Dim>
+struct TciIntervalCompute : db::ComputeTag, TciInterval {
+  using base = TciInterval;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<Tags::TciCadence, Tags::ActiveGrid,
+                                   Tags::Mesh<Dim>, ::domain::Tags::Mesh<Dim>>;
+  static void function(gsl::not_null<return_type*> result,
+                       const subcell::TciCadence& tci_cadence,
+                       subcell::ActiveGrid active_grid,
+                       const ::Mesh<Dim>& subcell_mesh,
+                       const ::Mesh<Dim>& dg_mesh);
+};
+}  // namespace evolution::dg::subcell::Tags
@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DgSubcell/TciCadence.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <pup.h>
+
+#include "DataStructures/DataVector.hpp"
+#include "Evolution/DgSubcell/RdmpTciData.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace evolution::dg::subcell {
+void TciCadence::skip() {
+  ASSERT(steps_until_check_ > 0,
+         "Cannot skip the TCI on a step on which it must be checked.");
+  --steps_until_check_;
+  ++number_of_skips_;
+}
+
+void TciCadence::record_check(const bool passed, const bool rdmp_bound_is_near,
+                              const size_t maximum_interval) {
+  ASSERT(maximum_interval > 0, "The maximum TCI interval must be positive.");
+  ++number_of_checks_;
+  if (not passed or rdmp_bound_is_near) {
+    interval_ = 1;
+    consecutive_passes_ = 0;
+  } else {
+    ++consecutive_passes_;
+    if (consecutive_passes_ >= interval_) {
+      interval_ = std::min(2 * interval_, maximum_interval);
+      consecutive_passes_ = 0;
+    }
+  }
+  steps_until_check_ = interval_ - 1;
+}
+
+void TciCadence::reset() {
+  interval_ = 1;
+  consecutive_passes_ = 0;
+  steps_until_check_ = 0;
+}
+
+void TciCadence::pup(PUP::er& p) {
+  p | interval_;
+  p | consecutive_passes_;
+  p | steps_until_check_;
+  p | number_of_checks_;
+  p | number_of_skips_;
+}
+
+bool operator==(const TciCadence& lhs, const TciCadence& rhs) {
+  return lhs.interval_ == rhs.interval_ and
+         lhs.consecutive_passes_ == rhs.consecutive_passes_ and
+         lhs.steps_until_check_ == rhs.steps_until_check_ and
+         lhs.number_of_checks_ == rhs.number_of_checks_ and
+         lhs.number_of_skips_ == rhs.number_of_skips_;
+}
+
+bool operator!=(const TciCadence& lhs, const TciCadence& rhs) {
+  return not(lhs == rhs);
+}
+
+bool rdmp_bound_is_near(const RdmpTciData& candidate_rdmp_data,
+                        const RdmpTciData& past_rdmp_data,
+                        const double rdmp_delta0, const double rdmp_epsilon) {
+  const size_t number_of_vars = candidate_rdmp_data.max_variables_values.size();
+  ASSERT(candidate_rdmp_data.min_variables_values.size() == number_of_vars and
+             past_rdmp_data.max_variables_values.size() == number_of_vars and
+             past_rdmp_data.min_variables_values.size() == number_of_vars,
+         "The max and min of the candidate and past variables must all have "
+         "the same size.");
+  for (size_t i = 0; i < number_of_vars; ++i) {
+    const double past_max = past_rdmp_data.max_variables_values[i];
+    const double past_min = past_rdmp_data.min_variables_values[i];
+    const double half_delta =
+        0.5 * std::max(rdmp_delta0, rdmp_epsilon * (past_max - past_min));
+    if (candidate_rdmp_data.max_variables_values[i] > past_max + half_delta or
+        candidate_rdmp_data.min_variables_values[i] < past_min - half_delta) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace evolution::dg::subcell
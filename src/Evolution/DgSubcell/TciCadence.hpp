@@ -0,0 +1,114 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace evolution::dg::subcell {
+struct RdmpTciData;
+}  // namespace evolution::dg::subcell
+/// \endcond
+
+namespace evolution::dg::subcell {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(maximum_tci_interval)
+}  // namespace detail
+
+/*!
+ * \brief The maximum number of time steps between two evaluations of the
+ * troubled-cell indicator on a DG element.
+ *
+ * Enabled by adding
+ *
+ * \code
+ * static constexpr size_t maximum_tci_interval = 8;
+ * \endcode
+ *
+ * to `Metavariables::SubcellOptions`. Defaults to `1`, i.e. the TCI is
+ * evaluated every time step. See `TciCadence` for how the interval is adapted.
+ */
+template <typename Metavariables>
+constexpr size_t maximum_tci_interval_v =
+    detail::get_maximum_tci_interval_or_default_v<
+        typename Metavariables::SubcellOptions, static_cast<size_t>(1)>;
+
+/*!
+ * \brief Decides on which time steps the troubled-cell indicator (TCI) is
+ * evaluated on a DG element.
+ *
+ * Elements that pass the TCI on many consecutive checks are checked less
+ * often: after a number of consecutive passes equal to the current interval
+ * the interval is doubled, up to the maximum interval. Whenever the TCI
+ * fails, the element is close to violating the RDMP bound (see
+ * `rdmp_bound_is_near`), or a check is forced (e.g. because a neighbor is
+ * troubled), the interval is reset to one so the element is checked every
+ * time step again.
+ *
+ * The numbers of checks and skips are kept for diagnostics.
+ */
+class TciCadence {
+ public:
+  TciCadence() = default;
+
+  /// Whether the TCI must be evaluated on the current time step.
+  bool check_this_step() const { return steps_until_check_ == 0; }
+
+  /// Record that the TCI was not evaluated on the current time step.
+  void skip();
+
+  /// Record the result of evaluating the TCI, adapting the interval.
+  ///
+  /// `maximum_interval` must be at least one.
+  void record_check(bool passed, bool rdmp_bound_is_near,
+                    size_t maximum_interval);
+
+  /// Check every time step until the element has passed again, e.g. after a
+  /// neighbor was troubled or the element switched grids.
+  void reset();
+
+  /// The current number of time steps between checks.
+  size_t interval() const { return interval_; }
+
+  size_t consecutive_passes() const { return consecutive_passes_; }
+
+  size_t steps_until_check() const { return steps_until_check_; }
+
+  size_t number_of_checks() const { return number_of_checks_; }
+
+  size_t number_of_skips() const { return number_of_skips_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  friend bool operator==(const TciCadence& lhs, const TciCadence& rhs);
+
+  size_t interval_{1};
+  size_t consecutive_passes_{0};
+  size_t steps_until_check_{0};
+  size_t number_of_checks_{0};
+  size_t number_of_skips_{0};
+};
+
+bool operator!=(const TciCadence& lhs, const TciCadence& rhs);
+
+/*!
+ * \brief Returns `true` if the candidate solution used up more than half of
+ * the relaxation \f$\delta_\alpha\f$ allowed by the RDMP TCI for any
+ * variable.
+ *
+ * The arguments are the same as those of `rdmp_tci`. Elements for which this
+ * returns `true` are checked on the next time step since the bound may be
+ * violated soon.
+ */
+bool rdmp_bound_is_near(const RdmpTciData& candidate_rdmp_data,
+                        const RdmpTciData& past_rdmp_data, double rdmp_delta0,
+                        double rdmp_epsilon);
+}  // namespace evolution::dg::subcell
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <optional>
@@ -50,6 +51,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/System/Prefetch.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -513,7 +515,29 @@ struct ApplyBoundaryCorrections {
           Variables<mortar_tags_list> local_data_on_mortar{};
           Variables<mortar_tags_list> neighbor_data_on_mortar{};
 
-          for (auto& mortar_id_and_data : *mortar_data) {
+          for (auto mortar_it = mortar_data->begin();
+               mortar_it != mortar_data->end(); ++mortar_it) {
+            auto& mortar_id_and_data = *mortar_it;
+            if constexpr (not local_time_stepping) {
+              // The mortar data of the different neighbors are separate
+              // allocations, so start loading the next mortar's data while
+              // this one is being lifted.
+              const auto next_mortar = std::next(mortar_it);
+              if (next_mortar != mortar_data->end()) {
+                const auto& local_next =
+                    next_mortar->second.local_mortar_data();
+                const auto& neighbor_next =
+                    next_mortar->second.neighbor_mortar_data();
+                if (local_next.has_value()) {
+                  sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(
+                      local_next->second);
+                }
+                if (neighbor_next.has_value()) {
+                  sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(
+                      neighbor_next->second);
+                }
+              }
+            }
             const auto& mortar_id = mortar_id_and_data.first;
             const auto& direction = mortar_id.first;
             if (UNLIKELY(mortar_id.second ==
@@ -588,24 +612,6 @@ struct ApplyBoundaryCorrections {
               const std::array<Spectral::MortarSize, volume_dim - 1>&
                   mortar_size = mortar_sizes.at(mortar_id);
 
-              // This cannot reuse an allocation because it is initialized
-              // via move-assignment.  (If it is used at all.)
-              DtVariables dt_boundary_correction_projected_onto_face{};
-              auto& dt_boundary_correction =
-                  [&dt_boundary_correction_on_mortar,
-                   &dt_boundary_correction_projected_onto_face, &face_mesh,
-                   &mortar_mesh, &mortar_size]() -> DtVariables& {
-                if (Spectral::needs_projection(face_mesh, mortar_mesh,
-                                               mortar_size)) {
-                  dt_boundary_correction_projected_onto_face =
-                      ::dg::project_from_mortar(
-                          dt_boundary_correction_on_mortar, face_mesh,
-                          mortar_mesh, mortar_size);
-                  return dt_boundary_correction_projected_onto_face;
-                }
-                return dt_boundary_correction_on_mortar;
-              }();
-
               // Both paths initialize this to be non-owning.
               Scalar<DataVector> magnitude_of_face_normal{};
               if constexpr (local_time_stepping) {
@@ -628,6 +634,27 @@ struct ApplyBoundaryCorrections {
               }
 
               if (using_gauss_lobatto_points) {
+                // The lifted correction is returned on the face so it can be
+                // added to the boundary history with local time stepping.
+                //
+                // This cannot reuse an allocation because it is initialized
+                // via move-assignment.  (If it is used at all.)
+                DtVariables dt_boundary_correction_projected_onto_face{};
+                auto& dt_boundary_correction =
+                    [&dt_boundary_correction_on_mortar,
+                     &dt_boundary_correction_projected_onto_face, &face_mesh,
+                     &mortar_mesh, &mortar_size]() -> DtVariables& {
+                  if (Spectral::needs_projection(face_mesh, mortar_mesh,
+                                                 mortar_size)) {
+                    dt_boundary_correction_projected_onto_face =
+                        ::dg::project_from_mortar(
+                            dt_boundary_correction_on_mortar, face_mesh,
+                            mortar_mesh, mortar_size);
+                    return dt_boundary_correction_projected_onto_face;
+                  }
+                  return dt_boundary_correction_on_mortar;
+                }();
+
                 // The lift_flux function lifts only on the slice, it does not
                 // add the contribution to the volume.
                 ::dg::lift_flux(make_not_null(&dt_boundary_correction),
@@ -676,11 +703,13 @@ struct ApplyBoundaryCorrections {
 
                 volume_dt_correction.initialize(
                     volume_mesh.number_of_grid_points(), 0.0);
-                evolution::dg::lift_boundary_terms_gauss_points(
+                // Project from the mortar and lift one component at a time
+                // instead of allocating the projected correction on the face.
+                evolution::dg::project_and_lift_boundary_terms(
                     make_not_null(&volume_dt_correction),
                     volume_det_inv_jacobian, volume_mesh, direction,
-                    dt_boundary_correction, magnitude_of_face_normal,
-                    face_det_jacobian);
+                    dt_boundary_correction_on_mortar, mortar_mesh, mortar_size,
+                    magnitude_of_face_normal, face_det_jacobian);
                 return std::move(volume_dt_correction);
               }
             };
@@ -579,20 +579,15 @@ void apply_boundary_condition_on_face(
             *db::get<evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>>(*box)
                  .at(direction));
     if (volume_mesh.quadrature(0) == Spectral::Quadrature::GaussLobatto) {
-      // The lift_flux function lifts only on the slice, it does not add
-      // the contribution to the volume.
-      ::dg::lift_flux(make_not_null(&boundary_corrections_on_face),
-                      volume_mesh.extents(direction.dimension()),
-                      magnitude_of_interior_face_normal);
-
-      // Add the flux contribution to the volume data
+      // Lift the flux contribution and add it to the volume data
       db::mutate<dt_variables_tag>(
-          [&direction, &boundary_corrections_on_face,
-           &volume_mesh](const auto dt_variables_ptr) {
-            add_slice_to_data(
+          [&direction, &boundary_corrections_on_face, &volume_mesh,
+           &magnitude_of_interior_face_normal](const auto dt_variables_ptr) {
+            ::dg::lift_flux_to_volume(
                 dt_variables_ptr, boundary_corrections_on_face,
                 volume_mesh.extents(), direction.dimension(),
-                index_to_slice_at(volume_mesh.extents(), direction));
+                index_to_slice_at(volume_mesh.extents(), direction),
+                magnitude_of_interior_face_normal);
           },
           box);
     } else {
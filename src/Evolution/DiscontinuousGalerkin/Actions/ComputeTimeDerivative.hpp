@@ -4,6 +4,7 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 #include <optional>
 #include <tuple>
 #include <type_traits>
@@ -14,6 +15,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -35,6 +37,7 @@
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/NormalVectorTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/StoredTemporary.hpp"
 #include "Evolution/DiscontinuousGalerkin/UsingSubcell.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
@@ -49,12 +52,19 @@
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Time/Actions/SelfStartActions.hpp"
+#include "Time/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/BoundaryHistory.hpp"
+#include "Time/Tags/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
+#include "Time/Tags/TimeStepId.hpp"
 #include "Time/TakeStep.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 /// \cond
 namespace Tags {
@@ -99,6 +109,8 @@ struct get_primitive_tags_for_face {
   using type = typename get_primitive_vars<
       System::has_primitive_and_conservative_vars>::template f<T>;
 };
+
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(use_dg_scratch_arena)
 }  // namespace detail
 
 /*!
@@ -234,6 +246,7 @@ struct get_primitive_tags_for_face {
  * - Adds: nothing
  * - Removes: nothing
  * - Modifies:
+ *   - `evolution::dg::Tags::StoredTemporary` of the temporaries, if present
  *   - db::add_tag_prefix<Tags::Flux, variables_tag,
  *                        tmpl::size_t<system::volume_dim>, Frame::Inertial>
  *   - `Tags::dt<system::variable_tags>`
@@ -341,6 +354,21 @@ struct get_primitive_tags_for_face {
  * - Removes: nothing
  * - Modifies:
  *   - `evolution::dg::Tags::MortarData<Dim>`
+ *   - `Tags::AdaptiveSteppingDiagnostics` if present, to record the number
+ *     of substeps and the wall time spent in this action
+ *
+ * The volume and face temporaries are allocated in a single buffer. If
+ * `static constexpr bool use_dg_scratch_arena = true;` is specified in the
+ * `Metavariables`, the buffer is taken from the `ScratchArena` of the current
+ * PE instead of the heap, so that steady-state stepping does not allocate
+ * memory for it. This can be confirmed with
+ * `ScratchArena::local().number_of_heap_allocations()`.
+ *
+ * With global time stepping the boundary data is sent to the neighbors as soon
+ * as it has been computed, and the external boundary conditions are applied
+ * afterwards so that their cost overlaps with the communication. With local
+ * time stepping the data can only be sent after the step has been taken,
+ * which requires the complete time derivative.
  */
 template <size_t Dim, typename EvolutionSystem, typename DgStepChoosers,
           bool LocalTimeStepping>
@@ -392,6 +420,8 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
   using compute_volume_time_derivative_terms =
       typename EvolutionSystem::compute_volume_time_derivative_terms;
 
+  [[maybe_unused]] const double wall_time_start = sys::wall_time();
+
   const Mesh<Dim>& mesh = db::get<::domain::Tags::Mesh<Dim>>(box);
   const ::dg::Formulation dg_formulation =
       db::get<::dg::Tags::Formulation>(box);
@@ -498,11 +528,23 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       (VarsFaceTemporaries::number_of_independent_components +
        DgPackagedDataVarsOnFace::number_of_independent_components) *
           num_face_temporary_grid_points;
-  auto buffer = cpp20::make_unique_for_overwrite<double[]>(buffer_size);
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  std::unique_ptr<double[]> heap_buffer{};
+  std::optional<ScratchArena::Scope> arena_scope{};
+  double* buffer = nullptr;
+  if constexpr (detail::get_use_dg_scratch_arena_or_default_v<Metavariables,
+                                                              false>) {
+    // The scope keeps the memory reserved until we return from the action.
+    arena_scope.emplace(make_not_null(&ScratchArena::local()));
+    buffer = arena_scope->allocate(buffer_size).data();
+  } else {
+    heap_buffer = cpp20::make_unique_for_overwrite<double[]>(buffer_size);
+    buffer = heap_buffer.get();
 #ifdef SPECTRE_DEBUG
-  std::fill(&buffer[0], &buffer[buffer_size],
-            std::numeric_limits<double>::signaling_NaN());
+    std::fill(&buffer[0], &buffer[buffer_size],
+              std::numeric_limits<double>::signaling_NaN());
 #endif
+  }
   VarsTemporaries temporaries{
       &buffer[0], VarsTemporaries::number_of_independent_components *
                       number_of_grid_points};
@@ -582,6 +624,24 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       },
       make_not_null(&box));
 
+  // Keep the temporaries that observations reuse, see
+  // `evolution::dg::Tags::StoredTemporary`
+  tmpl::for_each<typename compute_volume_time_derivative_terms::temporary_tags>(
+      [&box, &temporaries](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        if constexpr (db::tag_is_retrievable_v<
+                          evolution::dg::Tags::StoredTemporary<tag>,
+                          db::DataBox<DbTagsList>>) {
+          db::mutate<evolution::dg::Tags::StoredTemporary<tag>>(
+              [&temporaries](const auto stored_temporary,
+                             const TimeStepId& time_step_id) {
+                stored_temporary->first = time_step_id;
+                stored_temporary->second = get<tag>(temporaries);
+              },
+              make_not_null(&box), db::get<::Tags::TimeStepId>(box));
+        }
+      });
+
   const Variables<detail::get_primitive_vars_tags_from_system<EvolutionSystem>>*
       primitive_vars{nullptr};
   if constexpr (EvolutionSystem::has_primitive_and_conservative_vars) {
@@ -593,42 +653,75 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       tmpl::all<derived_boundary_corrections, std::is_final<tmpl::_1>>::value,
       "All createable classes for boundary corrections must be marked "
       "final.");
-  tmpl::for_each<derived_boundary_corrections>(
-      [&boundary_correction, &box, &partial_derivs, &primitive_vars,
-       &temporaries, &volume_fluxes, &packaged_data_buffer,
-       &face_temporaries](auto derived_correction_v) {
-        using DerivedCorrection =
-            tmpl::type_from<decltype(derived_correction_v)>;
-        if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
-          // Compute internal boundary quantities on the mortar for sides
-          // of the element that have neighbors, i.e. they are not an
-          // external side.
-          // Note: this call mutates:
-          //  - evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>,
-          //  - evolution::dg::Tags::MortarData<Dim>
-          detail::internal_mortar_data<EvolutionSystem, Dim>(
-              make_not_null(&box), make_not_null(&face_temporaries),
-              make_not_null(&packaged_data_buffer),
-              dynamic_cast<const DerivedCorrection&>(boundary_correction),
-              db::get<variables_tag>(box), volume_fluxes, temporaries,
-              primitive_vars,
-              typename DerivedCorrection::dg_package_data_volume_tags{});
-
-          detail::apply_boundary_conditions_on_all_external_faces<
-              EvolutionSystem, Dim>(
-              make_not_null(&box),
-              dynamic_cast<const DerivedCorrection&>(boundary_correction),
-              temporaries, volume_fluxes, partial_derivs, primitive_vars);
-        }
+  // Calls `func` with the boundary correction cast to its derived type.
+  const auto call_with_derived_correction = [&boundary_correction](
+                                                const auto& func) {
+    tmpl::for_each<derived_boundary_corrections>(
+        [&boundary_correction, &func](auto derived_correction_v) {
+          using DerivedCorrection =
+              tmpl::type_from<decltype(derived_correction_v)>;
+          if (typeid(boundary_correction) == typeid(DerivedCorrection)) {
+            func(dynamic_cast<const DerivedCorrection&>(boundary_correction));
+          }
+        });
+  };
+  const auto apply_external_boundary_conditions =
+      [&box, &partial_derivs, &primitive_vars, &temporaries,
+       &volume_fluxes](const auto& derived_correction) {
+        detail::apply_boundary_conditions_on_all_external_faces<
+            EvolutionSystem, Dim>(make_not_null(&box), derived_correction,
+                                  temporaries, volume_fluxes, partial_derivs,
+                                  primitive_vars);
+      };
+
+  call_with_derived_correction(
+      [&box, &primitive_vars, &temporaries, &volume_fluxes,
+       &packaged_data_buffer, &face_temporaries](
+          const auto& derived_correction) {
+        using DerivedCorrection = std::decay_t<decltype(derived_correction)>;
+        // Compute internal boundary quantities on the mortar for sides
+        // of the element that have neighbors, i.e. they are not an
+        // external side.
+        // Note: this call mutates:
+        //  - evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>,
+        //  - evolution::dg::Tags::MortarData<Dim>
+        detail::internal_mortar_data<EvolutionSystem, Dim>(
+            make_not_null(&box), make_not_null(&face_temporaries),
+            make_not_null(&packaged_data_buffer), derived_correction,
+            db::get<variables_tag>(box), volume_fluxes, temporaries,
+            primitive_vars,
+            typename DerivedCorrection::dg_package_data_volume_tags{});
       });
 
   if constexpr (LocalTimeStepping) {
+    // The step taken, and therefore the next time step id sent to the
+    // neighbors, depends on the time derivative including the external
+    // boundary conditions.
+    call_with_derived_correction(apply_external_boundary_conditions);
     take_step<EvolutionSystem, LocalTimeStepping, DgStepChoosers>(
         make_not_null(&box));
+    send_data_for_fluxes<ParallelComponent>(
+        make_not_null(&cache), make_not_null(&box), volume_fluxes);
+  } else {
+    // The data sent to the neighbors does not depend on the external
+    // boundary conditions, so we send it first and apply the boundary
+    // conditions while the messages are in flight.
+    send_data_for_fluxes<ParallelComponent>(
+        make_not_null(&cache), make_not_null(&box), volume_fluxes);
+    call_with_derived_correction(apply_external_boundary_conditions);
   }
 
-  send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
-                                          make_not_null(&box), volume_fluxes);
+  if constexpr (db::tag_is_retrievable_v<::Tags::AdaptiveSteppingDiagnostics,
+                                         db::DataBox<DbTagsList>>) {
+    db::mutate<::Tags::AdaptiveSteppingDiagnostics>(
+        [&wall_time_start](
+            const gsl::not_null<AdaptiveSteppingDiagnostics*> diags) {
+          ++diags->number_of_substeps;
+          diags->time_derivative_wall_time +=
+              sys::wall_time() - wall_time_start;
+        },
+        make_not_null(&box));
+  }
   return {Parallel::AlgorithmExecution::Continue, std::nullopt};
 }
 
@@ -800,6 +893,10 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                 normal_covector_and_magnitude) {
           Scalar<DataVector> volume_det_jacobian{};
           Scalar<DataVector> face_det_jacobian{};
+          // The geometric quantities are shared with the other mortars of
+          // this element and with the previous step where they agree, which
+          // they do on a static mesh. The history then holds a single copy.
+          const MortarData<Dim>* previous_mortar_data = nullptr;
           if (using_gauss_points) {
             get(volume_det_jacobian) = 1.0 / get(volume_det_inv_jacobian);
           }
@@ -835,24 +932,27 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
 
             for (const auto& neighbor : neighbors_in_direction) {
               const std::pair mortar_id{direction, neighbor};
-              if (using_gauss_points) {
-                mortar_data->at(mortar_id).insert_local_geometric_quantities(
-                    volume_det_inv_jacobian, face_det_jacobian,
-                    face_normal_magnitude);
-              } else {
-                mortar_data->at(mortar_id).insert_local_face_normal_magnitude(
-                    face_normal_magnitude);
-              }
               ASSERT(boundary_data_history->count(mortar_id) != 0,
                      "Could not insert the mortar data for "
                          << mortar_id
                          << " because the unordered map has not been "
                             "initialized "
                             "to have the mortar id.");
-              boundary_data_history->at(mortar_id).local_insert(
-                  time_step_id, std::move(mortar_data->at(mortar_id)));
-              boundary_data_history->at(mortar_id).integration_order(
-                  integration_order);
+              auto& history = boundary_data_history->at(mortar_id);
+              if (using_gauss_points) {
+                mortar_data->at(mortar_id).insert_local_geometric_quantities(
+                    volume_det_inv_jacobian, face_det_jacobian,
+                    face_normal_magnitude,
+                    {previous_mortar_data, history.latest_local_data()});
+              } else {
+                mortar_data->at(mortar_id).insert_local_face_normal_magnitude(
+                    face_normal_magnitude,
+                    {previous_mortar_data, history.latest_local_data()});
+              }
+              history.local_insert(time_step_id,
+                                   std::move(mortar_data->at(mortar_id)));
+              history.integration_order(integration_order);
+              previous_mortar_data = history.latest_local_data();
               mortar_data->at(mortar_id) = MortarData<Dim>{};
             }
           }
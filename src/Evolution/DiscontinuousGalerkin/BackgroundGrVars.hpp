@@ -43,11 +43,20 @@ struct EmptyStruct {
  * for evolution systems run on a curved spacetime without solving Einstein
  * equations (e.g. ValenciaDivclean, ForceFree).
  *
- * \warning This mutator assumes that the GR analytic data or solution
- * specifying background spacetime metric is time-independent.
+ * \details The background quantities are computed once and then kept in the
+ * DataBox. They are only recomputed when they can have changed:
  *
+ * - when the mesh changes, e.g. by p-refinement, so the number of grid points
+ *   differs from that of the stored quantities,
+ * - when the block coordinate map is time-dependent, so the grid points move,
+ * - on every call if `TimeDependentBackground` is `true`.
+ *
+ * \warning Set `TimeDependentBackground` if the GR analytic data or solution
+ * specifying the background spacetime metric is time-dependent. Otherwise it
+ * is only evaluated at the time the quantities were last computed.
  */
-template <typename System, typename Metavariables, bool UsingRuntimeId>
+template <typename System, typename Metavariables, bool UsingRuntimeId,
+          bool TimeDependentBackground = false>
 struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
   static constexpr size_t volume_dim = System::volume_dim;
 
@@ -80,27 +89,22 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
       const T& solution_or_data) {
     const size_t num_grid_pts = mesh.number_of_grid_points();
 
-    if (background_gr_vars->number_of_grid_points() != 0) {  // Evolution phase
-      ASSERT((*background_gr_vars).number_of_grid_points() == num_grid_pts,
-             "The size of GR variables ("
-                 << (*background_gr_vars).number_of_grid_points()
-                 << ") is not equal to the number of grid points ("
-                 << mesh.number_of_grid_points() << ").");
-
-      // Check if the mesh is actually moving i.e. block coordinate map is
-      // time-dependent. If not, we can skip the evaluation of GR variables
-      // since they may stay with their values assigned at the initialization
-      // phase.
-      const auto& element_id = element.id();
-      const size_t block_id = element_id.block_id();
-      const Block<volume_dim>& block = domain.blocks()[block_id];
-      if (block.is_time_dependent()) {
-        impl(background_gr_vars, time, inertial_coords, solution_or_data);
-      }
-    } else {
-      // Initialization phase
+    if (background_gr_vars->number_of_grid_points() != num_grid_pts) {
+      // Initialization phase, or the mesh has changed
       (*background_gr_vars).initialize(num_grid_pts);
       impl(background_gr_vars, time, inertial_coords, solution_or_data);
+      return;
+    }
+
+    // Check if the mesh is actually moving i.e. block coordinate map is
+    // time-dependent. If not, and the background is stationary, we can skip
+    // the evaluation of GR variables since they stay with the values they
+    // were last computed with.
+    const auto& element_id = element.id();
+    const size_t block_id = element_id.block_id();
+    const Block<volume_dim>& block = domain.blocks()[block_id];
+    if (TimeDependentBackground or block.is_time_dependent()) {
+      impl(background_gr_vars, time, inertial_coords, solution_or_data);
     }
   }
 
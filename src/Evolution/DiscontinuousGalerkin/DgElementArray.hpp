@@ -39,6 +39,10 @@ CREATE_HAS_STATIC_MEMBER_VARIABLE(use_z_order_distribution)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(use_z_order_distribution)
 CREATE_HAS_STATIC_MEMBER_VARIABLE(local_time_stepping)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(local_time_stepping)
+CREATE_HAS_STATIC_MEMBER_VARIABLE(element_tile_refinement_level)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(element_tile_refinement_level)
+CREATE_HAS_STATIC_MEMBER_VARIABLE(element_weight)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(element_weight)
 }  // namespace detail
 
 /*!
@@ -61,6 +65,21 @@ CREATE_HAS_STATIC_MEMBER_VARIABLE_V(local_time_stepping)
  * spacing of that `Element` (see
  * `domain::get_num_points_and_grid_spacing_cost()`), else the computational
  * cost is determined only by the number of grid points in the `Element`.
+ * Either choice can be overridden by specifying
+ * `static constexpr domain::ElementWeight element_weight = ...;` in the
+ * `Metavariables`.  With local time stepping,
+ * `domain::ElementWeight::NumGridPointsAndLtsStepRate` weights each `Element`
+ * by the number of substeps it is expected to take, which better reflects the
+ * work done by fine elements when the step sizes span many powers of two.
+ *
+ * For domains with many small elements, specifying
+ * `static constexpr size_t element_tile_refinement_level = N;` in the
+ * `Metavariables` assigns the (up to) \f$2^{N \cdot \mathrm{Dim}}\f$ elements
+ * descending from a common element \f$N\f$ refinement levels coarser to the
+ * same processor, so the boundary data exchanged within such a tile stays on
+ * one core (see the "Element tiles" section of
+ * `domain::BlockZCurveProcDistribution`). Each element is still its own array
+ * chare, so this works with any action list and with AMR.
  */
 template <class Metavariables, class PhaseDepActionList>
 struct DgElementArray {
@@ -121,22 +140,33 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
     local_time_stepping = Metavariables::local_time_stepping;
   }
 
+  size_t element_tile_refinement_level = 0;
+  if constexpr (detail::has_element_tile_refinement_level_v<Metavariables>) {
+    element_tile_refinement_level =
+        Metavariables::element_tile_refinement_level;
+  }
+
   const size_t number_of_procs = Parallel::number_of_procs<size_t>(local_cache);
   const size_t number_of_nodes = Parallel::number_of_nodes<size_t>(local_cache);
   const size_t num_of_procs_to_use = number_of_procs - procs_to_ignore.size();
 
   const auto& blocks = domain.blocks();
 
+  domain::ElementWeight element_weight =
+      local_time_stepping ? domain::ElementWeight::NumGridPointsAndGridSpacing
+                          : domain::ElementWeight::NumGridPoints;
+  if constexpr (detail::has_element_weight_v<Metavariables>) {
+    element_weight = Metavariables::element_weight;
+  }
+
   const std::unordered_map<ElementId<volume_dim>, double> element_costs =
-      domain::get_element_costs(
-          blocks, initial_refinement_levels, initial_extents,
-          local_time_stepping
-              ? domain::ElementWeight::NumGridPointsAndGridSpacing
-              : domain::ElementWeight::NumGridPoints,
-          quadrature);
+      domain::get_element_costs(blocks, initial_refinement_levels,
+                                initial_extents, element_weight, quadrature);
   const domain::BlockZCurveProcDistribution<volume_dim> element_distribution{
-      element_costs,   num_of_procs_to_use, blocks, initial_refinement_levels,
-      initial_extents, procs_to_ignore};
+      element_costs,   num_of_procs_to_use,
+      blocks,          initial_refinement_levels,
+      initial_extents, procs_to_ignore,
+      element_tile_refinement_level};
 
   // Will be used to print domain diagnostic info
   std::vector<size_t> elements_per_core(number_of_procs, 0_st);
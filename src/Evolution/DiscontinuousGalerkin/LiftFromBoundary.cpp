@@ -3,14 +3,24 @@
 
 #include "Evolution/DiscontinuousGalerkin/LiftFromBoundary.hpp"
 
+#include <array>
 #include <cstddef>
 #include <utility>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/SliceIterator.hpp"
 #include "DataStructures/StripeIterator.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/IndexToSliceAt.hpp"
+#include "Domain/Structure/Side.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -212,6 +222,194 @@ void lift_boundary_terms_gauss_points_impl(
   }
 }
 
+template <size_t Dim>
+void project_and_lift_boundary_terms_impl(
+    const gsl::not_null<double*> volume_dt_vars,
+    const size_t num_independent_components, const Mesh<Dim>& volume_mesh,
+    const Direction<Dim>& direction,
+    const Scalar<DataVector>& volume_det_inv_jacobian,
+    const gsl::span<const double>& boundary_corrections_on_mortar,
+    const Mesh<Dim - 1>& mortar_mesh,
+    const std::array<Spectral::MortarSize, Dim - 1>& mortar_size,
+    const Scalar<DataVector>& magnitude_of_face_normal,
+    const Scalar<DataVector>& face_det_jacobian) {
+  const size_t dimension = direction.dimension();
+  const Mesh<Dim - 1> face_mesh = volume_mesh.slice_away(dimension);
+  const size_t num_volume_pts = volume_mesh.number_of_grid_points();
+  const size_t num_face_pts = face_mesh.number_of_grid_points();
+  const size_t num_mortar_pts = mortar_mesh.number_of_grid_points();
+  ASSERT(boundary_corrections_on_mortar.size() ==
+             num_independent_components * num_mortar_pts,
+         "Expected " << num_independent_components << " components with "
+                     << num_mortar_pts << " mortar points each but got "
+                     << boundary_corrections_on_mortar.size() << " values.");
+  const bool using_gauss_lobatto_points =
+      volume_mesh.quadrature(dimension) == Spectral::Quadrature::GaussLobatto;
+  ASSERT(using_gauss_lobatto_points or
+             volume_mesh.quadrature(dimension) == Spectral::Quadrature::Gauss,
+         "Can only lift to Gauss or Gauss-Lobatto points but got the mesh: "
+             << volume_mesh);
+  const bool needs_projection =
+      Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size);
+
+  // Only one component of the projected corrections is held at a time. It is
+  // lifted before the next component is projected, so it is most likely still
+  // in cache.
+  DataVector projected_component{needs_projection ? num_face_pts : 0};
+  DataVector mortar_component{};
+  const Mesh<1> volume_stripe_mesh = volume_mesh.slice_through(dimension);
+  const DataVector* const boundary_lifting_term =
+      using_gauss_lobatto_points
+          ? nullptr
+          : &(direction.side() == Side::Upper
+                  ? Spectral::boundary_lifting_term(volume_stripe_mesh).second
+                  : Spectral::boundary_lifting_term(volume_stripe_mesh).first);
+  const size_t num_points_in_dimension = volume_mesh.extents(dimension);
+  // Same factor as in `::dg::lift_flux`
+  const double gauss_lobatto_lift_factor =
+      -0.5 * static_cast<double>(num_points_in_dimension *
+                                 (num_points_in_dimension - 1));
+  const size_t slice_index =
+      index_to_slice_at(volume_mesh.extents(), direction);
+
+  for (size_t component_index = 0; component_index < num_independent_components;
+       ++component_index) {
+    const double* face_component = boundary_corrections_on_mortar.data() +
+                                   component_index * num_mortar_pts;
+    if (needs_projection) {
+      // safe const_cast since used as a view
+      mortar_component.set_data_ref(
+          // NOLINTNEXTLINE
+          const_cast<double*>(face_component), num_mortar_pts);
+      apply_matrices(make_not_null(&projected_component),
+                     Spectral::projection_matrix_child_to_parent(
+                         mortar_mesh, face_mesh, mortar_size),
+                     mortar_component, mortar_mesh.extents());
+      face_component = projected_component.data();
+    }
+
+    double* const component_dt_vars =
+        volume_dt_vars.get() + component_index * num_volume_pts;
+    if (using_gauss_lobatto_points) {
+      for (SliceIterator si(volume_mesh.extents(), dimension, slice_index); si;
+           ++si) {
+        component_dt_vars[si.volume_offset()] +=
+            gauss_lobatto_lift_factor *
+            get(magnitude_of_face_normal)[si.slice_offset()] *
+            face_component[si.slice_offset()];
+      }
+    } else {
+      lift_boundary_terms_gauss_points_impl(
+          make_not_null(component_dt_vars), 1, volume_mesh, dimension,
+          volume_det_inv_jacobian, num_face_pts,
+          gsl::make_span(face_component, num_face_pts), *boundary_lifting_term,
+          magnitude_of_face_normal, face_det_jacobian);
+    }
+  }
+}
+
+template <size_t Dim>
+void lift_all_boundary_terms_gauss_points_impl(
+    const gsl::not_null<double*> volume_dt_vars,
+    const size_t num_independent_components, const Mesh<Dim>& volume_mesh,
+    const Scalar<DataVector>& volume_det_inv_jacobian,
+    const DirectionMap<Dim, gsl::span<const double>>& boundary_corrections,
+    const DirectionMap<Dim, Scalar<DataVector>>& magnitude_of_face_normal,
+    const DirectionMap<Dim, Scalar<DataVector>>& face_det_jacobian) {
+  // The lifting operator of a face is the tensor product of the 1D lifting
+  // term in the normal direction with the identity on the face, so the
+  // contribution of all faces to a volume point only needs the 1D lifting
+  // terms at that point's logical indices and the face values with that
+  // normal index removed.
+  struct Face {
+    size_t dimension = 0;
+    size_t num_face_pts = 0;
+    const DataVector* lifting_term = nullptr;
+    // The boundary corrections times the face Jacobian factors.
+    DataVector weighted_corrections{};
+  };
+  std::array<Face, 2 * Dim> faces{};
+  size_t num_faces = 0;
+  for (const auto& [direction, corrections] : boundary_corrections) {
+    const size_t dimension = direction.dimension();
+    auto& face = gsl::at(faces, num_faces);
+    ++num_faces;
+    face.dimension = dimension;
+    face.num_face_pts =
+        volume_mesh.slice_away(dimension).number_of_grid_points();
+    ASSERT(corrections.size() == num_independent_components * face.num_face_pts,
+           "Expected " << num_independent_components << " components with "
+                       << face.num_face_pts << " face points each in direction "
+                       << direction << " but got " << corrections.size()
+                       << " values.");
+    const auto& lifting_terms =
+        Spectral::boundary_lifting_term(volume_mesh.slice_through(dimension));
+    face.lifting_term = direction.side() == Side::Upper
+                            ? &lifting_terms.second
+                            : &lifting_terms.first;
+    const DataVector& magnitude = get(magnitude_of_face_normal.at(direction));
+    const DataVector& det_jacobian = get(face_det_jacobian.at(direction));
+    face.weighted_corrections.destructive_resize(corrections.size());
+    for (size_t component_index = 0;
+         component_index < num_independent_components; ++component_index) {
+      for (size_t face_index = 0; face_index < face.num_face_pts;
+           ++face_index) {
+        const size_t index = component_index * face.num_face_pts + face_index;
+        face.weighted_corrections[index] = corrections[index] *
+                                           magnitude[face_index] *
+                                           det_jacobian[face_index];
+      }
+    }
+  }
+  if (num_faces == 0) {
+    return;
+  }
+
+  const size_t num_volume_pts = volume_mesh.number_of_grid_points();
+  std::array<size_t, Dim> logical_index{};
+  std::array<double, 2 * Dim> volume_factors{};
+  std::array<size_t, 2 * Dim> face_indices{};
+  for (size_t volume_index = 0; volume_index < num_volume_pts;
+       ++volume_index) {
+    for (size_t face_number = 0; face_number < num_faces; ++face_number) {
+      const auto& face = gsl::at(faces, face_number);
+      size_t face_index = 0;
+      size_t face_stride = 1;
+      for (size_t d = 0; d < Dim; ++d) {
+        if (d != face.dimension) {
+          face_index += gsl::at(logical_index, d) * face_stride;
+          face_stride *= volume_mesh.extents(d);
+        }
+      }
+      gsl::at(face_indices, face_number) = face_index;
+      gsl::at(volume_factors, face_number) =
+          get(volume_det_inv_jacobian)[volume_index] *
+          (*face.lifting_term)[gsl::at(logical_index, face.dimension)];
+    }
+    for (size_t component_index = 0;
+         component_index < num_independent_components; ++component_index) {
+      double lifted = 0.0;
+      for (size_t face_number = 0; face_number < num_faces; ++face_number) {
+        const auto& face = gsl::at(faces, face_number);
+        lifted += gsl::at(volume_factors, face_number) *
+                  face.weighted_corrections[component_index *
+                                                face.num_face_pts +
+                                            gsl::at(face_indices, face_number)];
+      }
+      // Minus sign because we brought this from the LHS to the RHS.
+      volume_dt_vars.get()[component_index * num_volume_pts + volume_index] -=
+          lifted;
+    }
+    // Advance the logical index with the first dimension varying fastest.
+    for (size_t d = 0; d < Dim; ++d) {
+      if (++gsl::at(logical_index, d) < volume_mesh.extents(d)) {
+        break;
+      }
+      gsl::at(logical_index, d) = 0;
+    }
+  }
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(r, data)                                                 \
@@ -236,7 +434,26 @@ void lift_boundary_terms_gauss_points_impl(
       const gsl::span<const double>& lower_boundary_corrections,             \
       const DataVector& lower_boundary_lifting_term,                         \
       const Scalar<DataVector>& lower_magnitude_of_face_normal,              \
-      const Scalar<DataVector>& lower_face_det_jacobian);
+      const Scalar<DataVector>& lower_face_det_jacobian);                    \
+  template void project_and_lift_boundary_terms_impl(                        \
+      gsl::not_null<double*> volume_dt_vars,                                 \
+      size_t num_independent_components, const Mesh<DIM(data)>& volume_mesh, \
+      const Direction<DIM(data)>& direction,                                 \
+      const Scalar<DataVector>& volume_det_inv_jacobian,                     \
+      const gsl::span<const double>& boundary_corrections_on_mortar,         \
+      const Mesh<DIM(data) - 1>& mortar_mesh,                                \
+      const std::array<Spectral::MortarSize, DIM(data) - 1>& mortar_size,    \
+      const Scalar<DataVector>& magnitude_of_face_normal,                    \
+      const Scalar<DataVector>& face_det_jacobian);                          \
+  template void lift_all_boundary_terms_gauss_points_impl(                   \
+      gsl::not_null<double*> volume_dt_vars,                                 \
+      size_t num_independent_components, const Mesh<DIM(data)>& volume_mesh, \
+      const Scalar<DataVector>& volume_det_inv_jacobian,                     \
+      const DirectionMap<DIM(data), gsl::span<const double>>&                \
+          boundary_corrections,                                              \
+      const DirectionMap<DIM(data), Scalar<DataVector>>&                     \
+          magnitude_of_face_normal,                                          \
+      const DirectionMap<DIM(data), Scalar<DataVector>>& face_det_jacobian);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
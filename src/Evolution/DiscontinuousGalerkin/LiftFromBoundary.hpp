@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <utility>
 
@@ -10,8 +11,10 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Side.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
@@ -41,6 +44,26 @@ void lift_boundary_terms_gauss_points_impl(
     const DataVector& lower_boundary_lifting_term,
     const Scalar<DataVector>& lower_magnitude_of_face_normal,
     const Scalar<DataVector>& lower_face_det_jacobian);
+
+template <size_t Dim>
+void project_and_lift_boundary_terms_impl(
+    gsl::not_null<double*> volume_dt_vars, size_t num_independent_components,
+    const Mesh<Dim>& volume_mesh, const Direction<Dim>& direction,
+    const Scalar<DataVector>& volume_det_inv_jacobian,
+    const gsl::span<const double>& boundary_corrections_on_mortar,
+    const Mesh<Dim - 1>& mortar_mesh,
+    const std::array<Spectral::MortarSize, Dim - 1>& mortar_size,
+    const Scalar<DataVector>& magnitude_of_face_normal,
+    const Scalar<DataVector>& face_det_jacobian);
+
+template <size_t Dim>
+void lift_all_boundary_terms_gauss_points_impl(
+    gsl::not_null<double*> volume_dt_vars, size_t num_independent_components,
+    const Mesh<Dim>& volume_mesh,
+    const Scalar<DataVector>& volume_det_inv_jacobian,
+    const DirectionMap<Dim, gsl::span<const double>>& boundary_corrections,
+    const DirectionMap<Dim, Scalar<DataVector>>& magnitude_of_face_normal,
+    const DirectionMap<Dim, Scalar<DataVector>>& face_det_jacobian);
 }  // namespace detail
 
 /*!
@@ -173,4 +196,84 @@ void lift_boundary_terms_gauss_points(
       Spectral::boundary_lifting_term(volume_stripe_mesh).first,
       lower_magnitude_of_face_normal, lower_face_det_jacobian);
 }
+
+/*!
+ * \brief Lift the boundary corrections on all faces in `boundary_corrections`
+ * to the volume time derivatives in a single pass over the volume.
+ *
+ * This is equivalent to calling `lift_boundary_terms_gauss_points` for each
+ * direction in `boundary_corrections`, but since the lifting operator of a
+ * face only acts along the normal direction, the contributions of all faces
+ * are summed at each volume point before being added to `dt_vars`. The volume
+ * time derivatives and inverse Jacobian are therefore only traversed once
+ * instead of once for each face. Directions that are not in
+ * `boundary_corrections`, such as those with boundary conditions lifted
+ * separately, are skipped.
+ */
+template <size_t Dim, typename DtTagsList, typename BoundaryCorrectionTagsList>
+void lift_boundary_terms_gauss_points(
+    const gsl::not_null<Variables<DtTagsList>*> dt_vars,
+    const Scalar<DataVector>& volume_det_inv_jacobian,
+    const Mesh<Dim>& volume_mesh,
+    const DirectionMap<Dim, Variables<BoundaryCorrectionTagsList>>&
+        boundary_corrections,
+    const DirectionMap<Dim, Scalar<DataVector>>& magnitude_of_face_normal,
+    const DirectionMap<Dim, Scalar<DataVector>>& face_det_jacobian) {
+  ASSERT(std::all_of(volume_mesh.quadrature().begin(),
+                     volume_mesh.quadrature().end(),
+                     [](const Spectral::Quadrature quadrature) {
+                       return quadrature == Spectral::Quadrature::Gauss;
+                     }),
+         "Must use Gauss points in all directions but got the mesh: "
+             << volume_mesh);
+  DirectionMap<Dim, gsl::span<const double>> corrections_spans{};
+  for (const auto& [direction, corrections] : boundary_corrections) {
+    corrections_spans.emplace(
+        direction, gsl::make_span(corrections.data(), corrections.size()));
+  }
+  detail::lift_all_boundary_terms_gauss_points_impl(
+      make_not_null(dt_vars->data()), dt_vars->number_of_independent_components,
+      volume_mesh, volume_det_inv_jacobian, corrections_spans,
+      magnitude_of_face_normal, face_det_jacobian);
+}
+
+/*!
+ * \brief Project the boundary corrections from the mortar to the face and
+ * lift them to the volume time derivatives in the specified direction.
+ *
+ * This is equivalent to calling `::dg::project_from_mortar` followed by
+ * `lift_boundary_terms_gauss_points` (for Gauss points), or followed by
+ * `::dg::lift_flux` and `add_slice_to_data` (for Gauss-Lobatto points), but
+ * only holds one face-sized component of the projected corrections at a time
+ * instead of allocating the projected corrections for all variables.
+ *
+ * The quadrature of the volume mesh in the `direction` selects the lifting.
+ * The `volume_det_inv_jacobian` and `face_det_jacobian` are only used for
+ * Gauss points, since the Gauss-Lobatto lifting is done on the face. If the
+ * mortar and the face coincide the corrections are lifted directly.
+ */
+template <size_t Dim, typename DtTagsList, typename BoundaryCorrectionTagsList>
+void project_and_lift_boundary_terms(
+    const gsl::not_null<Variables<DtTagsList>*> dt_vars,
+    const Scalar<DataVector>& volume_det_inv_jacobian,
+    const Mesh<Dim>& volume_mesh, const Direction<Dim>& direction,
+    const Variables<BoundaryCorrectionTagsList>& boundary_corrections_on_mortar,
+    const Mesh<Dim - 1>& mortar_mesh,
+    const std::array<Spectral::MortarSize, Dim - 1>& mortar_size,
+    const Scalar<DataVector>& magnitude_of_face_normal,
+    const Scalar<DataVector>& face_det_jacobian) {
+  ASSERT(dt_vars->number_of_independent_components ==
+             boundary_corrections_on_mortar.number_of_independent_components,
+         "The time derivatives have "
+             << dt_vars->number_of_independent_components
+             << " independent components but the boundary corrections have "
+             << boundary_corrections_on_mortar
+                    .number_of_independent_components);
+  detail::project_and_lift_boundary_terms_impl(
+      make_not_null(dt_vars->data()), dt_vars->number_of_independent_components,
+      volume_mesh, direction, volume_det_inv_jacobian,
+      gsl::make_span(boundary_corrections_on_mortar.data(),
+                     boundary_corrections_on_mortar.size()),
+      mortar_mesh, mortar_size, magnitude_of_face_normal, face_det_jacobian);
+}
 }  // namespace evolution::dg
@@ -7,6 +7,7 @@
 #include <bitset>
 #include <cstddef>
 #include <exception>
+#include <functional>
 #include <ostream>
 #include <vector>
 
@@ -231,20 +232,31 @@ ConstrainedFitCache<VolumeDim>::ConstrainedFitCache(
       }
     }
   }
+
+  // A^{-1} w does not depend on the data being fit, so it is cached as well
+  for (const auto& [primary_dir, matrices] : inverse_a_matrices) {
+    for (const auto& [dir_to_exclude, inverse_a] : matrices) {
+      inverse_a_times_quadrature_weights[primary_dir][dir_to_exclude] =
+          apply_matrices(
+              std::array<std::reference_wrapper<const Matrix>, 1>{{inverse_a}},
+              quadrature_weights, Index<1>(quadrature_weights.size()));
+    }
+  }
 }
 
-template <size_t VolumeDim>
-const Matrix& ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_matrix(
+namespace {
+template <size_t VolumeDim, typename T>
+const T& retrieve_from_fit_cache(
+    const DirectionMap<VolumeDim, DirectionMap<VolumeDim, T>>& cached_values,
     const Direction<VolumeDim>& primary_direction,
-    const std::vector<Direction<VolumeDim>>& directions_to_exclude) const {
+    const std::vector<Direction<VolumeDim>>& directions_to_exclude) {
   if (LIKELY(directions_to_exclude.size() == 1)) {
-    return inverse_a_matrices.at(primary_direction)
-        .at(directions_to_exclude[0]);
+    return cached_values.at(primary_direction).at(directions_to_exclude[0]);
   } else if (directions_to_exclude.empty()) {
-    return inverse_a_matrices.at(primary_direction).at(primary_direction);
+    return cached_values.at(primary_direction).at(primary_direction);
   } else {
     ERROR(
-        "Cache misuse error: asked to retrieve a cached A^{-1} matrix for a\n"
+        "Cache misuse error: asked to retrieve cached A^{-1} terms for a\n"
         "configuration where multiple neighboring elements are excluded from\n"
         "the HWENO fit. Because this case is so rare, it is not handled by\n"
         "the cache. The caller should check for multiple neighbors being\n"
@@ -252,6 +264,24 @@ const Matrix& ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_matrix(
         "A^{-1} directly.");
   }
 }
+}  // namespace
+
+template <size_t VolumeDim>
+const Matrix& ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_matrix(
+    const Direction<VolumeDim>& primary_direction,
+    const std::vector<Direction<VolumeDim>>& directions_to_exclude) const {
+  return retrieve_from_fit_cache(inverse_a_matrices, primary_direction,
+                                 directions_to_exclude);
+}
+
+template <size_t VolumeDim>
+const DataVector&
+ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_times_quadrature_weights(
+    const Direction<VolumeDim>& primary_direction,
+    const std::vector<Direction<VolumeDim>>& directions_to_exclude) const {
+  return retrieve_from_fit_cache(inverse_a_times_quadrature_weights,
+                                 primary_direction, directions_to_exclude);
+}
 
 namespace {
 
@@ -28,6 +28,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
@@ -97,6 +98,11 @@ class ConstrainedFitCache {
       const Direction<VolumeDim>& primary_direction,
       const std::vector<Direction<VolumeDim>>& directions_to_exclude) const;
 
+  // A^{-1} w, with the same constraints on directions_to_exclude as above
+  const DataVector& retrieve_inverse_a_times_quadrature_weights(
+      const Direction<VolumeDim>& primary_direction,
+      const std::vector<Direction<VolumeDim>>& directions_to_exclude) const;
+
   DataVector quadrature_weights;
   DirectionMap<VolumeDim, Matrix> interpolation_matrices;
   DirectionMap<VolumeDim, DataVector>
@@ -110,6 +116,10 @@ class ConstrainedFitCache {
   // the data in the normally-nonsensical slot where
   // excluded_neighbor == primary_neighbor.
   DirectionMap<VolumeDim, DirectionMap<VolumeDim, Matrix>> inverse_a_matrices;
+  // The products A^{-1} w of each A^{-1} with the quadrature weights, which
+  // are needed by every fit. Stored in the same layout as inverse_a_matrices.
+  DirectionMap<VolumeDim, DirectionMap<VolumeDim, DataVector>>
+      inverse_a_times_quadrature_weights;
 };
 
 // Return the appropriate cache for the given mesh and element.
@@ -323,26 +333,44 @@ void solve_constrained_fit(
   const DirectionMap<VolumeDim, DataVector>& w_dot_interp_matrices =
       cache.quadrature_weights_dot_interpolation_matrices;
 
-  // Use cache if possible, or compute matrix if we are in edge case
+  // Use cache if possible, or compute the matrices if we are in the edge case.
+  // The cached terms are used by reference, so the common case does not copy
+  // or allocate any matrices.
+  const bool use_cache = LIKELY(directions_to_exclude.size() < 2);
+  Matrix uncached_inverse_a{};
+  DataVector uncached_inverse_a_times_w{};
+  if (UNLIKELY(not use_cache)) {
+    uncached_inverse_a = inverse_a_matrix(mesh, element, w, interp_matrices,
+                                          w_dot_interp_matrices,
+                                          primary_direction,
+                                          directions_to_exclude);
+    uncached_inverse_a_times_w = apply_matrices(
+        std::array<std::reference_wrapper<const Matrix>, 1>{
+            {uncached_inverse_a}},
+        w, Index<1>(w.size()));
+  }
   const Matrix& inverse_a =
-      LIKELY(directions_to_exclude.size() < 2)
-          ? cache.retrieve_inverse_a_matrix(primary_direction,
-                                            directions_to_exclude)
-          : inverse_a_matrix(mesh, element, w, interp_matrices,
-                             w_dot_interp_matrices, primary_direction,
-                             directions_to_exclude);
+      use_cache ? cache.retrieve_inverse_a_matrix(primary_direction,
+                                                  directions_to_exclude)
+                : uncached_inverse_a;
+  const DataVector& inverse_a_times_w =
+      use_cache ? cache.retrieve_inverse_a_times_quadrature_weights(
+                      primary_direction, directions_to_exclude)
+                : uncached_inverse_a_times_w;
 
   const DataVector b = b_vector<Tag>(tensor_index, mesh, w, interp_matrices,
                                      w_dot_interp_matrices, neighbor_data,
                                      primary_neighbor, neighbors_to_exclude);
 
+  // Compute A^{-1} b directly in the result buffer
   const size_t number_of_points = b.size();
-  const DataVector inverse_a_times_b = apply_matrices(
-      std::array<std::reference_wrapper<const Matrix>, 1>{{inverse_a}}, b,
-      Index<1>(number_of_points));
-  const DataVector inverse_a_times_w = apply_matrices(
-      std::array<std::reference_wrapper<const Matrix>, 1>{{inverse_a}}, w,
-      Index<1>(number_of_points));
+  if (constrained_fit_result->size() != number_of_points) {
+    constrained_fit_result->destructive_resize(number_of_points);
+  }
+  dgemv_('N', number_of_points, number_of_points, 1.0, inverse_a.data(),
+         inverse_a.spacing(), b.data(), 1, 0.0, constrained_fit_result->data(),
+         1);
+  const DataVector& inverse_a_times_b = *constrained_fit_result;
 
   // Compute Lagrange multiplier:
   // Note: we take w as an argument (instead of as a lambda capture), because
@@ -360,8 +388,7 @@ void solve_constrained_fit(
   }(w);
 
   // Compute solution:
-  *constrained_fit_result =
-      inverse_a_times_b + lagrange_multiplier * inverse_a_times_w;
+  *constrained_fit_result += lagrange_multiplier * inverse_a_times_w;
 }
 
 /*!
@@ -568,12 +595,12 @@ void hweno_impl(
 
   for (size_t tensor_index = 0; tensor_index < tensor->size(); ++tensor_index) {
     const auto& tensor_component = (*tensor)[tensor_index];
+    const double local_mean = mean_value(tensor_component, mesh);
     for (const auto& neighbor_and_data : neighbor_data) {
       const auto& primary_neighbor = neighbor_and_data.first;
       const auto neighbors_to_exclude =
           secondary_neighbors_to_exclude_from_fit<Tag>(
-              mean_value(tensor_component, mesh), tensor_index, neighbor_data,
-              primary_neighbor);
+              local_mean, tensor_index, neighbor_data, primary_neighbor);
 
       DataVector& buffer =
           modified_neighbor_solution_buffer->at(primary_neighbor);
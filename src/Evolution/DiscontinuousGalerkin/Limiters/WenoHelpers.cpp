@@ -7,8 +7,10 @@
 #include <cstddef>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Variables.hpp"    // IWYU pragma: keep
 #include "Domain/Structure/Direction.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/ElementId.hpp"  // IWYU pragma: keep
@@ -58,49 +60,39 @@ void reconstruct_from_weighted_sum(
   }
 #endif  // ifdef SPECTRE_DEBUG
 
-  // Store linear weights in `local_weights` and `neighbor_weights`
+  // Compute the unnormalized nonlinear weights from the linear weights. The
+  // neighbor weights are stored in the iteration order of
+  // `neighbor_polynomials`, and the oscillation indicators of all polynomials
+  // share a single buffer for their modal coefficients.
   // These weights will have to be generalized for multiple neighbors per
   // face for use with h-refinement and AMR.
-  double local_weight = 1.;
-  std::unordered_map<
-      std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, double,
-      boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
-      neighbor_weights;
-  for (const auto& kv : neighbor_polynomials) {
-    local_weight -= neighbor_linear_weight;
-    neighbor_weights[kv.first] = neighbor_linear_weight;
-  }
-
-  // Update `local_weights` and `neighbor_weights` to hold the unnormalized
-  // nonlinear weights.
-  local_weight = unnormalized_nonlinear_weight(
-      local_weight,
-      oscillation_indicator(derivative_weight, *local_polynomial, mesh));
-  for (const auto& kv : neighbor_polynomials) {
-    const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
-    neighbor_weights[key] = unnormalized_nonlinear_weight(
-        neighbor_weights[key],
-        oscillation_indicator(derivative_weight, neighbor_polynomial, mesh));
-  }
-
-  // Update `local_weights` and `neighbor_weights` to hold the normalized
-  // weights; these are the final weights of the WENO reconstruction.
+  ModalVector modal_coefficients_buffer(mesh.number_of_grid_points());
+  const double local_linear_weight =
+      1. - static_cast<double>(neighbor_polynomials.size()) *
+               neighbor_linear_weight;
+  const double local_weight = unnormalized_nonlinear_weight(
+      local_linear_weight,
+      oscillation_indicator(make_not_null(&modal_coefficients_buffer),
+                            derivative_weight, *local_polynomial, mesh));
   double normalization = local_weight;
-  for (const auto& kv : neighbor_weights) {
-    normalization += kv.second;
-  }
-  local_weight /= normalization;
-  for (auto& kv : neighbor_weights) {
-    kv.second /= normalization;
+  std::vector<double> neighbor_weights{};
+  neighbor_weights.reserve(neighbor_polynomials.size());
+  for (const auto& kv : neighbor_polynomials) {
+    neighbor_weights.push_back(unnormalized_nonlinear_weight(
+        neighbor_linear_weight,
+        oscillation_indicator(make_not_null(&modal_coefficients_buffer),
+                              derivative_weight, kv.second, mesh)));
+    normalization += neighbor_weights.back();
   }
 
-  // Perform reconstruction by combining the local and neighbor polynomials.
-  *local_polynomial *= local_weight;
+  // Perform reconstruction by combining the local and neighbor polynomials,
+  // using the normalized weights.
+  *local_polynomial *= local_weight / normalization;
+  size_t neighbor_index = 0;
   for (const auto& kv : neighbor_polynomials) {
-    const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
-    *local_polynomial += neighbor_weights.at(key) * neighbor_polynomial;
+    *local_polynomial +=
+        (neighbor_weights[neighbor_index] / normalization) * kv.second;
+    ++neighbor_index;
   }
 }
 
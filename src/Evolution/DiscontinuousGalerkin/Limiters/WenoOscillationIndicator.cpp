@@ -235,6 +235,16 @@ template <size_t VolumeDim>
 double oscillation_indicator(const DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh) {
+  ModalVector coeffs(mesh.number_of_grid_points());
+  return oscillation_indicator(make_not_null(&coeffs), derivative_weight, data,
+                               mesh);
+}
+
+template <size_t VolumeDim>
+double oscillation_indicator(
+    const gsl::not_null<ModalVector*> modal_coefficients_buffer,
+    const DerivativeWeight derivative_weight, const DataVector& data,
+    const Mesh<VolumeDim>& mesh) {
   ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
          "Unsupported basis: " << mesh);
   ASSERT(mesh.quadrature() ==
@@ -249,7 +259,8 @@ double oscillation_indicator(const DerivativeWeight derivative_weight,
 
   const Matrix& indicator_matrix = cached_indicator_matrix_from_mesh_index(
       derivative_weight, mesh.extents());
-  const ModalVector coeffs = to_modal_coefficients(data, mesh);
+  to_modal_coefficients(modal_coefficients_buffer, data, mesh);
+  const ModalVector& coeffs = *modal_coefficients_buffer;
 
   double result = 0.;
   // Note: because the 0'th modal coefficient encodes the mean of the data and
@@ -257,10 +268,16 @@ double oscillation_indicator(const DerivativeWeight derivative_weight,
   // sum and start summing at m == 1, n == 1. Note also that the indicator
   // matrix is computed excluding the m == 0, n == 0 elements, so the indexing
   // is offset by 1.
-  for (size_t m = 1; m < mesh.number_of_grid_points(); ++m) {
-    for (size_t n = 1; n < mesh.number_of_grid_points(); ++n) {
-      result += coeffs[m] * coeffs[n] * indicator_matrix(m - 1, n - 1);
+  //
+  // The indicator matrix is symmetric, so we sum only over its lower triangle
+  // (going down the contiguous columns) and double the off-diagonal terms.
+  for (size_t n = 1; n < mesh.number_of_grid_points(); ++n) {
+    double column_sum = 0.;
+    for (size_t m = n + 1; m < mesh.number_of_grid_points(); ++m) {
+      column_sum += coeffs[m] * indicator_matrix(m - 1, n - 1);
     }
+    result += coeffs[n] * (coeffs[n] * indicator_matrix(n - 1, n - 1) +
+                           2. * column_sum);
   }
   return result;
 }
@@ -268,9 +285,12 @@ double oscillation_indicator(const DerivativeWeight derivative_weight,
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                        \
-  template double oscillation_indicator<DIM(data)>( \
-      DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&);
+#define INSTANTIATE(_, data)                                            \
+  template double oscillation_indicator<DIM(data)>(                     \
+      DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&);     \
+  template double oscillation_indicator<DIM(data)>(                     \
+      gsl::not_null<ModalVector*>, DerivativeWeight, const DataVector&, \
+      const Mesh<DIM(data)>&);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
@@ -6,10 +6,13 @@
 #include <cstddef>
 #include <ostream>
 
+#include "Utilities/Gsl.hpp"
+
 /// \cond
 class DataVector;
 template <size_t>
 class Mesh;
+class ModalVector;
 /// \endcond
 
 namespace Limiters::Weno_detail {
@@ -42,4 +45,15 @@ double oscillation_indicator(DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh);
 
+// Compute the WENO oscillation indicator, as above, using
+// `modal_coefficients_buffer` to hold the modal coefficients of `data`. This
+// avoids allocating when computing the indicators of many DataVectors on the
+// same mesh, e.g., of the local and neighbor polynomials of a WENO
+// reconstruction.
+template <size_t VolumeDim>
+double oscillation_indicator(
+    gsl::not_null<ModalVector*> modal_coefficients_buffer,
+    DerivativeWeight derivative_weight, const DataVector& data,
+    const Mesh<VolumeDim>& mesh);
+
 }  // namespace Limiters::Weno_detail
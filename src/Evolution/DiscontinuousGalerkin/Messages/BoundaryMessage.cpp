@@ -3,14 +3,205 @@
 
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <ios>
+#include <memory>
+#include <new>
 #include <pup.h>
 
+#include "Evolution/DiscontinuousGalerkin/Messages/NodeLocalBoundaryBuffer.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
 
 namespace evolution::dg {
+namespace {
+// The data of a packed message is stored directly after the `dg_flux_data`
+// pointer.
+template <size_t Dim>
+double* data_after_message(BoundaryMessage<Dim>* message) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return reinterpret_cast<double*>(std::addressof(message->dg_flux_data))
+         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         + 1;
+}
+
+uint64_t bits_of(const double value) {
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(double));
+  return bits;
+}
+
+size_t leading_zero_bytes(const uint64_t bits) {
+  size_t result = 0;
+  while (result < sizeof(uint64_t) and
+         ((bits >> (8 * (sizeof(uint64_t) - 1 - result))) & 0xff) == 0) {
+    ++result;
+  }
+  return result;
+}
+
+// The lossless encoding of `size` values stores the number of leading zero
+// bytes of each XOR difference in one nibble, followed by the remaining bytes
+// of all differences, least significant first.
+size_t lossless_encoded_bytes(const double* const data, const size_t size) {
+  size_t bytes = (size + 1) / 2;
+  uint64_t previous = 0;
+  for (size_t i = 0; i < size; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const uint64_t bits = bits_of(data[i]);
+    bytes += sizeof(uint64_t) - leading_zero_bytes(bits ^ previous);
+    previous = bits;
+  }
+  return bytes;
+}
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+char* encode_lossless(char* const out, const double* const data,
+                      const size_t size) {
+  char* const counts = out;
+  std::fill(counts, counts + (size + 1) / 2, '\0');
+  char* bytes = counts + (size + 1) / 2;
+  uint64_t previous = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const uint64_t bits = bits_of(data[i]);
+    const uint64_t difference = bits ^ previous;
+    previous = bits;
+    const size_t zero_bytes = leading_zero_bytes(difference);
+    counts[i / 2] =
+        static_cast<char>(static_cast<unsigned char>(counts[i / 2]) |
+                          (zero_bytes << (4 * (i % 2))));
+    for (size_t j = 0; j < sizeof(uint64_t) - zero_bytes; ++j) {
+      *bytes = static_cast<char>((difference >> (8 * j)) & 0xff);
+      ++bytes;
+    }
+  }
+  return bytes;
+}
+
+const char* decode_lossless(double* const data, const char* const in,
+                            const size_t size) {
+  const char* const counts = in;
+  const char* bytes = counts + (size + 1) / 2;
+  uint64_t previous = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const size_t zero_bytes =
+        (static_cast<unsigned char>(counts[i / 2]) >> (4 * (i % 2))) & 0xf;
+    uint64_t difference = 0;
+    for (size_t j = 0; j < sizeof(uint64_t) - zero_bytes; ++j) {
+      difference |= static_cast<uint64_t>(static_cast<unsigned char>(*bytes))
+                    << (8 * j);
+      ++bytes;
+    }
+    previous ^= difference;
+    std::memcpy(&data[i], &previous, sizeof(double));
+  }
+  return bytes;
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+// The number of bytes of the encoded data, or zero if the data is sent as
+// doubles.
+template <size_t Dim>
+size_t bytes_of_encoded_data(const BoundaryMessage<Dim>& message) {
+  const size_t subcell_size = message.subcell_ghost_data_size;
+  const size_t dg_size = message.dg_flux_data_size;
+  size_t bytes = 0;
+  switch (message.encoding) {
+    case BoundaryMessageEncoding::Double:
+      return 0;
+    case BoundaryMessageEncoding::Float:
+      bytes = subcell_size * sizeof(double) + dg_size * sizeof(float);
+      break;
+    case BoundaryMessageEncoding::Lossless:
+      bytes =
+          lossless_encoded_bytes(message.subcell_ghost_data, subcell_size) +
+          lossless_encoded_bytes(message.dg_flux_data, dg_size);
+      break;
+    default:
+      ERROR("Unknown BoundaryMessageEncoding " << message.encoding);
+  }
+  return bytes < (subcell_size + dg_size) * sizeof(double) ? bytes : 0;
+}
+
+template <size_t Dim>
+void encode_data(const gsl::not_null<BoundaryMessage<Dim>*> out_msg,
+                 const BoundaryMessage<Dim>& in_msg) {
+  const size_t subcell_size = in_msg.subcell_ghost_data_size;
+  const size_t dg_size = in_msg.dg_flux_data_size;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto* out = reinterpret_cast<char*>(data_after_message(out_msg.get()));
+  if (in_msg.encoding == BoundaryMessageEncoding::Float) {
+    if (subcell_size != 0) {
+      std::memcpy(out, in_msg.subcell_ghost_data,
+                  subcell_size * sizeof(double));
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    out += subcell_size * sizeof(double);
+    for (size_t i = 0; i < dg_size; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto value = static_cast<float>(in_msg.dg_flux_data[i]);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(out + i * sizeof(float), &value, sizeof(float));
+    }
+  } else {
+    ASSERT(in_msg.encoding == BoundaryMessageEncoding::Lossless,
+           "Unexpected encoding " << in_msg.encoding);
+    out = encode_lossless(out, in_msg.subcell_ghost_data, subcell_size);
+    encode_lossless(out, in_msg.dg_flux_data, dg_size);
+  }
+}
+
+template <size_t Dim>
+void decode_data(const gsl::not_null<BoundaryMessage<Dim>*> out_msg,
+                 BoundaryMessage<Dim>* in_msg) {
+  const size_t subcell_size = in_msg->subcell_ghost_data_size;
+  const size_t dg_size = in_msg->dg_flux_data_size;
+  double* const out = data_after_message(out_msg.get());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  const auto* in = reinterpret_cast<const char*>(data_after_message(in_msg));
+  if (in_msg->encoding == BoundaryMessageEncoding::Float) {
+    if (subcell_size != 0) {
+      std::memcpy(out, in, subcell_size * sizeof(double));
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    in += subcell_size * sizeof(double);
+    for (size_t i = 0; i < dg_size; ++i) {
+      float value = 0.0f;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::memcpy(&value, in + i * sizeof(float), sizeof(float));
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      out[subcell_size + i] = static_cast<double>(value);
+    }
+  } else {
+    ASSERT(in_msg->encoding == BoundaryMessageEncoding::Lossless,
+           "Unexpected encoding " << in_msg->encoding);
+    in = decode_lossless(out, in, subcell_size);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    decode_lossless(out + subcell_size, in, dg_size);
+  }
+}
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os,
+                         const BoundaryMessageEncoding encoding) {
+  switch (encoding) {
+    case BoundaryMessageEncoding::Double:
+      return os << "Double";
+    case BoundaryMessageEncoding::Float:
+      return os << "Float";
+    case BoundaryMessageEncoding::Lossless:
+      return os << "Lossless";
+    default:
+      ERROR("Unknown BoundaryMessageEncoding");
+  }
+}
+
 template <size_t Dim>
 BoundaryMessage<Dim>::BoundaryMessage(
     const size_t subcell_ghost_data_size_in, const size_t dg_flux_data_size_in,
@@ -22,7 +213,8 @@ BoundaryMessage<Dim>::BoundaryMessage(
     const ElementId<Dim>& element_id_in,
     const Mesh<Dim>& volume_or_ghost_mesh_in,
     const Mesh<Dim - 1>& interface_mesh_in, double* subcell_ghost_data_in,
-    double* dg_flux_data_in)
+    double* dg_flux_data_in, detail::NodeLocalBufferSlot* node_local_slot_in,
+    const size_t node_local_version_in)
     : subcell_ghost_data_size(subcell_ghost_data_size_in),
       dg_flux_data_size(dg_flux_data_size_in),
       owning(owning_in),
@@ -36,8 +228,72 @@ BoundaryMessage<Dim>::BoundaryMessage(
       element_id(element_id_in),
       volume_or_ghost_mesh(volume_or_ghost_mesh_in),
       interface_mesh(interface_mesh_in),
+      node_local_slot(node_local_slot_in),
+      node_local_version(node_local_version_in),
       subcell_ghost_data(subcell_ghost_data_in),
-      dg_flux_data(dg_flux_data_in) {}
+      dg_flux_data(dg_flux_data_in) {
+  ASSERT(node_local_slot == nullptr or not owning,
+         "An owning BoundaryMessage cannot point into a "
+         "NodeLocalBoundaryBuffer.");
+}
+
+template <size_t Dim>
+BoundaryMessage<Dim>::~BoundaryMessage() {
+  release_node_local_data();
+}
+
+template <size_t Dim>
+bool BoundaryMessage<Dim>::node_local_data_is_current() const {
+  return node_local_slot == nullptr or
+         node_local_slot->version.load(std::memory_order_acquire) ==
+             node_local_version;
+}
+
+template <size_t Dim>
+void BoundaryMessage<Dim>::release_node_local_data() {
+  if (node_local_slot != nullptr) {
+    ASSERT(node_local_data_is_current(),
+           "The node-local boundary data was overwritten before the message "
+           "released it.");
+    // Release so that our reads of the data happen before the sender reuses
+    // the memory.
+    node_local_slot->number_of_readers.fetch_sub(1, std::memory_order_release);
+    node_local_slot = nullptr;
+  }
+}
+
+template <size_t Dim>
+BoundaryMessage<Dim>* BoundaryMessage<Dim>::allocate(
+    const size_t subcell_ghost_data_size_in, const size_t dg_flux_data_size_in,
+    const bool enable_if_disabled_in, const size_t sender_node_in,
+    const size_t sender_core_in, const int tci_status_in,
+    const ::TimeStepId& current_time_step_id_in,
+    const ::TimeStepId& next_time_step_id_in,
+    const Direction<Dim>& neighbor_direction_in,
+    const ElementId<Dim>& element_id_in,
+    const Mesh<Dim>& volume_or_ghost_mesh_in,
+    const Mesh<Dim - 1>& interface_mesh_in) {
+  // Allocate through Charm++ so the message can be sent and freed like any
+  // other message, but with the data appended as in a packed message
+  void* buffer = base::operator new(total_bytes_with_data(
+      subcell_ghost_data_size_in, dg_flux_data_size_in));
+  auto* message = ::new (buffer) BoundaryMessage<Dim>(
+      subcell_ghost_data_size_in, dg_flux_data_size_in, true,
+      enable_if_disabled_in, sender_node_in, sender_core_in, tci_status_in,
+      current_time_step_id_in, next_time_step_id_in, neighbor_direction_in,
+      element_id_in, volume_or_ghost_mesh_in, interface_mesh_in, nullptr,
+      nullptr);
+  if (subcell_ghost_data_size_in != 0) {
+    message->subcell_ghost_data = data_after_message(message);
+  }
+  if (dg_flux_data_size_in != 0) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    message->dg_flux_data =
+        data_after_message(message) + subcell_ghost_data_size_in;
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+  return message;
+}
 
 template <size_t Dim>
 size_t BoundaryMessage<Dim>::total_bytes_with_data(const size_t subcell_size,
@@ -47,6 +303,14 @@ size_t BoundaryMessage<Dim>::total_bytes_with_data(const size_t subcell_size,
   return totalsize;
 }
 
+template <size_t Dim>
+size_t BoundaryMessage<Dim>::packed_bytes() const {
+  const size_t encoded_bytes = owning ? 0 : bytes_of_encoded_data(*this);
+  return encoded_bytes == 0
+             ? total_bytes_with_data(subcell_ghost_data_size, dg_flux_data_size)
+             : sizeof(BoundaryMessage<Dim>) + encoded_bytes;
+}
+
 template <size_t Dim>
 void* BoundaryMessage<Dim>::pack(BoundaryMessage<Dim>* in_msg) {
   // If this is the case, then in_msg is already in the correct memory layout
@@ -59,7 +323,10 @@ void* BoundaryMessage<Dim>::pack(BoundaryMessage<Dim>* in_msg) {
   const size_t subcell_size = in_msg->subcell_ghost_data_size;
   const size_t dg_size = in_msg->dg_flux_data_size;
 
-  const size_t totalsize = total_bytes_with_data(subcell_size, dg_size);
+  const size_t encoded_bytes = bytes_of_encoded_data(*in_msg);
+  const size_t totalsize =
+      encoded_bytes == 0 ? total_bytes_with_data(subcell_size, dg_size)
+                         : sizeof(BoundaryMessage<Dim>) + encoded_bytes;
 
   // The fact that we call the pack() function means we are sending data across
   // address boundaries (nodes) which means we will be owning the data the
@@ -74,8 +341,17 @@ void* BoundaryMessage<Dim>::pack(BoundaryMessage<Dim>* in_msg) {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   memcpy(reinterpret_cast<char*>(out_msg), &in_msg->subcell_ghost_data_size,
          sizeof(BoundaryMessage<Dim>));
+  // The packed message owns a copy of the data, so it must not release the
+  // sender's node-local data a second time.
+  out_msg->node_local_slot = nullptr;
+  out_msg->encoded_data_bytes = encoded_bytes;
 
-  if (subcell_size != 0) {
+  if (encoded_bytes != 0) {
+    // The data pointers are set when the data is decoded in unpack()
+    encode_data(make_not_null(out_msg), *in_msg);
+    out_msg->subcell_ghost_data = nullptr;
+    out_msg->dg_flux_data = nullptr;
+  } else if (subcell_size != 0) {
     // double* + 1 == char* + 8 because double* is 8 bytes
     // Place subcell data right after dg pointer
     out_msg->subcell_ghost_data =
@@ -86,7 +362,7 @@ void* BoundaryMessage<Dim>::pack(BoundaryMessage<Dim>* in_msg) {
     memcpy(out_msg->subcell_ghost_data, in_msg->subcell_ghost_data,
            subcell_size * sizeof(double));
   }
-  if (dg_size != 0) {
+  if (encoded_bytes == 0 and dg_size != 0) {
     // Place dg data right after subcell data
     out_msg->dg_flux_data =
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -97,12 +373,10 @@ void* BoundaryMessage<Dim>::pack(BoundaryMessage<Dim>* in_msg) {
            dg_size * sizeof(double));
   }
 
-  // Gotta clean up
-  // A possible future optimization is if we know we have to send to another
-  // node that we define a BoundaryMessage::allocate function to immediately
-  // allocate a message of the right size. This will reduce the number of memory
-  // allocations when sending data internode from 3 (2 on send 1 on receive) to
-  // 2 (1 on send and 1 on receive).
+  // Gotta clean up. Messages created with `BoundaryMessage::allocate` are
+  // owning and skip this copy and the extra allocation.
+  // Deleting the original message releases the node-local data, if any, since
+  // it has been copied.
   delete in_msg;  // NOLINT
   return static_cast<void*>(out_msg);
 }
@@ -119,6 +393,22 @@ BoundaryMessage<Dim>* BoundaryMessage<Dim>::unpack(void* in_buf) {
   const size_t subcell_size = buffer->subcell_ghost_data_size;
   const size_t dg_size = buffer->dg_flux_data_size;
 
+  if (buffer->encoded_data_bytes != 0) {
+    // Encoded data has to be decoded into a buffer that is large enough to
+    // hold it in double precision.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* decoded_msg = reinterpret_cast<BoundaryMessage<Dim>*>(CkAllocBuffer(
+        in_buf,
+        static_cast<int>(total_bytes_with_data(subcell_size, dg_size))));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    memcpy(reinterpret_cast<char*>(decoded_msg), in_buf,
+           sizeof(BoundaryMessage<Dim>));
+    decoded_msg->encoded_data_bytes = 0;
+    decode_data(make_not_null(decoded_msg), buffer);
+    CkFreeMsg(in_buf);
+    buffer = decoded_msg;
+  }
+
   if (subcell_size != 0) {
     // double* + 1 == char* + 8 because double* is 8 bytes
     // Subcell data is located right after dg pointer
@@ -141,8 +431,9 @@ BoundaryMessage<Dim>* BoundaryMessage<Dim>::unpack(void* in_buf) {
     buffer->dg_flux_data = nullptr;
   }
 
-  // We don't delete in_buf here because it is actually the data we want. We
-  // didn't do any new allocations/memcpy's so no need to clean up
+  // We don't delete the buffer here because it is actually the data we want.
+  // Unless the data was encoded, we didn't do any new allocations/memcpy's so
+  // no need to clean up
   return buffer;
 }
 
@@ -162,6 +453,7 @@ bool operator==(const BoundaryMessage<Dim>& lhs,
          lhs.element_id == rhs.element_id and
          lhs.volume_or_ghost_mesh == rhs.volume_or_ghost_mesh and
          lhs.interface_mesh == rhs.interface_mesh and
+         lhs.encoding == rhs.encoding and
          // We are guaranteed that lhs.subcell_size == rhs.subcell_size and
          // lhs.dg_size == rhs.dg_size at this point so it's safe to loop over
          // everything
@@ -199,6 +491,7 @@ std::ostream& operator<<(std::ostream& os,
   os << "element_id = " << message.element_id << "\n";
   os << "volume_or_ghost_mesh = " << message.volume_or_ghost_mesh << "\n";
   os << "interface_mesh = " << message.interface_mesh << "\n";
+  os << "encoding = " << message.encoding << "\n";
 
   os << "subcell_ghost_data = (";
   if (message.subcell_ghost_data_size > 0) {
@@ -16,7 +16,34 @@
 
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.decl.h"
 
+/// \cond
+namespace evolution::dg::detail {
+struct NodeLocalBufferSlot;
+}  // namespace evolution::dg::detail
+/// \endcond
+
 namespace evolution::dg {
+/*!
+ * \brief How the data of a `BoundaryMessage` is encoded when it is sent to
+ * another node.
+ *
+ * - `Double`: the data is sent unchanged.
+ * - `Float`: the DG mortar data is rounded to single precision, halving its
+ *   size. The subcell ghost data is sent unchanged, since it carries the data
+ *   for the RDMP TCI. Use `send_ghost_data_as_float` in the
+ *   `Metavariables::SubcellOptions` to reduce the precision of the ghost zones.
+ * - `Lossless`: every value is XORed with the previous one and only the
+ *   trailing non-zero bytes of the result are sent, together with a 4-bit count
+ *   of the dropped leading zero bytes. Smooth data shares the sign, exponent,
+ *   and leading mantissa bits of its neighbors, so this saves a number of
+ *   bytes (roughly 10% for a well-resolved sine wave) for the cost of one cheap
+ *   pass over the data without losing any precision. If the data does not
+ *   compress it is sent unchanged.
+ */
+enum class BoundaryMessageEncoding { Double, Float, Lossless };
+
+std::ostream& operator<<(std::ostream& os, BoundaryMessageEncoding encoding);
+
 /*!
  * \brief [Charm++ Message]
  * (https://charm.readthedocs.io/en/latest/charm%2B%2B/manual.html#messages)
@@ -26,6 +53,21 @@ namespace evolution::dg {
  *
  * If this message is to be sent across nodes, the `pack()` and `unpack()`
  * methods will be called on the sending and receiving node, respectively.
+ *
+ * Messages between elements on the same node are not packed, so a non-owning
+ * message is read directly from the memory of the sender. If that memory was
+ * obtained from a `NodeLocalBoundaryBuffer`, pass the `slot` and `version` of
+ * the `NodeLocalBoundaryBuffer::Handle` to the constructor. The message then
+ * keeps the memory from being reused until it is destroyed or packed.
+ *
+ * The sender chooses how the data is encoded on the wire by setting `encoding`
+ * (see `BoundaryMessageEncoding`). The encoding only affects messages that are
+ * packed, i.e. sent to a different node, while node-local messages are always
+ * read in double precision. Every packed message records its own encoding and
+ * is decoded in `unpack()`, so neighbors need no agreement beforehand and each
+ * element may choose the encoding per message, e.g. based on whether the
+ * recipient is on a different node (`sender_node`) or on the accuracy
+ * required. Messages that are already `owning` are sent as they are.
  */
 template <size_t Dim>
 struct BoundaryMessage : public CMessage_BoundaryMessage<Dim> {
@@ -52,6 +94,18 @@ struct BoundaryMessage : public CMessage_BoundaryMessage<Dim> {
   Mesh<Dim> volume_or_ghost_mesh;
   Mesh<Dim - 1> interface_mesh;
 
+  // The slot of the sender's NodeLocalBoundaryBuffer that the data pointers
+  // point into, or nullptr. These must come before the data pointers because
+  // the data is stored directly after `dg_flux_data` in owning messages.
+  detail::NodeLocalBufferSlot* node_local_slot = nullptr;
+  size_t node_local_version = 0;
+
+  // How the data is encoded when the message is packed.
+  BoundaryMessageEncoding encoding = BoundaryMessageEncoding::Double;
+  // The number of bytes of encoded data following the message while it is in
+  // flight, or zero if the data is stored as doubles.
+  size_t encoded_data_bytes = 0;
+
   // If set to nullptr then we aren't sending that type of data.
   double* subcell_ghost_data;
   double* dg_flux_data;
@@ -68,7 +122,51 @@ struct BoundaryMessage : public CMessage_BoundaryMessage<Dim> {
                   const ElementId<Dim>& element_id_in,
                   const Mesh<Dim>& volume_or_ghost_mesh_in,
                   const Mesh<Dim - 1>& interface_mesh_in,
-                  double* subcell_ghost_data_in, double* dg_flux_data_in);
+                  double* subcell_ghost_data_in, double* dg_flux_data_in,
+                  detail::NodeLocalBufferSlot* node_local_slot_in = nullptr,
+                  size_t node_local_version_in = 0);
+
+  /*!
+   * \brief Allocate an owning message with room for the data directly after
+   * the message.
+   *
+   * The sender writes the data through the `subcell_ghost_data` and
+   * `dg_flux_data` pointers of the returned message, which point into the same
+   * buffer as the message itself. Since the message is already owning,
+   * `pack()` sends the buffer as it is and `unpack()` only sets the pointers,
+   * so the data is neither copied into nor out of the Charm++ message, and the
+   * receiver keeps the buffer as the storage of the data. Use this instead of a
+   * non-owning message when the data would otherwise be assembled in a
+   * temporary buffer that is copied into the message.
+   */
+  static BoundaryMessage* allocate(
+      size_t subcell_ghost_data_size_in, size_t dg_flux_data_size_in,
+      bool enable_if_disabled_in, size_t sender_node_in, size_t sender_core_in,
+      int tci_status_in, const ::TimeStepId& current_time_step_id_in,
+      const ::TimeStepId& next_time_step_id_in,
+      const Direction<Dim>& neighbor_direction_in,
+      const ElementId<Dim>& element_id_in,
+      const Mesh<Dim>& volume_or_ghost_mesh_in,
+      const Mesh<Dim - 1>& interface_mesh_in);
+
+  BoundaryMessage(const BoundaryMessage&) = delete;
+  BoundaryMessage& operator=(const BoundaryMessage&) = delete;
+  BoundaryMessage(BoundaryMessage&&) = delete;
+  BoundaryMessage& operator=(BoundaryMessage&&) = delete;
+  /// Releases the node-local data, if any.
+  ~BoundaryMessage();
+
+  /// \brief Whether the node-local data this message points to has not been
+  /// handed out again by the sender's `NodeLocalBoundaryBuffer`.
+  ///
+  /// Always `true` for messages that do not point into a
+  /// `NodeLocalBoundaryBuffer`.
+  bool node_local_data_is_current() const;
+
+  /// Stop referring to the sender's `NodeLocalBoundaryBuffer` so that it may
+  /// reuse the memory. The data must not be accessed afterwards unless the
+  /// message is `owning`.
+  void release_node_local_data();
 
   /*!
    * \brief This is the size (in bytes) necessary to allocate a BoundaryMessage
@@ -80,6 +178,10 @@ struct BoundaryMessage : public CMessage_BoundaryMessage<Dim> {
   static size_t total_bytes_with_data(const size_t subcell_size,
                                       const size_t dg_size);
 
+  /// The size (in bytes) of the message when it is packed, including the data
+  /// encoded according to `encoding`.
+  size_t packed_bytes() const;
+
   static void* pack(BoundaryMessage*);
   static BoundaryMessage* unpack(void*);
 };
@@ -0,0 +1,68 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/Messages/NodeLocalBoundaryBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <pup.h>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg {
+NodeLocalBoundaryBuffer::~NodeLocalBoundaryBuffer() {
+  ASSERT(number_of_slots_in_use() == 0,
+         "Destroying a NodeLocalBoundaryBuffer while "
+             << number_of_slots_in_use()
+             << " of its slots are still referred to by BoundaryMessages.");
+}
+
+NodeLocalBoundaryBuffer::Handle NodeLocalBoundaryBuffer::acquire(
+    const size_t size, const size_t number_of_readers) {
+  ASSERT(number_of_readers > 0,
+         "Acquiring node-local boundary data without any readers.");
+  auto slot_it = std::find_if(
+      slots_.begin(), slots_.end(), [](const auto& slot) {
+        // Acquire so that the reads of the last readers happen before we
+        // overwrite the data.
+        return slot->number_of_readers.load(std::memory_order_acquire) == 0;
+      });
+  if (slot_it == slots_.end()) {
+    slots_.push_back(std::make_unique<detail::NodeLocalBufferSlot>());
+    slot_it = std::prev(slots_.end());
+  }
+  detail::NodeLocalBufferSlot& slot = **slot_it;
+  // Only grows the allocation, so the memory is reused once the sizes of the
+  // messages are stable.
+  if (slot.data.size() < size) {
+    slot.data.resize(size);
+  }
+  slot.number_of_readers.store(number_of_readers, std::memory_order_relaxed);
+  // Release so that a reader that sees the new version also sees the new
+  // reader count.
+  const size_t version =
+      slot.version.fetch_add(1, std::memory_order_release) + 1;
+  return {gsl::make_span(slot.data.data(), size), &slot, version};
+}
+
+size_t NodeLocalBoundaryBuffer::number_of_slots_in_use() const {
+  return static_cast<size_t>(
+      std::count_if(slots_.begin(), slots_.end(), [](const auto& slot) {
+        return slot->number_of_readers.load(std::memory_order_acquire) != 0;
+      }));
+}
+
+void NodeLocalBoundaryBuffer::pup(PUP::er& p) {
+  ASSERT(number_of_slots_in_use() == 0,
+         "Cannot serialize a NodeLocalBoundaryBuffer while "
+             << number_of_slots_in_use()
+             << " of its slots are still referred to by BoundaryMessages.");
+  if (p.isUnpacking()) {
+    slots_.clear();
+  }
+}
+}  // namespace evolution::dg
@@ -0,0 +1,89 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace evolution::dg {
+namespace detail {
+// A block of memory that is read in place by the recipients of
+// `BoundaryMessage`s on the same node.
+struct NodeLocalBufferSlot {
+  std::vector<double> data{};
+  // Number of messages that still point into `data`. The slot may only be
+  // reused once this is zero.
+  std::atomic<size_t> number_of_readers{0};
+  // Incremented every time the slot is handed out so that a message can check
+  // that the data it points to has not been overwritten.
+  std::atomic<size_t> version{0};
+};
+}  // namespace detail
+
+/*!
+ * \brief Memory for boundary data that is sent to elements on the same node
+ * without being copied.
+ *
+ * A `BoundaryMessage` that is not `owning` only stores pointers to the data of
+ * the sender, and Charm++ does not copy (`pack()`) messages delivered within
+ * the same node. That is only safe if the sender does not modify or free the
+ * data before the receiver is done with it. This class provides that
+ * guarantee: `acquire()` returns memory together with the `slot` and
+ * `version` that are passed to the `BoundaryMessage` constructor, and the
+ * memory is not handed out again until every message referring to it has been
+ * destroyed or packed for sending to another node. Receivers can check that
+ * the data is still the version that was sent with
+ * `BoundaryMessage::node_local_data_is_current()`.
+ *
+ * The memory of released slots is reused, so in steady state no allocations
+ * are done. The buffer must outlive all messages referring to it, and cannot be
+ * serialized while any message is in flight.
+ */
+class NodeLocalBoundaryBuffer {
+ public:
+  struct Handle {
+    gsl::span<double> data;
+    detail::NodeLocalBufferSlot* slot;
+    size_t version;
+  };
+
+  NodeLocalBoundaryBuffer() = default;
+  NodeLocalBoundaryBuffer(const NodeLocalBoundaryBuffer&) = delete;
+  NodeLocalBoundaryBuffer& operator=(const NodeLocalBoundaryBuffer&) = delete;
+  NodeLocalBoundaryBuffer(NodeLocalBoundaryBuffer&&) = default;
+  NodeLocalBoundaryBuffer& operator=(NodeLocalBoundaryBuffer&&) = default;
+  ~NodeLocalBoundaryBuffer();
+
+  /// \brief Memory for `size` doubles that will be read by
+  /// `number_of_readers` messages.
+  ///
+  /// Each of the messages releases one reader when it is destroyed or packed.
+  Handle acquire(size_t size, size_t number_of_readers);
+
+  /// The number of slots that have been allocated
+  size_t number_of_slots() const { return slots_.size(); }
+
+  /// The number of slots that are still referred to by messages
+  size_t number_of_slots_in_use() const;
+
+  /// Only the fact that the buffer exists is serialized, the memory is
+  /// reallocated as needed.
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  // The slots are stored by pointer so that their addresses are stable.
+  std::vector<std::unique_ptr<detail::NodeLocalBufferSlot>> slots_{};
+};
+}  // namespace evolution::dg
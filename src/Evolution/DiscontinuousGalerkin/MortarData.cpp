@@ -3,7 +3,10 @@
 
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <initializer_list>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <pup.h>
@@ -18,9 +21,75 @@
 #include "Time/TimeStepId.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 
 namespace evolution::dg {
+namespace {
+// Whether `buffer` holds the concatenation of the `parts`
+bool holds(const std::shared_ptr<const DataVector>& buffer,
+           const std::initializer_list<const DataVector*> parts) {
+  if (buffer == nullptr) {
+    return false;
+  }
+  size_t size = 0;
+  for (const DataVector* part : parts) {
+    size += part->size();
+  }
+  if (buffer->size() != size) {
+    return false;
+  }
+  const double* position = buffer->data();
+  for (const DataVector* part : parts) {
+    if (not std::equal(part->begin(), part->end(), position)) {
+      return false;
+    }
+    position += part->size();
+  }
+  return true;
+}
+
+std::shared_ptr<const DataVector> concatenate(
+    const std::initializer_list<const DataVector*> parts) {
+  size_t size = 0;
+  for (const DataVector* part : parts) {
+    size += part->size();
+  }
+  auto result = std::make_shared<DataVector>(size);
+  double* position = result->data();
+  for (const DataVector* part : parts) {
+    position = std::copy(part->begin(), part->end(), position);
+  }
+  return result;
+}
+
+bool equal_contents(const std::shared_ptr<const DataVector>& lhs,
+                    const std::shared_ptr<const DataVector>& rhs) {
+  if (lhs == nullptr or rhs == nullptr) {
+    return lhs == rhs;
+  }
+  return *lhs == *rhs;
+}
+
+void pup_shared(PUP::er& p,  // NOLINT(google-runtime-references)
+                const gsl::not_null<std::shared_ptr<const DataVector>*> data) {
+  bool has_data = *data != nullptr;
+  p | has_data;
+  if (not has_data) {
+    data->reset();
+    return;
+  }
+  if (p.isUnpacking()) {
+    DataVector unpacked{};
+    p | unpacked;
+    *data = std::make_shared<const DataVector>(std::move(unpacked));
+  } else {
+    // Packing and sizing only read the data
+    p | const_cast<DataVector&>(**data);  // NOLINT
+  }
+}
+}  // namespace
+
 template <size_t Dim>
 MortarData<Dim>::MortarData(const size_t number_of_buffers)
     : number_of_buffers_(number_of_buffers) {
@@ -76,7 +145,8 @@ template <size_t Dim>
 void MortarData<Dim>::insert_local_geometric_quantities(
     const Scalar<DataVector>& local_volume_det_inv_jacobian,
     const Scalar<DataVector>& local_face_det_jacobian,
-    const Scalar<DataVector>& local_face_normal_magnitude) {
+    const Scalar<DataVector>& local_face_normal_magnitude,
+    const std::initializer_list<const MortarData*> reuse_candidates) {
   ASSERT(local_mortar_data_[mortar_index_].has_value(),
          "Must set local mortar data before setting the geometric quantities.");
   ASSERT(local_face_det_jacobian[0].size() ==
@@ -99,28 +169,40 @@ void MortarData<Dim>::insert_local_geometric_quantities(
          "Jacobian determinant cannot be inserted because the only the face "
          "normal is being used.");
   using_volume_and_face_jacobians_ = true;
-  const size_t required_storage_size = local_volume_det_inv_jacobian[0].size() +
-                                       2 * local_face_det_jacobian[0].size();
-  local_geometric_quantities_.destructive_resize(required_storage_size);
 
-  std::copy(local_volume_det_inv_jacobian[0].begin(),
-            local_volume_det_inv_jacobian[0].end(),
-            local_geometric_quantities_.begin());
-  std::copy(
-      local_face_det_jacobian[0].begin(), local_face_det_jacobian[0].end(),
-      local_geometric_quantities_.begin() +
-          static_cast<std::ptrdiff_t>(local_volume_det_inv_jacobian[0].size()));
-  std::copy(
-      local_face_normal_magnitude[0].begin(),
-      local_face_normal_magnitude[0].end(),
-      local_geometric_quantities_.begin() +
-          static_cast<std::ptrdiff_t>(local_volume_det_inv_jacobian[0].size() +
-                                      local_face_det_jacobian[0].size()));
+  local_volume_det_inv_jacobian_.reset();
+  local_face_quantities_.reset();
+  for (const MortarData* candidate : reuse_candidates) {
+    if (candidate == nullptr) {
+      continue;
+    }
+    if (local_volume_det_inv_jacobian_ == nullptr and
+        holds(candidate->local_volume_det_inv_jacobian_,
+              {&get(local_volume_det_inv_jacobian)})) {
+      local_volume_det_inv_jacobian_ =
+          candidate->local_volume_det_inv_jacobian_;
+    }
+    if (local_face_quantities_ == nullptr and
+        holds(candidate->local_face_quantities_,
+              {&get(local_face_det_jacobian),
+               &get(local_face_normal_magnitude)})) {
+      local_face_quantities_ = candidate->local_face_quantities_;
+    }
+  }
+  if (local_volume_det_inv_jacobian_ == nullptr) {
+    local_volume_det_inv_jacobian_ =
+        concatenate({&get(local_volume_det_inv_jacobian)});
+  }
+  if (local_face_quantities_ == nullptr) {
+    local_face_quantities_ = concatenate(
+        {&get(local_face_det_jacobian), &get(local_face_normal_magnitude)});
+  }
 }
 
 template <size_t Dim>
 void MortarData<Dim>::insert_local_face_normal_magnitude(
-    const Scalar<DataVector>& local_face_normal_magnitude) {
+    const Scalar<DataVector>& local_face_normal_magnitude,
+    const std::initializer_list<const MortarData*> reuse_candidates) {
   ASSERT(local_mortar_data_[mortar_index_].has_value(),
          "Must set local mortar data before setting the local face normal.");
   ASSERT(not using_volume_and_face_jacobians_,
@@ -128,12 +210,19 @@ void MortarData<Dim>::insert_local_face_normal_magnitude(
          "volume inverse Jacobian determinant, and face Jacobian determinant "
          "are being used.");
   using_only_face_normal_magnitude_ = true;
-  const size_t required_storage_size = local_face_normal_magnitude[0].size();
-  local_geometric_quantities_.destructive_resize(required_storage_size);
 
-  std::copy(local_face_normal_magnitude[0].begin(),
-            local_face_normal_magnitude[0].end(),
-            local_geometric_quantities_.begin());
+  local_face_quantities_.reset();
+  for (const MortarData* candidate : reuse_candidates) {
+    if (candidate != nullptr and
+        holds(candidate->local_face_quantities_,
+              {&get(local_face_normal_magnitude)})) {
+      local_face_quantities_ = candidate->local_face_quantities_;
+      break;
+    }
+  }
+  if (local_face_quantities_ == nullptr) {
+    local_face_quantities_ = concatenate({&get(local_face_normal_magnitude)});
+  }
 }
 
 template <size_t Dim>
@@ -144,25 +233,17 @@ void MortarData<Dim>::get_local_volume_det_inv_jacobian(
          "Must set local mortar data before getting the local volume inverse "
          "Jacobian determinant.");
   ASSERT(
-      local_geometric_quantities_.size() >
-          2 * std::get<0>(*local_mortar_data()).number_of_grid_points(),
-      "Cannot retrieve the volume inverse Jacobian determinant because it was "
-      "not inserted.");
-  ASSERT(
-      using_volume_and_face_jacobians_,
+      using_volume_and_face_jacobians_ and
+          local_volume_det_inv_jacobian_ != nullptr,
       "Cannot retrieve the volume inverse Jacobian determinant because it was "
       "not inserted.");
   ASSERT(not using_only_face_normal_magnitude_,
          "Inconsistent internal state: we are apparently using both the volume "
          "and face Jacobians, as well as only the face normal.");
-  const size_t num_face_points =
-      std::get<0>(*local_mortar_data()).number_of_grid_points();
-  const size_t num_volume_points =
-      local_geometric_quantities_.size() - 2 * num_face_points;
   get(*local_volume_det_inv_jacobian)
       .set_data_ref(const_cast<double*>(  // NOLINT
-                        local_geometric_quantities_.data()),
-                    num_volume_points);
+                        local_volume_det_inv_jacobian_->data()),
+                    local_volume_det_inv_jacobian_->size());
 }
 
 template <size_t Dim>
@@ -171,8 +252,10 @@ void MortarData<Dim>::get_local_face_det_jacobian(
   ASSERT(local_mortar_data_[mortar_index_].has_value(),
          "Must set local mortar data before getting the local face Jacobian "
          "determinant.");
-  ASSERT(local_geometric_quantities_.size() >
-             2 * std::get<0>(*local_mortar_data()).number_of_grid_points(),
+  const size_t num_face_points =
+      std::get<0>(*local_mortar_data()).number_of_grid_points();
+  ASSERT(local_face_quantities_ != nullptr and
+             local_face_quantities_->size() == 2 * num_face_points,
          "Cannot retrieve the face Jacobian determinant because it was not "
          "inserted.");
   ASSERT(using_volume_and_face_jacobians_,
@@ -181,16 +264,10 @@ void MortarData<Dim>::get_local_face_det_jacobian(
   ASSERT(not using_only_face_normal_magnitude_,
          "Inconsistent internal state: we are apparently using both the volume "
          "and face Jacobians, as well as only the face normal.");
-  const size_t num_face_points =
-      std::get<0>(*local_mortar_data()).number_of_grid_points();
-  const size_t offset =
-      local_geometric_quantities_.size() - 2 * num_face_points;
   get(*local_face_det_jacobian)
-      .set_data_ref(
-          // NOLINTNEXTLINE
-          const_cast<double*>(  // NOLINTNEXTLINE
-              local_geometric_quantities_.data() + offset),
-          num_face_points);
+      .set_data_ref(const_cast<double*>(  // NOLINT
+                        local_face_quantities_->data()),
+                    num_face_points);
 }
 
 template <size_t Dim>
@@ -202,16 +279,16 @@ void MortarData<Dim>::get_local_face_normal_magnitude(
          "magnitude.");
   const size_t num_face_points =
       std::get<0>(*local_mortar_data()).number_of_grid_points();
-  ASSERT(local_geometric_quantities_.size() == num_face_points or
-             local_geometric_quantities_.size() > 2 * num_face_points,
+  ASSERT(local_face_quantities_ != nullptr and
+             local_face_quantities_->size() >= num_face_points,
          "Cannot retrieve the face normal magnitude because it was not "
          "inserted.");
-  const size_t offset = local_geometric_quantities_.size() - num_face_points;
+  const size_t offset = local_face_quantities_->size() - num_face_points;
   get(*local_face_normal_magnitude)
       .set_data_ref(
           // NOLINTNEXTLINE
           const_cast<double*>(  // NOLINTNEXTLINE
-              local_geometric_quantities_.data() + offset),
+              local_face_quantities_->data() + offset),
           num_face_points);
 }
 
@@ -258,7 +335,8 @@ void MortarData<Dim>::pup(PUP::er& p) {
   p | time_step_id_;
   p | local_mortar_data_;
   p | neighbor_mortar_data_;
-  p | local_geometric_quantities_;
+  pup_shared(p, make_not_null(&local_volume_det_inv_jacobian_));
+  pup_shared(p, make_not_null(&local_face_quantities_));
   p | using_volume_and_face_jacobians_;
   p | using_only_face_normal_magnitude_;
 }
@@ -281,7 +359,10 @@ bool operator==(const MortarData<Dim>& lhs, const MortarData<Dim>& rhs) {
          lhs.time_step_id() == rhs.time_step_id() and
          lhs.local_mortar_data() == rhs.local_mortar_data() and
          lhs.neighbor_mortar_data() == rhs.neighbor_mortar_data() and
-         lhs.local_geometric_quantities_ == rhs.local_geometric_quantities_ and
+         equal_contents(lhs.local_volume_det_inv_jacobian_,
+                        rhs.local_volume_det_inv_jacobian_) and
+         equal_contents(lhs.local_face_quantities_,
+                        rhs.local_face_quantities_) and
          lhs.using_volume_and_face_jacobians_ ==
              rhs.using_volume_and_face_jacobians_ and
          lhs.using_only_face_normal_magnitude_ ==
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <cstddef>
+#include <initializer_list>
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -40,6 +42,15 @@ namespace evolution::dg {
  * responsible for reorienting the data on the mortar so it matches the
  * neighbor's orientation.
  *
+ * The geometric quantities used for local time stepping are held in immutable
+ * buffers that can be shared between `MortarData`s. With local time stepping
+ * a `MortarData` is stored in the boundary history for every step, and on a
+ * static mesh the geometric quantities are the same on every step. The volume
+ * inverse Jacobian determinant is also the same on all mortars of an element.
+ * The insert functions therefore take a list of previously inserted
+ * `MortarData` whose buffers are reused if they hold the same values, so the
+ * history holds only one copy of each of the quantities.
+ *
  * \tparam Dim the volume dimension of the mesh
  */
 template <size_t Dim>
@@ -90,11 +101,16 @@ class MortarData {
    *
    * for a face in the \f$\xi\f$-direction, with inverse spatial metric
    * \f$\gamma^{ij}\f$.
+   *
+   * The buffers of the first of the `reuse_candidates` that holds the same
+   * volume (or face) quantities are shared instead of storing a copy. Null
+   * candidates are ignored.
    */
   void insert_local_geometric_quantities(
       const Scalar<DataVector>& local_volume_det_inv_jacobian,
       const Scalar<DataVector>& local_face_det_jacobian,
-      const Scalar<DataVector>& local_face_normal_magnitude);
+      const Scalar<DataVector>& local_face_normal_magnitude,
+      std::initializer_list<const MortarData*> reuse_candidates = {});
 
   /*!
    * \brief Insert the magnitude of the local face normal. Used for local time
@@ -110,9 +126,14 @@ class MortarData {
    *
    * for a face in the \f$\xi\f$-direction, with inverse spatial metric
    * \f$\gamma^{ij}\f$.
+   *
+   * The buffer of the first of the `reuse_candidates` that holds the same face
+   * normal magnitude is shared instead of storing a copy. Null candidates are
+   * ignored.
    */
   void insert_local_face_normal_magnitude(
-      const Scalar<DataVector>& local_face_normal_magnitude);
+      const Scalar<DataVector>& local_face_normal_magnitude,
+      std::initializer_list<const MortarData*> reuse_candidates = {});
 
   /*!
    * \brief Sets the `local_volume_det_inv_jacobian` by setting the DataVector
@@ -200,7 +221,10 @@ class MortarData {
   std::vector<MortarType> local_mortar_data_{};
   std::vector<MortarType> neighbor_mortar_data_{};
   size_t mortar_index_{0};
-  DataVector local_geometric_quantities_{};
+  std::shared_ptr<const DataVector> local_volume_det_inv_jacobian_{};
+  // The local face Jacobian determinant followed by the magnitude of the local
+  // face normal, or only the latter if the Jacobians are not used
+  std::shared_ptr<const DataVector> local_face_quantities_{};
   bool using_volume_and_face_jacobians_{false};
   bool using_only_face_normal_magnitude_{false};
 };
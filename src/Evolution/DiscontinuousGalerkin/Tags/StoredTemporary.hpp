@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <utility>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Time/Tags/Time.hpp"
+#include "Time/Tags/TimeStepId.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace evolution::dg::Tags {
+/*!
+ * \brief A temporary of the volume time derivative, stored along with the
+ * `TimeStepId` at which it was computed
+ *
+ * \details The temporaries of `System::compute_volume_time_derivative_terms`
+ * are discarded after each evaluation of the time derivative. If this tag is in
+ * the DataBox for a `Tag` in the `temporary_tags`, then
+ * `evolution::dg::Actions::ComputeTimeDerivative` stores the `Tag` in every
+ * evaluation so observations can reuse it (see
+ * `evolution::dg::Tags::ReuseStoredTemporaryCompute`). For example, the
+ * generalized harmonic system computes the gauge and three-index constraints to
+ * damp them, so observing them at a step needn't compute them again.
+ */
+template <typename Tag>
+struct StoredTemporary : db::PrefixTag, db::SimpleTag {
+  using type = std::pair<TimeStepId, typename Tag::type>;
+  using tag = Tag;
+};
+
+/*!
+ * \brief Retrieves the `StoredTemporary` for the `ComputeTag::base` if it
+ * belongs to the current state, and computes it with the `ComputeTag`
+ * otherwise.
+ *
+ * \details The stored temporary belongs to the current state if it was
+ * computed at the current `TimeStepId`, which must be the start of a step, and
+ * the `::Tags::Time` is still the step time. In that case the evolved variables
+ * are the ones the time derivative was computed from, or their dense output at
+ * the step time, which only differs by roundoff. This is where observations
+ * triggered by `evolution::Actions::RunEventsAndDenseTriggers` at the step time
+ * happen. Observations at other times, or before the time derivative is
+ * computed in the step, fall back to the `ComputeTag`.
+ *
+ * Use this compute tag in place of the `ComputeTag`, e.g. in the list of
+ * observed fields, and add the `StoredTemporary` to the DataBox. Note that the
+ * arguments of the `ComputeTag` are retrieved from the DataBox in either case,
+ * so only the computation of this tag itself is saved.
+ */
+template <typename ComputeTag>
+struct ReuseStoredTemporaryCompute : ComputeTag::base, db::ComputeTag {
+  using base = typename ComputeTag::base;
+  using return_type = typename ComputeTag::return_type;
+  using argument_tags =
+      tmpl::append<tmpl::list<StoredTemporary<base>, ::Tags::TimeStepId,
+                              ::Tags::Time>,
+                   typename ComputeTag::argument_tags>;
+  template <typename... Args>
+  static void function(const gsl::not_null<return_type*> result,
+                       const std::pair<TimeStepId, return_type>& stored,
+                       const TimeStepId& time_step_id, const double time,
+                       const Args&... args) {
+    if (stored.first == time_step_id and time_step_id.substep() == 0 and
+        time == time_step_id.step_time().value()) {
+      *result = stored.second;
+    } else {
+      ComputeTag::function(result, args...);
+    }
+  }
+};
+}  // namespace evolution::dg::Tags
@@ -28,6 +28,7 @@
 #include "Evolution/DgSubcell/PrepareNeighborData.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverCoordinates.hpp"
 #include "Evolution/DgSubcell/Tags/ObserverMesh.hpp"
+#include "Evolution/DgSubcell/Tags/TciCadence.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
@@ -153,7 +154,9 @@ struct EvolutionMetavars {
           typename system::variables_tag::tags_list, error_tags,
           tmpl::conditional_t<use_dg_subcell,
                               tmpl::list<evolution::dg::subcell::Tags::
-                                             TciStatusCompute<volume_dim>>,
+                                             TciStatusCompute<volume_dim>,
+                                         evolution::dg::subcell::Tags::
+                                             TciIntervalCompute<volume_dim>>,
                               tmpl::list<>>>,
       ::Events::Tags::ObserverDetInvJacobianCompute<Frame::ElementLogical,
                                                     Frame::Inertial>,
@@ -260,7 +263,7 @@ struct EvolutionMetavars {
               evolution::Actions::RunEventsAndDenseTriggers<tmpl::list<>>,
               Actions::UpdateU<system>>>,
       evolution::dg::subcell::Actions::TciAndRollback<
-          Burgers::subcell::TciOnDgGrid>,
+          Burgers::subcell::TciOnDgGrid, Burgers::subcell::SetInitialRdmpData>,
       Actions::Goto<evolution::dg::subcell::Actions::Labels::EndOfSolvers>,
       Actions::Label<evolution::dg::subcell::Actions::Labels::BeginSubcell>,
       evolution::dg::subcell::Actions::SendDataForReconstruction<
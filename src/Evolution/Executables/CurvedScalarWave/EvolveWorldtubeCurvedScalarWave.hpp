@@ -295,6 +295,8 @@ struct EvolutionMetavars {
               volume_dim>,
           CurvedScalarWave::Worldtube::Tags::FaceCoordinatesCompute<
               volume_dim, Frame::Grid, true>,
+          CurvedScalarWave::Worldtube::Tags::FaceSphericalHarmonicsCompute<
+              volume_dim>,
           CurvedScalarWave::Worldtube::Tags::FaceCoordinatesCompute<
               volume_dim, Frame::Inertial, false>,
           CurvedScalarWave::Worldtube::Tags::PunctureFieldCompute<volume_dim>,
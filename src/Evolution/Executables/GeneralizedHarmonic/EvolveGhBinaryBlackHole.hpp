@@ -34,10 +34,12 @@
 #include "Evolution/Actions/RunEventsAndTriggers.hpp"
 #include "Evolution/ComputeTags.hpp"
 #include "Evolution/Deadlock/PrintDgElementArray.hpp"
+#include "Evolution/Deadlock/RecordProgress.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/Mortars.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/StoredTemporary.hpp"
 #include "Evolution/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "Evolution/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
@@ -350,9 +352,12 @@ struct EvolutionMetavars {
                                                  ::Frame::Inertial>,
           gr::Tags::InverseSpacetimeMetricCompute<DataVector, volume_dim,
                                                   ::Frame::Inertial>,
-          gh::Tags::GaugeConstraintCompute<volume_dim, ::Frame::Inertial>,
+          evolution::dg::Tags::ReuseStoredTemporaryCompute<
+              gh::Tags::GaugeConstraintCompute<volume_dim, ::Frame::Inertial>>,
           gh::Tags::TwoIndexConstraintCompute<volume_dim, ::Frame::Inertial>,
-          gh::Tags::ThreeIndexConstraintCompute<volume_dim, ::Frame::Inertial>,
+          evolution::dg::Tags::ReuseStoredTemporaryCompute<
+              gh::Tags::ThreeIndexConstraintCompute<volume_dim,
+                                                    ::Frame::Inertial>>,
           gh::Tags::DerivSpatialMetricCompute<volume_dim, ::Frame::Inertial>,
           gr::Tags::SpatialChristoffelFirstKindCompute<DataVector, volume_dim,
                                                        ::Frame::Inertial>,
@@ -543,6 +548,7 @@ struct EvolutionMetavars {
                                           Frame::Inertial>,
           typename system::gradient_variables>>>,
       gh::Actions::InitializeGhAnd3Plus1Variables<volume_dim>,
+      gh::Actions::InitializeStoredConstraints<volume_dim>,
       Initialization::Actions::AddComputeTags<
           tmpl::push_back<StepChoosers::step_chooser_compute_tags<
               EvolutionMetavars, local_time_stepping>>>,
@@ -578,7 +584,8 @@ struct EvolutionMetavars {
               SelfStart::self_start_procedure<step_actions, system>>,
           Parallel::PhaseActions<
               Parallel::Phase::Evolve,
-              tmpl::list<::domain::Actions::CheckFunctionsOfTimeAreReady,
+              tmpl::list<deadlock::Actions::RecordProgress,
+                         ::domain::Actions::CheckFunctionsOfTimeAreReady,
                          evolution::Actions::RunEventsAndTriggers,
                          Actions::ChangeSlabSize, step_actions,
                          Actions::AdvanceTime,
@@ -23,6 +23,7 @@
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/Mortars.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/StoredTemporary.hpp"
 #include "Evolution/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "Evolution/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
@@ -184,9 +185,12 @@ struct ObserverTags {
           gr::Tags::InverseSpacetimeMetricCompute<DataVector, volume_dim,
                                                   Frame::Inertial>,
 
-          gh::Tags::GaugeConstraintCompute<volume_dim, Frame::Inertial>,
+          evolution::dg::Tags::ReuseStoredTemporaryCompute<
+              gh::Tags::GaugeConstraintCompute<volume_dim, Frame::Inertial>>,
           gh::Tags::TwoIndexConstraintCompute<volume_dim, Frame::Inertial>,
-          gh::Tags::ThreeIndexConstraintCompute<volume_dim, Frame::Inertial>,
+          evolution::dg::Tags::ReuseStoredTemporaryCompute<
+              gh::Tags::ThreeIndexConstraintCompute<volume_dim,
+                                                    Frame::Inertial>>,
           gh::Tags::DerivSpatialMetricCompute<volume_dim, ::Frame::Inertial>,
           gr::Tags::SpatialChristoffelFirstKindCompute<DataVector, volume_dim,
                                                        ::Frame::Inertial>,
@@ -371,6 +375,7 @@ struct GeneralizedHarmonicTemplateBase {
                                         Frame::Inertial>,
           typename system::gradient_variables>>,
       gh::Actions::InitializeGhAnd3Plus1Variables<volume_dim>,
+      gh::Actions::InitializeStoredConstraints<volume_dim>,
       Initialization::Actions::AddComputeTags<
           tmpl::push_back<StepChoosers::step_chooser_compute_tags<
               GeneralizedHarmonicTemplateBase, local_time_stepping>>>,
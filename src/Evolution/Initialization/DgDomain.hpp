@@ -130,7 +130,8 @@ struct Domain {
       ::domain::Tags::InertialMeshVelocityCompute<Dim>,
       evolution::domain::Tags::DivMeshVelocityCompute<Dim>,
       // Compute tags for other mesh quantities
-      ::domain::Tags::MinimumGridSpacingCompute<Dim, Frame::Inertial>>;
+      ::domain::Tags::MinimumGridSpacingCompute<Dim, Frame::Grid>,
+      ::domain::Tags::MinimumInertialGridSpacingCompute<Dim>>;
 
   /// Given the items fetched from a DataBox by the argument_tags, mutate
   /// the items in the DataBox corresponding to return_tags
@@ -151,10 +152,14 @@ struct Domain {
         initial_extents, element_id, quadrature);
     *element = ::domain::Initialization::create_initial_element(
         element_id, my_block, initial_refinement);
-    *element_map = ElementMap<Dim, Frame::Grid>{
-        element_id, my_block.is_time_dependent()
-                        ? my_block.moving_mesh_logical_to_grid_map().get_clone()
-                        : my_block.stationary_map().get_to_grid_frame()};
+    // Time-dependent blocks share their map with their elements
+    if (my_block.is_time_dependent()) {
+      *element_map = ElementMap<Dim, Frame::Grid>{
+          element_id, my_block.shared_moving_mesh_logical_to_grid_map()};
+    } else {
+      *element_map = ElementMap<Dim, Frame::Grid>{
+          element_id, my_block.stationary_map().get_to_grid_frame()};
+    }
 
     if (my_block.is_time_dependent()) {
       *grid_to_inertial_map =
@@ -197,10 +202,14 @@ struct ProjectDomain : tt::ConformsTo<amr::protocols::Projector> {
       const ParentOrChildrenItemsType& /*parent_or_children_items*/) {
     const ElementId<Dim>& element_id = element.id();
     const auto& my_block = domain.blocks()[element_id.block_id()];
-    *element_map = ElementMap<Dim, Frame::Grid>{
-        element_id, my_block.is_time_dependent()
-                        ? my_block.moving_mesh_logical_to_grid_map().get_clone()
-                        : my_block.stationary_map().get_to_grid_frame()};
+    // Time-dependent blocks share their map with their elements
+    if (my_block.is_time_dependent()) {
+      *element_map = ElementMap<Dim, Frame::Grid>{
+          element_id, my_block.shared_moving_mesh_logical_to_grid_map()};
+    } else {
+      *element_map = ElementMap<Dim, Frame::Grid>{
+          element_id, my_block.stationary_map().get_to_grid_frame()};
+    }
     if (my_block.is_time_dependent()) {
       *grid_to_inertial_map =
           my_block.moving_mesh_grid_to_inertial_map().get_clone();
@@ -41,6 +41,15 @@ namespace callbacks {
 ///
 /// \note This callback requires the temporal ID in an InterpolationTargetTag be
 /// a TimeStepId.
+///
+/// \note The GH variables are sent as nodal data on the worldtube sphere. No
+/// single element holds the whole sphere, so a decomposition into
+/// spin-weighted spherical harmonic modes could only be done here, on the
+/// interpolation target, after the points from all elements are gathered. The
+/// sphere already uses the collocation points of the CCE `LMax`. The nodal
+/// data of those points is only about twice the size of its modes, and
+/// truncating to the modes would filter the data that
+/// `Cce::create_bondi_boundary_data` receives.
 template <typename CceEvolutionComponent, typename InterpolationTargetTag,
           bool DuringSelfStart, bool LocalTimeStepping>
 struct SendGhWorldtubeData
@@ -53,6 +53,18 @@ struct CceEvolutionLabelTag {};
  * computation, as well as storage for the boundary values and quantities
  * related to managing the evolution.
  *
+ * The component is a singleton. Each hypersurface is computed in the order of
+ * the `Cce::bondi_hypersurface_step_tags`, where each step needs the angular
+ * derivatives, over all angles, of the quantities integrated radially in the
+ * previous steps, and the next hypersurface needs the time derivative from the
+ * last step. A radial pipeline therefore has no independent stages to overlap,
+ * and an angular decomposition would need an all-to-all transpose of the volume
+ * data for every step of the hierarchy. Instead, the spin-weighted transforms
+ * of each step are batched over all radial shells and spins (see
+ * `Cce::mutate_all_swsh_derivatives_for_tag`). To keep the evolution from
+ * slowing CCE down, place this singleton exclusively on its own proc with
+ * `Parallel::ResourceInfo`.
+ *
  * Metavariables requirements:
  * - Phases:
  *  - `Initialization`
@@ -10,14 +10,17 @@
 #include <tuple>
 #include <utility>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/Serialization/PupStlCpp11.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
@@ -61,41 +64,32 @@ bool interpolate_to_time(
       return false;
     }
   }
-  DataVector time_points{
-      2 * interpolator->required_number_of_points_before_and_after()};
-  DataVector tensor_component_values{
-      2 * interpolator->required_number_of_points_before_and_after()};
+  const size_t number_of_times =
+      2 * interpolator->required_number_of_points_before_and_after();
+  DataVector time_points{number_of_times};
   for (auto [i, map_it] = std::make_tuple(0_st, iterator_start);
        i < time_points.size(); ++i, ++map_it) {
     time_points[i] = map_it->first.id;
   }
-  tmpl::for_each<typename VarsToInterpolate::tags_list>(
-      [&vars_to_interpolate, &interpolator, &time_points,
-       &tensor_component_values, &target_time,
-       &iterator_start](auto tensor_tag_v) {
-        using tensor_tag = typename decltype(tensor_tag_v)::type;
-        auto& tensor = get<tensor_tag>(*vars_to_interpolate);
-        for (size_t i = 0; i < tensor.size(); ++i) {
-          for (size_t offset = 0;
-               offset < vars_to_interpolate->number_of_grid_points();
-               ++offset) {
-            // assemble data into easily interpolated structures
-            for (auto [time_index, gh_data_it] =
-                     std::make_tuple(0_st, iterator_start);
-                 time_index <
-                 2 * interpolator->required_number_of_points_before_and_after();
-                 ++time_index, ++gh_data_it) {
-              tensor_component_values[time_index] =
-                  get<tensor_tag>(gh_data_it->second)[i][offset];
-            }
-            tensor[i][offset] = interpolator->interpolate(
-                gsl::span<const double>{time_points.data(), time_points.size()},
-                gsl::span<const double>{tensor_component_values.data(),
-                                        tensor_component_values.size()},
-                target_time);
-          }
-        }
-      });
+  // All of the `intrp::SpanInterpolator`s are linear in the interpolated
+  // values, and the times are the same for every grid point and tensor
+  // component, so the interpolation reduces to a weighted sum of the stored
+  // data sets. The weights are found by interpolating the unit vectors.
+  DataVector weights{number_of_times};
+  DataVector unit_values{number_of_times, 0.0};
+  for (size_t i = 0; i < number_of_times; ++i) {
+    unit_values[i] = 1.0;
+    weights[i] = interpolator->interpolate(
+        gsl::span<const double>{time_points.data(), time_points.size()},
+        gsl::span<const double>{unit_values.data(), unit_values.size()},
+        target_time);
+    unit_values[i] = 0.0;
+  }
+  *vars_to_interpolate = weights[0] * iterator_start->second;
+  for (auto [i, gh_data_it] = std::make_tuple(1_st, std::next(iterator_start));
+       i < number_of_times; ++i, ++gh_data_it) {
+    *vars_to_interpolate += weights[i] * gh_data_it->second;
+  }
   return true;
 }
 }  // namespace detail
@@ -4,6 +4,7 @@
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -137,15 +138,13 @@ void transpose_to_reals_then_imags_radial_stripes(
     const gsl::not_null<DataVector*> result, const ComplexDataVector& input,
     const size_t number_of_radial_points,
     const size_t number_of_angular_points) {
-  for (size_t i = 0; i < input.size() * 2; ++i) {
-    (*result)[i] = ((i / number_of_radial_points) % 2) == 0
-                       ? real(input[number_of_angular_points *
-                                        (i % number_of_radial_points) +
-                                    i / (2 * number_of_radial_points)])
-                       : imag(input[number_of_angular_points *
-                                        (i % number_of_radial_points) +
-                                    i / (2 * number_of_radial_points)]);
-  }
+  // `std::complex<double>` has the layout of `double[2]`, so the input is a
+  // row-major matrix with a row of interleaved real and imaginary parts for
+  // each radial point, and the result is its transpose.
+  raw_transpose(
+      make_not_null(result->data()),
+      reinterpret_cast<const double*>(input.data()),  // NOLINT
+      2 * number_of_angular_points, number_of_radial_points);
 }
 }  // namespace detail
 
@@ -222,14 +221,10 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
   ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
 
-  DataVector transpose_buffer{2 * get(pole_of_integrand).size()};
   DataVector linear_solve_buffer{2 * get(pole_of_integrand).size()};
 
   // transpose such that each radial slice is split up into the order:
@@ -238,41 +233,35 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
       make_not_null(&linear_solve_buffer), integrand, number_of_radial_points,
       number_of_angular_points);
 
-  raw_transpose(make_not_null(transpose_buffer.data()),
-                linear_solve_buffer.data(), number_of_radial_points,
-                2 * number_of_angular_points);
-
+  // The (1 - y) \partial_y part of the matrix is the same at all angular
+  // points, because y only depends on the radial point. It is applied to the
+  // upper left (real-real) and lower right (imag-imag) part of the matrix,
+  // and the other two parts are zero.
   const auto& derivative_matrix =
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
-
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
-      for (size_t i = 0; i < number_of_radial_points; ++i) {
-        for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
-        }
-      }
-    }
-
-    // zero out the lower left and upper right part of the matrix
+  Matrix angle_independent_operator(2 * number_of_radial_points,
+                                    2 * number_of_radial_points, 0.0);
+  for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
     for (size_t i = 0; i < number_of_radial_points; ++i) {
       for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
+        angle_independent_operator(i + matrix_block * number_of_radial_points,
+                                   j + matrix_block * number_of_radial_points) =
+            derivative_matrix(i, j) *
+            real(get(one_minus_y).data()[i * number_of_angular_points]);
       }
     }
+  }
+
+  Matrix operator_matrix(2 * number_of_radial_points,
+                         2 * number_of_radial_points);
+  std::vector<int> pivots(2 * number_of_radial_points);
+  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
+    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
+    // We'll ignore its pivots and just overwrite the whole thing on each
+    // pass.
+    operator_matrix = angle_independent_operator;
 
     // gather the contributions to the matrix blocks from the linear factors
     // each, we zero the first row
@@ -313,7 +302,7 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
         linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
         2 * number_of_radial_points};
     lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
+        make_not_null(&linear_solve_buffer_view), make_not_null(&pivots),
         make_not_null(&operator_matrix));
   }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -149,6 +149,15 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5Prefetch {
+  using type = bool;
+  static constexpr Options::String help{
+      "Read the next H5LookaheadTimes times from the h5 on a background thread "
+      "while the current ones are used. Only has an effect in SMP builds."};
+  static bool suggested_value() { return false; }
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -284,14 +293,15 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
   using type = std::unique_ptr<WorldtubeDataManager>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
-                 OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5Prefetch,
+                 OptionTags::H5Interpolator, OptionTags::H5IsBondiData,
+                 OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const bool prefetch,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) {
@@ -308,13 +318,14 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       return std::make_unique<BondiWorldtubeDataManager>(
           std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
                                                           extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch);
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
           std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
                                                            extraction_radius),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch);
     }
   }
 };
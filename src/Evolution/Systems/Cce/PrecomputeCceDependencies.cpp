@@ -6,7 +6,9 @@
 #include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/Cce/IntegrandInputSteps.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -18,6 +20,29 @@
 namespace Cce {
 
 namespace detail {
+namespace {
+// divides the innermost angular shell of `d_r_divided_by_r`, which holds an
+// angular derivative of the boundary value of R, by R, then repeats it over
+// the rest of the radial dimension.
+template <int Spin>
+void divide_by_r_and_fill_radially(
+    const gsl::not_null<SpinWeighted<ComplexDataVector, Spin>*>
+        d_r_divided_by_r,
+    const SpinWeighted<ComplexDataVector, 0>& boundary_r,
+    const size_t number_of_radial_points) {
+  const size_t number_of_angular_points = boundary_r.size();
+  ComplexDataVector d_r_divided_by_r_boundary{d_r_divided_by_r->data().data(),
+                                              number_of_angular_points};
+  d_r_divided_by_r_boundary /= boundary_r.data();
+  // all of the angular shells after the innermost one
+  ComplexDataVector d_r_divided_by_r_tail_shells{
+      d_r_divided_by_r->data().data() + number_of_angular_points,
+      (number_of_radial_points - 1) * number_of_angular_points};
+  fill_with_n_copies(make_not_null(&d_r_divided_by_r_tail_shells),
+                     d_r_divided_by_r_boundary, number_of_radial_points - 1);
+}
+}  // namespace
+
 template <typename DerivKind>
 void angular_derivative_of_r_divided_by_r_impl(
     const gsl::not_null<
@@ -35,14 +60,65 @@ void angular_derivative_of_r_divided_by_r_impl(
           {d_r_divided_by_r->data().data(), number_of_angular_points}};
   Spectral::Swsh::angular_derivatives<tmpl::list<DerivKind>>(
       l_max, 1, make_not_null(&d_r_divided_by_r_boundary), boundary_r);
-  d_r_divided_by_r_boundary.data() /= boundary_r.data();
-  // all of the angular shells after the innermost one
-  ComplexDataVector d_r_divided_by_r_tail_shells{
-      d_r_divided_by_r->data().data() + number_of_angular_points,
-      (number_of_radial_points - 1) * number_of_angular_points};
-  fill_with_n_copies(make_not_null(&d_r_divided_by_r_tail_shells),
-                     d_r_divided_by_r_boundary.data(),
-                     number_of_radial_points - 1);
+  divide_by_r_and_fill_radially(d_r_divided_by_r, boundary_r,
+                                number_of_radial_points);
+}
+
+void angular_derivatives_of_r_divided_by_r(
+    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*>
+        eth_r_divided_by_r,
+    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 2>>*>
+        eth_eth_r_divided_by_r,
+    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
+        eth_ethbar_r_divided_by_r,
+    const Scalar<SpinWeighted<ComplexDataVector, 0>>& boundary_r,
+    const size_t l_max, const size_t number_of_radial_points) {
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  // views of the innermost angular shells, into which the derivatives of the
+  // boundary value are placed
+  Scalar<SpinWeighted<ComplexDataVector, 1>> eth_r_boundary{};
+  get(eth_r_boundary)
+      .set_data_ref(get(*eth_r_divided_by_r).data().data(),
+                    number_of_angular_points);
+  Scalar<SpinWeighted<ComplexDataVector, 2>> eth_eth_r_boundary{};
+  get(eth_eth_r_boundary)
+      .set_data_ref(get(*eth_eth_r_divided_by_r).data().data(),
+                    number_of_angular_points);
+  Scalar<SpinWeighted<ComplexDataVector, 0>> eth_ethbar_r_boundary{};
+  get(eth_ethbar_r_boundary)
+      .set_data_ref(get(*eth_ethbar_r_divided_by_r).data().data(),
+                    number_of_angular_points);
+
+  // the `AngularDerivatives` interface identifies the inputs by tag, so the
+  // boundary value of R is transformed once for all three derivatives
+  using derivative_tags = tmpl::list<
+      Spectral::Swsh::Tags::Derivative<Tags::BondiR, Spectral::Swsh::Tags::Eth>,
+      Spectral::Swsh::Tags::Derivative<Tags::BondiR,
+                                       Spectral::Swsh::Tags::EthEth>,
+      Spectral::Swsh::Tags::Derivative<Tags::BondiR,
+                                       Spectral::Swsh::Tags::EthEthbar>>;
+  Scalar<SpinWeighted<ComplexModalVector, 1>> eth_r_modes{
+      Spectral::Swsh::swsh_buffer<1>(l_max, 1)};
+  Scalar<SpinWeighted<ComplexModalVector, 2>> eth_eth_r_modes{
+      Spectral::Swsh::swsh_buffer<2>(l_max, 1)};
+  Scalar<SpinWeighted<ComplexModalVector, 0>> eth_ethbar_r_modes{
+      Spectral::Swsh::swsh_buffer<0>(l_max, 1)};
+  Scalar<SpinWeighted<ComplexModalVector, 0>> r_modes{
+      Spectral::Swsh::swsh_buffer<0>(l_max, 1)};
+  Spectral::Swsh::AngularDerivatives<derivative_tags>::apply(
+      make_not_null(&eth_r_boundary), make_not_null(&eth_eth_r_boundary),
+      make_not_null(&eth_ethbar_r_boundary), make_not_null(&eth_r_modes),
+      make_not_null(&eth_eth_r_modes), make_not_null(&eth_ethbar_r_modes),
+      make_not_null(&r_modes), boundary_r, l_max, 1);
+
+  divide_by_r_and_fill_radially(make_not_null(&get(*eth_r_divided_by_r)),
+                                get(boundary_r), number_of_radial_points);
+  divide_by_r_and_fill_radially(make_not_null(&get(*eth_eth_r_divided_by_r)),
+                                get(boundary_r), number_of_radial_points);
+  divide_by_r_and_fill_radially(
+      make_not_null(&get(*eth_ethbar_r_divided_by_r)), get(boundary_r),
+      number_of_radial_points);
 }
 }  // namespace detail
 
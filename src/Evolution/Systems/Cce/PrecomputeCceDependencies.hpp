@@ -8,6 +8,7 @@
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/SpinWeighted.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/IntegrandInputSteps.hpp"
 #include "Evolution/Systems/Cce/OptionTags.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
@@ -35,6 +36,44 @@ void angular_derivative_of_r_divided_by_r_impl(
     const SpinWeighted<ComplexDataVector, 0>& boundary_r, size_t l_max,
     size_t number_of_radial_points);
 
+// Computes \f$\eth R / R\f$, \f$\eth \eth R / R\f$, and
+// \f$\eth \bar{\eth} R / R\f$ together, transforming the boundary value of
+// \f$R\f$ to spin-weighted spherical harmonic modes only once.
+void angular_derivatives_of_r_divided_by_r(
+    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*>
+        eth_r_divided_by_r,
+    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 2>>*>
+        eth_eth_r_divided_by_r,
+    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
+        eth_ethbar_r_divided_by_r,
+    const Scalar<SpinWeighted<ComplexDataVector, 0>>& boundary_r, size_t l_max,
+    size_t number_of_radial_points);
+
+// The mutator used by `mutate_all_precompute_cce_dependencies` in place of the
+// separate `PrecomputeCceDependencies` for the three angular derivatives of
+// \f$R\f$, which all differentiate the same boundary value.
+template <template <typename> class BoundaryPrefix>
+struct PrecomputeAngularDerivativesOfRDividedByR {
+  using return_tags =
+      tmpl::list<Tags::EthRDividedByR, Tags::EthEthRDividedByR,
+                 Tags::EthEthbarRDividedByR>;
+  using argument_tags = tmpl::list<BoundaryPrefix<Tags::BondiR>, Tags::LMax,
+                                   Tags::NumberOfRadialPoints>;
+
+  static void apply(
+      const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*>
+          eth_r_divided_by_r,
+      const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 2>>*>
+          eth_eth_r_divided_by_r,
+      const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
+          eth_ethbar_r_divided_by_r,
+      const Scalar<SpinWeighted<ComplexDataVector, 0>>& boundary_r,
+      const size_t l_max, const size_t number_of_radial_points) {
+    angular_derivatives_of_r_divided_by_r(
+        eth_r_divided_by_r, eth_eth_r_divided_by_r, eth_ethbar_r_divided_by_r,
+        boundary_r, l_max, number_of_radial_points);
+  }
+};
 }  // namespace detail
 
 /*!
@@ -242,6 +281,9 @@ struct PrecomputeCceDependencies<BoundaryPrefix, Tags::BondiK> {
  * `Cce::pre_computation_tags` to their correct values for the current values
  * for the remaining (input) tags.
  *
+ * The three angular derivatives of \f$R\f$ are computed together, sharing the
+ * transform of the boundary value of \f$R\f$.
+ *
  * The `BoundaryPrefix` template template parameter is to be passed a prefix
  * tag associated with the boundary value prefix used in the computation (e.g.
  * `Cce::Tags::BoundaryValue`), and allows easy switching between the
@@ -250,11 +292,16 @@ struct PrecomputeCceDependencies<BoundaryPrefix, Tags::BondiK> {
 template <template <typename> class BoundaryPrefix, typename DataBoxType>
 void mutate_all_precompute_cce_dependencies(
     const gsl::not_null<DataBoxType*> box) {
-  tmpl::for_each<pre_computation_tags>([&box](auto x) {
-    using integration_independent_tag = typename decltype(x)::type;
-    using mutation =
-        PrecomputeCceDependencies<BoundaryPrefix, integration_independent_tag>;
-    db::mutate_apply<mutation>(box);
-  });
+  using angular_derivatives_of_r =
+      detail::PrecomputeAngularDerivativesOfRDividedByR<BoundaryPrefix>;
+  db::mutate_apply<angular_derivatives_of_r>(box);
+  tmpl::for_each<tmpl::list_difference<
+      pre_computation_tags, typename angular_derivatives_of_r::return_tags>>(
+      [&box](auto x) {
+        using integration_independent_tag = typename decltype(x)::type;
+        using mutation = PrecomputeCceDependencies<BoundaryPrefix,
+                                                   integration_independent_tag>;
+        db::mutate_apply<mutation>(box);
+      });
 }
 }  // namespace Cce
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Evolution/Systems/Cce/Tags.hpp"
 #include "IO/H5/File.hpp"
@@ -93,6 +94,15 @@ struct ReducedWorldtubeModeRecorder {
                                   const ComplexModalVector& modes, size_t l_max,
                                   bool is_real = false);
 
+  /// append to `dataset_path` a row for each of the `times`, formatted as for
+  /// a single time from the `modes` at the same index.
+  ///
+  /// Appending many rows at once avoids opening the dataset for every row.
+  void append_worldtube_mode_data(const std::string& dataset_path,
+                                  const std::vector<double>& times,
+                                  const std::vector<ComplexModalVector>& modes,
+                                  size_t l_max, bool is_real = false);
+
  private:
   h5::H5File<h5::AccessType::ReadWrite> output_file_;
 };
@@ -69,8 +69,20 @@ struct ScriPlusInterpolationManager {
            "Inserted data must be of size specified at construction: "
                << vector_size_
                << " and provided data is of size: " << to_interpolate.size());
-    u_bondi_values_.push_back(u_bondi);
-    to_interpolate_values_.push_back(to_interpolate);
+    // reuse the storage of data that has been removed, if any, so that the
+    // steady-state insertion and removal does not allocate
+    if (spare_u_bondi_values_.empty()) {
+      u_bondi_values_.push_back(u_bondi);
+      to_interpolate_values_.push_back(to_interpolate);
+    } else {
+      u_bondi_values_.push_back(std::move(spare_u_bondi_values_.back()));
+      to_interpolate_values_.push_back(
+          std::move(spare_to_interpolate_values_.back()));
+      spare_u_bondi_values_.pop_back();
+      spare_to_interpolate_values_.pop_back();
+      u_bondi_values_.back() = u_bondi;
+      to_interpolate_values_.back() = to_interpolate;
+    }
     u_bondi_ranges_.emplace_back(min(u_bondi), max(u_bondi));
   }
 
@@ -152,6 +164,11 @@ struct ScriPlusInterpolationManager {
     p | vector_size_;
     p | target_number_of_points_;
     p | interpolator_;
+    // the spare storage is only a cache of allocations, so is not serialized
+    if (p.isUnpacking()) {
+      spare_u_bondi_values_.clear();
+      spare_to_interpolate_values_.clear();
+    }
   }
 
  private:
@@ -167,6 +184,9 @@ struct ScriPlusInterpolationManager {
   size_t vector_size_ = 0_st;
   size_t target_number_of_points_ = 0_st;
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+  // storage of removed data, reused by `insert_data()`
+  std::vector<DataVector> spare_u_bondi_values_;
+  std::vector<VectorTypeToInterpolate> spare_to_interpolate_values_;
 };
 
 template <typename VectorTypeToInterpolate, typename Tag>
@@ -286,6 +306,13 @@ void ScriPlusInterpolationManager<VectorTypeToInterpolate,
          (*time_it).second < target_times_.front()) {
     if (times_counter > target_number_of_points_ and
         u_bondi_ranges_.size() >= 2 * target_number_of_points_) {
+      // only a few data sets are removed for each one inserted, so a bounded
+      // number of spares suffices between insertions
+      if (spare_u_bondi_values_.size() < target_number_of_points_) {
+        spare_u_bondi_values_.push_back(std::move(u_bondi_values_.front()));
+        spare_to_interpolate_values_.push_back(
+            std::move(to_interpolate_values_.front()));
+      }
       u_bondi_ranges_.pop_front();
       u_bondi_values_.pop_front();
       to_interpolate_values_.pop_front();
@@ -20,6 +20,7 @@
 #include "NumericalAlgorithms/Spectral/SwshTags.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
 #include "Utilities/TypeTraits/IsA.hpp"
 
@@ -593,6 +594,16 @@ void apply_swsh_jacobian_helper(
   db::mutate_apply<ApplySwshJacobianInplace<DerivativeTag>>(
       box, OnDemandInputsForSwshJacobian<OnDemandTags>{}(*box)...);
 }
+
+// Whether any of the `SecondDerivativeTags` differentiates the result of one of
+// the `SingleDerivativeTags`, in which case their transforms can't be batched.
+template <typename SingleDerivativeTags, typename... SecondDerivativeTags>
+constexpr bool differentiates_any_of(
+    tmpl::list<SecondDerivativeTags...> /*meta*/) {
+  return (tmpl::list_contains_v<SingleDerivativeTags,
+                                typename SecondDerivativeTags::derivative_of> or
+          ...);
+}
 }  // namespace detail
 
 /*!
@@ -620,24 +631,32 @@ void mutate_all_swsh_derivatives_for_tag(
   // to libsharp in groups. So, we supply a bulk mutate operation which takes in
   // multiple Variables from the presumed DataBox, and alters their values as
   // necessary.
+  //
+  // The second derivatives only depend on the first derivatives through the
+  // Jacobians, so the transforms for both are batched together, and only the
+  // Jacobians are applied in order.
+  using single_derivative_tags =
+      single_swsh_derivative_tags_to_compute_for_t<BondiValueTag>;
+  using second_derivative_tags =
+      second_swsh_derivative_tags_to_compute_for_t<BondiValueTag>;
+  static_assert(not detail::differentiates_any_of<single_derivative_tags>(
+                    second_derivative_tags{}),
+                "The second spin-weighted derivatives may only differentiate "
+                "quantities that are known before the first derivatives are "
+                "computed.");
   db::mutate_apply<Spectral::Swsh::AngularDerivatives<
-      single_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>>(box);
-  tmpl::for_each<single_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>(
-      [&box](auto derivative_tag_v) {
-        using derivative_tag = typename decltype(derivative_tag_v)::type;
-        detail::apply_swsh_jacobian_helper<derivative_tag>(
-            box, typename ApplySwshJacobianInplace<
-                     derivative_tag>::on_demand_argument_tags{});
-      });
-
-  db::mutate_apply<Spectral::Swsh::AngularDerivatives<
-      second_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>>(box);
-  tmpl::for_each<second_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>(
-      [&box](auto derivative_tag_v) {
-        using derivative_tag = typename decltype(derivative_tag_v)::type;
-        detail::apply_swsh_jacobian_helper<derivative_tag>(
-            box, typename ApplySwshJacobianInplace<
-                     derivative_tag>::on_demand_argument_tags{});
-      });
+      tmpl::append<single_derivative_tags, second_derivative_tags>>>(box);
+  tmpl::for_each<single_derivative_tags>([&box](auto derivative_tag_v) {
+    using derivative_tag = typename decltype(derivative_tag_v)::type;
+    detail::apply_swsh_jacobian_helper<derivative_tag>(
+        box, typename ApplySwshJacobianInplace<
+                 derivative_tag>::on_demand_argument_tags{});
+  });
+  tmpl::for_each<second_derivative_tags>([&box](auto derivative_tag_v) {
+    using derivative_tag = typename decltype(derivative_tag_v)::type;
+    detail::apply_swsh_jacobian_helper<derivative_tag>(
+        box, typename ApplySwshJacobianInplace<
+                 derivative_tag>::on_demand_argument_tags{});
+  });
 }
 }  // namespace Cce
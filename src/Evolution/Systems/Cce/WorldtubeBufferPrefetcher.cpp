@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <string>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Tracing.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Cce {
+template <typename BufferTags>
+WorldtubeBufferPrefetcher<BufferTags>::WorldtubeBufferPrefetcher(
+    const bool prefetch)
+    : prefetch_{prefetch} {}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<BufferTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end,
+    const gsl::not_null<WorldtubeBufferUpdater<BufferTags>*> buffer_updater,
+    const double time, const size_t computation_l_max,
+    const size_t interpolator_length, const size_t buffer_depth,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) {
+#if CMK_SMP
+  const bool prefetch = prefetch_;
+#else
+  const bool prefetch = false;
+#endif  // CMK_SMP
+  const DataVector& time_buffer = buffer_updater->get_time_buffer();
+
+  // The same condition under which the buffer updaters keep their buffers
+  const bool window_is_used_up =
+      *time_span_end <= interpolator_length or
+      time_buffer[*time_span_end - interpolator_length] <= time;
+  if (prefetched_ != nullptr and prefetched_->has_read and window_is_used_up) {
+    static const std::string wait_name{"Cce worldtube data prefetch wait"};
+    const auto start = std::chrono::steady_clock::now();
+    prefetched_->thread.wait();
+    const auto end = std::chrono::steady_clock::now();
+    Parallel::tracing::record(&wait_name, start, end);
+    stall_time_ += std::chrono::duration<double>(end - start).count();
+    std::swap(*buffers, prefetched_->buffers);
+    *time_span_start = prefetched_->time_span_start;
+    *time_span_end = prefetched_->time_span_end;
+    prefetched_->has_read = false;
+  }
+
+  // Reads the window if the prefetched one, if any, does not cover `time`
+  {
+    static const std::string read_name{"Cce worldtube data read"};
+    const size_t previous_time_span_start = *time_span_start;
+    const size_t previous_time_span_end = *time_span_end;
+    const auto start = std::chrono::steady_clock::now();
+    {
+      const std::lock_guard hold_lock(*hdf5_lock);
+      buffer_updater->update_buffers_for_time(
+          buffers, time_span_start, time_span_end, time, computation_l_max,
+          interpolator_length, buffer_depth);
+    }
+    if (*time_span_start != previous_time_span_start or
+        *time_span_end != previous_time_span_end) {
+      const auto end = std::chrono::steady_clock::now();
+      Parallel::tracing::record(&read_name, start, end);
+      stall_time_ += std::chrono::duration<double>(end - start).count();
+    }
+  }
+
+  if (not prefetch or *time_span_end >= time_buffer.size() or
+      *time_span_end <= interpolator_length or
+      (prefetched_ != nullptr and prefetched_->has_read)) {
+    return;
+  }
+  if (prefetched_ == nullptr) {
+    prefetched_ = std::make_unique<Prefetch>();
+    prefetched_->buffer_updater = buffer_updater->get_clone();
+  }
+  if (prefetched_->buffers.number_of_grid_points() !=
+      buffers->number_of_grid_points()) {
+    prefetched_->buffers =
+        Variables<BufferTags>{buffers->number_of_grid_points()};
+  }
+  // An empty span makes the buffer updater read the whole window, centered on
+  // the time at which the current window is used up.
+  prefetched_->time_span_start = 0;
+  prefetched_->time_span_end = 0;
+  prefetched_->has_read = true;
+  const double prefetch_time =
+      time_buffer[*time_span_end - interpolator_length];
+  prefetched_->thread.submit(
+      [state = prefetched_.get(), prefetch_time, computation_l_max,
+       interpolator_length, buffer_depth, hdf5_lock]() {
+        static const std::string prefetch_name{"Cce worldtube data prefetch"};
+        const Parallel::tracing::Span span{&prefetch_name};
+        const std::lock_guard hold_lock(*hdf5_lock);
+        state->buffer_updater->update_buffers_for_time(
+            make_not_null(&state->buffers),
+            make_not_null(&state->time_span_start),
+            make_not_null(&state->time_span_end), prefetch_time,
+            computation_l_max, interpolator_length, buffer_depth);
+      },
+      1);
+}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::pup(PUP::er& p) {
+  p | prefetch_;
+  p | stall_time_;
+  if (p.isUnpacking()) {
+    // The data managers read their buffers again after unpacking.
+    prefetched_ = nullptr;
+  }
+}
+
+template class WorldtubeBufferPrefetcher<cce_metric_input_tags>;
+template class WorldtubeBufferPrefetcher<cce_bondi_input_tags>;
+}  // namespace Cce
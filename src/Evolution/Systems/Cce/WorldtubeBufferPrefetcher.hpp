@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/WriterThread.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Cce {
+/*!
+ * \brief Refills the buffers of a `WorldtubeDataManager` from its
+ * `WorldtubeBufferUpdater`, optionally reading the next window of times in
+ * the background.
+ *
+ * \details Without prefetching, `update_buffers_for_time()` calls the buffer
+ * updater, which reads the window of times around `time`, e.g. from the
+ * worldtube H5 file, once the current window is used up. The CCE evolution
+ * waits for every such read.
+ *
+ * With prefetching, as soon as a window is in use the window that follows it
+ * is read into a second set of buffers on a background
+ * `Parallel::WriterThread`, using a clone of the buffer updater. Once the
+ * current window is used up the two are swapped, so the evolution only waits
+ * if the read has not finished yet. The length of the windows is set by the
+ * `buffer_depth` of the data manager. If the prefetched window does not cover
+ * the requested time, e.g. because the time step is longer than a window, the
+ * buffer updater reads the window itself as without prefetching. The
+ * background read holds the `hdf5_lock` like the reads on the main thread.
+ *
+ * The wall time spent waiting for the data is accumulated in `stall_time()`,
+ * and the reads and the waits are recorded as `Parallel::tracing` spans.
+ *
+ * \note Without SMP the `Parallel::NodeLock` does not lock, so the reads are
+ * always done synchronously.
+ */
+template <typename BufferTags>
+class WorldtubeBufferPrefetcher {
+ public:
+  WorldtubeBufferPrefetcher() = default;
+  explicit WorldtubeBufferPrefetcher(bool prefetch);
+
+  /// Update the `buffers`, `time_span_start`, and `time_span_end` to be
+  /// appropriate for `time`, like
+  /// `WorldtubeBufferUpdater::update_buffers_for_time()`.
+  void update_buffers_for_time(
+      gsl::not_null<Variables<BufferTags>*> buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end,
+      gsl::not_null<WorldtubeBufferUpdater<BufferTags>*> buffer_updater,
+      double time, size_t computation_l_max, size_t interpolator_length,
+      size_t buffer_depth, gsl::not_null<Parallel::NodeLock*> hdf5_lock);
+
+  /// Whether the next window is read in the background
+  bool prefetch() const { return prefetch_; }
+
+  /// The wall time in seconds spent waiting for worldtube data to be read
+  double stall_time() const { return stall_time_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct Prefetch {
+    std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> buffer_updater;
+    Variables<BufferTags> buffers;
+    size_t time_span_start = 0;
+    size_t time_span_end = 0;
+    bool has_read = false;
+    // Declared last so that it is destroyed, and the read finished, before the
+    // data the read uses.
+    Parallel::WriterThread thread{};
+  };
+
+  bool prefetch_ = false;
+  double stall_time_ = 0.0;
+  std::unique_ptr<Prefetch> prefetched_{};
+};
+}  // namespace Cce
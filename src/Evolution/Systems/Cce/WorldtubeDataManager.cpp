@@ -6,7 +6,6 @@
 #include <complex>
 #include <cstddef>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 #include "DataStructures/ComplexModalVector.hpp"
@@ -17,6 +16,7 @@
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/SpecBoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
@@ -30,13 +30,14 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization)
+    const bool fix_spec_normalization, const bool prefetch_buffers)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
+      prefetcher_{prefetch_buffers},
       interpolator_{std::move(interpolator)} {
   if (UNLIKELY(
           buffer_updater_->get_time_buffer().size() <
@@ -77,14 +78,11 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  prefetcher_.update_buffers_for_time(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), make_not_null(buffer_updater_.get()),
+      time, l_max_, interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_, hdf5_lock);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -238,7 +236,8 @@ std::unique_ptr<WorldtubeDataManager> MetricWorldtubeDataManager::get_clone()
     const {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      prefetcher_.prefetch());
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span() const {
@@ -253,6 +252,7 @@ void MetricWorldtubeDataManager::pup(PUP::er& p) {
   p | buffer_depth_;
   p | interpolator_;
   p | fix_spec_normalization_;
+  p | prefetcher_;
   if (p.isUnpacking()) {
     time_span_start_ = 0;
     time_span_end_ = 0;
@@ -270,12 +270,14 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch_buffers)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
+      prefetcher_{prefetch_buffers},
       interpolator_{std::move(interpolator)} {
   if (UNLIKELY(
           buffer_updater_->get_time_buffer().size() <
@@ -314,14 +316,11 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  prefetcher_.update_buffers_for_time(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), make_not_null(buffer_updater_.get()),
+      time, l_max_, interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_, hdf5_lock);
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -423,7 +422,7 @@ std::unique_ptr<WorldtubeDataManager> BondiWorldtubeDataManager::get_clone()
     const {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), prefetcher_.prefetch());
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span() const {
@@ -437,6 +436,7 @@ void BondiWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  p | prefetcher_;
   if (p.isUnpacking()) {
     time_span_start_ = 0;
     time_span_end_ = 0;
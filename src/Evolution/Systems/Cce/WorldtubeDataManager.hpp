@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -47,6 +48,10 @@ class BondiWorldtubeDataManager;
  *   `std::pair` of indices that represent the start and end point of the
  *   underlying data source. This is primarily used for monitoring the frequency
  *   and size of the buffer updates.
+ * - `WorldtubeDataManager::get_stall_time()`: The override should return the
+ *   wall time in seconds that the buffer updates have waited for data to be
+ *   read. This is used for monitoring whether the reads slow down the
+ *   evolution.
  */
 class WorldtubeDataManager : public PUP::able {
  public:
@@ -66,6 +71,8 @@ class WorldtubeDataManager : public PUP::able {
   virtual size_t get_l_max() const = 0;
 
   virtual std::pair<size_t, size_t> get_time_span() const = 0;
+
+  virtual double get_stall_time() const = 0;
 };
 
 /*!
@@ -77,6 +84,8 @@ class WorldtubeDataManager : public PUP::able {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_buffers` is `true`, the next buffer is read in the background
+ * while the current one is used, see `Cce::WorldtubeBufferPrefetcher`.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
@@ -91,7 +100,7 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization);
+      bool fix_spec_normalization, bool prefetch_buffers = false);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -130,6 +139,10 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the wall time the buffer updates have waited for reads, for
+  /// diagnostics
+  double get_stall_time() const override { return prefetcher_.stall_time(); }
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -154,6 +167,9 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
 
   size_t buffer_depth_ = 0;
 
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<cce_metric_input_tags> prefetcher_;
+
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
 };
 
@@ -166,6 +182,8 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_buffers` is `true`, the next buffer is read in the background
+ * while the current one is used, see `Cce::WorldtubeBufferPrefetcher`.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation. This version
@@ -183,7 +201,8 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
       std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch_buffers = false);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -221,6 +240,10 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the wall time the buffer updates have waited for reads, for
+  /// diagnostics
+  double get_stall_time() const override { return prefetcher_.stall_time(); }
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -243,6 +266,9 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
 
   size_t buffer_depth_ = 0;
 
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<cce_bondi_input_tags> prefetcher_;
+
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
 };
 }  // namespace Cce
@@ -161,9 +161,18 @@ void TimeDerivative<Dim>::apply(
                           inv_conformal_spatial_metric,
                           conformal_spatial_metric);
 
+  // Pointwise scalar quantities are computed in a single pass over the grid
+  // points rather than one pass per quantity, so each input is loaded only once
   const size_t num_points = get_size(get(ln_conformal_factor));
   for (size_t i = 0; i < num_points; i++) {
     get(*conformal_factor_squared)[i] = exp(2.0 * get(ln_conformal_factor)[i]);
+    get(*half_conformal_factor_squared)[i] =
+        0.5 * get(*conformal_factor_squared)[i];
+    get(*lapse)[i] = exp(get(ln_lapse)[i]);
+    get(*k_minus_2_theta_c)[i] =
+        get(trace_extrinsic_curvature)[i] - 2.0 * c * get(theta)[i];
+    get(*k_minus_k0_minus_2_theta_c)[i] =
+        get(*k_minus_2_theta_c)[i] - get(k_0)[i];
   }
 
   ::tenex::evaluate<ti::I, ti::J>(
@@ -175,10 +184,6 @@ void TimeDerivative<Dim>::apply(
                        (*inv_conformal_spatial_metric)(ti::I, ti::K) *
                        (*inv_conformal_spatial_metric)(ti::J, ti::L));
 
-  for (size_t i = 0; i < num_points; i++) {
-    get(*lapse)[i] = exp(get(ln_lapse)[i]);
-  }
-
   if (slicing_condition_type == SlicingConditionType::Harmonic) {
     get(*slicing_condition) = 1.0;
     get(*d_slicing_condition) = 0.0;
@@ -277,10 +282,6 @@ void TimeDerivative<Dim>::apply(
       spatial_z4_constraint, conformal_spatial_metric,
       *gamma_hat_minus_contracted_conformal_christoffel);
 
-  // temp for eq 25
-  ::tenex::evaluate(half_conformal_factor_squared,
-                    0.5 * (*conformal_factor_squared)());
-
   // eq 25
   ::Ccz4::upper_spatial_z4_constraint(
       upper_spatial_z4_constraint, *half_conformal_factor_squared,
@@ -333,10 +334,6 @@ void TimeDerivative<Dim>::apply(
       conformal_spatial_metric(ti::m, ti::i) *
           (*symmetrized_d_field_b)(ti::k, ti::j, ti::M));
 
-  ::tenex::evaluate<ti::i, ti::j>(
-      conformal_metric_times_trace_a_tilde,
-      conformal_spatial_metric(ti::i, ti::j) * (*trace_a_tilde)());
-
   ::tenex::evaluate<ti::k>(inv_conformal_metric_times_d_a_tilde,
                            (*inv_conformal_spatial_metric)(ti::I, ti::J) *
                                d_a_tilde(ti::k, ti::i, ti::j));
@@ -344,28 +341,39 @@ void TimeDerivative<Dim>::apply(
   ::tenex::evaluate<ti::i, ti::j>(
       a_tilde_times_field_b, a_tilde(ti::k, ti::i) * field_b(ti::j, ti::K));
 
-  ::tenex::evaluate<ti::i, ti::j>(
-      a_tilde_minus_one_third_conformal_metric_times_trace_a_tilde,
-      a_tilde(ti::i, ti::j) -
-          one_third * (*conformal_metric_times_trace_a_tilde)(ti::i, ti::j));
-
-  ::tenex::evaluate(k_minus_2_theta_c,
-                    trace_extrinsic_curvature() - 2.0 * c * theta());
-
-  ::tenex::evaluate(k_minus_k0_minus_2_theta_c, (*k_minus_2_theta_c)() - k_0());
-
-  ::tenex::evaluate<ti::i, ti::j>(lapse_times_a_tilde,
-                                  (*lapse)() * a_tilde(ti::i, ti::j));
+  // The products of symmetric rank-2 tensors with pointwise scalars share
+  // their inputs, so they are computed in a single pass per component
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = i; j < Dim; ++j) {
+      const DataVector& metric_ij = conformal_spatial_metric.get(i, j);
+      const DataVector& a_tilde_ij = a_tilde.get(i, j);
+      DataVector& metric_times_trace_a_tilde_ij =
+          conformal_metric_times_trace_a_tilde->get(i, j);
+      DataVector& trace_free_a_tilde_ij =
+          a_tilde_minus_one_third_conformal_metric_times_trace_a_tilde->get(
+              i, j);
+      DataVector& lapse_times_a_tilde_ij = lapse_times_a_tilde->get(i, j);
+      DataVector& lapse_times_metric_ij =
+          lapse_times_conformal_spatial_metric->get(i, j);
+      DataVector& inv_tau_times_metric_ij =
+          inv_tau_times_conformal_metric->get(i, j);
+      for (size_t s = 0; s < num_points; ++s) {
+        metric_times_trace_a_tilde_ij[s] =
+            metric_ij[s] * get(*trace_a_tilde)[s];
+        trace_free_a_tilde_ij[s] =
+            a_tilde_ij[s] - one_third * metric_times_trace_a_tilde_ij[s];
+        lapse_times_a_tilde_ij[s] = get(*lapse)[s] * a_tilde_ij[s];
+        lapse_times_metric_ij[s] = get(*lapse)[s] * metric_ij[s];
+        inv_tau_times_metric_ij[s] = one_over_relaxation_time * metric_ij[s];
+      }
+    }
+  }
 
   tenex::evaluate<ti::k, ti::i, ti::j>(
       lapse_times_d_a_tilde, (*lapse)() * d_a_tilde(ti::k, ti::i, ti::j));
 
   ::tenex::evaluate<ti::k>(lapse_times_field_a, (*lapse)() * field_a(ti::k));
 
-  ::tenex::evaluate<ti::i, ti::j>(
-      lapse_times_conformal_spatial_metric,
-      (*lapse)() * conformal_spatial_metric(ti::i, ti::j));
-
   ::tenex::evaluate(
       lapse_times_ricci_scalar_plus_divergence_z4_constraint,
       (*lapse)() * (*ricci_scalar_plus_divergence_z4_constraint)());
@@ -373,10 +381,6 @@ void TimeDerivative<Dim>::apply(
   ::tenex::evaluate<ti::I>(shift_times_deriv_gamma_hat,
                            shift(ti::K) * d_gamma_hat(ti::k, ti::I));
 
-  ::tenex::evaluate<ti::i, ti::j>(
-      inv_tau_times_conformal_metric,
-      one_over_relaxation_time * conformal_spatial_metric(ti::i, ti::j));
-
   // time derivative computation: eq 12a - 12m
 
   // eq 12a : time derivative of the conformal spatial metric
@@ -3,7 +3,6 @@
 
 #pragma once
 
-#include <boost/math/special_functions/spherical_harmonic.hpp>
 #include <cstddef>
 #include <optional>
 #include <vector>
@@ -27,7 +26,6 @@
 #include "Evolution/Systems/CurvedScalarWave/Worldtube/Tags.hpp"
 #include "NumericalAlgorithms/LinearOperators/DefiniteIntegral.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
-#include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -51,16 +49,18 @@ namespace CurvedScalarWave::Worldtube::Actions {
  * \details The regular field is obtained by subtracting the singular/puncture
  * field from the numerical DG field.
  * All spherical harmonics are computed for \f$l <= n\f$, where \f$n\f$ is the
- * worldtube expansion order. The projection is done by integrating over the DG
- * grid of the element face using \ref definite_integral with the euclidean area
- * element. The worldtube adds up all integrals from the different elements to
- * obtain the integral over the entire sphere.
+ * worldtube expansion order. They are taken from
+ * `Worldtube::Tags::FaceSphericalHarmonics` so they are only evaluated once.
+ * The projection is done by integrating over the DG grid of the element face
+ * using \ref definite_integral with the euclidean area element. The worldtube
+ * adds up all integrals from the different elements to obtain the integral over
+ * the entire sphere.
  *
  * DataBox:
  * - Uses:
  *    - `tags_to_slice_on_face`
  *    - `Worldtube::Tags::ExpansionOrder`
- *    - `Worldtube::Tags::FaceCoordinates<Dim, Frame::Grid, true>`
+ *    - `Worldtube::Tags::FaceSphericalHarmonics<Dim>`
  *    - `Worldtube::Tags::PunctureField`
  *    - `Worldtube::Tags::ExcisionSphere`
  *    - `Tags::TimeStepId`
@@ -172,42 +172,31 @@ struct SendToWorldtube {
 
       psi_regular_times_det *= get(area_element);
       dt_psi_regular_times_det *= get(area_element);
-      const auto& centered_face_coords =
-          db::get<Tags::FaceCoordinates<Dim, Frame::Grid, true>>(box);
-      ASSERT(centered_face_coords.has_value(),
-             "Should be an abutting element here, but face coords are not "
-             "calculated!");
-      const auto& x = get<0>(centered_face_coords.value());
-      const auto& y = get<1>(centered_face_coords.value());
-      const auto& z = get<2>(centered_face_coords.value());
+      const auto& spherical_harmonics =
+          db::get<Tags::FaceSphericalHarmonics<Dim>>(box);
+      ASSERT(spherical_harmonics.has_value(),
+             "Should be an abutting element here, but the spherical harmonics "
+             "are not calculated!");
 
       const size_t order = db::get<Worldtube::Tags::ExpansionOrder>(box);
       const size_t num_modes = (order + 1) * (order + 1);
+      ASSERT(spherical_harmonics->size() == num_modes,
+             "Expected " << num_modes << " spherical harmonics but got "
+                         << spherical_harmonics->size());
       Variables<tags_to_send> Ylm_coefs(num_modes);
-      // re-use allocations
-      auto& theta = get<0, 2>(face_inv_jacobian);
-      auto& phi = get<1, 0>(face_inv_jacobian);
-      auto& spherical_harmonic = get<1, 1>(face_inv_jacobian);
-
-      theta = atan2(hypot(x, y), z);
-      phi = atan2(y, x);
-      size_t index = 0;
+      // re-use allocation
+      auto& integrand = get<0, 2>(face_inv_jacobian);
       // project onto spherical harmonics
-      for (size_t l = 0; l <= order; ++l) {
-        for (int m = -l; m <= static_cast<int>(l); ++m, ++index) {
-          spherical_harmonic = ylm::real_spherical_harmonic(theta, phi, l, m);
-          get(get<CurvedScalarWave::Tags::Psi>(Ylm_coefs)).at(index) =
-              definite_integral(psi_regular_times_det * spherical_harmonic,
-                                face_mesh);
-          get(get<::Tags::dt<CurvedScalarWave::Tags::Psi>>(Ylm_coefs))
-              .at(index) = definite_integral(
-              dt_psi_regular_times_det * spherical_harmonic, face_mesh);
-        }
+      for (size_t index = 0; index < num_modes; ++index) {
+        const DataVector& spherical_harmonic =
+            spherical_harmonics.value()[index];
+        integrand = psi_regular_times_det * spherical_harmonic;
+        get(get<CurvedScalarWave::Tags::Psi>(Ylm_coefs))[index] =
+            definite_integral(integrand, face_mesh);
+        integrand = dt_psi_regular_times_det * spherical_harmonic;
+        get(get<::Tags::dt<CurvedScalarWave::Tags::Psi>>(Ylm_coefs))[index] =
+            definite_integral(integrand, face_mesh);
       }
-      ASSERT(index == num_modes,
-             "Internal indexing error. "
-                 << num_modes << " modes should have been calculated but "
-                 << index << " modes were computed.");
 
       auto& worldtube_component = Parallel::get_parallel_component<
           Worldtube::WorldtubeSingleton<Metavariables>>(cache);
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 #include "Evolution/Systems/CurvedScalarWave/Worldtube/Tags.hpp"
 
@@ -17,6 +18,7 @@
 #include "Domain/Structure/IndexToSliceAt.hpp"
 #include "Evolution/Systems/CurvedScalarWave/Worldtube/PunctureField.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
@@ -101,6 +103,37 @@ void FaceCoordinatesCompute<Dim, Frame, Centered>::function(
 #pragma GCC diagnostic pop
 #endif  // defined(__GNUC__) && !defined(__clang__)
 
+template <size_t Dim>
+void FaceSphericalHarmonicsCompute<Dim>::function(
+    const gsl::not_null<return_type*> result,
+    const std::optional<tnsr::I<DataVector, Dim, Frame::Grid>>&
+        centered_face_coords,
+    const size_t expansion_order) {
+  if (not centered_face_coords.has_value()) {
+    result->reset();
+    return;
+  }
+  const auto& x = get<0>(centered_face_coords.value());
+  const auto& y = get<1>(centered_face_coords.value());
+  const auto& z = get<2>(centered_face_coords.value());
+  const DataVector theta = atan2(hypot(x, y), z);
+  const DataVector phi = atan2(y, x);
+  const size_t num_modes = (expansion_order + 1) * (expansion_order + 1);
+  if (not result->has_value()) {
+    result->emplace();
+  }
+  result->value().resize(num_modes);
+  size_t index = 0;
+  for (size_t l = 0; l <= expansion_order; ++l) {
+    for (int m = -static_cast<int>(l); m <= static_cast<int>(l);
+         ++m, ++index) {
+      result->value()[index].destructive_resize(x.size());
+      ylm::real_spherical_harmonic(make_not_null(&result->value()[index]),
+                                   theta, phi, l, m);
+    }
+  }
+}
+
 template <size_t Dim>
 void PunctureFieldCompute<Dim>::function(
     const gsl::not_null<return_type*> result,
@@ -138,6 +171,7 @@ void InertialParticlePositionCompute<Dim>::function(
 }
 
 template struct InertialParticlePositionCompute<3>;
+template struct FaceSphericalHarmonicsCompute<3>;
 template struct PunctureFieldCompute<3>;
 
 template struct FaceCoordinatesCompute<3, Frame::Grid, true>;
@@ -9,6 +9,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -271,6 +272,39 @@ struct ExpansionOrder : db::SimpleTag {
   static size_t create_from_options(const size_t order) { return order; }
 };
 
+/// @{
+/*!
+ * \brief The real spherical harmonics \f$Y_{lm}\f$ with \f$l \leq n\f$ on the
+ * grid points of an element face abutting the worldtube, where \f$n\f$ is the
+ * worldtube expansion order. The modes are ordered by increasing \f$l\f$ and
+ * then by increasing \f$m\f$.
+ *
+ * \details The harmonics are evaluated at the grid coordinates centered on the
+ * worldtube, which don't change during the evolution. So they are computed only
+ * once instead of every time the regular field is projected onto them in
+ * `CurvedScalarWave::Worldtube::Actions::SendToWorldtube`. If the element does
+ * not abut the worldtube, this holds std::nullopt.
+ */
+template <size_t Dim>
+struct FaceSphericalHarmonics : db::SimpleTag {
+  using type = std::optional<std::vector<DataVector>>;
+};
+
+template <size_t Dim>
+struct FaceSphericalHarmonicsCompute : FaceSphericalHarmonics<Dim>,
+                                       db::ComputeTag {
+  using base = FaceSphericalHarmonics<Dim>;
+  using argument_tags =
+      tmpl::list<FaceCoordinates<Dim, Frame::Grid, true>, ExpansionOrder>;
+  using return_type = std::optional<std::vector<DataVector>>;
+  static void function(
+      gsl::not_null<return_type*> result,
+      const std::optional<tnsr::I<DataVector, Dim, Frame::Grid>>&
+          centered_face_coords,
+      size_t expansion_order);
+};
+/// @}
+
 /// @{
 /*!
  * Computes the puncture field on an element face abutting the worldtube.
@@ -3,18 +3,16 @@
 
 #include "Evolution/Systems/ForceFree/ElectricCurrentDensity.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/LeviCivitaIterator.hpp"
-#include "DataStructures/Tags/TempTensor.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "DataStructures/Variables.hpp"
-#include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
-#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace ForceFree {
 
@@ -31,69 +29,79 @@ void tilde_j_impl(
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric) {
   static_assert(IncludeDriftCurrent or IncludeParallelCurrent);
 
-  Variables<tmpl::list<::Tags::Tempi<0, 3>, ::Tags::Tempi<1, 3>,
-                       ::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                       ::Tags::TempScalar<2>>>
-      buffer{get(lapse).size()};
-
-  // compute one-forms of TildeE and TildeB in advance to reduce the number of
-  // dot products using spatial metric (which are slower than dot products
-  // without using spatial metric)
-  auto& tilde_e_one_form = get<::Tags::Tempi<0, 3>>(buffer);
-  auto& tilde_b_one_form = get<::Tags::Tempi<1, 3>>(buffer);
-  raise_or_lower_index(make_not_null(&tilde_e_one_form), tilde_e,
-                       spatial_metric);
-  raise_or_lower_index(make_not_null(&tilde_b_one_form), tilde_b,
-                       spatial_metric);
-
-  // Compute \tilde{B}^2 = \tilde{B}^j \tilde{B}_j. We need this quantity for
-  // both drift (explicit, non-stiff) and parallel (implicit, stiff) components
-  // of J^i.
-  auto& tilde_b_squared = get<::Tags::TempScalar<0>>(buffer);
-  dot_product(make_not_null(&tilde_b_squared), tilde_b, tilde_b_one_form);
-
-  if constexpr (IncludeParallelCurrent) {
-    (void)tilde_q;                  // avoid compiler warnings
-    (void)sqrt_det_spatial_metric;  // avoid compiler warnings
-
-    auto& tilde_e_squared = get<::Tags::TempScalar<1>>(buffer);
-    auto& tilde_e_dot_tilde_b = get<::Tags::TempScalar<2>>(buffer);
-    dot_product(make_not_null(&tilde_e_squared), tilde_e, tilde_e_one_form);
-    dot_product(make_not_null(&tilde_e_dot_tilde_b), tilde_e, tilde_b_one_form);
-
+  // All terms are evaluated in a single pass over the grid points so the
+  // one-forms, squares, and the overall factor stay in registers instead of
+  // being written to temporary buffers, and there is a single division per
+  // point for each of the drift and parallel parts.
+  const size_t number_of_points = get(lapse).size();
+  set_number_of_grid_points(tilde_j, number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    // compute one-forms of TildeE and TildeB in advance to reduce the number
+    // of contractions with the spatial metric
+    std::array<double, 3> tilde_e_one_form{};
+    std::array<double, 3> tilde_b_one_form{};
     for (size_t i = 0; i < 3; ++i) {
-      (*tilde_j).get(i) =
-          parallel_conductivity *
-          (get(tilde_e_dot_tilde_b) * tilde_b.get(i) +
-           max(get(tilde_e_squared) - get(tilde_b_squared), 0.0) *
-               tilde_e.get(i));
+      for (size_t j = 0; j < 3; ++j) {
+        const double spatial_metric_ij = spatial_metric.get(i, j)[s];
+        gsl::at(tilde_e_one_form, i) += spatial_metric_ij * tilde_e.get(j)[s];
+        gsl::at(tilde_b_one_form, i) += spatial_metric_ij * tilde_b.get(j)[s];
+      }
     }
-  } else {
-    // tilde_j should be initialized to zero before the summation performed in
-    // the next `if constexpr` block
+
+    // Compute \tilde{B}^2 = \tilde{B}^j \tilde{B}_j. We need this quantity
+    // for both drift (explicit, non-stiff) and parallel (implicit, stiff)
+    // components of J^i.
+    double tilde_b_squared = 0.0;
     for (size_t i = 0; i < 3; ++i) {
-      (*tilde_j).get(i) = 0;
+      tilde_b_squared += tilde_b.get(i)[s] * gsl::at(tilde_b_one_form, i);
+    }
+    const double lapse_over_tilde_b_squared = get(lapse)[s] / tilde_b_squared;
+
+    std::array<double, 3> result{};
+    if constexpr (IncludeParallelCurrent) {
+      double tilde_e_squared = 0.0;
+      double tilde_e_dot_tilde_b = 0.0;
+      for (size_t i = 0; i < 3; ++i) {
+        tilde_e_squared += tilde_e.get(i)[s] * gsl::at(tilde_e_one_form, i);
+        tilde_e_dot_tilde_b +=
+            tilde_e.get(i)[s] * gsl::at(tilde_b_one_form, i);
+      }
+      const double parallel_factor =
+          parallel_conductivity * lapse_over_tilde_b_squared;
+      const double rectified_e_squared_minus_b_squared =
+          std::max(tilde_e_squared - tilde_b_squared, 0.0);
+      for (size_t i = 0; i < 3; ++i) {
+        gsl::at(result, i) =
+            parallel_factor *
+            (tilde_e_dot_tilde_b * tilde_b.get(i)[s] +
+             rectified_e_squared_minus_b_squared * tilde_e.get(i)[s]);
+      }
+    } else {
+      (void)parallel_conductivity;  // avoid compiler warnings
     }
-  }
 
-  if constexpr (IncludeDriftCurrent) {
-    (void)parallel_conductivity;  // avoid compiler warnings
-
-    for (LeviCivitaIterator<3> it; it; ++it) {
-      const auto& i = it[0];
-      const auto& j = it[1];
-      const auto& k = it[2];
-      (*tilde_j).get(i) +=
-          it.sign() * get(tilde_q) * tilde_e_one_form.get(j) *
-          tilde_b_one_form.get(k) /
-          get(sqrt_det_spatial_metric);  // the extra 1/sqrt{gamma} factor comes
-                                         // from the spatial Levi-Civita tensor
+    if constexpr (IncludeDriftCurrent) {
+      // the extra 1/sqrt{gamma} factor comes from the spatial Levi-Civita
+      // tensor
+      const double drift_factor = get(tilde_q)[s] *
+                                  lapse_over_tilde_b_squared /
+                                  get(sqrt_det_spatial_metric)[s];
+      for (LeviCivitaIterator<3> it; it; ++it) {
+        const auto& i = it[0];
+        const auto& j = it[1];
+        const auto& k = it[2];
+        gsl::at(result, i) += it.sign() * drift_factor *
+                              gsl::at(tilde_e_one_form, j) *
+                              gsl::at(tilde_b_one_form, k);
+      }
+    } else {
+      (void)tilde_q;                  // avoid compiler warnings
+      (void)sqrt_det_spatial_metric;  // avoid compiler warnings
     }
-  }
 
-  // overall factor
-  for (size_t i = 0; i < 3; ++i) {
-    (*tilde_j).get(i) *= get(lapse) / get(tilde_b_squared);
+    for (size_t i = 0; i < 3; ++i) {
+      tilde_j->get(i)[s] = gsl::at(result, i);
+    }
   }
 }
 
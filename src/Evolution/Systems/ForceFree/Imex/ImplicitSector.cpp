@@ -0,0 +1,105 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/ForceFree/Imex/ImplicitSector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/ForceFree/ElectricCurrentDensity.hpp"
+#include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace ForceFree::Imex {
+void ImplicitSector::source(
+    const gsl::not_null<
+        Variables<db::wrap_tags_in<::Tags::dt, variables_tags>>*>
+        source,
+    const Variables<variables_tags>& vars, const double parallel_conductivity,
+    const Scalar<DataVector>& lapse,
+    const Scalar<DataVector>& sqrt_det_spatial_metric,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric) {
+  auto& source_tilde_e = get<::Tags::dt<Tags::TildeE>>(*source);
+  ComputeParallelTildeJ::apply(
+      make_not_null(&source_tilde_e), get<Tags::TildeQ>(vars),
+      get<Tags::TildeE>(vars), get<Tags::TildeB>(vars), parallel_conductivity,
+      lapse, sqrt_det_spatial_metric, spatial_metric);
+  for (size_t i = 0; i < 3; ++i) {
+    source_tilde_e.get(i) *= -1.0;
+    get<::Tags::dt<Tags::TildeB>>(*source).get(i) = 0.0;
+  }
+  get(get<::Tags::dt<Tags::TildePsi>>(*source)) = 0.0;
+  get(get<::Tags::dt<Tags::TildePhi>>(*source)) = 0.0;
+  get(get<::Tags::dt<Tags::TildeQ>>(*source)) = 0.0;
+}
+
+void ImplicitSector::solve(
+    const gsl::not_null<Variables<variables_tags>*> vars, const double weight,
+    const double parallel_conductivity, const Scalar<DataVector>& lapse,
+    const Scalar<DataVector>& /*sqrt_det_spatial_metric*/,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric) {
+  auto& tilde_e = get<Tags::TildeE>(*vars);
+  const auto& tilde_b = get<Tags::TildeB>(*vars);
+  const size_t number_of_points = vars->number_of_grid_points();
+  for (size_t s = 0; s < number_of_points; ++s) {
+    std::array<double, 3> tilde_b_one_form{};
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        gsl::at(tilde_b_one_form, i) +=
+            spatial_metric.get(i, j)[s] * tilde_b.get(j)[s];
+      }
+    }
+    double tilde_b_squared = 0.0;
+    double tilde_e_dot_tilde_b = 0.0;
+    double tilde_e_squared = 0.0;
+    for (size_t i = 0; i < 3; ++i) {
+      tilde_b_squared += tilde_b.get(i)[s] * gsl::at(tilde_b_one_form, i);
+      tilde_e_dot_tilde_b += tilde_e.get(i)[s] * gsl::at(tilde_b_one_form, i);
+      for (size_t j = 0; j < 3; ++j) {
+        tilde_e_squared +=
+            spatial_metric.get(i, j)[s] * tilde_e.get(i)[s] * tilde_e.get(j)[s];
+      }
+    }
+
+    const double a =
+        weight * parallel_conductivity * get(lapse)[s] / tilde_b_squared;
+    // Squares of the components of the explicit solution parallel and
+    // perpendicular to \tilde{B}^i
+    const double e_parallel_squared =
+        square(tilde_e_dot_tilde_b) / tilde_b_squared;
+    const double e_perp_squared =
+        std::max(tilde_e_squared - e_parallel_squared, 0.0);
+    const auto e_squared_minus_b_squared = [&](const double m) {
+      return e_parallel_squared / square(1.0 + a * (m + tilde_b_squared)) +
+             e_perp_squared / square(1.0 + a * m) - tilde_b_squared;
+    };
+
+    double m = 0.0;
+    const double upper_bound = e_squared_minus_b_squared(0.0);
+    if (upper_bound > 0.0) {
+      const auto f = [&e_squared_minus_b_squared](const double x) {
+        return e_squared_minus_b_squared(x) - x;
+      };
+      const double f_at_upper_bound = f(upper_bound);
+      m = f_at_upper_bound >= 0.0
+              ? upper_bound
+              : RootFinder::toms748(f, 0.0, upper_bound, upper_bound,
+                                    f_at_upper_bound, 1.0e-14 * upper_bound,
+                                    1.0e-14);
+    }
+
+    const double parallel_part =
+        a * tilde_e_dot_tilde_b / (1.0 + a * (m + tilde_b_squared));
+    const double perp_damping = 1.0 / (1.0 + a * m);
+    for (size_t i = 0; i < 3; ++i) {
+      tilde_e.get(i)[s] = perp_damping * (tilde_e.get(i)[s] -
+                                          parallel_part * tilde_b.get(i)[s]);
+    }
+  }
+}
+}  // namespace ForceFree::Imex
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/ForceFree/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+namespace ForceFree::Imex {
+/*!
+ * \brief The stiff parallel current \f$\tilde{J}^i_\mathrm{parallel}\f$ of the
+ * GRFFE system, evolved implicitly with an `ImexTimeStepper`.
+ *
+ * \details Implements the `implicit_sector` interface documented at
+ * `has_implicit_sector_v`. The source is
+ * \f$S(\tilde{E}^i) = -\tilde{J}^i_\mathrm{parallel}\f$, see
+ * `ForceFree::ComputeParallelTildeJ`, and zero for the other evolved
+ * variables. The explicit sources in `ForceFree::Sources` contain only the
+ * drift current, so the step size is not limited by the parallel
+ * conductivity \f$\eta\f$ when this sector is used.
+ *
+ * The implicit equation
+ * \f$\tilde{E}^i = \tilde{E}^i_* + w S(\tilde{E}^i)\f$ is solved pointwise.
+ * With \f$a = w \eta \alpha / \tilde{B}^2\f$ and
+ * \f$m = \mathcal{R}(\tilde{E}^2 - \tilde{B}^2)\f$ it reads
+ *
+ * \f{align*}
+ *  \tilde{E}^i = \tilde{E}^i_* - a \left[(\tilde{E}_j\tilde{B}^j)\tilde{B}^i
+ *    + m \tilde{E}^i\right].
+ * \f}
+ *
+ * Its components parallel and perpendicular to \f$\tilde{B}^i\f$ decouple and
+ * are damped by the factors \f$1 + a (m + \tilde{B}^2)\f$ and \f$1 + a m\f$,
+ * respectively. So the only unknown is the scalar \f$m\f$. It vanishes if the
+ * field is magnetically dominated after the parallel component is damped, and
+ * is otherwise found with a bracketed root find of
+ * \f$\tilde{E}^2(m) - \tilde{B}^2 - m = 0\f$ on
+ * \f$[0, \tilde{E}^2(0) - \tilde{B}^2]\f$.
+ *
+ * To evolve the parallel current implicitly, add
+ * `using implicit_sector = ForceFree::Imex::ImplicitSector;` to the system and
+ * use an IMEX time stepper, see `has_implicit_sector_v` for the requirements
+ * on the DataBox.
+ */
+struct ImplicitSector {
+  using variables_tags = tmpl::list<Tags::TildeE, Tags::TildeB, Tags::TildePsi,
+                                    Tags::TildePhi, Tags::TildeQ>;
+
+  using argument_tags =
+      tmpl::list<Tags::ParallelConductivity, gr::Tags::Lapse<DataVector>,
+                 gr::Tags::SqrtDetSpatialMetric<DataVector>,
+                 gr::Tags::SpatialMetric<DataVector, 3>>;
+
+  static void source(
+      gsl::not_null<Variables<db::wrap_tags_in<::Tags::dt, variables_tags>>*>
+          source,
+      const Variables<variables_tags>& vars, double parallel_conductivity,
+      const Scalar<DataVector>& lapse,
+      const Scalar<DataVector>& sqrt_det_spatial_metric,
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric);
+
+  static void solve(gsl::not_null<Variables<variables_tags>*> vars,
+                    double weight, double parallel_conductivity,
+                    const Scalar<DataVector>& lapse,
+                    const Scalar<DataVector>& sqrt_det_spatial_metric,
+                    const tnsr::ii<DataVector, 3, Frame::Inertial>&
+                        spatial_metric);
+};
+}  // namespace ForceFree::Imex
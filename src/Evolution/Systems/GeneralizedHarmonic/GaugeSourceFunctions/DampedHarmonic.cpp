@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <optional>
 
 #include "DataStructures/Blaze/IntegerPow.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -87,7 +88,7 @@ void damped_harmonic_impl(
     const double amp_coef_L1, const double amp_coef_L2, const double amp_coef_S,
     const int exp_L1, const int exp_L2, const int exp_S,
     const double rollon_start_time, const double rollon_width,
-    const double sigma_r) {
+    const double sigma_r, const Scalar<DataVector>* const spatial_weight) {
   const size_t num_points = get(lapse).size();
 
   if constexpr (UseRollon) {
@@ -132,14 +133,14 @@ void damped_harmonic_impl(
       ::Tags::Tempa<36, SpatialDim, Frame>,
       ::Tags::Tempab<37, SpatialDim, Frame>, ::Tags::TempScalar<38>,
       ::Tags::Tempa<39, SpatialDim, Frame>, ::Tags::TempScalar<40>,
-      ::Tags::Tempa<41, SpatialDim, Frame>, ::Tags::TempScalar<42>,
+      ::Tags::Tempa<41, SpatialDim, Frame>,
       ::Tags::Tempa<43, SpatialDim, Frame>, ::Tags::TempScalar<44>,
       ::Tags::TempScalar<45>, ::Tags::TempScalar<46>, ::Tags::TempScalar<47>>>
       buffer(num_points);
   auto& one_over_lapse = get<::Tags::TempScalar<5>>(buffer);
   auto& log_fac_1 = get<::Tags::TempScalar<6>>(buffer);
   auto& log_fac_2 = get<::Tags::TempScalar<7>>(buffer);
-  auto& weight = get<::Tags::TempScalar<8>>(buffer);
+  auto& weight_buffer = get<::Tags::TempScalar<8>>(buffer);
   auto& mu_L1 = get<::Tags::TempScalar<9>>(buffer);
   auto& mu_S = get<::Tags::TempScalar<10>>(buffer);
   auto& mu_L2 = get<::Tags::TempScalar<11>>(buffer);
@@ -169,7 +170,6 @@ void damped_harmonic_impl(
   auto& d_lapse_by_lapse = get<::Tags::Tempa<39, SpatialDim, Frame>>(buffer);
   auto& det_spatial_metric = get<::Tags::TempScalar<40>>(buffer);
   auto& d_g_by_det = get<::Tags::Tempa<41, SpatialDim, Frame>>(buffer);
-  auto& logfac = get<::Tags::TempScalar<42>>(buffer);
   auto& d_logfac = get<::Tags::Tempa<43, SpatialDim, Frame>>(buffer);
   auto& prefac_log = get<::Tags::TempScalar<44>>(buffer);
 
@@ -210,9 +210,19 @@ void damped_harmonic_impl(
                              ? DampedHarmonicGauge_detail::roll_on_function(
                                    time, rollon_start_time, rollon_width)
                              : 1.0;
-  DampedHarmonicGauge_detail::spatial_weight_function<DataVector, SpatialDim,
-                                                      Frame>(
-      make_not_null(&weight), coords, sigma_r);
+  // The spatial weight only depends on the coordinates, so the caller may have
+  // computed it already
+  if (spatial_weight == nullptr) {
+    DampedHarmonicGauge_detail::spatial_weight_function<DataVector, SpatialDim,
+                                                        Frame>(
+        make_not_null(&weight_buffer), coords, sigma_r);
+  } else {
+    ASSERT(get(*spatial_weight).size() == num_points,
+           "The spatial weight has " << get(*spatial_weight).size()
+                                     << " points, but expected " << num_points);
+  }
+  const Scalar<DataVector>& weight =
+      spatial_weight == nullptr ? weight_buffer : *spatial_weight;
 
   get(pow1) = integer_pow(get(log_fac_1), exp_L1);
   get(pow2) = integer_pow(get(log_fac_1), exp_S);
@@ -288,17 +298,17 @@ void damped_harmonic_impl(
   for (size_t a = 0; a < SpatialDim + 1; ++a) {
     d_g_by_det.get(a) = d_g_by_det.get(a) / get(det_spatial_metric);
   }
+  // The log factors were computed above, so we don't evaluate the logarithms
+  // again here
   const auto spacetime_deriv_of_power_log_factor_metric_lapse =
-      [&d_lapse_by_lapse, &d_g_by_det, &lapse, &sqrt_det_spatial_metric,
-       &prefac_log, &d_logfac,
-       &logfac](gsl::not_null<tnsr::a<DataVector, SpatialDim, Frame>*> result,
-                double g_exponent, int exponent) -> void {
+      [&d_lapse_by_lapse, &d_g_by_det, &prefac_log, &d_logfac](
+          gsl::not_null<tnsr::a<DataVector, SpatialDim, Frame>*> result,
+          double g_exponent, const Scalar<DataVector>& logfac,
+          int exponent) -> void {
     for (size_t a = 0; a < SpatialDim + 1; ++a) {
       d_logfac.get(a) =
           g_exponent * d_g_by_det.get(a) - d_lapse_by_lapse.get(a);
     }
-    DampedHarmonicGauge_detail::log_factor_metric_lapse(
-        make_not_null(&logfac), lapse, sqrt_det_spatial_metric, g_exponent);
     get(prefac_log) =
         static_cast<double>(exponent) * integer_pow(get(logfac), exponent - 1);
     for (size_t a = 0; a < SpatialDim + 1; ++a) {
@@ -312,11 +322,11 @@ void damped_harmonic_impl(
   // \partial_a \mu_2 = \partial_a(A_L2 R_L2 W
   //                               \log(1/N)^{1+c_{L2}})
   spacetime_deriv_of_power_log_factor_metric_lapse(
-      make_not_null(&d4_log_fac_mu1), exp_fac_1, exp_L1 + 1);
+      make_not_null(&d4_log_fac_mu1), exp_fac_1, log_fac_1, exp_L1 + 1);
   spacetime_deriv_of_power_log_factor_metric_lapse(
-      make_not_null(&d4_log_fac_muS), exp_fac_1, exp_S);
+      make_not_null(&d4_log_fac_muS), exp_fac_1, log_fac_1, exp_S);
   spacetime_deriv_of_power_log_factor_metric_lapse(
-      make_not_null(&d4_log_fac_mu2), exp_fac_2, exp_L2 + 1);
+      make_not_null(&d4_log_fac_mu2), exp_fac_2, log_fac_2, exp_L2 + 1);
 
   get(pow1) *= get(log_fac_1) * amp_coef_L1;
   get(pow2) *= amp_coef_S;
@@ -466,7 +476,7 @@ void damped_harmonic_rollon(
       sqrt_det_spatial_metric, inverse_spatial_metric, d4_spacetime_metric,
       half_pi_two_normals, half_phi_two_normals, spacetime_metric, phi, time,
       coords, amp_coef_L1, amp_coef_L2, amp_coef_S, exp_L1, exp_L2, exp_S,
-      rollon_start_time, rollon_width, sigma_r);
+      rollon_start_time, rollon_width, sigma_r, nullptr);
 }
 
 template <size_t SpatialDim, typename Frame>
@@ -492,7 +502,7 @@ void damped_harmonic(
       std::numeric_limits<double>::signaling_NaN(), coords, amp_coef_L1,
       amp_coef_L2, amp_coef_S, exp_L1, exp_L2, exp_S,
       std::numeric_limits<double>::signaling_NaN(),
-      std::numeric_limits<double>::signaling_NaN(), sigma_r);
+      std::numeric_limits<double>::signaling_NaN(), sigma_r, nullptr);
 }
 
 DampedHarmonic::DampedHarmonic(const double width,
@@ -514,6 +524,16 @@ std::unique_ptr<GaugeCondition> DampedHarmonic::get_clone() const {
   return std::make_unique<DampedHarmonic>(*this);
 }
 
+template <size_t SpatialDim>
+void DampedHarmonic::spatial_weight(
+    const gsl::not_null<Scalar<DataVector>*> weight,
+    const tnsr::I<DataVector, SpatialDim, Frame::Inertial>& inertial_coords)
+    const {
+  set_number_of_grid_points(weight, inertial_coords);
+  DampedHarmonicGauge_detail::spatial_weight_function(weight, inertial_coords,
+                                                      spatial_decay_width_);
+}
+
 template <size_t SpatialDim>
 void DampedHarmonic::gauge_and_spacetime_derivative(
     const gsl::not_null<tnsr::a<DataVector, SpatialDim, Frame::Inertial>*>
@@ -533,14 +553,19 @@ void DampedHarmonic::gauge_and_spacetime_derivative(
     const tnsr::aa<DataVector, SpatialDim, Frame::Inertial>& spacetime_metric,
     const tnsr::iaa<DataVector, SpatialDim, Frame::Inertial>& phi,
     const double /*time*/,
-    const tnsr::I<DataVector, SpatialDim, Frame::Inertial>& inertial_coords)
-    const {
-  damped_harmonic(gauge_h, d4_gauge_h, lapse, shift, sqrt_det_spatial_metric,
-                  inverse_spatial_metric, d4_spacetime_metric,
-                  half_pi_two_normals, half_phi_two_normals, spacetime_metric,
-                  phi, inertial_coords, amplitudes_[0], amplitudes_[1],
-                  amplitudes_[2], exponents_[0], exponents_[1], exponents_[2],
-                  spatial_decay_width_);
+    const tnsr::I<DataVector, SpatialDim, Frame::Inertial>& inertial_coords,
+    const std::optional<Scalar<DataVector>>& cached_spatial_weight) const {
+  damped_harmonic_impl<false, SpatialDim, Frame::Inertial>(
+      gauge_h, d4_gauge_h, nullptr, nullptr, lapse, shift,
+      sqrt_det_spatial_metric, inverse_spatial_metric, d4_spacetime_metric,
+      half_pi_two_normals, half_phi_two_normals, spacetime_metric, phi,
+      std::numeric_limits<double>::signaling_NaN(), inertial_coords,
+      amplitudes_[0], amplitudes_[1], amplitudes_[2], exponents_[0],
+      exponents_[1], exponents_[2],
+      std::numeric_limits<double>::signaling_NaN(),
+      std::numeric_limits<double>::signaling_NaN(), spatial_decay_width_,
+      cached_spatial_weight.has_value() ? &cached_spatial_weight.value()
+                                        : nullptr);
 }
 
 // NOLINTNEXTLINE
@@ -567,6 +592,10 @@ PUP::able::PUP_ID DampedHarmonic::my_PUP_ID = 0;
           spacetime_metric,                                                    \
       const tnsr::iaa<DataVector, DIM(data), Frame::Inertial>& phi,            \
       const double /*time*/,                                                   \
+      const tnsr::I<DataVector, DIM(data), Frame::Inertial>& inertial_coords,  \
+      const std::optional<Scalar<DataVector>>& cached_spatial_weight) const;   \
+  template void DampedHarmonic::spatial_weight(                                \
+      gsl::not_null<Scalar<DataVector>*> weight,                               \
       const tnsr::I<DataVector, DIM(data), Frame::Inertial>& inertial_coords)  \
       const;
 
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <optional>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -81,6 +82,13 @@ namespace gauges {
  *   - Spatial weight function \f$W\f$ is specified completely by
  *     \f$\sigma_r\f$, which is taken as input here as `sigma_r`.
  *
+ * The spatial weight function only depends on the coordinates, so it can be
+ * computed once per element with `DampedHarmonic::spatial_weight()` and passed
+ * to `DampedHarmonic::gauge_and_spacetime_derivative()` to avoid evaluating the
+ * exponential at every time step (see
+ * `gh::gauges::Tags::DampedHarmonicSpatialWeightCompute`). The roll-on function
+ * only depends on time, so it is evaluated once per call.
+ *
  * Also computes spacetime derivatives, i.e. \f$\partial_a H_b\f$, of the damped
  * harmonic source function H. Using notation from damped_harmonic_h(), we
  * rewrite the same as:
@@ -250,6 +258,16 @@ class DampedHarmonic final : public GaugeCondition {
 
   std::unique_ptr<GaugeCondition> get_clone() const override;
 
+  /// The spatial weight function \f$W(x^i)\f$ at the `inertial_coords`, which
+  /// can be passed to `gauge_and_spacetime_derivative()`
+  template <size_t SpatialDim>
+  void spatial_weight(
+      gsl::not_null<Scalar<DataVector>*> weight,
+      const tnsr::I<DataVector, SpatialDim, Frame::Inertial>& inertial_coords)
+      const;
+
+  /// If the `cached_spatial_weight` is provided it must be the result of
+  /// `spatial_weight()` at the `inertial_coords`. Otherwise, it is computed.
   template <size_t SpatialDim>
   void gauge_and_spacetime_derivative(
       gsl::not_null<tnsr::a<DataVector, SpatialDim, Frame::Inertial>*> gauge_h,
@@ -268,8 +286,9 @@ class DampedHarmonic final : public GaugeCondition {
       const tnsr::aa<DataVector, SpatialDim, Frame::Inertial>& spacetime_metric,
       const tnsr::iaa<DataVector, SpatialDim, Frame::Inertial>& phi,
       double time,
-      const tnsr::I<DataVector, SpatialDim, Frame::Inertial>& inertial_coords)
-      const;
+      const tnsr::I<DataVector, SpatialDim, Frame::Inertial>& inertial_coords,
+      const std::optional<Scalar<DataVector>>& cached_spatial_weight =
+          std::nullopt) const;
 
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override;
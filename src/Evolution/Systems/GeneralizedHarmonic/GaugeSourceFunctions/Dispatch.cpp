@@ -3,6 +3,8 @@
 
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Dispatch.hpp"
 
+#include <optional>
+
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/AnalyticChristoffel.hpp"
@@ -32,7 +34,8 @@ void dispatch(
     const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           Frame::Inertial>& inverse_jacobian,
-    const GaugeCondition& gauge_condition) {
+    const GaugeCondition& gauge_condition,
+    const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight) {
   if (const auto* harmonic_gauge =
           dynamic_cast<const Harmonic*>(&gauge_condition);
       harmonic_gauge != nullptr) {
@@ -44,7 +47,8 @@ void dispatch(
     damped_harmonic_gauge->gauge_and_spacetime_derivative(
         gauge_h, d4_gauge_h, lapse, shift, sqrt_det_spatial_metric,
         inverse_spatial_metric, d4_spacetime_metric, half_pi_two_normals,
-        half_phi_two_normals, spacetime_metric, phi, time, inertial_coords);
+        half_phi_two_normals, spacetime_metric, phi, time, inertial_coords,
+        damped_harmonic_spatial_weight);
   } else if (const auto* analytic_gauge =
                  dynamic_cast<const AnalyticChristoffel*>(&gauge_condition);
              analytic_gauge != nullptr) {
@@ -83,7 +87,8 @@ void dispatch(
       const tnsr::I<DataVector, DIM(data), Frame::Inertial>& inertial_coords,  \
       const InverseJacobian<DataVector, DIM(data), Frame::ElementLogical,      \
                             Frame::Inertial>& inverse_jacobian,                \
-      const GaugeCondition& gauge_condition);
+      const GaugeCondition& gauge_condition,                                   \
+      const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
 #include "Utilities/Gsl.hpp"
@@ -20,6 +22,10 @@ namespace gh::gauges {
  * Which of the arguments to this function are used will depend on the gauge
  * condition, but since that is a runtime choice we need support for all gauge
  * conditions.
+ *
+ * The `damped_harmonic_spatial_weight` can be computed once per element with
+ * `gh::gauges::Tags::DampedHarmonicSpatialWeightCompute`. If it is not
+ * provided, the damped harmonic gauge computes the weight itself.
  */
 template <size_t Dim>
 void dispatch(
@@ -38,5 +44,7 @@ void dispatch(
     const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           Frame::Inertial>& inverse_jacobian,
-    const GaugeCondition& gauge_condition);
+    const GaugeCondition& gauge_condition,
+    const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight =
+        std::nullopt);
 }  // namespace gh::gauges
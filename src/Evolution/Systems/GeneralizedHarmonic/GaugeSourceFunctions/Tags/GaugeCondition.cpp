@@ -4,10 +4,12 @@
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Tags/GaugeCondition.hpp"
 
 #include <cstddef>
+#include <optional>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Dispatch.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
@@ -18,6 +20,24 @@
 #include "Utilities/Gsl.hpp"
 
 namespace gh::gauges::Tags {
+template <size_t Dim>
+void DampedHarmonicSpatialWeightCompute<Dim>::function(
+    const gsl::not_null<return_type*> spatial_weight,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+    const gauges::GaugeCondition& gauge_condition) {
+  const auto* const damped_harmonic_gauge =
+      dynamic_cast<const DampedHarmonic*>(&gauge_condition);
+  if (damped_harmonic_gauge == nullptr) {
+    *spatial_weight = std::nullopt;
+    return;
+  }
+  if (not spatial_weight->has_value()) {
+    spatial_weight->emplace();
+  }
+  damped_harmonic_gauge->spatial_weight(make_not_null(&spatial_weight->value()),
+                                        inertial_coords);
+}
+
 template <size_t Dim>
 void GaugeAndDerivativeCompute<Dim>::function(
     const gsl::not_null<return_type*> gauge_and_deriv,
@@ -80,7 +100,8 @@ void GaugeAndDerivativeCompute<Dim>::function(
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(r, data) \
+#define INSTANTIATION(r, data)                                \
+  template struct DampedHarmonicSpatialWeightCompute<DIM(data)>; \
   template class GaugeAndDerivativeCompute<DIM(data)>;
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
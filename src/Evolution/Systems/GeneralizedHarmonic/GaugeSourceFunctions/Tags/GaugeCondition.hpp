@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -51,6 +52,35 @@ struct GaugeCondition : db::SimpleTag {
   }
 };
 
+/// \brief The spatial weight function \f$W(x^i)\f$ of the damped harmonic
+/// gauge, or `std::nullopt` if the gauge condition is not
+/// `gh::gauges::DampedHarmonic`.
+struct DampedHarmonicSpatialWeight : db::SimpleTag {
+  using type = std::optional<Scalar<DataVector>>;
+};
+
+/// \brief Compute the spatial weight function \f$W(x^i)\f$ of the damped
+/// harmonic gauge.
+///
+/// The weight only depends on the inertial coordinates, so it is only
+/// recomputed when they change. The GH time derivative passes it to
+/// `gh::gauges::dispatch()` so the exponential isn't evaluated at every point
+/// in every time step.
+template <size_t Dim>
+struct DampedHarmonicSpatialWeightCompute : DampedHarmonicSpatialWeight,
+                                            db::ComputeTag {
+  using base = DampedHarmonicSpatialWeight;
+  using return_type = typename base::type;
+  using argument_tags =
+      tmpl::list<domain::Tags::Coordinates<Dim, Frame::Inertial>,
+                 Tags::GaugeCondition>;
+
+  static void function(
+      gsl::not_null<return_type*> spatial_weight,
+      const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+      const gauges::GaugeCondition& gauge_condition);
+};
+
 /// \brief Gauge condition \f$H_a\f$ and its spacetime derivative
 /// \f$\partial_b H_a\f$
 template <size_t Dim>
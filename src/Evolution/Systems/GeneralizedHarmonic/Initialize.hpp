@@ -15,8 +15,10 @@
 #include "DataStructures/Tensor/EagerMath/Norms.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/StoredTemporary.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Tags/GaugeCondition.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -68,7 +70,11 @@ struct InitializeGhAnd3Plus1Variables {
       // Compute constraint damping parameters.
       ConstraintDamping::Tags::ConstraintGamma0Compute<Dim, Frame::Grid>,
       ConstraintDamping::Tags::ConstraintGamma1Compute<Dim, Frame::Grid>,
-      ConstraintDamping::Tags::ConstraintGamma2Compute<Dim, Frame::Grid>>;
+      ConstraintDamping::Tags::ConstraintGamma2Compute<Dim, Frame::Grid>,
+
+      // The spatial weight of the damped harmonic gauge only changes with the
+      // coordinates, so don't recompute it in every time derivative.
+      gauges::Tags::DampedHarmonicSpatialWeightCompute<Dim>>;
 
   using const_global_cache_tags = tmpl::list<
       gh::ConstraintDamping::Tags::DampingFunctionGamma0<Dim, Frame::Grid>,
@@ -87,4 +93,36 @@ struct InitializeGhAnd3Plus1Variables {
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
+
+/*!
+ * \brief Keep the gauge and three-index constraints that the time derivative
+ * computes for constraint damping, so observations can reuse them
+ *
+ * Observe the constraints with
+ * `evolution::dg::Tags::ReuseStoredTemporaryCompute` wrapped around
+ * `gh::Tags::GaugeConstraintCompute` and
+ * `gh::Tags::ThreeIndexConstraintCompute`. See
+ * `evolution::dg::Tags::StoredTemporary` for details.
+ */
+template <size_t Dim>
+struct InitializeStoredConstraints {
+  using simple_tags = tmpl::list<
+      evolution::dg::Tags::StoredTemporary<
+          Tags::GaugeConstraint<DataVector, Dim>>,
+      evolution::dg::Tags::StoredTemporary<
+          Tags::ThreeIndexConstraint<DataVector, Dim>>>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
 }  // namespace gh::Actions
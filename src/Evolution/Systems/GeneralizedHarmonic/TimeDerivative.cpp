@@ -4,6 +4,8 @@
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 
 #include <cstddef>
+#include <optional>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -26,6 +28,21 @@
 #include "Utilities/Gsl.hpp"
 
 namespace gh {
+namespace {
+template <typename Term, size_t... Is>
+auto sum_of_terms_impl(const Term& term,
+                       std::index_sequence<Is...> /*meta*/) {
+  return (term(Is) + ...);
+}
+
+// The sum of `term(i)` for all `i < NumberOfTerms` as a single expression.
+// The operands of the expressions returned by `term` must outlive the result.
+template <size_t NumberOfTerms, typename Term>
+auto sum_of_terms(const Term& term) {
+  return sum_of_terms_impl(term, std::make_index_sequence<NumberOfTerms>{});
+}
+}  // namespace
+
 template <size_t Dim>
 void TimeDerivative<Dim>::apply(
     const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
@@ -77,7 +94,8 @@ void TimeDerivative<Dim>::apply(
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           Frame::Inertial>& inverse_jacobian,
     const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
-        mesh_velocity) {
+        mesh_velocity,
+    const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight) {
   const size_t number_of_points = get<0, 0>(*dt_spacetime_metric).size();
   // Need constraint damping on interfaces in DG schemes
   *temp_gamma1 = gamma1;
@@ -262,7 +280,8 @@ void TimeDerivative<Dim>::apply(
       gauge_function, spacetime_deriv_gauge_function, *lapse, *shift,
       *sqrt_det_spatial_metric, *inverse_spatial_metric, *da_spacetime_metric,
       *half_pi_two_normals, *half_phi_two_normals, spacetime_metric, phi, mesh,
-      time, inertial_coords, inverse_jacobian, gauge_condition);
+      time, inertial_coords, inverse_jacobian, gauge_condition,
+      damped_harmonic_spatial_weight);
   if (not using_harmonic_gauge) {
     // Compute source function last so that we don't need to recompute any of
     // the other temporary tags.
@@ -338,24 +357,28 @@ void TimeDerivative<Dim>::apply(
         dt_pi->get(mu, nu) -= spacetime_deriv_gauge_function->get(mu, nu) +
                               spacetime_deriv_gauge_function->get(nu, mu);
       }
-      for (size_t delta = 0; delta < Dim + 1; ++delta) {
-        dt_pi->get(mu, nu) -= 2 * pi.get(mu, delta) * pi_2_up->get(nu, delta);
-        if (not using_harmonic_gauge) {
+      if (not using_harmonic_gauge) {
+        for (size_t delta = 0; delta < Dim + 1; ++delta) {
           dt_pi->get(mu, nu) += 2 *
                                 christoffel_second_kind->get(delta, mu, nu) *
                                 gauge_function->get(delta);
         }
-        for (size_t n = 0; n < Dim; ++n) {
-          dt_pi->get(mu, nu) +=
-              2 * phi_1_up->get(n, mu, delta) * phi_3_up->get(n, nu, delta);
-        }
-
-        for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
-          dt_pi->get(mu, nu) -=
-              2. * christoffel_first_kind_3_up->get(mu, alpha, delta) *
-              christoffel_first_kind_3_up->get(nu, delta, alpha);
-        }
       }
+      // The quadratic terms are the bulk of the work. They are combined into a
+      // single expression so that they are evaluated in one pass over the grid
+      // points instead of one read-modify-write of dt_pi per term.
+      dt_pi->get(mu, nu) -=
+          2.0 * sum_of_terms<Dim + 1>([&](const size_t delta) {
+            return pi.get(mu, delta) * pi_2_up->get(nu, delta) -
+                   sum_of_terms<Dim>([&](const size_t n) {
+                     return phi_1_up->get(n, mu, delta) *
+                            phi_3_up->get(n, nu, delta);
+                   }) +
+                   sum_of_terms<Dim + 1>([&](const size_t alpha) {
+                     return christoffel_first_kind_3_up->get(mu, alpha, delta) *
+                            christoffel_first_kind_3_up->get(nu, delta, alpha);
+                   });
+          });
 
       for (size_t m = 0; m < Dim; ++m) {
         dt_pi->get(mu, nu) -=
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Tags.hpp"
@@ -138,7 +139,8 @@ struct TimeDerivative {
                  ::Tags::Time, domain::Tags::Coordinates<Dim, Frame::Inertial>,
                  domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
                                                Frame::Inertial>,
-                 domain::Tags::MeshVelocity<Dim, Frame::Inertial>>;
+                 domain::Tags::MeshVelocity<Dim, Frame::Inertial>,
+                 gauges::Tags::DampedHarmonicSpatialWeight>;
 
   static void apply(
       gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
@@ -189,6 +191,7 @@ struct TimeDerivative {
       const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                             Frame::Inertial>& inverse_jacobian,
       const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
-          mesh_velocity);
+          mesh_velocity,
+      const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight);
 };
 }  // namespace gh
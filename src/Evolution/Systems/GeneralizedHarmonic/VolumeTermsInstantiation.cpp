@@ -59,7 +59,8 @@ namespace evolution::dg::Actions::detail {
       const InverseJacobian<DataVector, DIM(data), Frame::ElementLogical,      \
                             Frame::Inertial>& inverse_jacobian,                \
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&    \
-          mesh_velocity_from_time_deriv_args);
+          mesh_velocity_from_time_deriv_args,                                  \
+      const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
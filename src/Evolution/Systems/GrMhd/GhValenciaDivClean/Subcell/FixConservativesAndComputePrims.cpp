@@ -27,6 +27,7 @@ template <typename OrderedListOfRecoverySchemes>
 template <size_t ThermodynamicDim>
 void FixConservativesAndComputePrims<OrderedListOfRecoverySchemes>::apply(
     const gsl::not_null<bool*> needed_fixing,
+    const gsl::not_null<size_t*> number_of_points_needed_fixing,
     const gsl::not_null<typename System::variables_tag::type*>
         conserved_vars_ptr,
     const gsl::not_null<Variables<hydro::grmhd_tags<DataVector>>*>
@@ -56,7 +57,7 @@ void FixConservativesAndComputePrims<OrderedListOfRecoverySchemes>::apply(
                           spatial_metric);
   get(sqrt_det_spatial_metric) = sqrt(get(sqrt_det_spatial_metric));
 
-  *needed_fixing = fix_conservatives(
+  *number_of_points_needed_fixing = fix_conservatives.fix_and_count_points(
       make_not_null(&get<ValenciaDivClean::Tags::TildeD>(*conserved_vars_ptr)),
       make_not_null(&get<ValenciaDivClean::Tags::TildeYe>(*conserved_vars_ptr)),
       make_not_null(
@@ -65,6 +66,7 @@ void FixConservativesAndComputePrims<OrderedListOfRecoverySchemes>::apply(
           *conserved_vars_ptr)),
       get<ValenciaDivClean::Tags::TildeB<Frame::Inertial>>(*conserved_vars_ptr),
       spatial_metric, inverse_spatial_metric, sqrt_det_spatial_metric);
+  *needed_fixing = *number_of_points_needed_fixing > 0;
   grmhd::ValenciaDivClean::
       PrimitiveFromConservative<OrderedListOfRecoverySchemes, true>::apply(
           make_not_null(&get<hydro::Tags::RestMassDensity<DataVector>>(
@@ -116,6 +118,7 @@ using KastaunThenNewmanThenPalenzuela =
   template void                                                             \
   FixConservativesAndComputePrims<RECOVERY(data)>::apply<THERMO_DIM(data)>( \
       const gsl::not_null<bool*> needed_fixing,                             \
+      const gsl::not_null<size_t*> number_of_points_needed_fixing,          \
       const gsl::not_null<typename System::variables_tag::type*>            \
           conserved_vars_ptr,                                               \
       const gsl::not_null<Variables<hydro::grmhd_tags<DataVector>>*>        \
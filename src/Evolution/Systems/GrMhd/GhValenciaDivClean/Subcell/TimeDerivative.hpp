@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <optional>
 #include <type_traits>
+#include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -60,6 +61,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 /// \cond
 namespace Tags {
@@ -108,7 +110,7 @@ struct ComputeTimeDerivImpl<
         ::Tags::deriv<gr::Tags::SpatialMetric<DataVector, 3>, tmpl::size_t<3>,
                       Frame::Inertial>;
     using extra_tags_for_grmhd =
-        tmpl::list<deriv_lapse, deriv_shift, deriv_spatial_metric,
+        tmpl::list<deriv_lapse, deriv_shift,
                    gr::Tags::ExtrinsicCurvature<DataVector, 3>>;
     using temporary_tags = tmpl::remove_duplicates<tmpl::append<
         typename gh::TimeDerivative<3_st>::temporary_tags,
@@ -186,7 +188,10 @@ struct ComputeTimeDerivImpl<
         db::get<::gh::gauges::Tags::GaugeCondition>(*box),
         db::get<evolution::dg::subcell::Tags::Mesh<3>>(*box), time,
         inertial_coords, cell_centered_logical_to_inertial_inv_jacobian,
-        mesh_velocity_subcell);
+        mesh_velocity_subcell,
+        // The cached spatial weight of the damped harmonic gauge is on the DG
+        // grid, so compute it on the subcell grid
+        std::nullopt);
     if (get<gh::gauges::Tags::GaugeCondition>(*box).is_harmonic()) {
       get(get<gr::Tags::SqrtDetSpatialMetric<DataVector>>(*temp_tags_ptr)) =
           sqrt(
@@ -222,6 +227,9 @@ struct ComputeTimeDerivImpl<
       });
     }
 
+    // The spatial derivative of the spatial metric is a view into Phi, like in
+    // the DG time derivative, so it doesn't need to be copied
+    tuples::TaggedTuple<deriv_spatial_metric> spatial_metric_views{};
     {
       // Set extra tags needed for GRMHD source terms. We compute these from
       // quantities already computed inside the GH RHS computation to minimize
@@ -264,8 +272,12 @@ struct ComputeTimeDerivImpl<
       for (size_t k = 0; k < 3; ++k) {
         for (size_t i = 0; i < 3; ++i) {
           for (size_t j = i; j < 3; ++j) {
-            get<deriv_spatial_metric>(temp_tags).get(k, i, j) =
-                phi.get(k, i + 1, j + 1);
+            make_const_view(
+                make_not_null(
+                    &std::as_const(get<deriv_spatial_metric>(
+                                       spatial_metric_views))
+                         .get(k, i, j)),
+                phi.get(k, i + 1, j + 1), 0, number_of_points);
           }
         }
       }
@@ -284,8 +296,8 @@ struct ComputeTimeDerivImpl<
 
     grmhd::ValenciaDivClean::ComputeSources::apply(
         get<::Tags::dt<GrmhdSourceTags>>(dt_vars_ptr)...,
-        get<GrmhdArgumentSourceTags>(temp_tags, primitive_vars, evolved_vars,
-                                     *box)...);
+        get<GrmhdArgumentSourceTags>(temp_tags, spatial_metric_views,
+                                     primitive_vars, evolved_vars, *box)...);
 
     // Zero GRMHD tags that don't have sources.
     tmpl::for_each<tmpl::list<GrmhdDtTags...>>([&dt_vars_ptr](
@@ -188,12 +188,15 @@ struct TimeDerivativeTermsImpl<
  * system, which is the only explicit coupling required to back-react the effect
  * of matter on the spacetime solution.
  *
- * \note The MHD calculation reuses any spacetime quantities in its
- * argument_tags that are computed by the GH time derivative. However, other
- * quantities that aren't computed by the GH time derivative like the extrinsic
- * curvature are currently still retrieved from the DataBox. Those calculations
- * can be explicitly inlined here to reduce memory pressure and the number of
- * compute tags.
+ * The 3+1 decomposition of the spacetime metric is done only once per step, by
+ * the GH time derivative. The lapse, the shift, the inverse spatial metric and
+ * the (square root of the) determinant of the spatial metric are GH
+ * temporaries that the MHD time derivative and the stress-energy tensor read
+ * from the shared temporaries. The spatial metric and its derivative are views
+ * into the spacetime metric and \f$\Phi_{iab}\f$. The other spacetime
+ * quantities the MHD time derivative needs (the derivatives of the lapse and
+ * shift and the extrinsic curvature) are computed here from the GH
+ * temporaries, so no spacetime quantities are retrieved from the DataBox.
  */
 struct TimeDerivativeTerms : evolution::PassVariables {
   using gh_dt_tags =
@@ -230,6 +233,18 @@ struct TimeDerivativeTerms : evolution::PassVariables {
   using valencia_arg_tags = tmpl::list_difference<
       typename grmhd::ValenciaDivClean::TimeDerivativeTerms::argument_tags,
       tmpl::append<gh_temp_tags, valencia_extra_temp_tags>>;
+  static_assert(
+      not tmpl::list_contains_v<valencia_arg_tags,
+                                gr::Tags::Lapse<DataVector>> and
+          not tmpl::list_contains_v<valencia_arg_tags,
+                                    gr::Tags::Shift<DataVector, 3>> and
+          not tmpl::list_contains_v<
+              valencia_arg_tags,
+              gr::Tags::InverseSpatialMetric<DataVector, 3>> and
+          not tmpl::list_contains_v<
+              valencia_arg_tags, gr::Tags::SqrtDetSpatialMetric<DataVector>>,
+      "The 3+1 quantities of the MHD time derivative should be taken from "
+      "the GH temporaries so the spacetime metric is decomposed only once.");
 
   using trace_reversed_stress_result_tags =
       tmpl::list<Tags::TraceReversedStressEnergy, Tags::FourVelocityOneForm,
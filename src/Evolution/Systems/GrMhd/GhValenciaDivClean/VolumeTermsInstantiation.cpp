@@ -59,6 +59,7 @@ template void volume_terms<::grmhd::GhValenciaDivClean::TimeDerivativeTerms>(
                           Frame::Inertial>& inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>&
         mesh_velocity_gh,
+    const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight,
     // GRMHD argument tags
     const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_ye,
     const Scalar<DataVector>& tilde_tau,
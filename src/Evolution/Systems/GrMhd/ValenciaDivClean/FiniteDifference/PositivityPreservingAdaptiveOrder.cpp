@@ -3,17 +3,22 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/FiniteDifference/PositivityPreservingAdaptiveOrder.hpp"
 
+#include <algorithm>
 #include <array>
 #include <boost/functional/hash.hpp>
+#include <cmath>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/FixedHashMap.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
@@ -36,21 +41,119 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace grmhd::ValenciaDivClean::fd {
+namespace {
+// Whether every component of the `ReconstructedTags` varies across the volume
+// and the ghost zones by at most `tolerance` times its largest magnitude there.
+template <typename ReconstructedTags, typename NeighborData>
+bool is_smooth_element(
+    const Variables<hydro::grmhd_tags<DataVector>>& volume_prims,
+    const NeighborData& neighbor_data, const double tolerance) {
+  bool smooth = true;
+  tmpl::for_each<ReconstructedTags>([&neighbor_data, &smooth, tolerance,
+                                     &volume_prims](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    const auto component_is_smooth = [&neighbor_data, tolerance](
+                                         const DataVector& volume_component,
+                                         const size_t storage_index) {
+      double min_value = min(volume_component);
+      double max_value = max(volume_component);
+      for (const auto& id_and_vars : neighbor_data) {
+        const DataVector& neighbor_component =
+            get<tag>(id_and_vars.second)[storage_index];
+        min_value = std::min(min_value, min(neighbor_component));
+        max_value = std::max(max_value, max(neighbor_component));
+      }
+      return max_value - min_value <=
+             tolerance * std::max(std::abs(min_value), std::abs(max_value));
+    };
+
+    for (size_t i = 0; smooth and i < tag::type::size(); ++i) {
+      if constexpr (std::is_same_v<
+                        tag, hydro::Tags::LorentzFactorTimesSpatialVelocity<
+                                 DataVector, 3>>) {
+        smooth = component_is_smooth(
+            get(get<hydro::Tags::LorentzFactor<DataVector>>(volume_prims)) *
+                get<hydro::Tags::SpatialVelocity<DataVector, 3>>(volume_prims)
+                    .get(i),
+            i);
+      } else {
+        smooth = component_is_smooth(get<tag>(volume_prims)[i], i);
+      }
+    }
+  });
+  return smooth;
+}
+
+// Copies the `narrowed_ghost_zone_size` cells closest to the element out of
+// ghost data that is `ghost_zone_size` cells wide.
+template <typename NeighborData>
+void narrow_ghost_data(const gsl::not_null<NeighborData*> narrowed_data,
+                       const NeighborData& neighbor_data,
+                       const size_t ghost_zone_size,
+                       const size_t narrowed_ghost_zone_size,
+                       const Mesh<3>& subcell_mesh) {
+  narrowed_data->clear();
+  for (const auto& [neighbor_id, neighbor_vars] : neighbor_data) {
+    const Direction<3>& direction = neighbor_id.first;
+    Index<3> ghost_extents = subcell_mesh.extents();
+    ghost_extents[direction.dimension()] = ghost_zone_size;
+    Index<3> narrowed_extents = subcell_mesh.extents();
+    narrowed_extents[direction.dimension()] = narrowed_ghost_zone_size;
+    // The cell adjacent to the element is the first one in upper directions
+    // and the last one in lower directions.
+    const size_t offset = direction.side() == Side::Upper
+                              ? 0
+                              : ghost_zone_size - narrowed_ghost_zone_size;
+
+    auto& narrowed_vars = (*narrowed_data)[neighbor_id];
+    narrowed_vars.initialize(narrowed_extents.product());
+    for (size_t component = 0;
+         component < std::decay_t<decltype(neighbor_vars)>::
+                         number_of_independent_components;
+         ++component) {
+      const double* const source =
+          neighbor_vars.data() + component * ghost_extents.product();
+      double* const destination =
+          narrowed_vars.data() + component * narrowed_extents.product();
+      for (size_t k = 0; k < narrowed_extents[2]; ++k) {
+        for (size_t j = 0; j < narrowed_extents[1]; ++j) {
+          for (size_t i = 0; i < narrowed_extents[0]; ++i) {
+            const Index<3> narrowed_index{i, j, k};
+            Index<3> source_index = narrowed_index;
+            source_index[direction.dimension()] += offset;
+            destination[collapsed_index(narrowed_index, narrowed_extents)] =
+                source[collapsed_index(source_index, ghost_extents)];
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace
 
 PositivityPreservingAdaptiveOrderPrim::PositivityPreservingAdaptiveOrderPrim(
     const double alpha_5, const std::optional<double> alpha_7,
     const std::optional<double> alpha_9,
     const ::fd::reconstruction::FallbackReconstructorType
         low_order_reconstructor,
+    const std::optional<double> smooth_element_tolerance,
     const Options::Context& context)
     : four_to_the_alpha_5_(pow(4.0, alpha_5)),
-      low_order_reconstructor_(low_order_reconstructor) {
+      low_order_reconstructor_(low_order_reconstructor),
+      smooth_element_tolerance_(smooth_element_tolerance) {
   if (low_order_reconstructor_ ==
       ::fd::reconstruction::FallbackReconstructorType::None) {
     PARSE_ERROR(context, "None is not an allowed low-order reconstructor.");
   }
+  if (smooth_element_tolerance_.has_value() and
+      smooth_element_tolerance_.value() < 0.0) {
+    PARSE_ERROR(context, "The smooth element tolerance must be non-negative "
+                         "but got "
+                             << smooth_element_tolerance_.value());
+  }
   if (alpha_7.has_value()) {
     six_to_the_alpha_7_ = pow(6.0, alpha_7.value());
   }
@@ -80,6 +183,12 @@ void PositivityPreservingAdaptiveOrderPrim::set_function_pointers() {
       positivity_preserving_adaptive_order_function_pointers<3, true>(
           true, eight_to_the_alpha_9_.has_value(),
           six_to_the_alpha_7_.has_value(), low_order_reconstructor_);
+  std::tie(smooth_reconstruct_, std::ignore, std::ignore) = ::fd::
+      reconstruction::positivity_preserving_adaptive_order_function_pointers<
+          3, false>(false, false, false, low_order_reconstructor_);
+  std::tie(smooth_pp_reconstruct_, std::ignore, std::ignore) = ::fd::
+      reconstruction::positivity_preserving_adaptive_order_function_pointers<
+          3, true>(true, false, false, low_order_reconstructor_);
 }
 
 void PositivityPreservingAdaptiveOrderPrim::pup(PUP::er& p) {
@@ -88,6 +197,7 @@ void PositivityPreservingAdaptiveOrderPrim::pup(PUP::er& p) {
   p | six_to_the_alpha_7_;
   p | eight_to_the_alpha_9_;
   p | low_order_reconstructor_;
+  p | smooth_element_tolerance_;
   if (p.isUnpacking()) {
     set_function_pointers();
   }
@@ -119,38 +229,67 @@ void PositivityPreservingAdaptiveOrderPrim::reconstruct(
                                         ghost_data, ghost_zone_size(),
                                         subcell_mesh);
 
-  reconstruct_prims_work<positivity_preserving_tags>(
-      vars_on_lower_face, vars_on_upper_face,
-      [this, &reconstruction_order](
-          auto upper_face_vars_ptr, auto lower_face_vars_ptr,
-          const auto& volume_vars, const auto& ghost_cell_vars,
-          const auto& subcell_extents, const size_t number_of_variables) {
-        pp_reconstruct_(upper_face_vars_ptr, lower_face_vars_ptr,
-                        reconstruction_order, volume_vars, ghost_cell_vars,
-                        subcell_extents, number_of_variables,
-                        four_to_the_alpha_5_,
-                        six_to_the_alpha_7_.value_or(
-                            std::numeric_limits<double>::signaling_NaN()),
-                        eight_to_the_alpha_9_.value_or(
-                            std::numeric_limits<double>::signaling_NaN()));
-      },
-      volume_prims, eos, element, neighbor_variables_data, subcell_mesh,
-      ghost_zone_size(), false);
-  reconstruct_prims_work<non_positive_tags>(
-      vars_on_lower_face, vars_on_upper_face,
-      [this](auto upper_face_vars_ptr, auto lower_face_vars_ptr,
-             const auto& volume_vars, const auto& ghost_cell_vars,
-             const auto& subcell_extents, const size_t number_of_variables) {
-        reconstruct_(upper_face_vars_ptr, lower_face_vars_ptr, volume_vars,
-                     ghost_cell_vars, subcell_extents, number_of_variables,
-                     four_to_the_alpha_5_,
-                     six_to_the_alpha_7_.value_or(
-                         std::numeric_limits<double>::signaling_NaN()),
-                     eight_to_the_alpha_9_.value_or(
-                         std::numeric_limits<double>::signaling_NaN()));
-      },
-      volume_prims, eos, element, neighbor_variables_data, subcell_mesh,
-      ghost_zone_size(), true);
+  const auto reconstruct_with = [this, &element, &eos, &reconstruction_order,
+                                 &subcell_mesh, &vars_on_lower_face,
+                                 &vars_on_upper_face, &volume_prims](
+                                    const PointerReconsOrder pp_recons,
+                                    const PointerRecons recons,
+                                    const auto& neighbor_data,
+                                    const size_t local_ghost_zone_size) {
+    reconstruct_prims_work<positivity_preserving_tags>(
+        vars_on_lower_face, vars_on_upper_face,
+        [this, &reconstruction_order, pp_recons](
+            auto upper_face_vars_ptr, auto lower_face_vars_ptr,
+            const auto& volume_vars, const auto& ghost_cell_vars,
+            const auto& subcell_extents, const size_t number_of_variables) {
+          pp_recons(upper_face_vars_ptr, lower_face_vars_ptr,
+                    reconstruction_order, volume_vars, ghost_cell_vars,
+                    subcell_extents, number_of_variables, four_to_the_alpha_5_,
+                    six_to_the_alpha_7_.value_or(
+                        std::numeric_limits<double>::signaling_NaN()),
+                    eight_to_the_alpha_9_.value_or(
+                        std::numeric_limits<double>::signaling_NaN()));
+        },
+        volume_prims, eos, element, neighbor_data, subcell_mesh,
+        local_ghost_zone_size, false);
+    reconstruct_prims_work<non_positive_tags>(
+        vars_on_lower_face, vars_on_upper_face,
+        [this, recons](
+            auto upper_face_vars_ptr, auto lower_face_vars_ptr,
+            const auto& volume_vars, const auto& ghost_cell_vars,
+            const auto& subcell_extents, const size_t number_of_variables) {
+          recons(upper_face_vars_ptr, lower_face_vars_ptr, volume_vars,
+                 ghost_cell_vars, subcell_extents, number_of_variables,
+                 four_to_the_alpha_5_,
+                 six_to_the_alpha_7_.value_or(
+                     std::numeric_limits<double>::signaling_NaN()),
+                 eight_to_the_alpha_9_.value_or(
+                     std::numeric_limits<double>::signaling_NaN()));
+        },
+        volume_prims, eos, element, neighbor_data, subcell_mesh,
+        local_ghost_zone_size, true);
+  };
+
+  if (smooth_element_tolerance_.has_value() and
+      ghost_zone_size() > smooth_element_ghost_zone_size and
+      is_smooth_element<prims_to_reconstruct_tags>(
+          volume_prims, neighbor_variables_data,
+          smooth_element_tolerance_.value())) {
+    FixedHashMap<maximum_number_of_neighbors(dim),
+                 std::pair<Direction<dim>, ElementId<dim>>,
+                 Variables<prims_to_reconstruct_tags>,
+                 boost::hash<std::pair<Direction<dim>, ElementId<dim>>>>
+        narrowed_neighbor_variables_data{};
+    narrow_ghost_data(make_not_null(&narrowed_neighbor_variables_data),
+                      neighbor_variables_data, ghost_zone_size(),
+                      smooth_element_ghost_zone_size, subcell_mesh);
+    reconstruct_with(smooth_pp_reconstruct_, smooth_reconstruct_,
+                     narrowed_neighbor_variables_data,
+                     smooth_element_ghost_zone_size);
+  } else {
+    reconstruct_with(pp_reconstruct_, reconstruct_, neighbor_variables_data,
+                     ghost_zone_size());
+  }
 }
 
 template <size_t ThermodynamicDim, typename TagsList>
@@ -243,7 +382,8 @@ bool operator==(const PositivityPreservingAdaptiveOrderPrim& lhs,
   return lhs.four_to_the_alpha_5_ == rhs.four_to_the_alpha_5_ and
          lhs.six_to_the_alpha_7_ == rhs.six_to_the_alpha_7_ and
          lhs.eight_to_the_alpha_9_ == rhs.eight_to_the_alpha_9_ and
-         lhs.low_order_reconstructor_ == rhs.low_order_reconstructor_;
+         lhs.low_order_reconstructor_ == rhs.low_order_reconstructor_ and
+         lhs.smooth_element_tolerance_ == rhs.smooth_element_tolerance_;
 }
 
 bool operator!=(const PositivityPreservingAdaptiveOrderPrim& lhs,
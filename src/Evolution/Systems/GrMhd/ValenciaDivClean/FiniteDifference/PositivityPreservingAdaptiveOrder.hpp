@@ -57,6 +57,15 @@ namespace grmhd::ValenciaDivClean::fd {
  * ::fd::reconstruction::positivity_preserving_adaptive_order() for details.
  *
  * The rest mass density, electron fraction, and the pressure are kept positive.
+ *
+ * If `SmoothElementTolerance` is specified, the reconstruction order can also
+ * be lowered for a whole element: if every reconstructed variable varies
+ * across the element and its ghost zones by at most the tolerance times its
+ * largest magnitude there, e.g. in the atmosphere, the 7th- and 9th-order
+ * stencils cannot improve on 5th order. Such elements are reconstructed with
+ * the 5th-order adaptive scheme, using only the three ghost cells closest to
+ * the element. The ghost zones sent to neighbors keep their full width, since
+ * the neighbors choose their order independently.
  */
 class PositivityPreservingAdaptiveOrderPrim : public Reconstructor {
  private:
@@ -113,7 +122,18 @@ class PositivityPreservingAdaptiveOrderPrim : public Reconstructor {
         "isn't okay."};
   };
 
-  using options = tmpl::list<Alpha5, Alpha7, Alpha9, LowOrderReconstructor>;
+  struct SmoothElementTolerance {
+    using type = Options::Auto<double, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "If every reconstructed variable varies across the element and its "
+        "ghost zones by at most this fraction of its largest magnitude, the "
+        "element is reconstructed with at most 5th order, skipping the 7th- "
+        "and 9th-order stencils. If specified to None, then the order is "
+        "never lowered for whole elements."};
+  };
+
+  using options = tmpl::list<Alpha5, Alpha7, Alpha9, LowOrderReconstructor,
+                             SmoothElementTolerance>;
 
   static constexpr Options::String help{
       "Positivity-preserving adaptive-order reconstruction."};
@@ -133,6 +153,7 @@ class PositivityPreservingAdaptiveOrderPrim : public Reconstructor {
       double alpha_5, std::optional<double> alpha_7,
       std::optional<double> alpha_9,
       FallbackReconstructorType low_order_reconstructor,
+      std::optional<double> smooth_element_tolerance = std::nullopt,
       const Options::Context& context = {});
 
   explicit PositivityPreservingAdaptiveOrderPrim(CkMigrateMessage* msg);
@@ -202,6 +223,10 @@ class PositivityPreservingAdaptiveOrderPrim : public Reconstructor {
   std::optional<double> eight_to_the_alpha_9_{};
   FallbackReconstructorType low_order_reconstructor_ =
       FallbackReconstructorType::None;
+  std::optional<double> smooth_element_tolerance_{};
+
+  // The ghost zone size needed by the 5th-order adaptive scheme
+  static constexpr size_t smooth_element_ghost_zone_size = 3;
 
   using PointerReconsOrder = void (*)(
       gsl::not_null<std::array<gsl::span<double>, dim>*>,
@@ -218,6 +243,8 @@ class PositivityPreservingAdaptiveOrderPrim : public Reconstructor {
                const Index<dim>&, size_t, double, double, double);
   PointerRecons reconstruct_ = nullptr;
   PointerReconsOrder pp_reconstruct_ = nullptr;
+  PointerRecons smooth_reconstruct_ = nullptr;
+  PointerReconsOrder smooth_pp_reconstruct_ = nullptr;
 
   using PointerNeighbor = void (*)(gsl::not_null<DataVector*>,
                                    const DataVector&, const DataVector&,
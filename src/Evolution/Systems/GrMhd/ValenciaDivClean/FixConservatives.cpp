@@ -181,7 +181,21 @@ bool FixConservatives::operator()(
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
     const Scalar<DataVector>& sqrt_det_spatial_metric) const {
-  bool needed_fixing = false;
+  return fix_and_count_points(tilde_d, tilde_ye, tilde_tau, tilde_s, tilde_b,
+                              spatial_metric, inv_spatial_metric,
+                              sqrt_det_spatial_metric) > 0;
+}
+
+size_t FixConservatives::fix_and_count_points(
+    const gsl::not_null<Scalar<DataVector>*> tilde_d,
+    const gsl::not_null<Scalar<DataVector>*> tilde_ye,
+    const gsl::not_null<Scalar<DataVector>*> tilde_tau,
+    const gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*> tilde_s,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) const {
+  size_t number_of_points_fixed = 0;
   const size_t size = get<0>(tilde_b).size();
   Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
                        ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
@@ -209,6 +223,7 @@ bool FixConservatives::operator()(
   local_ye = get(*tilde_ye) / get(*tilde_d);
 
   for (size_t s = 0; s < size; s++) {
+    bool needed_fixing = false;
     double& d_tilde = get(*tilde_d)[s];
 
     // Increase electron fraction if necessary
@@ -379,8 +394,11 @@ bool FixConservatives::operator()(
         }
       }
     }
+    if (needed_fixing) {
+      ++number_of_points_fixed;
+    }
   }
-  return needed_fixing;
+  return number_of_points_fixed;
 }
 
 bool operator==(const FixConservatives& lhs, const FixConservatives& rhs) {
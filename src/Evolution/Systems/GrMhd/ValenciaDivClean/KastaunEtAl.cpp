@@ -4,6 +4,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <exception>
 #include <limits>
 #include <optional>
@@ -304,6 +305,13 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
                                      electron_fraction,
                                      equation_of_state};
 
+  size_t number_of_iterations = 0;
+  const auto counted_f_of_mu = [&f_of_mu,
+                                &number_of_iterations](const double mu) {
+    ++number_of_iterations;
+    return f_of_mu(mu);
+  };
+
   // mu is 1 / (h W) see Equation (26)
   double one_over_specific_enthalpy_times_lorentz_factor =
       std::numeric_limits<double>::signaling_NaN();
@@ -316,7 +324,7 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
     // Try to recover primitves
     one_over_specific_enthalpy_times_lorentz_factor =
         // NOLINTNEXTLINE(clang-analyzer-core)
-        RootFinder::toms748(f_of_mu, lower_bound, upper_bound,
+        RootFinder::toms748(counted_f_of_mu, lower_bound, upper_bound,
                             absolute_tolerance_, relative_tolerance_,
                             max_iterations_);
   } catch (std::exception& exception) {
@@ -335,7 +343,7 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
       rest_mass_density, lorentz_factor, pressure,
       rest_mass_density_times_lorentz_factor /
           one_over_specific_enthalpy_times_lorentz_factor,
-      electron_fraction};
+      electron_fraction, number_of_iterations};
 }
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
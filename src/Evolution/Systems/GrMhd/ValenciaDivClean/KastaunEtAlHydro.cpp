@@ -4,6 +4,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAlHydro.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <exception>
 #include <limits>
 #include <optional>
@@ -179,6 +180,13 @@ KastaunEtAlHydro<EnforcePhysicality>::apply(
     return std::nullopt;
   };
 
+  size_t number_of_iterations = 0;
+  const auto counted_f_of_z = [&f_of_z,
+                               &number_of_iterations](const double local_z) {
+    ++number_of_iterations;
+    return f_of_z(local_z);
+  };
+
   // z is W * v  (Lorentz factor * velocity)
   double z = std::numeric_limits<double>::signaling_NaN();
   try {
@@ -188,7 +196,7 @@ KastaunEtAlHydro<EnforcePhysicality>::apply(
     // Try to recover primitves
     z =
         // NOLINTNEXTLINE(clang-analyzer-core)
-        RootFinder::toms748(f_of_z, lower_bound, upper_bound,
+        RootFinder::toms748(counted_f_of_z, lower_bound, upper_bound,
                             absolute_tolerance_, relative_tolerance_,
                             max_iterations_);
   } catch (std::exception& exception) {
@@ -202,7 +210,7 @@ KastaunEtAlHydro<EnforcePhysicality>::apply(
       rest_mass_density, lorentz_factor, pressure,
       (rest_mass_density * (1. + specific_internal_energy) + pressure) *
           (1. + z * z),
-      electron_fraction};
+      electron_fraction, number_of_iterations};
 }
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
@@ -7,27 +7,44 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <optional>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
+namespace {
+// The state of the Newman-Hamlin iteration at a single grid point. The
+// iteration is split into the part before and after the call to the equation
+// of state so that the batched recovery can evaluate the equation of state for
+// all points that are still iterating at once.
+struct NewmanHamlinState {
+  double d_in_cubic;
+  double minimum_pressure;
+  double current_pressure;
+  double previous_pressure;
+  std::array<double, 3> aitken_pressure;
+  size_t valid_entries_in_aitken_pressure;
+  size_t iteration_step;
+  bool converged;
+};
 
-template <size_t ThermodynamicDim>
-std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
+enum class NewmanHamlinStage { Failed, Converged, NeedsEquationOfState };
+
+// Returns `std::nullopt` if the recovery fails before the iteration starts.
+std::optional<NewmanHamlinState> initialize_newman_hamlin(
     const double initial_guess_for_pressure, const double total_energy_density,
     const double momentum_density_squared,
     const double momentum_density_dot_magnetic_field,
-    const double magnetic_field_squared,
-    const double rest_mass_density_times_lorentz_factor,
-    const double electron_fraction,
-    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
-        equation_of_state) {
+    const double magnetic_field_squared) {
   // constant in cubic equation  f(eps) = eps^3 - a eps^2 + d
   // whose root is being found at each point in the iteration below
   const double d_in_cubic = [momentum_density_squared, magnetic_field_squared,
@@ -49,126 +66,309 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
   const double minimum_pressure =
       std::max(0.0, cbrt(6.75 * d_in_cubic) - total_energy_density -
                         0.5 * magnetic_field_squared);
-  double current_pressure =
+  const double current_pressure =
       std::max(minimum_pressure, initial_guess_for_pressure);
-  double previous_pressure{std::numeric_limits<double>::signaling_NaN()};
-  size_t iteration_step{0};
-  std::array<double, 3> aitken_pressure{
-      {current_pressure, std::numeric_limits<double>::signaling_NaN(),
-       std::numeric_limits<double>::signaling_NaN()}};
-  size_t valid_entries_in_aitken_pressure = 1;
-  bool converged = false;
+  return NewmanHamlinState{
+      d_in_cubic,
+      minimum_pressure,
+      current_pressure,
+      std::numeric_limits<double>::signaling_NaN(),
+      {{current_pressure, std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN()}},
+      1,
+      0,
+      false};
+}
 
-  while (true) {  // will break when relative pressure change is <
-                  // relative_tolernance_
-    if (UNLIKELY(max_iterations_ == iteration_step and not converged)) {
-      return std::nullopt;
+// Computes the primitives from the current pressure. If the iteration has
+// converged `primitive_data` is set, otherwise the rest mass density and
+// specific enthalpy at which to evaluate the equation of state are returned
+// in `rest_mass_density` and `specific_enthalpy`.
+NewmanHamlinStage newman_hamlin_before_equation_of_state(
+    const gsl::not_null<NewmanHamlinState*> state,
+    const gsl::not_null<std::optional<PrimitiveRecoveryData>*> primitive_data,
+    const gsl::not_null<double*> rest_mass_density,
+    const gsl::not_null<double*> specific_enthalpy,
+    const double total_energy_density, const double momentum_density_squared,
+    const double momentum_density_dot_magnetic_field,
+    const double magnetic_field_squared,
+    const double rest_mass_density_times_lorentz_factor,
+    const double electron_fraction, const size_t max_iterations) {
+  if (UNLIKELY(max_iterations == state->iteration_step and
+               not state->converged)) {
+    return NewmanHamlinStage::Failed;
+  }
+
+  ++state->iteration_step;
+  state->previous_pressure = state->current_pressure;
+  // enforces NH Eq.(5.9): d <= (4/27) a^3 so cubic has positive root
+  state->current_pressure =
+      std::max(state->current_pressure, state->minimum_pressure);
+  const double a_in_cubic = total_energy_density + state->current_pressure +
+                            0.5 * magnetic_field_squared;
+
+  if (UNLIKELY(a_in_cubic <= 0.0)) {
+    return NewmanHamlinStage::Failed;
+  }
+
+  // NH Eq. (5.10): d = (4/27) a^3 cos^2(phi)
+  const double phi = acos(sqrt(6.75 * state->d_in_cubic / cube(a_in_cubic)));
+  // NH Eq. (5.11) with l=1 is desired positive root
+  const double root_of_cubic =
+      (a_in_cubic / 3.0) * (1.0 - 2.0 * cos((2.0 / 3.0) * (M_PI + phi)));
+  // NH Eq. (5.5) with their script L being rho_h_w_squared
+  // where rho is rest_mass_density, h is specific_enthalpy,
+  // and w is the lorentz factor
+  const double rho_h_w_squared = root_of_cubic - magnetic_field_squared;
+
+  if (UNLIKELY(rho_h_w_squared <= 0.0)) {
+    return NewmanHamlinStage::Failed;
+  }
+
+  // NH Eq. (5.2) with (5.5) substituted in denominator
+  const double v_squared =
+      (momentum_density_squared * square(rho_h_w_squared) +
+       square(momentum_density_dot_magnetic_field) *
+           (magnetic_field_squared + 2.0 * rho_h_w_squared)) /
+      square(rho_h_w_squared * root_of_cubic);
+
+  // If this fails, there was code in the Bitbucket version that adjusted
+  // the pressure to get the maximum allowed velocity in atmosphere.
+  // Instead, we could return std::nullopt and try the next inversion method.
+  if (UNLIKELY(v_squared < 0.0 or v_squared >= 1.0)) {
+    return NewmanHamlinStage::Failed;
+  }
+
+  const double current_lorentz_factor = sqrt(1.0 / (1.0 - v_squared));
+  const double current_rest_mass_density =
+      rest_mass_density_times_lorentz_factor / current_lorentz_factor;
+
+  if (state->converged) {
+    *primitive_data = PrimitiveRecoveryData{
+        current_rest_mass_density, current_lorentz_factor,
+        state->current_pressure, rho_h_w_squared, electron_fraction,
+        state->iteration_step};
+    return NewmanHamlinStage::Converged;
+  }
+
+  const double current_specific_enthalpy = [rho_h_w_squared,
+                                            current_rest_mass_density,
+                                            current_lorentz_factor]() {
+    const double local_specific_enthalpy =
+        rho_h_w_squared /
+        (current_rest_mass_density * square(current_lorentz_factor));
+    if (UNLIKELY(1.0 - 1.0e-12 > local_specific_enthalpy)) {
+      return local_specific_enthalpy;  // will fail returning std::nullopt
     }
+    return std::max(1.0, local_specific_enthalpy);
+  }();
+  if (UNLIKELY(1.0 > current_specific_enthalpy)) {
+    return NewmanHamlinStage::Failed;
+  }
+  *rest_mass_density = current_rest_mass_density;
+  *specific_enthalpy = current_specific_enthalpy;
+  return NewmanHamlinStage::NeedsEquationOfState;
+}
 
-    ++iteration_step;
-    previous_pressure = current_pressure;
-    // enforces NH Eq.(5.9): d <= (4/27) a^3 so cubic has positive root
-    current_pressure = std::max(current_pressure, minimum_pressure);
-    const double a_in_cubic =
-        total_energy_density + current_pressure + 0.5 * magnetic_field_squared;
+// Updates the pressure with the value from the equation of state, applying
+// Aitken extrapolation. Returns `false` if the recovery failed.
+template <size_t ThermodynamicDim>
+bool newman_hamlin_after_equation_of_state(
+    const gsl::not_null<NewmanHamlinState*> state, const double new_pressure,
+    const double relative_tolerance) {
+  state->current_pressure = new_pressure;
+  if constexpr (ThermodynamicDim == 2) {
+    if (UNLIKELY(state->current_pressure <= 0.0)) {
+      return false;
+    }
+  }
 
-    if (UNLIKELY(a_in_cubic <= 0.0)) {
-      return std::nullopt;
+  auto& aitken_pressure = state->aitken_pressure;
+  gsl::at(aitken_pressure, state->valid_entries_in_aitken_pressure++) =
+      state->current_pressure;
+  if (3 == state->valid_entries_in_aitken_pressure) {
+    const double aitken_residual = (aitken_pressure[2] - aitken_pressure[1]) /
+                                   (aitken_pressure[1] - aitken_pressure[0]);
+    if (0.0 <= aitken_residual and aitken_residual < 1.0) {
+      state->previous_pressure = state->current_pressure;
+      state->current_pressure =
+          aitken_pressure[1] +
+          (aitken_pressure[2] - aitken_pressure[1]) / (1.0 - aitken_residual);
+      aitken_pressure = {{state->current_pressure,
+                          std::numeric_limits<double>::signaling_NaN(),
+                          std::numeric_limits<double>::signaling_NaN()}};
+      state->valid_entries_in_aitken_pressure = 1;
+    } else {
+      // Aitken extrapolation failed, retain latest 2 values for next attempt
+      aitken_pressure[0] = aitken_pressure[1];
+      aitken_pressure[1] = aitken_pressure[2];
+      state->valid_entries_in_aitken_pressure = 2;
     }
+  }
+  // note primitives are recomputed before being returned
+  state->converged =
+      fabs(state->current_pressure - state->previous_pressure) <=
+      relative_tolerance *
+          (state->current_pressure + state->previous_pressure);
+  return true;
+}
+}  // namespace
 
-    // NH Eq. (5.10): d = (4/27) a^3 cos^2(phi)
-    const double phi = acos(sqrt(6.75 * d_in_cubic / cube(a_in_cubic)));
-    // NH Eq. (5.11) with l=1 is desired positive root
-    const double root_of_cubic =
-        (a_in_cubic / 3.0) * (1.0 - 2.0 * cos((2.0 / 3.0) * (M_PI + phi)));
-    // NH Eq. (5.5) with their script L being rho_h_w_squared
-    // where rho is rest_mass_density, h is specific_enthalpy,
-    // and w is the lorentz factor
-    const double rho_h_w_squared = root_of_cubic - magnetic_field_squared;
-
-    if (UNLIKELY(rho_h_w_squared <= 0.0)) {
-      return std::nullopt;
+template <size_t ThermodynamicDim>
+std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
+    const double initial_guess_for_pressure, const double total_energy_density,
+    const double momentum_density_squared,
+    const double momentum_density_dot_magnetic_field,
+    const double magnetic_field_squared,
+    const double rest_mass_density_times_lorentz_factor,
+    const double electron_fraction,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) {
+  static_assert(ThermodynamicDim == 1 or ThermodynamicDim == 2,
+                "3d EOS not implemented");
+  std::optional<NewmanHamlinState> state = initialize_newman_hamlin(
+      initial_guess_for_pressure, total_energy_density,
+      momentum_density_squared, momentum_density_dot_magnetic_field,
+      magnetic_field_squared);
+  if (UNLIKELY(not state.has_value())) {
+    return std::nullopt;
+  }
+
+  std::optional<PrimitiveRecoveryData> primitive_data{};
+  double rest_mass_density = std::numeric_limits<double>::signaling_NaN();
+  double specific_enthalpy = std::numeric_limits<double>::signaling_NaN();
+  while (true) {  // will break when relative pressure change is <
+                  // relative_tolernance_
+    const NewmanHamlinStage stage = newman_hamlin_before_equation_of_state(
+        make_not_null(&*state), make_not_null(&primitive_data),
+        make_not_null(&rest_mass_density), make_not_null(&specific_enthalpy),
+        total_energy_density, momentum_density_squared,
+        momentum_density_dot_magnetic_field, magnetic_field_squared,
+        rest_mass_density_times_lorentz_factor, electron_fraction,
+        max_iterations_);
+    if (stage != NewmanHamlinStage::NeedsEquationOfState) {
+      return primitive_data;
     }
 
-    // NH Eq. (5.2) with (5.5) substituted in denominator
-    const double v_squared =
-        (momentum_density_squared * square(rho_h_w_squared) +
-         square(momentum_density_dot_magnetic_field) *
-             (magnetic_field_squared + 2.0 * rho_h_w_squared)) /
-        square(rho_h_w_squared * root_of_cubic);
-
-    // If this fails, there was code in the Bitbucket version that adjusted
-    // the pressure to get the maximum allowed velocity in atmosphere.
-    // Instead, we could return std::nullopt and try the next inversion method.
-    if (UNLIKELY(v_squared < 0.0 or v_squared >= 1.0)) {
+    double new_pressure = std::numeric_limits<double>::signaling_NaN();
+    if constexpr (ThermodynamicDim == 1) {
+      new_pressure = get(equation_of_state.pressure_from_density(
+          Scalar<double>(rest_mass_density)));
+    } else if constexpr (ThermodynamicDim == 2) {
+      new_pressure = get(equation_of_state.pressure_from_density_and_enthalpy(
+          Scalar<double>(rest_mass_density),
+          Scalar<double>(specific_enthalpy)));
+    }
+    if (UNLIKELY(not newman_hamlin_after_equation_of_state<ThermodynamicDim>(
+            make_not_null(&*state), new_pressure, relative_tolerance_))) {
       return std::nullopt;
     }
+  }  // while loop
+}
 
-    const double current_lorentz_factor = sqrt(1.0 / (1.0 - v_squared));
-    const double current_rest_mass_density =
-        rest_mass_density_times_lorentz_factor / current_lorentz_factor;
-
-    if (converged) {
-      return PrimitiveRecoveryData{current_rest_mass_density,
-                                   current_lorentz_factor, current_pressure,
-                                   rho_h_w_squared, electron_fraction};
+template <size_t ThermodynamicDim>
+void NewmanHamlin::apply(
+    const gsl::not_null<std::vector<std::optional<PrimitiveRecoveryData>>*>
+        primitive_data,
+    const std::vector<size_t>& points,
+    const DataVector& initial_guess_for_pressure,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const DataVector& electron_fraction,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) {
+  static_assert(ThermodynamicDim == 1 or ThermodynamicDim == 2,
+                "3d EOS not implemented");
+  ASSERT(primitive_data->size() == total_energy_density.size(),
+         "The primitive data must have one entry per grid point, "
+             << total_energy_density.size() << ", but has "
+             << primitive_data->size());
+  // The points that are still iterating and their states. Points that
+  // converged or failed are removed, so every equation of state call only
+  // contains points that need it.
+  std::vector<size_t> active_points{};
+  std::vector<NewmanHamlinState> states{};
+  active_points.reserve(points.size());
+  states.reserve(points.size());
+  for (const size_t s : points) {
+    ASSERT(s < total_energy_density.size(),
+           "Point " << s << " is out of range for "
+                    << total_energy_density.size() << " grid points.");
+    std::optional<NewmanHamlinState> state = initialize_newman_hamlin(
+        initial_guess_for_pressure[s], total_energy_density[s],
+        momentum_density_squared[s], momentum_density_dot_magnetic_field[s],
+        magnetic_field_squared[s]);
+    if (LIKELY(state.has_value())) {
+      active_points.push_back(s);
+      states.push_back(*state);
     }
+  }
 
-    const double current_specific_enthalpy = [rho_h_w_squared,
-                                              current_rest_mass_density,
-                                              current_lorentz_factor]() {
-      const double specific_enthalpy =
-          rho_h_w_squared /
-          (current_rest_mass_density * square(current_lorentz_factor));
-      if (UNLIKELY(1.0 - 1.0e-12 > specific_enthalpy)) {
-        return specific_enthalpy;  // will fail returning std::nullopt
+  Scalar<DataVector> rest_mass_density{active_points.size()};
+  Scalar<DataVector> specific_enthalpy{active_points.size()};
+  while (not active_points.empty()) {
+    // Compute the primitives at all active points, dropping the ones that
+    // converged or failed.
+    size_t number_needing_eos = 0;
+    for (size_t i = 0; i < active_points.size(); ++i) {
+      const size_t s = active_points[i];
+      double local_rest_mass_density =
+          std::numeric_limits<double>::signaling_NaN();
+      double local_specific_enthalpy =
+          std::numeric_limits<double>::signaling_NaN();
+      if (newman_hamlin_before_equation_of_state(
+              make_not_null(&states[i]), make_not_null(&(*primitive_data)[s]),
+              make_not_null(&local_rest_mass_density),
+              make_not_null(&local_specific_enthalpy), total_energy_density[s],
+              momentum_density_squared[s],
+              momentum_density_dot_magnetic_field[s],
+              magnetic_field_squared[s],
+              rest_mass_density_times_lorentz_factor[s],
+              electron_fraction[s], max_iterations_) ==
+          NewmanHamlinStage::NeedsEquationOfState) {
+        active_points[number_needing_eos] = s;
+        states[number_needing_eos] = states[i];
+        get(rest_mass_density)[number_needing_eos] = local_rest_mass_density;
+        get(specific_enthalpy)[number_needing_eos] = local_specific_enthalpy;
+        ++number_needing_eos;
       }
-      return std::max(1.0, specific_enthalpy);
-    }();
-    if (UNLIKELY(1.0 > current_specific_enthalpy)) {
-      return std::nullopt;
+    }
+    active_points.resize(number_needing_eos);
+    states.resize(number_needing_eos);
+    if (active_points.empty()) {
+      break;
     }
 
+    // Evaluate the equation of state once for all remaining points.
+    const Scalar<DataVector> rest_mass_density_view{
+        DataVector{get(rest_mass_density).data(), number_needing_eos}};
+    Scalar<DataVector> new_pressure{};
     if constexpr (ThermodynamicDim == 1) {
-      current_pressure = get(equation_of_state.pressure_from_density(
-          Scalar<double>(current_rest_mass_density)));
+      new_pressure =
+          equation_of_state.pressure_from_density(rest_mass_density_view);
     } else if constexpr (ThermodynamicDim == 2) {
-      current_pressure =
-          get(equation_of_state.pressure_from_density_and_enthalpy(
-              Scalar<double>(current_rest_mass_density),
-              Scalar<double>(current_specific_enthalpy)));
-      if (UNLIKELY(current_pressure <= 0.0)) {
-        return std::nullopt;
-      }
-    } else if constexpr (ThermodynamicDim == 3) {
-      ERROR("3d EOS not implemented");
+      const Scalar<DataVector> specific_enthalpy_view{
+          DataVector{get(specific_enthalpy).data(), number_needing_eos}};
+      new_pressure = equation_of_state.pressure_from_density_and_enthalpy(
+          rest_mass_density_view, specific_enthalpy_view);
     }
 
-    gsl::at(aitken_pressure, valid_entries_in_aitken_pressure++) =
-        current_pressure;
-    if (3 == valid_entries_in_aitken_pressure) {
-      const double aitken_residual = (aitken_pressure[2] - aitken_pressure[1]) /
-                                     (aitken_pressure[1] - aitken_pressure[0]);
-      if (0.0 <= aitken_residual and aitken_residual < 1.0) {
-        previous_pressure = current_pressure;
-        current_pressure =
-            aitken_pressure[1] +
-            (aitken_pressure[2] - aitken_pressure[1]) / (1.0 - aitken_residual);
-        aitken_pressure = {{current_pressure,
-                            std::numeric_limits<double>::signaling_NaN(),
-                            std::numeric_limits<double>::signaling_NaN()}};
-        valid_entries_in_aitken_pressure = 1;
-      } else {
-        // Aitken extrapolation failed, retain latest 2 values for next attempt
-        aitken_pressure[0] = aitken_pressure[1];
-        aitken_pressure[1] = aitken_pressure[2];
-        valid_entries_in_aitken_pressure = 2;
+    size_t number_active = 0;
+    for (size_t i = 0; i < number_needing_eos; ++i) {
+      if (LIKELY(newman_hamlin_after_equation_of_state<ThermodynamicDim>(
+              make_not_null(&states[i]), get(new_pressure)[i],
+              relative_tolerance_))) {
+        active_points[number_active] = active_points[i];
+        states[number_active] = states[i];
+        ++number_active;
       }
     }
-    // note primitives are recomputed above before being returned
-    converged = fabs(current_pressure - previous_pressure) <=
-                relative_tolerance_ * (current_pressure + previous_pressure);
-  }  // while loop
+    active_points.resize(number_active);
+    states.resize(number_active);
+  }
 }
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
@@ -184,6 +384,23 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
       const double magnetic_field_squared,                                    \
       const double rest_mass_density_times_lorentz_factor,                    \
       const double electron_fraction,                                         \
+      const EquationsOfState::EquationOfState<true, THERMODIM(data)>&         \
+          equation_of_state);                                                 \
+  template void                                                               \
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin::apply<     \
+      THERMODIM(data)>(                                                       \
+      const gsl::not_null<std::vector<std::optional<                          \
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::                 \
+              PrimitiveRecoveryData>>*>                                       \
+          primitive_data,                                                     \
+      const std::vector<size_t>& points,                                      \
+      const DataVector& initial_guess_for_pressure,                           \
+      const DataVector& total_energy_density,                                 \
+      const DataVector& momentum_density_squared,                             \
+      const DataVector& momentum_density_dot_magnetic_field,                  \
+      const DataVector& magnetic_field_squared,                               \
+      const DataVector& rest_mass_density_times_lorentz_factor,               \
+      const DataVector& electron_fraction,                                    \
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&         \
           equation_of_state);
 
@@ -6,10 +6,19 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd {
@@ -43,6 +52,13 @@ namespace PrimitiveRecoverySchemes {
  * density, momentum density, specific internal energy density, and magnetic
  * field, and \f$\gamma\f$ and \f$\gamma^{mn}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{mn}\f$.
+ *
+ * The second overload recovers the primitives at all grid points in `points`
+ * at once, leaving `primitive_data` as `std::nullopt` at points where the
+ * recovery fails. It performs the same iteration as the single-point version,
+ * but evaluates the equation of state once per iteration for all points that
+ * have not yet converged or failed instead of once for each point, avoiding
+ * the virtual call per point and allowing the equation of state to vectorize.
  */
 class NewmanHamlin {
  public:
@@ -55,8 +71,26 @@ class NewmanHamlin {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state);
 
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<std::vector<std::optional<PrimitiveRecoveryData>>*>
+          primitive_data,
+      const std::vector<size_t>& points,
+      const DataVector& initial_guess_for_pressure,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const DataVector& electron_fraction,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state);
+
   static const std::string name() { return "Newman Hamlin"; }
 
+  /// Whether the batched overload of `apply` is available.
+  static constexpr bool supports_batched_recovery = true;
+
  private:
   static constexpr size_t max_iterations_ = 50;
   static constexpr double relative_tolerance_ = 1.e-10;
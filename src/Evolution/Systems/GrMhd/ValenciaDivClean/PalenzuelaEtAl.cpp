@@ -4,6 +4,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <exception>
 #include <limits>
 
@@ -121,12 +122,18 @@ std::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
                                     rest_mass_density_times_lorentz_factor,
                                     electron_fraction,
                                     equation_of_state};
+  size_t number_of_iterations = 0;
+  const auto counted_f_of_x = [&f_of_x,
+                               &number_of_iterations](const double x) {
+    ++number_of_iterations;
+    return f_of_x(x);
+  };
   double specific_enthalpy_times_lorentz_factor =
       std::numeric_limits<double>::signaling_NaN();
   try {
     specific_enthalpy_times_lorentz_factor =
         // NOLINTNEXTLINE(clang-analyzer-core)
-        RootFinder::toms748(f_of_x, lower_bound, upper_bound,
+        RootFinder::toms748(counted_f_of_x, lower_bound, upper_bound,
                             absolute_tolerance_, relative_tolerance_,
                             max_iterations_);
   } catch (std::exception& exception) {
@@ -153,7 +160,7 @@ std::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
   return PrimitiveRecoveryData{rest_mass_density, lorentz_factor, pressure,
                                specific_enthalpy_times_lorentz_factor *
                                    rest_mass_density_times_lorentz_factor,
-                               electron_fraction};
+                               electron_fraction, number_of_iterations};
 }
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
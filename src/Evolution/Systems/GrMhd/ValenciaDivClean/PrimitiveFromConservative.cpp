@@ -3,10 +3,12 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <limits>
 #include <optional>
 #include <ostream>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -18,6 +20,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryStatistics.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"  // IWYU pragma: keep
@@ -28,6 +31,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 // IWYU pragma: no_include <array>
 
@@ -35,6 +39,9 @@
 // IWYU pragma: no_forward_declare Tensor
 
 namespace grmhd::ValenciaDivClean {
+namespace {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(supports_batched_recovery)
+}  // namespace
 
 template <typename OrderedListOfPrimitiveRecoverySchemes, bool ErrorOnFailure>
 template <bool EnforcePhysicality, size_t ThermodynamicDim>
@@ -64,6 +71,46 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
               equation_of_state,
           const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
               primitive_from_conservative_options) {
+  PrimitiveRecoveryStatistics statistics{};
+  return apply<EnforcePhysicality>(
+      rest_mass_density, electron_fraction, specific_internal_energy,
+      spatial_velocity, magnetic_field, divergence_cleaning_field,
+      lorentz_factor, pressure, specific_enthalpy, temperature,
+      make_not_null(&statistics), tilde_d, tilde_ye, tilde_tau, tilde_s,
+      tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+      sqrt_det_spatial_metric, equation_of_state,
+      primitive_from_conservative_options);
+}
+
+template <typename OrderedListOfPrimitiveRecoverySchemes, bool ErrorOnFailure>
+template <bool EnforcePhysicality, size_t ThermodynamicDim>
+bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
+                               ErrorOnFailure>::
+    apply(const gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+          const gsl::not_null<Scalar<DataVector>*> electron_fraction,
+          const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+          const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+              spatial_velocity,
+          const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+              magnetic_field,
+          const gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
+          const gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+          const gsl::not_null<Scalar<DataVector>*> pressure,
+          const gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
+          const gsl::not_null<Scalar<DataVector>*> temperature,
+          const gsl::not_null<PrimitiveRecoveryStatistics*> statistics,
+          const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_ye,
+          const Scalar<DataVector>& tilde_tau,
+          const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
+          const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+          const Scalar<DataVector>& tilde_phi,
+          const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+          const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+          const Scalar<DataVector>& sqrt_det_spatial_metric,
+          const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+              equation_of_state,
+          const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+              primitive_from_conservative_options) {
   get(*divergence_cleaning_field) =
       get(tilde_phi) / get(sqrt_det_spatial_metric);
   for (size_t i = 0; i < 3; ++i) {
@@ -113,14 +160,36 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   const double floorD =
       primitive_from_conservative_options.density_when_skipping_inversion();
 
+  const size_t number_of_points = total_energy_density.size();
+  std::vector<std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>>
+      all_primitive_data(number_of_points, std::nullopt);
+  // The points at which the recovery schemes in
+  // OrderedListOfPrimitiveRecoverySchemes are needed.
+  std::vector<size_t> points_to_recover{};
+  points_to_recover.reserve(number_of_points);
+
+  const auto recover_at_point =
+      [&pressure, &all_primitive_data, &total_energy_density,
+       &momentum_density_squared, &momentum_density_dot_magnetic_field,
+       &magnetic_field_squared, &rest_mass_density_times_lorentz_factor,
+       &equation_of_state, &electron_fraction](auto scheme, const size_t s) {
+        using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
+        all_primitive_data[s] =
+            primitive_recovery_scheme::template apply<ThermodynamicDim>(
+                get(*pressure)[s], total_energy_density[s],
+                get(momentum_density_squared)[s],
+                get(momentum_density_dot_magnetic_field)[s],
+                get(magnetic_field_squared)[s],
+                rest_mass_density_times_lorentz_factor[s],
+                get(*electron_fraction)[s], equation_of_state);
+      };
+
   // This may need bounds
   // limit Ye to table bounds once that is implemented
-  for (size_t s = 0; s < total_energy_density.size(); ++s) {
+  for (size_t s = 0; s < number_of_points; ++s) {
     get(*electron_fraction)[s] =
         std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
 
-    std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
-        primitive_data = std::nullopt;
     // Quick exit from inversion in low-density regions where we will
     // apply atmosphere corrections anyways.
     if (rest_mass_density_times_lorentz_factor[s] < cutoffD) {
@@ -135,9 +204,9 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
                 Scalar<double>{specific_energy_at_point}));
         const double specific_enthalpy_at_point =
             1.0 + specific_energy_at_point + pressure_at_point / floorD;
-        primitive_data = PrimitiveRecoverySchemes::PrimitiveRecoveryData{
+        all_primitive_data[s] = PrimitiveRecoverySchemes::PrimitiveRecoveryData{
             floorD, 1.0, pressure_at_point, floorD * specific_enthalpy_at_point,
-            get(*electron_fraction)[s]};
+            get(*electron_fraction)[s], 0};
       }
       else if constexpr (ThermodynamicDim == 1) {
         const double specific_energy_at_point =
@@ -149,43 +218,85 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
                 Scalar<double>{floorD}));
         const double specific_enthalpy_at_point =
             1.0 + specific_energy_at_point + pressure_at_point / floorD;
-        primitive_data = PrimitiveRecoverySchemes::PrimitiveRecoveryData{
+        all_primitive_data[s] = PrimitiveRecoverySchemes::PrimitiveRecoveryData{
             floorD, 1.0, pressure_at_point, floorD * specific_enthalpy_at_point,
-            get(*electron_fraction)[s]};
+            get(*electron_fraction)[s], 0};
       }
+    } else if (use_hydro_optimization and
+               equal_within_roundoff(total_energy_density[s],
+                                     get(magnetic_field_squared)[s] * 0.5 +
+                                         total_energy_density[s])) {
+      // Check consistency
+      recover_at_point(
+          tmpl::type_<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+                          KastaunEtAlHydro<EnforcePhysicality>>{},
+          s);
     } else {
+      points_to_recover.push_back(s);
+    }
+  }
 
-    auto apply_scheme =
-        [&pressure, &primitive_data, &total_energy_density,
-         &momentum_density_squared, &momentum_density_dot_magnetic_field,
-         &magnetic_field_squared, &rest_mass_density_times_lorentz_factor,
-         &equation_of_state, &s, &electron_fraction](auto scheme) {
-          using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
-          if (not primitive_data.has_value()) {
-            primitive_data =
-                primitive_recovery_scheme::template apply<ThermodynamicDim>(
-                    get(*pressure)[s], total_energy_density[s],
-                    get(momentum_density_squared)[s],
-                    get(momentum_density_dot_magnetic_field)[s],
-                    get(magnetic_field_squared)[s],
-                    rest_mass_density_times_lorentz_factor[s],
-                    get(*electron_fraction)[s], equation_of_state);
-          }
-        };
-
-    // Check consistency
-    if (use_hydro_optimization and
-        equal_within_roundoff(
-            total_energy_density[s],
-            get(magnetic_field_squared)[s] * 0.5 + total_energy_density[s])) {
-      tmpl::for_each<
-          tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
-                         KastaunEtAlHydro<EnforcePhysicality>>>(apply_scheme);
+  constexpr size_t number_of_schemes =
+      tmpl::size<OrderedListOfPrimitiveRecoverySchemes>::value;
+  if (statistics->number_of_schemes() != number_of_schemes) {
+    *statistics = PrimitiveRecoveryStatistics{number_of_schemes};
+  }
+  const size_t starting_scheme = statistics->starting_scheme();
+
+  // Try each scheme on the points at which all previously tried schemes
+  // failed. Schemes that support it recover all of these points at once.
+  const auto try_scheme = [&](auto scheme, const size_t scheme_index) {
+    using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
+    if (points_to_recover.empty()) {
+      return;
+    }
+    if constexpr (get_supports_batched_recovery_or_default_v<
+                      primitive_recovery_scheme, false>) {
+      primitive_recovery_scheme::template apply<ThermodynamicDim>(
+          make_not_null(&all_primitive_data), points_to_recover,
+          get(*pressure), total_energy_density, get(momentum_density_squared),
+          get(momentum_density_dot_magnetic_field),
+          get(magnetic_field_squared), rest_mass_density_times_lorentz_factor,
+          get(*electron_fraction), equation_of_state);
     } else {
-      tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(apply_scheme);
+      for (const size_t s : points_to_recover) {
+        recover_at_point(scheme, s);
+      }
     }
-   }
-
+    for (const size_t s : points_to_recover) {
+      statistics->record_attempt(
+          scheme_index, all_primitive_data[s].has_value(),
+          all_primitive_data[s].has_value()
+              ? all_primitive_data[s].value().number_of_iterations
+              : 0);
+    }
+    points_to_recover.erase(
+        std::remove_if(points_to_recover.begin(), points_to_recover.end(),
+                       [&all_primitive_data](const size_t s) {
+                         return all_primitive_data[s].has_value();
+                       }),
+        points_to_recover.end());
+  };
+  size_t scheme_index = 0;
+  tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(
+      [&scheme_index, &starting_scheme, &try_scheme](auto scheme) {
+        if (scheme_index == starting_scheme) {
+          try_scheme(scheme, scheme_index);
+        }
+        ++scheme_index;
+      });
+  scheme_index = 0;
+  tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(
+      [&scheme_index, &starting_scheme, &try_scheme](auto scheme) {
+        if (scheme_index != starting_scheme) {
+          try_scheme(scheme, scheme_index);
+        }
+        ++scheme_index;
+      });
+
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>&
+        primitive_data = all_primitive_data[s];
     if (primitive_data.has_value()) {
       get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
       const double coefficient_of_b =
@@ -309,6 +420,36 @@ GENERATE_INSTANTIATIONS(
       const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,        \
       const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,    \
       const Scalar<DataVector>& sqrt_det_spatial_metric,                     \
+      const EquationsOfState::EquationOfState<true, THERMODIM(data)>&        \
+          equation_of_state,                                                 \
+      const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&       \
+          primitive_from_conservative_options);                              \
+  template bool grmhd::ValenciaDivClean::PrimitiveFromConservative<          \
+      RECOVERY(data), ERROR_ON_FAILURE(data)>::apply<PHYSICALITY(data),      \
+                                                     THERMODIM(data)>(       \
+      const gsl::not_null<Scalar<DataVector>*> rest_mass_density,            \
+      const gsl::not_null<Scalar<DataVector>*> electron_fraction,            \
+      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,     \
+      const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>          \
+          spatial_velocity,                                                  \
+      const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>          \
+          magnetic_field,                                                    \
+      const gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,    \
+      const gsl::not_null<Scalar<DataVector>*> lorentz_factor,               \
+      const gsl::not_null<Scalar<DataVector>*> pressure,                     \
+      const gsl::not_null<Scalar<DataVector>*> specific_enthalpy,            \
+      const gsl::not_null<Scalar<DataVector>*> temperature,                  \
+      const gsl::not_null<                                                   \
+          grmhd::ValenciaDivClean::PrimitiveRecoveryStatistics*>             \
+          statistics,                                                        \
+      const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_ye, \
+      const Scalar<DataVector>& tilde_tau,                                   \
+      const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,                \
+      const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,                \
+      const Scalar<DataVector>& tilde_phi,                                   \
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,        \
+      const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,    \
+      const Scalar<DataVector>& sqrt_det_spatial_metric,                     \
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&        \
           equation_of_state,                                                 \
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&       \
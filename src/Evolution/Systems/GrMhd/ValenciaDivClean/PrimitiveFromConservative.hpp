@@ -24,6 +24,9 @@ class not_null;
 }  // namespace gsl
 
 class DataVector;
+namespace grmhd::ValenciaDivClean {
+class PrimitiveRecoveryStatistics;
+}  // namespace grmhd::ValenciaDivClean
 /// \endcond
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
@@ -48,6 +51,15 @@ namespace ValenciaDivClean {
  * If `EnforcePhysicality` is `false` then the hydrodynamic inversion will
  * return with an error if the input conservatives are unphysical, i.e., if no
  * solution exits. The exact behavior is governed by `ErrorOnFailure`.
+ *
+ * The schemes in `OrderedListOfPrimitiveRecoverySchemes` are tried in order
+ * at each point until one succeeds. When a
+ * `grmhd::ValenciaDivClean::PrimitiveRecoveryStatistics` is passed, e.g. by
+ * mutating with the `return_tags_with_statistics`, the scheme that was
+ * cheapest on the element in the past is tried first instead, and the
+ * success and iteration counts of every scheme are recorded. Points at which
+ * the hydro-only inversion is used or the inversion is skipped because of low
+ * density are not recorded.
  */
 template <typename OrderedListOfPrimitiveRecoverySchemes,
           bool ErrorOnFailure = true>
@@ -63,6 +75,8 @@ struct PrimitiveFromConservative {
                  hydro::Tags::Pressure<DataVector>,
                  hydro::Tags::SpecificEnthalpy<DataVector>,
                  hydro::Tags::Temperature<DataVector>>;
+  using return_tags_with_statistics = tmpl::push_back<
+      return_tags, grmhd::ValenciaDivClean::Tags::PrimitiveRecoveryStatistics>;
 
   using argument_tags = tmpl::list<
       grmhd::ValenciaDivClean::Tags::TildeD,
@@ -102,6 +116,37 @@ struct PrimitiveFromConservative {
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
           primitive_from_conservative_options);
 
+  /// Same as above, but records in `statistics` which scheme succeeded at
+  /// each point and how many iterations it took, and starts from the scheme
+  /// returned by `PrimitiveRecoveryStatistics::starting_scheme()` before
+  /// trying the remaining schemes in order. Meant to be called with the
+  /// `return_tags_with_statistics`.
+  template <bool EnforcePhysicality = true, size_t ThermodynamicDim>
+  static bool apply(
+      gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+      gsl::not_null<Scalar<DataVector>*> electron_fraction,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> spatial_velocity,
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> magnetic_field,
+      gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
+      gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
+      gsl::not_null<Scalar<DataVector>*> temperature,
+      gsl::not_null<PrimitiveRecoveryStatistics*> statistics,
+      const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_ye,
+      const Scalar<DataVector>& tilde_tau,
+      const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
+      const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+      const Scalar<DataVector>& tilde_phi,
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+      const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+      const Scalar<DataVector>& sqrt_det_spatial_metric,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state,
+      const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+          primitive_from_conservative_options);
+
  private:
   // Use Kastaun hydro inversion if B is dynamically unimportant
   static constexpr bool use_hydro_optimization = true;
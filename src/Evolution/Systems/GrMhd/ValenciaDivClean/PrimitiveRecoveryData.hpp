@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace grmhd {
 namespace ValenciaDivClean {
 
@@ -15,6 +17,10 @@ namespace PrimitiveRecoverySchemes {
  *
  * `rho_h_w_squared` is \f$\rho h W^2\f$ where \f$\rho\f$ is the rest mass
  * density, \f$h\f$ is the specific enthalpy, and \f$W\f$ is the Lorentz factor.
+ *
+ * `number_of_iterations` is the number of iterations the scheme needed. For
+ * schemes using a bracketed root find it is the number of evaluations of the
+ * function whose root is found, and it is zero if no root find was done.
  */
 struct PrimitiveRecoveryData {
   double rest_mass_density;
@@ -22,6 +28,7 @@ struct PrimitiveRecoveryData {
   double pressure;
   double rho_h_w_squared;
   double electron_fraction;
+  size_t number_of_iterations;
 };
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
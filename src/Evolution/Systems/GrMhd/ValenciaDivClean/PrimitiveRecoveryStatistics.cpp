@@ -0,0 +1,116 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryStatistics.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <pup.h>
+#include <pup_stl.h>
+#include <vector>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace grmhd::ValenciaDivClean {
+PrimitiveRecoveryStatistics::PrimitiveRecoveryStatistics(
+    const size_t number_of_schemes)
+    : number_of_attempts_(number_of_schemes, 0),
+      number_of_successes_(number_of_schemes, 0),
+      number_of_iterations_(number_of_schemes, 0),
+      iteration_histograms_(number_of_schemes,
+                            std::array<size_t, number_of_iteration_bins>{}) {}
+
+void PrimitiveRecoveryStatistics::record_attempt(
+    const size_t scheme, const bool succeeded,
+    const size_t number_of_iterations) {
+  ASSERT(scheme < number_of_schemes(),
+         "Scheme " << scheme << " is out of range for " << number_of_schemes()
+                   << " schemes.");
+  ++number_of_attempts_[scheme];
+  if (succeeded) {
+    ++number_of_successes_[scheme];
+    number_of_iterations_[scheme] += number_of_iterations;
+    size_t bin = 0;
+    for (size_t remaining = number_of_iterations;
+         remaining > 0 and bin < number_of_iteration_bins - 1;
+         remaining /= 2) {
+      ++bin;
+    }
+    ++gsl::at(iteration_histograms_[scheme], bin);
+  }
+}
+
+size_t PrimitiveRecoveryStatistics::starting_scheme() const {
+  size_t best_scheme = 0;
+  double lowest_cost = std::numeric_limits<double>::max();
+  for (size_t scheme = 0; scheme < number_of_schemes(); ++scheme) {
+    if (number_of_attempts_[scheme] < minimum_number_of_attempts or
+        static_cast<double>(number_of_successes_[scheme]) <
+            minimum_success_fraction *
+                static_cast<double>(number_of_attempts_[scheme])) {
+      continue;
+    }
+    const double cost = static_cast<double>(number_of_iterations_[scheme]) /
+                        static_cast<double>(number_of_successes_[scheme]);
+    if (cost < lowest_cost) {
+      lowest_cost = cost;
+      best_scheme = scheme;
+    }
+  }
+  return best_scheme;
+}
+
+size_t PrimitiveRecoveryStatistics::number_of_attempts(
+    const size_t scheme) const {
+  ASSERT(scheme < number_of_schemes(),
+         "Scheme " << scheme << " is out of range for " << number_of_schemes()
+                   << " schemes.");
+  return number_of_attempts_[scheme];
+}
+
+size_t PrimitiveRecoveryStatistics::number_of_successes(
+    const size_t scheme) const {
+  ASSERT(scheme < number_of_schemes(),
+         "Scheme " << scheme << " is out of range for " << number_of_schemes()
+                   << " schemes.");
+  return number_of_successes_[scheme];
+}
+
+size_t PrimitiveRecoveryStatistics::number_of_iterations(
+    const size_t scheme) const {
+  ASSERT(scheme < number_of_schemes(),
+         "Scheme " << scheme << " is out of range for " << number_of_schemes()
+                   << " schemes.");
+  return number_of_iterations_[scheme];
+}
+
+const std::array<size_t, PrimitiveRecoveryStatistics::number_of_iteration_bins>&
+PrimitiveRecoveryStatistics::iteration_histogram(const size_t scheme) const {
+  ASSERT(scheme < number_of_schemes(),
+         "Scheme " << scheme << " is out of range for " << number_of_schemes()
+                   << " schemes.");
+  return iteration_histograms_[scheme];
+}
+
+void PrimitiveRecoveryStatistics::pup(PUP::er& p) {
+  p | number_of_attempts_;
+  p | number_of_successes_;
+  p | number_of_iterations_;
+  p | iteration_histograms_;
+}
+
+bool operator==(const PrimitiveRecoveryStatistics& lhs,
+                const PrimitiveRecoveryStatistics& rhs) {
+  return lhs.number_of_attempts_ == rhs.number_of_attempts_ and
+         lhs.number_of_successes_ == rhs.number_of_successes_ and
+         lhs.number_of_iterations_ == rhs.number_of_iterations_ and
+         lhs.iteration_histograms_ == rhs.iteration_histograms_;
+}
+
+bool operator!=(const PrimitiveRecoveryStatistics& lhs,
+                const PrimitiveRecoveryStatistics& rhs) {
+  return not(lhs == rhs);
+}
+}  // namespace grmhd::ValenciaDivClean
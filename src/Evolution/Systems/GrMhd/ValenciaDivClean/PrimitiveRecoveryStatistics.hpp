@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace grmhd::ValenciaDivClean {
+/*!
+ * \brief Counts how often and at which cost each primitive recovery scheme
+ * succeeded on an element, and chooses the scheme to try first.
+ *
+ * The schemes are identified by their index in the list of primitive recovery
+ * schemes passed to `PrimitiveFromConservative`. For every attempt at a grid
+ * point we record whether the scheme succeeded and, if it did, the number of
+ * iterations it needed (see `PrimitiveRecoveryData`). The iteration counts are
+ * also binned into a histogram where bin \f$i\f$ holds the recoveries that
+ * needed fewer than \f$2^i\f$ iterations but at least \f$2^{i-1}\f$, and the
+ * last bin holds all recoveries with more iterations.
+ *
+ * `starting_scheme()` returns the scheme with the lowest average number of
+ * iterations among the schemes that succeeded in at least
+ * `minimum_success_fraction` of at least `minimum_number_of_attempts`
+ * attempts. If no scheme satisfies this the first scheme in the list is used,
+ * so that the list is tried in its original order.
+ */
+class PrimitiveRecoveryStatistics {
+ public:
+  static constexpr size_t number_of_iteration_bins = 8;
+  static constexpr size_t minimum_number_of_attempts = 16;
+  static constexpr double minimum_success_fraction = 0.99;
+
+  PrimitiveRecoveryStatistics() = default;
+  explicit PrimitiveRecoveryStatistics(size_t number_of_schemes);
+
+  /// Record an attempt of the scheme with index `scheme` at a grid point.
+  /// `number_of_iterations` is ignored if the scheme failed.
+  void record_attempt(size_t scheme, bool succeeded,
+                      size_t number_of_iterations);
+
+  /// The index of the scheme that should be tried first.
+  size_t starting_scheme() const;
+
+  size_t number_of_schemes() const { return number_of_attempts_.size(); }
+
+  size_t number_of_attempts(size_t scheme) const;
+
+  size_t number_of_successes(size_t scheme) const;
+
+  /// The total number of iterations of all successful attempts.
+  size_t number_of_iterations(size_t scheme) const;
+
+  const std::array<size_t, number_of_iteration_bins>& iteration_histogram(
+      size_t scheme) const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  friend bool operator==(const PrimitiveRecoveryStatistics& lhs,
+                         const PrimitiveRecoveryStatistics& rhs);
+
+  std::vector<size_t> number_of_attempts_{};
+  std::vector<size_t> number_of_successes_{};
+  std::vector<size_t> number_of_iterations_{};
+  std::vector<std::array<size_t, number_of_iteration_bins>>
+      iteration_histograms_{};
+};
+
+bool operator!=(const PrimitiveRecoveryStatistics& lhs,
+                const PrimitiveRecoveryStatistics& rhs);
+}  // namespace grmhd::ValenciaDivClean
@@ -3,11 +3,15 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/SetVariablesNeededFixingToFalse.hpp"
 
+#include <cstddef>
+
 #include "Utilities/Gsl.hpp"
 
 namespace grmhd::ValenciaDivClean {
 void SetVariablesNeededFixingToFalse::apply(
-    const gsl::not_null<bool*> variables_needed_fixing) {
+    const gsl::not_null<bool*> variables_needed_fixing,
+    const gsl::not_null<size_t*> number_of_points_needed_fixing) {
   *variables_needed_fixing = false;
+  *number_of_points_needed_fixing = 0;
 }
 }  // namespace grmhd::ValenciaDivClean
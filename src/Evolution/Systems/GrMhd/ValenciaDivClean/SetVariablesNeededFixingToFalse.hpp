@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "DataStructures/DataBox/Protocols/Mutator.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
@@ -18,13 +20,16 @@ class not_null;
 namespace grmhd::ValenciaDivClean {
 /*!
  * \brief Mutator used with `Initialization::Actions::AddSimpleTags` to
- * initialize the `VariablesNeededFixing` to `false`
+ * initialize the `VariablesNeededFixing` to `false` and the
+ * `NumberOfPointsNeededFixing` to zero
  */
 struct SetVariablesNeededFixingToFalse
     : tt::ConformsTo<db::protocols::Mutator> {
-  using return_tags = tmpl::list<Tags::VariablesNeededFixing>;
+  using return_tags = tmpl::list<Tags::VariablesNeededFixing,
+                                 Tags::NumberOfPointsNeededFixing>;
   using argument_tags = tmpl::list<>;
 
-  static void apply(gsl::not_null<bool*> variables_needed_fixing);
+  static void apply(gsl::not_null<bool*> variables_needed_fixing,
+                    gsl::not_null<size_t*> number_of_points_needed_fixing);
 };
 }  // namespace grmhd::ValenciaDivClean
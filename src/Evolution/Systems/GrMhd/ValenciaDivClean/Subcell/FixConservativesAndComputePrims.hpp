@@ -35,12 +35,16 @@ namespace grmhd::ValenciaDivClean::subcell {
  *
  * Sets `ValenciaDivClean::Tags::VariablesNeededFixing` to `true` if the
  * conservative variables needed fixing, otherwise sets the tag to `false`.
+ * `ValenciaDivClean::Tags::NumberOfPointsNeededFixing` is set to the number of
+ * grid points at which the conservative variables were fixed.
  */
 template <typename OrderedListOfRecoverySchemes>
 struct FixConservativesAndComputePrims {
-  using return_tags = tmpl::list<ValenciaDivClean::Tags::VariablesNeededFixing,
-                                 typename System::variables_tag,
-                                 typename System::primitive_variables_tag>;
+  using return_tags =
+      tmpl::list<ValenciaDivClean::Tags::VariablesNeededFixing,
+                 ValenciaDivClean::Tags::NumberOfPointsNeededFixing,
+                 typename System::variables_tag,
+                 typename System::primitive_variables_tag>;
   using argument_tags = tmpl::list<
       ::Tags::VariableFixer<grmhd::ValenciaDivClean::FixConservatives>,
       hydro::Tags::EquationOfStateBase, gr::Tags::SpatialMetric<DataVector, 3>,
@@ -51,6 +55,7 @@ struct FixConservativesAndComputePrims {
   template <size_t ThermodynamicDim>
   static void apply(
       gsl::not_null<bool*> needed_fixing,
+      gsl::not_null<size_t*> number_of_points_needed_fixing,
       gsl::not_null<typename System::variables_tag::type*> conserved_vars_ptr,
       gsl::not_null<Variables<hydro::grmhd_tags<DataVector>>*>
           primitive_vars_ptr,
@@ -9,6 +9,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservativeOptions.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryStatistics.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/TagsDeclarations.hpp"
 #include "Evolution/Tags.hpp"
 #include "Options/String.hpp"
@@ -69,6 +70,20 @@ struct TildePhi : db::SimpleTag {
 struct VariablesNeededFixing : db::SimpleTag {
   using type = bool;
 };
+
+/// \brief The number of grid points at which the conservative variables
+/// needed fixing.
+///
+/// Used in DG-subcell hybrid scheme evolutions.
+struct NumberOfPointsNeededFixing : db::SimpleTag {
+  using type = size_t;
+};
+
+/// \brief The `grmhd::ValenciaDivClean::PrimitiveRecoveryStatistics` of an
+/// element, used to choose the primitive recovery scheme that is tried first.
+struct PrimitiveRecoveryStatistics : db::SimpleTag {
+  using type = grmhd::ValenciaDivClean::PrimitiveRecoveryStatistics;
+};
 }  // namespace Tags
 
 namespace OptionTags {
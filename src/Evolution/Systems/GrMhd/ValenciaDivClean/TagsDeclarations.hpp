@@ -16,6 +16,7 @@ namespace Tags {
 struct CharacteristicSpeeds;
 struct ConstraintDampingParameter;
 struct PrimitiveFromConservativeOptions;
+struct PrimitiveRecoveryStatistics;
 struct TildeD;
 struct TildeYe;
 struct TildeTau;
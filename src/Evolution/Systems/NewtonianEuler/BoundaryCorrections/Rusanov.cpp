@@ -70,16 +70,15 @@ double Rusanov<Dim>::dg_package_data(
                         specific_internal_energy, equation_of_state);
     get(sound_speed) = sqrt(get(sound_speed));
     dot_product(make_not_null(&normal_dot_velocity), velocity, normal_covector);
+    // The sound speed is non-negative, so the largest of |v_n + c_s| and
+    // |v_n - c_s| is |v_n| + c_s
     if (normal_dot_mesh_velocity.has_value()) {
       get(*packaged_abs_char_speed) =
-          max(abs(get(normal_dot_velocity) + get(sound_speed) -
-                  get(*normal_dot_mesh_velocity)),
-              abs(get(normal_dot_velocity) - get(sound_speed) -
-                  get(*normal_dot_mesh_velocity)));
+          abs(get(normal_dot_velocity) - get(*normal_dot_mesh_velocity)) +
+          get(sound_speed);
     } else {
       get(*packaged_abs_char_speed) =
-          max(abs(get(normal_dot_velocity) + get(sound_speed)),
-              abs(get(normal_dot_velocity) - get(sound_speed)));
+          abs(get(normal_dot_velocity)) + get(sound_speed);
     }
   }
 
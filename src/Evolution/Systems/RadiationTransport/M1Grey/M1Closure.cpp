@@ -63,6 +63,9 @@ void compute_closure_impl(
   constexpr size_t spatial_dim = 3;
   // Tolerance used in the rootfinding used to find the closure factor
   constexpr double root_find_tolerance = 1.e-6;
+  // Half-width of the bracket around the closure factor of the previous call
+  // that is tried before bracketing the whole interval [0, 1]
+  constexpr double warm_start_half_width = 0.05;
   Variables<
       tmpl::list<hydro::Tags::LorentzFactorSquared<DataVector>, MomentumSquared,
                  MomentumUp, hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
@@ -211,16 +214,42 @@ void compute_closure_impl(
           };
       // To avoid failures in the root find at the boundary of
       // the allowed domain for zeta, test the edge values first.
-      if (fabs(zeta_j_sqr_minus_h_sqr(0.)) < root_find_tolerance) {
+      const double f_at_zero = zeta_j_sqr_minus_h_sqr(0.);
+      const double f_at_one = zeta_j_sqr_minus_h_sqr(1.);
+      if (fabs(f_at_zero) < root_find_tolerance) {
         get(*closure_factor)[s] = 0.;
-      } else if (fabs(zeta_j_sqr_minus_h_sqr(1.)) < root_find_tolerance) {
+      } else if (fabs(f_at_one) < root_find_tolerance) {
         get(*closure_factor)[s] = 1.;
       } else {
-        ERROR(
-            "This function is broken and effectively untested.  It will be "
-            "fixed later.");
+        // The closure factor changes little between steps, so we first try
+        // to bracket the root in a small interval around its previous value.
+        // This saves most of the iterations of the root find. If the previous
+        // value is not a valid closure factor or the root has moved out of
+        // the small interval, we fall back to the whole interval.
+        double lower_bound = 0.;
+        double upper_bound = 1.;
+        double f_at_lower_bound = f_at_zero;
+        double f_at_upper_bound = f_at_one;
+        const double previous_zeta = get(*closure_factor)[s];
+        if (previous_zeta > 0. and previous_zeta < 1.) {
+          const double warm_lower_bound =
+              std::max(previous_zeta - warm_start_half_width, 0.);
+          const double warm_upper_bound =
+              std::min(previous_zeta + warm_start_half_width, 1.);
+          const double f_at_warm_lower_bound =
+              zeta_j_sqr_minus_h_sqr(warm_lower_bound);
+          const double f_at_warm_upper_bound =
+              zeta_j_sqr_minus_h_sqr(warm_upper_bound);
+          if (f_at_warm_lower_bound * f_at_warm_upper_bound <= 0.) {
+            lower_bound = warm_lower_bound;
+            upper_bound = warm_upper_bound;
+            f_at_lower_bound = f_at_warm_lower_bound;
+            f_at_upper_bound = f_at_warm_upper_bound;
+          }
+        }
         get(*closure_factor)[s] = RootFinder::toms748(
-            zeta_j_sqr_minus_h_sqr, 1.e-15, 1., root_find_tolerance, 1.0e-15);
+            zeta_j_sqr_minus_h_sqr, lower_bound, upper_bound, f_at_lower_bound,
+            f_at_upper_bound, root_find_tolerance, 1.0e-15);
       }
       const double& zeta = get(*closure_factor)[s];
 
@@ -233,13 +262,13 @@ void compute_closure_impl(
       get(*comoving_momentum_density_normal)[s] =
           h_0_t + h_thin_t * d_thin + h_thick_t * d_thick;
       for (size_t i = 0; i < spatial_dim; i++) {
-        comoving_momentum_density_spatial->get(i) =
+        comoving_momentum_density_spatial->get(i)[s] =
             -(h_0_v + h_thin_v * d_thin + h_thick_v * d_thick) * v_m.get(i)[s] -
             (h_0_f + h_thin_f * d_thin + h_thick_f * d_thick) *
                 momentum_density.get(i)[s];
         for (size_t j = i; j < spatial_dim; j++) {
           // Optically thin part of pressure tensor
-          pressure_tensor->get(i, j) = d_thin * e_pt *
+          pressure_tensor->get(i, j)[s] = d_thin * e_pt *
                                        momentum_density.get(i)[s] *
                                        momentum_density.get(j)[s] / s_sqr_pt;
         }
@@ -256,7 +285,7 @@ void compute_closure_impl(
           ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
       for (size_t i = 0; i < spatial_dim; i++) {
         for (size_t j = i; j < spatial_dim; j++) {
-          pressure_tensor->get(i, j) +=
+          pressure_tensor->get(i, j)[s] +=
               d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
                                          fluid_velocity.get(j)[s] +
                                      inv_spatial_metric.get(i, j)[s]) +
@@ -100,9 +100,12 @@ struct ComputeM1Closure;
  * \f}
  * for a given \f$\xi\f$ only requires recomputing \f$d_{\rm thin,thick}\f$
  * and their derivatives with respect to \f$\xi\f$.
- * We perform the root-finding using a Newton-Raphson algorithm, with the
- * accuracy set by the variable root_find_number_of_digits (6 significant digits
- * at the moment).
+ * We perform the root-finding using the TOMS748 algorithm, with an absolute
+ * accuracy of \f$10^{-6}\f$. The closure factor passed in is used as a warm
+ * start: the root is first bracketed in a small interval around it, which
+ * saves most of the iterations when the closure factor changes little between
+ * steps. If the root is not in that interval, the whole interval
+ * \f$[0, 1]\f$ is searched.
  *
  * The function returns the closure factors \f$\xi\f$ (to be used as initial
  * guess for this function at the next step), the pressure tensor \f$P_{ij}\f$,
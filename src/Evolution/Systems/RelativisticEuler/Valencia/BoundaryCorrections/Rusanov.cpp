@@ -3,6 +3,9 @@
 
 #include "Evolution/Systems/RelativisticEuler/Valencia/BoundaryCorrections/Rusanov.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <pup.h>
@@ -10,7 +13,6 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "Evolution/Systems/RelativisticEuler/Valencia/Characteristics.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "PointwiseFunctions/Hydro/SoundSpeedSquared.hpp"
@@ -80,31 +82,44 @@ double Rusanov<Dim>::dg_package_data(
                                rest_mass_density, specific_internal_energy,
                                specific_enthalpy, equation_of_state);
 
-    // Create the array into which to compute the char speeds, then point each
-    // of the DataVectors into one of the return args for the evolved fields
-    std::array<DataVector, Dim + 2> char_speeds;
-    char_speeds[0].set_data_ref(make_not_null(&get(*packaged_tilde_d)));
-    char_speeds[Dim + 1].set_data_ref(make_not_null(&get(*packaged_tilde_tau)));
-    for (size_t i = 0; i < Dim; ++i) {
-      gsl::at(char_speeds, i + 1)
-          .set_data_ref(make_not_null(&packaged_tilde_s->get(i)));
-    }
-
-    // Call into characteristic_speed function because speeds are tedious
-    characteristic_speeds(make_not_null(&char_speeds), lapse, shift,
-                          spatial_velocity, spatial_velocity_squared,
-                          sound_speed_squared, normal_covector);
-
-    // There are 3 different values in the Dim+2 char speed, so we do not need
-    // to maximize over all entries in the std::array
-    if (normal_dot_mesh_velocity.has_value()) {
-      get(*packaged_abs_char_speed) =
-          max(abs(char_speeds[0] - get(*normal_dot_mesh_velocity)),
-              abs(char_speeds[1] - get(*normal_dot_mesh_velocity)),
-              abs(char_speeds[Dim + 1] - get(*normal_dot_mesh_velocity)));
-    } else {
-      get(*packaged_abs_char_speed) = max(
-          abs(char_speeds[0]), abs(char_speeds[1]), abs(char_speeds[Dim + 1]));
+    // The largest characteristic speed is computed point by point instead
+    // of through `characteristic_speeds`, which allocates temporaries and
+    // fills all Dim + 2 speeds although only three of them are distinct. See
+    // `RelativisticEuler::Valencia::characteristic_speeds` for the formulas.
+    const size_t number_of_points = get(lapse).size();
+    get(*packaged_abs_char_speed).destructive_resize(number_of_points);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      double normal_shift = normal_covector.get(0)[s] * shift.get(0)[s];
+      double normal_velocity =
+          normal_covector.get(0)[s] * spatial_velocity.get(0)[s];
+      for (size_t i = 1; i < Dim; ++i) {
+        normal_shift += normal_covector.get(i)[s] * shift.get(i)[s];
+        normal_velocity +=
+            normal_covector.get(i)[s] * spatial_velocity.get(i)[s];
+      }
+      const double v_squared = get(spatial_velocity_squared)[s];
+      const double cs_squared = get(sound_speed_squared)[s];
+      const double lapse_s = get(lapse)[s];
+      const double one_minus_v_sqrd_cs_sqrd = 1.0 - v_squared * cs_squared;
+      const double vn_times_one_minus_cs_sqrd =
+          normal_velocity * (1.0 - cs_squared);
+      const double first_term = lapse_s / one_minus_v_sqrd_cs_sqrd;
+      const double second_term =
+          first_term * std::sqrt(cs_squared) *
+          std::sqrt((1.0 - v_squared) *
+               (one_minus_v_sqrd_cs_sqrd -
+                normal_velocity * vn_times_one_minus_cs_sqrd));
+      // Characteristic speed of the grid, including the mesh velocity
+      double grid_speed = -normal_shift;
+      if (normal_dot_mesh_velocity.has_value()) {
+        grid_speed -= get(*normal_dot_mesh_velocity)[s];
+      }
+      const double acoustic_center =
+          grid_speed + first_term * vn_times_one_minus_cs_sqrd;
+      get(*packaged_abs_char_speed)[s] =
+          std::max({std::abs(grid_speed + lapse_s * normal_velocity),
+                    std::abs(acoustic_center - second_term),
+                    std::abs(acoustic_center + second_term)});
     }
   }
 
@@ -9,6 +9,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Tags/GaugeCondition.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
 #include "Evolution/Systems/ScalarTensor/Sources/ScalarSource.hpp"
@@ -41,6 +42,9 @@ namespace ScalarTensor::Initialization {
 /// Namely, we include the compute tags associated to the trace of the extrinsic
 /// curvature and the trace of the spatial Christoffel symbol, as well as the
 /// compute tag required to calculate the source term of the scalar equation.
+/// Note that `ScalarTensor::TimeDerivative` computes the spacetime quantities
+/// of the scalar equations from the GH temporaries, so apart from the scalar
+/// source these compute tags are only retrieved for observations.
 template <size_t Dim, typename Fr = Frame::Inertial>
 using scalar_tensor_3plus1_compute_tags = tmpl::list<
     // Needed to compute the characteristic speeds for the AH finder
@@ -68,6 +72,7 @@ using scalar_tensor_3plus1_compute_tags = tmpl::list<
     gh::ConstraintDamping::Tags::ConstraintGamma0Compute<Dim, Frame::Grid>,
     gh::ConstraintDamping::Tags::ConstraintGamma1Compute<Dim, Frame::Grid>,
     gh::ConstraintDamping::Tags::ConstraintGamma2Compute<Dim, Frame::Grid>,
+    gh::gauges::Tags::DampedHarmonicSpatialWeightCompute<Dim>,
 
     ScalarTensor::Tags::ScalarSourceCompute>;
 
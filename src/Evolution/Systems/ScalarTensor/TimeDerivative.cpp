@@ -18,6 +18,7 @@
 #include "Evolution/Systems/ScalarTensor/StressEnergy.hpp"
 #include "Evolution/Systems/ScalarTensor/System.hpp"
 #include "Evolution/Systems/ScalarTensor/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Tags/Time.hpp"
 #include "Utilities/Gsl.hpp"
@@ -77,6 +78,12 @@ void TimeDerivative::apply(
 
     // Extra temporal tags
     const gsl::not_null<tnsr::aa<DataVector, dim>*> stress_energy,
+    const gsl::not_null<tnsr::i<DataVector, dim>*> deriv_lapse,
+    const gsl::not_null<tnsr::iJ<DataVector, dim>*> deriv_shift,
+    const gsl::not_null<tnsr::i<DataVector, dim>*>
+        trace_spatial_christoffel_first_kind,
+    const gsl::not_null<tnsr::I<DataVector, dim>*> trace_spatial_christoffel,
+    const gsl::not_null<Scalar<DataVector>*> trace_extrinsic_curvature,
 
     // GH spatial derivatives
     const tnsr::iaa<DataVector, dim>& d_spacetime_metric,
@@ -100,17 +107,11 @@ void TimeDerivative::apply(
                           Frame::Inertial>& inverse_jacobian,
     const std::optional<tnsr::I<DataVector, dim, Frame::Inertial>>&
         mesh_velocity,
+    const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight,
 
     // Scalar argument variables
     const Scalar<DataVector>& pi_scalar,
     const tnsr::i<DataVector, dim>& phi_scalar,
-    const Scalar<DataVector>& lapse_scalar,
-    const tnsr::I<DataVector, dim>& shift_scalar,
-    const tnsr::i<DataVector, dim>& deriv_lapse,
-    const tnsr::iJ<DataVector, dim>& deriv_shift,
-    const tnsr::II<DataVector, dim>& upper_spatial_metric,
-    const tnsr::I<DataVector, dim>& trace_spatial_christoffel,
-    const Scalar<DataVector>& trace_extrinsic_curvature,
     const Scalar<DataVector>& gamma1_scalar,
     const Scalar<DataVector>& gamma2_scalar,
 
@@ -135,7 +136,48 @@ void TimeDerivative::apply(
       // GH argument variables
       d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
       gamma1, gamma2, gauge_condition, mesh, time, inertial_coords,
-      inverse_jacobian, mesh_velocity);
+      inverse_jacobian, mesh_velocity, damped_harmonic_spatial_weight);
+
+  // Spacetime quantities of the scalar equation from the GH temporaries, see
+  // gh::spatial_deriv_of_lapse, gh::spatial_deriv_of_shift and
+  // gh::extrinsic_curvature
+  for (size_t i = 0; i < dim; ++i) {
+    deriv_lapse->get(i) = -get(*lapse) * half_phi_two_normals->get(i);
+    for (size_t j = 0; j < dim; ++j) {
+      deriv_shift->get(i, j) = 2.0 * normal_spacetime_vector->get(j + 1) *
+                               half_phi_two_normals->get(i);
+      for (size_t a = 0; a < dim + 1; ++a) {
+        deriv_shift->get(i, j) +=
+            inverse_spacetime_metric->get(j + 1, a) * phi_one_normal->get(i, a);
+      }
+      deriv_shift->get(i, j) *= get(*lapse);
+    }
+  }
+  get(*trace_extrinsic_curvature) = 0.0;
+  for (size_t i = 0; i < dim; ++i) {
+    for (size_t j = 0; j < dim; ++j) {
+      get(*trace_extrinsic_curvature) +=
+          inverse_spatial_metric->get(i, j) *
+          (0.5 * pi.get(i + 1, j + 1) + phi_one_normal->get(i, j + 1));
+    }
+  }
+  // Gamma_k = gamma^{ij} (Phi_{ikj} - Phi_{kij} / 2)
+  for (size_t k = 0; k < dim; ++k) {
+    trace_spatial_christoffel_first_kind->get(k) = phi_1_up->get(0, k + 1, 1);
+    for (size_t j = 1; j < dim; ++j) {
+      trace_spatial_christoffel_first_kind->get(k) +=
+          phi_1_up->get(j, k + 1, j + 1);
+    }
+    for (size_t i = 0; i < dim; ++i) {
+      for (size_t j = 0; j < dim; ++j) {
+        trace_spatial_christoffel_first_kind->get(k) -=
+            0.5 * inverse_spatial_metric->get(i, j) * phi.get(k, i + 1, j + 1);
+      }
+    }
+  }
+  raise_or_lower_index(trace_spatial_christoffel,
+                       *trace_spatial_christoffel_first_kind,
+                       *inverse_spatial_metric);
 
   // Compute sourceless part of the RHS of the scalar equation
   CurvedScalarWave::TimeDerivative<dim>::apply(
@@ -150,17 +192,15 @@ void TimeDerivative::apply(
       // Scalar argument variables
       d_psi_scalar, d_pi_scalar, d_phi_scalar, pi_scalar, phi_scalar,
 
-      lapse_scalar, shift_scalar,
-
-      deriv_lapse, deriv_shift, upper_spatial_metric, trace_spatial_christoffel,
-      trace_extrinsic_curvature, gamma1_scalar, gamma2_scalar);
+      *lapse, *shift, *deriv_lapse, *deriv_shift, *inverse_spatial_metric,
+      *trace_spatial_christoffel, *trace_extrinsic_curvature, gamma1_scalar,
+      gamma2_scalar);
 
   // Compute the (trace-reversed) stress energy tensor here
-  trace_reversed_stress_energy(stress_energy, pi_scalar, phi_scalar,
-                               lapse_scalar);
+  trace_reversed_stress_energy(stress_energy, pi_scalar, phi_scalar, *lapse);
 
-  add_stress_energy_term_to_dt_pi(dt_pi, *stress_energy, lapse_scalar);
+  add_stress_energy_term_to_dt_pi(dt_pi, *stress_energy, *lapse);
 
-  add_scalar_source_to_dt_pi_scalar(dt_pi_scalar, scalar_source, lapse_scalar);
+  add_scalar_source_to_dt_pi_scalar(dt_pi_scalar, scalar_source, *lapse);
 }
 }  // namespace ScalarTensor
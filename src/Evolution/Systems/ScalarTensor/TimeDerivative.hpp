@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
@@ -17,6 +18,8 @@
 #include "Evolution/Systems/ScalarTensor/Sources/ScalarSource.hpp"
 #include "Evolution/Systems/ScalarTensor/StressEnergy.hpp"
 #include "Evolution/Systems/ScalarTensor/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Tags/Time.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -36,6 +39,15 @@ namespace ScalarTensor {
  * to the \f$\partial_t \Pi_{a b}\f$ variable in the Generalized Harmonic
  * system, as well as adding any scalar sources to the variable \f$\partial_t
  * \Pi\f$.
+ *
+ * The 3+1 decomposition of the spacetime metric is done only once per step, by
+ * the GH time derivative. The scalar time derivative and the stress-energy
+ * tensor use the lapse, the shift and the inverse spatial metric from the GH
+ * temporaries. The other spacetime quantities of the scalar equations (the
+ * spatial derivatives of the lapse and shift and the traces of the spatial
+ * Christoffel symbols and of the extrinsic curvature) are computed here from
+ * the GH temporaries \f$n^a\Phi_{iab}\f$ and \f$\gamma^{ij}\Phi_{jab}\f$, so no
+ * spacetime quantities are retrieved from the DataBox.
  */
 struct TimeDerivative {
   static constexpr size_t dim = 3;
@@ -53,12 +65,21 @@ struct TimeDerivative {
       typename CurvedScalarWave::TimeDerivative<dim>::temporary_tags;
   using scalar_extra_temp_tags =
       tmpl::list<ScalarTensor::Tags::TraceReversedStressEnergy<
-          DataVector, dim, ::Frame::Inertial>>;
+                     DataVector, dim, ::Frame::Inertial>,
+                 ::Tags::deriv<gr::Tags::Lapse<DataVector>, tmpl::size_t<dim>,
+                               Frame::Inertial>,
+                 ::Tags::deriv<gr::Tags::Shift<DataVector, dim>,
+                               tmpl::size_t<dim>, Frame::Inertial>,
+                 gr::Tags::TraceSpatialChristoffelFirstKind<DataVector, dim>,
+                 gr::Tags::TraceSpatialChristoffelSecondKind<DataVector, dim>,
+                 gr::Tags::TraceExtrinsicCurvature<DataVector>>;
   using scalar_gradient_tags =
       typename CurvedScalarWave::System<dim>::gradients_tags;
   using gradient_tags = tmpl::append<gh_gradient_tags, scalar_gradient_tags>;
-  using scalar_arg_tags =
-      typename CurvedScalarWave::TimeDerivative<dim>::argument_tags;
+  // The spacetime quantities are taken from the temporaries instead
+  using scalar_arg_tags = tmpl::list_difference<
+      typename CurvedScalarWave::TimeDerivative<dim>::argument_tags,
+      tmpl::append<gh_temp_tags, scalar_extra_temp_tags>>;
   using temporary_tags = tmpl::remove_duplicates<
       tmpl::append<gh_temp_tags, scalar_temp_tags, scalar_extra_temp_tags>>;
   using argument_tags =
@@ -115,6 +136,12 @@ struct TimeDerivative {
 
       // Extra temporal tags
       gsl::not_null<tnsr::aa<DataVector, dim>*> stress_energy,
+      gsl::not_null<tnsr::i<DataVector, dim>*> deriv_lapse,
+      gsl::not_null<tnsr::iJ<DataVector, dim>*> deriv_shift,
+      gsl::not_null<tnsr::i<DataVector, dim>*>
+          trace_spatial_christoffel_first_kind,
+      gsl::not_null<tnsr::I<DataVector, dim>*> trace_spatial_christoffel,
+      gsl::not_null<Scalar<DataVector>*> trace_extrinsic_curvature,
 
       // GH spatial derivatives
       const tnsr::iaa<DataVector, dim>& d_spacetime_metric,
@@ -138,17 +165,11 @@ struct TimeDerivative {
                             Frame::Inertial>& inverse_jacobian,
       const std::optional<tnsr::I<DataVector, dim, Frame::Inertial>>&
           mesh_velocity,
+      const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight,
 
       // Scalar argument variables
       const Scalar<DataVector>& pi_scalar,
       const tnsr::i<DataVector, dim>& phi_scalar,
-      const Scalar<DataVector>& lapse_scalar,
-      const tnsr::I<DataVector, dim>& shift_scalar,
-      const tnsr::i<DataVector, dim>& deriv_lapse,
-      const tnsr::iJ<DataVector, dim>& deriv_shift,
-      const tnsr::II<DataVector, dim>& upper_spatial_metric,
-      const tnsr::I<DataVector, dim>& trace_spatial_christoffel,
-      const Scalar<DataVector>& trace_extrinsic_curvature,
       const Scalar<DataVector>& gamma1_scalar,
       const Scalar<DataVector>& gamma2_scalar,
 
@@ -56,6 +56,7 @@ template void volume_terms<::ScalarTensor::TimeDerivative>(
                           Frame::Inertial>& inverse_jacobian,
     const std::optional<tnsr::I<DataVector, 3, Frame::Inertial>>&
         mesh_velocity_gh,
+    const std::optional<Scalar<DataVector>>& damped_harmonic_spatial_weight,
     // Scalar argument variables
     const Scalar<DataVector>& pi_scalar,
     const tnsr::i<DataVector, 3>& phi_scalar,
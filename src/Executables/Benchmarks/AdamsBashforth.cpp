@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "Time/BoundaryHistory.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforth.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Rational.hpp"
+
+namespace {
+// Number of independent components in the data, roughly the size of the
+// generalized harmonic evolved variables.
+constexpr size_t number_of_components = 50;
+
+// The integration orders and points per dimension of the isotropic mesh.
+void adams_bashforth_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"order", "points_per_dim"});
+  benchmark->ArgsProduct({{2, 4, 6, 8}, {4, 8, 12}});
+}
+
+TimeStepId make_id(const Slab& slab, const int64_t sixteenths) {
+  return {true, 0, Time(slab, Rational(sixteenths, 16))};
+}
+
+// The volume update after the history has been filled with one step of
+// each order, so no history entries are removed by the update.
+void bench_update_u(benchmark::State& state) {
+  const auto order = static_cast<size_t>(state.range(0));
+  const auto points_per_dim = static_cast<size_t>(state.range(1));
+  const size_t size =
+      number_of_components * points_per_dim * points_per_dim * points_per_dim;
+  const TimeSteppers::AdamsBashforth stepper(order);
+  const Slab slab(0.0, 16.0);
+
+  TimeSteppers::History<DataVector> history(order);
+  for (size_t i = 0; i < order; ++i) {
+    history.insert(make_id(slab, static_cast<int64_t>(i)),
+                   DataVector(size, 1.0), DataVector(size, 0.5));
+  }
+  DataVector u(size);
+  const TimeDelta time_step(slab, Rational(1, 16));
+  for (auto _ : state) {
+    stepper.update_u(make_not_null(&u), make_not_null(&history), time_step);
+    benchmark::DoNotOptimize(u.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(size));
+}
+BENCHMARK(bench_update_u)->Apply(adams_bashforth_arguments);
+
+// The boundary contribution of a neighbor taking two steps for each local
+// step.  The coupling values are cached by the history after the first
+// evaluation, so this measures the accumulation of the cached values.
+void bench_lts_boundary_delta(benchmark::State& state) {
+  const auto order = static_cast<size_t>(state.range(0));
+  const auto points_per_dim = static_cast<size_t>(state.range(1));
+  const size_t size = number_of_components * points_per_dim * points_per_dim;
+  const TimeSteppers::AdamsBashforth stepper(order);
+  const Slab slab(0.0, 16.0);
+
+  TimeSteppers::BoundaryHistory<DataVector, DataVector, DataVector> history(
+      order);
+  for (size_t i = 0; i < order; ++i) {
+    history.local_insert(make_id(slab, 2 * static_cast<int64_t>(i)),
+                         DataVector(size, 1.0));
+  }
+  for (size_t i = 0; i < 2 * order; ++i) {
+    history.remote_insert(make_id(slab, static_cast<int64_t>(i)),
+                          DataVector(size, 2.0));
+  }
+  const auto coupling = [](const DataVector& local, const DataVector& remote) {
+    return DataVector(local + remote);
+  };
+  const TimeDelta time_step(slab, Rational(2, 16));
+  DataVector result(size, 0.0);
+  // Remove the remote entries that are not needed and fill the coupling
+  // cache, so every iteration does the same work.
+  stepper.add_boundary_delta(make_not_null(&result), make_not_null(&history),
+                             time_step, coupling);
+  for (auto _ : state) {
+    stepper.add_boundary_delta(make_not_null(&result),
+                               make_not_null(&history), time_step, coupling);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(size));
+}
+BENCHMARK(bench_lts_boundary_delta)->Apply(adams_bashforth_arguments);
+}  // namespace
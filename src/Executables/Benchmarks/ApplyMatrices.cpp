@@ -0,0 +1,63 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Number of independent components in the data, roughly the size of the
+// evolved variables of a first-order hyperbolic system.
+constexpr size_t number_of_components = 10;
+
+// Interpolate to a mesh with one more point in every dimension, as is done for
+// p-refinement and projections between DG meshes.
+void bench_apply_matrices_all_dimensions(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const Mesh<1> target_mesh{mesh.extents(0) + 1, mesh.basis(0),
+                            mesh.quadrature(0)};
+  const Matrix interpolation_matrix = Spectral::interpolation_matrix(
+      mesh.slice_through(0), Spectral::collocation_points(target_mesh));
+  const std::array<Matrix, 3> matrices{
+      {interpolation_matrix, interpolation_matrix, interpolation_matrix}};
+  const DataVector u(number_of_components * mesh.number_of_grid_points(), 1.0);
+  DataVector result(number_of_components * target_mesh.extents(0) *
+                    target_mesh.extents(0) * target_mesh.extents(0));
+  for (auto _ : state) {
+    apply_matrices(make_not_null(&result), matrices, u, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_apply_matrices_all_dimensions)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+
+// Apply a matrix in only one dimension, as is done for filtering or
+// differentiation in a single direction. The empty matrices are treated as the
+// identity.
+void bench_apply_matrices_one_dimension(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const std::array<Matrix, 3> matrices{
+      {Matrix{}, Spectral::differentiation_matrix(mesh.slice_through(1)),
+       Matrix{}}};
+  const DataVector u(number_of_components * mesh.number_of_grid_points(), 1.0);
+  DataVector result(u.size());
+  for (auto _ : state) {
+    apply_matrices(make_not_null(&result), matrices, u, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_apply_matrices_one_dimension)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+}  // namespace
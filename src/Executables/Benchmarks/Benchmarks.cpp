@@ -0,0 +1,38 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+
+#include "Informer/InfoFromBuild.hpp"
+
+// Charm looks for this function but since we build without a main function or
+// main module we just have it be empty
+extern "C" void CkRegisterMainModule(void) {}
+
+/*!
+ * \brief Runs the microbenchmarks of the DG and FD hot paths.
+ *
+ * The benchmarks are registered in the other source files of this executable.
+ * All command line options of Google Benchmark are supported. For example,
+ * run
+ *
+ * \code
+ * ./bin/Benchmarks --benchmark_out=Benchmarks.json \
+ *   --benchmark_out_format=json
+ * \endcode
+ *
+ * to write the results as JSON so they can be compared across versions, e.g.
+ * with the `compare.py` tool that ships with Google Benchmark. The SpECTRE
+ * version and git description are added to the context of the output.
+ */
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::AddCustomContext("spectre_version", spectre_version());
+  benchmark::AddCustomContext("git_description", git_description());
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
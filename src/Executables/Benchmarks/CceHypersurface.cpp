@@ -0,0 +1,249 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Executables/Cce/CharacteristicExtractBase.hpp"
+#include "Evolution/Systems/Cce/Actions/CalculateScriInputs.hpp"
+#include "Evolution/Systems/Cce/Actions/InitializeCharacteristicEvolutionVariables.hpp"
+#include "Evolution/Systems/Cce/AnalyticBoundaryDataManager.hpp"
+#include "Evolution/Systems/Cce/AnalyticSolutions/BouncingBlackHole.hpp"
+#include "Evolution/Systems/Cce/Equations.hpp"
+#include "Evolution/Systems/Cce/GaugeTransformBoundaryData.hpp"
+#include "Evolution/Systems/Cce/Initialize/InitializeJ.hpp"
+#include "Evolution/Systems/Cce/Initialize/InverseCubic.hpp"
+#include "Evolution/Systems/Cce/IntegrandInputSteps.hpp"
+#include "Evolution/Systems/Cce/LinearSolve.hpp"
+#include "Evolution/Systems/Cce/PreSwshDerivatives.hpp"
+#include "Evolution/Systems/Cce/PrecomputeCceDependencies.hpp"
+#include "Evolution/Systems/Cce/ScriPlusValues.hpp"
+#include "Evolution/Systems/Cce/SwshDerivatives.hpp"
+#include "Evolution/Systems/Cce/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/SwshDerivatives.hpp"
+#include "NumericalAlgorithms/Spectral/SwshFiltering.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// The tag lists of the CharacteristicExtract executable without
+// Cauchy-characteristic matching.
+struct CceMetavariables : CharacteristicExtractDefaults<false> {};
+
+using initialize_variables =
+    Cce::Actions::InitializeCharacteristicEvolutionVariables<CceMetavariables>;
+using boundary_data_tags =
+    Cce::Tags::characteristic_worldtube_boundary_tags<Cce::Tags::BoundaryValue>;
+
+// The seconds since `start`, which is then reset to now.
+double lap(const gsl::not_null<std::chrono::steady_clock::time_point*> start) {
+  const auto now = std::chrono::steady_clock::now();
+  const double seconds = std::chrono::duration<double>(now - *start).count();
+  *start = now;
+  return seconds;
+}
+
+// Copies the worldtube data for `time` into the DataBox like
+// `Cce::Actions::ReceiveWorldtubeData`, then updates the gauge and the
+// quantities that do not depend on the hypersurface integration like
+// `Cce::Actions::UpdateGauge` and
+// `Cce::Actions::PrecomputeGlobalCceDependencies`.
+template <typename DbTags>
+void boundary_stage(
+    const gsl::not_null<db::DataBox<DbTags>*> box,
+    const gsl::not_null<Variables<boundary_data_tags>*> boundary_data,
+    const Cce::AnalyticBoundaryDataManager& boundary_data_manager,
+    const double time) {
+  boundary_data_manager.populate_hypersurface_boundary_data(boundary_data,
+                                                            time);
+  tmpl::for_each<boundary_data_tags>([&box, &boundary_data](auto tag_v) {
+    using tag = typename decltype(tag_v)::type;
+    db::mutate<tag>(
+        [&boundary_data](const gsl::not_null<typename tag::type*> destination) {
+          *destination = get<tag>(*boundary_data);
+        },
+        box);
+  });
+  db::mutate_apply<Cce::GaugeUpdateAngularFromCartesian<
+      Cce::Tags::CauchyAngularCoords, Cce::Tags::CauchyCartesianCoords>>(box);
+  db::mutate_apply<Cce::GaugeUpdateJacobianFromCoordinates<
+      Cce::Tags::PartiallyFlatGaugeC, Cce::Tags::PartiallyFlatGaugeD,
+      Cce::Tags::CauchyAngularCoords, Cce::Tags::CauchyCartesianCoords>>(box);
+  db::mutate_apply<
+      Cce::GaugeUpdateInterpolator<Cce::Tags::CauchyAngularCoords>>(box);
+  db::mutate_apply<Cce::GaugeUpdateOmega<Cce::Tags::PartiallyFlatGaugeC,
+                                         Cce::Tags::PartiallyFlatGaugeD,
+                                         Cce::Tags::PartiallyFlatGaugeOmega>>(
+      box);
+  tmpl::for_each<Cce::gauge_adjustments_setup_tags>([&box](auto tag_v) {
+    using tag = typename decltype(tag_v)::type;
+    db::mutate_apply<Cce::GaugeAdjustedBoundaryValue<tag>>(box);
+  });
+  Cce::mutate_all_precompute_cce_dependencies<
+      Cce::Tags::EvolutionGaugeBoundaryValue>(box);
+}
+
+// The radial integration of each of the Bondi quantities in the hierarchy,
+// following the `hypersurface_computation` of
+// `Cce::CharacteristicEvolution`, and the filtering of `Cce::Tags::BondiH`
+// done by `Cce::Actions::FilterSwshVolumeQuantity`.
+template <typename DbTags>
+void hypersurface_stage(const gsl::not_null<db::DataBox<DbTags>*> box) {
+  tmpl::for_each<Cce::bondi_hypersurface_step_tags>([&box](auto tag_v) {
+    using bondi_tag = typename decltype(tag_v)::type;
+    db::mutate_apply<Cce::GaugeAdjustedBoundaryValue<bondi_tag>>(box);
+    Cce::mutate_all_pre_swsh_derivatives_for_tag<bondi_tag>(box);
+    Cce::mutate_all_swsh_derivatives_for_tag<bondi_tag>(box);
+    tmpl::for_each<
+        Cce::integrand_terms_to_compute_for_bondi_variable<bondi_tag>>(
+        [&box](auto integrand_tag_v) {
+          using integrand_tag = typename decltype(integrand_tag_v)::type;
+          db::mutate_apply<Cce::ComputeBondiIntegrand<integrand_tag>>(box);
+        });
+    db::mutate_apply<Cce::RadialIntegrateBondi<
+        Cce::Tags::EvolutionGaugeBoundaryValue, bondi_tag>>(box);
+    if constexpr (std::is_same_v<bondi_tag, Cce::Tags::BondiU>) {
+      db::mutate_apply<Cce::GaugeUpdateTimeDerivatives>(box);
+      db::mutate_apply<
+          Cce::GaugeAdjustedBoundaryValue<Cce::Tags::DuRDividedByR>>(box);
+      db::mutate_apply<Cce::PrecomputeCceDependencies<
+          Cce::Tags::EvolutionGaugeBoundaryValue, Cce::Tags::DuRDividedByR>>(
+          box);
+    }
+  });
+  const size_t l_max = db::get<Cce::Tags::LMax>(*box);
+  db::mutate<Cce::Tags::BondiH>(
+      [&l_max](const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 2>>*>
+                   bondi_h) {
+        Spectral::Swsh::filter_swsh_volume_quantity(
+            make_not_null(&get(*bondi_h)), l_max, l_max - 2, 35.0, 24);
+      },
+      box);
+}
+
+// The scri+ values, following the `compute_scri_quantities_and_observe`
+// actions of `Cce::CharacteristicEvolution` without the interpolation to
+// inertial time and the output.
+template <typename DbTags>
+void scri_stage(const gsl::not_null<db::DataBox<DbTags>*> box) {
+  db::mutate_apply<Cce::CalculateScriPlusValue<
+      ::Tags::dt<Cce::Tags::InertialRetardedTime>>>(box);
+  tmpl::for_each<
+      tmpl::append<Cce::all_pre_swsh_derivative_tags_for_scri,
+                   Cce::all_boundary_pre_swsh_derivative_tags_for_scri>>(
+      [&box](auto pre_swsh_derivative_tag_v) {
+        using pre_swsh_derivative_tag =
+            typename decltype(pre_swsh_derivative_tag_v)::type;
+        db::mutate_apply<Cce::PreSwshDerivatives<pre_swsh_derivative_tag>>(
+            box);
+      });
+  db::mutate_apply<Spectral::Swsh::AngularDerivatives<
+      Cce::all_swsh_derivative_tags_for_scri>>(box);
+  Cce::Actions::CalculateScriInputs::boundary_derivative_impl(
+      *box, db::get<Cce::Tags::LMax>(*box),
+      Cce::all_boundary_swsh_derivative_tags_for_scri{});
+  tmpl::for_each<Cce::all_swsh_derivative_tags_for_scri>(
+      [&box](auto derivative_tag_v) {
+        using derivative_tag = typename decltype(derivative_tag_v)::type;
+        Cce::detail::apply_swsh_jacobian_helper<derivative_tag>(
+            box, typename Cce::ApplySwshJacobianInplace<
+                     derivative_tag>::on_demand_argument_tags{});
+      });
+  tmpl::for_each<typename CceMetavariables::cce_scri_tags>(
+      [&box](auto tag_v) {
+        using tag = typename decltype(tag_v)::type;
+        db::mutate_apply<Cce::CalculateScriPlusValue<tag>>(box);
+      });
+}
+
+// One CCE step per iteration on the worldtube data of a bouncing black hole,
+// at the angular resolution `l_max` (first argument) and with the number of
+// radial points given by the second argument. The time is advanced between
+// the steps, but the evolved quantities are not, so each step integrates a
+// hypersurface from the same initial data. The wall time of the three stages
+// of a step, in seconds per step, is reported in the counters.
+void bench_cce_step(benchmark::State& state) {
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const auto number_of_radial_points = static_cast<size_t>(state.range(1));
+  const double extraction_radius = 40.0;
+  const Cce::AnalyticBoundaryDataManager boundary_data_manager{
+      l_max, extraction_radius,
+      std::make_unique<Cce::Solutions::BouncingBlackHole>(
+          0.1, extraction_radius, 1.0, 40.0)};
+
+  auto box = db::create<
+      tmpl::push_back<typename initialize_variables::simple_tags_for_evolution,
+                      Cce::Tags::LMax, Cce::Tags::NumberOfRadialPoints>>();
+  db::mutate<Cce::Tags::LMax, Cce::Tags::NumberOfRadialPoints>(
+      [&l_max, &number_of_radial_points](
+          const gsl::not_null<size_t*> box_l_max,
+          const gsl::not_null<size_t*> box_number_of_radial_points) {
+        *box_l_max = l_max;
+        *box_number_of_radial_points = number_of_radial_points;
+      },
+      make_not_null(&box));
+  initialize_variables::initialize_impl(make_not_null(&box));
+
+  // The first hypersurface, like `Cce::Actions::InitializeFirstHypersurface`
+  Variables<boundary_data_tags> boundary_data{
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max)};
+  boundary_data_manager.populate_hypersurface_boundary_data(
+      make_not_null(&boundary_data), 0.0);
+  tmpl::for_each<boundary_data_tags>([&box, &boundary_data](auto tag_v) {
+    using tag = typename decltype(tag_v)::type;
+    db::mutate<tag>(
+        [&boundary_data](const gsl::not_null<typename tag::type*> destination) {
+          *destination = get<tag>(boundary_data);
+        },
+        make_not_null(&box));
+  });
+  Parallel::NodeLock hdf5_lock{};
+  db::mutate_apply<Cce::InitializeJ::InitializeJ<false>::mutate_tags,
+                   Cce::InitializeJ::InitializeJ<false>::argument_tags>(
+      Cce::InitializeJ::InverseCubic<false>{}, make_not_null(&box),
+      make_not_null(&hdf5_lock));
+  db::mutate_apply<Cce::InitializeGauge>(make_not_null(&box));
+  db::mutate_apply<
+      Cce::InitializeScriPlusValue<Cce::Tags::InertialRetardedTime>>(
+      make_not_null(&box), 0.0);
+
+  double boundary_time = 0.0;
+  double hypersurface_time = 0.0;
+  double scri_time = 0.0;
+  double time = 0.0;
+  for (auto _ : state) {
+    time += 0.1;
+    auto start = std::chrono::steady_clock::now();
+    boundary_stage(make_not_null(&box), make_not_null(&boundary_data),
+                   boundary_data_manager, time);
+    boundary_time += lap(make_not_null(&start));
+    hypersurface_stage(make_not_null(&box));
+    hypersurface_time += lap(make_not_null(&start));
+    scri_stage(make_not_null(&box));
+    scri_time += lap(make_not_null(&start));
+    benchmark::DoNotOptimize(
+        get(db::get<Cce::Tags::News>(box)).data().data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["boundary"] =
+      benchmark::Counter(boundary_time, benchmark::Counter::kAvgIterations);
+  state.counters["hypersurface"] = benchmark::Counter(
+      hypersurface_time, benchmark::Counter::kAvgIterations);
+  state.counters["scri"] =
+      benchmark::Counter(scri_time, benchmark::Counter::kAvgIterations);
+  // The reported items per second are the CCE steps per second
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(bench_cce_step)
+    ->ArgNames({"l_max", "radial_points"})
+    ->ArgsProduct({{12, 16, 20, 28}, {8, 12, 16}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Benchmarks {
+/*!
+ * \brief Registers the mesh sizes we run DG evolutions with: 4 to 12 points
+ * per dimension, each with Gauss and Gauss-Lobatto quadrature.
+ *
+ * The first benchmark argument is the number of points per dimension and the
+ * second is `1` for Gauss-Lobatto and `0` for Gauss quadrature. Use
+ * `Benchmarks::dg_mesh` to construct the corresponding mesh.
+ */
+inline void dg_mesh_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"points_per_dim", "gauss_lobatto"});
+  benchmark->ArgsProduct({{4, 5, 6, 8, 10, 12}, {0, 1}});
+}
+
+/// The isotropic Legendre mesh selected by the `dg_mesh_arguments`
+template <size_t Dim>
+Mesh<Dim> dg_mesh(const benchmark::State& state) {
+  return {static_cast<size_t>(state.range(0)), Spectral::Basis::Legendre,
+          state.range(1) == 0 ? Spectral::Quadrature::Gauss
+                              : Spectral::Quadrature::GaussLobatto};
+}
+
+/*!
+ * \brief Registers the DG mesh sizes 4 to 12 points per dimension for
+ * benchmarks on the corresponding finite-difference subcell mesh.
+ *
+ * Use `Benchmarks::subcell_mesh` to construct the subcell mesh, which has
+ * \f$2N-1\f$ cell-centered points per dimension for a DG mesh with \f$N\f$
+ * points per dimension.
+ */
+inline void subcell_mesh_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"dg_points_per_dim"});
+  for (const int64_t points_per_dim : {4, 5, 6, 8, 10, 12}) {
+    benchmark->Arg(points_per_dim);
+  }
+}
+
+/// The subcell mesh selected by the `subcell_mesh_arguments`
+template <size_t Dim>
+Mesh<Dim> subcell_mesh(const benchmark::State& state) {
+  return {2 * static_cast<size_t>(state.range(0)) - 1,
+          Spectral::Basis::FiniteDifference,
+          Spectral::Quadrature::CellCentered};
+}
+
+/// Reports the number of grid points processed per second
+template <size_t Dim>
+void set_grid_points_processed(const gsl::not_null<benchmark::State*> state,
+                               const Mesh<Dim>& mesh) {
+  state->SetItemsProcessed(static_cast<int64_t>(state->iterations()) *
+                           static_cast<int64_t>(mesh.number_of_grid_points()));
+}
+}  // namespace Benchmarks
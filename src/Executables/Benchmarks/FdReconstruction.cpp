@@ -0,0 +1,133 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace {
+// Roughly the number of primitive variables reconstructed for GRMHD.
+constexpr size_t number_of_variables = 10;
+
+// Holds the volume, ghost, and face data for reconstructing
+// `number_of_variables` variables on the subcell mesh in 3d.
+struct ReconstructionData {
+  ReconstructionData(const Mesh<3>& mesh, const size_t ghost_zone_size) {
+    const size_t number_of_points = mesh.number_of_grid_points();
+    const auto logical_coords = logical_coordinates(mesh);
+    volume_vars = DataVector{number_of_points * number_of_variables};
+    for (size_t var = 0; var < number_of_variables; ++var) {
+      DataVector component(volume_vars.data() + var * number_of_points,
+                           number_of_points);
+      component = 1.0 + static_cast<double>(var) +
+                  sin(get<0>(logical_coords) + 2.0 * get<1>(logical_coords) -
+                      get<2>(logical_coords));
+    }
+    // The values of the ghost data do not matter for the cost of the
+    // reconstruction, as long as they are not constant.
+    for (const auto& direction : Direction<3>::all_directions()) {
+      ghost_data[direction] = DataVector{
+          mesh.extents().slice_away(direction.dimension()).product() *
+              ghost_zone_size * number_of_variables,
+          1.5};
+      ghost_data[direction][0] = 2.0;
+      ghost_cell_vars[direction] = gsl::make_span(
+          ghost_data[direction].data(), ghost_data[direction].size());
+    }
+    const size_t number_of_face_points =
+        (mesh.extents(0) + 1) * mesh.slice_away(0).number_of_grid_points();
+    upper_face_data =
+        make_array<3>(DataVector{number_of_face_points * number_of_variables});
+    lower_face_data =
+        make_array<3>(DataVector{number_of_face_points * number_of_variables});
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(upper_face_vars, d) = gsl::make_span(
+          gsl::at(upper_face_data, d).data(), gsl::at(upper_face_data, d).size());
+      gsl::at(lower_face_vars, d) = gsl::make_span(
+          gsl::at(lower_face_data, d).data(), gsl::at(lower_face_data, d).size());
+    }
+  }
+
+  // The spans point into the data owned by this object
+  ReconstructionData(const ReconstructionData&) = delete;
+  ReconstructionData& operator=(const ReconstructionData&) = delete;
+  ReconstructionData(ReconstructionData&&) = delete;
+  ReconstructionData& operator=(ReconstructionData&&) = delete;
+  ~ReconstructionData() = default;
+
+  gsl::span<const double> volume_span() const {
+    return gsl::make_span(volume_vars.data(), volume_vars.size());
+  }
+
+  DataVector volume_vars{};
+  DirectionMap<3, DataVector> ghost_data{};
+  DirectionMap<3, gsl::span<const double>> ghost_cell_vars{};
+  std::array<DataVector, 3> upper_face_data{};
+  std::array<DataVector, 3> lower_face_data{};
+  std::array<gsl::span<double>, 3> upper_face_vars{};
+  std::array<gsl::span<double>, 3> lower_face_vars{};
+};
+
+void bench_monotonised_central(benchmark::State& state) {
+  const auto mesh = Benchmarks::subcell_mesh<3>(state);
+  ReconstructionData data{mesh, 2};
+  for (auto _ : state) {
+    fd::reconstruction::monotonised_central(
+        make_not_null(&data.upper_face_vars),
+        make_not_null(&data.lower_face_vars), data.volume_span(),
+        data.ghost_cell_vars, mesh.extents(), number_of_variables);
+    benchmark::DoNotOptimize(data.upper_face_data[0].data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_monotonised_central)
+    ->Apply(Benchmarks::subcell_mesh_arguments);
+
+void bench_monotonicity_preserving_5(benchmark::State& state) {
+  const auto mesh = Benchmarks::subcell_mesh<3>(state);
+  ReconstructionData data{mesh, 3};
+  for (auto _ : state) {
+    fd::reconstruction::monotonicity_preserving_5(
+        make_not_null(&data.upper_face_vars),
+        make_not_null(&data.lower_face_vars), data.volume_span(),
+        data.ghost_cell_vars, mesh.extents(), number_of_variables, 4.0,
+        1.0e-10);
+    benchmark::DoNotOptimize(data.upper_face_data[0].data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_monotonicity_preserving_5)
+    ->Apply(Benchmarks::subcell_mesh_arguments);
+
+void bench_wcns5z(benchmark::State& state) {
+  const auto mesh = Benchmarks::subcell_mesh<3>(state);
+  ReconstructionData data{mesh, 3};
+  for (auto _ : state) {
+    fd::reconstruction::wcns5z<2, void>(
+        make_not_null(&data.upper_face_vars),
+        make_not_null(&data.lower_face_vars), data.volume_span(),
+        data.ghost_cell_vars, mesh.extents(), number_of_variables, 2.0e-16,
+        0);
+    benchmark::DoNotOptimize(data.upper_face_data[0].data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_wcns5z)->Apply(Benchmarks::subcell_mesh_arguments);
+}  // namespace
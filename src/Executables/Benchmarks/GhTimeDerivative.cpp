@@ -0,0 +1,123 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Fill every independent component with a smooth field of magnitude `scale`
+// that differs between components.
+template <typename TensorType>
+void fill_smooth(const gsl::not_null<TensorType*> tensor, const double scale,
+                 const tnsr::I<DataVector, 3, Frame::Inertial>& coords) {
+  double offset = 1.0;
+  for (auto& component : *tensor) {
+    component = scale * offset * (get<0>(coords) - 0.5 * get<1>(coords) +
+                                  0.25 * get<2>(coords));
+    offset += 0.1;
+  }
+}
+
+template <typename... TemporaryTags>
+void evaluate_time_derivative(
+    const gsl::not_null<tnsr::aa<DataVector, 3>*> dt_spacetime_metric,
+    const gsl::not_null<tnsr::aa<DataVector, 3>*> dt_pi,
+    const gsl::not_null<tnsr::iaa<DataVector, 3>*> dt_phi,
+    const gsl::not_null<Variables<tmpl::list<TemporaryTags...>>*> temporaries,
+    const tnsr::iaa<DataVector, 3>& d_spacetime_metric,
+    const tnsr::iaa<DataVector, 3>& d_pi,
+    const tnsr::ijaa<DataVector, 3>& d_phi,
+    const tnsr::aa<DataVector, 3>& spacetime_metric,
+    const tnsr::aa<DataVector, 3>& pi, const tnsr::iaa<DataVector, 3>& phi,
+    const Scalar<DataVector>& gamma0, const Scalar<DataVector>& gamma1,
+    const Scalar<DataVector>& gamma2,
+    const gh::gauges::GaugeCondition& gauge_condition, const Mesh<3>& mesh,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& inertial_coords,
+    const InverseJacobian<DataVector, 3, Frame::ElementLogical,
+                          Frame::Inertial>& inverse_jacobian) {
+  gh::TimeDerivative<3>::apply(
+      dt_spacetime_metric, dt_pi, dt_phi,
+      make_not_null(&get<TemporaryTags>(*temporaries))..., d_spacetime_metric,
+      d_pi, d_phi, spacetime_metric, pi, phi, gamma0, gamma1, gamma2,
+      gauge_condition, mesh, 0.0, inertial_coords, inverse_jacobian,
+      std::nullopt, std::nullopt);
+}
+
+template <typename... TemporaryTags>
+void bench_gh_time_derivative_impl(benchmark::State& state,
+                                   tmpl::list<TemporaryTags...> /*meta*/) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+
+  tnsr::I<DataVector, 3, Frame::Inertial> inertial_coords{
+      number_of_grid_points};
+  const auto logical_coords = logical_coordinates(mesh);
+  for (size_t i = 0; i < 3; ++i) {
+    inertial_coords.get(i) = 2.0 * logical_coords.get(i) + 10.0;
+  }
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      inverse_jacobian{number_of_grid_points, 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    inverse_jacobian.get(i, i) = 0.5;
+  }
+
+  // A small perturbation of Minkowski space, which keeps the lapse real and
+  // the spatial metric positive definite.
+  tnsr::aa<DataVector, 3> spacetime_metric{number_of_grid_points};
+  fill_smooth(make_not_null(&spacetime_metric), 1.0e-4, inertial_coords);
+  get<0, 0>(spacetime_metric) -= 1.0;
+  for (size_t i = 1; i < 4; ++i) {
+    spacetime_metric.get(i, i) += 1.0;
+  }
+  tnsr::aa<DataVector, 3> pi{number_of_grid_points};
+  fill_smooth(make_not_null(&pi), 1.0e-3, inertial_coords);
+  tnsr::iaa<DataVector, 3> phi{number_of_grid_points};
+  fill_smooth(make_not_null(&phi), 1.0e-3, inertial_coords);
+  tnsr::iaa<DataVector, 3> d_spacetime_metric{number_of_grid_points};
+  fill_smooth(make_not_null(&d_spacetime_metric), 1.0e-3, inertial_coords);
+  tnsr::iaa<DataVector, 3> d_pi{number_of_grid_points};
+  fill_smooth(make_not_null(&d_pi), 1.0e-3, inertial_coords);
+  tnsr::ijaa<DataVector, 3> d_phi{number_of_grid_points};
+  fill_smooth(make_not_null(&d_phi), 1.0e-3, inertial_coords);
+
+  const Scalar<DataVector> gamma0{number_of_grid_points, 1.0};
+  const Scalar<DataVector> gamma1{number_of_grid_points, -1.0};
+  const Scalar<DataVector> gamma2{number_of_grid_points, 1.0};
+  const gh::gauges::Harmonic gauge_condition{};
+
+  tnsr::aa<DataVector, 3> dt_spacetime_metric{number_of_grid_points};
+  tnsr::aa<DataVector, 3> dt_pi{number_of_grid_points};
+  tnsr::iaa<DataVector, 3> dt_phi{number_of_grid_points};
+  Variables<tmpl::list<TemporaryTags...>> temporaries{number_of_grid_points};
+
+  for (auto _ : state) {
+    evaluate_time_derivative(
+        make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
+        make_not_null(&dt_phi), make_not_null(&temporaries),
+        d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
+        gamma1, gamma2, gauge_condition, mesh, inertial_coords,
+        inverse_jacobian);
+    benchmark::DoNotOptimize(dt_pi.get(0, 0).data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+
+void bench_gh_time_derivative(benchmark::State& state) {
+  bench_gh_time_derivative_impl(
+      state, gh::TimeDerivative<3>::temporary_tags{});
+}
+BENCHMARK(bench_gh_time_derivative)->Apply(Benchmarks::dg_mesh_arguments);
+}  // namespace
@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/AffineTransformation.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MetricIdentityJacobian.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// A rigid rotation about the z-axis combined with an expansion, which is what
+// the grid-to-inertial map of a binary evolution looks like at a given time
+domain::CoordinateMaps::AffineTransformation<3> make_grid_to_inertial() {
+  domain::CoordinateMaps::AffineTransformation<3> grid_to_inertial{};
+  grid_to_inertial.matrix = {
+      {{0.9, -0.3, 0.0}, {0.3, 0.9, 0.0}, {0.0, 0.0, 1.1}}};
+  grid_to_inertial.offset = {{0.1, -0.2, 0.0}};
+  return grid_to_inertial;
+}
+
+// A curved element in the grid frame so that all components of the Jacobian
+// are nonzero
+void make_grid_quantities(
+    const gsl::not_null<tnsr::I<DataVector, 3, Frame::Grid>*> grid_coords,
+    const gsl::not_null<
+        Jacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid>*>
+        grid_jacobian,
+    const Mesh<3>& mesh) {
+  const auto logical_coords = logical_coordinates(mesh);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  *grid_coords = tnsr::I<DataVector, 3, Frame::Grid>{number_of_grid_points};
+  *grid_jacobian = Jacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid>{
+      number_of_grid_points, 0.1};
+  for (size_t i = 0; i < 3; ++i) {
+    grid_coords->get(i) = 2.0 * logical_coords.get(i) +
+                          0.05 * logical_coords.get((i + 1) % 3) *
+                              logical_coords.get((i + 2) % 3);
+    grid_jacobian->get(i, i) = 2.0;
+  }
+}
+
+// Recomputes the metric identity-satisfying quantity from the derivatives of
+// the inertial coordinates, as needed at every substep without caching
+void bench_metric_identity_recompute(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  tnsr::I<DataVector, 3, Frame::Grid> grid_coords{};
+  Jacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid> grid_jacobian{};
+  make_grid_quantities(make_not_null(&grid_coords),
+                       make_not_null(&grid_jacobian), mesh);
+  const auto grid_to_inertial = make_grid_to_inertial();
+  const auto inertial_coords_array = grid_to_inertial(
+      std::array<DataVector, 3>{
+          {get<0>(grid_coords), get<1>(grid_coords), get<2>(grid_coords)}});
+  tnsr::I<DataVector, 3, Frame::Inertial> inertial_coords{};
+  Jacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      inertial_jacobian{number_of_grid_points, 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    inertial_coords.get(i) = gsl::at(inertial_coords_array, i);
+    for (size_t k = 0; k < 3; ++k) {
+      for (size_t j_hat = 0; j_hat < 3; ++j_hat) {
+        inertial_jacobian.get(i, j_hat) +=
+            gsl::at(gsl::at(grid_to_inertial.matrix, i), k) *
+            grid_jacobian.get(k, j_hat);
+      }
+    }
+  }
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      det_jac_times_inverse_jacobian{number_of_grid_points};
+
+  for (auto _ : state) {
+    dg::metric_identity_det_jac_times_inv_jac(
+        make_not_null(&det_jac_times_inverse_jacobian), mesh, inertial_coords,
+        inertial_jacobian);
+    benchmark::DoNotOptimize(get<0, 0>(det_jac_times_inverse_jacobian).data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_metric_identity_recompute)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+
+// Transforms the cached grid-frame quantity with the time-dependent affine
+// grid-to-inertial map
+void bench_metric_identity_cached_grid_frame(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  tnsr::I<DataVector, 3, Frame::Grid> grid_coords{};
+  Jacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid> grid_jacobian{};
+  make_grid_quantities(make_not_null(&grid_coords),
+                       make_not_null(&grid_jacobian), mesh);
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid>
+      grid_det_jac_times_inverse_jacobian{};
+  dg::metric_identity_det_jac_times_inv_jac(
+      make_not_null(&grid_det_jac_times_inverse_jacobian), mesh, grid_coords,
+      grid_jacobian);
+  const auto grid_to_inertial = make_grid_to_inertial();
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      det_jac_times_inverse_jacobian{number_of_grid_points};
+
+  for (auto _ : state) {
+    dg::metric_identity_det_jac_times_inv_jac(
+        make_not_null(&det_jac_times_inverse_jacobian),
+        grid_det_jac_times_inverse_jacobian, grid_to_inertial);
+    benchmark::DoNotOptimize(get<0, 0>(det_jac_times_inverse_jacobian).data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_metric_identity_cached_grid_frame)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+}  // namespace
@@ -0,0 +1,118 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct ScalarVar : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+// The evolved variables of the generalized harmonic system, which are the
+// largest set of variables we take derivatives of in a DG step.
+using gh_variables_tags =
+    tmpl::list<gr::Tags::SpacetimeMetric<DataVector, 3>,
+               gh::Tags::Pi<DataVector, 3>, gh::Tags::Phi<DataVector, 3>>;
+using gh_derivative_tags =
+    db::wrap_tags_in<Tags::deriv, gh_variables_tags, tmpl::size_t<3>,
+                     Frame::Inertial>;
+
+// An inverse Jacobian that couples all dimensions so the contraction with the
+// logical derivatives is not trivially sparse.
+InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+make_inverse_jacobian(const size_t number_of_grid_points) {
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>
+      inverse_jacobian{number_of_grid_points, 0.1};
+  for (size_t i = 0; i < 3; ++i) {
+    inverse_jacobian.get(i, i) = 2.0;
+  }
+  return inverse_jacobian;
+}
+
+Variables<gh_variables_tags> make_gh_variables(const Mesh<3>& mesh) {
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto logical_coords = logical_coordinates(mesh);
+  Variables<gh_variables_tags> u{number_of_grid_points};
+  for (size_t i = 0; i < u.number_of_independent_components; ++i) {
+    DataVector component(u.data() + i * number_of_grid_points,  // NOLINT
+                         number_of_grid_points);
+    component = (1.0 + static_cast<double>(i)) * get<0>(logical_coords) *
+                    get<1>(logical_coords) +
+                square(get<2>(logical_coords));
+  }
+  return u;
+}
+
+void bench_partial_derivatives_gh_variables(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto inverse_jacobian = make_inverse_jacobian(number_of_grid_points);
+  const auto u = make_gh_variables(mesh);
+  Variables<gh_derivative_tags> du{number_of_grid_points};
+
+  for (auto _ : state) {
+    partial_derivatives(make_not_null(&du), u, mesh, inverse_jacobian);
+    benchmark::DoNotOptimize(du.data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_partial_derivatives_gh_variables)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+
+void bench_fused_partial_derivatives_gh_variables(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto inverse_jacobian = make_inverse_jacobian(number_of_grid_points);
+  const auto u = make_gh_variables(mesh);
+  Variables<gh_derivative_tags> du{number_of_grid_points};
+
+  for (auto _ : state) {
+    fused_partial_derivatives(make_not_null(&du), u, mesh, inverse_jacobian);
+    benchmark::DoNotOptimize(du.data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_fused_partial_derivatives_gh_variables)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+
+// A single scalar, which measures the per-call overhead of the derivative
+// code rather than the throughput.
+void bench_partial_derivatives_scalar(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto inverse_jacobian = make_inverse_jacobian(number_of_grid_points);
+
+  Variables<tmpl::list<ScalarVar>> u{number_of_grid_points};
+  get(get<ScalarVar>(u)) = get<0>(logical_coordinates(mesh));
+  Variables<tmpl::list<Tags::deriv<ScalarVar, tmpl::size_t<3>, Frame::Inertial>>>
+      du{number_of_grid_points};
+
+  for (auto _ : state) {
+    partial_derivatives(make_not_null(&du), u, mesh, inverse_jacobian);
+    benchmark::DoNotOptimize(du.data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+BENCHMARK(bench_partial_derivatives_scalar)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+}  // namespace
@@ -0,0 +1,57 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Transpose.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Number of independent components in the data, roughly the size of the
+// generalized harmonic evolved variables.
+constexpr size_t number_of_components = 50;
+
+// Reports the memory bandwidth achieved by a transpose, counting every value
+// being read once and written once.
+void set_transpose_bytes_processed(const gsl::not_null<benchmark::State*> state,
+                                   const size_t size) {
+  state->SetBytesProcessed(static_cast<int64_t>(state->iterations()) * 2 *
+                           static_cast<int64_t>(size * sizeof(double)));
+}
+
+// Moves the first logical dimension to be the slowest varying, as is done
+// before differentiating in the second and third dimensions.
+void bench_transpose(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t size = number_of_components * mesh.number_of_grid_points();
+  const DataVector u(size, 1.0);
+  DataVector result(size);
+  for (auto _ : state) {
+    transpose(make_not_null(&result), u, mesh.extents(0),
+              size / mesh.extents(0));
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  set_transpose_bytes_processed(make_not_null(&state), size);
+}
+BENCHMARK(bench_transpose)->Apply(Benchmarks::dg_mesh_arguments);
+
+void bench_transpose_in_place(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t size = number_of_components * mesh.number_of_grid_points();
+  DataVector u(size, 1.0);
+  for (auto _ : state) {
+    transpose_in_place(make_not_null(&u), mesh.extents(0),
+                       size / mesh.extents(0));
+    benchmark::DoNotOptimize(u.data());
+    benchmark::ClobberMemory();
+  }
+  set_transpose_bytes_processed(make_not_null(&state), size);
+}
+BENCHMARK(bench_transpose_in_place)->Apply(Benchmarks::dg_mesh_arguments);
+}  // namespace
@@ -0,0 +1,131 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservativeOptions.hpp"
+#include "Executables/Benchmarks/DgMeshArguments.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <typename RecoveryScheme>
+void bench_primitive_from_conservative(benchmark::State& state) {
+  const auto mesh = Benchmarks::dg_mesh<3>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto logical_coords = logical_coordinates(mesh);
+
+  // A mildly relativistic, magnetized fluid in flat space that varies across
+  // the element so the root finds take different paths at different points.
+  const EquationsOfState::IdealFluid<true> equation_of_state{5.0 / 3.0};
+  const Scalar<DataVector> rest_mass_density{
+      1.0e-3 * (1.5 + 0.5 * get<0>(logical_coords))};
+  const Scalar<DataVector> electron_fraction{number_of_grid_points, 0.1};
+  const Scalar<DataVector> specific_internal_energy{
+      0.2 + 0.1 * get<1>(logical_coords)};
+  const Scalar<DataVector> pressure{(2.0 / 3.0) * get(rest_mass_density) *
+                                    get(specific_internal_energy)};
+  tnsr::I<DataVector, 3, Frame::Inertial> spatial_velocity{
+      number_of_grid_points};
+  get<0>(spatial_velocity) = 0.3 * get<2>(logical_coords);
+  get<1>(spatial_velocity) = 0.2;
+  get<2>(spatial_velocity) = -0.1 * get<0>(logical_coords);
+  const Scalar<DataVector> lorentz_factor{
+      1.0 / sqrt(1.0 - square(get<0>(spatial_velocity)) -
+                 square(get<1>(spatial_velocity)) -
+                 square(get<2>(spatial_velocity)))};
+  tnsr::I<DataVector, 3, Frame::Inertial> magnetic_field{number_of_grid_points,
+                                                         1.0e-3};
+  get<2>(magnetic_field) += 1.0e-3 * get<1>(logical_coords);
+  const Scalar<DataVector> divergence_cleaning_field{number_of_grid_points,
+                                                     0.0};
+
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric{number_of_grid_points,
+                                                          0.0};
+  tnsr::II<DataVector, 3, Frame::Inertial> inv_spatial_metric{
+      number_of_grid_points, 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+    inv_spatial_metric.get(i, i) = 1.0;
+  }
+  const Scalar<DataVector> sqrt_det_spatial_metric{number_of_grid_points, 1.0};
+
+  Scalar<DataVector> tilde_d{number_of_grid_points};
+  Scalar<DataVector> tilde_ye{number_of_grid_points};
+  Scalar<DataVector> tilde_tau{number_of_grid_points};
+  tnsr::i<DataVector, 3, Frame::Inertial> tilde_s{number_of_grid_points};
+  tnsr::I<DataVector, 3, Frame::Inertial> tilde_b{number_of_grid_points};
+  Scalar<DataVector> tilde_phi{number_of_grid_points};
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_ye),
+      make_not_null(&tilde_tau), make_not_null(&tilde_s),
+      make_not_null(&tilde_b), make_not_null(&tilde_phi), rest_mass_density,
+      electron_fraction, specific_internal_energy, pressure, spatial_velocity,
+      lorentz_factor, magnetic_field, sqrt_det_spatial_metric, spatial_metric,
+      divergence_cleaning_field);
+
+  const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions options{
+      1.0e-12, 1.0e-12};
+
+  Scalar<DataVector> recovered_rest_mass_density{number_of_grid_points};
+  Scalar<DataVector> recovered_electron_fraction{number_of_grid_points};
+  Scalar<DataVector> recovered_specific_internal_energy{number_of_grid_points};
+  tnsr::I<DataVector, 3, Frame::Inertial> recovered_spatial_velocity{
+      number_of_grid_points};
+  tnsr::I<DataVector, 3, Frame::Inertial> recovered_magnetic_field{
+      number_of_grid_points};
+  Scalar<DataVector> recovered_divergence_cleaning_field{
+      number_of_grid_points};
+  Scalar<DataVector> recovered_lorentz_factor{number_of_grid_points};
+  Scalar<DataVector> recovered_pressure{number_of_grid_points};
+  Scalar<DataVector> recovered_specific_enthalpy{number_of_grid_points};
+  Scalar<DataVector> recovered_temperature{number_of_grid_points};
+
+  for (auto _ : state) {
+    // The input pressure is the initial guess of the recovery. Reset it so
+    // every iteration does the same amount of work. The cost of the reset is
+    // negligible compared to the root finds.
+    get(recovered_pressure) = 1.1 * get(pressure);
+    grmhd::ValenciaDivClean::PrimitiveFromConservative<
+        tmpl::list<RecoveryScheme>>::apply(
+        make_not_null(&recovered_rest_mass_density),
+        make_not_null(&recovered_electron_fraction),
+        make_not_null(&recovered_specific_internal_energy),
+        make_not_null(&recovered_spatial_velocity),
+        make_not_null(&recovered_magnetic_field),
+        make_not_null(&recovered_divergence_cleaning_field),
+        make_not_null(&recovered_lorentz_factor),
+        make_not_null(&recovered_pressure),
+        make_not_null(&recovered_specific_enthalpy),
+        make_not_null(&recovered_temperature), tilde_d, tilde_ye, tilde_tau,
+        tilde_s, tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+        sqrt_det_spatial_metric, equation_of_state, options);
+    benchmark::DoNotOptimize(get(recovered_rest_mass_density).data());
+    benchmark::ClobberMemory();
+  }
+  Benchmarks::set_grid_points_processed(make_not_null(&state), mesh);
+}
+
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl;
+BENCHMARK_TEMPLATE(bench_primitive_from_conservative, KastaunEtAl)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+BENCHMARK_TEMPLATE(bench_primitive_from_conservative, NewmanHamlin)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+BENCHMARK_TEMPLATE(bench_primitive_from_conservative, PalenzuelaEtAl)
+    ->Apply(Benchmarks::dg_mesh_arguments);
+}  // namespace
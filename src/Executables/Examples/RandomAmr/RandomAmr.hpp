@@ -78,6 +78,7 @@ struct RandomAmrMetavars {
                 PhaseControl::VisitAndReturn<
                     Parallel::Phase::EvaluateAmrCriteria>,
                 PhaseControl::VisitAndReturn<Parallel::Phase::AdjustDomain>,
+                PhaseControl::VisitAndReturn<Parallel::Phase::LoadBalancing>,
                 PhaseControl::VisitAndReturn<Parallel::Phase::CheckDomain>,
                 PhaseControl::CheckpointAndExitAfterWallclock>>,
         tmpl::pair<Trigger, tmpl::list<Triggers::Always>>>;
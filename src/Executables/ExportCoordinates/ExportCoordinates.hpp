@@ -350,8 +350,6 @@ struct Metavariables {
                              ::amr::Initialization::Initialize<volume_dim>,
                              Initialization::SetMeshType<Dim>>,
                          Initialization::Actions::AddComputeTags<tmpl::list<
-                             ::domain::Tags::MinimumGridSpacingCompute<
-                                 Dim, Frame::Inertial>,
                              ::domain::Tags::FlatLogicalMetricCompute<Dim>>>,
                          Parallel::Actions::TerminatePhase>>,
           Parallel::PhaseActions<
@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <optional>
 #include <pup.h>
 #include <string>
+#include <variant>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
@@ -14,12 +19,16 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/ObjectLabel.hpp"
 #include "Domain/Tags.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
 #include "Elliptic/DiscontinuousGalerkin/Actions/InitializeDomain.hpp"
 #include "Elliptic/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "IO/Importers/Actions/ReadVolumeData.hpp"
-#include "IO/Importers/Actions/ReceiveVolumeData.hpp"
 #include "IO/Importers/Actions/RegisterWithElementDataReader.hpp"
 #include "IO/Importers/ElementDataReader.hpp"
+#include "IO/Importers/ObservationSelector.hpp"
+#include "IO/Importers/Tags.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/ReductionActions.hpp"
@@ -60,12 +69,16 @@
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Tags/Time.hpp"
 #include "Utilities/Blas.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
 #include "Utilities/ErrorHandling/SegfaultHandler.hpp"
-#include "Utilities/Overloader.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 /// \cond
 namespace FindHorizons {
@@ -76,14 +89,90 @@ struct VolumeDataGroup {
   static constexpr Options::String help =
       "Volume data to load and find horizons in";
 };
+
+struct ObservationsInFlight {
+  using type = size_t;
+  using group = VolumeDataGroup;
+  static constexpr Options::String help =
+      "Number of observations that are read ahead of the one the elements are "
+      "working on. Reading ahead lets the data reader, the interpolator and "
+      "the horizon finders work on different observations at the same time.";
+  static size_t lower_bound() { return 1; }
+};
 }  // namespace OptionTags
 
+namespace Tags {
+/// The observation values to find horizons at, in increasing order. Selecting
+/// `All` observations lists the observations in the first file that matches
+/// the file glob.
+struct ObservationValues : db::SimpleTag {
+  using type = std::vector<double>;
+  using option_tags =
+      tmpl::list<importers::Tags::ImporterOptions<OptionTags::VolumeDataGroup>>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const importers::ImporterOptions& options) {
+    const auto& observation_value =
+        get<importers::OptionTags::ObservationValue>(options);
+    if (std::holds_alternative<double>(observation_value)) {
+      return {std::get<double>(observation_value)};
+    }
+    const auto file_paths =
+        file_system::glob(get<importers::OptionTags::FileGlob>(options));
+    if (file_paths.empty()) {
+      ERROR_NO_TRACE("The file glob '"
+                     << get<importers::OptionTags::FileGlob>(options)
+                     << "' matches no files.");
+    }
+    const h5::H5File<h5::AccessType::ReadOnly> h5file(file_paths.front());
+    const auto& volume_file = h5file.get<h5::VolumeData>(
+        "/" + get<importers::OptionTags::Subgroup>(options), 0);
+    std::vector<double> result{};
+    for (const size_t observation_id : volume_file.list_observation_ids()) {
+      result.push_back(volume_file.get_observation_value(observation_id));
+    }
+    if (result.empty()) {
+      ERROR_NO_TRACE("The file '" << file_paths.front()
+                                  << "' contains no observations.");
+    }
+    std::sort(result.begin(), result.end());
+    switch (std::get<importers::ObservationSelector>(observation_value)) {
+      case importers::ObservationSelector::First:
+        return {result.front()};
+      case importers::ObservationSelector::Last:
+        return {result.back()};
+      default:
+        return result;
+    }
+  }
+};
+
+struct ObservationsInFlight : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<OptionTags::ObservationsInFlight>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const size_t value) { return value; }
+};
+
+/// Index into `FindHorizons::Tags::ObservationValues` of the observation the
+/// element is working on
+struct ObservationIndex : db::SimpleTag {
+  using type = size_t;
+};
+
+/// Number of observations the element has requested from the data reader
+struct NumberOfRequestedObservations : db::SimpleTag {
+  using type = size_t;
+};
+}  // namespace Tags
+
 namespace Actions {
 
 template <size_t Dim, typename FieldsTagsList>
 struct InitializeFields {
   using simple_tags =
-      tmpl::list<::Tags::Time, ::Tags::Variables<FieldsTagsList>>;
+      tmpl::list<::Tags::Time, ::Tags::Variables<FieldsTagsList>,
+                 Tags::ObservationIndex, Tags::NumberOfRequestedObservations>;
+  using const_global_cache_tags = tmpl::list<Tags::ObservationValues>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
@@ -93,34 +182,139 @@ struct InitializeFields {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/, ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
-    // For now, set the time to the observation value at which we want to read
-    // data, or to zero if it's determined from the available observations
-    // automatically. The time is currently only used to index interpolations to
-    // the AH finder. We can generalize this to step through the available
-    // observations in the file, handle time-dependent domains, etc. To do that,
-    // the importer will have to send information about the observation value it
-    // read from the file, as well as the available observation IDs/values in
-    // the file.
-    const auto& options =
-        db::get<importers::Tags::ImporterOptions<OptionTags::VolumeDataGroup>>(
-            box);
-    const double observation_time = std::visit(
-        Overloader{
-            [](const double local_obs_value) { return local_obs_value; },
-            [](const importers::ObservationSelector /*local_obs_selector*/) {
-              return 0.;
-            }},
-        get<importers::OptionTags::ObservationValue>(options));
-    ::Initialization::mutate_assign<tmpl::list<::Tags::Time>>(
-        make_not_null(&box), observation_time);
+    // The time is set to the observation value of the data that is read from
+    // the file. It is used to index interpolations to the AH finder. We can
+    // generalize this to handle time-dependent domains, etc.
+    ::Initialization::mutate_assign<
+        tmpl::list<::Tags::Time, Tags::ObservationIndex,
+                   Tags::NumberOfRequestedObservations>>(
+        make_not_null(&box), db::get<Tags::ObservationValues>(box).front(),
+        0_st, 0_st);
     // Nothing to do to initialize the fields. They will be read from the
     // volume data file.
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
 
+// Request the observations up to `Tags::ObservationsInFlight` ahead of the
+// current one from the data reader. Each observation is read once per node, by
+// the first element that requests it, and identified by its index in the
+// inbox. Reading ahead keeps the data reader busy while the elements, the
+// interpolator and the horizon finders work on earlier observations.
+template <typename FieldsTagsList>
+struct RequestObservations {
+  using const_global_cache_tags =
+      tmpl::list<importers::Tags::ImporterOptions<OptionTags::VolumeDataGroup>,
+                 Tags::ObservationsInFlight>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& /*element_id*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto& observation_values = db::get<Tags::ObservationValues>(box);
+    const size_t end_of_requests =
+        std::min(db::get<Tags::ObservationIndex>(box) +
+                     db::get<Tags::ObservationsInFlight>(box),
+                 observation_values.size());
+    auto options =
+        db::get<importers::Tags::ImporterOptions<OptionTags::VolumeDataGroup>>(
+            box);
+    // Not using `ckLocalBranch` here to make sure the simple action invocation
+    // is asynchronous.
+    auto& reader_component = Parallel::get_parallel_component<
+        importers::ElementDataReader<Metavariables>>(cache);
+    for (size_t i = db::get<Tags::NumberOfRequestedObservations>(box);
+         i < end_of_requests; ++i) {
+      get<importers::OptionTags::ObservationValue>(options) =
+          observation_values[i];
+      Parallel::simple_action<
+          importers::Actions::ReadAllVolumeDataAndDistribute<
+              Dim, FieldsTagsList, ParallelComponent>>(reader_component,
+                                                       options, i);
+    }
+    db::mutate<Tags::NumberOfRequestedObservations>(
+        [&end_of_requests](const gsl::not_null<size_t*> requested) {
+          *requested = std::max(*requested, end_of_requests);
+        },
+        make_not_null(&box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// Wait for the data of the current observation and move it into the DataBox
+template <typename FieldsTagsList>
+struct ReceiveObservation {
+  using inbox_tags = tmpl::list<importers::Tags::VolumeData<FieldsTagsList>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    auto& inbox =
+        tuples::get<importers::Tags::VolumeData<FieldsTagsList>>(inboxes);
+    const size_t observation_index = db::get<Tags::ObservationIndex>(box);
+    const auto received_data = inbox.find(observation_index);
+    if (received_data == inbox.end()) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+    auto& element_data = received_data->second;
+    tmpl::for_each<FieldsTagsList>([&box, &element_data](auto tag_v) {
+      using tag = tmpl::type_from<decltype(tag_v)>;
+      db::mutate<tag>(
+          [&element_data](const gsl::not_null<typename tag::type*> value) {
+            *value = std::move(tuples::get<tag>(element_data));
+          },
+          make_not_null(&box));
+    });
+    inbox.erase(received_data);
+    db::mutate<::Tags::Time>(
+        [&observation_index](const gsl::not_null<double*> time,
+                             const std::vector<double>& observation_values) {
+          *time = observation_values[observation_index];
+        },
+        make_not_null(&box), db::get<Tags::ObservationValues>(box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// Move on to the next observation, or continue past the loop over observations
+// once all have been dispatched to the horizon finders
+template <typename FirstActionOfLoop>
+struct NextObservation {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    db::mutate<Tags::ObservationIndex>(
+        [](const gsl::not_null<size_t*> observation_index) {
+          ++(*observation_index);
+        },
+        make_not_null(&box));
+    if (db::get<Tags::ObservationIndex>(box) <
+        db::get<Tags::ObservationValues>(box).size()) {
+      return {Parallel::AlgorithmExecution::Continue,
+              tmpl::index_of<ActionList, FirstActionOfLoop>::value};
+    }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
 // Send volume data to the interpolator, which will trigger an apparent horizon
-// find
+// find. The horizon finders process the observations in order, so each find
+// starts from an initial guess extrapolated from the previous horizons.
 template <typename InterpolationTargetTag>
 struct DispatchApparentHorizonFinder {
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -229,7 +423,9 @@ struct Metavariables {
   static constexpr size_t volume_dim = Dim;
 
   static constexpr Options::String help{
-      "Find apparent horizons in volume data."};
+      "Find apparent horizons in volume data. Set the 'ObservationValue' of "
+      "the volume data to 'All' to find horizons at every observation in the "
+      "files."};
 
   // A placeholder system for the domain creators
   struct system {};
@@ -277,13 +473,14 @@ struct Metavariables {
           Parallel::PhaseActions<
               Parallel::Phase::Execute,
               tmpl::list<
-                  importers::Actions::ReadVolumeData<
-                      OptionTags::VolumeDataGroup, adm_vars>,
-                  importers::Actions::ReceiveVolumeData<adm_vars>,
+                  Actions::RequestObservations<adm_vars>,
+                  Actions::ReceiveObservation<adm_vars>,
                   Actions::DispatchApparentHorizonFinder<AhA>,
                   tmpl::conditional_t<
                       two_horizons, Actions::DispatchApparentHorizonFinder<AhB>,
                       tmpl::list<>>,
+                  Actions::NextObservation<
+                      Actions::RequestObservations<adm_vars>>,
                   Parallel::Actions::TerminatePhase>>>>;
 
   using component_list = tmpl::flatten<tmpl::list<
@@ -1,9 +1,12 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <cstddef>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -19,7 +22,9 @@
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
 #include "Parallel/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
@@ -148,25 +153,29 @@ void slice_buffers_to_libsharp_modes(
   }
 }
 
-// read in the data from a (previously standard) SpEC worldtube file
-// `input_file`, perform the boundary computation, and dump the (considerably
-// smaller) dataset associated with the spin-weighted scalars to `output_file`.
-void perform_cce_worldtube_reduction(
-    const std::string& input_file, const std::string& output_file,
-    const size_t buffer_depth, const size_t l_max_factor,
-    const bool fix_spec_normalization = false) {
-  Cce::MetricWorldtubeH5BufferUpdater buffer_updater{input_file};
-  const size_t l_max = buffer_updater.get_l_max();
-  // Perform the boundary computation to scalars at twice the input l_max to be
-  // absolutely certain that there are no problems associated with aliasing.
-  const size_t computation_l_max = l_max_factor * l_max;
-
-  // we're not interpolating, this is just a reasonable number of rows to ingest
-  // at a time.
-  const size_t size_of_buffer = square(l_max + 1) * (buffer_depth);
-  const DataVector& time_buffer = buffer_updater.get_time_buffer();
+using reduced_boundary_tags =
+    tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
 
-  Variables<Cce::cce_metric_input_tags> coefficients_buffers{size_of_buffer};
+// Performs the boundary computation for the times with offsets `first_offset`,
+// `first_offset + offset_stride`, ... in the buffers, and stores the reduced
+// Goldberg modes of each tag in `reduced_modes`, with the modes of all the
+// times in the buffers for the first tag first. Each thread calls this with
+// its own `first_offset`.
+void reduce_buffered_times(
+    const gsl::not_null<std::vector<ComplexModalVector>*> reduced_modes,
+    const Variables<Cce::cce_metric_input_tags>& coefficients_buffers,
+    const size_t time_span, const size_t first_offset,
+    const size_t offset_stride, const size_t l_max,
+    const size_t computation_l_max, const double extraction_radius,
+    const bool apply_spec_normalization_fix) {
   Variables<Cce::cce_metric_input_tags> coefficients_set{
       Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
 
@@ -175,39 +184,17 @@ void perform_cce_worldtube_reduction(
       boundary_data_variables{
           Spectral::Swsh::number_of_swsh_collocation_points(computation_l_max)};
 
-  using reduced_boundary_tags =
-      tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
-
-  size_t time_span_start = 0;
-  size_t time_span_end = 0;
-  Cce::ReducedWorldtubeModeRecorder recorder{output_file};
-
   ComplexModalVector output_goldberg_mode_buffer{square(computation_l_max + 1)};
   ComplexModalVector output_libsharp_mode_buffer{
       Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
 
-  for (size_t i = 0; i < time_buffer.size(); ++i) {
-    const double time = time_buffer[i];
-    Parallel::printf("reducing data at time : %f / %f \r", time,
-                     time_buffer[time_buffer.size() - 1]);
-    buffer_updater.update_buffers_for_time(
-        make_not_null(&coefficients_buffers), make_not_null(&time_span_start),
-        make_not_null(&time_span_end), time, l_max, 0, buffer_depth);
+  for (size_t offset = first_offset; offset < time_span;
+       offset += offset_stride) {
+    slice_buffers_to_libsharp_modes(make_not_null(&coefficients_set),
+                                    coefficients_buffers, time_span, offset,
+                                    l_max, computation_l_max);
 
-    slice_buffers_to_libsharp_modes(
-        make_not_null(&coefficients_set), coefficients_buffers,
-        time_span_end - time_span_start, i - time_span_start, l_max,
-        computation_l_max);
-
-    if (not buffer_updater.has_version_history() and fix_spec_normalization) {
+    if (apply_spec_normalization_fix) {
       Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
           make_not_null(&boundary_data_variables),
           get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
@@ -222,7 +209,7 @@ void perform_cce_worldtube_reduction(
           get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
           get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
               coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
+          extraction_radius, computation_l_max);
     } else {
       Cce::create_bondi_boundary_data(
           make_not_null(&boundary_data_variables),
@@ -238,13 +225,13 @@ void perform_cce_worldtube_reduction(
           get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
           get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
               coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
+          extraction_radius, computation_l_max);
     }
     // loop over the tags that we want to dump.
     tmpl::for_each<reduced_boundary_tags>(
-        [&recorder, &boundary_data_variables, &output_goldberg_mode_buffer,
-         &output_libsharp_mode_buffer, &l_max, &computation_l_max,
-         &time](auto tag_v) {
+        [&reduced_modes, &boundary_data_variables, &output_goldberg_mode_buffer,
+         &output_libsharp_mode_buffer, &l_max, &computation_l_max, &time_span,
+         &offset](auto tag_v) {
           using tag = typename decltype(tag_v)::type;
           SpinWeighted<ComplexModalVector, tag::type::type::spin>
               spin_weighted_libsharp_view;
@@ -266,13 +253,106 @@ void perform_cce_worldtube_reduction(
           // The goldberg format type is in strictly increasing l modes, so to
           // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
           // values.
-          ComplexModalVector reduced_goldberg_view{
-              output_goldberg_mode_buffer.data(), square(l_max + 1)};
-          recorder.append_worldtube_mode_data(
-              "/" + Cce::dataset_label_for_tag<tag>(), time,
-              reduced_goldberg_view, l_max, tag::type::type::spin == 0);
+          ComplexModalVector& modes =
+              (*reduced_modes)[tmpl::index_of<reduced_boundary_tags,
+                                              tag>::value *
+                                   time_span +
+                               offset];
+          if (modes.size() != square(l_max + 1)) {
+            modes = ComplexModalVector{square(l_max + 1)};
+          }
+          std::copy(output_goldberg_mode_buffer.data(),
+                    output_goldberg_mode_buffer.data() + modes.size(),
+                    modes.data());
         });
   }
+}
+
+// read in the data from a (previously standard) SpEC worldtube file
+// `input_file`, perform the boundary computation, and dump the (considerably
+// smaller) dataset associated with the spin-weighted scalars to `output_file`.
+//
+// The input is streamed `buffer_depth` times at a time. The boundary
+// computations for the times in the buffer are independent, so they are
+// divided among `number_of_threads` threads, and the results for the buffer
+// are then written together.
+void perform_cce_worldtube_reduction(
+    const std::string& input_file, const std::string& output_file,
+    const size_t buffer_depth, const size_t l_max_factor,
+    const size_t number_of_threads, const bool fix_spec_normalization = false) {
+  Cce::MetricWorldtubeH5BufferUpdater buffer_updater{input_file};
+  const size_t l_max = buffer_updater.get_l_max();
+  // Perform the boundary computation to scalars at twice the input l_max to be
+  // absolutely certain that there are no problems associated with aliasing.
+  const size_t computation_l_max = l_max_factor * l_max;
+
+  // we're not interpolating, this is just a reasonable number of rows to ingest
+  // at a time.
+  const size_t size_of_buffer = square(l_max + 1) * (buffer_depth);
+  const DataVector& time_buffer = buffer_updater.get_time_buffer();
+
+  Variables<Cce::cce_metric_input_tags> coefficients_buffers{size_of_buffer};
+  const double extraction_radius = buffer_updater.get_extraction_radius();
+  const bool apply_spec_normalization_fix =
+      not buffer_updater.has_version_history() and fix_spec_normalization;
+
+  size_t time_span_start = 0;
+  size_t time_span_end = 0;
+  Cce::ReducedWorldtubeModeRecorder recorder{output_file};
+
+  std::vector<ComplexModalVector> reduced_modes{};
+  std::vector<ComplexModalVector> reduced_modes_for_tag{};
+  std::vector<double> times{};
+  size_t i = 0;
+  while (i < time_buffer.size()) {
+    Parallel::printf("reducing data at time : %f / %f \r", time_buffer[i],
+                     time_buffer[time_buffer.size() - 1]);
+    buffer_updater.update_buffers_for_time(
+        make_not_null(&coefficients_buffers), make_not_null(&time_span_start),
+        make_not_null(&time_span_end), time_buffer[i], l_max, 0, buffer_depth);
+    if (UNLIKELY(time_span_end <= i)) {
+      ERROR("The buffer updater did not load the data at time "
+            << time_buffer[i]);
+    }
+    const size_t time_span = time_span_end - time_span_start;
+    // Only the times from `i` onward are new, the earlier ones in the buffer
+    // have already been written.
+    const size_t first_new_offset = i - time_span_start;
+    reduced_modes.resize(tmpl::size<reduced_boundary_tags>::value * time_span);
+
+    const auto reduce = [&](const size_t first_offset) {
+      reduce_buffered_times(
+          make_not_null(&reduced_modes), coefficients_buffers, time_span,
+          first_new_offset + first_offset, number_of_threads, l_max,
+          computation_l_max, extraction_radius, apply_spec_normalization_fix);
+    };
+    std::vector<std::thread> threads{};
+    threads.reserve(number_of_threads - 1);
+    for (size_t thread = 1; thread < number_of_threads; ++thread) {
+      threads.emplace_back(reduce, thread);
+    }
+    reduce(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    times.assign(time_buffer.data() + i, time_buffer.data() + time_span_end);
+    tmpl::for_each<reduced_boundary_tags>([&](auto tag_v) {
+      using tag = typename decltype(tag_v)::type;
+      const auto first_mode =
+          reduced_modes.begin() +
+          static_cast<std::ptrdiff_t>(
+              tmpl::index_of<reduced_boundary_tags, tag>::value * time_span +
+              first_new_offset);
+      reduced_modes_for_tag.assign(
+          first_mode,
+          first_mode + static_cast<std::ptrdiff_t>(times.size()));
+      recorder.append_worldtube_mode_data(
+          "/" + Cce::dataset_label_for_tag<tag>(), times,
+          reduced_modes_for_tag, l_max, tag::type::type::spin == 0);
+    });
+    i = time_span_end;
+  }
   Parallel::printf("\n");
 }
 }  // namespace
@@ -301,7 +381,10 @@ int main(int argc, char** argv) {
       "routines. Higher values mean fewer, larger loads from file into RAM.")(
       "lmax_factor", boost::program_options::value<size_t>()->default_value(2),
       "the boundary computations will be performed at a resolution that is "
-      "lmax_factor times the input file lmax to avoid aliasing");
+      "lmax_factor times the input file lmax to avoid aliasing")(
+      "threads", boost::program_options::value<size_t>()->default_value(1),
+      "number of threads that perform the boundary computations for the "
+      "times loaded in each call to the file-accessing routines");
 
   boost::program_options::variables_map vars;
 
@@ -322,5 +405,6 @@ int main(int argc, char** argv) {
                                   vars["output_file"].as<std::string>(),
                                   vars["buffer_depth"].as<size_t>(),
                                   vars["lmax_factor"].as<size_t>(),
+                                  std::max(vars["threads"].as<size_t>(), 1_st),
                                   vars.count("fix_spec_normalization") != 0u);
 }
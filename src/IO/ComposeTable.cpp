@@ -4,6 +4,8 @@
 #include "IO/ComposeTable.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdlib>
 #include <fstream>
 #include <limits>
 #include <pup.h>
@@ -151,23 +153,46 @@ void ComposeTable::parse_eos_parameters() {
 }
 
 void ComposeTable::parse_eos_table() {
+  // Look up the data of each column once instead of for every value
+  std::vector<DataVector*> columns{};
+  columns.reserve(available_quantities_.size());
   for (const auto& quantity_name : available_quantities()) {
-    data_[quantity_name] = DataVector{table_size_};
+    columns.push_back(&(data_[quantity_name] = DataVector{table_size_}));
   }
 
-  std::string line_buffer{};
   const std::string filename{directory_to_read_from_ + "/eos.table"};
   if (not file_system::check_if_file_exists(filename)) {
     ERROR("File '" << filename << "' does not exist.");
   }
   std::ifstream table_file(filename);
 
+  // The table is streamed one row at a time and the values are parsed with
+  // `std::strtod`, which is several times faster than extracting them from the
+  // stream with `operator>>`. Tables can have hundreds of millions of values.
+  std::string line_buffer{};
   for (size_t i = 0; i < table_size_; ++i) {
-    // Read in number density, temperature, and electron fraction
-    double dummy = std::numeric_limits<double>::signaling_NaN();
-    table_file >> dummy >> dummy >> dummy;
-    for (const auto& quantity_name : available_quantities()) {
-      table_file >> data_[quantity_name][i];
+    if (not std::getline(table_file, line_buffer)) {
+      ERROR("File '" << filename << "' ends after " << i << " of "
+                     << table_size_ << " rows.");
+    }
+    const char* position = line_buffer.c_str();
+    const auto next_value = [&position, &line_buffer, &filename, &i]() {
+      char* end = nullptr;
+      const double value = std::strtod(position, &end);
+      if (end == position) {
+        ERROR("Could not read all values from row "
+              << i << " of file '" << filename << "': '" << line_buffer
+              << "'");
+      }
+      position = end;
+      return value;
+    };
+    // Skip the temperature, number density, and electron fraction
+    for (size_t j = 0; j < 3; ++j) {
+      next_value();
+    }
+    for (DataVector* column : columns) {
+      (*column)[i] = next_value();
     }
   }
 }
@@ -7,45 +7,33 @@
 #include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5PropertiesMatch.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/SourceArchive.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "Parallel/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/StdHelpers.hpp"
 
 namespace {
-// Returns all the observation_ids stored in the volume files. Assumes all
-// volume files have the same observation ids
-std::vector<size_t> get_observation_ids(
-    const std::vector<std::string>& file_names,
-    const std::string& subfile_name) {
-  const h5::H5File<h5::AccessType::ReadOnly> initial_file(file_names[0], false);
-  const auto& initial_volume_file =
-      initial_file.get<h5::VolumeData>(subfile_name);
-  return initial_volume_file.list_observation_ids();
-}
-
 // Returns total number of elements for an observation id across all volume data
 // files
-size_t get_number_of_elements(const std::vector<std::string>& input_filenames,
-                              const std::string& subfile_name,
-                              const size_t& observation_id) {
+size_t get_number_of_elements(
+    const std::vector<const h5::VolumeData*>& volume_files,
+    const size_t& observation_id) {
   size_t total_elements = 0;
-  for (const auto& input_filename : input_filenames) {
-    const h5::H5File<h5::AccessType::ReadOnly> original_file(input_filename,
-                                                             false);
-    const auto& original_volume_file =
-        original_file.get<h5::VolumeData>(subfile_name);
-    total_elements += original_volume_file.get_extents(observation_id).size();
+  for (const auto* const volume_file : volume_files) {
+    total_elements += volume_file->get_extents(observation_id).size();
   }
   return total_elements;
 }
@@ -54,7 +42,15 @@ namespace h5 {
 
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
-                const bool check_src) {
+                const bool check_src, const size_t process_index,
+                const size_t number_of_processes,
+                const Compression& compression) {
+  if (number_of_processes == 0 or process_index >= number_of_processes) {
+    ERROR("The process index ("
+          << process_index
+          << ") must be smaller than the number of processes ("
+          << number_of_processes << ").");
+  }
   // Parses for and stores all input files to be looped over
   Parallel::printf("Processing files:\n%s\n",
                    std::string{MakeString{} << file_names}.c_str());
@@ -77,27 +73,38 @@ void combine_h5(const std::vector<std::string>& file_names,
         "executable or were corrupted.");
   }
 
-  // Braces to specify scope for H5 file
-  {
-    // Instantiates the output file and the .vol subfile to be filled with the
-    // combined data later
-    Parallel::printf("Creating output file: %s\n", output.c_str());
-    h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
-    new_file.insert<h5::VolumeData>(subfile_name);
-    new_file.close_current_object();
-  }  // End of scope for H5 file
-
-  // Obtains list of observation ids to loop over
+  // Instantiates the output file and the .vol subfile to be filled with the
+  // combined data later
+  Parallel::printf("Creating output file: %s\n", output.c_str());
+  h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
+  auto& new_volume_file = new_file.insert<h5::VolumeData>(subfile_name);
+
+  // Opens every input file once and keeps it open for all observations, since
+  // opening the files and their subfiles dominates for many small observations
+  std::vector<h5::H5File<h5::AccessType::ReadOnly>> original_files{};
+  original_files.reserve(file_names.size());
+  std::vector<const h5::VolumeData*> original_volume_files{};
+  original_volume_files.reserve(file_names.size());
+  for (const auto& file_name : file_names) {
+    original_files.emplace_back(file_name, false);
+    original_volume_files.push_back(
+        &original_files.back().get<h5::VolumeData>(subfile_name));
+  }
+
+  // Obtains list of observation ids to loop over. Assumes all volume files
+  // have the same observation ids
   const std::vector<size_t> observation_ids =
-      get_observation_ids(file_names, subfile_name);
+      original_volume_files.front()->list_observation_ids();
 
-  // Loops over observation ids to write volume data by observation id
-  for (size_t obs_index = 0; obs_index < observation_ids.size(); ++obs_index) {
+  // Loops over observation ids to write volume data by observation id. Only
+  // the observations of this process are combined.
+  for (size_t obs_index = process_index; obs_index < observation_ids.size();
+       obs_index += number_of_processes) {
     const size_t obs_id = observation_ids[obs_index];
     // Pre-calculates size of vector to store element data and allocates
     // corresponding memory
     const size_t vector_dim =
-        get_number_of_elements(file_names, subfile_name, obs_id);
+        get_number_of_elements(original_volume_files, obs_id);
     std::vector<ElementVolumeData> element_data;
     element_data.reserve(vector_dim);
 
@@ -107,20 +114,16 @@ void combine_h5(const std::vector<std::string>& file_names,
 
     // Loops over input files to append element data into a single vector to be
     // stored in a single H5
-    bool printed = false;
-    for (auto const& file_name : file_names) {
-      const h5::H5File<h5::AccessType::ReadOnly> original_file(file_name,
-                                                               false);
-      const auto& original_volume_file =
-          original_file.get<h5::VolumeData>(subfile_name);
+    for (size_t file_index = 0; file_index < file_names.size(); ++file_index) {
+      const auto& original_volume_file = *original_volume_files[file_index];
       obs_val = original_volume_file.get_observation_value(obs_id);
-      if (not printed) {
+      if (file_index == 0) {
         Parallel::printf(
             "Processing obsevation ID %lo (%lo/%lo) with value %1.14e\n",
             obs_id, obs_index, observation_ids.size(), obs_val);
-        printed = true;
       }
-      Parallel::printf("  Processing file: %s\n", file_name.c_str());
+      Parallel::printf("  Processing file: %s\n",
+                       file_names[file_index].c_str());
 
       serialized_domain = original_volume_file.get_domain(obs_id);
       serialized_functions_of_time =
@@ -128,25 +131,18 @@ void combine_h5(const std::vector<std::string>& file_names,
 
       // Get vector of element data for this `obs_id` and `file_name`
       std::vector<ElementVolumeData> data_by_element =
-          std::move(std::get<2>(original_volume_file.get_data_by_element(
-              obs_val * (1.0 - 4.0 * std::numeric_limits<double>::epsilon()),
-              obs_val * (1.0 + 4.0 * std::numeric_limits<double>::epsilon()),
-              std::nullopt)[0]));
+          original_volume_file.get_element_data(obs_id);
 
       // Append vector to total vector of element data for this `obs_id`
       element_data.insert(element_data.end(),
                           std::make_move_iterator(data_by_element.begin()),
                           std::make_move_iterator(data_by_element.end()));
-      data_by_element.clear();
-      original_file.close_current_object();
     }
 
-    h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
-    auto& new_volume_file = new_file.get<h5::VolumeData>(subfile_name);
     new_volume_file.write_volume_data(obs_id, obs_val, element_data,
                                       serialized_domain,
-                                      serialized_functions_of_time);
-    new_file.close_current_object();
+                                      serialized_functions_of_time,
+                                      compression);
   }
 }
 }  // namespace h5
@@ -3,13 +3,36 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
-namespace h5 {
+#include "IO/H5/Compression.hpp"
 
+namespace h5 {
+/*!
+ * \brief Combine the volume data subfile `subfile_name` of the per-node
+ * `file_names` into a single file `output`.
+ *
+ * The observers write one file per node because the runtime has no collective
+ * I/O: the nodes write independently, and the HDF5 library is not required to
+ * be built with MPI support. Each input file is opened once, so combining many
+ * observations costs one read per file and observation.
+ *
+ * The observations are streamed: only the data of one observation is held in
+ * memory at a time, and it is written with the `compression` before the next
+ * observation is read.
+ *
+ * To combine in parallel, run `number_of_processes` processes with different
+ * `process_index`. Each of them combines every `number_of_processes`-th
+ * observation, starting at the `process_index`-th, into its own `output`. The
+ * outputs hold disjoint sets of observations, so they can be used together by
+ * tools that take several volume files, like `generate-xdmf`.
+ */
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
-                const bool check_src = true);
+                bool check_src = true, size_t process_index = 0,
+                size_t number_of_processes = 1,
+                const Compression& compression = {});
 
 }  // namespace h5
@@ -0,0 +1,126 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/Compression.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <hdf5.h>
+#include <iterator>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace {
+bool filter_can_encode(const H5Z_filter_t filter) {
+  if (H5Zfilter_avail(filter) <= 0) {
+    return false;
+  }
+  unsigned int filter_info = 0;
+  const auto status = H5Zget_filter_info(filter, &filter_info);
+  return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
+         (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
+}
+}  // namespace
+
+namespace h5 {
+Compression::Compression(const size_t deflate_level_in, const bool shuffle_in,
+                         const size_t chunk_bytes_in,
+                         std::vector<unsigned int> plugin_filter_in)
+    : deflate_level(deflate_level_in),
+      shuffle(shuffle_in),
+      chunk_bytes(chunk_bytes_in),
+      plugin_filter(std::move(plugin_filter_in)) {}
+
+Compression Compression::none() { return {0, false, 131'072, {}}; }
+
+void Compression::pup(PUP::er& p) {
+  p | deflate_level;
+  p | shuffle;
+  p | chunk_bytes;
+  p | plugin_filter;
+}
+
+bool operator==(const Compression& lhs, const Compression& rhs) {
+  return lhs.deflate_level == rhs.deflate_level and
+         lhs.shuffle == rhs.shuffle and lhs.chunk_bytes == rhs.chunk_bytes and
+         lhs.plugin_filter == rhs.plugin_filter;
+}
+
+bool operator!=(const Compression& lhs, const Compression& rhs) {
+  return not(lhs == rhs);
+}
+
+namespace detail {
+hid_t compressed_dataset_properties(const Compression& compression,
+                                    const std::vector<size_t>& extents,
+                                    const size_t bytes_per_value,
+                                    const std::string& name) {
+  // Static so the filters are only queried once
+  static const bool deflate_available = filter_can_encode(H5Z_FILTER_DEFLATE);
+  static const bool shuffle_available = filter_can_encode(H5Z_FILTER_SHUFFLE);
+  const bool use_deflate = compression.deflate_level > 0 and deflate_available;
+  const bool use_plugin = not compression.plugin_filter.empty();
+  // Shuffling alone doesn't make the data smaller
+  const bool use_shuffle =
+      compression.shuffle and shuffle_available and (use_deflate or use_plugin);
+  // We can't compress a single number. Since there's not much to reduce
+  // anyway, we just skip compression.
+  if (extents.empty() or not(use_deflate or use_plugin)) {
+    return h5p_default();
+  }
+
+  if (use_plugin and
+      not filter_can_encode(
+          static_cast<H5Z_filter_t>(compression.plugin_filter.front()))) {
+    ERROR("The HDF5 filter with id "
+          << compression.plugin_filter.front() << " requested for dataset "
+          << name
+          << " is not available. Set HDF5_PLUGIN_PATH to the directory "
+             "containing the filter plugin.");
+  }
+
+  std::vector<hsize_t> chunk_size(extents.size());
+  const size_t values_per_chunk =
+      std::max(compression.chunk_bytes / bytes_per_value, size_t{1});
+  for (size_t i = 0; i < chunk_size.size(); ++i) {
+    chunk_size[i] = std::min(values_per_chunk, extents[i]);
+  }
+
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list");
+  if (use_shuffle) {
+    CHECK_H5(H5Pset_shuffle(property_list),
+             "Failed to enable shuffle filter on dataset " << name);
+  }
+  if (use_plugin) {
+    const auto filter_id =
+        static_cast<H5Z_filter_t>(compression.plugin_filter.front());
+    CHECK_H5(H5Pset_filter(property_list, filter_id, H5Z_FLAG_MANDATORY,
+                           compression.plugin_filter.size() - 1,
+                           std::next(compression.plugin_filter.data())),
+             "Failed to enable filter " << filter_id << " on dataset "
+                                        << name);
+  }
+  if (use_deflate) {
+    CHECK_H5(H5Pset_deflate(property_list, static_cast<unsigned int>(
+                                               compression.deflate_level)),
+             "Failed to enable gzip filter on dataset " << name);
+  }
+  CHECK_H5(H5Pset_chunk(property_list, static_cast<int>(chunk_size.size()),
+                        chunk_size.data()),
+           "Failed to set chunk size on dataset " << name);
+  CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
+           "Failed to disable setting default values on dataset creation for "
+           "dataset "
+               << name);
+  return property_list;
+}
+}  // namespace detail
+}  // namespace h5
@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <hdf5.h>
+#include <string>
+#include <vector>
+
+#include "Options/String.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief The chunk size and filters used to compress the datasets written by
+ * `h5::write_data`.
+ *
+ * The filters are applied in the order shuffle, plugin filter, deflate, and
+ * each can be disabled separately. Shuffle and deflate are built into HDF5
+ * and are skipped if the HDF5 library was built without them. A plugin filter,
+ * such as ZFP (id 32013) or Blosc (id 32001), must be found at runtime,
+ * typically through the `HDF5_PLUGIN_PATH` environment variable, and files
+ * written with it can only be read where the plugin is available too.
+ *
+ * The default compresses with shuffle and deflate level 5 in chunks of
+ * 128 KiB. The chunk size should be a power of two, because other sizes
+ * increase the compression overhead by about an order of magnitude.
+ */
+struct Compression {
+  struct DeflateLevel {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Compression level of the deflate (gzip) filter, from 1 (fastest) to 9 "
+        "(smallest). 0 disables the filter."};
+    static type upper_bound() { return 9; }
+  };
+  struct Shuffle {
+    using type = bool;
+    static constexpr Options::String help = {
+        "Reorder the bytes of the values before compressing them, which "
+        "usually improves the compression of floating-point data."};
+  };
+  struct ChunkBytes {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Target size of a chunk of a dataset in bytes. Should be a power of "
+        "two."};
+    static type lower_bound() { return 1; }
+  };
+  struct PluginFilter {
+    using type = std::vector<unsigned int>;
+    static constexpr Options::String help = {
+        "An HDF5 plugin filter to apply: its registered filter id followed by "
+        "its parameters, e.g., [32013, ...] for ZFP. An empty list disables "
+        "the filter."};
+  };
+  using options = tmpl::list<DeflateLevel, Shuffle, ChunkBytes, PluginFilter>;
+  static constexpr Options::String help = {
+      "Chunking and compression of the datasets written to HDF5 files."};
+
+  Compression() = default;
+  Compression(size_t deflate_level_in, bool shuffle_in, size_t chunk_bytes_in,
+              std::vector<unsigned int> plugin_filter_in = {});
+
+  /// Write contiguous, uncompressed datasets
+  static Compression none();
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+  size_t deflate_level{5};
+  bool shuffle{true};
+  size_t chunk_bytes{131'072};
+  std::vector<unsigned int> plugin_filter{};
+};
+
+bool operator==(const Compression& lhs, const Compression& rhs);
+bool operator!=(const Compression& lhs, const Compression& rhs);
+
+namespace detail {
+/*!
+ * \brief Create the dataset creation property list that chunks and compresses
+ * a dataset with `extents` holding values of `bytes_per_value` bytes.
+ *
+ * Returns `h5p_default()` if no filter is applied, in which case the dataset
+ * is contiguous. Otherwise the caller must close the property list.
+ */
+hid_t compressed_dataset_properties(const Compression& compression,
+                                    const std::vector<size_t>& extents,
+                                    size_t bytes_per_value,
+                                    const std::string& name);
+}  // namespace detail
+}  // namespace h5
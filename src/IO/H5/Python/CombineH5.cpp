@@ -3,18 +3,32 @@
 
 #include "IO/H5/Python/CombineH5.hpp"
 
+#include <cstddef>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <vector>
 
 #include "IO/H5/CombineH5.hpp"
+#include "IO/H5/Compression.hpp"
 
 namespace py = pybind11;
 
 namespace py_bindings {
 void bind_h5combine(py::module& m) {
   // Wrapper for combining h5 files
-  m.def("combine_h5", &h5::combine_h5, py::arg("file_names"),
-        py::arg("subfile_name"), py::arg("output"), py::arg("check_src"));
+  m.def(
+      "combine_h5",
+      [](const std::vector<std::string>& file_names,
+         const std::string& subfile_name, const std::string& output,
+         const bool check_src, const size_t process_index,
+         const size_t number_of_processes, const bool compress) {
+        h5::combine_h5(file_names, subfile_name, output, check_src,
+                       process_index, number_of_processes,
+                       compress ? h5::Compression{} : h5::Compression::none());
+      },
+      py::arg("file_names"), py::arg("subfile_name"), py::arg("output"),
+      py::arg("check_src"), py::arg("process_index") = 0,
+      py::arg("number_of_processes") = 1, py::arg("compress") = true);
 }
 }  // namespace py_bindings
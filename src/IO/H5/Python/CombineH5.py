@@ -1,8 +1,10 @@
 # Distributed under the MIT License.
 # See LICENSE.txt for details.
 
+import functools
 import logging
 import os
+from multiprocessing import Pool
 
 import click
 import rich
@@ -53,7 +55,28 @@ combine_h5_command.add_command(combine_h5_dat_command, name="dat")
         " checked, False implies no src files to check."
     ),
 )
-def combine_h5_vol_command(h5files, subfile_name, output, check_src):
+@click.option(
+    "-j",
+    "--num-jobs",
+    type=click.IntRange(min=1),
+    default=1,
+    show_default=True,
+    help=(
+        "Number of processes that combine the observations in parallel. With"
+        " more than one process, each writes a disjoint subset of the"
+        " observations to its own output file, numbered like the per-node"
+        " files (e.g. 'Volume0.h5', 'Volume1.h5', ...)."
+    ),
+)
+@click.option(
+    "--compress/--no-compress",
+    default=True,
+    show_default=True,
+    help="Compress the tensor components in the output file(s).",
+)
+def combine_h5_vol_command(
+    h5files, subfile_name, output, check_src, num_jobs, compress
+):
     """Combines volume data spread over multiple H5 files into a single file
 
     The typical use case is to combine volume data from multiple nodes into a
@@ -65,6 +88,11 @@ def combine_h5_vol_command(h5files, subfile_name, output, check_src):
     Note that this command does not currently combine volume data from different
     time steps (e.g. from multiple segments of a simulation). All input H5 files
     must contain the same set of observation IDs.
+
+    Only one observation is held in memory at a time. With '--num-jobs'
+    larger than one the observations are split between processes, each of
+    which writes its own output file. Commands like 'generate-xdmf' can
+    operate on these files just like on the per-node files.
     """
     # CLI scripts should be noops when input is empty
     if not h5files:
@@ -86,7 +114,46 @@ def combine_h5_vol_command(h5files, subfile_name, output, check_src):
     if not output.endswith(".h5"):
         output += ".h5"
 
-    spectre_h5.combine_h5(h5files, subfile_name, output, check_src)
+    if num_jobs == 1:
+        spectre_h5.combine_h5(
+            h5files, subfile_name, output, check_src, compress=compress
+        )
+        return
+
+    output_prefix = output[:-3]
+    with Pool(num_jobs) as p:
+        p.map(
+            functools.partial(
+                _combine_part,
+                h5files=h5files,
+                subfile_name=subfile_name,
+                output_prefix=output_prefix,
+                check_src=check_src,
+                num_jobs=num_jobs,
+                compress=compress,
+            ),
+            range(num_jobs),
+        )
+
+
+def _combine_part(
+    process_index,
+    h5files,
+    subfile_name,
+    output_prefix,
+    check_src,
+    num_jobs,
+    compress,
+):
+    spectre_h5.combine_h5(
+        h5files,
+        subfile_name,
+        f"{output_prefix}{process_index}.h5",
+        check_src,
+        process_index=process_index,
+        number_of_processes=num_jobs,
+        compress=compress,
+    )
 
 
 if __name__ == "__main__":
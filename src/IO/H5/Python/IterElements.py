@@ -6,8 +6,6 @@ from dataclasses import dataclass
 from functools import cached_property
 from typing import Dict, Iterable, Optional, Sequence, Union
 
-import numpy as np
-
 import spectre.IO.H5 as spectre_h5
 from spectre.DataStructures.Tensor.EagerMath import determinant
 from spectre.Domain import (
@@ -177,11 +175,8 @@ def iter_elements(
             # Pre-load the tensor data because it's stored contiguously for all
             # grids in the file
             if tensor_components:
-                tensor_data = np.asarray(
-                    [
-                        volfile.get_tensor_component(obs_id, component).data
-                        for component in tensor_components
-                    ]
+                tensor_data = volfile.get_tensor_components_array(
+                    obs_id, tensor_components
                 )
             # Iterate elements in this file
             for grid_name, element_id, mesh in zip(
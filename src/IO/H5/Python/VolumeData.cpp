@@ -3,9 +3,18 @@
 
 #include "IO/H5/Python/VolumeData.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
@@ -14,6 +23,21 @@
 namespace py = pybind11;
 
 namespace py_bindings {
+namespace {
+// Moves the data read from the file into a NumPy array without copying it.
+// The array owns the data and frees it when it is garbage collected.
+template <typename Container>
+py::array owning_array(Container&& data) {
+  using value_type = typename std::decay_t<Container>::value_type;
+  auto* const owned = new std::decay_t<Container>(std::move(data));
+  const py::capsule free_when_done(owned, [](void* const ptr) {
+    delete static_cast<std::decay_t<Container>*>(ptr);
+  });
+  return py::array_t<value_type>({owned->size()}, {sizeof(value_type)},
+                                 owned->data(), free_when_done);
+}
+}  // namespace
+
 void bind_h5vol(py::module& m) {
   // Wrapper for basic H5VolumeData operations
   py::class_<h5::VolumeData>(m, "H5Vol")
@@ -21,10 +45,27 @@ void bind_h5vol(py::module& m) {
       .def("get_header", &h5::VolumeData::get_header)
       .def("get_version", &h5::VolumeData::get_version)
       .def("get_dimension", &h5::VolumeData::get_dimension)
-      .def("write_volume_data", &h5::VolumeData::write_volume_data,
-           py::arg("observation_id"), py::arg("observation_value"),
-           py::arg("elements"), py::arg("serialized_domain") = std::nullopt,
-           py::arg("serialized_functions_of_time") = std::nullopt)
+      .def(
+          "write_volume_data",
+          [](h5::VolumeData& volume_file, const size_t observation_id,
+             const double observation_value,
+             const std::vector<ElementVolumeData>& elements,
+             const std::optional<std::vector<char>>& serialized_domain,
+             const std::optional<std::vector<char>>&
+                 serialized_functions_of_time,
+             const bool write_connectivity) {
+            volume_file.write_volume_data(
+                observation_id, observation_value, elements, serialized_domain,
+                serialized_functions_of_time, {}, write_connectivity);
+          },
+          py::arg("observation_id"), py::arg("observation_value"),
+          py::arg("elements"), py::arg("serialized_domain") = std::nullopt,
+          py::arg("serialized_functions_of_time") = std::nullopt,
+          py::arg("write_connectivity") = true)
+      .def("has_connectivity", &h5::VolumeData::has_connectivity,
+           py::arg("observation_id"))
+      .def("generate_connectivity", &h5::VolumeData::generate_connectivity,
+           py::arg("observation_id"))
       .def("write_tensor_component",
            py::overload_cast<size_t, const std::string&, const DataVector&,
                              bool>(&h5::VolumeData::write_tensor_component),
@@ -40,6 +81,54 @@ void bind_h5vol(py::module& m) {
            py::arg("observation_id"))
       .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def(
+          "get_tensor_component_array",
+          [](const h5::VolumeData& volume_file, const size_t observation_id,
+             const std::string& tensor_component) {
+            auto component =
+                volume_file.get_tensor_component(observation_id,
+                                                 tensor_component);
+            return std::visit(
+                [](auto& data) { return owning_array(std::move(data)); },
+                component.data);
+          },
+          py::arg("observation_id"), py::arg("tensor_component"),
+          "Read a tensor component into a 1D NumPy array without copying it. "
+          "The dtype is the precision the component is stored with.")
+      .def(
+          "get_tensor_components_array",
+          [](const h5::VolumeData& volume_file, const size_t observation_id,
+             const std::vector<std::string>& tensor_components) {
+            // Only the components that are requested are read, one at a time,
+            // and each is copied straight into its row of the result.
+            if (tensor_components.empty()) {
+              return py::array_t<double>(std::vector<size_t>{0, 0});
+            }
+            std::optional<py::array_t<double>> result{};
+            for (size_t i = 0; i < tensor_components.size(); ++i) {
+              std::visit(
+                  [&result, &i, &tensor_components](const auto& data) {
+                    if (not result.has_value()) {
+                      result = py::array_t<double>(
+                          {tensor_components.size(), data.size()});
+                    }
+                    if (static_cast<size_t>(result->shape(1)) != data.size()) {
+                      throw std::invalid_argument(
+                          "The tensor components have different sizes.");
+                    }
+                    std::copy(data.begin(), data.end(),
+                              result->mutable_data(i, 0));
+                  },
+                  volume_file
+                      .get_tensor_component(observation_id,
+                                            tensor_components[i])
+                      .data);
+            }
+            return std::move(*result);
+          },
+          py::arg("observation_id"), py::arg("tensor_components"),
+          "Read the tensor components into a 2D NumPy array of doubles with "
+          "one row per component.")
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
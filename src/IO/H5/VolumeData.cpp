@@ -13,11 +13,13 @@
 #include <optional>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/ExtendConnectivityHelpers.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
@@ -43,24 +45,17 @@
 
 namespace h5 {
 namespace {
-// Append the element extents and connectevity to the total extents and
-// connectivity
-void append_element_extents_and_connectivity(
-    const gsl::not_null<std::vector<size_t>*> total_extents,
+// Append the connectivity of a grid with the `extents` and `basis` to the
+// total connectivity
+void append_grid_connectivity(
     const gsl::not_null<std::vector<int>*> total_connectivity,
     const gsl::not_null<std::vector<int>*> pole_connectivity,
-    const gsl::not_null<int*> total_points_so_far, const size_t dim,
-    const ElementVolumeData& element) {
-  // Process the element extents
-  const auto& extents = element.extents;
+    const gsl::not_null<int*> total_points_so_far,
+    const std::vector<size_t>& extents,
+    const std::vector<Spectral::Basis>& basis) {
+  const size_t dim = extents.size();
   ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 1; }),
          "We cannot generate connectivity for any single grid point elements.");
-  if (extents.size() != dim) {
-    ERROR("Trying to write data of dimensionality"
-          << extents.size() << "but the VolumeData file has dimensionality"
-          << dim << ".");
-  }
-  total_extents->insert(total_extents->end(), extents.begin(), extents.end());
   // Find the number of points in the local connectivity
   const int element_num_points =
       alg::accumulate(extents, 1, std::multiplies<>{});
@@ -84,10 +79,10 @@ void append_element_extents_and_connectivity(
   // If element is 2D and the bases are both SphericalHarmonic,
   // then add extra connections to close the surface.
   if (dim == 2) {
-    if (element.basis[0] == Spectral::Basis::SphericalHarmonic and
-        element.basis[1] == Spectral::Basis::SphericalHarmonic) {
+    if (basis[0] == Spectral::Basis::SphericalHarmonic and
+        basis[1] == Spectral::Basis::SphericalHarmonic) {
       // Extents are (l+1, 2l+1)
-      const size_t l = element.extents[0] - 1;
+      const size_t l = extents[0] - 1;
 
       // Connect max(phi) and min(phi) by adding more quads
       // to total_connectivity
@@ -164,6 +159,22 @@ void append_element_extents_and_connectivity(
   }
 }
 
+
+void write_connectivity_datasets(const hid_t observation_group_id,
+                                 const std::vector<int>& total_connectivity,
+                                 const std::vector<int>& pole_connectivity) {
+  h5::write_data(observation_group_id, total_connectivity,
+                 {total_connectivity.size()}, "connectivity");
+  // Note: pole_connectivity stores extra connections that define triangles to
+  // fill in the poles on a Strahlkorper and is empty if not outputting
+  // Strahlkorper surface data. Because these connections define triangles
+  // and not quadrilaterals, they are stored separately instead of just being
+  // included in total_connectivity.
+  if (not pole_connectivity.empty()) {
+    h5::write_data(observation_group_id, pole_connectivity,
+                   {pole_connectivity.size()}, "pole_connectivity");
+  }
+}
 }  // namespace
 
 VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
@@ -208,7 +219,8 @@ void VolumeData::write_volume_data(
     const size_t observation_id, const double observation_value,
     const std::vector<ElementVolumeData>& elements,
     const std::optional<std::vector<char>>& serialized_domain,
-    const std::optional<std::vector<char>>& serialized_functions_of_time) {
+    const std::optional<std::vector<char>>& serialized_functions_of_time,
+    const Compression& compression, const bool write_connectivity) {
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
@@ -267,10 +279,10 @@ void VolumeData::write_volume_data(
     }
 
     const auto fill_and_write_contiguous_tensor_data =
-        [&bases, &component_name, &dim, &elements, &grid_names, i,
-         &observation_group, &quadratures, &total_connectivity,
-         &pole_connectivity, &total_extents,
-         &total_points_so_far](const auto contiguous_tensor_data_ptr) {
+        [&bases, &component_name, &compression, &dim, &elements, &grid_names,
+         i, &observation_group, &quadratures, &total_connectivity,
+         &pole_connectivity, &total_extents, &total_points_so_far,
+         &write_connectivity](const auto contiguous_tensor_data_ptr) {
           for (const auto& element : elements) {
             if (UNLIKELY(i == 0)) {
               // True if first tensor component being accessed
@@ -286,9 +298,21 @@ void VolumeData::write_volume_data(
                                return static_cast<int>(t);
                              });
 
-              append_element_extents_and_connectivity(
-                  &total_extents, &total_connectivity, &pole_connectivity,
-                  &total_points_so_far, dim, element);
+              if (element.extents.size() != dim) {
+                ERROR("Trying to write data of dimensionality"
+                      << element.extents.size()
+                      << "but the VolumeData file has dimensionality" << dim
+                      << ".");
+              }
+              total_extents.insert(total_extents.end(),
+                                   element.extents.begin(),
+                                   element.extents.end());
+              if (write_connectivity) {
+                append_grid_connectivity(&total_connectivity,
+                                         &pole_connectivity,
+                                         &total_points_so_far, element.extents,
+                                         element.basis);
+              }
             }
             using type_from_variant = tmpl::conditional_t<
                 std::is_same_v<
@@ -303,7 +327,8 @@ void VolumeData::write_volume_data(
                     .end());
           }  // for each element
           h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
-                         {contiguous_tensor_data_ptr->size()}, component_name);
+                         {contiguous_tensor_data_ptr->size()}, component_name,
+                         false, compression);
         };
 
     if (elements[0].tensor_components[i].data.index() == 0) {
@@ -349,16 +374,9 @@ void VolumeData::write_volume_data(
                               observation_group);
   h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
   // Write the Connectivity
-  h5::write_data(observation_group.id(), total_connectivity,
-                 {total_connectivity.size()}, "connectivity");
-  // Note: pole_connectivity stores extra connections that define triangles to
-  // fill in the poles on a Strahlkorper and is empty if not outputting
-  // Strahlkorper surface data. Because these connections define triangles
-  // and not quadrilaterals, they are stored separately instead of just being
-  // included in total_connectivity.
-  if (not pole_connectivity.empty()) {
-    h5::write_data(observation_group.id(), pole_connectivity,
-                   {pole_connectivity.size()}, "pole_connectivity");
+  if (write_connectivity) {
+    write_connectivity_datasets(observation_group.id(), total_connectivity,
+                                pole_connectivity);
   }
   // Write the serialized domain
   if (serialized_domain.has_value()) {
@@ -372,6 +390,35 @@ void VolumeData::write_volume_data(
   }
 }
 
+bool VolumeData::has_connectivity(const size_t observation_id) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  return h5::contains_dataset_or_group(observation_group.id(), "",
+                                       "connectivity");
+}
+
+void VolumeData::generate_connectivity(const size_t observation_id) {
+  if (has_connectivity(observation_id)) {
+    return;
+  }
+  const auto all_extents = get_extents(observation_id);
+  const auto all_bases = get_bases(observation_id);
+  std::vector<int> total_connectivity{};
+  std::vector<int> pole_connectivity{};
+  int total_points_so_far = 0;
+  for (size_t i = 0; i < all_extents.size(); ++i) {
+    append_grid_connectivity(&total_connectivity, &pole_connectivity,
+                             &total_points_so_far, all_extents[i],
+                             all_bases[i]);
+  }
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadWrite);
+  write_connectivity_datasets(observation_group.id(), total_connectivity,
+                              pole_connectivity);
+}
+
 // Write new connectivity connections given a std::vector of observation ids
 template <size_t SpatialDim>
 void VolumeData::extend_connectivity_data(
@@ -556,6 +603,29 @@ std::pair<size_t, size_t> offset_and_length_for_grid(
   }
 }
 
+std::unordered_map<std::string, GridLocation> locations_of_grids(
+    const std::vector<std::string>& all_grid_names,
+    const std::vector<std::vector<size_t>>& all_extents) {
+  ASSERT(all_grid_names.size() == all_extents.size(),
+         "Got " << all_grid_names.size() << " grid names but "
+                << all_extents.size() << " extents.");
+  std::unordered_map<std::string, GridLocation> locations{};
+  locations.reserve(all_grid_names.size());
+  size_t offset = 0;
+  for (size_t i = 0; i < all_grid_names.size(); ++i) {
+    const size_t length =
+        alg::accumulate(all_extents[i], 1_st, std::multiplies<>{});
+    const bool inserted =
+        locations.emplace(all_grid_names[i], GridLocation{i, offset, length})
+            .second;
+    if (not inserted) {
+      ERROR("The grid name '" << all_grid_names[i] << "' is not unique.");
+    }
+    offset += length;
+  }
+  return locations;
+}
+
 auto VolumeData::get_data_by_element(
     const std::optional<double> start_observation_value,
     const std::optional<double> end_observation_value,
@@ -595,77 +665,82 @@ auto VolumeData::get_data_by_element(
 
   // Retrieve element data and insert into result
   for (auto& single_time_data : result) {
-    const auto known_components =
-        list_tensor_components(std::get<0>(single_time_data));
-
-    std::vector<ElementVolumeData> element_volume_data{};
-    const auto grid_names = get_grid_names(std::get<0>(single_time_data));
-    const auto extents = get_extents(std::get<0>(single_time_data));
-    const auto bases = get_bases(std::get<0>(single_time_data));
-    const auto quadratures = get_quadratures(std::get<0>(single_time_data));
-    element_volume_data.reserve(grid_names.size());
-
-    const auto& component_names =
-        components_to_retrieve.value_or(known_components);
-    std::vector<TensorComponent> tensors{};
-    tensors.reserve(grid_names.size());
-    for (const std::string& component : component_names) {
-      if (not alg::found(known_components, component)) {
-        using ::operator<<;  // STL streams
-        ERROR("Could not find tensor component '"
-              << component
-              << "' in file. Known components are: " << known_components);
-      }
-      tensors.emplace_back(
-          get_tensor_component(std::get<0>(single_time_data), component));
-    }
-    // Now split the data by element
-    for (size_t grid_index = 0, offset = 0; grid_index < grid_names.size();
-         ++grid_index) {
-      const size_t mesh_size =
-          alg::accumulate(extents[grid_index], 1_st, std::multiplies<>{});
-      std::vector<TensorComponent> tensor_components{tensors.size()};
-      for (size_t component_index = 0; component_index < tensors.size();
-           ++component_index) {
-        std::visit(
-            [component_index, &component_names, mesh_size, offset,
-             &tensor_components](const auto& tensor_component_data) {
-              std::decay_t<decltype(tensor_component_data)> component(
-                  mesh_size);
-              std::copy(
-                  std::next(tensor_component_data.begin(),
-                            static_cast<std::ptrdiff_t>(offset)),
-                  std::next(tensor_component_data.begin(),
-                            static_cast<std::ptrdiff_t>(offset + mesh_size)),
-                  component.begin());
-              tensor_components[component_index] = TensorComponent{
-                  component_names[component_index], std::move(component)};
-            },
-            tensors[component_index].data);
-      }
-
-      // Sort the tensor components by name so that they are in the same order
-      // in all elements.
-      alg::sort(tensor_components, [](const auto& lhs, const auto& rhs) {
-        return lhs.name < rhs.name;
-      });
-
-      element_volume_data.emplace_back(
-          grid_names[grid_index], std::move(tensor_components),
-          extents[grid_index], bases[grid_index], quadratures[grid_index]);
-      offset += mesh_size;
-    }  // for grid_index
-
-    // Sort the elements so they are in the same order at all time steps
-    alg::sort(element_volume_data,
-              [](const ElementVolumeData& lhs, const ElementVolumeData& rhs) {
-                return lhs.element_name < rhs.element_name;
-              });
-    std::get<2>(single_time_data) = std::move(element_volume_data);
+    std::get<2>(single_time_data) = get_element_data(
+        std::get<0>(single_time_data), components_to_retrieve);
   }
   return result;
 }
 
+std::vector<ElementVolumeData> VolumeData::get_element_data(
+    const size_t observation_id,
+    const std::optional<std::vector<std::string>>& components_to_retrieve)
+    const {
+  const auto known_components = list_tensor_components(observation_id);
+
+  std::vector<ElementVolumeData> element_volume_data{};
+  const auto grid_names = get_grid_names(observation_id);
+  const auto extents = get_extents(observation_id);
+  const auto bases = get_bases(observation_id);
+  const auto quadratures = get_quadratures(observation_id);
+  element_volume_data.reserve(grid_names.size());
+
+  const auto& component_names =
+      components_to_retrieve.value_or(known_components);
+  std::vector<TensorComponent> tensors{};
+  tensors.reserve(grid_names.size());
+  for (const std::string& component : component_names) {
+    if (not alg::found(known_components, component)) {
+      using ::operator<<;  // STL streams
+      ERROR("Could not find tensor component '"
+            << component
+            << "' in file. Known components are: " << known_components);
+    }
+    tensors.emplace_back(get_tensor_component(observation_id, component));
+  }
+  // Now split the data by element
+  for (size_t grid_index = 0, offset = 0; grid_index < grid_names.size();
+       ++grid_index) {
+    const size_t mesh_size =
+        alg::accumulate(extents[grid_index], 1_st, std::multiplies<>{});
+    std::vector<TensorComponent> tensor_components{tensors.size()};
+    for (size_t component_index = 0; component_index < tensors.size();
+         ++component_index) {
+      std::visit(
+          [component_index, &component_names, mesh_size, offset,
+           &tensor_components](const auto& tensor_component_data) {
+            std::decay_t<decltype(tensor_component_data)> component(mesh_size);
+            std::copy(
+                std::next(tensor_component_data.begin(),
+                          static_cast<std::ptrdiff_t>(offset)),
+                std::next(tensor_component_data.begin(),
+                          static_cast<std::ptrdiff_t>(offset + mesh_size)),
+                component.begin());
+            tensor_components[component_index] = TensorComponent{
+                component_names[component_index], std::move(component)};
+          },
+          tensors[component_index].data);
+    }
+
+    // Sort the tensor components by name so that they are in the same order
+    // in all elements.
+    alg::sort(tensor_components, [](const auto& lhs, const auto& rhs) {
+      return lhs.name < rhs.name;
+    });
+
+    element_volume_data.emplace_back(
+        grid_names[grid_index], std::move(tensor_components),
+        extents[grid_index], bases[grid_index], quadratures[grid_index]);
+    offset += mesh_size;
+  }  // for grid_index
+
+  // Sort the elements so they are in the same order at all time steps
+  alg::sort(element_volume_data,
+            [](const ElementVolumeData& lhs, const ElementVolumeData& rhs) {
+              return lhs.element_name < rhs.element_name;
+            });
+  return element_volume_data;
+}
+
 size_t VolumeData::get_dimension() const {
   return h5::read_value_attribute<double>(volume_data_group_.id(), "dimension");
 }
@@ -752,37 +827,51 @@ Mesh<Dim> mesh_for_grid(
   if (found_grid_name == all_grid_names.end()) {
     ERROR("Found no grid named '" + grid_name + "'.");
   } else {
-    const auto element_index =
-        std::distance(all_grid_names.begin(), found_grid_name);
-    const auto& extents = gsl::at(all_extents, element_index);
-    const auto& bases = gsl::at(all_bases, element_index);
-    const auto& quadratures = gsl::at(all_quadratures, element_index);
-    ASSERT(extents.size() == Dim, "Extents in " << Dim << "D should have size "
-                                                << Dim << ", but found size "
-                                                << extents.size() << ".");
-    ASSERT(bases.size() == Dim, "Bases in " << Dim << "D should have size "
-                                            << Dim << ", but found size "
-                                            << bases.size() << ".");
-    ASSERT(quadratures.size() == Dim, "Quadratures in "
-                                          << Dim << "D should have size " << Dim
-                                          << ", but found size "
-                                          << quadratures.size() << ".");
-    return Mesh<Dim>{make_array<size_t, Dim>(extents),
-                     make_array<Spectral::Basis, Dim>(bases),
-                     make_array<Spectral::Quadrature, Dim>(quadratures)};
+    return mesh_for_grid<Dim>(
+        static_cast<size_t>(
+            std::distance(all_grid_names.begin(), found_grid_name)),
+        all_extents, all_bases, all_quadratures);
   }
 }
 
+template <size_t Dim>
+Mesh<Dim> mesh_for_grid(
+    const size_t grid_index,
+    const std::vector<std::vector<size_t>>& all_extents,
+    const std::vector<std::vector<Spectral::Basis>>& all_bases,
+    const std::vector<std::vector<Spectral::Quadrature>>& all_quadratures) {
+  const auto& extents = all_extents.at(grid_index);
+  const auto& bases = all_bases.at(grid_index);
+  const auto& quadratures = all_quadratures.at(grid_index);
+  ASSERT(extents.size() == Dim, "Extents in " << Dim << "D should have size "
+                                              << Dim << ", but found size "
+                                              << extents.size() << ".");
+  ASSERT(bases.size() == Dim, "Bases in " << Dim << "D should have size "
+                                          << Dim << ", but found size "
+                                          << bases.size() << ".");
+  ASSERT(quadratures.size() == Dim, "Quadratures in "
+                                        << Dim << "D should have size " << Dim
+                                        << ", but found size "
+                                        << quadratures.size() << ".");
+  return Mesh<Dim>{make_array<size_t, Dim>(extents),
+                   make_array<Spectral::Basis, Dim>(bases),
+                   make_array<Spectral::Quadrature, Dim>(quadratures)};
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                                         \
-  template void h5::VolumeData::extend_connectivity_data<DIM(data)>( \
-      const std::vector<size_t>& observation_ids);                   \
-  template Mesh<DIM(data)> mesh_for_grid(                            \
-      const std::string& grid_name,                                  \
-      const std::vector<std::string>& all_grid_names,                \
-      const std::vector<std::vector<size_t>>& all_extents,           \
-      const std::vector<std::vector<Spectral::Basis>>& all_bases,    \
+#define INSTANTIATE(_, data)                                                  \
+  template void h5::VolumeData::extend_connectivity_data<DIM(data)>(          \
+      const std::vector<size_t>& observation_ids);                            \
+  template Mesh<DIM(data)> mesh_for_grid(                                     \
+      const std::string& grid_name,                                           \
+      const std::vector<std::string>& all_grid_names,                         \
+      const std::vector<std::vector<size_t>>& all_extents,                    \
+      const std::vector<std::vector<Spectral::Basis>>& all_bases,             \
+      const std::vector<std::vector<Spectral::Quadrature>>& all_quadratures); \
+  template Mesh<DIM(data)> mesh_for_grid(                                     \
+      size_t grid_index, const std::vector<std::vector<size_t>>& all_extents, \
+      const std::vector<std::vector<Spectral::Basis>>& all_bases,             \
       const std::vector<std::vector<Spectral::Quadrature>>& all_quadratures);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
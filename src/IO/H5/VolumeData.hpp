@@ -8,9 +8,11 @@
 #include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -109,13 +111,27 @@ class VolumeData : public h5::Object {
 
   /// Insert tensor components at `observation_id` with floating point value
   /// `observation_value`. Optionally write a serialized representation of the
-  /// domain and the functions of time into the subfile as well.
+  /// domain and the functions of time into the subfile as well. The tensor
+  /// components are chunked and compressed as specified by `compression`.
+  ///
+  /// The connectivity is only needed for visualization. If
+  /// `write_connectivity` is `false` it is not computed or stored, and can be
+  /// generated later from the stored extents with `generate_connectivity`.
   void write_volume_data(
       size_t observation_id, double observation_value,
       const std::vector<ElementVolumeData>& elements,
       const std::optional<std::vector<char>>& serialized_domain = std::nullopt,
       const std::optional<std::vector<char>>& serialized_functions_of_time =
-          std::nullopt);
+          std::nullopt,
+      const Compression& compression = {}, bool write_connectivity = true);
+
+  /// Whether the connectivity of the observation `observation_id` is stored
+  bool has_connectivity(size_t observation_id) const;
+
+  /// Compute the connectivity of the observation `observation_id` from the
+  /// stored extents and bases and write it, unless it is already stored. The
+  /// result is the same as if it had been written by `write_volume_data`.
+  void generate_connectivity(size_t observation_id);
 
   /// Overwrites the current connectivity dataset with a new one. This new
   /// connectivity dataset builds connectivity within each block in the domain
@@ -190,6 +206,17 @@ class VolumeData : public h5::Object {
       -> std::vector<
           std::tuple<size_t, double, std::vector<ElementVolumeData>>>;
 
+  /// \brief Read the tensor components of all elements at the observation
+  /// `observation_id`, sorted by element name.
+  ///
+  /// Unlike `get_data_by_element` this does not look up the observation values
+  /// of all observations, so it is the cheaper choice when the observations
+  /// are processed one at a time.
+  std::vector<ElementVolumeData> get_element_data(
+      size_t observation_id,
+      const std::optional<std::vector<std::string>>& components_to_retrieve =
+          std::nullopt) const;
+
   /// Read the dimensionality of the grids.  Note : This is the dimension of
   /// the grids as manifolds, not the dimension of the embedding space.  For
   /// example, the volume data of a sphere is 2-dimensional, even though
@@ -253,6 +280,32 @@ std::pair<size_t, size_t> offset_and_length_for_grid(
     const std::vector<std::string>& all_grid_names,
     const std::vector<std::vector<size_t>>& all_extents);
 
+/*!
+ * \ingroup HDF5Group
+ * \brief The position of a grid in the lists returned by
+ * `h5::VolumeData::get_grid_names` and `h5::VolumeData::get_extents`, and the
+ * part of the contiguous datasets that holds its data.
+ */
+struct GridLocation {
+  size_t index;
+  size_t offset;
+  size_t length;
+};
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Find the `h5::GridLocation` of every grid in an observation at once.
+ *
+ * This takes linear time in the number of grids, whereas every call to
+ * `h5::offset_and_length_for_grid` does, so use this function when looking up
+ * many grids, e.g., all elements on a node. Grid names must be unique.
+ *
+ * \see `h5::offset_and_length_for_grid`
+ */
+std::unordered_map<std::string, GridLocation> locations_of_grids(
+    const std::vector<std::string>& all_grid_names,
+    const std::vector<std::vector<size_t>>& all_extents);
+
 template <size_t Dim>
 Mesh<Dim> mesh_for_grid(
     const std::string& grid_name,
@@ -261,4 +314,12 @@ Mesh<Dim> mesh_for_grid(
     const std::vector<std::vector<Spectral::Basis>>& all_bases,
     const std::vector<std::vector<Spectral::Quadrature>>& all_quadratures);
 
+/// The mesh of the grid at position `grid_index` in the lists of the
+/// observation, e.g., the `h5::GridLocation::index`.
+template <size_t Dim>
+Mesh<Dim> mesh_for_grid(
+    size_t grid_index, const std::vector<std::vector<size_t>>& all_extents,
+    const std::vector<std::vector<Spectral::Basis>>& all_bases,
+    const std::vector<std::vector<Spectral::Quadrature>>& all_quadratures);
+
 }  // namespace h5
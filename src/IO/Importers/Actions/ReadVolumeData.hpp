@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -192,48 +196,87 @@ void verify_inertial_coordinates(
   }
 }
 
-// Interpolate only the `selected_fields` in `source_element_data` to the
-// `target_logical_coords`.
+// Interpolate only the `selected_fields` of the source element whose data is
+// at `source_element_data_offset_and_length` in `all_tensor_data` to the
+// `target_logical_coords`. The selected tensor components of the source
+// element are gathered into one contiguous buffer, so they are interpolated
+// together with a single matrix multiplication.
 template <typename FieldTagsList, size_t Dim>
 void interpolate_selected_fields(
     const gsl::not_null<tuples::tagged_tuple_from_typelist<FieldTagsList>*>
         target_element_data,
-    const tuples::tagged_tuple_from_typelist<FieldTagsList>&
-        source_element_data,
+    const tuples::tagged_tuple_from_typelist<FieldTagsList>& all_tensor_data,
+    const std::pair<size_t, size_t>& source_element_data_offset_and_length,
     const Mesh<Dim>& source_mesh,
     const tnsr::I<DataVector, Dim, Frame::ElementLogical>&
         target_logical_coords,
     const std::vector<size_t>& offsets,
     const tuples::tagged_tuple_from_typelist<
         db::wrap_tags_in<Tags::Selected, FieldTagsList>>& selected_fields) {
+  const size_t source_offset = source_element_data_offset_and_length.first;
+  const size_t source_num_points =
+      source_element_data_offset_and_length.second;
   const intrp::Irregular<Dim> interpolator{source_mesh, target_logical_coords};
   const size_t target_num_points = target_logical_coords.begin()->size();
   ASSERT(target_num_points == offsets.size(),
          "The number of target points ("
              << target_num_points << ") must match the number of offsets ("
              << offsets.size() << ").");
-  DataVector target_tensor_component_buffer{target_num_points};
-  tmpl::for_each<FieldTagsList>([&source_element_data, &target_element_data,
-                                 &interpolator, &target_tensor_component_buffer,
-                                 &selected_fields, &offsets](auto field_tag_v) {
+  ASSERT(source_num_points == source_mesh.number_of_grid_points(),
+         "The number of source points ("
+             << source_num_points << ") must match the source mesh "
+             << source_mesh);
+
+  // Gather the selected components of the source element
+  size_t number_of_components = 0;
+  tmpl::for_each<FieldTagsList>(
+      [&number_of_components, &selected_fields](auto field_tag_v) {
+        using field_tag = tmpl::type_from<decltype(field_tag_v)>;
+        if (get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
+          number_of_components += field_tag::type::size();
+        }
+      });
+  if (number_of_components == 0) {
+    return;
+  }
+  DataVector source_buffer{source_num_points * number_of_components};
+  size_t component_index = 0;
+  tmpl::for_each<FieldTagsList>([&source_buffer, &component_index,
+                                 &all_tensor_data, &selected_fields,
+                                 &source_offset,
+                                 &source_num_points](auto field_tag_v) {
     using field_tag = tmpl::type_from<decltype(field_tag_v)>;
-    const auto& selection = get<Tags::Selected<field_tag>>(selected_fields);
-    if (not selection.has_value()) {
+    if (not get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
+      return;
+    }
+    for (const DataVector& component : get<field_tag>(all_tensor_data)) {
+      std::copy(component.data() + source_offset,
+                component.data() + source_offset + source_num_points,
+                source_buffer.data() + component_index * source_num_points);
+      ++component_index;
+    }
+  });
+
+  DataVector target_buffer{};
+  interpolator.interpolate(make_not_null(&target_buffer), source_buffer,
+                           number_of_components);
+
+  // Fill target element data at corresponding offsets
+  component_index = 0;
+  tmpl::for_each<FieldTagsList>([&target_element_data, &target_buffer,
+                                 &component_index, &selected_fields, &offsets,
+                                 &target_num_points](auto field_tag_v) {
+    using field_tag = tmpl::type_from<decltype(field_tag_v)>;
+    if (not get<Tags::Selected<field_tag>>(selected_fields).has_value()) {
       return;
     }
-    const auto& source_tensor_data = get<field_tag>(source_element_data);
-    auto& target_tensor_data = get<field_tag>(*target_element_data);
-    // Iterate independent components of the tensor
-    for (size_t i = 0; i < source_tensor_data.size(); ++i) {
-      const DataVector& source_tensor_component = source_tensor_data[i];
-      DataVector& target_tensor_component = target_tensor_data[i];
-      // Interpolate
-      interpolator.interpolate(make_not_null(&target_tensor_component_buffer),
-                               source_tensor_component);
-      // Fill target element data at corresponding offsets
-      for (size_t j = 0; j < target_tensor_component_buffer.size(); ++j) {
-        target_tensor_component[offsets[j]] = target_tensor_component_buffer[j];
+    for (DataVector& component : get<field_tag>(*target_element_data)) {
+      const double* const interpolated_component =
+          target_buffer.data() + component_index * target_num_points;
+      for (size_t j = 0; j < target_num_points; ++j) {
+        component[offsets[j]] = interpolated_component[j];
       }
+      ++component_index;
     }
   });
 }
@@ -467,6 +510,11 @@ struct ReadAllVolumeDataAndDistribute {
                     return all_observation_ids.front();
                   case ObservationSelector::Last:
                     return all_observation_ids.back();
+                  case ObservationSelector::All:
+                    ERROR_NO_TRACE(
+                        "Reading all observations at once is not supported. "
+                        "Select a single observation value, or 'First' or "
+                        "'Last'.");
                   default:
                     ERROR("Unknown importers::ObservationSelector: "
                           << local_obs_selector);
@@ -498,14 +546,24 @@ struct ReadAllVolumeDataAndDistribute {
       const auto source_bases = volume_file.get_bases(observation_id);
       const auto source_quadratures =
           volume_file.get_quadratures(observation_id);
-      std::vector<ElementId<Dim>> source_element_ids{};
+      // Index the grids once so looking up the registered elements takes
+      // constant time per element
+      const auto source_grid_locations =
+          h5::locations_of_grids(source_grid_names, source_extents);
+      // Spatial index of the source elements in this file, so the source
+      // element that contains each target point is computed directly from the
+      // block logical coordinates of the point
+      ElementLocator<Dim> source_element_locator{};
       if (enable_interpolation) {
         // Need to parse all source grid names to element IDs only if
         // interpolation is enabled
+        std::vector<ElementId<Dim>> source_element_ids{};
         source_element_ids.reserve(source_grid_names.size());
         for (const auto& grid_name : source_grid_names) {
-          source_element_ids.push_back(ElementId<Dim>(grid_name));
+          source_element_ids.emplace_back(grid_name);
         }
+        source_element_locator =
+            ElementLocator<Dim>{std::move(source_element_ids)};
         // Reconstruct domain from volume data file
         const std::optional<std::vector<char>> serialized_domain =
             volume_file.get_domain(observation_id);
@@ -575,9 +633,11 @@ struct ReadAllVolumeDataAndDistribute {
               *source_domain, target_points, observation_value,
               source_domain_functions_of_time);
           // Find the target points in the subset of source elements contained
-          // in this volume file
-          source_element_logical_coords = element_logical_coordinates(
-              source_element_ids, source_block_logical_coords);
+          // in this volume file. Only these source elements overlap with the
+          // target element, so only their data is interpolated.
+          source_element_logical_coords =
+              source_element_locator.element_logical_coordinates(
+                  source_block_logical_coords);
           overlapping_source_element_ids.reserve(
               source_element_logical_coords.size());
           for (const auto& source_element_id_and_coords :
@@ -588,8 +648,8 @@ struct ReadAllVolumeDataAndDistribute {
         } else {
           // When interpolation is disabled we process only volume files that
           // contain the exact element
-          if (std::find(source_grid_names.begin(), source_grid_names.end(),
-                        target_grid_name) == source_grid_names.end()) {
+          if (source_grid_locations.find(target_grid_name) ==
+              source_grid_locations.end()) {
             continue;
           }
           overlapping_source_element_ids.push_back(target_element_id);
@@ -607,19 +667,15 @@ struct ReadAllVolumeDataAndDistribute {
         for (const auto& source_element_id : overlapping_source_element_ids) {
           const auto source_grid_name = get_output(source_element_id);
           // Find the data offset that corresponds to this element
-          const auto element_data_offset_and_length =
-              h5::offset_and_length_for_grid(source_grid_name,
-                                             source_grid_names, source_extents);
-          // Extract this element's data from the read-in dataset
-          auto source_element_data =
-              detail::extract_element_data<FieldTagsList>(
-                  element_data_offset_and_length, *all_tensor_data,
-                  selected_fields);
+          const h5::GridLocation& source_grid_location =
+              source_grid_locations.at(source_grid_name);
+          const std::pair<size_t, size_t> element_data_offset_and_length{
+              source_grid_location.offset, source_grid_location.length};
 
           if (enable_interpolation) {
             const auto source_mesh = h5::mesh_for_grid<Dim>(
-                source_grid_name, source_grid_names, source_extents,
-                source_bases, source_quadratures);
+                source_grid_location.index, source_extents, source_bases,
+                source_quadratures);
             const size_t target_num_points = target_points.begin()->size();
 
             // Get and resize target buffer
@@ -638,12 +694,13 @@ struct ReadAllVolumeDataAndDistribute {
             auto& indices_of_filled_interp_points =
                 all_indices_of_filled_interp_points[target_element_id];
 
-            // Interpolate!
+            // Interpolate all selected fields of the source element at once,
+            // directly from the read-in dataset
             const auto& source_logical_coords_of_target_points =
                 source_element_logical_coords.at(source_element_id);
             detail::interpolate_selected_fields<FieldTagsList>(
-                make_not_null(&target_element_data), source_element_data,
-                source_mesh,
+                make_not_null(&target_element_data), *all_tensor_data,
+                element_data_offset_and_length, source_mesh,
                 source_logical_coords_of_target_points.element_logical_coords,
                 source_logical_coords_of_target_points.offsets,
                 selected_fields);
@@ -681,7 +738,12 @@ struct ReadAllVolumeDataAndDistribute {
             detail::verify_inertial_coordinates(
                 element_data_offset_and_length, *source_inertial_coords,
                 target_points, source_grid_name);
-            // Pass data directly to the element when interpolation is disabled
+            // Pass this element's data from the read-in dataset directly to
+            // the element when interpolation is disabled
+            auto source_element_data =
+                detail::extract_element_data<FieldTagsList>(
+                    element_data_offset_and_length, *all_tensor_data,
+                    selected_fields);
             Parallel::receive_data<Tags::VolumeData<FieldTagsList>>(
                 Parallel::get_parallel_component<ReceiveComponent>(
                     cache)[target_element_id],
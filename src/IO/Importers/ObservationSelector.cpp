@@ -16,6 +16,8 @@ std::ostream& operator<<(std::ostream& os, const ObservationSelector value) {
       return os << "First";
     case ObservationSelector::Last:
       return os << "Last";
+    case ObservationSelector::All:
+      return os << "All";
       // LCOV_EXCL_START
     default:
       ERROR("Unknown importers::ObservationSelector");
@@ -33,9 +35,11 @@ Options::create_from_yaml<importers::ObservationSelector>::create<void>(
     return importers::ObservationSelector::First;
   } else if (value == "Last") {
     return importers::ObservationSelector::Last;
+  } else if (value == "All") {
+    return importers::ObservationSelector::All;
   }
   PARSE_ERROR(options.context(), "Failed to convert '"
                                      << value
                                      << "' to importers::ObservationSelector. "
-                                        "Must be one of First, Last.");
+                                        "Must be one of First, Last, All.");
 }
@@ -18,7 +18,11 @@ namespace importers {
 /// Represents the first or last observation in a volume data file, to allow
 /// specifying it in an input file without knowledge of the specific observation
 /// values.
-enum class ObservationSelector { First, Last };
+///
+/// `All` selects every observation in the file. It is only supported by code
+/// that processes observations one after another, such as the `FindHorizons`
+/// executable, and not by `importers::Actions::ReadAllVolumeDataAndDistribute`.
+enum class ObservationSelector { First, Last, All };
 
 std::ostream& operator<<(std::ostream& os, const ObservationSelector value);
 
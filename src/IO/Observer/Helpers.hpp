@@ -3,10 +3,17 @@
 
 #pragma once
 
+#include <converse.h>
+#include <cstddef>
+#include <utility>
+
+#include "IO/Observer/Staging.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/Tags/InputSource.hpp"
+#include "Parallel/WriterThread.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
 
@@ -53,6 +60,53 @@ std::string input_source_from_cache(
   }
 }
 
+/*!
+ * \brief Run `write` on the `Parallel::writer_thread()` if
+ * `observers::Tags::MaxPendingWrites` is in the global cache and nonzero,
+ * otherwise run it immediately.
+ *
+ * \details Writing in the background lets the `ObserverWriter` return to
+ * processing messages while the file system is slow, and the limit on the
+ * pending writes bounds the memory held by the data waiting to be written.
+ * The writes are done in the order they were submitted. `write` must take the
+ * `observers::Tags::H5FileLock` itself, and it must not use the `cache` or
+ * any other Charm++ function, so everything it needs must be computed
+ * beforehand and captured by value.
+ *
+ * The pending writes are finished before the nodegroups are checkpointed and
+ * before the run exits.
+ *
+ * \note Without SMP the `Parallel::NodeLock` does not lock, so the writes are
+ * always done synchronously.
+ */
+template <typename Metavariables, typename F>
+void submit_write(const Parallel::GlobalCache<Metavariables>& cache,
+                  F&& write) {
+  size_t max_pending_writes = 0;
+#if CMK_SMP
+  if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                             Tags::MaxPendingWrites>) {
+    max_pending_writes = Parallel::get<Tags::MaxPendingWrites>(cache);
+  }
+#endif  // CMK_SMP
+  (void)cache;
+  Parallel::writer_thread().submit(std::forward<F>(write), max_pending_writes);
+}
+
+/// The `observers::Tags::OutputBackend` if it is in the global cache,
+/// otherwise `observers::OutputBackend::H5`.
+template <typename Metavariables>
+OutputBackend output_backend(
+    const Parallel::GlobalCache<Metavariables>& cache) {
+  if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                             Tags::OutputBackend>) {
+    return Parallel::get<Tags::OutputBackend>(cache);
+  } else {
+    (void)cache;
+    return OutputBackend::H5;
+  }
+}
+
 /// Each Action that sends data to the reduction Observer must specify
 /// a type alias `observed_reduction_data_tags` that describes the data it
 /// sends.  Given a list of such Actions (or other types that expose the alias),
@@ -19,6 +19,8 @@
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/Protocols/ReductionDataFormatter.hpp"
+#include "IO/Observer/ReductionRowBuffer.hpp"
+#include "IO/Observer/Staging.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -226,11 +228,9 @@ void append_to_reduction_data(
     const std::vector<double>& t);
 
 template <typename... Ts, size_t... Is>
-void write_data(const std::string& subfile_name,
-                const std::string& input_source,
-                std::vector<std::string> legend, const std::tuple<Ts...>& data,
-                const std::string& file_prefix,
-                std::index_sequence<Is...> /*meta*/) {
+std::vector<double> make_row(const std::vector<std::string>& legend,
+                             const std::tuple<Ts...>& data,
+                             std::index_sequence<Is...> /*meta*/) {
   static_assert(sizeof...(Ts) > 0,
                 "Must be reducing at least one piece of data");
   std::vector<double> data_to_append{};
@@ -244,6 +244,16 @@ void write_data(const std::string& subfile_name,
         << "' but there are " << data_to_append.size()
         << " pieces of data being reduced");
   }
+  return data_to_append;
+}
+
+template <typename... Ts, size_t... Is>
+void write_data(const std::string& subfile_name,
+                const std::string& input_source,
+                std::vector<std::string> legend, const std::tuple<Ts...>& data,
+                const std::string& file_prefix,
+                std::index_sequence<Is...> meta) {
+  const std::vector<double> data_to_append = make_row(legend, data, meta);
 
   h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
                                                input_source);
@@ -252,6 +262,40 @@ void write_data(const std::string& subfile_name,
       subfile_name, std::move(legend), version_number);
   time_series_file.append(data_to_append);
 }
+
+// Write a row of reduction data to the reductions file, collecting
+// `Tags::BufferedReductionRows` rows of each subfile before they are written.
+// With the `OutputBackend::Staging` backend the row is published to the
+// `staging_area()` instead.
+template <typename Metavariables, typename... Ts>
+void submit_row(const Parallel::GlobalCache<Metavariables>& cache,
+                const gsl::not_null<Parallel::NodeLock*> file_lock,
+                const std::string& subfile_name,
+                std::vector<std::string> legend,
+                const std::tuple<Ts...>& data) {
+  std::vector<double> row =
+      make_row(legend, data, std::make_index_sequence<sizeof...(Ts)>{});
+  if (observers::output_backend(cache) == OutputBackend::Staging) {
+    staging_area().publish_reduction_row(subfile_name, legend, row);
+    return;
+  }
+  const size_t max_rows = [&cache]() -> size_t {
+    if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                               Tags::BufferedReductionRows>) {
+      return Parallel::get<Tags::BufferedReductionRows>(cache);
+    } else {
+      (void)cache;
+      return 1;
+    }
+  }();
+  auto write_rows = observers::reduction_row_buffer().append(
+      file_lock, Parallel::get<Tags::ReductionFileName>(cache) + ".h5",
+      subfile_name, observers::input_source_from_cache(cache),
+      std::move(legend), std::move(row), max_rows);
+  if (write_rows.has_value()) {
+    observers::submit_write(cache, std::move(*write_rows));
+  }
+}
 }  // namespace ReductionActions_detail
 
 /*!
@@ -618,7 +662,6 @@ struct WriteReductionData {
     }
 
     if (write_to_disk) {
-      const std::lock_guard hold_lock(*reduction_file_lock);
       // NOLINTNEXTLINE(bugprone-use-after-move)
       received_reduction_data.finalize();
       if constexpr (not std::is_same_v<Formatter, NoFormatter>) {
@@ -627,12 +670,10 @@ struct WriteReductionData {
               std::apply(*formatter, received_reduction_data.data()) + "\n");
         }
       }
-      ReductionActions_detail::write_data(
-          subfile_name, observers::input_source_from_cache(cache),
+      ReductionActions_detail::submit_row(
+          cache, make_not_null(reduction_file_lock), subfile_name,
           // NOLINTNEXTLINE(bugprone-use-after-move)
-          std::move(reduction_names), std::move(received_reduction_data.data()),
-          Parallel::get<Tags::ReductionFileName>(cache),
-          std::make_index_sequence<sizeof...(ReductionDatums)>{});
+          std::move(reduction_names), received_reduction_data.data());
     }
   }
 };
@@ -668,14 +709,11 @@ struct WriteReductionDataRow {
                     const std::string& subfile_name,
                     std::vector<std::string>&& legend,
                     std::tuple<Ts...>&& reduction_data) {
-    auto& reduction_file_lock =
-        db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
-    const std::lock_guard hold_lock(reduction_file_lock);
-    ThreadedActions::ReductionActions_detail::write_data(
-        subfile_name, observers::input_source_from_cache(cache),
-        std::move(legend), std::move(reduction_data),
-        Parallel::get<Tags::ReductionFileName>(cache),
-        std::make_index_sequence<sizeof...(Ts)>{});
+    ThreadedActions::ReductionActions_detail::submit_row(
+        cache,
+        make_not_null(
+            &db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box))),
+        subfile_name, std::move(legend), reduction_data);
   }
 };
 
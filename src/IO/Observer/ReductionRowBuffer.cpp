@@ -0,0 +1,112 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/ReductionRowBuffer.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/WriterThread.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers {
+std::optional<std::function<void()>> ReductionRowBuffer::append(
+    const gsl::not_null<Parallel::NodeLock*> file_lock,
+    const std::string& file_name, const std::string& subfile_name,
+    std::string input_source, std::vector<std::string> legend,
+    std::vector<double> row, const size_t max_rows) {
+  const std::lock_guard lock(mutex_);
+  const auto key = std::make_pair(file_name, subfile_name);
+  auto subfile = subfiles_.find(key);
+  std::optional<std::function<void()>> write_previous_rows{};
+  if (subfile != subfiles_.end() and subfile->second.legend != legend) {
+    write_previous_rows =
+        write_task(file_name, subfile_name, std::move(subfile->second));
+    subfiles_.erase(subfile);
+    subfile = subfiles_.end();
+  }
+  if (subfile == subfiles_.end()) {
+    subfile = subfiles_
+                  .emplace(key, Subfile{file_lock.get(),
+                                        std::move(input_source),
+                                        std::move(legend),
+                                        {}})
+                  .first;
+  }
+  subfile->second.rows.push_back(std::move(row));
+  if (subfile->second.rows.size() < max_rows) {
+    return write_previous_rows;
+  }
+  auto write_rows =
+      write_task(file_name, subfile_name, std::move(subfile->second));
+  subfiles_.erase(subfile);
+  if (not write_previous_rows.has_value()) {
+    return write_rows;
+  }
+  return [write_previous_rows = std::move(*write_previous_rows),
+          write_rows = std::move(write_rows)]() {
+    write_previous_rows();
+    write_rows();
+  };
+}
+
+std::vector<std::function<void()>> ReductionRowBuffer::take_all() {
+  const std::lock_guard lock(mutex_);
+  std::vector<std::function<void()>> result{};
+  result.reserve(subfiles_.size());
+  for (auto& [key, subfile] : subfiles_) {
+    result.push_back(write_task(key.first, key.second, std::move(subfile)));
+  }
+  subfiles_.clear();
+  return result;
+}
+
+size_t ReductionRowBuffer::size() const {
+  const std::lock_guard lock(mutex_);
+  size_t result = 0;
+  for (const auto& [key, subfile] : subfiles_) {
+    (void)key;
+    result += subfile.rows.size();
+  }
+  return result;
+}
+
+std::function<void()> ReductionRowBuffer::write_task(std::string file_name,
+                                                     std::string subfile_name,
+                                                     Subfile subfile) {
+  return [file_name = std::move(file_name),
+          subfile_name = std::move(subfile_name),
+          subfile = std::move(subfile)]() {
+    const std::lock_guard hold_lock(*subfile.file_lock);
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true,
+                                                 subfile.input_source);
+    constexpr size_t version_number = 0;
+    auto& time_series_file = h5file.try_insert<h5::Dat>(
+        subfile_name, subfile.legend, version_number);
+    time_series_file.append(subfile.rows);
+  };
+}
+
+ReductionRowBuffer& reduction_row_buffer() {
+  static ReductionRowBuffer result{};
+  static const bool flush_registered = []() {
+    Parallel::writer_thread().add_flush_callback([]() {
+      for (auto& write_rows : result.take_all()) {
+        Parallel::writer_thread().submit(std::move(write_rows), 0);
+      }
+    });
+    return true;
+  }();
+  (void)flush_registered;
+  return result;
+}
+}  // namespace observers
@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Collects rows of reduction data so that they are appended to their
+ * `h5::Dat` subfile several at a time.
+ *
+ * \details Every append to a `h5::Dat` opens the file and extends the dataset,
+ * which is expensive for observations made every few time steps. The rows of
+ * each subfile are kept here until there are enough of them, and are then
+ * written together by a task returned from `append`. `take_all` returns the
+ * tasks writing all rows still buffered. The process-wide buffer returned by
+ * `observers::reduction_row_buffer()` is flushed whenever
+ * `Parallel::writer_thread()` is waited on, which happens before a checkpoint
+ * and before the run exits.
+ *
+ * The tasks take the `file_lock` passed to `append`, which should be the
+ * `observers::Tags::H5FileLock`.
+ */
+class ReductionRowBuffer {
+ public:
+  /// Buffer `row` for the subfile `subfile_name` of the file `file_name`.
+  ///
+  /// Returns a task that writes the buffered rows of the subfile once there
+  /// are `max_rows` of them. If `legend` differs from the legend of the rows
+  /// that are already buffered, the returned task also writes those first.
+  std::optional<std::function<void()>> append(
+      gsl::not_null<Parallel::NodeLock*> file_lock,
+      const std::string& file_name, const std::string& subfile_name,
+      std::string input_source, std::vector<std::string> legend,
+      std::vector<double> row, size_t max_rows);
+
+  /// Tasks that write all buffered rows, one for each subfile.
+  std::vector<std::function<void()>> take_all();
+
+  /// The number of rows waiting to be written
+  size_t size() const;
+
+ private:
+  struct Subfile {
+    Parallel::NodeLock* file_lock;
+    std::string input_source;
+    std::vector<std::string> legend;
+    std::vector<std::vector<double>> rows;
+  };
+
+  static std::function<void()> write_task(std::string file_name,
+                                          std::string subfile_name,
+                                          Subfile subfile);
+
+  mutable std::mutex mutex_{};
+  std::map<std::pair<std::string, std::string>, Subfile> subfiles_{};
+};
+
+/// The `observers::ReductionRowBuffer` shared by the `ObserverWriter` of this
+/// process. It is flushed by every `Parallel::writer_thread().wait()`.
+ReductionRowBuffer& reduction_row_buffer();
+}  // namespace observers
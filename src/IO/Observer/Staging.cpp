@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/Staging.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/TensorData.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace observers {
+std::ostream& operator<<(std::ostream& os, const OutputBackend value) {
+  switch (value) {
+    case OutputBackend::H5:
+      return os << "H5";
+    case OutputBackend::Staging:
+      return os << "Staging";
+      // LCOV_EXCL_START
+    default:
+      ERROR("Unknown observers::OutputBackend");
+      // LCOV_EXCL_STOP
+  }
+}
+
+void StagingArea::add_volume_consumer(VolumeConsumer consumer) {
+  const std::lock_guard lock(mutex_);
+  volume_consumers_.push_back(std::move(consumer));
+}
+
+void StagingArea::add_reduction_consumer(ReductionConsumer consumer) {
+  const std::lock_guard lock(mutex_);
+  reduction_consumers_.push_back(std::move(consumer));
+}
+
+void StagingArea::publish_volume_data(
+    const std::string& subfile_name, const size_t observation_id,
+    const double observation_value,
+    const std::vector<ElementVolumeData>& volume_data) const {
+  const std::lock_guard lock(mutex_);
+  for (const auto& consumer : volume_consumers_) {
+    consumer(subfile_name, observation_id, observation_value, volume_data);
+  }
+}
+
+void StagingArea::publish_reduction_row(const std::string& subfile_name,
+                                        const std::vector<std::string>& legend,
+                                        const std::vector<double>& row) const {
+  const std::lock_guard lock(mutex_);
+  for (const auto& consumer : reduction_consumers_) {
+    consumer(subfile_name, legend, row);
+  }
+}
+
+void StagingArea::clear() {
+  const std::lock_guard lock(mutex_);
+  volume_consumers_.clear();
+  reduction_consumers_.clear();
+}
+
+StagingArea& staging_area() {
+  static StagingArea result{};
+  return result;
+}
+}  // namespace observers
+
+template <>
+observers::OutputBackend
+Options::create_from_yaml<observers::OutputBackend>::create<void>(
+    const Options::Option& options) {
+  const auto value = options.parse_as<std::string>();
+  if (value == "H5") {
+    return observers::OutputBackend::H5;
+  } else if (value == "Staging") {
+    return observers::OutputBackend::Staging;
+  }
+  PARSE_ERROR(options.context(), "Failed to convert '"
+                                     << value
+                                     << "' to observers::OutputBackend. Must "
+                                        "be one of H5, Staging.");
+}
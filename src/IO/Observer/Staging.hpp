@@ -0,0 +1,102 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// \cond
+struct ElementVolumeData;
+namespace Options {
+struct Option;
+template <typename T>
+struct create_from_yaml;
+}  // namespace Options
+/// \endcond
+
+namespace observers {
+/// \ingroup ObserversGroup
+/// Where the `observers::ObserverWriter` sends the observations it collected.
+///
+/// - `H5`: write them to the volume and reduction files.
+/// - `Staging`: pass them to the consumers of the
+///   `observers::staging_area()` and never write them to disk.
+enum class OutputBackend { H5, Staging };
+
+std::ostream& operator<<(std::ostream& os, OutputBackend value);
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief An in-memory destination for observations, for analyzing or
+ * visualizing them in situ.
+ *
+ * \details With the `observers::OutputBackend::Staging` backend the
+ * `observers::ObserverWriter` passes the volume data and reduction rows it
+ * collected on a node to the consumers added here, instead of writing them to
+ * the parallel file system. This avoids the file system entirely for data that
+ * is analyzed once and discarded. A consumer can, for instance, run an
+ * analysis, or forward the data to a staging service outside the simulation.
+ *
+ * Consumers are added to the process-wide `observers::staging_area()` at
+ * startup, before the first observation. They are called synchronously on the
+ * thread running the writer action, one at a time and in the order they were
+ * added, so they should hand off long-running work. The data passed to them is
+ * only valid for the duration of the call. Observations published without any
+ * consumer are discarded.
+ */
+class StagingArea {
+ public:
+  using VolumeConsumer = std::function<void(
+      const std::string& subfile_name, size_t observation_id,
+      double observation_value,
+      const std::vector<ElementVolumeData>& volume_data)>;
+  using ReductionConsumer = std::function<void(
+      const std::string& subfile_name, const std::vector<std::string>& legend,
+      const std::vector<double>& row)>;
+
+  void add_volume_consumer(VolumeConsumer consumer);
+
+  void add_reduction_consumer(ReductionConsumer consumer);
+
+  /// Pass the volume data of the observation `observation_id` of the subfile
+  /// `subfile_name` to all volume consumers.
+  void publish_volume_data(
+      const std::string& subfile_name, size_t observation_id,
+      double observation_value,
+      const std::vector<ElementVolumeData>& volume_data) const;
+
+  /// Pass a row of reduction data of the subfile `subfile_name` to all
+  /// reduction consumers.
+  void publish_reduction_row(const std::string& subfile_name,
+                             const std::vector<std::string>& legend,
+                             const std::vector<double>& row) const;
+
+  /// Remove all consumers
+  void clear();
+
+ private:
+  mutable std::mutex mutex_{};
+  std::vector<VolumeConsumer> volume_consumers_{};
+  std::vector<ReductionConsumer> reduction_consumers_{};
+};
+
+/// The staging area of this process.
+StagingArea& staging_area();
+}  // namespace observers
+
+template <>
+struct Options::create_from_yaml<observers::OutputBackend> {
+  template <typename Metavariables>
+  static observers::OutputBackend create(const Options::Option& options) {
+    return create<void>(options);
+  }
+};
+template <>
+observers::OutputBackend
+Options::create_from_yaml<observers::OutputBackend>::create<void>(
+    const Options::Option& options);
@@ -15,8 +15,10 @@
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/Staging.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -205,6 +207,57 @@ struct SurfaceFileName {
       "Name of the surface data file without extension"};
   using group = Group;
 };
+
+/// The chunking and compression of the volume data.
+struct VolumeCompression {
+  using type = h5::Compression;
+  static constexpr Options::String help = {
+      "Chunking and compression of the tensor components in the volume data "
+      "files"};
+  using group = Group;
+};
+
+/// Whether the connectivity is written with the volume data.
+struct WriteVolumeConnectivity {
+  using type = bool;
+  static constexpr Options::String help = {
+      "Write the connectivity of the elements with every observation of "
+      "volume data. It is only needed for visualization, and 'generate-xdmf' "
+      "generates it when it is missing."};
+  using group = Group;
+};
+
+/// The number of volume and reduction writes that may wait for the
+/// background writer thread.
+struct MaxPendingWrites {
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Number of writes that may wait to be done in the background before the "
+      "observers wait for them. Zero writes synchronously."};
+  using group = Group;
+};
+
+/// The number of rows of reduction data that are collected before they are
+/// appended to their subfile.
+struct BufferedReductionRows {
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Number of rows of reduction data collected for each subfile before "
+      "they are written together. The rows are always written before a "
+      "checkpoint and at the end of the run."};
+  static type lower_bound() { return 1; }
+  using group = Group;
+};
+
+/// Where the observations are sent, see `observers::OutputBackend`.
+struct OutputBackend {
+  using type = observers::OutputBackend;
+  static constexpr Options::String help = {
+      "Where the observations are sent: 'H5' writes them to the volume and "
+      "reduction files, 'Staging' passes them to the in-memory consumers "
+      "for in-situ analysis and never writes them to disk."};
+  using group = Group;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -264,5 +317,88 @@ struct SurfaceFileName : db::SimpleTag {
     return surface_file_name;
   }
 };
+
+/// \brief The chunking and compression of the tensor components written to
+/// the volume data files.
+///
+/// This tag is optional. Add it to the `const_global_cache_tags` of the
+/// metavariables to select the compression in the input file, otherwise the
+/// default `h5::Compression` is used.
+struct VolumeCompression : db::SimpleTag {
+  using type = h5::Compression;
+  using option_tags = tmpl::list<::observers::OptionTags::VolumeCompression>;
+
+  static constexpr bool pass_metavariables = false;
+  static h5::Compression create_from_options(
+      const h5::Compression& compression) {
+    return compression;
+  }
+};
+
+/// \brief Whether the connectivity is written with the volume data, see
+/// `h5::VolumeData::write_volume_data`.
+///
+/// This tag is optional. Add it to the `const_global_cache_tags` of the
+/// metavariables to allow skipping the connectivity, otherwise it is always
+/// written.
+struct WriteVolumeConnectivity : db::SimpleTag {
+  using type = bool;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::WriteVolumeConnectivity>;
+
+  static constexpr bool pass_metavariables = false;
+  static bool create_from_options(const bool write_volume_connectivity) {
+    return write_volume_connectivity;
+  }
+};
+
+/// \brief The number of writes that may wait for the
+/// `Parallel::writer_thread()`, see `observers::submit_write`.
+///
+/// This tag is optional. Add it to the `const_global_cache_tags` of the
+/// metavariables to write in the background, otherwise all writes are done
+/// synchronously.
+struct MaxPendingWrites : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<::observers::OptionTags::MaxPendingWrites>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t max_pending_writes) {
+    return max_pending_writes;
+  }
+};
+
+/// \brief The number of rows of reduction data collected in the
+/// `observers::reduction_row_buffer()` before they are written.
+///
+/// This tag is optional. Add it to the `const_global_cache_tags` of the
+/// metavariables to buffer the rows, otherwise every row is written as soon as
+/// it is reduced.
+struct BufferedReductionRows : db::SimpleTag {
+  using type = size_t;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::BufferedReductionRows>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t buffered_reduction_rows) {
+    return buffered_reduction_rows;
+  }
+};
+
+/// \brief Where the `observers::ObserverWriter` sends the observations.
+///
+/// This tag is optional. Add it to the `const_global_cache_tags` of the
+/// metavariables to allow selecting the `observers::OutputBackend`, otherwise
+/// all observations are written to the H5 files.
+struct OutputBackend : db::SimpleTag {
+  using type = observers::OutputBackend;
+  using option_tags = tmpl::list<::observers::OptionTags::OutputBackend>;
+
+  static constexpr bool pass_metavariables = false;
+  static observers::OutputBackend create_from_options(
+      const observers::OutputBackend output_backend) {
+    return output_backend;
+  }
+};
 }  // namespace Tags
 }  // namespace observers
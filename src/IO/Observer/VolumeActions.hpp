@@ -15,12 +15,14 @@
 #include "Domain/FunctionsOfTime/Tags.hpp"
 #include "Domain/Tags.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Staging.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
 #include "Parallel/ArrayComponentId.hpp"
@@ -341,51 +343,90 @@ struct ContributeVolumeDataToWriter {
         }
       }
 
+      if (observers::output_backend(cache) == OutputBackend::Staging) {
+        staging_area().publish_volume_data(subfile_name, observation_id.hash(),
+                                           observation_id.value(),
+                                           volume_data_to_write);
+        return;
+      }
+
+      // Everything that needs the cache is retrieved here, because the write
+      // may be done on the writer thread, see `observers::submit_write`.
+      const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      std::string file_name =
+          file_prefix +
+          std::to_string(
+              Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
+          ".h5";
+      std::string input_source = observers::input_source_from_cache(cache);
+      // Serialize domain. See `Domain` docs for details on the serialization.
+      // The domain is retrieved from the global cache using the standard
+      // domain tag. If more flexibility is required here later, then the
+      // domain can be passed along with the `ContributeVolumeData` action.
+      std::vector<char> serialized_domain = serialize(
+          Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
+              cache));
+      std::optional<std::vector<char>> serialized_functions_of_time =
+          [&cache]() -> std::optional<std::vector<char>> {
+        // Functions-of-time are in the _mutable_ global cache, so they aren't
+        // accessible through the DataBox by default
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, domain::Tags::FunctionsOfTime>) {
+          return serialize(get<domain::Tags::FunctionsOfTime>(cache));
+        } else {
+          (void)cache;
+          return std::nullopt;
+        }
+      }();
+      h5::Compression compression = [&cache]() {
+        if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                                   Tags::VolumeCompression>) {
+          return Parallel::get<Tags::VolumeCompression>(cache);
+        } else {
+          (void)cache;
+          return h5::Compression{};
+        }
+      }();
+      const bool write_connectivity = [&cache]() {
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, Tags::WriteVolumeConnectivity>) {
+          return Parallel::get<Tags::WriteVolumeConnectivity>(cache);
+        } else {
+          (void)cache;
+          return true;
+        }
+      }();
+
       // Write to file. We use a separate node lock because writing can be
       // very time consuming (it's network dependent, depends on how full the
       // disks are, what other users are doing, etc.) and we want to be able
       // to continue to work on the nodegroup while we are writing data to
       // disk.
-      const std::lock_guard hold_lock(*volume_file_lock);
-      {
-        // Scoping is for closing HDF5 file before we release the lock.
-        const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
-        h5::H5File<h5::AccessType::ReadWrite> h5file(
-            file_prefix +
-                std::to_string(
-                    Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
-                ".h5",
-            true, observers::input_source_from_cache(cache));
-        constexpr size_t version_number = 0;
-        auto& volume_file =
-            h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
-
-        // Serialize domain. See `Domain` docs for details on the serialization.
-        // The domain is retrieved from the global cache using the standard
-        // domain tag. If more flexibility is required here later, then the
-        // domain can be passed along with the `ContributeVolumeData` action.
-        const auto serialized_domain = serialize(
-            Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
-                cache));
-        const auto serialized_functions_of_time =
-            [&cache]() -> std::optional<std::vector<char>> {
-          // Functions-of-time are in the _mutable_ global cache, so they aren't
-          // accessible through the DataBox by default
-          if constexpr (Parallel::is_in_global_cache<
-                            Metavariables, domain::Tags::FunctionsOfTime>) {
-            return serialize(get<domain::Tags::FunctionsOfTime>(cache));
-          } else {
-            (void)cache;
-            return std::nullopt;
-          }
-        }();
-        // Write the data to the file
-        volume_file.write_volume_data(
-            observation_id.hash(), observation_id.value(), volume_data_to_write,
-            serialized_domain, serialized_functions_of_time);
-      }
+      observers::submit_write(
+          cache,
+          [volume_file_lock, file_name = std::move(file_name),
+           input_source = std::move(input_source), subfile_name,
+           observation_id,
+           volume_data_to_write = std::move(volume_data_to_write),
+           serialized_domain = std::move(serialized_domain),
+           serialized_functions_of_time =
+               std::move(serialized_functions_of_time),
+           compression = std::move(compression), write_connectivity]() {
+            const std::lock_guard hold_lock(*volume_file_lock);
+            // The HDF5 file is closed before the lock is released.
+            h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true,
+                                                         input_source);
+            constexpr size_t version_number = 0;
+            auto& volume_file =
+                h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
+            volume_file.write_volume_data(
+                observation_id.hash(), observation_id.value(),
+                volume_data_to_write, serialized_domain,
+                serialized_functions_of_time, compression,
+                write_connectivity);
+          });
     }
   }
 };
@@ -421,6 +462,11 @@ struct WriteVolumeData {
                     const std::string& subfile_path,
                     const observers::ObservationId& observation_id,
                     std::vector<ElementVolumeData>&& volume_data) {
+    if (observers::output_backend(cache) == OutputBackend::Staging) {
+      staging_area().publish_volume_data(subfile_path, observation_id.hash(),
+                                         observation_id.value(), volume_data);
+      return;
+    }
     auto& volume_file_lock =
         db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
     const std::lock_guard hold_lock(volume_file_lock);
@@ -5,103 +5,86 @@
 
 #include <cstddef>
 
+#include "DataStructures/DataVector.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace dg::detail {
-
-template <>
-void apply_mass_matrix_impl<1>(const gsl::not_null<double*> data,
-                               const Mesh<1>& mesh) {
+namespace {
+// Multiplies (or divides) all components of the data by the tensor product of
+// the quadrature weights. Meshes of lower dimension are treated as 3D meshes
+// with a single point in the missing dimensions.
+template <bool Inverse, size_t Dim>
+void apply_quadrature_weights(const gsl::not_null<double*> data,
+                              const Mesh<Dim>& mesh,
+                              const size_t number_of_components) {
+  static_assert(Dim >= 1 and Dim <= 3);
+  static const DataVector unit_weight{1, 1.0};
   const size_t x_size = mesh.extents(0);
-  const auto& w_x = Spectral::quadrature_weights(mesh);
-  for (size_t i = 0; i < x_size; ++i) {
-    data.get()[i] *= w_x[i];
+  const size_t y_size = Dim > 1 ? mesh.extents(1) : 1;
+  const size_t z_size = Dim > 2 ? mesh.extents(2) : 1;
+  const DataVector& w_x = Spectral::quadrature_weights(mesh.slice_through(0));
+  const DataVector* w_y = &unit_weight;
+  const DataVector* w_z = &unit_weight;
+  if constexpr (Dim > 1) {
+    w_y = &Spectral::quadrature_weights(mesh.slice_through(1));
   }
-}
-
-template <>
-void apply_inverse_mass_matrix_impl<1>(const gsl::not_null<double*> data,
-                                       const Mesh<1>& mesh) {
-  const size_t x_size = mesh.extents(0);
-  const auto& w_x = Spectral::quadrature_weights(mesh);
-  for (size_t i = 0; i < x_size; ++i) {
-    data.get()[i] /= w_x[i];
+  if constexpr (Dim > 2) {
+    w_z = &Spectral::quadrature_weights(mesh.slice_through(2));
   }
-}
-
-template <>
-void apply_mass_matrix_impl<2>(const gsl::not_null<double*> data,
-                               const Mesh<2>& mesh) {
-  const size_t x_size = mesh.extents(0);
-  const size_t y_size = mesh.extents(1);
-  const auto& w_x = Spectral::quadrature_weights(mesh.slice_through(0));
-  const auto& w_y = Spectral::quadrature_weights(mesh.slice_through(1));
-  for (size_t j = 0; j < y_size; ++j) {
-    const size_t offset = j * x_size;
-    for (size_t i = 0; i < x_size; ++i) {
-      data.get()[offset + i] *= w_x[i] * w_y[j];
+  const size_t num_points = x_size * y_size * z_size;
+  for (size_t component = 0; component < number_of_components; ++component) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    double* const component_data = data.get() + component * num_points;
+    for (size_t k = 0; k < z_size; ++k) {
+      const size_t offset_z = k * y_size * x_size;
+      for (size_t j = 0; j < y_size; ++j) {
+        const double w_yz = (*w_y)[j] * (*w_z)[k];
+        const size_t offset = x_size * j + offset_z;
+        for (size_t i = 0; i < x_size; ++i) {
+          // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          if constexpr (Inverse) {
+            component_data[offset + i] /= w_x[i] * w_yz;
+          } else {
+            component_data[offset + i] *= w_x[i] * w_yz;
+          }
+          // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
     }
   }
 }
+}  // namespace
 
-template <>
-void apply_inverse_mass_matrix_impl<2>(const gsl::not_null<double*> data,
-                                       const Mesh<2>& mesh) {
-  const size_t x_size = mesh.extents(0);
-  const size_t y_size = mesh.extents(1);
-  const auto& w_x = Spectral::quadrature_weights(mesh.slice_through(0));
-  const auto& w_y = Spectral::quadrature_weights(mesh.slice_through(1));
-  for (size_t j = 0; j < y_size; ++j) {
-    const size_t offset = j * x_size;
-    for (size_t i = 0; i < x_size; ++i) {
-      data.get()[offset + i] /= w_x[i] * w_y[j];
-    }
-  }
+template <size_t Dim>
+void apply_mass_matrix_impl(const gsl::not_null<double*> data,
+                            const Mesh<Dim>& mesh,
+                            const size_t number_of_components) {
+  apply_quadrature_weights<false>(data, mesh, number_of_components);
 }
 
-template <>
-void apply_mass_matrix_impl<3>(const gsl::not_null<double*> data,
-                               const Mesh<3>& mesh) {
-  const size_t x_size = mesh.extents(0);
-  const size_t y_size = mesh.extents(1);
-  const size_t z_size = mesh.extents(2);
-  const auto& w_x = Spectral::quadrature_weights(mesh.slice_through(0));
-  const auto& w_y = Spectral::quadrature_weights(mesh.slice_through(1));
-  const auto& w_z = Spectral::quadrature_weights(mesh.slice_through(2));
-  for (size_t k = 0; k < z_size; ++k) {
-    const size_t offset_z = k * y_size * x_size;
-    for (size_t j = 0; j < y_size; ++j) {
-      const double w_yz = w_y[j] * w_z[k];
-      const size_t offset = x_size * j + offset_z;
-      for (size_t i = 0; i < x_size; ++i) {
-        data.get()[offset + i] *= w_x[i] * w_yz;
-      }
-    }
-  }
+template <size_t Dim>
+void apply_inverse_mass_matrix_impl(const gsl::not_null<double*> data,
+                                    const Mesh<Dim>& mesh,
+                                    const size_t number_of_components) {
+  apply_quadrature_weights<true>(data, mesh, number_of_components);
 }
 
-template <>
-void apply_inverse_mass_matrix_impl<3>(const gsl::not_null<double*> data,
-                                       const Mesh<3>& mesh) {
-  const size_t x_size = mesh.extents(0);
-  const size_t y_size = mesh.extents(1);
-  const size_t z_size = mesh.extents(2);
-  const auto& w_x = Spectral::quadrature_weights(mesh.slice_through(0));
-  const auto& w_y = Spectral::quadrature_weights(mesh.slice_through(1));
-  const auto& w_z = Spectral::quadrature_weights(mesh.slice_through(2));
-  for (size_t k = 0; k < z_size; ++k) {
-    const size_t offset_z = k * y_size * x_size;
-    for (size_t j = 0; j < y_size; ++j) {
-      const double w_yz = w_y[j] * w_z[k];
-      const size_t offset = x_size * j + offset_z;
-      for (size_t i = 0; i < x_size; ++i) {
-        data.get()[offset + i] /= w_x[i] * w_yz;
-      }
-    }
-  }
-}
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                       \
+  template void apply_mass_matrix_impl(                            \
+      gsl::not_null<double*> data, const Mesh<DIM(data)>& mesh,    \
+      size_t number_of_components);                                \
+  template void apply_inverse_mass_matrix_impl(                    \
+      gsl::not_null<double*> data, const Mesh<DIM(data)>& mesh,    \
+      size_t number_of_components);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
 
 }  // namespace dg::detail
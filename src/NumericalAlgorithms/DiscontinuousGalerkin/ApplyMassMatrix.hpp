@@ -13,11 +13,15 @@
 namespace dg {
 
 namespace detail {
+// Applies the (inverse) mass matrix to `number_of_components` sets of data
+// stored one after the other, as in a `Variables`
 template <size_t Dim>
-void apply_mass_matrix_impl(gsl::not_null<double*> data, const Mesh<Dim>& mesh);
+void apply_mass_matrix_impl(gsl::not_null<double*> data, const Mesh<Dim>& mesh,
+                            size_t number_of_components = 1);
 template <size_t Dim>
 void apply_inverse_mass_matrix_impl(gsl::not_null<double*> data,
-                                    const Mesh<Dim>& mesh);
+                                    const Mesh<Dim>& mesh,
+                                    size_t number_of_components = 1);
 }  // namespace detail
 
 /*!
@@ -63,16 +67,13 @@ void apply_mass_matrix(const gsl::not_null<DataVector*> data,
 template <size_t Dim, typename TagsList>
 void apply_mass_matrix(const gsl::not_null<Variables<TagsList>*> data,
                        const Mesh<Dim>& mesh) {
-  const size_t num_points = data->number_of_grid_points();
-  ASSERT(num_points == mesh.number_of_grid_points(),
+  ASSERT(data->number_of_grid_points() == mesh.number_of_grid_points(),
          "The Variables data has "
-             << num_points << " grid points, but expected "
+             << data->number_of_grid_points() << " grid points, but expected "
              << mesh.number_of_grid_points() << " on the given mesh.");
-  constexpr size_t num_comps =
-      Variables<TagsList>::number_of_independent_components;
-  for (size_t i = 0; i < num_comps; ++i) {
-    detail::apply_mass_matrix_impl(data->data() + i * num_points, mesh);
-  }
+  detail::apply_mass_matrix_impl(
+      data->data(), mesh,
+      Variables<TagsList>::number_of_independent_components);
 }
 /// @}
 
@@ -95,16 +96,13 @@ void apply_inverse_mass_matrix(const gsl::not_null<DataVector*> data,
 template <size_t Dim, typename TagsList>
 void apply_inverse_mass_matrix(const gsl::not_null<Variables<TagsList>*> data,
                                const Mesh<Dim>& mesh) {
-  const size_t num_points = data->number_of_grid_points();
-  ASSERT(num_points == mesh.number_of_grid_points(),
+  ASSERT(data->number_of_grid_points() == mesh.number_of_grid_points(),
          "The Variables data has "
-             << num_points << " grid points, but expected "
+             << data->number_of_grid_points() << " grid points, but expected "
              << mesh.number_of_grid_points() << " on the given mesh.");
-  constexpr size_t num_comps =
-      Variables<TagsList>::number_of_independent_components;
-  for (size_t i = 0; i < num_comps; ++i) {
-    detail::apply_inverse_mass_matrix_impl(data->data() + i * num_points, mesh);
-  }
+  detail::apply_inverse_mass_matrix_impl(
+      data->data(), mesh,
+      Variables<TagsList>::number_of_independent_components);
 }
 /// @}
 
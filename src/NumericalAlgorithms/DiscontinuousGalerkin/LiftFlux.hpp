@@ -7,12 +7,16 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/SliceIterator.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -73,4 +77,67 @@ auto lift_flux(Variables<tmpl::list<FluxTags...>> flux,
   return lifted_data;
 }
 /// @}
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Lifts the flux contribution from an interface and adds it to the
+ * volume data.
+ *
+ * This is equivalent to `dg::lift_flux` followed by `add_slice_to_data`, but
+ * leaves `boundary_correction_terms` unchanged and passes over the data only
+ * once. The slice is specified as in `add_slice_to_data`, i.e. by the
+ * `sliced_dim` perpendicular to the interface and the `fixed_index` of the
+ * slice in that dimension (see `index_to_slice_at`).
+ */
+template <typename... VolumeTags, typename... BoundaryCorrectionTags,
+          size_t VolumeDim>
+void lift_flux_to_volume(
+    const gsl::not_null<Variables<tmpl::list<VolumeTags...>>*> volume_vars,
+    const Variables<tmpl::list<BoundaryCorrectionTags...>>&
+        boundary_correction_terms,
+    const Index<VolumeDim>& extents, const size_t sliced_dim,
+    const size_t fixed_index,
+    const Scalar<DataVector>& magnitude_of_face_normal) {
+  static_assert(
+      (std::is_same_v<db::remove_all_prefixes<VolumeTags>,
+                      db::remove_all_prefixes<BoundaryCorrectionTags>> and
+       ...));
+  static_assert((std::is_same_v<typename VolumeTags::type,
+                                typename BoundaryCorrectionTags::type> and
+                 ...),
+                "Tensor types do not match.");
+  constexpr size_t number_of_independent_components =
+      Variables<tmpl::list<VolumeTags...>>::number_of_independent_components;
+  const size_t volume_grid_points = extents.product();
+  const size_t slice_grid_points = extents.slice_away(sliced_dim).product();
+  ASSERT(volume_vars->number_of_grid_points() == volume_grid_points,
+         "volume_vars has wrong number of grid points.  Expected "
+             << volume_grid_points << ", got "
+             << volume_vars->number_of_grid_points());
+  ASSERT(boundary_correction_terms.number_of_grid_points() ==
+                 slice_grid_points and
+             get(magnitude_of_face_normal).size() == slice_grid_points,
+         "The boundary corrections and the magnitude of the face normal must "
+         "have "
+             << slice_grid_points << " grid points, but have "
+             << boundary_correction_terms.number_of_grid_points() << " and "
+             << get(magnitude_of_face_normal).size());
+  // See `dg::lift_flux` for the prefactor
+  const size_t extent_perpendicular_to_boundary = extents[sliced_dim];
+  const double prefactor =
+      -0.5 * static_cast<double>((extent_perpendicular_to_boundary *
+                                  (extent_perpendicular_to_boundary - 1)));
+  double* const volume_data = volume_vars->data();
+  const double* const slice_data = boundary_correction_terms.data();
+  const DataVector& magnitude = get(magnitude_of_face_normal);
+  for (SliceIterator si(extents, sliced_dim, fixed_index); si; ++si) {
+    const double factor = prefactor * magnitude[si.slice_offset()];
+    for (size_t i = 0; i < number_of_independent_components; ++i) {
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      volume_data[si.volume_offset() + i * volume_grid_points] +=
+          factor * slice_data[si.slice_offset() + i * slice_grid_points];
+      // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+}
 }  // namespace dg
@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/AffineTransformation.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -24,14 +25,14 @@
 #include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace {
-template <size_t Dim>
+template <size_t Dim, typename TargetFrame>
 void metric_identity_det_jac_times_inv_jac_impl(
     const gsl::not_null<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
-                                        Frame::Inertial>*>
+                                        TargetFrame>*>
         det_jac_times_inverse_jacobian,
     const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
-    const Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>&
+    const tnsr::I<DataVector, Dim, TargetFrame>& inertial_coords,
+    const Jacobian<DataVector, Dim, Frame::ElementLogical, TargetFrame>&
         jacobian) {
   static_assert(Dim == 1 or Dim == 2, "Generic impl handles only 1d and 2d.");
   set_number_of_grid_points(det_jac_times_inverse_jacobian,
@@ -65,14 +66,15 @@ void metric_identity_det_jac_times_inv_jac_impl(
   }
 }
 
+template <typename TargetFrame>
 void metric_identity_det_jac_times_inv_jac_impl(
     const gsl::not_null<
-        InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>*>
+        InverseJacobian<DataVector, 3, Frame::ElementLogical, TargetFrame>*>
         det_jac_times_inverse_jacobian,
     const gsl::not_null<DataVector*> buffer,
     const gsl::not_null<DataVector*> buffer_component, const Mesh<3>& mesh,
-    const tnsr::I<DataVector, 3, Frame::Inertial>& inertial_coords,
-    const Jacobian<DataVector, 3, Frame::ElementLogical, Frame::Inertial>&
+    const tnsr::I<DataVector, 3, TargetFrame>& inertial_coords,
+    const Jacobian<DataVector, 3, Frame::ElementLogical, TargetFrame>&
         jacobian) {
   // The 3d case is handled separately because this actually requires a buffer.
   // Basically, in 2d you can get into the situation where you have 2 unused
@@ -220,14 +222,14 @@ void metric_identity_det_jac_times_inv_jac_impl(
 }  // namespace
 
 namespace dg {
-template <size_t Dim>
+template <size_t Dim, typename TargetFrame>
 void metric_identity_det_jac_times_inv_jac(
     const gsl::not_null<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
-                                        Frame::Inertial>*>
+                                        TargetFrame>*>
         det_jac_times_inverse_jacobian,
     const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
-    const Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>&
+    const tnsr::I<DataVector, Dim, TargetFrame>& inertial_coords,
+    const Jacobian<DataVector, Dim, Frame::ElementLogical, TargetFrame>&
         jacobian) {
   if constexpr (Dim == 3) {
     const size_t num_grid_points = mesh.number_of_grid_points();
@@ -246,6 +248,53 @@ void metric_identity_det_jac_times_inv_jac(
   }
 }
 
+template <size_t Dim>
+void metric_identity_det_jac_times_inv_jac(
+    const gsl::not_null<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                                        Frame::Inertial>*>
+        det_jac_times_inverse_jacobian,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>&
+        grid_det_jac_times_inverse_jacobian,
+    const domain::CoordinateMaps::AffineTransformation<Dim>&
+        grid_to_inertial_map) {
+  set_number_of_grid_points(
+      det_jac_times_inverse_jacobian,
+      get<0, 0>(grid_det_jac_times_inverse_jacobian).size());
+  // The adjugate det(M) M^{-1} of the grid-to-inertial matrix M
+  const auto& matrix = grid_to_inertial_map.matrix;
+  std::array<std::array<double, Dim>, Dim> adjugate{};
+  if constexpr (Dim == 1) {
+    (void)matrix;
+    adjugate[0][0] = 1.0;
+  } else if constexpr (Dim == 2) {
+    adjugate[0][0] = matrix[1][1];
+    adjugate[0][1] = -matrix[0][1];
+    adjugate[1][0] = -matrix[1][0];
+    adjugate[1][1] = matrix[0][0];
+  } else {
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        gsl::at(gsl::at(adjugate, i), j) =
+            gsl::at(gsl::at(matrix, (j + 1) % 3), (i + 1) % 3) *
+                gsl::at(gsl::at(matrix, (j + 2) % 3), (i + 2) % 3) -
+            gsl::at(gsl::at(matrix, (j + 1) % 3), (i + 2) % 3) *
+                gsl::at(gsl::at(matrix, (j + 2) % 3), (i + 1) % 3);
+      }
+    }
+  }
+  for (size_t i_hat = 0; i_hat < Dim; ++i_hat) {
+    for (size_t j = 0; j < Dim; ++j) {
+      auto& result = det_jac_times_inverse_jacobian->get(i_hat, j);
+      result = grid_det_jac_times_inverse_jacobian.get(i_hat, 0) *
+               gsl::at(adjugate[0], j);
+      for (size_t k = 1; k < Dim; ++k) {
+        result += grid_det_jac_times_inverse_jacobian.get(i_hat, k) *
+                  gsl::at(gsl::at(adjugate, k), j);
+      }
+    }
+  }
+}
+
 template <size_t Dim>
 void metric_identity_jacobian_quantities(
     const gsl::not_null<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
@@ -321,16 +370,34 @@ void metric_identity_jacobian_quantities(
 
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(r, data)                                                 \
+#define GET_FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATION_FRAME(r, data)                                           \
   template void metric_identity_det_jac_times_inv_jac(                         \
       gsl::not_null<InverseJacobian<DataVector, GET_DIM(data),                 \
-                                    Frame::ElementLogical, Frame::Inertial>*>  \
+                                    Frame::ElementLogical, GET_FRAME(data)>*>  \
           det_jac_times_inverse_jacobian,                                      \
       const Mesh<GET_DIM(data)>& mesh,                                         \
-      const tnsr::I<DataVector, GET_DIM(data), Frame::Inertial>&               \
+      const tnsr::I<DataVector, GET_DIM(data), GET_FRAME(data)>&               \
           inertial_coords,                                                     \
       const Jacobian<DataVector, GET_DIM(data), Frame::ElementLogical,         \
-                     Frame::Inertial>& jacobian);                              \
+                     GET_FRAME(data)>& jacobian);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION_FRAME, (1, 2, 3),
+                        (Frame::Grid, Frame::Inertial))
+
+#undef GET_FRAME
+#undef INSTANTIATION_FRAME
+
+#define INSTANTIATION(r, data)                                                 \
+  template void metric_identity_det_jac_times_inv_jac(                         \
+      gsl::not_null<InverseJacobian<DataVector, GET_DIM(data),                 \
+                                    Frame::ElementLogical, Frame::Inertial>*>  \
+          det_jac_times_inverse_jacobian,                                      \
+      const InverseJacobian<DataVector, GET_DIM(data), Frame::ElementLogical,  \
+                            Frame::Grid>& grid_det_jac_times_inverse_jacobian, \
+      const domain::CoordinateMaps::AffineTransformation<GET_DIM(data)>&       \
+          grid_to_inertial_map);                                               \
   template void metric_identity_jacobian_quantities(                           \
       gsl::not_null<InverseJacobian<DataVector, GET_DIM(data),                 \
                                     Frame::ElementLogical, Frame::Inertial>*>  \
@@ -9,6 +9,10 @@
 
 /// \cond
 class DataVector;
+namespace domain::CoordinateMaps {
+template <size_t Dim>
+struct AffineTransformation;
+}  // namespace domain::CoordinateMaps
 template <size_t Dim>
 class Mesh;
 namespace gsl {
@@ -173,17 +177,53 @@ namespace dg {
  * \f}
  *
  * The subtraction technique is most commonly used in finite difference codes.
+ *
+ * The `TargetFrame` is usually `Frame::Inertial`. On moving meshes, compute the
+ * quantity once in `Frame::Grid` and transform it with the overload below.
  */
-template <size_t Dim>
+template <size_t Dim, typename TargetFrame>
 void metric_identity_det_jac_times_inv_jac(
     gsl::not_null<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
-                                  Frame::Inertial>*>
+                                  TargetFrame>*>
         det_jac_times_inverse_jacobian,
     const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
-    const Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>&
+    const tnsr::I<DataVector, Dim, TargetFrame>& inertial_coords,
+    const Jacobian<DataVector, Dim, Frame::ElementLogical, TargetFrame>&
         jacobian);
 
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Transform the metric identity-satisfying Jacobian determinant times
+ * inverse Jacobian from the grid to the inertial frame when the
+ * grid-to-inertial map is affine.
+ *
+ * \details For a map \f$x^i = M^i{}_j y^j + b^i\f$ (e.g. a rigid rotation,
+ * translation, and expansion of the grid frame \f$y\f$) we have
+ *
+ * \f{align*}{
+ * J\frac{\partial\xi^{\hat{\imath}}}{\partial x^j} =
+ * \left(J\frac{\partial\xi^{\hat{\imath}}}{\partial y^k}\right)
+ * \det(M) (M^{-1})^k{}_j.
+ * \f}
+ *
+ * Since \f$M\f$ is constant over the element, the result satisfies the
+ * discrete metric identities exactly if the grid-frame quantity does. This
+ * lets elements on moving meshes compute the time-independent grid-frame
+ * quantity with the derivative operations once, and only apply the
+ * time-dependent matrix at each (sub)step. The translation \f$b\f$ does not
+ * enter. Without the translation, the result equals the quantity computed
+ * directly from the inertial coordinates up to roundoff.
+ */
+template <size_t Dim>
+void metric_identity_det_jac_times_inv_jac(
+    gsl::not_null<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                                  Frame::Inertial>*>
+        det_jac_times_inverse_jacobian,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>&
+        grid_det_jac_times_inverse_jacobian,
+    const domain::CoordinateMaps::AffineTransformation<Dim>&
+        grid_to_inertial_map);
+
 /*!
  * \ingroup DiscontinuousGalerkinGroup
  * \brief Compute the Jacobian, inverse Jacobian, and determinant of the
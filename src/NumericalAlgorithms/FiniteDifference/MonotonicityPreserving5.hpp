@@ -103,6 +103,7 @@ struct MonotonicityPreserving5Reconstructor {
   }
 
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
+  static constexpr bool vectorize_over_stripes = true;
 };
 }  // namespace detail
 
@@ -224,6 +224,7 @@ struct PositivityPreservingAdaptiveOrderReconstructor {
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() {
     return Use9thOrder ? 9 : (Use7thOrder ? 7 : 5);
   }
+  static constexpr bool vectorize_over_stripes = true;
 };
 }  // namespace detail
 
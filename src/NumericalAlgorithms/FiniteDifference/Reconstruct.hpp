@@ -68,10 +68,19 @@ namespace fd {
  *   \f$u_{i-1}\f$ is at `u[-stride]`. The returned values are the
  *   reconstructed solution on the lower and upper side of the cell.
  *
- * \note Currently the stride is always one because we transpose the data before
- * reconstruction. However, it may be faster to have a non-unit stride without
- * the transpose. We have the `stride` parameter in the reconstruction schemes
- * to make testing performance easier in the future.
+ * `Reconstructor` classes may additionally define
+ * `static constexpr bool vectorize_over_stripes = true;` to reconstruct
+ * several stripes of cells at once. The stripes are interleaved into a buffer
+ * and `pointwise` is called with a non-unit stride in a loop over the
+ * stripes that the compiler can vectorize. This pays off for reconstructors
+ * with expensive nonlinear weights, like WCNS and monotonicity-preserving
+ * schemes, and does not change the results.
+ *
+ * \note Apart from `vectorize_over_stripes`, the stride is always one because
+ * we transpose the data before reconstruction. However, it may be faster to
+ * have a non-unit stride without the transpose. We have the `stride`
+ * parameter in the reconstruction schemes to make testing performance easier
+ * in the future.
  *
  * Here is an ASCII illustration of the names of various quantities and where in
  * the cells they are:
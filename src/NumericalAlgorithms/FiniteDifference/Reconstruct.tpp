@@ -5,7 +5,12 @@
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -16,6 +21,8 @@
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/System/TaskPool.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace fd::reconstruction {
 namespace detail {
@@ -76,6 +83,146 @@ auto u_to_reconstruct_impl(const DataVector& volume_data,
   }
 }
 
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(vectorize_over_stripes)
+
+// The number of stripes reconstructed together by
+// `reconstruct_stripes_in_lanes`, enough to fill an AVX-512 register.
+constexpr size_t number_of_stripe_lanes = 8;
+
+// Reconstructs `number_of_stripe_lanes` stripes at a time. The stripes,
+// including their ghost cells, are interleaved into a buffer so that the
+// same cell of consecutive stripes is contiguous. The pointwise
+// reconstruction is then called with a stride of `number_of_stripe_lanes`
+// in an inner loop over the stripes, which the compiler can vectorize since
+// the stripes are independent. This is worthwhile for reconstructors with
+// expensive nonlinear weights, for which the cost of interleaving the data is
+// negligible. The results are the same as those of `reconstruct_impl`.
+template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
+          typename... ArgsForReconstructor>
+void reconstruct_stripes_in_lanes(
+    const gsl::not_null<gsl::span<double>*> recons_upper,
+    const gsl::not_null<gsl::span<double>*> recons_lower,
+    [[maybe_unused]] const gsl::not_null<gsl::span<std::uint8_t>*>
+        reconstruction_order,
+    const gsl::span<const double>& volume_vars,
+    const gsl::span<const double>& lower_ghost_data,
+    const gsl::span<const double>& upper_ghost_data,
+    const Index<Dim>& volume_extents, const size_t number_of_variables,
+    const ArgsForReconstructor&... args_for_reconstructor) {
+  using std::get;
+  using std::min;
+  constexpr size_t lanes = number_of_stripe_lanes;
+  constexpr size_t stencil_width = Reconstructor::stencil_width();
+  const size_t ghost_zone_for_stencil = (stencil_width - 1) / 2;
+  // Assume we send one extra ghost cell so we can reconstruct our neighbor's
+  // external data.
+  const size_t ghost_pts_in_neighbor_data = ghost_zone_for_stencil + 1;
+  const size_t stripe_size = volume_extents[0];
+  ASSERT(stripe_size >= stencil_width - 1,
+         " Subcell volume extent (current value: "
+             << stripe_size
+             << ") must be not smaller than the stencil width (current value: "
+             << stencil_width << ") minus 1");
+
+  const size_t number_of_stripes_per_variable =
+      volume_extents.slice_away(0).product();
+  const size_t number_of_stripes =
+      number_of_stripes_per_variable * number_of_variables;
+  if constexpr (ReturnReconstructionOrder) {
+    ASSERT(reconstruction_order->size() ==
+               (number_of_stripes_per_variable * (stripe_size + 2)),
+           "Expected size "
+               << (number_of_stripes_per_variable * (stripe_size + 2))
+               << " for reconstruction_order but got "
+               << reconstruction_order->size());
+  }
+
+  // The cells of the stripes including the ghost cells on both sides, and the
+  // reconstructed values of the cells from the last lower ghost cell to the
+  // first upper ghost cell.
+  const size_t padded_stripe_size =
+      stripe_size + 2 * ghost_pts_in_neighbor_data;
+  const size_t number_of_reconstructed_cells = stripe_size + 2;
+  DataVector buffer{lanes *
+                    (padded_stripe_size + 2 * number_of_reconstructed_cells)};
+  using PointwiseResult = std::decay_t<decltype(Reconstructor::pointwise(
+      buffer.data(), 1, args_for_reconstructor...))>;
+  constexpr bool store_order = ReturnReconstructionOrder and
+                               std::tuple_size_v<PointwiseResult> > 2;
+  double* const interleaved_vars = buffer.data();
+  double* const interleaved_upper =
+      interleaved_vars + lanes * padded_stripe_size;
+  double* const interleaved_lower =
+      interleaved_upper + lanes * number_of_reconstructed_cells;
+
+  for (size_t first_stripe = 0; first_stripe < number_of_stripes;
+       first_stripe += lanes) {
+    const size_t active_lanes = min(lanes, number_of_stripes - first_stripe);
+    for (size_t lane = 0; lane < active_lanes; ++lane) {
+      const size_t stripe = first_stripe + lane;
+      for (size_t j = 0; j < ghost_pts_in_neighbor_data; ++j) {
+        interleaved_vars[j * lanes + lane] =
+            lower_ghost_data[stripe * ghost_pts_in_neighbor_data + j];
+        interleaved_vars[(ghost_pts_in_neighbor_data + stripe_size + j) *
+                             lanes +
+                         lane] =
+            upper_ghost_data[stripe * ghost_pts_in_neighbor_data + j];
+      }
+      for (size_t j = 0; j < stripe_size; ++j) {
+        interleaved_vars[(ghost_pts_in_neighbor_data + j) * lanes + lane] =
+            volume_vars[stripe * stripe_size + j];
+      }
+    }
+    // Fill the unused lanes of the last batch with a valid stripe, which
+    // costs nothing extra to reconstruct when the loop is vectorized.
+    for (size_t lane = active_lanes; lane < lanes; ++lane) {
+      for (size_t j = 0; j < padded_stripe_size; ++j) {
+        interleaved_vars[j * lanes + lane] = interleaved_vars[j * lanes];
+      }
+    }
+
+    // Cell `cell` is the last lower ghost cell for `cell == 0` and the first
+    // upper ghost cell for `cell == stripe_size + 1`.
+    for (size_t cell = 0; cell < number_of_reconstructed_cells; ++cell) {
+      const double* const cell_vars =
+          interleaved_vars + (cell + ghost_zone_for_stencil) * lanes;
+      [[maybe_unused]] std::array<std::uint8_t, lanes> orders{};
+      for (size_t lane = 0; lane < lanes; ++lane) {
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            cell_vars + lane, static_cast<int>(lanes),
+            args_for_reconstructor...);
+        interleaved_upper[cell * lanes + lane] = get<0>(upper_lower_and_order);
+        interleaved_lower[cell * lanes + lane] = get<1>(upper_lower_and_order);
+        if constexpr (store_order) {
+          gsl::at(orders, lane) =
+              static_cast<std::uint8_t>(get<2>(upper_lower_and_order));
+        }
+      }
+      if constexpr (store_order) {
+        for (size_t lane = 0; lane < active_lanes; ++lane) {
+          auto& order = (*reconstruction_order)
+              [((first_stripe + lane) % number_of_stripes_per_variable) *
+                   number_of_reconstructed_cells +
+               cell];
+          order = min(gsl::at(orders, lane), order);
+        }
+      }
+    }
+
+    // The lower side of the first face comes from the last lower ghost cell
+    // and the upper side of the last face from the first upper ghost cell.
+    for (size_t lane = 0; lane < active_lanes; ++lane) {
+      const size_t recons_offset = (first_stripe + lane) * (stripe_size + 1);
+      for (size_t face = 0; face < stripe_size + 1; ++face) {
+        (*recons_upper)[recons_offset + face] =
+            interleaved_upper[(face + 1) * lanes + lane];
+        (*recons_lower)[recons_offset + face] =
+            interleaved_lower[face * lanes + lane];
+      }
+    }
+  }
+}
+
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
           typename... ArgsForReconstructor>
 void reconstruct_impl(
@@ -90,6 +237,14 @@ void reconstruct_impl(
     const ArgsForReconstructor&... args_for_reconstructor) {
   using std::get;
   using std::min;
+  if constexpr (get_vectorize_over_stripes_or_default_v<Reconstructor,
+                                                        false>) {
+    reconstruct_stripes_in_lanes<ReturnReconstructionOrder, Reconstructor>(
+        recons_upper, recons_lower, reconstruction_order, volume_vars,
+        lower_ghost_data, upper_ghost_data, volume_extents, number_of_variables,
+        args_for_reconstructor...);
+    return;
+  }
   constexpr size_t stencil_width = Reconstructor::stencil_width();
   ASSERT(stencil_width % 2 == 1, "The stencil with should be odd but got "
                                      << stencil_width
@@ -262,6 +417,58 @@ void reconstruct_impl(
   }  // for slices
 }
 
+// Splits the variables into chunks that idle PEs can help with, see
+// `sys::TaskPool`. The reconstruction order is the minimum over all
+// variables, so it is only split when the order isn't returned.
+template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
+          typename... ArgsForReconstructor>
+void reconstruct_variables_in_tasks(
+    const gsl::not_null<gsl::span<double>*> recons_upper,
+    const gsl::not_null<gsl::span<double>*> recons_lower,
+    const gsl::not_null<gsl::span<std::uint8_t>*> reconstruction_order,
+    const gsl::span<const double>& volume_vars,
+    const gsl::span<const double>& lower_ghost_data,
+    const gsl::span<const double>& upper_ghost_data,
+    const Index<Dim>& volume_extents, const size_t number_of_variables,
+    const ArgsForReconstructor&... args_for_reconstructor) {
+  if (ReturnReconstructionOrder or number_of_variables < 2) {
+    reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
+        recons_upper, recons_lower, reconstruction_order, volume_vars,
+        lower_ghost_data, upper_ghost_data, volume_extents, number_of_variables,
+        args_for_reconstructor...);
+  } else {
+    const size_t volume_size = volume_vars.size() / number_of_variables;
+    const size_t ghost_size = lower_ghost_data.size() / number_of_variables;
+    const size_t recons_size = recons_upper->size() / number_of_variables;
+    sys::task_pool().parallel_for(
+        number_of_variables, sys::min_items_per_task(volume_size),
+        [&recons_upper, &recons_lower, &reconstruction_order, &volume_vars,
+         &lower_ghost_data, &upper_ghost_data, &volume_extents,
+         &args_for_reconstructor..., volume_size, ghost_size, recons_size](
+            const size_t first_variable, const size_t end_variable) {
+          const size_t number_of_chunk_variables =
+              end_variable - first_variable;
+          gsl::span<double> chunk_upper = recons_upper->subspan(
+              first_variable * recons_size,
+              number_of_chunk_variables * recons_size);
+          gsl::span<double> chunk_lower = recons_lower->subspan(
+              first_variable * recons_size,
+              number_of_chunk_variables * recons_size);
+          reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
+              make_not_null(&chunk_upper), make_not_null(&chunk_lower),
+              reconstruction_order,
+              volume_vars.subspan(first_variable * volume_size,
+                                  number_of_chunk_variables * volume_size),
+              lower_ghost_data.subspan(first_variable * ghost_size,
+                                       number_of_chunk_variables * ghost_size),
+              upper_ghost_data.subspan(first_variable * ghost_size,
+                                       number_of_chunk_variables * ghost_size),
+              volume_extents, number_of_chunk_variables,
+              args_for_reconstructor...);
+        });
+  }
+}
+
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
           typename... ArgsForReconstructor>
 void reconstruct_impl(
@@ -312,7 +519,7 @@ void reconstruct_impl(
   // Because std::optional.value_or returns by value we want to ensure that we
   // don't copy any data.
   gsl::span<std::uint8_t> empty_span{};
-  reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
+  reconstruct_variables_in_tasks<ReturnReconstructionOrder, Reconstructor>(
       make_not_null(&(*reconstructed_upper_side_of_face_vars)[0]),
       make_not_null(&(*reconstructed_lower_side_of_face_vars)[0]),
       make_not_null(&(ReturnReconstructionOrder
@@ -351,7 +558,7 @@ void reconstruct_impl(
         gsl::make_span(buffer.data() + recons_offset_in_buffer, recons_size);
     gsl::span<double> recons_lower_view = gsl::make_span(
         buffer.data() + recons_offset_in_buffer + recons_size, recons_size);
-    reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
+    reconstruct_variables_in_tasks<ReturnReconstructionOrder, Reconstructor>(
         make_not_null(&recons_upper_view), make_not_null(&recons_lower_view),
         make_not_null(&(ReturnReconstructionOrder
                             ? reconstruction_order->value()[1]
@@ -387,7 +594,7 @@ void reconstruct_impl(
                     ghost_cell_vars.at(Direction<Dim>::upper_zeta()).data(),
                     chunk_size, number_of_neighbor_chunks);
 
-      reconstruct_impl<ReturnReconstructionOrder, Reconstructor>(
+      reconstruct_variables_in_tasks<ReturnReconstructionOrder, Reconstructor>(
           make_not_null(&recons_upper_view), make_not_null(&recons_lower_view),
           make_not_null(&(ReturnReconstructionOrder
                               ? reconstruction_order->value()[2]
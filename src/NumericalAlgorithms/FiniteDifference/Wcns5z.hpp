@@ -119,6 +119,7 @@ struct Wcns5zReconstructor {
   }
 
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
+  static constexpr bool vectorize_over_stripes = true;
 };
 
 template <size_t NonlinearWeightExponent>
@@ -129,6 +130,7 @@ struct Wcns5zReconstructor<NonlinearWeightExponent, void> {
     return Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
   }
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
+  static constexpr bool vectorize_over_stripes = true;
 };
 
 }  // namespace detail
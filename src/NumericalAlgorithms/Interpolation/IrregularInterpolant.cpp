@@ -6,13 +6,19 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <pup.h>
+#include <pup_stl.h>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
 // IWYU pragma: no_forward_declare Tensor
 
 namespace {
@@ -42,26 +48,17 @@ std::vector<double> fd_stencil(const DataVector& xi_source,
   return result;
 }
 
-template <size_t Dim>
-Matrix interpolation_matrix(
-    const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& points);
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<1>& mesh,
-    const tnsr::I<DataVector, 1, Frame::ElementLogical>& points) {
-  if (mesh.basis()[0] == Spectral::Basis::FiniteDifference) {
-    auto source_xi = logical_coordinates(mesh);
-    const auto number_of_source_points = mesh.number_of_grid_points();
-    const DataVector xi_source(get<0>(source_xi).data(),
-                               number_of_source_points);
-    const auto number_of_target_points = get<0>(points).size();
+// The interpolation matrix in one dimension, with one row per target point.
+Matrix one_dimensional_matrix(const Mesh<1>& mesh,
+                              const DataVector& target_points) {
+  if (mesh.basis(0) == Spectral::Basis::FiniteDifference) {
+    const auto source_xi = logical_coordinates(mesh);
+    const DataVector& xi_source = get<0>(source_xi);
+    const size_t number_of_target_points = target_points.size();
     Matrix result(number_of_target_points, mesh.number_of_grid_points());
     for (size_t p = 0; p < number_of_target_points; ++p) {
-      const double xi_target = get<0>(points)[p];
-      const auto stencil = fd_stencil(xi_source, xi_target);
-      for (size_t i = 0; i < number_of_source_points; ++i) {
+      const auto stencil = fd_stencil(xi_source, target_points[p]);
+      for (size_t i = 0; i < mesh.number_of_grid_points(); ++i) {
         result(p, i) = stencil[i];
       }
     }
@@ -69,135 +66,59 @@ Matrix interpolation_matrix(
   }
 
   // Not FD, so use spectral interpolation
-  return Spectral::interpolation_matrix(mesh, get<0>(points));
+  return Spectral::interpolation_matrix(mesh, target_points);
 }
 
-template <>
-Matrix interpolation_matrix(
-    const Mesh<2>& mesh,
-    const tnsr::I<DataVector, 2, Frame::ElementLogical>& points) {
-  const auto number_of_target_points = get<0>(points).size();
-  Matrix result(number_of_target_points, mesh.number_of_grid_points());
-
-  if (mesh.basis()[0] == Spectral::Basis::FiniteDifference) {
-    ASSERT(mesh.basis()[1] == Spectral::Basis::FiniteDifference,
-           "Mixed FD and DG bases are not supported. Mesh = " << mesh);
-    auto source_xi = logical_coordinates(mesh);
-    DataVector xi_source{get<0>(source_xi).data(), mesh.extents(0)};
-    DataVector eta_source;
-    if (mesh.extents(1) == mesh.extents(0)) {
-      eta_source.set_data_ref(&xi_source);
-    } else {
-      eta_source.destructive_resize(mesh.extents(1));
-      for (size_t j = 0; j < mesh.extents(1); ++j) {
-        eta_source[j] = get<1>(source_xi)[j * mesh.extents(0)];
-      }
-    }
-    for (size_t p = 0; p < number_of_target_points; ++p) {
-      const double xi_target = get<0>(points)[p];
-      const double eta_target = get<1>(points)[p];
-      const auto xi_stencil = fd_stencil(xi_source, xi_target);
-      const auto eta_stencil = fd_stencil(eta_source, eta_target);
-      for (size_t j = 0, s = 0; j < mesh.extents(1); ++j) {
-        for (size_t i = 0; i < mesh.extents(0); ++i) {
-          result(p, s) = xi_stencil[i] * eta_stencil[j];
-          ++s;
-        }
-      }
-    }
-    return result;
-  }
-
-  // Not FD, so use spectral interpolation
-  const std::array<Matrix, 2> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points))}};
-
-  // First dimension of DataVector varies fastest.
-  for (size_t j = 0, s = 0; j < mesh.extents(1); ++j) {
-    for (size_t i = 0; i < mesh.extents(0); ++i) {
-      for (size_t p = 0; p < number_of_target_points; ++p) {
-        result(p, s) = matrices[0](p, i) * matrices[1](p, j);
-      }
-      ++s;
-    }
+template <size_t Dim>
+std::array<Matrix, Dim> one_dimensional_matrices(
+    const Mesh<Dim>& mesh,
+    const tnsr::I<DataVector, Dim, Frame::ElementLogical>& points) {
+  ASSERT(alg::all_of(mesh.basis(),
+                     [](const Spectral::Basis basis) {
+                       return basis == Spectral::Basis::FiniteDifference;
+                     }) or
+             alg::none_of(mesh.basis(),
+                          [](const Spectral::Basis basis) {
+                            return basis == Spectral::Basis::FiniteDifference;
+                          }),
+         "Mixed FD and DG bases are not supported. Mesh = " << mesh);
+  std::array<Matrix, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(result, d) =
+        one_dimensional_matrix(mesh.slice_through(d), points.get(d));
   }
   return result;
 }
 
-template <>
-Matrix interpolation_matrix(
-    const Mesh<3>& mesh,
-    const tnsr::I<DataVector, 3, Frame::ElementLogical>& points) {
-  const auto number_of_target_points = get<0>(points).size();
+// The tensor product of the one-dimensional matrices.
+template <size_t Dim>
+Matrix interpolation_matrix(const Mesh<Dim>& mesh,
+                            const std::array<Matrix, Dim>& matrices) {
+  const size_t number_of_target_points = matrices[0].rows();
   Matrix result(number_of_target_points, mesh.number_of_grid_points());
-
-  if (mesh.basis()[0] == Spectral::Basis::FiniteDifference) {
-    ASSERT(mesh.basis()[1] == Spectral::Basis::FiniteDifference and
-               mesh.basis()[2] == Spectral::Basis::FiniteDifference,
-           "Mixed FD and DG bases are not supported. Mesh = " << mesh);
-    auto source_xi = logical_coordinates(mesh);
-    DataVector xi_source{get<0>(source_xi).data(), mesh.extents(0)};
-    DataVector eta_source;
-    if (mesh.extents(1) == mesh.extents(0)) {
-      eta_source.set_data_ref(&xi_source);
-    } else {
-      eta_source.destructive_resize(mesh.extents(1));
-      for (size_t j = 0; j < mesh.extents(1); ++j) {
-        eta_source[j] = get<1>(source_xi)[j * mesh.extents(0)];
-      }
-    }
-    DataVector zeta_source;
-    if (mesh.extents(2) == mesh.extents(0)) {
-      zeta_source.set_data_ref(&xi_source);
-    } else if (mesh.extents(2) == mesh.extents(1)) {
-      zeta_source.set_data_ref(&eta_source);
-    } else {
-      zeta_source.destructive_resize(mesh.extents(2));
-      for (size_t k = 0; k < mesh.extents(2); ++k) {
-        zeta_source[k] =
-            get<2>(source_xi)[k * mesh.extents(0) * mesh.extents(1)];
-      }
-    }
+  // First dimension of DataVector varies fastest.
+  for (IndexIterator<Dim> index(mesh.extents()); index; ++index) {
+    const size_t s = index.collapsed_index();
     for (size_t p = 0; p < number_of_target_points; ++p) {
-      const double xi_target = get<0>(points)[p];
-      const double eta_target = get<1>(points)[p];
-      const double zeta_target = get<2>(points)[p];
-      const auto xi_stencil = fd_stencil(xi_source, xi_target);
-      const auto eta_stencil = fd_stencil(eta_source, eta_target);
-      const auto zeta_stencil = fd_stencil(zeta_source, zeta_target);
-      for (size_t k = 0, s = 0; k < mesh.extents(2); ++k) {
-        for (size_t j = 0; j < mesh.extents(1); ++j) {
-          for (size_t i = 0; i < mesh.extents(0); ++i) {
-            result(p, s) = xi_stencil[i] * eta_stencil[j] * zeta_stencil[k];
-            ++s;
-          }
-        }
-      }
+      result(p, s) = matrices[0](p, index()[0]);
     }
-    return result;
-  }
-
-  // Not FD, so use spectral interpolation
-  const std::array<Matrix, 3> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(2), get<2>(points))}};
-
-  // First dimension of DataVector varies fastest.
-  for (size_t k = 0, s = 0; k < mesh.extents(2); ++k) {
-    for (size_t j = 0; j < mesh.extents(1); ++j) {
-      for (size_t i = 0; i < mesh.extents(0); ++i) {
-        for (size_t p = 0; p < number_of_target_points; ++p) {
-          result(p, s) =
-              matrices[0](p, i) * matrices[1](p, j) * matrices[2](p, k);
-        }
-        ++s;
+    for (size_t d = 1; d < Dim; ++d) {
+      for (size_t p = 0; p < number_of_target_points; ++p) {
+        result(p, s) *= gsl::at(matrices, d)(p, index()[d]);
       }
     }
   }
   return result;
 }
+
+// Adds `weights * values` to `sum` for every target point, where `weights` is
+// a column of a one-dimensional matrix.
+void add_product(const gsl::not_null<double*> sum, const double* const weights,
+                 const double* const values, const size_t size) {
+  for (size_t p = 0; p < size; ++p) {
+    sum.get()[p] += weights[p] * values[p];
+  }
+}
 }  // namespace
 
 namespace intrp {
@@ -209,18 +130,85 @@ template <size_t Dim>
 Irregular<Dim>::Irregular(const Mesh<Dim>& source_mesh,
                           const tnsr::I<DataVector, Dim, Frame::ElementLogical>&
                               target_points)
-    : interpolation_matrix_(interpolation_matrix(source_mesh, target_points)) {}
+    : number_of_target_points_(get<0>(target_points).size()),
+      number_of_source_points_(source_mesh.number_of_grid_points()),
+      one_dimensional_matrices_(
+          one_dimensional_matrices(source_mesh, target_points)) {
+  if (number_of_target_points_ > max_points_for_direct_evaluation) {
+    interpolation_matrix_ =
+        interpolation_matrix(source_mesh, one_dimensional_matrices_);
+    one_dimensional_matrices_ = std::array<Matrix, Dim>{};
+  }
+}
 
 template <size_t Dim>
 void Irregular<Dim>::pup(PUP::er& p) {
+  p | number_of_target_points_;
+  p | number_of_source_points_;
   p | interpolation_matrix_;
+  p | one_dimensional_matrices_;
+}
+
+template <size_t Dim>
+bool Irregular<Dim>::uses_direct_evaluation() const {
+  return number_of_target_points_ <= max_points_for_direct_evaluation;
+}
+
+template <size_t Dim>
+void Irregular<Dim>::interpolate_directly(
+    const gsl::not_null<double*> result, const double* const source,
+    const size_t number_of_components) const {
+  const size_t m = number_of_target_points_;
+  if (m == 0) {
+    return;
+  }
+  // The sums over the first `d + 1` dimensions of the source values, for
+  // every target point, are accumulated in `partial_sums[d]`, and the sums
+  // over all dimensions directly in `result`.
+  std::array<size_t, Dim> extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(extents, d) = gsl::at(one_dimensional_matrices_, d).columns();
+  }
+  std::array<DataVector, Dim> partial_sums{};
+  for (size_t d = 0; d + 1 < Dim; ++d) {
+    gsl::at(partial_sums, d) = DataVector(m, 0.0);
+  }
+  const auto column = [this](const size_t d, const size_t i) {
+    const Matrix& matrix = gsl::at(one_dimensional_matrices_, d);
+    return matrix.data() + i * matrix.spacing();
+  };
+
+  for (size_t c = 0; c < number_of_components; ++c) {
+    const double* const values = source + c * number_of_source_points_;
+    double* const sum = result.get() + c * m;
+    std::fill(sum, sum + m, 0.0);
+    double* const innermost_sum = Dim == 1 ? sum : partial_sums[0].data();
+    for (IndexIterator<Dim> index(Index<Dim>{extents}); index; ++index) {
+      // Contract the first dimension, which the source values are ordered by.
+      const double value = values[index.collapsed_index()];
+      const double* const weights = column(0, index()[0]);
+      for (size_t p = 0; p < m; ++p) {
+        innermost_sum[p] += weights[p] * value;
+      }
+      // Once a dimension has been summed over, contract the next one.
+      for (size_t d = 0;
+           d + 1 < Dim and index()[d] + 1 == gsl::at(extents, d); ++d) {
+        DataVector& finished_sum = gsl::at(partial_sums, d);
+        double* const next_sum =
+            d + 2 == Dim ? sum : gsl::at(partial_sums, d + 1).data();
+        add_product(make_not_null(next_sum), column(d + 1, index()[d + 1]),
+                    finished_sum.data(), m);
+        finished_sum = 0.0;
+      }
+    }
+  }
 }
 
 template <size_t Dim>
 void Irregular<Dim>::interpolate(const gsl::not_null<DataVector*> result,
                                  const DataVector& input) const {
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
   ASSERT(k == input.size(),
          "Number of points in 'input', "
              << input.size()
@@ -229,11 +217,40 @@ void Irregular<Dim>::interpolate(const gsl::not_null<DataVector*> result,
   if (result->size() != m) {
     result->destructive_resize(m);
   }
+  if (uses_direct_evaluation()) {
+    interpolate_directly(make_not_null(result->data()), input.data(), 1);
+    return;
+  }
   dgemv_('n', m, k, 1.0, interpolation_matrix_.data(),
          interpolation_matrix_.spacing(), input.data(), 1, 0.0, result->data(),
          1);
 }
 
+template <size_t Dim>
+void Irregular<Dim>::interpolate(const gsl::not_null<DataVector*> result,
+                                 const DataVector& input,
+                                 const size_t number_of_components) const {
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
+  const size_t n = number_of_components;
+  ASSERT(k * n == input.size(),
+         "Number of points in 'input', "
+             << input.size() << ",\n disagrees with the size of the "
+             << "source_mesh, " << k
+             << ", that was passed into the constructor times the number of "
+             << "components, " << n);
+  if (result->size() != m * n) {
+    result->destructive_resize(m * n);
+  }
+  if (uses_direct_evaluation()) {
+    interpolate_directly(make_not_null(result->data()), input.data(), n);
+    return;
+  }
+  dgemm_('n', 'n', m, n, k, 1.0, interpolation_matrix_.data(),
+         interpolation_matrix_.spacing(), input.data(), k, 0.0, result->data(),
+         m);
+}
+
 template <size_t Dim>
 DataVector Irregular<Dim>::interpolate(const DataVector& input) const {
   DataVector result{input.size()};
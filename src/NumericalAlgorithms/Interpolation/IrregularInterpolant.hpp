@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
@@ -31,9 +32,22 @@ namespace intrp {
 /// linear interpolation is done in each dimension; otherwise it uses the
 /// barycentric interpolation provided by Spectral::interpolation_matrix in each
 /// dimension.
+///
+/// For more than `max_points_for_direct_evaluation` target points the
+/// one-dimensional interpolation matrices are combined into a single matrix
+/// from all grid points to all target points, which is applied with BLAS. For
+/// fewer target points, e.g., when an element holds only a handful of the
+/// points of a surface or the points change every time they are interpolated
+/// to, building and storing that matrix costs more than it saves. Instead the
+/// one-dimensional matrices are contracted with the source data one dimension
+/// at a time, with the innermost loops running over the target points.
 template <size_t Dim>
 class Irregular {
  public:
+  /// The largest number of target points for which the interpolation is
+  /// done without building the full interpolation matrix.
+  static constexpr size_t max_points_for_direct_evaluation = 32;
+
   Irregular(
       const Mesh<Dim>& source_mesh,
       const tnsr::I<DataVector, Dim, Frame::ElementLogical>& target_points);
@@ -68,11 +82,39 @@ class Irregular {
   DataVector interpolate(const DataVector& input) const;
   /// @}
 
+  /*!
+   * \brief Interpolate `number_of_components` components that are stored one
+   * after the other in `input` onto the target points.
+   *
+   * This is as efficient as the `Variables` interface, but works with data
+   * that is not stored in a `Variables`, such as tensor components read from
+   * volume data files. The interpolated components are stored one after the
+   * other in `result`, which is resized to the proper size.
+   */
+  void interpolate(gsl::not_null<DataVector*> result, const DataVector& input,
+                   size_t number_of_components) const;
+
  private:
   friend bool operator==(const Irregular& lhs, const Irregular& rhs) {
-    return lhs.interpolation_matrix_ == rhs.interpolation_matrix_;
+    return lhs.number_of_target_points_ == rhs.number_of_target_points_ and
+           lhs.number_of_source_points_ == rhs.number_of_source_points_ and
+           lhs.interpolation_matrix_ == rhs.interpolation_matrix_ and
+           lhs.one_dimensional_matrices_ == rhs.one_dimensional_matrices_;
   }
+
+  bool uses_direct_evaluation() const;
+
+  // Interpolates the `number_of_components` components of `source`, stored
+  // one after the other, to `result`, without the full interpolation matrix.
+  void interpolate_directly(gsl::not_null<double*> result, const double* source,
+                            size_t number_of_components) const;
+
+  size_t number_of_target_points_{0};
+  size_t number_of_source_points_{0};
+  // Only one of `interpolation_matrix_` and `one_dimensional_matrices_` is
+  // set, depending on the number of target points.
   Matrix interpolation_matrix_;
+  std::array<Matrix, Dim> one_dimensional_matrices_;
 };
 
 template <size_t Dim>
@@ -84,8 +126,8 @@ void Irregular<Dim>::interpolate(
   //   matrix Interp is m rows by k columns
   //   matrix Source is k rows by n columns
   //   matrix Result is m rows by n columns
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points_;
+  const size_t k = number_of_source_points_;
   const size_t n = vars.number_of_independent_components;
   ASSERT(k == vars.number_of_grid_points(),
          "Number of grid points in source 'vars', "
@@ -95,6 +137,10 @@ void Irregular<Dim>::interpolate(
   if (result->number_of_grid_points() != m) {
     *result = Variables<TagsList>(m, 0.);
   }
+  if (uses_direct_evaluation()) {
+    interpolate_directly(make_not_null(result->data()), vars.data(), n);
+    return;
+  }
   dgemm_('n', 'n', m, n, k, 1.0, interpolation_matrix_.data(),
          interpolation_matrix_.spacing(), vars.data(), k, 0.0, result->data(),
          m);
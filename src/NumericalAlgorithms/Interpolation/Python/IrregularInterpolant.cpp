@@ -5,12 +5,17 @@
 
 #include <array>
 #include <cstddef>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace py = pybind11;
 
@@ -32,7 +37,39 @@ void bind_irregular_impl(py::module& m) {  // NOLINT
       .def("interpolate",
            static_cast<DataVector (Irregular<Dim>::*)(const DataVector&) const>(
                &Irregular<Dim>::interpolate),
-           py::arg("input"));
+           py::arg("input"))
+      .def(
+          "interpolate",
+          [](const Irregular<Dim>& interpolant,
+             const py::array_t<double, py::array::c_style |
+                                           py::array::forcecast>& input) {
+            if (input.ndim() != 2) {
+              throw std::runtime_error(
+                  "Expected an array of shape (number_of_components, "
+                  "number_of_source_points), but it has " +
+                  std::to_string(input.ndim()) + " dimensions.");
+            }
+            const auto number_of_components =
+                static_cast<size_t>(input.shape(0));
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            const DataVector input_view{const_cast<double*>(input.data()),
+                                        static_cast<size_t>(input.size())};
+            DataVector result{};
+            interpolant.interpolate(make_not_null(&result), input_view,
+                                    number_of_components);
+            const size_t number_of_target_points =
+                number_of_components == 0
+                    ? 0
+                    : result.size() / number_of_components;
+            return py::array_t<double>(
+                std::vector<py::ssize_t>{
+                    input.shape(0),
+                    static_cast<py::ssize_t>(number_of_target_points)},
+                result.data());
+          },
+          py::arg("input"),
+          "Interpolate all components of a 2D array of shape "
+          "(number_of_components, number_of_source_points) at once.");
 }
 }  // namespace
 
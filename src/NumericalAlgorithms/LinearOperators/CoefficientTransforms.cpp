@@ -4,6 +4,8 @@
 #include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
@@ -12,11 +14,16 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"  // IWYU pragma: keep
 #include "DataStructures/ModalVector.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/StaticCache.hpp"
 
 // IWYU pragma: no_forward_declare Matrix
 
@@ -32,6 +39,257 @@ std::array<std::reference_wrapper<const Matrix>, Dim> make_transform_matrices(
                               {Spectral::modal_to_nodal_matrix(
                                   mesh.slice_through(Is))...}};
 }
+
+// Dimensions with at least this many points are transformed with the even-odd
+// decomposition below. Smaller dimensions are handled efficiently by the
+// sum-factorization kernels in `apply_matrices`.
+constexpr size_t min_extent_for_parity_split =
+    apply_matrices_detail::max_extent_for_small_kernels + 1;
+
+// Even-odd decomposition of the transform matrices (see e.g. Solomonoff, "A
+// fast algorithm for spectral differentiation", J. Comput. Phys. 98, 174
+// (1992)). The collocation points of the Legendre and Chebyshev bases are
+// symmetric about the origin and the basis functions have definite parity,
+// P_k(-x) = (-1)^k P_k(x). Therefore, the even modes only depend on the
+// symmetric part u_j + u_{N-1-j} of the nodal data and the odd modes only on
+// the antisymmetric part u_j - u_{N-1-j}, and vice versa for the transform
+// back to nodal space. This halves the number of operations of the dense
+// matrix multiplication.
+//
+// For the transform to modal space, `even` maps the symmetric parts (followed
+// by the center point if N is odd) to the even modes and `odd` maps the
+// antisymmetric parts to the odd modes. For the transform to nodal space,
+// `even` maps the even modes to the symmetric parts (followed by the center
+// point) and `odd` maps the odd modes to the antisymmetric parts.
+struct ParitySplitMatrices {
+  Matrix even;
+  Matrix odd;
+};
+
+ParitySplitMatrices make_parity_split_matrices(const Mesh<1>& mesh,
+                                               const bool nodal_to_modal) {
+  const size_t num_points = mesh.extents(0);
+  const size_t num_odd = num_points / 2;
+  const size_t num_even = num_points - num_odd;
+  ParitySplitMatrices result{Matrix(num_even, num_even, 0.0),
+                             Matrix(num_odd, num_odd, 0.0)};
+  if (nodal_to_modal) {
+    const Matrix& nodal_to_modal_matrix = Spectral::nodal_to_modal_matrix(mesh);
+    for (size_t i = 0; i < num_even; ++i) {
+      for (size_t j = 0; j < num_even; ++j) {
+        result.even(i, j) = nodal_to_modal_matrix(2 * i, j);
+      }
+    }
+    for (size_t i = 0; i < num_odd; ++i) {
+      for (size_t j = 0; j < num_odd; ++j) {
+        result.odd(i, j) = nodal_to_modal_matrix(2 * i + 1, j);
+      }
+    }
+  } else {
+    const Matrix& modal_to_nodal_matrix = Spectral::modal_to_nodal_matrix(mesh);
+    for (size_t j = 0; j < num_even; ++j) {
+      for (size_t i = 0; i < num_even; ++i) {
+        result.even(j, i) = modal_to_nodal_matrix(j, 2 * i);
+      }
+    }
+    for (size_t j = 0; j < num_odd; ++j) {
+      for (size_t i = 0; i < num_odd; ++i) {
+        result.odd(j, i) = modal_to_nodal_matrix(j, 2 * i + 1);
+      }
+    }
+  }
+  return result;
+}
+
+bool use_parity_split(const Mesh<1>& mesh) {
+  return mesh.extents(0) >= min_extent_for_parity_split and
+         (mesh.basis(0) == Spectral::Basis::Legendre or
+          mesh.basis(0) == Spectral::Basis::Chebyshev) and
+         (mesh.quadrature(0) == Spectral::Quadrature::Gauss or
+          mesh.quadrature(0) == Spectral::Quadrature::GaussLobatto);
+}
+
+const ParitySplitMatrices& parity_split_matrices(const Mesh<1>& mesh,
+                                                 const bool nodal_to_modal) {
+  const auto make_cache = [](const bool local_nodal_to_modal) {
+    return make_static_cache<
+        CacheRange<min_extent_for_parity_split,
+                   Spectral::maximum_number_of_points<
+                       Spectral::Basis::Legendre> +
+                       1>,
+        CacheEnumeration<Spectral::Basis, Spectral::Basis::Legendre,
+                         Spectral::Basis::Chebyshev>,
+        CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                         Spectral::Quadrature::GaussLobatto>>(
+        [local_nodal_to_modal](const size_t extents,
+                               const Spectral::Basis basis,
+                               const Spectral::Quadrature quadrature) {
+          return make_parity_split_matrices(
+              Mesh<1>{extents, basis, quadrature}, local_nodal_to_modal);
+        });
+  };
+  static const auto nodal_to_modal_cache = make_cache(true);
+  static const auto modal_to_nodal_cache = make_cache(false);
+  return nodal_to_modal ? nodal_to_modal_cache(mesh.extents(0), mesh.basis(0),
+                                               mesh.quadrature(0))
+                        : modal_to_nodal_cache(mesh.extents(0), mesh.basis(0),
+                                               mesh.quadrature(0));
+}
+
+// Multiplies each stripe of `data` by `matrix`. The data is laid out as
+// `data[(block * matrix.columns() + column) * stride + offset]` and the result
+// as `result[(block * matrix.rows() + row) * stride + offset]`.
+void multiply_stripes(const gsl::not_null<double*> result, const Matrix& matrix,
+                      const double* const data, const size_t stride,
+                      const size_t number_of_blocks) {
+  if (stride == 1) {
+    dgemm_<true>('N', 'N', matrix.rows(), number_of_blocks, matrix.columns(),
+                 1.0, matrix.data(), matrix.spacing(), data, matrix.columns(),
+                 0.0, result.get(), matrix.rows());
+    return;
+  }
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    dgemm_<true>('N', 'T', stride, matrix.rows(), matrix.columns(), 1.0,
+                 data + block * matrix.columns() * stride, stride,
+                 matrix.data(), matrix.spacing(), 0.0,
+                 result.get() + block * matrix.rows() * stride, stride);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// Transforms `data` in the dimension with `num_points` points, which has
+// `stride` points in lower dimensions and `number_of_blocks` points in higher
+// dimensions, using the even-odd decomposition.
+void parity_split_transform(const gsl::not_null<double*> result,
+                            const double* const data,
+                            const ParitySplitMatrices& matrices,
+                            const size_t num_points, const size_t stride,
+                            const size_t number_of_blocks,
+                            const bool nodal_to_modal) {
+  const size_t num_odd = num_points / 2;
+  const size_t num_even = num_points - num_odd;
+  DataVector buffer(2 * num_points * stride * number_of_blocks);
+  double* const even_in = buffer.data();
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  double* const odd_in = even_in + num_even * stride * number_of_blocks;
+  double* const even_out = odd_in + num_odd * stride * number_of_blocks;
+  double* const odd_out = even_out + num_even * stride * number_of_blocks;
+  const auto index = [&stride](const size_t block, const size_t size,
+                               const size_t i, const size_t offset) {
+    return (block * size + i) * stride + offset;
+  };
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    for (size_t offset = 0; offset < stride; ++offset) {
+      if (nodal_to_modal) {
+        for (size_t j = 0; j < num_odd; ++j) {
+          const double lower = data[index(block, num_points, j, offset)];
+          const double upper =
+              data[index(block, num_points, num_points - 1 - j, offset)];
+          even_in[index(block, num_even, j, offset)] = lower + upper;
+          odd_in[index(block, num_odd, j, offset)] = lower - upper;
+        }
+        if (num_even > num_odd) {
+          even_in[index(block, num_even, num_odd, offset)] =
+              data[index(block, num_points, num_odd, offset)];
+        }
+      } else {
+        for (size_t i = 0; i < num_odd; ++i) {
+          even_in[index(block, num_even, i, offset)] =
+              data[index(block, num_points, 2 * i, offset)];
+          odd_in[index(block, num_odd, i, offset)] =
+              data[index(block, num_points, 2 * i + 1, offset)];
+        }
+        if (num_even > num_odd) {
+          even_in[index(block, num_even, num_odd, offset)] =
+              data[index(block, num_points, num_points - 1, offset)];
+        }
+      }
+    }
+  }
+  multiply_stripes(even_out, matrices.even, even_in, stride, number_of_blocks);
+  multiply_stripes(odd_out, matrices.odd, odd_in, stride, number_of_blocks);
+  for (size_t block = 0; block < number_of_blocks; ++block) {
+    for (size_t offset = 0; offset < stride; ++offset) {
+      if (nodal_to_modal) {
+        for (size_t i = 0; i < num_odd; ++i) {
+          result.get()[index(block, num_points, 2 * i, offset)] =
+              even_out[index(block, num_even, i, offset)];
+          result.get()[index(block, num_points, 2 * i + 1, offset)] =
+              odd_out[index(block, num_odd, i, offset)];
+        }
+        if (num_even > num_odd) {
+          result.get()[index(block, num_points, num_points - 1, offset)] =
+              even_out[index(block, num_even, num_odd, offset)];
+        }
+      } else {
+        for (size_t j = 0; j < num_odd; ++j) {
+          const double even_part = even_out[index(block, num_even, j, offset)];
+          const double odd_part = odd_out[index(block, num_odd, j, offset)];
+          result.get()[index(block, num_points, j, offset)] =
+              even_part + odd_part;
+          result.get()[index(block, num_points, num_points - 1 - j, offset)] =
+              even_part - odd_part;
+        }
+        if (num_even > num_odd) {
+          result.get()[index(block, num_points, num_odd, offset)] =
+              even_out[index(block, num_even, num_odd, offset)];
+        }
+      }
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// Transforms real data one dimension at a time, using the even-odd
+// decomposition in dimensions with many Legendre or Chebyshev points. Returns
+// `false` without doing anything if no dimension benefits from it, so the
+// caller can apply the dense matrices in all dimensions at once.
+template <size_t Dim>
+bool transform_with_parity_split(const gsl::not_null<double*> result,
+                                 const double* const data,
+                                 const Mesh<Dim>& mesh,
+                                 const bool nodal_to_modal) {
+  bool any_dimension_is_split = false;
+  for (size_t d = 0; d < Dim; ++d) {
+    any_dimension_is_split |= use_parity_split(mesh.slice_through(d));
+  }
+  if (not any_dimension_is_split) {
+    return false;
+  }
+  const size_t num_points = mesh.number_of_grid_points();
+  DataVector buffers(Dim > 1 ? 2 * num_points : 0);
+  const Matrix empty{};
+  const double* source = data;
+  size_t stride = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Mesh<1> mesh_1d = mesh.slice_through(d);
+    const size_t extent = mesh_1d.extents(0);
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    double* const destination =
+        d + 1 == Dim ? result.get() : buffers.data() + (d % 2) * num_points;
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (use_parity_split(mesh_1d)) {
+      parity_split_transform(destination, source,
+                             parity_split_matrices(mesh_1d, nodal_to_modal),
+                             extent, stride, num_points / (stride * extent),
+                             nodal_to_modal);
+    } else {
+      auto matrices = make_array<Dim>(std::cref(empty));
+      gsl::at(matrices, d) =
+          nodal_to_modal ? std::cref(Spectral::nodal_to_modal_matrix(mesh_1d))
+                         : std::cref(Spectral::modal_to_nodal_matrix(mesh_1d));
+      DataVector destination_view(destination, num_points);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const DataVector source_view(const_cast<double*>(source), num_points);
+      apply_matrices(make_not_null(&destination_view), matrices, source_view,
+                     mesh.extents());
+    }
+    source = destination;
+    stride *= extent;
+  }
+  return true;
+}
 }  // namespace
 
 template <size_t Dim>
@@ -52,6 +310,10 @@ void to_modal_coefficients(gsl::not_null<ModalVector*> modal_coefficients,
                            const DataVector& nodal_coefficients,
                            const Mesh<Dim>& mesh) {
   modal_coefficients->destructive_resize(nodal_coefficients.size());
+  if (transform_with_parity_split(modal_coefficients->data(),
+                                  nodal_coefficients.data(), mesh, true)) {
+    return;
+  }
   apply_matrices<ModalVector>(
       modal_coefficients,
       make_transform_matrices<Dim>(mesh, true, std::make_index_sequence<Dim>{}),
@@ -93,6 +355,10 @@ void to_nodal_coefficients(const gsl::not_null<DataVector*> nodal_coefficients,
                            const ModalVector& modal_coefficients,
                            const Mesh<Dim>& mesh) {
   nodal_coefficients->destructive_resize(modal_coefficients.size());
+  if (transform_with_parity_split(nodal_coefficients->data(),
+                                  modal_coefficients.data(), mesh, false)) {
+    return;
+  }
   apply_matrices<DataVector>(nodal_coefficients,
                              make_transform_matrices<Dim>(
                                  mesh, false, std::make_index_sequence<Dim>{}),
@@ -11,6 +11,8 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Blas.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 // The 2D and 3D definite integrals have been optimized and are up to 2x faster
 // than the previous implementation. The main differences are
@@ -114,3 +116,83 @@ double definite_integral<3>(const DataVector& integrand, const Mesh<3>& mesh) {
   }
   return result;
 }
+
+namespace {
+// Tensor product of the 1D quadrature weights, i.e. the weights of the
+// quadrature on the full mesh
+template <size_t Dim>
+void volume_quadrature_weights(const gsl::not_null<DataVector*> weights,
+                               const Mesh<Dim>& mesh) {
+  weights->destructive_resize(mesh.number_of_grid_points());
+  *weights = 1.0;
+  if constexpr (Dim > 0) {
+    const auto sliced_meshes = mesh.slices();
+    size_t stride = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      const DataVector& weights_d =
+          Spectral::quadrature_weights(gsl::at(sliced_meshes, d));
+      const size_t extent = weights_d.size();
+      for (size_t s = 0; s < weights->size(); ++s) {
+        (*weights)[s] *= weights_d[(s / stride) % extent];
+      }
+      stride *= extent;
+    }
+  }
+}
+
+void contract_with_weights(const gsl::not_null<DataVector*> integrals,
+                           const DataVector& integrands,
+                           const DataVector& weights) {
+  const size_t num_points = weights.size();
+  ASSERT(num_points > 0 and integrands.size() % num_points == 0,
+         "The size of the integrands (" << integrands.size()
+                                        << ") is not a multiple of the number "
+                                           "of grid points ("
+                                        << num_points << ").");
+  const size_t num_integrands = integrands.size() / num_points;
+  integrals->destructive_resize(num_integrands);
+  if (num_integrands == 0) {
+    return;
+  }
+  dgemv_('T', num_points, num_integrands, 1.0, integrands.data(), num_points,
+         weights.data(), 1, 0.0, integrals->data(), 1);
+}
+}  // namespace
+
+template <size_t Dim>
+void definite_integrals(const gsl::not_null<DataVector*> integrals,
+                        const DataVector& integrands, const Mesh<Dim>& mesh) {
+  DataVector weights{};
+  volume_quadrature_weights(make_not_null(&weights), mesh);
+  contract_with_weights(integrals, integrands, weights);
+}
+
+template <size_t Dim>
+void definite_integrals(const gsl::not_null<DataVector*> integrals,
+                        const DataVector& integrands, const Mesh<Dim>& mesh,
+                        const DataVector& det_jacobian) {
+  ASSERT(det_jacobian.size() == mesh.number_of_grid_points(),
+         "num_grid_points = " << mesh.number_of_grid_points()
+                              << ", det_jacobian size = "
+                              << det_jacobian.size());
+  DataVector weights{};
+  volume_quadrature_weights(make_not_null(&weights), mesh);
+  weights *= det_jacobian;
+  contract_with_weights(integrals, integrands, weights);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                            \
+  template void definite_integrals(gsl::not_null<DataVector*> integrals, \
+                                   const DataVector& integrands,        \
+                                   const Mesh<DIM(data)>& mesh);        \
+  template void definite_integrals(gsl::not_null<DataVector*> integrals, \
+                                   const DataVector& integrands,        \
+                                   const Mesh<DIM(data)>& mesh,         \
+                                   const DataVector& det_jacobian);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (0, 1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
@@ -8,6 +8,8 @@
 
 #include <cstddef>
 
+#include "Utilities/Gsl.hpp"
+
 /// \cond
 class DataVector;
 template <size_t>
@@ -38,3 +40,30 @@ class Mesh;
  */
 template <size_t Dim>
 double definite_integral(const DataVector& integrand, const Mesh<Dim>& mesh);
+
+/// @{
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the definite integrals of several functions over a manifold
+ * at once.
+ *
+ * The `integrands` hold the values of the functions one after the other, i.e.
+ * in the layout of a `Variables` with `mesh.number_of_grid_points()` points.
+ * The `integrals` are resized to the number of functions. Passing the
+ * Jacobian determinant `det_jacobian` integrates the functions w.r.t. the
+ * coordinates \f$\boldsymbol{x}\f$ as described in `definite_integral`,
+ * without forming the products of the functions with the Jacobian.
+ *
+ * The quadrature weights of the full mesh (times the Jacobian) are computed once
+ * and contracted with all functions in a single matrix-vector multiplication,
+ * which is considerably faster than integrating the functions one by one.
+ */
+template <size_t Dim>
+void definite_integrals(gsl::not_null<DataVector*> integrals,
+                        const DataVector& integrands, const Mesh<Dim>& mesh);
+
+template <size_t Dim>
+void definite_integrals(gsl::not_null<DataVector*> integrals,
+                        const DataVector& integrands, const Mesh<Dim>& mesh,
+                        const DataVector& det_jacobian);
+/// @}
@@ -13,6 +13,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
@@ -179,17 +180,17 @@ class Filter<FilterType, tmpl::list<TagsToFilter...>> {
           [&filter](const gsl::not_null<
                         typename TagsToFilter::type*>... tensors_to_filter,
                     const auto& local_mesh) {
-            DataVector temp(local_mesh.number_of_grid_points(), 0.0);
-            const auto helper = [&local_mesh, &filter,
-                                 &temp](const auto tensor) {
-              for (auto& component : *tensor) {
-                temp = 0.0;
-                apply_matrices(make_not_null(&temp), filter, component,
-                               local_mesh.extents());
-                component = temp;
-              }
-            };
-            EXPAND_PACK_LEFT_TO_RIGHT(helper(tensors_to_filter));
+            // Gather the tensors into a single contiguous buffer so the
+            // filter matrices are applied to all of them in one pass instead
+            // of once per component.
+            Variables<tmpl::list<TagsToFilter...>> unfiltered{
+                local_mesh.number_of_grid_points()};
+            EXPAND_PACK_LEFT_TO_RIGHT(get<TagsToFilter>(unfiltered) =
+                                          *tensors_to_filter);
+            const auto filtered =
+                apply_matrices(filter, unfiltered, local_mesh.extents());
+            EXPAND_PACK_LEFT_TO_RIGHT(*tensors_to_filter =
+                                          get<TagsToFilter>(filtered));
           },
           make_not_null(&box), mesh);
     }
@@ -70,8 +70,23 @@ double mean_value_on_boundary(
          two_to_the(Dim - 1);
 }
 
+template <size_t Dim>
+void mean_values(const gsl::not_null<DataVector*> means, const DataVector& f,
+                 const Mesh<Dim>& mesh) {
+  definite_integrals(means, f, mesh);
+  *means /= two_to_the(Dim);
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
+#define INSTANTIATE_MEAN_VALUES(_, data)                             \
+  template void mean_values(const gsl::not_null<DataVector*>,        \
+                            const DataVector&, const Mesh<DIM(data)>&);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_MEAN_VALUES, (1, 2, 3))
+
+#undef INSTANTIATE_MEAN_VALUES
+
 #define INSTANTIATE(_, data)                                         \
   template double mean_value_on_boundary(                            \
       const gsl::not_null<DataVector*>, const DataVector&,           \
@@ -48,6 +48,17 @@ double mean_value(const DataVector& f, const Mesh<Dim>& mesh) {
   return definite_integral(f, mesh) / two_to_the(Dim);
 }
 
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the mean values of several functions over a manifold at once.
+ *
+ * The functions are stored one after the other in `f`, as for
+ * `definite_integrals`. The `means` are resized to the number of functions.
+ */
+template <size_t Dim>
+void mean_values(gsl::not_null<DataVector*> means, const DataVector& f,
+                 const Mesh<Dim>& mesh);
+
 /// @{
 /*!
  * \ingroup NumericalAlgorithmsGroup
@@ -8,8 +8,10 @@
 #include <functional>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "Domain/Tags.hpp"
@@ -21,6 +23,7 @@
 #include "Utilities/Literals.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
+#include "Utilities/System/TaskPool.hpp"
 
 namespace {
 void apply_matrix_in_first_dim(double* result, const double* const input,
@@ -40,6 +43,79 @@ void apply_matrix_in_first_dim(double* result, const double* const input,
 }
 }  // namespace
 
+namespace partial_derivatives_detail {
+template <size_t Dim, typename DerivativeFrame>
+void fused_partial_derivatives_impl(
+    const gsl::not_null<double*> du, const double* const u,
+    const size_t number_of_independent_components, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian) {
+  const size_t num_grid_points = mesh.number_of_grid_points();
+  std::array<const Matrix*, Dim> diff_matrices{};
+  // Number of grid points before and after each dimension in memory.
+  std::array<size_t, Dim> strides{};
+  std::array<size_t, Dim> number_of_stripes{};
+  size_t stride = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(diff_matrices, d) =
+        &Spectral::differentiation_matrix(mesh.slice_through(d));
+    gsl::at(strides, d) = stride;
+    gsl::at(number_of_stripes, d) =
+        num_grid_points / (stride * mesh.extents(d));
+    stride *= mesh.extents(d);
+  }
+  std::array<std::array<const double*, Dim>, Dim> inv_jac{};
+  for (size_t logical_index = 0; logical_index < Dim; ++logical_index) {
+    for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
+      gsl::at(gsl::at(inv_jac, logical_index), deriv_index) =
+          inverse_jacobian.get(logical_index, deriv_index).data();
+    }
+  }
+
+  // The components are split into chunks that idle PEs can help with, see
+  // `sys::TaskPool`.
+  const auto compute_components = [&du, &u, &diff_matrices, &strides,
+                                    &number_of_stripes, &inv_jac,
+                                    num_grid_points](
+                                       const size_t first_component,
+                                       const size_t end_component) {
+    // The logical derivatives of a single component are small enough to stay
+    // in cache until the inverse Jacobian has been applied to them.
+    ScratchArena::Scope scratch{make_not_null(&ScratchArena::local())};
+    const gsl::span<double> logical_du =
+        scratch.allocate(Dim * num_grid_points);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t component = first_component; component < end_component;
+         ++component) {
+      const double* const u_component = u + component * num_grid_points;
+      for (size_t d = 0; d < Dim; ++d) {
+        apply_matrices_detail::contract_dimension(
+            &logical_du[d * num_grid_points], *gsl::at(diff_matrices, d),
+            u_component, gsl::at(strides, d), gsl::at(number_of_stripes, d));
+      }
+      for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
+        double* const du_component =
+            du.get() + (component * Dim + deriv_index) * num_grid_points;
+        for (size_t s = 0; s < num_grid_points; ++s) {
+          double sum = gsl::at(inv_jac[0], deriv_index)[s] * logical_du[s];
+          for (size_t logical_index = 1; logical_index < Dim;
+               ++logical_index) {
+            sum += gsl::at(gsl::at(inv_jac, logical_index), deriv_index)[s] *
+                   logical_du[logical_index * num_grid_points + s];
+          }
+          du_component[s] = sum;
+        }
+      }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  };
+  sys::task_pool().parallel_for(number_of_independent_components,
+                                sys::min_items_per_task(num_grid_points),
+                                compute_components);
+}
+}  // namespace partial_derivatives_detail
+
 template <typename SymmList, typename IndexList, size_t Dim>
 void logical_partial_derivative(
     const gsl::not_null<TensorMetafunctions::prepend_spatial_index<
@@ -330,6 +406,19 @@ GENERATE_INSTANTIATIONS(INSTANTIATE_SCALAR, (1, 2, 3),
                         (Frame::Grid, Frame::Distorted, Frame::Inertial))
 
 #undef INSTANTIATE_SCALAR
+
+#define INSTANTIATE_FUSED(r, data)                                            \
+  template void partial_derivatives_detail::fused_partial_derivatives_impl(  \
+      gsl::not_null<double*> du, const double* u,                             \
+      size_t number_of_independent_components,                                \
+      const Mesh<GET_DIM(data)>& mesh,                                        \
+      const InverseJacobian<DataVector, GET_DIM(data), Frame::ElementLogical, \
+                            GET_FRAME(data)>& inverse_jacobian);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_FUSED, (1, 2, 3),
+                        (Frame::Grid, Frame::Distorted, Frame::Inertial))
+
+#undef INSTANTIATE_FUSED
 #undef GET_FRAME
 #undef GET_DIM
 #undef GET_TENSOR
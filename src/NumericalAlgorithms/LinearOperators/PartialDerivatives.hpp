@@ -193,6 +193,38 @@ auto partial_derivatives(
                                   tmpl::size_t<Dim>, DerivativeFrame>>;
 /// @}
 
+/// @{
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Compute the partial derivatives of each variable with respect to
+/// the coordinates of `DerivativeFrame`, one tensor component at a time.
+///
+/// Produces the same result as `partial_derivatives`, but instead of
+/// differentiating all variables in one dimension before moving on to the
+/// next, each tensor component is differentiated in all dimensions directly
+/// from its strided data and the inverse Jacobian is applied immediately. This
+/// avoids the transposes and the full-size logical derivative buffers of
+/// `partial_derivatives`, which dominate the cost on the small meshes typical
+/// of DG evolutions. Meshes with an extent larger than
+/// `apply_matrices_detail::max_extent_for_small_kernels` fall back to
+/// `partial_derivatives`.
+template <typename ResultTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void fused_partial_derivatives(
+    gsl::not_null<Variables<ResultTags>*> du, const Variables<VariableTags>& u,
+    const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian);
+
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+auto fused_partial_derivatives(
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian)
+    -> Variables<db::wrap_tags_in<Tags::deriv, DerivativeTags,
+                                  tmpl::size_t<Dim>, DerivativeFrame>>;
+/// @}
+
 /// @{
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Compute the partial derivative of a `Tensor` with respect to
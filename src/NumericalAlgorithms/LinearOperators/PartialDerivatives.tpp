@@ -5,6 +5,7 @@
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -20,11 +21,23 @@
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
+#include "Utilities/System/TaskPool.hpp"
 
 namespace partial_derivatives_detail {
 template <size_t Dim, typename VariableTags, typename DerivativeTags>
 struct LogicalImpl;
 
+// Computes the logical derivatives of one component at a time in all
+// dimensions directly from the strided data (no transposes) and applies the
+// inverse Jacobian while they are still in cache. Requires every extent of
+// `mesh` to be at most `apply_matrices_detail::max_extent_for_small_kernels`.
+template <size_t Dim, typename DerivativeFrame>
+void fused_partial_derivatives_impl(
+    gsl::not_null<double*> du, const double* u,
+    size_t number_of_independent_components, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian);
+
 // This routine has been optimized to perform really well. The following
 // describes what optimizations were made.
 //
@@ -53,6 +66,10 @@ struct LogicalImpl;
 //
 // - We factor out the `logical_deriv_index == 0` case so that we do not need to
 //   zero the memory in `du` before the computation.
+//
+// - The components are split into chunks of at least
+//   `sys::min_points_per_task` points that idle PEs can help with, see
+//   `sys::TaskPool`.
 template <typename ResultTags, size_t Dim, typename DerivativeFrame>
 void partial_derivatives_impl(
     const gsl::not_null<Variables<ResultTags>*> du,
@@ -60,10 +77,7 @@ void partial_derivatives_impl(
     const size_t number_of_independent_components,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           DerivativeFrame>& inverse_jacobian) {
-  double* pdu = du->data();
   const size_t num_grid_points = du->number_of_grid_points();
-  DataVector lhs{};
-  DataVector logical_du{};
 
   std::array<std::array<size_t, Dim>, Dim> indices{};
   for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
@@ -74,37 +88,52 @@ void partial_derivatives_impl(
     }
   }
 
-  for (size_t component_index = 0;
-       component_index < number_of_independent_components; ++component_index) {
-    for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
-      lhs.set_data_ref(pdu, num_grid_points);
-      // clang-tidy: const cast is fine since we won't modify the data and we
-      // need it to easily hook into the expression templates.
-      logical_du.set_data_ref(
-          const_cast<double*>(  // NOLINT
-              gsl::at(logical_partial_derivatives_of_u, 0)) +  // NOLINT
-              component_index * num_grid_points,
-          num_grid_points);
-      lhs = (*(inverse_jacobian.begin() + gsl::at(indices[0], deriv_index))) *
-            logical_du;
-      for (size_t logical_deriv_index = 1; logical_deriv_index < Dim;
-           ++logical_deriv_index) {
+  const auto compute_components = [&du, &logical_partial_derivatives_of_u,
+                                    &inverse_jacobian, &indices,
+                                    num_grid_points](
+                                       const size_t first_component,
+                                       const size_t end_component) {
+    // clang-tidy: no pointer arithmetic
+    double* pdu =
+        du->data() + first_component * Dim * num_grid_points;  // NOLINT
+    DataVector lhs{};
+    DataVector logical_du{};
+    for (size_t component_index = first_component;
+         component_index < end_component; ++component_index) {
+      for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
+        lhs.set_data_ref(pdu, num_grid_points);
         // clang-tidy: const cast is fine since we won't modify the data and we
         // need it to easily hook into the expression templates.
-        logical_du.set_data_ref(const_cast<double*>(  // NOLINT
-                                    gsl::at(logical_partial_derivatives_of_u,
-                                            logical_deriv_index)) +  // NOLINT
-                                    component_index * num_grid_points,
-                                num_grid_points);
-        lhs +=
-            (*(inverse_jacobian.begin() +
-               gsl::at(gsl::at(indices, logical_deriv_index), deriv_index))) *
+        logical_du.set_data_ref(
+            const_cast<double*>(  // NOLINT
+                gsl::at(logical_partial_derivatives_of_u, 0)) +  // NOLINT
+                component_index * num_grid_points,
+            num_grid_points);
+        lhs =
+            (*(inverse_jacobian.begin() + gsl::at(indices[0], deriv_index))) *
             logical_du;
+        for (size_t logical_deriv_index = 1; logical_deriv_index < Dim;
+             ++logical_deriv_index) {
+          // clang-tidy: const cast is fine since we won't modify the data and
+          // we need it to easily hook into the expression templates.
+          logical_du.set_data_ref(const_cast<double*>(  // NOLINT
+                                      gsl::at(logical_partial_derivatives_of_u,
+                                              logical_deriv_index)) +  // NOLINT
+                                      component_index * num_grid_points,
+                                  num_grid_points);
+          lhs +=
+              (*(inverse_jacobian.begin() +
+                 gsl::at(gsl::at(indices, logical_deriv_index), deriv_index))) *
+              logical_du;
+        }
+        // clang-tidy: no pointer arithmetic
+        pdu += num_grid_points;  // NOLINT
       }
-      // clang-tidy: no pointer arithmetic
-      pdu += num_grid_points;  // NOLINT
     }
-  }
+  };
+  sys::task_pool().parallel_for(number_of_independent_components,
+                                sys::min_items_per_task(num_grid_points),
+                                compute_components);
 }
 }  // namespace partial_derivatives_detail
 
@@ -244,6 +273,47 @@ partial_derivatives(
   return partial_derivatives_of_u;
 }
 
+template <typename ResultTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void fused_partial_derivatives(
+    const gsl::not_null<Variables<ResultTags>*> du,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian) {
+  if (alg::any_of(mesh.extents(), [](const size_t extent) {
+        return extent > apply_matrices_detail::max_extent_for_small_kernels;
+      })) {
+    partial_derivatives(du, u, mesh, inverse_jacobian);
+    return;
+  }
+  using DerivativeTags =
+      tmpl::front<tmpl::split_at<VariableTags, tmpl::size<ResultTags>>>;
+  // For mutating compute items we must set the size.
+  if (UNLIKELY(du->number_of_grid_points() != mesh.number_of_grid_points())) {
+    du->initialize(mesh.number_of_grid_points());
+  }
+  partial_derivatives_detail::fused_partial_derivatives_impl(
+      du->data(), u.data(),
+      Variables<DerivativeTags>::number_of_independent_components, mesh,
+      inverse_jacobian);
+}
+
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+Variables<db::wrap_tags_in<Tags::deriv, DerivativeTags, tmpl::size_t<Dim>,
+                           DerivativeFrame>>
+fused_partial_derivatives(
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          DerivativeFrame>& inverse_jacobian) {
+  Variables<db::wrap_tags_in<Tags::deriv, DerivativeTags, tmpl::size_t<Dim>,
+                             DerivativeFrame>>
+      partial_derivatives_of_u(u.number_of_grid_points());
+  fused_partial_derivatives(make_not_null(&partial_derivatives_of_u), u, mesh,
+                            inverse_jacobian);
+  return partial_derivatives_of_u;
+}
+
 namespace partial_derivatives_detail {
 template <typename VariableTags, typename DerivativeTags>
 struct LogicalImpl<1, VariableTags, DerivativeTags> {
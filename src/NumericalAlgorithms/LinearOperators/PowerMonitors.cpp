@@ -20,10 +20,13 @@ namespace PowerMonitors {
 
 template <size_t Dim>
 void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
-                    const DataVector& u, const Mesh<Dim>& mesh) {
-  // Get modal coefficients
-  const ModalVector modal_coefficients = to_modal_coefficients(u, mesh);
-
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh) {
+  ASSERT(modal_coefficients.size() == mesh.number_of_grid_points(),
+         "The number of modal coefficients ("
+             << modal_coefficients.size()
+             << ") does not match the number of grid points ("
+             << mesh.number_of_grid_points() << ").");
   double slice_sum = 0.0;
   size_t n_slice = 0;
   size_t n_stripe = 0;
@@ -46,6 +49,22 @@ void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
   }
 }
 
+template <size_t Dim>
+void power_monitors(
+    const gsl::not_null<std::array<DataVector, Dim>*> result,
+    const gsl::not_null<ModalVector*> modal_coefficients_buffer,
+    const DataVector& u, const Mesh<Dim>& mesh) {
+  to_modal_coefficients(modal_coefficients_buffer, u, mesh);
+  power_monitors(result, *modal_coefficients_buffer, mesh);
+}
+
+template <size_t Dim>
+void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const DataVector& u, const Mesh<Dim>& mesh) {
+  ModalVector modal_coefficients{};
+  power_monitors(result, make_not_null(&modal_coefficients), u, mesh);
+}
+
 template <size_t Dim>
 std::array<DataVector, Dim> power_monitors(const DataVector& u,
                                            const Mesh<Dim>& mesh) {
@@ -132,6 +151,14 @@ std::array<double, Dim> absolute_truncation_error(
 #define INSTANTIATE(_, data)                                            \
   template std::array<DataVector, DIM(data)> power_monitors(            \
       const DataVector& u, const Mesh<DIM(data)>& mesh);                \
+  template void power_monitors(                                         \
+      const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
+      const ModalVector& modal_coefficients,                            \
+      const Mesh<DIM(data)>& mesh);                                     \
+  template void power_monitors(                                         \
+      const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
+      const gsl::not_null<ModalVector*> modal_coefficients_buffer,      \
+      const DataVector& u, const Mesh<DIM(data)>& mesh);                \
   template void power_monitors(                                         \
       const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
       const DataVector& u, const Mesh<DIM(data)>& mesh);                \
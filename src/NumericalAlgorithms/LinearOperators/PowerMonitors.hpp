@@ -12,6 +12,7 @@
 
 /// \cond
 class DataVector;
+class ModalVector;
 /// \endcond
 
 /*!
@@ -35,8 +36,22 @@ namespace PowerMonitors {
  * where \f$ C_{k_0,k_1,k_2}\f$ are the modal coefficients
  * of variable \f$ \psi \f$.
  *
+ * The overload taking the `modal_coefficients` of \f$ \psi \f$ avoids the
+ * modal transform when the coefficients are already available, and the
+ * overload taking a `modal_coefficients_buffer` reuses its allocation when
+ * computing the power monitors of many variables.
  */
 template <size_t Dim>
+void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh);
+
+template <size_t Dim>
+void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
+                    gsl::not_null<ModalVector*> modal_coefficients_buffer,
+                    const DataVector& u, const Mesh<Dim>& mesh);
+
+template <size_t Dim>
 void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
                     const DataVector& u, const Mesh<Dim>& mesh);
 
@@ -0,0 +1,250 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <pup.h>
+#include <pup_stl.h>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DynamicMatrix.hpp"
+#include "DataStructures/DynamicVector.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/LinearSolver/BuildMatrix.hpp"
+#include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
+#include "Options/String.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::Serial {
+
+/// \cond
+template <typename LinearSolverRegistrars>
+struct LuFactorization;
+/// \endcond
+
+namespace Registrars {
+/// Registers the `LinearSolver::Serial::LuFactorization` linear solver
+using LuFactorization = Registration::Registrar<Serial::LuFactorization>;
+}  // namespace Registrars
+
+/*!
+ * \brief Linear solver that builds a matrix representation of the linear
+ * operator and solves it directly with an LU factorization
+ *
+ * Like `LinearSolver::Serial::ExplicitInverse`, this solver first constructs
+ * an explicit matrix representation of the operator by feeding it with unit
+ * vectors. Instead of inverting the matrix it computes its LU factorization
+ * with partial pivoting (LAPACK `getrf`), and every solve applies the
+ * factorization with two triangular solves (LAPACK `getrs`). Factorizing the
+ * matrix takes about a third of the operations of inverting it, and applying
+ * the factorization costs as much as multiplying with the inverse, so this
+ * solver has the same memory demands as `ExplicitInverse` but a cheaper
+ * initialization. Prefer this solver over `ExplicitInverse` unless you need
+ * the `matrix_representation()` of the inverse.
+ *
+ * Enable the `SinglePrecision` option to store and apply the factorization
+ * in single precision. This halves the memory of the factorization and the
+ * memory bandwidth of every solve. The matrix is still built in double
+ * precision, and the solution has a relative error of roughly the
+ * single-precision roundoff times the condition number of the matrix. That is
+ * typically acceptable when the solver only approximates the inverse, e.g. as
+ * subdomain solver of the `LinearSolver::Schwarz::Schwarz` preconditioner,
+ * while the outer iterations remain in double precision.
+ *
+ * The factorization is cached until the solver is `reset()`. To reuse the
+ * factorization across nonlinear-solver iterations, e.g. the Newton steps of
+ * an XCTS solve, skip the resets with
+ * `LinearSolver::Schwarz::Tags::SkipSubdomainSolverResets` (see
+ * `LinearSolver::Schwarz::Actions::ResetSubdomainSolver`).
+ */
+template <typename LinearSolverRegistrars =
+              tmpl::list<Registrars::LuFactorization>>
+class LuFactorization : public LinearSolver<LinearSolverRegistrars> {
+ private:
+  using Base = LinearSolver<LinearSolverRegistrars>;
+
+ public:
+  struct SinglePrecision {
+    using type = bool;
+    static constexpr Options::String help =
+        "Store and apply the factorization in single precision. Halves the "
+        "memory and bandwidth of the solver, but the solution is only accurate "
+        "to single precision. Use when the solver is a preconditioner.";
+  };
+
+  using options = tmpl::list<SinglePrecision>;
+  static constexpr Options::String help =
+      "Build a matrix representation of the linear operator and LU-factorize "
+      "it. This means that the first solve has a large initialization cost, "
+      "but all subsequent solves converge immediately. Cheaper to initialize "
+      "than ExplicitInverse.";
+
+  LuFactorization() = default;
+  explicit LuFactorization(const bool single_precision)
+      : single_precision_(single_precision) {}
+  LuFactorization(const LuFactorization& /*rhs*/) = default;
+  LuFactorization& operator=(const LuFactorization& /*rhs*/) = default;
+  LuFactorization(LuFactorization&& /*rhs*/) = default;
+  LuFactorization& operator=(LuFactorization&& /*rhs*/) = default;
+  ~LuFactorization() = default;
+
+  /// \cond
+  explicit LuFactorization(CkMigrateMessage* m) : Base(m) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(LuFactorization);  // NOLINT
+  /// \endcond
+
+  /*!
+   * \brief Solve the equation \f$Ax=b\f$ by explicitly constructing the
+   * operator matrix \f$A\f$ and its LU factorization. The first solve is
+   * computationally expensive and successive solves are cheap.
+   *
+   * The `SourceType` must support the same iteration as for
+   * `LinearSolver::Serial::ExplicitInverse::solve`.
+   */
+  template <typename LinearOperator, typename VarsType, typename SourceType,
+            typename... OperatorArgs>
+  Convergence::HasConverged solve(
+      gsl::not_null<VarsType*> solution, const LinearOperator& linear_operator,
+      const SourceType& source,
+      const std::tuple<OperatorArgs...>& operator_args = std::tuple{}) const;
+
+  /// Flags the operator to require re-initialization. No memory is released.
+  /// Call this function to rebuild the solver when the operator changed.
+  void reset() override { size_ = std::numeric_limits<size_t>::max(); }
+
+  /// Size of the operator. The stored factorization will have `size^2`
+  /// entries.
+  size_t size() const { return size_; }
+
+  /// Whether the factorization is stored and applied in single precision
+  bool single_precision() const { return single_precision_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    p | single_precision_;
+    p | size_;
+    p | lu_factors_;
+    p | single_precision_lu_factors_;
+    p | pivots_;
+    if (p.isUnpacking() and size_ != std::numeric_limits<size_t>::max()) {
+      if (single_precision_) {
+        single_precision_workspace_.resize(size_);
+      } else {
+        workspace_.resize(size_);
+      }
+    }
+  }
+
+  std::unique_ptr<Base> get_clone() const override {
+    return std::make_unique<LuFactorization>(*this);
+  }
+
+ private:
+  template <typename MatrixType>
+  void factorize(gsl::not_null<MatrixType*> matrix) const;
+
+  bool single_precision_ = false;
+
+  // Caches for successive solves of the same operator
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t size_ = std::numeric_limits<size_t>::max();
+  // The L and U factors, stored in place of the matrix by LAPACK. Only one of
+  // the two matrices is used, depending on the precision.
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicMatrix<double, blaze::columnMajor> lu_factors_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicMatrix<float, blaze::columnMajor>
+      single_precision_lu_factors_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::vector<blaze::blas_int_t> pivots_{};
+
+  // Buffer to avoid re-allocating memory for applying the factorization
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<double> workspace_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable blaze::DynamicVector<float> single_precision_workspace_{};
+};
+
+template <typename LinearSolverRegistrars>
+template <typename MatrixType>
+void LuFactorization<LinearSolverRegistrars>::factorize(
+    const gsl::not_null<MatrixType*> matrix) const {
+  blaze::getrf(*matrix, pivots_.data());
+  // A singular matrix has a zero on the diagonal of U
+  for (size_t i = 0; i < size_; ++i) {
+    if (UNLIKELY((*matrix)(i, i) == 0.)) {
+      ERROR("Could not LU-factorize subdomain matrix (size "
+            << size_ << "): The matrix is singular.");
+    }
+  }
+}
+
+template <typename LinearSolverRegistrars>
+template <typename LinearOperator, typename VarsType, typename SourceType,
+          typename... OperatorArgs>
+Convergence::HasConverged LuFactorization<LinearSolverRegistrars>::solve(
+    const gsl::not_null<VarsType*> solution,
+    const LinearOperator& linear_operator, const SourceType& source,
+    const std::tuple<OperatorArgs...>& operator_args) const {
+  if (UNLIKELY(size_ == std::numeric_limits<size_t>::max())) {
+    const auto& used_for_size = source;
+    size_ = used_for_size.size();
+    lu_factors_.resize(size_, size_);
+    pivots_.resize(size_);
+    // Construct explicit matrix representation by "sniffing out" the operator,
+    // i.e. feeding it unit vectors
+    auto operand_buffer = make_with_value<VarsType>(used_for_size, 0.);
+    auto result_buffer = make_with_value<SourceType>(used_for_size, 0.);
+    build_matrix(make_not_null(&lu_factors_), make_not_null(&operand_buffer),
+                 make_not_null(&result_buffer), linear_operator,
+                 operator_args);
+    if (single_precision_) {
+      single_precision_workspace_.resize(size_);
+      single_precision_lu_factors_ =
+          blaze::map(lu_factors_, [](const double value) {
+            return static_cast<float>(value);
+          });
+      // Release the double-precision matrix
+      lu_factors_ = blaze::DynamicMatrix<double, blaze::columnMajor>{};
+      factorize(make_not_null(&single_precision_lu_factors_));
+    } else {
+      workspace_.resize(size_);
+      factorize(make_not_null(&lu_factors_));
+    }
+  }
+  // Copy source into contiguous workspace, solve in place and reconstruct the
+  // solution data from the workspace
+  if (single_precision_) {
+    std::copy(source.begin(), source.end(),
+              single_precision_workspace_.begin());
+    blaze::getrs(single_precision_lu_factors_, single_precision_workspace_,
+                 'N', pivots_.data());
+    std::copy(single_precision_workspace_.begin(),
+              single_precision_workspace_.end(), solution->begin());
+  } else {
+    std::copy(source.begin(), source.end(), workspace_.begin());
+    blaze::getrs(lu_factors_, workspace_, 'N', pivots_.data());
+    std::copy(workspace_.begin(), workspace_.end(), solution->begin());
+  }
+  return {0, 0};
+}
+
+/// \cond
+template <typename LinearSolverRegistrars>
+// NOLINTNEXTLINE
+PUP::able::PUP_ID LuFactorization<LinearSolverRegistrars>::my_PUP_ID = 0;
+/// \endcond
+
+}  // namespace LinearSolver::Serial
@@ -3,6 +3,8 @@
 
 #include "NumericalAlgorithms/RootFinding/QuadraticEquation.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <gsl/gsl_poly.h>
 #include <limits>
 
@@ -11,6 +13,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 double positive_root(const double a, const double b, const double c) {
   const auto roots = real_roots(a, b, c);
@@ -142,10 +145,48 @@ struct root_between_values_impl<DataVector> {
            "Size mismatch a vs b: " << a.size() << " " << b.size());
     ASSERT(a.size() == c.size(),
            "Size mismatch a vs c: " << a.size() << " " << c.size());
+    // The roots are computed and chosen without branches, in the same way as
+    // `gsl_poly_solve_quadratic` and the `double` overload, so the loop can
+    // be vectorized. Points with a degenerate quadratic or without a root in
+    // the interval are rare, and are redone by the `double` overload, which
+    // also reports the errors.
+    const bool choose_min = min_or_max == RootToChoose::min;
     DataVector result(a.size());
+    bool all_points_are_regular = true;
     for (size_t i = 0; i < a.size(); ++i) {
-      result[i] = root_between_values_impl<double>::function(
-          a[i], b[i], c[i], min_value, max_value, min_or_max);
+      const double discriminant = b[i] * b[i] - 4.0 * a[i] * c[i];
+      const double sqrt_discriminant = std::sqrt(std::max(discriminant, 0.0));
+      const double temp =
+          -0.5 * (b[i] + std::copysign(sqrt_discriminant, b[i]));
+      // Avoid dividing by zero at the irregular points, which are redone
+      const double denominator_a = a[i] == 0.0 ? 1.0 : a[i];
+      const double denominator_temp = temp == 0.0 ? 1.0 : temp;
+      const double root_0 =
+          std::min(temp / denominator_a, c[i] / denominator_temp);
+      const double root_1 =
+          std::max(temp / denominator_a, c[i] / denominator_temp);
+
+      const bool root_0_low =
+          root_0 < min_value and not equal_within_roundoff(root_0, min_value);
+      const bool root_1_low =
+          root_1 < min_value and not equal_within_roundoff(root_1, min_value);
+      const bool root_0_high =
+          root_0 > max_value and not equal_within_roundoff(root_0, max_value);
+      const bool root_1_high =
+          root_1 > max_value and not equal_within_roundoff(root_1, max_value);
+      const bool choose_root_1 = choose_min ? root_0_low : not root_1_high;
+      result[i] = choose_root_1 ? root_1 : root_0;
+      const bool root_is_valid =
+          choose_root_1 ? not(root_1_low or root_1_high)
+                        : not(root_0_low or root_0_high);
+      all_points_are_regular &= (a[i] != 0.0 and b[i] != 0.0 and
+                                 discriminant > 0.0 and root_is_valid);
+    }
+    if (UNLIKELY(not all_points_are_regular)) {
+      for (size_t i = 0; i < a.size(); ++i) {
+        result[i] = root_between_values_impl<double>::function(
+            a[i], b[i], c[i], min_value, max_value, min_or_max);
+      }
     }
     return result;
   }
@@ -6,15 +6,322 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/math/tools/roots.hpp>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/Exceptions.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace RootFinder {
+namespace toms748_detail {
+// The brackets of all points in a lockstep TOMS_748 root find. Each step of
+// the algorithm below follows the corresponding step of
+// `boost::math::tools::toms748_solve` for every point, so the lockstep
+// iteration converges to the same roots as the iteration point by point.
+struct Brackets {
+  DataVector a;
+  DataVector b;
+  DataVector d;
+  DataVector e;
+  DataVector fa;
+  DataVector fb;
+  DataVector fd;
+  DataVector fe;
+};
+
+inline double safe_div(const double num, const double denom,
+                       const double result_on_overflow) {
+  if (std::abs(denom) < 1.0 and
+      std::abs(denom * std::numeric_limits<double>::max()) <= std::abs(num)) {
+    return result_on_overflow;
+  }
+  return num / denom;
+}
+
+inline double sign(const double x) {
+  return static_cast<double>((x > 0.0) - (x < 0.0));
+}
+
+inline double secant_interpolate(const double a, const double b,
+                                 const double fa, const double fb) {
+  const double tol = 5.0 * std::numeric_limits<double>::epsilon();
+  const double c = a - (fa / (fb - fa)) * (b - a);
+  if ((c <= a + std::abs(a) * tol) or (c >= b - std::abs(b) * tol)) {
+    return 0.5 * (a + b);
+  }
+  return c;
+}
+
+inline double quadratic_interpolate(const Brackets& s, const size_t i,
+                                    const size_t newton_steps) {
+  const double a = s.a[i];
+  const double b = s.b[i];
+  const double fa = s.fa[i];
+  const double fb = s.fb[i];
+  const double coef_b = safe_div(fb - fa, b - a,
+                                 std::numeric_limits<double>::max());
+  double coef_a = safe_div(s.fd[i] - fb, s.d[i] - b,
+                           std::numeric_limits<double>::max());
+  coef_a = safe_div(coef_a - coef_b, s.d[i] - a, 0.0);
+  if (coef_a == 0.0) {
+    return secant_interpolate(a, b, fa, fb);
+  }
+  double c = sign(coef_a) * sign(fa) > 0.0 ? a : b;
+  for (size_t step = 0; step < newton_steps; ++step) {
+    c -= safe_div(fa + (coef_b + coef_a * (c - b)) * (c - a),
+                  coef_b + coef_a * (2.0 * c - a - b), 1.0 + c - a);
+  }
+  if ((c <= a) or (c >= b)) {
+    return secant_interpolate(a, b, fa, fb);
+  }
+  return c;
+}
+
+inline double cubic_interpolate(const Brackets& s, const size_t i) {
+  const double a = s.a[i];
+  const double b = s.b[i];
+  const double d = s.d[i];
+  const double e = s.e[i];
+  const double fa = s.fa[i];
+  const double fb = s.fb[i];
+  const double fd = s.fd[i];
+  const double fe = s.fe[i];
+  const double q11 = (d - e) * fd / (fe - fd);
+  const double q21 = (b - d) * fb / (fd - fb);
+  const double q31 = (a - b) * fa / (fb - fa);
+  const double d21 = (b - d) * fd / (fd - fb);
+  const double d31 = (a - b) * fb / (fb - fa);
+  const double q22 = (d21 - q11) * fb / (fe - fb);
+  const double q32 = (d31 - q21) * fa / (fd - fa);
+  const double d32 = (d31 - q21) * fd / (fd - fa);
+  const double q33 = (d32 - q22) * fa / (fe - fa);
+  const double c = q31 + q32 + q33 + a;
+  if ((c <= a) or (c >= b)) {
+    return quadratic_interpolate(s, i, 3);
+  }
+  return c;
+}
+
+// Whether the function values are too close to each other for the cubic
+// interpolation
+inline bool cubic_is_unsafe(const Brackets& s, const size_t i) {
+  const double min_diff = std::numeric_limits<double>::min() * 32.0;
+  return std::abs(s.fa[i] - s.fb[i]) < min_diff or
+         std::abs(s.fa[i] - s.fd[i]) < min_diff or
+         std::abs(s.fa[i] - s.fe[i]) < min_diff or
+         std::abs(s.fb[i] - s.fd[i]) < min_diff or
+         std::abs(s.fb[i] - s.fe[i]) < min_diff or
+         std::abs(s.fd[i] - s.fe[i]) < min_diff;
+}
+
+// Moves the trial point `c` away from the ends of the bracket
+inline double trial_point_in_bracket(const double a, const double b,
+                                     const double c) {
+  const double tol = 2.0 * std::numeric_limits<double>::epsilon();
+  if ((b - a) < 2.0 * tol * a) {
+    return a + 0.5 * (b - a);
+  } else if (c <= a + std::abs(a) * tol) {
+    return a + std::abs(a) * tol;
+  } else if (c >= b - std::abs(b) * tol) {
+    return b - std::abs(b) * tol;
+  }
+  return c;
+}
+
+// Shrinks the bracket of point `i` to the side of `c` that contains the root
+inline void bracket(const gsl::not_null<Brackets*> s, const size_t i,
+                    const double c, const double fc) {
+  if (fc == 0.0) {
+    s->a[i] = c;
+    s->fa[i] = 0.0;
+    s->d[i] = 0.0;
+    s->fd[i] = 0.0;
+  } else if (sign(s->fa[i]) * sign(fc) < 0.0) {
+    s->d[i] = s->b[i];
+    s->fd[i] = s->fb[i];
+    s->b[i] = c;
+    s->fb[i] = fc;
+  } else {
+    s->d[i] = s->a[i];
+    s->fd[i] = s->fa[i];
+    s->a[i] = c;
+    s->fa[i] = fc;
+  }
+}
+
+template <typename Function>
+DataVector toms748_lockstep(const Function& f, const DataVector& lower_bound,
+                            const DataVector& upper_bound,
+                            const DataVector& f_at_lower_bound,
+                            const DataVector& f_at_upper_bound,
+                            const double absolute_tolerance,
+                            const double relative_tolerance,
+                            const size_t max_iterations) {
+  const size_t size = lower_bound.size();
+  ASSERT(upper_bound.size() == size and f_at_lower_bound.size() == size and
+             f_at_upper_bound.size() == size,
+         "The bounds and function values must have the same size.");
+  for (size_t i = 0; i < size; ++i) {
+    if (f_at_lower_bound[i] * f_at_upper_bound[i] > 0.0) {
+      ERROR("Root not bracketed at index "
+            << i << ": f(" << lower_bound[i] << ") = " << f_at_lower_bound[i]
+            << ", f(" << upper_bound[i] << ") = " << f_at_upper_bound[i]);
+    }
+  }
+  ASSERT(relative_tolerance > std::numeric_limits<double>::epsilon(),
+         "The relative tolerance is too small.");
+  const auto converged = [absolute_tolerance, relative_tolerance](
+                             const double lhs, const double rhs) {
+    return std::abs(lhs - rhs) <=
+           absolute_tolerance +
+               relative_tolerance * std::min(std::abs(lhs), std::abs(rhs));
+  };
+
+  Brackets s{lower_bound,     upper_bound,      DataVector(size, 0.0),
+             DataVector(size, 0.0), f_at_lower_bound, f_at_upper_bound,
+             DataVector(size, 0.0), DataVector(size, 0.0)};
+  for (size_t i = 0; i < size; ++i) {
+    if (s.fb[i] == 0.0) {
+      s.a[i] = s.b[i];
+      s.fa[i] = 0.0;
+    }
+  }
+  std::vector<size_t> iterations_left(size, max_iterations);
+  // Points that take part in the current step. The others keep their bracket
+  // and evaluate `f` at its center, which is within its domain.
+  std::vector<bool> active(size);
+  const auto update_active = [&s, &iterations_left, &active, &converged,
+                              &size]() {
+    bool any_active = false;
+    for (size_t i = 0; i < size; ++i) {
+      active[i] = active[i] and iterations_left[i] > 0 and s.fa[i] != 0.0 and
+                  not converged(s.a[i], s.b[i]);
+      any_active |= active[i];
+    }
+    return any_active;
+  };
+  DataVector c(size);
+  DataVector fc(size);
+  // Evaluates `f` at the trial points of all active points in one call and
+  // shrinks their brackets
+  const auto step = [&f, &s, &iterations_left, &active, &c, &fc, &size](
+                        const auto& trial_point, const bool shift_e) {
+    for (size_t i = 0; i < size; ++i) {
+      if (active[i]) {
+        const double trial = trial_point(i);
+        if (shift_e) {
+          s.e[i] = s.d[i];
+          s.fe[i] = s.fd[i];
+        }
+        c[i] = trial_point_in_bracket(s.a[i], s.b[i], trial);
+      } else {
+        c[i] = s.a[i] + 0.5 * (s.b[i] - s.a[i]);
+      }
+    }
+    fc = f(c);
+    ASSERT(fc.size() == size, "The function must return "
+                                  << size << " values, but returned "
+                                  << fc.size());
+    for (size_t i = 0; i < size; ++i) {
+      if (active[i]) {
+        bracket(make_not_null(&s), i, c[i], fc[i]);
+        --iterations_left[i];
+      }
+    }
+  };
+  const auto interpolate = [&s](const size_t newton_steps) {
+    return [&s, newton_steps](const size_t i) {
+      return cubic_is_unsafe(s, i) ? quadratic_interpolate(s, i, newton_steps)
+                                   : cubic_interpolate(s, i);
+    };
+  };
+
+  active.assign(size, true);
+  bool any_active = update_active();
+  if (any_active) {
+    // On the first step we take a secant step, and on the second a quadratic
+    // interpolation
+    step(
+        [&s](const size_t i) {
+          return secant_interpolate(s.a[i], s.b[i], s.fa[i], s.fb[i]);
+        },
+        false);
+    any_active = update_active();
+    if (any_active) {
+      step([&s](const size_t i) { return quadratic_interpolate(s, i, 2); },
+           true);
+      any_active = update_active();
+    }
+  }
+  DataVector a0(size);
+  DataVector b0(size);
+  while (any_active) {
+    a0 = s.a;
+    b0 = s.b;
+    // Two interpolation steps
+    step(interpolate(2), true);
+    if (not update_active()) {
+      break;
+    }
+    step(interpolate(3), false);
+    if (not update_active()) {
+      break;
+    }
+    // A double-length secant step
+    step(
+        [&s](const size_t i) {
+          const bool use_a = std::abs(s.fa[i]) < std::abs(s.fb[i]);
+          const double u = use_a ? s.a[i] : s.b[i];
+          const double fu = use_a ? s.fa[i] : s.fb[i];
+          const double trial = u - 2.0 * (fu / (s.fb[i] - s.fa[i])) *
+                                       (s.b[i] - s.a[i]);
+          return std::abs(trial - u) > 0.5 * (s.b[i] - s.a[i])
+                     ? s.a[i] + 0.5 * (s.b[i] - s.a[i])
+                     : trial;
+        },
+        true);
+    if (not update_active()) {
+      break;
+    }
+    // A bisection step for the points that don't converge fast enough
+    bool any_bisection = false;
+    for (size_t i = 0; i < size; ++i) {
+      const bool needs_bisection =
+          active[i] and not((s.b[i] - s.a[i]) < 0.5 * (b0[i] - a0[i]));
+      any_bisection |= needs_bisection;
+      active[i] = needs_bisection;
+    }
+    if (any_bisection) {
+      step(
+          [&s](const size_t i) { return s.a[i] + 0.5 * (s.b[i] - s.a[i]); },
+          true);
+    }
+    // Points that skipped the bisection take part in the next step again
+    active.assign(size, true);
+    any_active = update_active();
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    if (iterations_left[i] == 0) {
+      throw convergence_error(
+          "toms748 reached max iterations without converging");
+    }
+    if (s.fa[i] == 0.0) {
+      s.b[i] = s.a[i];
+    }
+  }
+  return s.a + 0.5 * (s.b - s.a);
+}
+}  // namespace toms748_detail
 
 /*!
  * \ingroup NumericalAlgorithmsGroup
@@ -105,6 +412,16 @@ double toms748(const Function& f, const double lower_bound,
  *
  * \snippet Test_TOMS748.cpp datavector_root_find
  *
+ * Alternatively, `f` can be a unary invokable that takes a `DataVector` of
+ * points, one for each index, and returns the function values at all of them.
+ * Then the root finds for all indices advance in lockstep, so `f` is evaluated
+ * once per iteration on all points. This allows `f` to use vectorized
+ * `DataVector` math, e.g. to evaluate an equation of state on all points at
+ * once. Indices that have already converged are evaluated at the center of
+ * their bracket, but their bracket is not changed anymore.
+ *
+ * \snippet Test_TOMS748.cpp lockstep_root_find
+ *
  * For each index `i` into the DataVector, the TOMS_748 algorithm searches for a
  * root in the interval [`lower_bound[i]`, `upper_bound[i]`], and will throw if
  * this interval does not bracket a root,
@@ -112,7 +429,8 @@ double toms748(const Function& f, const double lower_bound,
  *
  * See the [Boost](http://www.boost.org/) documentation for more details.
  *
- * \requires Function `f` be callable with a `double` and a `size_t`
+ * \requires Function `f` be callable with a `double` and a `size_t`, or with
+ * a `DataVector`
  *
  * \throws `convergence_error` if, for any index, the requested tolerance is not
  * met after `max_iterations` iterations.
@@ -123,13 +441,20 @@ DataVector toms748(const Function& f, const DataVector& lower_bound,
                    const double absolute_tolerance,
                    const double relative_tolerance,
                    const size_t max_iterations = 100) {
-  DataVector result_vector{lower_bound.size()};
-  for (size_t i = 0; i < result_vector.size(); ++i) {
-    result_vector[i] = toms748(
-        [&f, i](double x) { return f(x, i); }, lower_bound[i], upper_bound[i],
+  if constexpr (std::is_invocable_v<const Function&, const DataVector&>) {
+    return toms748_detail::toms748_lockstep(
+        f, lower_bound, upper_bound, f(lower_bound), f(upper_bound),
         absolute_tolerance, relative_tolerance, max_iterations);
+  } else {
+    DataVector result_vector{lower_bound.size()};
+    for (size_t i = 0; i < result_vector.size(); ++i) {
+      result_vector[i] = toms748(
+          [&f, i](double x) { return f(x, i); }, lower_bound[i],
+          upper_bound[i], absolute_tolerance, relative_tolerance,
+          max_iterations);
+    }
+    return result_vector;
   }
-  return result_vector;
 }
 
 /*!
@@ -150,14 +475,20 @@ DataVector toms748(const Function& f, const DataVector& lower_bound,
                    const double absolute_tolerance,
                    const double relative_tolerance,
                    const size_t max_iterations = 100) {
-  DataVector result_vector{lower_bound.size()};
-  for (size_t i = 0; i < result_vector.size(); ++i) {
-    result_vector[i] =
-        toms748([&f, i](double x) { return f(x, i); }, lower_bound[i],
-                upper_bound[i], f_at_lower_bound[i], f_at_upper_bound[i],
-                absolute_tolerance, relative_tolerance, max_iterations);
-  }
-  return result_vector;
+  if constexpr (std::is_invocable_v<const Function&, const DataVector&>) {
+    return toms748_detail::toms748_lockstep(
+        f, lower_bound, upper_bound, f_at_lower_bound, f_at_upper_bound,
+        absolute_tolerance, relative_tolerance, max_iterations);
+  } else {
+    DataVector result_vector{lower_bound.size()};
+    for (size_t i = 0; i < result_vector.size(); ++i) {
+      result_vector[i] =
+          toms748([&f, i](double x) { return f(x, i); }, lower_bound[i],
+                  upper_bound[i], f_at_lower_bound[i], f_at_upper_bound[i],
+                  absolute_tolerance, relative_tolerance, max_iterations);
+    }
+    return result_vector;
+  }
 }
 
 }  // namespace RootFinder
@@ -5,9 +5,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <mutex>
 #include <ostream>
+#include <sstream>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
@@ -17,6 +22,7 @@
 #include "Options/Options.hpp"
 #include "Options/ParseOptions.hpp"
 #include "Utilities/Blas.hpp"
+#include "Utilities/ConcurrentCachedFunction.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -24,6 +30,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/StaticCache.hpp"
 
 namespace Spectral {
@@ -35,6 +42,17 @@ namespace {
 
 // Caching mechanism
 
+std::mutex uncapped_cache_registry_mutex{};
+std::vector<std::pair<std::string, std::function<CacheStatistics()>>>
+    uncapped_cache_registry{};
+
+bool register_uncapped_cache(std::string name,
+                             std::function<CacheStatistics()> statistics) {
+  const std::lock_guard lock(uncapped_cache_registry_mutex);
+  uncapped_cache_registry.emplace_back(std::move(name), std::move(statistics));
+  return true;
+}
+
 template <Basis BasisType, Quadrature QuadratureType,
           typename SpectralQuantityGenerator>
 const auto& precomputed_spectral_quantity(const size_t num_points) {
@@ -45,11 +63,19 @@ const auto& precomputed_spectral_quantity(const size_t num_points) {
   ASSERT(num_points >= min_num_points,
          "Tried to work with less than the minimum number of collocation "
          "points for this quadrature.");
-  ASSERT(num_points <= max_num_points,
-         "Exceeded maximum number of collocation points.");
-  // We compute the quantity for all possible `num_point`s the first time this
-  // function is called and keep the data around for the lifetime of the
-  // program. The computation is handled by the call operator of the
+  if (UNLIKELY(num_points > max_num_points)) {
+    // Quantities beyond the range of the static cache are computed the first
+    // time they are requested and shared between all threads.
+    static const auto uncapped_data =
+        make_concurrent_cached_function<size_t>(SpectralQuantityGenerator{});
+    [[maybe_unused]] static const bool registered = register_uncapped_cache(
+        pretty_type::get_name<SpectralQuantityGenerator>(),
+        []() { return uncapped_data.statistics(); });
+    return uncapped_data(num_points);
+  }
+  // We compute the quantity for a given `num_point`s the first time it is
+  // requested and keep the data around for the lifetime of the program. The
+  // computation is handled by the call operator of the
   // `SpectralQuantityType` instance.
   static const auto precomputed_data =
       make_static_cache<CacheRange<min_num_points, max_num_points + 1>>(
@@ -610,15 +636,11 @@ PRECOMPUTED_SPECTRAL_QUANTITY(linear_filter_matrix, Matrix,
 
 template <Basis BasisType, Quadrature QuadratureType, typename T>
 Matrix interpolation_matrix(const size_t num_points, const T& target_points) {
-  constexpr size_t max_num_points =
-      Spectral::maximum_number_of_points<BasisType>;
   constexpr size_t min_num_points =
       Spectral::minimum_number_of_points<BasisType, QuadratureType>;
   ASSERT(num_points >= min_num_points,
          "Tried to work with less than the minimum number of collocation "
          "points for this quadrature.");
-  ASSERT(num_points <= max_num_points,
-         "Exceeded maximum number of collocation points.");
   const DataVector& collocation_pts =
       collocation_points<BasisType, QuadratureType>(num_points);
   const DataVector& bary_weights =
@@ -872,6 +894,14 @@ Matrix interpolation_matrix(const Mesh<1>& mesh, const T& target_points) {
       mesh);
 }
 
+std::string uncapped_cache_statistics() {
+  std::ostringstream os{};
+  const std::lock_guard lock(uncapped_cache_registry_mutex);
+  for (const auto& [name, statistics] : uncapped_cache_registry) {
+    os << name << ": " << statistics() << "\n";
+  }
+  return os.str();
+}
 }  // namespace Spectral
 
 #define BASIS(data) BOOST_PP_TUPLE_ELEM(0, data)
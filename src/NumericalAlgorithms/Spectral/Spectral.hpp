@@ -12,6 +12,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <limits>
+#include <string>
 #include <utility>
 
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -548,4 +549,16 @@ const Matrix& linear_filter_matrix(size_t num_points);
  */
 const Matrix& linear_filter_matrix(const Mesh<1>& mesh);
 
+/*!
+ * \brief Usage statistics of the caches holding spectral quantities for more
+ * than `maximum_number_of_points` collocation points.
+ *
+ * Spectral quantities for up to `maximum_number_of_points` points are held in
+ * a `StaticCache`. Larger numbers of points are supported by the functions
+ * taking `num_points` that return a reference to a cached quantity, e.g.
+ * `differentiation_matrix`, through caches that grow as needed and are
+ * shared between all threads of a process. This returns one line per such
+ * cache that has been used, giving its hits, misses, and memory footprint.
+ */
+std::string uncapped_cache_statistics();
 }  // namespace Spectral
@@ -5,8 +5,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
@@ -67,8 +71,7 @@ Spherepack::Spherepack(const size_t l_max, const size_t m_max)
       m_max_{m_max},
       n_theta_{l_max_ + 1},
       n_phi_{2 * m_max_ + 1},
-      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)},
-      storage_(l_max_, m_max_) {
+      spectral_size_{2 * (l_max_ + 1) * (m_max_ + 1)} {
   if (l_max_ < 2) {
     ERROR("Must use l_max>=2, not l_max=" << l_max_);
   }
@@ -79,10 +82,26 @@ Spherepack::Spherepack(const size_t l_max, const size_t m_max)
     ERROR("Must use m_max<=l_max, not l_max=" << l_max_
                                               << ", m_max=" << m_max_);
   }
-  calculate_collocation_points();
-  fill_scalar_work_arrays();
-  fill_vector_work_arrays();
-  calculate_interpolation_data();
+
+  // The storage is computed only once per process for each l_max and m_max.
+  // Entries are never removed, because only a few different resolutions are
+  // used in a run.
+  static std::mutex cache_mutex{};
+  static std::map<std::pair<size_t, size_t>,
+                  std::shared_ptr<const Spherepack_detail::ConstStorage>>
+      cache{};
+  const std::lock_guard lock(cache_mutex);
+  auto& cached_storage = cache[{l_max_, m_max_}];
+  if (cached_storage == nullptr) {
+    auto storage =
+        std::make_shared<Spherepack_detail::ConstStorage>(l_max_, m_max_);
+    calculate_collocation_points(make_not_null(storage.get()));
+    fill_scalar_work_arrays(make_not_null(storage.get()));
+    fill_vector_work_arrays(make_not_null(storage.get()));
+    calculate_interpolation_data(make_not_null(storage.get()));
+    cached_storage = std::move(storage);
+  }
+  storage_ = cached_storage;
 }
 
 void Spherepack::phys_to_spec_impl(
@@ -106,7 +125,7 @@ void Spherepack::phys_to_spec_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_phys_to_spec = storage_.work_phys_to_spec;
+  const auto& work_phys_to_spec = storage_->work_phys_to_spec;
   shags_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -145,7 +164,7 @@ void Spherepack::spec_to_phys_impl(
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
 
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   shsgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -257,7 +276,7 @@ void Spherepack::gradient_from_coefs_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  const auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  const auto& work_vector_spec_to_phys = storage_->work_vector_spec_to_phys;
   gradgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           effective_physical_offset, effective_spectral_offset,
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1, df[0],
@@ -348,7 +367,7 @@ void Spherepack::scalar_laplacian_from_coefs(
   const size_t work_size = n_theta_ * (3 * n_phi_ + 2 * l1 + 1);
   auto& work = memory_pool_.get(work_size);
   int err = 0;
-  const auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   slapgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           static_cast<int>(physical_offset), static_cast<int>(spectral_offset),
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -405,12 +424,12 @@ void Spherepack::second_derivative(
     const std::array<double*, 2>& df, const gsl::not_null<SecondDeriv*> ddf,
     const gsl::not_null<const double*> collocation_values,
     const size_t physical_stride, const size_t physical_offset) const {
-  const auto& cos_theta = storage_.cos_theta;
-  const auto& sin_theta = storage_.sin_theta;
-  const auto& sin_phi = storage_.sin_phi;
-  const auto& cos_phi = storage_.cos_phi;
-  const auto& cot_theta = storage_.cot_theta;
-  const auto& cosec_theta = storage_.cosec_theta;
+  const auto& cos_theta = storage_->cos_theta;
+  const auto& sin_theta = storage_->sin_theta;
+  const auto& sin_phi = storage_->sin_phi;
+  const auto& cos_phi = storage_->cos_phi;
+  const auto& cot_theta = storage_->cot_theta;
+  const auto& cosec_theta = storage_->cosec_theta;
 
   // Get first derivatives
   gradient(df, collocation_values, physical_stride, physical_offset);
@@ -550,7 +569,7 @@ Spherepack::InterpolationInfo<T>::InterpolationInfo(
 template <typename T>
 Spherepack::InterpolationInfo<T> Spherepack::set_up_interpolation_info(
     const std::array<T, 2>& target_points) const {
-  return InterpolationInfo(l_max_, m_max_, storage_.work_interp_pmm,
+  return InterpolationInfo(l_max_, m_max_, storage_->work_interp_pmm,
                            target_points);
 }
 
@@ -585,9 +604,9 @@ void Spherepack::interpolate_from_coefs(
           << interpolation_info.l_max() << ") and Spherepack instance ("
           << l_max_ << ")");
   };
-  const auto& alpha = storage_.work_interp_alpha;
-  const auto& beta = storage_.work_interp_beta;
-  const auto& index = storage_.work_interp_index;
+  const auto& alpha = storage_->work_interp_alpha;
+  const auto& beta = storage_->work_interp_beta;
+  const auto& index = storage_->work_interp_index;
   // alpha holds alpha(n,m,x)/x, beta holds beta(n+1,m).
   // index holds the index into the coefficient array.
   // All are indexed together.
@@ -693,9 +712,10 @@ T Spherepack::interpolate_from_coefs(
   return result;
 }
 
-void Spherepack::calculate_collocation_points() {
+void Spherepack::calculate_collocation_points(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // Theta
-  auto& theta = storage_.theta;
+  auto& theta = storage->theta;
   DataVector temp(2 * n_theta_ + 1);
   auto work = gsl::make_span(temp.data(), n_theta_);
   auto unused_weights = gsl::make_span(temp.data() + n_theta_, n_theta_ + 1);
@@ -708,17 +728,17 @@ void Spherepack::calculate_collocation_points() {
   }
 
   // Phi
-  auto& phi = storage_.phi;
+  auto& phi = storage->phi;
   const double two_pi_over_n_phi = 2.0 * M_PI / n_phi_;
   for (size_t i = 0; i < n_phi_; ++i) {
     phi[i] = two_pi_over_n_phi * i;
   }
 
   // Other trig functions at collocation points
-  auto& cos_theta = storage_.cos_theta;
-  auto& sin_theta = storage_.sin_theta;
-  auto& cot_theta = storage_.cot_theta;
-  auto& cosec_theta = storage_.cosec_theta;
+  auto& cos_theta = storage->cos_theta;
+  auto& sin_theta = storage->sin_theta;
+  auto& cot_theta = storage->cot_theta;
+  auto& cosec_theta = storage->cosec_theta;
   for (size_t i = 0; i < n_theta_; ++i) {
     cos_theta[i] = cos(theta[i]);
     sin_theta[i] = sin(theta[i]);
@@ -726,15 +746,16 @@ void Spherepack::calculate_collocation_points() {
     cot_theta[i] = cos_theta[i] * cosec_theta[i];
   }
 
-  auto& sin_phi = storage_.sin_phi;
-  auto& cos_phi = storage_.cos_phi;
+  auto& sin_phi = storage->sin_phi;
+  auto& cos_phi = storage->cos_phi;
   for (size_t i = 0; i < n_phi_; ++i) {
     cos_phi[i] = cos(phi[i]);
     sin_phi[i] = sin(phi[i]);
   }
 }
 
-void Spherepack::calculate_interpolation_data() {
+void Spherepack::calculate_interpolation_data(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // SPHEREPACK expands f(theta,phi) as
   //
   // f(theta,phi) =
@@ -772,10 +793,10 @@ void Spherepack::calculate_interpolation_data() {
   // and  Pbar(m+1)(m) is (2m+1)!! x(1-x^2)^(n/2)sqrt((2m+3)/(2(2m+1)!))
   //  Ratio Pbar(m+1)(m)/Pbar(m)(m)   = x sqrt(2m+3)
   //  Ratio Pbar(m+1)(m+1)/Pbar(m)(m) = sqrt(1-x^2) sqrt((2m+3)/(2m+2))
-  auto& alpha = storage_.work_interp_alpha;
-  auto& beta = storage_.work_interp_beta;
-  auto& pmm = storage_.work_interp_pmm;
-  auto& index = storage_.work_interp_index;
+  auto& alpha = storage->work_interp_alpha;
+  auto& beta = storage->work_interp_beta;
+  auto& pmm = storage->work_interp_pmm;
+  auto& index = storage->work_interp_index;
 
   const size_t l1 = m_max_ + 1;
 
@@ -827,10 +848,11 @@ void Spherepack::calculate_interpolation_data() {
   }
 }
 
-void Spherepack::fill_vector_work_arrays() {
+void Spherepack::fill_vector_work_arrays(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   DataVector work((3 * n_theta_ * (n_theta_ + 3) + 2) / 2);
 
-  auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  auto& work_vector_spec_to_phys = storage->work_vector_spec_to_phys;
   int err = 0;
   vhsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
           work_vector_spec_to_phys.data(),
@@ -841,7 +863,8 @@ void Spherepack::fill_vector_work_arrays() {
   }
 }
 
-void Spherepack::fill_scalar_work_arrays() {
+void Spherepack::fill_scalar_work_arrays(
+    const gsl::not_null<Spherepack_detail::ConstStorage*> storage) const {
   // Quadrature weights
   {
     DataVector temp(3 * n_theta_ + 1);
@@ -854,7 +877,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("gaqd error " << err << " in Spherepack");
     }
-    auto& quadrature_weights = storage_.quadrature_weights;
+    auto& quadrature_weights = storage->quadrature_weights;
     for (size_t i = 0; i < n_theta_; ++i) {
       for (size_t j = 0; j < n_phi_; ++j) {
         quadrature_weights[i + j * n_theta_] = (2 * M_PI / n_phi_) * weights[i];
@@ -869,7 +892,7 @@ void Spherepack::fill_scalar_work_arrays() {
     DataVector temp(work0_size + work1_size);
     auto work0 = gsl::make_span(temp.data(), work0_size);
     auto work1 = gsl::make_span(temp.data() + work0_size, work1_size);
-    auto& work_phys_to_spec = storage_.work_phys_to_spec;
+    auto& work_phys_to_spec = storage->work_phys_to_spec;
     int err = 0;
     shagsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_phys_to_spec.data(),
@@ -879,7 +902,7 @@ void Spherepack::fill_scalar_work_arrays() {
     if (UNLIKELY(err != 0)) {
       ERROR("shagsi error " << err << " in Spherepack");
     }
-    auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+    auto& work_scalar_spec_to_phys = storage->work_scalar_spec_to_phys;
     shsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
             work_scalar_spec_to_phys.data(),
             static_cast<int>(work_scalar_spec_to_phys.size()), work0.data(),
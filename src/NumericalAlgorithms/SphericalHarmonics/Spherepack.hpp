@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -128,9 +129,17 @@ namespace ylm {
  * be "interpolated" (i.e. the new expansion evaluated) using `interpolate`.
  *
  * Spherepack stores two types of quantities:
- *   1. storage_, which is filled in the constructor and is always const.
+ *   1. storage_, which is always const. It depends only on l_max and m_max, so
+ *      it is computed by the first Spherepack constructed with them and then
+ *      shared by all instances in the process (on all threads) with the same
+ *      l_max and m_max. Constructing and copying a Spherepack is therefore
+ *      cheap after the first construction.
  *   2. memory_pool_, which is dynamic and thread_local, and is overwritten
  *      by various member functions that need temporary storage.
+ *
+ * Because storage_ is never modified and memory_pool_ is thread_local, the
+ * member functions of a Spherepack may be called concurrently from different
+ * threads.
  */
 class Spherepack {
  public:
@@ -209,10 +218,10 @@ class Spherepack {
   /// The theta points are Gauss-Legendre in \f$\cos(\theta)\f$,
   /// so there are no points at the poles.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& theta_points() const {
-    return storage_.theta;
+    return storage_->theta;
   }
   SPECTRE_ALWAYS_INLINE const std::vector<double>& phi_points() const {
-    return storage_.phi;
+    return storage_->phi;
   }
   std::array<DataVector, 2> theta_phi_points() const;
   /// @}
@@ -396,7 +405,7 @@ class Spherepack {
       gsl::not_null<const double*> collocation_values,
       size_t physical_stride = 1, size_t physical_offset = 0) const {
     // clang-tidy: 'do not use pointer arithmetic'
-    return ddot_(n_theta_ * n_phi_, storage_.quadrature_weights.data(), 1,
+    return ddot_(n_theta_ * n_phi_, storage_->quadrature_weights.data(), 1,
                  collocation_values.get() + physical_offset,  // NOLINT
                  physical_stride);
   }
@@ -405,7 +414,7 @@ class Spherepack {
   /// is the definite integral, where \f$c_i\f$ are collocation values
   /// at point i.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& integration_weights() const {
-    return storage_.quadrature_weights;
+    return storage_->quadrature_weights;
   }
 
   /// Adds a constant (i.e. \f$f(\theta,\phi)\f$ += \f$c\f$) to the function
@@ -500,10 +509,14 @@ class Spherepack {
                                 size_t physical_stride = 1,
                                 size_t physical_offset = 0,
                                 bool loop_over_offset = false) const;
-  void calculate_collocation_points();
-  void calculate_interpolation_data();
-  void fill_scalar_work_arrays();
-  void fill_vector_work_arrays();
+  void calculate_collocation_points(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void calculate_interpolation_data(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void fill_scalar_work_arrays(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
+  void fill_vector_work_arrays(
+      gsl::not_null<Spherepack_detail::ConstStorage*> storage) const;
   size_t l_max_, m_max_, n_theta_, n_phi_;
   size_t spectral_size_;
   // memory_pool_ will be shared by multiple instances of
@@ -515,7 +528,7 @@ class Spherepack {
   // safe to resize objects in memory_pool_ or to overwrite them with
   // arbitrary data.
   static thread_local Spherepack_detail::MemoryPool memory_pool_;
-  Spherepack_detail::ConstStorage storage_;
+  std::shared_ptr<const Spherepack_detail::ConstStorage> storage_;
 };  // class Spherepack
 
 bool operator==(const Spherepack& lhs, const Spherepack& rhs);
@@ -4,12 +4,14 @@
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 
 #include <cmath>
+#include <memory>
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>
 #include <utility>
 
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 namespace Frame {
@@ -94,6 +96,7 @@ void Strahlkorper<Frame>::pup(PUP::er& p) {
 
   if (p.isUnpacking()) {
     ylm_ = ylm::Spherepack(l_max_, m_max_);
+    derived_quantities_cache_ = nullptr;
   }
 }
 
@@ -142,6 +145,41 @@ bool Strahlkorper<Frame>::point_is_contained(
   return magnitude(xmc) < radius(theta, phi);
 }
 
+template <typename Frame>
+std::shared_ptr<const typename Strahlkorper<Frame>::DerivedQuantities>
+Strahlkorper<Frame>::derived_quantities() const {
+  const auto cache = std::atomic_load(&derived_quantities_cache_);
+  if (cache != nullptr and cache->l_max == l_max_ and
+      cache->m_max == m_max_ and cache->center == center_ and
+      cache->coefficients == strahlkorper_coefs_) {
+    return cache->quantities;
+  }
+  auto theta_phi = ylm::theta_phi(*this);
+  auto radius = ylm::radius(*this);
+  auto rhat = ylm::rhat(theta_phi);
+  auto jacobian = ylm::jacobian(theta_phi);
+  auto inv_jacobian = ylm::inv_jacobian(theta_phi);
+  auto cartesian_coords = ylm::cartesian_coords(*this, radius, rhat);
+  auto dx_radius =
+      ylm::cartesian_derivs_of_scalar(radius, *this, radius, inv_jacobian);
+  auto normal_one_form = ylm::normal_one_form(dx_radius, rhat);
+  auto tangents = ylm::tangents(*this, radius, rhat, jacobian);
+  auto quantities = std::make_shared<const DerivedQuantities>(
+      DerivedQuantities{std::move(theta_phi), std::move(radius),
+                        std::move(rhat), std::move(jacobian),
+                        std::move(inv_jacobian), std::move(cartesian_coords),
+                        std::move(dx_radius), std::move(normal_one_form),
+                        std::move(tangents)});
+  // Concurrent calls may compute the quantities more than once, but each
+  // caller gets consistent quantities and the last one is kept.
+  std::atomic_store(&derived_quantities_cache_,
+                    std::make_shared<const DerivedQuantitiesCache>(
+                        DerivedQuantitiesCache{l_max_, m_max_, center_,
+                                               strahlkorper_coefs_,
+                                               quantities}));
+  return quantities;
+}
+
 template class Strahlkorper<Frame::Inertial>;
 template class Strahlkorper<Frame::Grid>;
 template class Strahlkorper<Frame::Distorted>;
@@ -5,9 +5,12 @@
 
 #include <array>
 #include <cstddef>
+#include <memory>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/TagsTypeAliases.hpp"
 #include "Options/String.hpp"
 #include "Utilities/ForceInline.hpp"
 
@@ -160,11 +163,53 @@ class Strahlkorper {
     return ylm_;
   }
 
+  /// Quantities on the collocation points of the surface, as computed by the
+  /// functions in StrahlkorperFunctions.hpp with the same names
+  struct DerivedQuantities {
+    tnsr::i<DataVector, 2, ::Frame::Spherical<Frame>> theta_phi;
+    Scalar<DataVector> radius;
+    tnsr::i<DataVector, 3, Frame> rhat;
+    ylm::Tags::aliases::Jacobian<Frame> jacobian;
+    ylm::Tags::aliases::InvJacobian<Frame> inv_jacobian;
+    tnsr::I<DataVector, 3, Frame> cartesian_coords;
+    /// `ylm::cartesian_derivs_of_scalar` of the radius
+    tnsr::i<DataVector, 3, Frame> dx_radius;
+    tnsr::i<DataVector, 3, Frame> normal_one_form;
+    ylm::Tags::aliases::Jacobian<Frame> tangents;
+  };
+
+  /*!
+   * \brief The `DerivedQuantities` of the current surface.
+   *
+   * \details The quantities are computed on the first call and kept until the
+   * surface changes, so repeated calls on the same surface (e.g. by several
+   * observers or control systems measuring the same horizon) only compute them
+   * once. Changes are detected by comparing the resolution, the expansion
+   * center and the coefficients to the ones the quantities were computed
+   * from, so modifying the surface through `coefficients()` is safe. Copies of
+   * the Strahlkorper share the computed quantities until they are modified.
+   * The returned pointer remains valid when the surface changes. This function
+   * may be called concurrently on the same surface, but not concurrently with
+   * copying or modifying the surface.
+   */
+  std::shared_ptr<const DerivedQuantities> derived_quantities() const;
+
  private:
+  struct DerivedQuantitiesCache {
+    size_t l_max;
+    size_t m_max;
+    std::array<double, 3> center;
+    DataVector coefficients;
+    std::shared_ptr<const DerivedQuantities> quantities;
+  };
+
   size_t l_max_{2}, m_max_{2};
   ylm::Spherepack ylm_{2, 2};
   std::array<double, 3> center_{{0.0, 0.0, 0.0}};
   DataVector strahlkorper_coefs_ = DataVector(ylm_.spectral_size(), 0.0);
+  // Accessed with `std::atomic_load` and `std::atomic_store` only
+  mutable std::shared_ptr<const DerivedQuantitiesCache>
+      derived_quantities_cache_{};
 };
 
 namespace OptionTags {
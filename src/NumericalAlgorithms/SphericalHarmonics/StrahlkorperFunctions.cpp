@@ -3,6 +3,8 @@
 
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 
+#include <cmath>
+#include <cstddef>
 #include <deque>
 #include <utility>
 
@@ -492,6 +494,44 @@ void time_deriv_of_strahlkorper(
   time_deriv->coefficients() = std::move(new_coefficients);
 }
 
+template <typename Frame>
+void extrapolate_strahlkorper(
+    const gsl::not_null<Strahlkorper<Frame>*> extrapolated,
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    const double time) {
+  size_t num_valid = 0;
+  while (num_valid < previous_strahlkorpers.size() and
+         not std::isnan(previous_strahlkorpers[num_valid].first)) {
+    ++num_valid;
+  }
+  if (num_valid < 2) {
+    return;
+  }
+
+  DataVector new_coefficients{extrapolated->coefficients().size(), 0.0};
+  for (size_t i = 0; i < num_valid; ++i) {
+    const auto& [time_i, strahlkorper_i] = previous_strahlkorpers[i];
+    double weight = 1.0;
+    for (size_t j = 0; j < num_valid; ++j) {
+      if (j != i) {
+        const double time_j = previous_strahlkorpers[j].first;
+        weight *= (time - time_j) / (time_i - time_j);
+      }
+    }
+    if (strahlkorper_i.l_max() == extrapolated->l_max() and
+        strahlkorper_i.m_max() == extrapolated->m_max()) {
+      new_coefficients += weight * strahlkorper_i.coefficients();
+    } else {
+      new_coefficients +=
+          weight * Strahlkorper<Frame>(extrapolated->l_max(),
+                                       extrapolated->m_max(), strahlkorper_i)
+                       .coefficients();
+    }
+  }
+  extrapolated->coefficients() = std::move(new_coefficients);
+}
+
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                                                  \
@@ -605,7 +645,11 @@ void time_deriv_of_strahlkorper(
       const std::vector<Strahlkorper<FRAME(data)>>& strahlkorpers);           \
   template void ylm::time_deriv_of_strahlkorper(                              \
       const gsl::not_null<Strahlkorper<FRAME(data)>*>,                        \
-      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&);
+      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&);       \
+  template void ylm::extrapolate_strahlkorper(                                \
+      const gsl::not_null<Strahlkorper<FRAME(data)>*>,                        \
+      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&,        \
+      double);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE,
                         (Frame::Distorted, Frame::Grid, Frame::Inertial))
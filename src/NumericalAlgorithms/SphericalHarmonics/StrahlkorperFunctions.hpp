@@ -387,4 +387,32 @@ void time_deriv_of_strahlkorper(
     gsl::not_null<Strahlkorper<Frame>*> time_deriv,
     const std::deque<std::pair<double, Strahlkorper<Frame>>>&
         previous_strahlkorpers);
+
+/*!
+ * \brief Extrapolate a number of previous Strahlkorpers to `time`
+ *
+ * \details Sets the coefficients of `extrapolated` to the Lagrange polynomial
+ * through the coefficients of the `previous_strahlkorpers`, evaluated at
+ * `time`. The polynomial has the degree one less than the number of previous
+ * Strahlkorpers up to the first one whose time is NaN (which marks an initial
+ * guess rather than a surface found at that time). If there are fewer than
+ * two such Strahlkorpers, `extrapolated` is left unchanged.
+ *
+ * The previous Strahlkorpers are prolonged or restricted to the
+ * \f$l_{\max}\f$ and \f$m_{\max}\f$ of `extrapolated`, so the resolution of
+ * the surface may change between finds. The expansion centers of all the
+ * Strahlkorpers are assumed to be the same.
+ *
+ * \param extrapolated Strahlkorper whose coefficients are set to the
+ * extrapolation. Its resolution and expansion center are kept.
+ * \param previous_strahlkorpers Previous Strahlkorpers and the times they are
+ * at, with the most recent Strahlkorper in the front of the deque.
+ * \param time The time to extrapolate to.
+ */
+template <typename Frame>
+void extrapolate_strahlkorper(
+    gsl::not_null<Strahlkorper<Frame>*> extrapolated,
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    double time);
 }  // namespace ylm
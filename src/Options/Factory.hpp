@@ -11,6 +11,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <yaml-cpp/yaml.h>
 
@@ -88,6 +89,37 @@ template <typename T>
 struct is_factory_creatable
     : std::bool_constant<get_factory_creatable_or_default_v<T, true>> {};
 
+template <typename BaseClass, typename Derived, typename Metavariables>
+std::unique_ptr<BaseClass> create_derived(const Option& options) {
+  return std::make_unique<Derived>(options.parse_as<Derived, Metavariables>());
+}
+
+// Maps the factory ids of the `CreatableClasses` to the functions that create
+// them. The table is built the first time a factory for `BaseClass` is
+// operated, so the class names are only computed once and each lookup is a
+// hash instead of a comparison with every creatable class.
+template <typename BaseClass, typename Metavariables, typename CreatableClasses>
+const std::unordered_map<std::string,
+                         std::unique_ptr<BaseClass> (*)(const Option&)>&
+factory_table() {
+  static const auto table = []() {
+    std::unordered_map<std::string,
+                       std::unique_ptr<BaseClass> (*)(const Option&)>
+        result{};
+    tmpl::for_each<CreatableClasses>([&result](auto derived_v) {
+      using Derived = tmpl::type_from<decltype(derived_v)>;
+      auto* const create_function =
+          &create_derived<BaseClass, Derived, Metavariables>;
+      [[maybe_unused]] const auto [entry, inserted] =
+          result.emplace(pretty_type::name<Derived>(), create_function);
+      ASSERT(inserted or entry->second == create_function,
+             "Duplicate factory id: " << entry->first);
+    });
+    return result;
+  }();
+  return table;
+}
+
 template <typename BaseClass, typename Metavariables>
 std::unique_ptr<BaseClass> create(const Option& options) {
   using all_creatable_classes =
@@ -123,18 +155,10 @@ std::unique_ptr<BaseClass> create(const Option& options) {
                 << node);
   }
 
-  std::unique_ptr<BaseClass> result;
-  tmpl::for_each<creatable_classes>(
-      [&id, &derived_opts, &result](auto derived_v) {
-        using Derived = tmpl::type_from<decltype(derived_v)>;
-        if (pretty_type::name<Derived>() == id) {
-          ASSERT(result == nullptr, "Duplicate factory id: " << id);
-          result = std::make_unique<Derived>(
-              derived_opts.parse_as<Derived, Metavariables>());
-        }
-      });
-  if (result != nullptr) {
-    return result;
+  const auto& table =
+      factory_table<BaseClass, Metavariables, creatable_classes>();
+  if (const auto derived = table.find(id); derived != table.end()) {
+    return derived->second(derived_opts);
   }
   PARSE_ERROR(derived_opts.context(),
               "Unknown Id '" << id << "'\n"
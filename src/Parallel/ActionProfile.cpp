@@ -0,0 +1,31 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ActionProfile.hpp"
+
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+
+namespace Parallel {
+void ActionProfile::pup(PUP::er& p) {
+  p | name;
+  p | number_of_invocations;
+  p | total_time;
+}
+
+bool operator==(const ActionProfile& lhs, const ActionProfile& rhs) {
+  return lhs.name == rhs.name and
+         lhs.number_of_invocations == rhs.number_of_invocations and
+         lhs.total_time == rhs.total_time;
+}
+
+bool operator!=(const ActionProfile& lhs, const ActionProfile& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os, const ActionProfile& profile) {
+  return os << profile.name << ": " << profile.number_of_invocations
+            << " invocations, " << profile.total_time << " s";
+}
+}  // namespace Parallel
@@ -0,0 +1,92 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Utilities/MakeString.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief How often and for how long an iterable action was run on an element
+ * of an array component.
+ *
+ * The DistributedObject records one profile for every action in every phase
+ * of an array component and stores them in `Parallel::Tags::ActionProfiles`.
+ * Use `Events::ObserveActionProfile` to write the sums over all elements to
+ * disk.
+ */
+struct ActionProfile {
+  /// The phase and the name of the action, e.g. `Evolve/UpdateU`
+  std::string name{};
+  /// Number of times the action was run, including the times it returned
+  /// `Parallel::AlgorithmExecution::Retry`
+  size_t number_of_invocations{0};
+  /// Total wall time spent in the action in seconds
+  double total_time{0.0};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+bool operator==(const ActionProfile& lhs, const ActionProfile& rhs);
+
+bool operator!=(const ActionProfile& lhs, const ActionProfile& rhs);
+
+std::ostream& operator<<(std::ostream& os, const ActionProfile& profile);
+
+namespace detail {
+// The profiles of all actions in the `PhaseDepActionLists`, with the actions
+// of each phase following those of the previous phase.
+template <typename... PhaseDepActionLists>
+std::vector<ActionProfile> make_action_profiles(
+    tmpl::list<PhaseDepActionLists...> /*meta*/) {
+  std::vector<ActionProfile> result{};
+  result.reserve((PhaseDepActionLists::number_of_actions + ... + 0));
+  const auto add_phase = [&result](auto phase_dep_action_list_v) {
+    using phase_dep_action_list = decltype(phase_dep_action_list_v);
+    tmpl::for_each<typename phase_dep_action_list::action_list>(
+        [&result](auto action_v) {
+          using action = tmpl::type_from<decltype(action_v)>;
+          result.push_back(ActionProfile{
+              MakeString{} << phase_dep_action_list::phase << "/"
+                           << pretty_type::name<action>(),
+              0, 0.0});
+        });
+  };
+  // In case of no phases avoid compiler warning.
+  (void)add_phase;
+  (add_phase(PhaseDepActionLists{}), ...);
+  return result;
+}
+
+// The index into the result of `make_action_profiles` of the first action in
+// the phase with index `phase_index` in the `PhaseDepActionLists`.
+template <typename... PhaseDepActionLists>
+constexpr size_t action_profile_offset(
+    tmpl::list<PhaseDepActionLists...> /*meta*/, const size_t phase_index) {
+  const std::array<size_t, sizeof...(PhaseDepActionLists)> sizes{
+      {PhaseDepActionLists::number_of_actions...}};
+  size_t offset = 0;
+  for (size_t i = 0; i < phase_index; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    offset += sizes[i];
+  }
+  return offset;
+}
+}  // namespace detail
+}  // namespace Parallel
@@ -16,6 +16,8 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Main.hpp"
 #include "Utilities/NoSuchType.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/System/TaskPool.hpp"
 
 namespace Parallel {
 namespace charmxx {
@@ -28,6 +30,8 @@ ReducerFunctions* charm_reducer_functions_list = nullptr;
 size_t charm_reducer_functions_capacity = 0;
 size_t charm_reducer_functions_size = 0;
 std::unordered_map<size_t, CkReduction::reducerType> charm_reducer_functions{};
+
+std::vector<double> charm_init_node_func_times{};
 /// \endcond
 
 /*!
@@ -96,6 +100,24 @@ inline void register_custom_reducer_functions() {
   }
 }
 
+/*!
+ * \ingroup CharmExtensionsGroup
+ * \brief Runs the `charm_init_node_funcs` in order and records the wall time
+ * each of them took in `charm_init_node_func_times`
+ *
+ * The times are printed by the main chare when the executable is launched with
+ * `--print-startup-timings`, e.g. to see how long the registration of the
+ * derived classes with Charm++ takes.
+ */
+inline void run_init_node_funcs() {
+  charm_init_node_func_times.reserve(charm_init_node_funcs.size());
+  for (const auto& init_node_func : charm_init_node_funcs) {
+    const double start_time = sys::wall_time();
+    (*init_node_func)();
+    charm_init_node_func_times.push_back(sys::wall_time() - start_time);
+  }
+}
+
 /*!
  * \ingroup CharmExtensionsGroup
  * \brief Register all init_node and init_proc functions with Charm++
@@ -111,13 +133,12 @@ inline void register_init_node_and_proc() {
   done_registration = true;
   // We explicitly register custom reducer functions first.
   _registerInitCall(register_custom_reducer_functions, 1);
-  for (const auto& init_node_func : charm_init_node_funcs) {
-    _registerInitCall(*init_node_func, 1);
-  }
+  _registerInitCall(run_init_node_funcs, 1);
 
   for (const auto& init_proc_func : charm_init_proc_funcs) {
     _registerInitCall(*init_proc_func, 0);
   }
+  _registerInitCall(sys::register_task_pool_idle_helper, 0);
 }
 }  // namespace charmxx
 }  // namespace Parallel
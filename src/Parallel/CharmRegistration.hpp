@@ -9,6 +9,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/ReductionDeclare.hpp"
@@ -58,6 +59,7 @@ struct RegistrationHelper;
 extern std::unique_ptr<RegistrationHelper>* charm_register_list;
 extern size_t charm_register_list_capacity;
 extern size_t charm_register_list_size;
+extern std::vector<double> charm_init_node_func_times;
 /// \endcond
 
 /*!
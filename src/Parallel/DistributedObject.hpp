@@ -4,11 +4,13 @@
 #pragma once
 
 #include <charm++.h>
+#include <chrono>
 #include <converse.h>
 #include <cstddef>
 #include <exception>
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <ostream>
@@ -19,9 +21,11 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "Parallel/ActionProfile.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/Algorithms/AlgorithmArrayDeclarations.hpp"
@@ -34,15 +38,19 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Local.hpp"
+#include "Parallel/MultiProducerQueue.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Parallel/Printf.hpp"
+#include "Parallel/Tags/ActionProfiles.hpp"
 #include "Parallel/Tags/ArrayIndex.hpp"
 #include "Parallel/Tags/DistributedObjectTags.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
+#include "Parallel/Tracing.hpp"
 #include "Parallel/TypeTraits.hpp"
+#include "Parallel/WriterThread.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -286,6 +294,9 @@ class DistributedObject<ParallelComponent,
     // definition is out of line.
     (void)Parallel::charmxx::RegisterThreadedAction<ParallelComponent, Action,
                                                     Args...>::registrar;
+    static const std::string trace_name =
+        make_trace_name<Action>("threaded_action");
+    const Parallel::tracing::Span trace_span{&trace_name};
     forward_tuple_to_threaded_action<Action>(
         std::move(args), std::make_index_sequence<sizeof...(Args)>{});
   }
@@ -300,6 +311,11 @@ class DistributedObject<ParallelComponent,
   /// When an algorithm has terminated it can be restarted by passing
   /// `enable_if_disabled = true`. This allows long-term disabling and
   /// re-enabling of algorithms
+  ///
+  /// On a nodegroup the data is first pushed to a lock-free queue. Only the
+  /// thread that finds the queue empty waits for the node lock and moves all
+  /// the queued data into the inboxes, so many elements sending to the same
+  /// node at once do not contend for the lock.
   template <typename ReceiveTag, typename ReceiveDataType>
   void receive_data(typename ReceiveTag::temporal_id instance,
                     ReceiveDataType&& t, bool enable_if_disabled = false);
@@ -407,6 +423,17 @@ class DistributedObject<ParallelComponent,
  private:
   void set_array_index();
 
+  // The action profiles are only recorded for array components, since the
+  // other components may run several actions on the same object at once.
+  static std::vector<ActionProfile> initial_action_profiles() {
+    if constexpr (Parallel::is_array<parallel_component>::value) {
+      return Parallel::detail::make_action_profiles(
+          phase_dependent_action_lists{});
+    } else {
+      return {};
+    }
+  }
+
   template <typename PhaseDepActions, size_t... Is>
   constexpr bool iterate_over_actions(std::index_sequence<Is...> /*meta*/);
 
@@ -423,6 +450,49 @@ class DistributedObject<ParallelComponent,
   // After catching an exception, shutdown the simulation
   void initiate_shutdown(const std::exception& exception);
 
+  // The name of the spans recorded by `Parallel::tracing` for an entry method
+  template <typename ActionOrTag>
+  static std::string make_trace_name(const std::string& entry_method) {
+    return pretty_type::name<ParallelComponent>() + " " + entry_method + " " +
+           pretty_type::name<ActionOrTag>();
+  }
+
+  // Data received by a nodegroup that has not been inserted into the inboxes
+  // yet.
+  struct PendingInboxInsertion {
+    PendingInboxInsertion() = default;
+    PendingInboxInsertion(const PendingInboxInsertion&) = delete;
+    PendingInboxInsertion& operator=(const PendingInboxInsertion&) = delete;
+    PendingInboxInsertion(PendingInboxInsertion&&) = delete;
+    PendingInboxInsertion& operator=(PendingInboxInsertion&&) = delete;
+    virtual ~PendingInboxInsertion() = default;
+
+    virtual void insert(gsl::not_null<DistributedObject*> object) = 0;
+  };
+
+  template <typename ReceiveTag, typename ReceiveDataType>
+  struct PendingInboxInsertionImpl final : PendingInboxInsertion {
+    PendingInboxInsertionImpl(typename ReceiveTag::temporal_id in_instance,
+                              ReceiveDataType&& in_data,
+                              const bool in_enable_if_disabled)
+        : instance(std::move(in_instance)),
+          data(std::forward<ReceiveDataType>(in_data)),
+          enable_if_disabled(in_enable_if_disabled) {}
+
+    void insert(const gsl::not_null<DistributedObject*> object) override {
+      if (enable_if_disabled) {
+        object->set_terminate(false);
+      }
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(object->inboxes_)), instance,
+          std::move(data));
+    }
+
+    typename ReceiveTag::temporal_id instance;
+    std::decay_t<ReceiveDataType> data;
+    bool enable_if_disabled;
+  };
+
   // Member variables
 #ifdef SPECTRE_CHARM_PROJECTIONS
   double non_action_time_start_;
@@ -436,6 +506,11 @@ class DistributedObject<ParallelComponent,
   tmpl::conditional_t<Parallel::is_node_group_proxy<cproxy_type>::value,
                       Parallel::NodeLock, NoSuchType>
       node_lock_;
+  tmpl::conditional_t<
+      Parallel::is_node_group_proxy<cproxy_type>::value,
+      Parallel::MultiProducerQueue<std::unique_ptr<PendingInboxInsertion>>,
+      NoSuchType>
+      pending_inbox_insertions_;
 
   bool terminate_{true};
   bool halt_algorithm_until_next_phase_{false};
@@ -513,7 +588,7 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
     ::Initialization::mutate_assign<
         tmpl::push_back<distributed_object_tags, InitializationTags...>>(
         make_not_null(&box_), metavariables{}, array_index_,
-        global_cache_proxy_,
+        global_cache_proxy_, initial_action_profiles(),
         std::move(get<InitializationTags>(initialization_items))...);
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
@@ -542,7 +617,7 @@ DistributedObject<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>::
     phase_ = current_phase;
     ::Initialization::mutate_assign<distributed_object_tags>(
         make_not_null(&box_), metavariables{}, array_index_,
-        global_cache_proxy_);
+        global_cache_proxy_, initial_action_profiles());
     callback->invoke();
   } catch (const std::exception& exception) {
     initiate_shutdown(exception);
@@ -644,7 +719,15 @@ void DistributedObject<
   p | phase_bookmarks_;
   p | algorithm_step_;
   if constexpr (Parallel::is_node_group_proxy<cproxy_type>::value) {
+    ASSERT(p.isSizing() or pending_inbox_insertions_.empty(),
+           "Cannot serialize while received data is waiting to be inserted "
+           "into the inboxes.");
     p | node_lock_;
+    // Writes done in the background hold pointers into the DataBox and must
+    // be on disk before a checkpoint is taken.
+    if (not p.isUnpacking()) {
+      Parallel::writer_thread().wait();
+    }
   }
   p | terminate_;
   p | halt_algorithm_until_next_phase_;
@@ -698,6 +781,9 @@ void DistributedObject<
   try {
     (void)Parallel::charmxx::RegisterReductionAction<
         ParallelComponent, Action, std::decay_t<Arg>>::registrar;
+    static const std::string trace_name =
+        make_trace_name<Action>("reduction_action");
+    const Parallel::tracing::Span trace_span{&trace_name};
     {
       std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
       if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
@@ -730,6 +816,9 @@ void DistributedObject<ParallelComponent,
   try {
     (void)Parallel::charmxx::RegisterSimpleAction<ParallelComponent, Action,
                                                   Args...>::registrar;
+    static const std::string trace_name =
+        make_trace_name<Action>("simple_action");
+    const Parallel::tracing::Span trace_span{&trace_name};
     {
       std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
       if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
@@ -761,6 +850,9 @@ void DistributedObject<
   try {
     (void)Parallel::charmxx::RegisterSimpleAction<ParallelComponent,
                                                   Action>::registrar;
+    static const std::string trace_name =
+        make_trace_name<Action>("simple_action");
+    const Parallel::tracing::Span trace_span{&trace_name};
     {
       std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
       if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
@@ -806,6 +898,9 @@ void DistributedObject<
     // NOLINTNEXTLINE(modernize-redundant-void-arg)
     (void)Parallel::charmxx::RegisterThreadedAction<ParallelComponent,
                                                     Action>::registrar;
+    static const std::string trace_name =
+        make_trace_name<Action>("threaded_action");
+    const Parallel::tracing::Span trace_span{&trace_name};
     Action::template apply<ParallelComponent>(
         box_, *Parallel::local_branch(global_cache_proxy_),
         static_cast<const array_index&>(array_index_),
@@ -824,11 +919,27 @@ void DistributedObject<ParallelComponent,
   try {
     (void)Parallel::charmxx::RegisterReceiveData<ParallelComponent, ReceiveTag,
                                                  false>::registrar;
-    {
-      std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
-      if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
-        hold_lock.emplace(node_lock_);
+    static const std::string trace_name =
+        make_trace_name<ReceiveTag>("receive_data");
+    const Parallel::tracing::Span trace_span{&trace_name};
+    if constexpr (Parallel::is_node_group_proxy<cproxy_type>::value) {
+      if (not pending_inbox_insertions_.push(
+              std::make_unique<
+                  PendingInboxInsertionImpl<ReceiveTag, ReceiveDataType>>(
+                  std::move(instance), std::forward<ReceiveDataType>(t),
+                  enable_if_disabled))) {
+        // The thread that pushed to the empty queue inserts this data and
+        // then runs the algorithm.
+        return;
+      }
+      {
+        const std::lock_guard<Parallel::NodeLock> hold_lock(node_lock_);
+        pending_inbox_insertions_.drain(
+            [this](const std::unique_ptr<PendingInboxInsertion>& insertion) {
+              insertion->insert(make_not_null(this));
+            });
       }
+    } else {
       if (enable_if_disabled) {
         set_terminate(false);
       }
@@ -850,6 +961,9 @@ void DistributedObject<ParallelComponent,
   try {
     (void)Parallel::charmxx::RegisterReceiveData<ParallelComponent, ReceiveTag,
                                                  true>::registrar;
+    static const std::string trace_name =
+        make_trace_name<ReceiveTag>("receive_data");
+    const Parallel::tracing::Span trace_span{&trace_name};
     {
       std::optional<std::lock_guard<Parallel::NodeLock>> hold_lock{};
       if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
@@ -1098,10 +1212,36 @@ bool DistributedObject<
 
   AlgorithmExecution requested_execution{};
   std::optional<std::size_t> next_action_step{};
+  const auto start_time = std::chrono::steady_clock::now();
   std::tie(requested_execution, next_action_step) = ThisAction::apply(
       box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
       std::as_const(array_index_), actions_list{},
       std::add_pointer_t<ParallelComponent>{});
+  const auto end_time = std::chrono::steady_clock::now();
+  static const std::string trace_name =
+      MakeString{} << pretty_type::name<ParallelComponent>() << " "
+                   << phase_dep_action::phase << "/"
+                   << pretty_type::name<ThisAction>();
+  Parallel::tracing::record(&trace_name, start_time, end_time);
+  if constexpr (Parallel::is_array<parallel_component>::value) {
+    constexpr size_t profile_index =
+        Parallel::detail::action_profile_offset(phase_dependent_action_lists{},
+                                                PhaseIndex::value) +
+        DataBoxIndex::value;
+    db::mutate<Tags::ActionProfiles>(
+        [&start_time, &end_time](
+            const gsl::not_null<std::vector<ActionProfile>*> action_profiles) {
+          ASSERT(profile_index < action_profiles->size(),
+                 "Expected at least " << profile_index + 1
+                                      << " action profiles but got "
+                                      << action_profiles->size());
+          ActionProfile& profile = (*action_profiles)[profile_index];
+          ++profile.number_of_invocations;
+          profile.total_time +=
+              std::chrono::duration<double>(end_time - start_time).count();
+        },
+        make_not_null(&box_));
+  }
 
   if (next_action_step.has_value()) {
     ASSERT(
@@ -1137,6 +1277,10 @@ template <typename ParallelComponent, typename... PhaseDepActionListsPack>
 void DistributedObject<ParallelComponent,
                        tmpl::list<PhaseDepActionListsPack...>>::
     contribute_termination_status_to_main() {
+  if constexpr (Parallel::is_node_group_proxy<cproxy_type>::value) {
+    // Finish the writes done in the background before the run can exit.
+    Parallel::writer_thread().wait();
+  }
   auto* global_cache = Parallel::local_branch(global_cache_proxy_);
   if (UNLIKELY(global_cache == nullptr)) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <charm++.h>
 #include <cstddef>
+#include <limits>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -96,6 +99,26 @@ void simple_action(Proxy&& proxy, Arg0&& arg0, Args&&... args) {
 }
 /// @}
 
+/*!
+ * \ingroup ParallelGroup
+ * \brief Invoke a simple action on `proxy` with the lowest message priority
+ *
+ * \details The action only runs once the receiving PE has processed all
+ * pending messages of higher (e.g. the default) priority, i.e., when it would
+ * otherwise be idle. Use this for work that nothing is waiting for urgently,
+ * such as packing observation data.
+ */
+template <typename Action, typename Proxy, typename Arg0, typename... Args>
+void low_priority_simple_action(Proxy&& proxy, Arg0&& arg0, Args&&... args) {
+  CkEntryOptions options{};
+  options.setPriority(std::numeric_limits<int>::max());
+  proxy.template simple_action<Action, std::decay_t<Arg0>,
+                               std::decay_t<Args>...>(
+      std::tuple<std::decay_t<Arg0>, std::decay_t<Args>...>(
+          std::forward<Arg0>(arg0), std::forward<Args>(args)...),
+      &options);
+}
+
 /*!
  * \ingroup ParallelGroup
  * \brief Invoke a local synchronous action on `proxy`
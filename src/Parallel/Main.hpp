@@ -9,12 +9,14 @@
 #include <array>
 #include <boost/program_options.hpp>
 #include <charm++.h>
+#include <cstddef>
 #include <initializer_list>
 #include <pup.h>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Informer/Informer.hpp"
 #include "Options/ParseOptions.hpp"
@@ -295,6 +297,9 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
          "Dump the contents of SpECTRE's BuildInfo.txt")
         ("dump-only",
          "Exit after dumping requested information.")
+        ("print-startup-timings",
+         "Print the wall time each function in 'charm_init_node_funcs' took "
+         "at startup, e.g. to register derived classes with Charm++.")
         ;
     // clang-format on
 
@@ -362,6 +367,17 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
     Options::Parser<tmpl::remove<option_list, Options::Tags::InputSource>>
         options(Metavariables::help);
 
+    if (parsed_command_line_options.count("print-startup-timings") != 0) {
+      const auto& times = Parallel::charmxx::charm_init_node_func_times;
+      double total_time = 0.0;
+      Parallel::printf("Wall time of the charm_init_node_funcs in seconds:\n");
+      for (size_t i = 0; i < times.size(); ++i) {
+        Parallel::printf("  %zu: %f\n", i, times[i]);
+        total_time += times[i];
+      }
+      Parallel::printf("  Total: %f\n", total_time);
+    }
+
     if (parsed_command_line_options.count("help") != 0) {
       Parallel::printf("%s\n%s", command_line_options, options.help());
       sys::exit();
@@ -400,11 +416,13 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
         options.parse(
             "ResourceInfo:\n"
             "  AvoidGlobalProc0: false\n"
+            "  ReservedProcsPerNode: 0\n"
             "  Singletons: Auto\n");
       } else {
         options.parse(
             "ResourceInfo:\n"
-            "  AvoidGlobalProc0: false\n");
+            "  AvoidGlobalProc0: false\n"
+            "  ReservedProcsPerNode: 0\n");
       }
     }
 
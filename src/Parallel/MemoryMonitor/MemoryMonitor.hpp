@@ -26,12 +26,17 @@ namespace mem_monitor {}
 namespace mem_monitor {
 namespace detail {
 struct InitializeMutator : tt::ConformsTo<db::protocols::Mutator> {
-  using return_tags = tmpl::list<mem_monitor::Tags::MemoryHolder>;
+  using return_tags = tmpl::list<mem_monitor::Tags::MemoryHolder,
+                                 mem_monitor::Tags::MaximumTotalMemory,
+                                 mem_monitor::Tags::PreviousTotalMemory>;
   using argument_tags = tmpl::list<>;
 
   using tag_type = typename mem_monitor::Tags::MemoryHolder::type;
+  using totals_type = typename mem_monitor::Tags::MaximumTotalMemory::type;
 
-  static void apply(const gsl::not_null<tag_type*> /*holder*/) {}
+  static void apply(const gsl::not_null<tag_type*> /*holder*/,
+                    const gsl::not_null<totals_type*> /*maximum_totals*/,
+                    const gsl::not_null<totals_type*> /*previous_totals*/) {}
 };
 }  // namespace detail
 
@@ -36,5 +36,21 @@ struct MemoryHolder : db::SimpleTag {
   using type = std::unordered_map<
       std::string, std::unordered_map<double, std::unordered_map<int, double>>>;
 };
+
+/*!
+ * \brief Tag to hold the largest total memory usage in MB, summed over all
+ * nodes, that has been observed for each parallel component.
+ */
+struct MaximumTotalMemory : db::SimpleTag {
+  using type = std::unordered_map<std::string, double>;
+};
+
+/*!
+ * \brief Tag to hold the total memory usage in MB, summed over all nodes,
+ * that was observed most recently for each parallel component.
+ */
+struct PreviousTotalMemory : db::SimpleTag {
+  using type = std::unordered_map<std::string, double>;
+};
 }  // namespace Tags
 }  // namespace mem_monitor
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief A lock-free queue that any number of threads may push to and a
+ * single thread at a time drains.
+ *
+ * \details `push` never blocks, so many threads on a node can hand off work
+ * to the owner of a shared resource without contending on a lock. The owner
+ * (or whichever thread currently holds the lock protecting the resource) calls
+ * `drain`, which removes all the queued values at once and processes them in
+ * the order they were pushed. Pushes that race with a `drain` are either
+ * processed by it or left for the next one.
+ *
+ * \warning Only one thread may call `drain` at a time.
+ */
+template <typename T>
+class MultiProducerQueue {
+ public:
+  MultiProducerQueue() = default;
+  MultiProducerQueue(const MultiProducerQueue&) = delete;
+  MultiProducerQueue& operator=(const MultiProducerQueue&) = delete;
+  MultiProducerQueue(MultiProducerQueue&&) = delete;
+  MultiProducerQueue& operator=(MultiProducerQueue&&) = delete;
+  ~MultiProducerQueue() { delete_nodes(head_.exchange(nullptr)); }
+
+  /// Add a value to the queue.  Safe to call from any thread.
+  ///
+  /// Returns `true` if the queue was empty, i.e., if no earlier value is
+  /// waiting for a `drain`.  If every thread that gets `true` calls `drain`
+  /// afterwards, every value is drained without the other producers having to
+  /// wait.
+  bool push(T value) {
+    auto* const node = new Node{std::move(value), head_.load()};
+    while (not head_.compare_exchange_weak(node->next, node)) {
+    }
+    return node->next == nullptr;
+  }
+
+  /// Remove all values from the queue and call `f` on each of them in the
+  /// order they were pushed.
+  template <typename F>
+  void drain(F&& f) {
+    Node* node = head_.exchange(nullptr);
+    // The list is last-in-first-out, so reverse it.
+    Node* reversed = nullptr;
+    while (node != nullptr) {
+      Node* const next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    while (reversed != nullptr) {
+      Node* const next = reversed->next;
+      reversed->next = nullptr;
+      try {
+        f(std::move(reversed->value));
+      } catch (...) {
+        delete reversed;
+        delete_nodes(next);
+        throw;
+      }
+      delete reversed;
+      reversed = next;
+    }
+  }
+
+  /// Whether the queue is empty.  The result may be out of date if other
+  /// threads are pushing.
+  bool empty() const { return head_.load() == nullptr; }
+
+ private:
+  struct Node {
+    T value;
+    Node* next;
+  };
+
+  static void delete_nodes(Node* node) {
+    while (node != nullptr) {
+      Node* const next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  std::atomic<Node*> head_{nullptr};
+};
+}  // namespace Parallel
@@ -103,6 +103,16 @@ struct CheckpointAndExitRequested {
  * the executable to clean up. In this case, triggering a global sync every
  * 2-10 minutes might be desirable. Matching the global sync frequency with the
  * time window for checkpoint and exit is the responsibility of the user!
+ *
+ * \note The checkpoint is written by `CkStartCheckpoint` from the
+ * `Parallel::Phase::WriteCheckpoint` phase, which the Main chare only starts
+ * after quiescence. Every object is serialized straight to disk, and the
+ * evolution cannot resume until Charm++ reports that all the files are written.
+ * Budget the time window above with the size of the checkpoint and the
+ * bandwidth of the file system in mind. Overlapping the writes with the
+ * evolution is not possible. Charm++ gives no way to continue from a
+ * checkpoint that is still being written, and staging the serialized objects
+ * in memory would double the memory footprint at the moment it is highest.
  */
 struct CheckpointAndExitAfterWallclock : public PhaseChange {
   CheckpointAndExitAfterWallclock(const std::optional<double> wallclock_hours,
@@ -129,6 +139,12 @@ struct CheckpointAndExitAfterWallclock : public PhaseChange {
       "writing a checkpoint and then exit with the 'ContinueFromCheckpoint' "
       "exit code."};
 
+  /// A phase change with no `WallclockHours` never requests a checkpoint, so
+  /// its trigger does not need to halt the evolution.
+  bool needs_synchronization() const override {
+    return wallclock_hours_for_checkpoint_and_exit_.has_value();
+  }
+
   using argument_tags = tmpl::list<>;
   using return_tags = tmpl::list<>;
 
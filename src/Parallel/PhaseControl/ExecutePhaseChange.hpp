@@ -14,6 +14,7 @@
 #include "Parallel/PhaseControl/ContributeToPhaseChangeReduction.hpp"
 #include "Parallel/PhaseControl/PhaseChange.hpp"
 #include "Parallel/PhaseControl/PhaseControlTags.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -43,7 +44,9 @@ namespace Actions {
  * This action iterates over the `Tags::PhaseChangeAndTriggers`, sending
  * reduction data for the phase decision for each triggered `PhaseChange`, then
  * halts the algorithm execution so that the `Main` chare can make a phase
- * decision if any were triggered.
+ * decision if any were triggered. Triggers for which no `PhaseChange` reports
+ * `PhaseChange::needs_synchronization()` are not checked, so they never halt
+ * the algorithm.
  *
  * Uses:
  * - GlobalCache: `Tags::PhaseChangeAndTriggers`
@@ -75,8 +78,15 @@ struct ExecutePhaseChange {
     bool should_halt = false;
     for (const auto& trigger_and_phase_changes : phase_change_and_triggers) {
       const auto& trigger = trigger_and_phase_changes.trigger;
+      const auto& phase_changes = trigger_and_phase_changes.phase_changes;
+      // Skip the (relatively expensive) trigger check and the global
+      // synchronization if none of the phase changes could request a phase.
+      if (alg::none_of(phase_changes, [](const auto& phase_change) {
+            return phase_change->needs_synchronization();
+          })) {
+        continue;
+      }
       if (trigger->is_triggered(box)) {
-        const auto& phase_changes = trigger_and_phase_changes.phase_changes;
         for (const auto& phase_change : phase_changes) {
           phase_change->template contribute_phase_data<ParallelComponent>(
               make_not_null(&box), cache, array_index);
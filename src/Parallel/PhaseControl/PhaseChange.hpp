@@ -154,6 +154,14 @@ struct PhaseChange : public PUP::able {
 
   WRAPPED_PUPable_abstract(PhaseChange);  // NOLINT
 
+  /// Whether this phase change can ever request a phase, so that the
+  /// components must halt for arbitration when its trigger fires.
+  ///
+  /// `Actions::ExecutePhaseChange` skips the reduction, and does not halt,
+  /// for a trigger whose phase changes all return `false`. The result must be
+  /// the same on every processor, so it should depend only on the options.
+  virtual bool needs_synchronization() const { return true; }
+
   /// Send data from all `participating_components` to the Main chare for
   /// determining the next phase.
   template <typename ParallelComponent, typename DbTags, typename Metavariables,
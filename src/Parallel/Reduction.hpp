@@ -4,6 +4,8 @@
 #pragma once
 
 #include <charm++.h>
+#include <cstddef>
+#include <memory>
 #include <tuple>
 
 #include "Parallel/CharmRegistration.hpp"
@@ -255,6 +257,18 @@ NoSection& no_section();
  *
  * \snippet Test_SectionReductions.cpp section_reduction
  *
+ * \par Combining on each node
+ * The contributions are combined hierarchically by Charm++, so they don't
+ * travel to the target individually. All contributions from array elements
+ * on a PE are first combined with `ReductionData::combine` on that PE, and
+ * only the result is passed up the reduction tree of PEs. That tree is built
+ * from the machine topology, so the PEs of a node are combined before a
+ * message leaves the node. Collecting the contributions in a nodegroup first,
+ * like `observers::ObserverWriter` does for observations, would therefore not
+ * reduce the number of messages sent between nodes, but would add a hop and
+ * a lock to every reduction. Observers do this only because they need to
+ * write data from each node, not to speed up the reduction.
+ *
  * \warning Section reductions currently don't support migrating elements, i.e.
  * either load-balancing or restoring a checkpoint to a different number of PEs.
  * Support for migrating elements may require [updating the "section
@@ -276,21 +290,27 @@ void contribute_to_reduction(ReductionData<Ts...> reduction_data,
       TargetProxy::index_t::template redn_wrapper_reduction_action<
           Action, std::decay_t<ReductionData<Ts...>>>(nullptr),
       target_component);
-  const auto& charm_reducer_function =
+  // The reducer is registered with Charm++ before any reduction can start, so
+  // it only has to be looked up once.
+  static const CkReduction::reducerType charm_reducer_function =
       Parallel::charmxx::charm_reducer_functions.at(
           std::hash<Parallel::charmxx::ReducerFunctions>{}(
               &ReductionData<Ts...>::combine));
+  // Size the data once instead of separately for the buffer and the message
+  const size_t packed_size = reduction_data.size();
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  const auto packed_data = std::make_unique<char[]>(packed_size);
+  PUP::toMem packer(packed_data.get());
+  packer | reduction_data;
   if constexpr (std::is_same_v<SectionType, NoSection>) {
     if constexpr (is_array_element_proxy<SenderProxy>::value) {
       Parallel::local(sender_component)
-          ->contribute(static_cast<int>(reduction_data.size()),
-                       reduction_data.packed().get(), charm_reducer_function,
-                       callback);
+          ->contribute(static_cast<int>(packed_size), packed_data.get(),
+                       charm_reducer_function, callback);
     } else {
       Parallel::local_branch(sender_component)
-          ->contribute(static_cast<int>(reduction_data.size()),
-                       reduction_data.packed().get(), charm_reducer_function,
-                       callback);
+          ->contribute(static_cast<int>(packed_size), packed_data.get(),
+                       charm_reducer_function, callback);
     }
   } else {
     static_assert(
@@ -312,8 +332,7 @@ void contribute_to_reduction(ReductionData<Ts...> reduction_data,
     // https://charm.readthedocs.io/en/latest/charm++/manual.html#section-operations-with-migrating-elements).
     // In that case we can possibly broadcast a CkMulticast message to all
     // elements to update their section cookies.
-    SectionProxy::contribute(static_cast<int>(reduction_data.size()),
-                             reduction_data.packed().get(),
+    SectionProxy::contribute(static_cast<int>(packed_size), packed_data.get(),
                              charm_reducer_function, section_cookie, callback);
   }
 }
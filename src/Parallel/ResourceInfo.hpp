@@ -245,6 +245,7 @@ using singleton_components =
  * \code {.yaml}
  * ResourceInfo:
  *   AvoidGlobalProc0: true
+ *   ReservedProcsPerNode: 0
  * \endcode
  *
  * If you have singletons, but do not want to assign any of them to a specific
@@ -255,6 +256,7 @@ using singleton_components =
  * ResourceInfo:
  *   AvoidGlobalProc0: true
  *   Singletons: Auto
+ *   ReservedProcsPerNode: 0
  * \endcode
  *
  * Otherwise, you will need to specify a block in the input file as below,
@@ -268,6 +270,7 @@ using singleton_components =
  *       Proc: 2
  *       Exclusive: true
  *     MySingleton2: Auto
+ *   ReservedProcsPerNode: 0
  * \endcode
  *
  * where `MySingleton1` is the `pretty_type::name` of the singleton component
@@ -276,6 +279,16 @@ using singleton_components =
  * you want to have it's proc determined automatically and be non-exclusive,
  * like `MySingleton2`).
  *
+ * The `ReservedProcsPerNode` option keeps that many procs on each node free of
+ * array elements, e.g. `ReservedProcsPerNode: 1` in the blocks above. The last
+ * procs on each node that are not taken by exclusive singletons are reserved.
+ * Charm++ runs the entry methods of nodegroups such as the observer writer,
+ * the interpolator, and the memory monitor on whichever proc of the node
+ * becomes idle first, so on the reserved procs this work no longer waits for
+ * element work and doesn't delay the elements. Singletons with an `Auto` proc
+ * that are not exclusive are placed on the reserved procs as well, so e.g.
+ * horizon finders and control systems run there too.
+ *
  * Several consistency checks are done during option parsing to avoid user
  * error. However, some checks can't be done during option parsing because the
  * number of nodes/procs is needed to determine if there is an inconsistency.
@@ -310,12 +323,14 @@ using singleton_components =
  *    evenly distributed the `exclusive` singletons could be. However, this *is*
  *    the most evenly distributed they could be given the starting distribution
  *    from the input file.
- * 3. Allocate `auto nonexclusive` singletons, distributing the total number of
+ * 3. Reserve `ReservedProcsPerNode` procs on each node, if requested.
+ * 4. Allocate `auto nonexclusive` singletons, distributing the total number of
  *    `nonexclusive` singletons (`auto` + `requested`): First, as evenly as
  *    possibly over the number of nodes. Then, on each node, distributing the
  *    singletons as evenly as possibly over the number of processors on that
- *    node. The same disclaimer about "as evenly as possibly" from the previous
- *    step applies here.
+ *    node, or over the reserved processors if there are any. The same
+ *    disclaimer about "as evenly as possibly" from the previous step applies
+ *    here.
  *
  * The goal of this algorithm is to mimic, as best as possible, how a human
  * would distribute this workload. It isn't perfect, but is a significant
@@ -349,10 +364,21 @@ struct ResourceInfo {
         "0."};
   };
 
-  using options = tmpl::push_front<
-      tmpl::conditional_t<tmpl::size<singletons>::value != 0,
-                          tmpl::list<Singletons>, tmpl::list<>>,
-      AvoidGlobalProc0>;
+  struct ReservedProcsPerNode {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Number of procs on each node that are kept free of Array elements, so "
+        "they are available for the work of nodegroups (e.g. observers and "
+        "interpolators) and singletons. Singletons with an Auto proc are "
+        "placed on these procs. Set to 0 to place elements on all procs."};
+  };
+
+  using options = tmpl::push_back<
+      tmpl::push_front<
+          tmpl::conditional_t<tmpl::size<singletons>::value != 0,
+                              tmpl::list<Singletons>, tmpl::list<>>,
+          AvoidGlobalProc0>,
+      ReservedProcsPerNode>;
 
   static constexpr Options::String help = {
       "Resource options for a simulation. This information will be used when "
@@ -362,6 +388,18 @@ struct ResourceInfo {
   /// The main constructor. All other constructors that take options will call
   /// this one. This constructor holds all checks able to be done during option
   /// parsing.
+  ResourceInfo(const bool avoid_global_proc_0,
+               const std::optional<SingletonPack<singletons>>& singleton_pack,
+               size_t reserved_procs_per_node,
+               const Options::Context& context = {});
+
+  /// This constructor is used when no SingletonInfoHolders are specified.
+  /// Calls the main constructor with an empty SingletonPack.
+  ResourceInfo(const bool avoid_global_proc_0,
+               size_t reserved_procs_per_node,
+               const Options::Context& context = {});
+
+  /// Same as the main constructor, but without reserved procs
   ResourceInfo(const bool avoid_global_proc_0,
                const std::optional<SingletonPack<singletons>>& singleton_pack,
                const Options::Context& context = {});
@@ -386,6 +424,15 @@ struct ResourceInfo {
   /// the global zeroth proc. Default `false`.
   bool avoid_global_proc_0() const { return avoid_global_proc_0_; }
 
+  /// Returns the number of procs on each node that are kept free of array
+  /// elements. Default `0`.
+  size_t reserved_procs_per_node() const { return reserved_procs_per_node_; }
+
+  /// Returns the procs that are kept free of array elements for nodegroup and
+  /// singleton work, `ReservedProcsPerNode` on each node. These are also part
+  /// of `procs_to_ignore()`.
+  const std::set<size_t>& reserved_procs() const;
+
   /// Return a SingletonInfoHolder corresponding to `Component`
   template <typename Component>
   auto get_singleton_info() const;
@@ -433,6 +480,7 @@ struct ResourceInfo {
         "build_singleton_map() before you call this function.");
   }
   bool avoid_global_proc_0_{false};
+  size_t reserved_procs_per_node_{0};
   bool singleton_map_has_been_set_{false};
   // These are quantities that we will need for placing singletons which can be
   // determined just by option parsing
@@ -441,8 +489,10 @@ struct ResourceInfo {
   size_t num_requested_exclusive_singletons_{};
   size_t num_requested_nonexclusive_singletons_{};
   std::unordered_multiset<size_t> requested_nonexclusive_procs_{};
-  // Procs that are exclusive. These may or may not be specifically requested
+  // Procs that are exclusive. These may or may not be specifically requested.
+  // The reserved procs are added once the singleton map is built.
   std::unordered_set<size_t> procs_to_ignore_{};
+  std::set<size_t> reserved_procs_{};
   std::set<size_t> procs_available_for_elements_{};
   // For each singleton (whether it has a SingletonInfo or not), maps whether
   // it's exclusive and what proc it is on.
@@ -453,8 +503,9 @@ template <typename Metavariables>
 ResourceInfo<Metavariables>::ResourceInfo(
     const bool avoid_global_proc_0,
     const std::optional<SingletonPack<singletons>>& opt_singleton_pack,
-    const Options::Context& context)
-    : avoid_global_proc_0_(avoid_global_proc_0) {
+    const size_t reserved_procs_per_node, const Options::Context& context)
+    : avoid_global_proc_0_(avoid_global_proc_0),
+      reserved_procs_per_node_(reserved_procs_per_node) {
   if (avoid_global_proc_0_) {
     procs_to_ignore_.insert(0);
     ++num_procs_to_ignore_;
@@ -555,14 +606,29 @@ ResourceInfo<Metavariables>::ResourceInfo(
   }
 }
 
+template <typename Metavariables>
+ResourceInfo<Metavariables>::ResourceInfo(const bool avoid_global_proc_0,
+                                          const size_t reserved_procs_per_node,
+                                          const Options::Context& context)
+    : ResourceInfo(avoid_global_proc_0, std::nullopt, reserved_procs_per_node,
+                   context) {}
+
+template <typename Metavariables>
+ResourceInfo<Metavariables>::ResourceInfo(
+    const bool avoid_global_proc_0,
+    const std::optional<SingletonPack<singletons>>& singleton_pack,
+    const Options::Context& context)
+    : ResourceInfo(avoid_global_proc_0, singleton_pack, 0, context) {}
+
 template <typename Metavariables>
 ResourceInfo<Metavariables>::ResourceInfo(const bool avoid_global_proc_0,
                                           const Options::Context& context)
-    : ResourceInfo(avoid_global_proc_0, std::nullopt, context) {}
+    : ResourceInfo(avoid_global_proc_0, std::nullopt, 0, context) {}
 
 template <typename Metavariables>
 void ResourceInfo<Metavariables>::pup(PUP::er& p) {
   p | avoid_global_proc_0_;
+  p | reserved_procs_per_node_;
   p | singleton_map_has_been_set_;
   p | num_exclusive_singletons_;
   p | num_procs_to_ignore_;
@@ -570,6 +636,7 @@ void ResourceInfo<Metavariables>::pup(PUP::er& p) {
   p | num_requested_nonexclusive_singletons_;
   p | requested_nonexclusive_procs_;
   p | procs_to_ignore_;
+  p | reserved_procs_;
   p | procs_available_for_elements_;
   p | singleton_map_;
 }
@@ -595,6 +662,14 @@ const std::unordered_set<size_t>& ResourceInfo<Metavariables>::procs_to_ignore()
   return procs_to_ignore_;
 }
 
+template <typename Metavariables>
+const std::set<size_t>& ResourceInfo<Metavariables>::reserved_procs() const {
+  if (not singleton_map_has_been_set_) {
+    singleton_map_not_built();
+  }
+  return reserved_procs_;
+}
+
 template <typename Metavariables>
 const std::set<size_t>&
 ResourceInfo<Metavariables>::procs_available_for_elements() const {
@@ -617,6 +692,7 @@ template <typename Metavars>
 bool operator==(const ResourceInfo<Metavars>& lhs,
                 const ResourceInfo<Metavars>& rhs) {
   return lhs.avoid_global_proc_0_ == rhs.avoid_global_proc_0_ and
+         lhs.reserved_procs_per_node_ == rhs.reserved_procs_per_node_ and
          lhs.singleton_map_has_been_set_ == rhs.singleton_map_has_been_set_ and
          lhs.num_exclusive_singletons_ == rhs.num_exclusive_singletons_ and
          lhs.num_procs_to_ignore_ == rhs.num_procs_to_ignore_ and
@@ -627,6 +703,7 @@ bool operator==(const ResourceInfo<Metavars>& lhs,
          lhs.requested_nonexclusive_procs_ ==
              rhs.requested_nonexclusive_procs_ and
          lhs.procs_to_ignore_ == rhs.procs_to_ignore_ and
+         lhs.reserved_procs_ == rhs.reserved_procs_ and
          lhs.procs_available_for_elements_ ==
              rhs.procs_available_for_elements_ and
          lhs.singleton_map_ == rhs.singleton_map_;
@@ -781,6 +858,29 @@ break_auto_exclusive_loops:
          "number of auto exclusive singletons to be allocated is "
              << alg::accumulate(auto_exclusive_singletons_on_each_node, 0_st));
 
+  // Procs without nonexclusive singletons. The reserved procs are excluded
+  // from this set because singletons may be placed on them
+  const std::unordered_set<size_t> procs_without_singletons = procs_to_ignore_;
+
+  // Reserve the last procs on each node that are not taken by exclusive
+  // singletons. Array elements are not placed on these procs, so they are idle
+  // whenever there is no nodegroup or singleton work to do.
+  for (size_t node = 0; node < num_nodes and reserved_procs_per_node_ > 0;
+       ++node) {
+    const size_t first_proc = Parallel::first_proc_on_node<size_t>(node, cache);
+    size_t reserved_on_node = 0;
+    for (size_t proc =
+             first_proc + Parallel::procs_on_node<size_t>(node, cache);
+         proc > first_proc and reserved_on_node < reserved_procs_per_node_;
+         --proc) {
+      if (procs_to_ignore_.find(proc - 1) == procs_to_ignore_.end()) {
+        reserved_procs_.insert(proc - 1);
+        ++reserved_on_node;
+      }
+    }
+  }
+  procs_to_ignore_.insert(reserved_procs_.begin(), reserved_procs_.end());
+
   // procs_to_ignore_ is now complete. Now construct
   // procs_available_for_elements_
   for (size_t i = 0; i < num_procs; i++) {
@@ -788,6 +888,13 @@ break_auto_exclusive_loops:
       procs_available_for_elements_.insert(i);
     }
   }
+  if (procs_available_for_elements_.empty()) {
+    ERROR("No procs are left for array elements after reserving "
+          << reserved_procs_per_node_
+          << " procs on each node. Reduce the ReservedProcsPerNode option or "
+             "run on more procs. Number of procs: "
+          << num_procs << ".");
+  }
 
   // At this point, all auto exclusive singletons have been allocated. Now the
   // only singletons left are auto non-exclusive. We use vectors of
@@ -804,7 +911,7 @@ break_auto_exclusive_loops:
   // have singletons, which will usually be a small subset of the total procs.
   std::vector<std::optional<size_t>> auto_nonexclusive_singletons_on_each_proc(
       num_procs, std::nullopt);
-  for (const size_t proc : procs_to_ignore_) {
+  for (const size_t proc : procs_without_singletons) {
     nonexclusive_singletons_on_each_proc[proc] = std::nullopt;
   }
   // Now we add in the requested nonexclusive to the total number of singletons
@@ -813,6 +920,15 @@ break_auto_exclusive_loops:
     ++*nonexclusive_singletons_on_each_proc[proc];
     ++singletons_on_each_node[Parallel::node_of<size_t>(proc, cache)];
   }
+  // Auto nonexclusive singletons go on the reserved procs, if there are any,
+  // so they don't compete with the array elements
+  if (not reserved_procs_.empty()) {
+    for (size_t proc = 0; proc < num_procs; ++proc) {
+      if (reserved_procs_.count(proc) == 0) {
+        nonexclusive_singletons_on_each_proc[proc] = std::nullopt;
+      }
+    }
+  }
 
   size_t remaining_auto_nonexclusive_singletons =
       tmpl::size<singletons>::value - num_exclusive_singletons_ -
@@ -937,6 +1053,14 @@ break_auto_nonexclusive_loops:
     ss << ", exclusive = " << std::boolalpha << singleton_map.first << "\n";
   });
 
+  if (not reserved_procs_.empty()) {
+    ss << "Reserved procs without array elements:";
+    for (const size_t proc : reserved_procs_) {
+      ss << " " << proc;
+    }
+    ss << "\n";
+  }
+
   ss << "\n";
   Parallel::printf("%s", ss.str());
 
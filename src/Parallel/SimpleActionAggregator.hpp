@@ -0,0 +1,298 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <pup.h>
+#include <pup_stl.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/Serialization/PupStlCpp11.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace db {
+template <typename TagsList>
+class DataBox;
+}  // namespace db
+/// \endcond
+
+namespace Parallel {
+namespace Actions {
+/*!
+ * \ingroup ActionsGroup
+ * \ingroup ParallelGroup
+ * \brief Simple action that invokes the simple action `Action` once for
+ * every set of arguments in a batch sent by a
+ * `Parallel::SimpleActionAggregator`.
+ *
+ * The calls are made in the order the arguments were added to the batch.
+ */
+template <typename Action>
+struct ApplyAggregated {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, typename... Args>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index,
+                    std::vector<std::tuple<Args...>> batch) {
+    for (auto& args : batch) {
+      std::apply(
+          [&box, &cache, &array_index](auto&... unpacked_args) {
+            Action::template apply<ParallelComponent>(
+                box, cache, array_index, std::move(unpacked_args)...);
+          },
+          args);
+    }
+  }
+};
+}  // namespace Actions
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief When a `Parallel::SimpleActionAggregator` sends its buffered calls.
+ *
+ * The calls buffered for a destination are sent as one message as soon as
+ * there are `MaxMessages` of them, their serialized size reaches `MaxBytes`,
+ * or the oldest of them has waited `MaxDelay` seconds. The delay is only
+ * checked when calls are added or `flush_expired` is called, so it is an upper
+ * bound only if the owner of the aggregator calls one of them regularly.
+ */
+struct AggregationPolicy {
+  struct MaxMessages {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Send the buffered calls to a destination once there are this many."};
+    static type lower_bound() { return 1; }
+  };
+  struct MaxBytes {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Send the buffered calls to a destination once their serialized size "
+        "reaches this many bytes."};
+  };
+  struct MaxDelay {
+    using type = double;
+    static constexpr Options::String help = {
+        "Send the buffered calls to a destination once the oldest has waited "
+        "this many seconds."};
+    static type lower_bound() { return 0.0; }
+  };
+  using options = tmpl::list<MaxMessages, MaxBytes, MaxDelay>;
+  static constexpr Options::String help = {
+      "When to send calls that are buffered to be sent together."};
+
+  AggregationPolicy() = default;
+  AggregationPolicy(const size_t max_messages_in, const size_t max_bytes_in,
+                    const double max_delay_in)
+      : max_messages(max_messages_in),
+        max_bytes(max_bytes_in),
+        max_delay(max_delay_in) {}
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | max_messages;
+    p | max_bytes;
+    p | max_delay;
+  }
+
+  size_t max_messages{1};
+  size_t max_bytes{std::numeric_limits<size_t>::max()};
+  double max_delay{0.0};
+};
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Counts of the calls and messages sent by a
+ * `Parallel::SimpleActionAggregator`.
+ */
+struct AggregationCounters {
+  /// The number of calls added to the aggregator
+  size_t calls{0};
+  /// The number of messages sent, each holding one or more calls
+  size_t messages{0};
+  /// The serialized size of all the calls added to the aggregator
+  size_t bytes{0};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | calls;
+    p | messages;
+    p | bytes;
+  }
+};
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Buffers many small invocations of the simple action `Action` on
+ * `ParallelComponent` and sends them in fewer, larger messages.
+ *
+ * \details Each call of `push` corresponds to a call
+ * `Parallel::simple_action<Action>(proxy, args...)`. The calls to the same
+ * destination (an element of an array component, or a singleton) are
+ * buffered and sent together in a `Parallel::Actions::ApplyAggregated`
+ * message according to the `Parallel::AggregationPolicy`, which saves the
+ * per-message overhead of the interconnect. The receiving element invokes
+ * `Action` for every call in the order they were pushed.
+ *
+ * The aggregator is owned by the sender, for instance in a DataBox tag, and
+ * is opt-in: nothing is batched unless a sender uses one. The default policy
+ * sends every call immediately.
+ *
+ * \warning The calls are delayed, so they may arrive after messages the sender
+ * sends to the same destination later without the aggregator. Calls still
+ * buffered are not sent until `flush` or `flush_expired` is invoked, so the
+ * owner must flush before it waits on the results, e.g., before the end of a
+ * step or phase.
+ */
+template <typename ParallelComponent, typename Action, typename... Args>
+class SimpleActionAggregator {
+  static_assert(Parallel::is_array_v<ParallelComponent> or
+                    Parallel::is_singleton_v<ParallelComponent>,
+                "Calls can only be aggregated for array and singleton "
+                "components.");
+
+ public:
+  using array_index =
+      std::conditional_t<Parallel::is_array_v<ParallelComponent>,
+                         typename ParallelComponent::array_index, int>;
+
+  SimpleActionAggregator() = default;
+  explicit SimpleActionAggregator(AggregationPolicy policy)
+      : policy_(std::move(policy)) {}
+
+  /// Buffer a call of `Action` with the arguments `args` on the element
+  /// `index` of an array component, and send the buffered calls that are due.
+  template <typename Metavariables>
+  void push(Parallel::GlobalCache<Metavariables>& cache,
+            const array_index& index, Args... args) {
+    std::tuple<Args...> call{std::move(args)...};
+    const size_t call_size = size_of_object_in_bytes(call);
+    ++counters_.calls;
+    counters_.bytes += call_size;
+    const auto now = std::chrono::steady_clock::now();
+
+    auto destination = destinations_.begin();
+    while (destination != destinations_.end() and
+           destination->index != index) {
+      ++destination;
+    }
+    if (destination == destinations_.end()) {
+      destinations_.push_back({index, {}, 0, now});
+      destination = std::prev(destinations_.end());
+    } else if (destination->calls.empty()) {
+      destination->oldest = now;
+    }
+    destination->calls.push_back(std::move(call));
+    destination->bytes += call_size;
+    if (destination->calls.size() >= policy_.max_messages or
+        destination->bytes >= policy_.max_bytes) {
+      send(cache, *destination);
+    }
+    flush_expired(cache, now);
+  }
+
+  /// Buffer a call of `Action` with the arguments `args` on a singleton, and
+  /// send the buffered calls that are due.
+  template <typename Metavariables, typename LocalComponent = ParallelComponent,
+            Requires<Parallel::is_singleton_v<LocalComponent>> = nullptr>
+  void push(Parallel::GlobalCache<Metavariables>& cache, Args... args) {
+    push(cache, 0, std::move(args)...);
+  }
+
+  /// Send the buffered calls whose oldest call has waited for longer than the
+  /// `AggregationPolicy::MaxDelay`.
+  template <typename Metavariables>
+  void flush_expired(Parallel::GlobalCache<Metavariables>& cache) {
+    flush_expired(cache, std::chrono::steady_clock::now());
+  }
+
+  /// Send all buffered calls.
+  template <typename Metavariables>
+  void flush(Parallel::GlobalCache<Metavariables>& cache) {
+    for (auto& destination : destinations_) {
+      if (not destination.calls.empty()) {
+        send(cache, destination);
+      }
+    }
+  }
+
+  /// Whether no calls are waiting to be sent
+  bool empty() const {
+    for (const auto& destination : destinations_) {
+      if (not destination.calls.empty()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const AggregationPolicy& policy() const { return policy_; }
+
+  const AggregationCounters& counters() const { return counters_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    ASSERT(empty(), "Flush the SimpleActionAggregator before serializing it.");
+    p | policy_;
+    p | counters_;
+    if (p.isUnpacking()) {
+      destinations_.clear();
+    }
+  }
+
+ private:
+  struct Destination {
+    array_index index;
+    std::vector<std::tuple<Args...>> calls;
+    size_t bytes;
+    std::chrono::steady_clock::time_point oldest;
+  };
+
+  template <typename Metavariables>
+  void flush_expired(Parallel::GlobalCache<Metavariables>& cache,
+                     const std::chrono::steady_clock::time_point now) {
+    for (auto& destination : destinations_) {
+      if (not destination.calls.empty() and
+          std::chrono::duration<double>(now - destination.oldest).count() >=
+              policy_.max_delay) {
+        send(cache, destination);
+      }
+    }
+  }
+
+  template <typename Metavariables>
+  void send(Parallel::GlobalCache<Metavariables>& cache,
+            Destination& destination) {
+    ++counters_.messages;
+    auto& proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    if constexpr (Parallel::is_array_v<ParallelComponent>) {
+      Parallel::simple_action<Actions::ApplyAggregated<Action>>(
+          proxy[destination.index], std::move(destination.calls));
+    } else {
+      Parallel::simple_action<Actions::ApplyAggregated<Action>>(
+          proxy, std::move(destination.calls));
+    }
+    destination.calls.clear();
+    destination.bytes = 0;
+  }
+
+  AggregationPolicy policy_{};
+  AggregationCounters counters_{};
+  std::vector<Destination> destinations_{};
+};
+}  // namespace Parallel
@@ -0,0 +1,21 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Parallel/ActionProfile.hpp"
+
+namespace Parallel::Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ParallelGroup
+/// The wall time spent in each iterable action of an element of an array
+/// component, see `Parallel::ActionProfile`.
+///
+/// Empty for the other kinds of components.
+struct ActionProfiles : db::SimpleTag {
+  using type = std::vector<Parallel::ActionProfile>;
+};
+}  // namespace Parallel::Tags
@@ -7,6 +7,7 @@
 
 namespace Parallel::Tags {
 /// \cond
+struct ActionProfiles;
 template <typename Index>
 struct ArrayIndexImpl;
 template <typename Metavariables>
@@ -24,5 +25,5 @@ template <typename Metavariables, typename Index>
 using distributed_object_tags =
     tmpl::list<Tags::MetavariablesImpl<Metavariables>,
                Tags::ArrayIndexImpl<Index>,
-               Tags::GlobalCacheProxy<Metavariables>>;
+               Tags::GlobalCacheProxy<Metavariables>, Tags::ActionProfiles>;
 }  // namespace Parallel::Tags
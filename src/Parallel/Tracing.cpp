@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/Tracing.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel::tracing {
+namespace {
+struct RecordedSpan {
+  const std::string* name;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point end;
+};
+
+// The spans of one thread.  The mutex is only contended while the trace is
+// being written or cleared.
+struct ThreadBuffer {
+  std::mutex mutex{};
+  std::vector<RecordedSpan> spans{};
+  // Index of the oldest span once the buffer is full
+  size_t next = 0;
+};
+
+// The buffers are never freed, because a thread's buffer must remain
+// readable after the thread has exited.
+struct Registry {
+  std::mutex mutex{};
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers{};
+};
+
+Registry& registry() {
+  static Registry result{};
+  return result;
+}
+
+ThreadBuffer& local_buffer() {
+  thread_local ThreadBuffer* const buffer = []() {
+    auto& all = registry();
+    const std::lock_guard lock(all.mutex);
+    all.buffers.push_back(std::make_unique<ThreadBuffer>());
+    all.buffers.back()->spans.reserve(buffer_capacity);
+    return all.buffers.back().get();
+  }();
+  return *buffer;
+}
+
+void write_json_string(std::ostream& os, const std::string& string) {
+  os << '"';
+  for (const char c : string) {
+    if (c == '"' or c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << ' ';
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+}  // namespace
+
+void record(const std::string* const name,
+            const std::chrono::steady_clock::time_point start,
+            const std::chrono::steady_clock::time_point end) {
+  ThreadBuffer& buffer = local_buffer();
+  const std::lock_guard lock(buffer.mutex);
+  if (buffer.spans.size() < buffer_capacity) {
+    buffer.spans.push_back({name, start, end});
+  } else {
+    buffer.spans[buffer.next] = {name, start, end};
+    buffer.next = (buffer.next + 1) % buffer_capacity;
+  }
+}
+
+void write_chrome_trace(std::ostream& os, const int process_id) {
+  // Convert the steady clock to the Charm++ wall time in microseconds.
+  const auto now = std::chrono::steady_clock::now();
+  const double wall_time_now = 1.0e6 * sys::wall_time();
+  const auto microseconds_since =
+      [](const std::chrono::steady_clock::time_point from,
+         const std::chrono::steady_clock::time_point to) {
+        return std::chrono::duration<double, std::micro>(to - from).count();
+      };
+
+  auto& all = registry();
+  const std::lock_guard registry_lock(all.mutex);
+  const auto flags = os.flags();
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  for (size_t thread = 0; thread < all.buffers.size(); ++thread) {
+    ThreadBuffer& buffer = *all.buffers[thread];
+    const std::lock_guard lock(buffer.mutex);
+    const size_t size = buffer.spans.size();
+    for (size_t i = 0; i < size; ++i) {
+      const RecordedSpan& span = buffer.spans[(buffer.next + i) % size];
+      os << (first ? "\n" : ",\n") << "{\"name\":";
+      write_json_string(os, *span.name);
+      os << ",\"ph\":\"X\",\"ts\":"
+         << wall_time_now - microseconds_since(span.start, now)
+         << ",\"dur\":" << microseconds_since(span.start, span.end)
+         << ",\"pid\":" << process_id << ",\"tid\":" << thread << "}";
+      first = false;
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os.flags(flags);
+}
+
+void clear() {
+  auto& all = registry();
+  const std::lock_guard registry_lock(all.mutex);
+  for (auto& buffer : all.buffers) {
+    const std::lock_guard lock(buffer->mutex);
+    buffer->spans.clear();
+    buffer->next = 0;
+  }
+}
+}  // namespace Parallel::tracing
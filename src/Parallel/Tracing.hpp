@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief A lightweight, always-enabled trace of the actions and entry methods
+ * run by the parallel components.
+ *
+ * \details Every thread keeps the last `buffer_capacity` spans it recorded in
+ * a ring buffer, so the memory used is bounded and recording a span is cheap
+ * enough to leave on in production runs. The `DistributedObject` records a
+ * span for every iterable action, simple action, threaded action, reduction
+ * action, and `receive_data` call.
+ *
+ * The buffers of all threads in the process can be written in the Chrome trace
+ * event format, which can be viewed in the Perfetto UI or `chrome://tracing`,
+ * for example with `Events::WriteTrace`. This allows investigating stalls
+ * after the fact without having run with Charm++ Projections. Timestamps are
+ * given as the Charm++ wall time, so the files written by different nodes can
+ * be loaded together.
+ */
+namespace Parallel::tracing {
+/// The number of spans kept by each thread.  Once a buffer is full the oldest
+/// spans are overwritten.
+constexpr size_t buffer_capacity = 8192;
+
+/// Record that the code called `*name` ran on this thread from `start` to
+/// `end`.
+///
+/// Only the pointer is stored, so `name` must remain valid until the trace is
+/// written. Function-local `static` strings are a good choice.
+void record(const std::string* name,
+            std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end);
+
+/// Records a span from its construction to its destruction.
+class Span {
+ public:
+  explicit Span(const std::string* name)
+      : name_(name), start_(std::chrono::steady_clock::now()) {}
+  Span(const Span&) = delete;
+  Span& operator=(const Span&) = delete;
+  Span(Span&&) = delete;
+  Span& operator=(Span&&) = delete;
+  ~Span() { record(name_, start_, std::chrono::steady_clock::now()); }
+
+ private:
+  const std::string* name_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// Write the spans recorded by all threads of this process as a JSON object
+/// in the Chrome trace event format.  The process id of the events is
+/// `process_id`, and the thread ids number the threads in the order they
+/// first recorded a span.
+void write_chrome_trace(std::ostream& os, int process_id);
+
+/// Discard all the recorded spans.
+void clear();
+}  // namespace Parallel::tracing
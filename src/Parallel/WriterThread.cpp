@@ -0,0 +1,112 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/WriterThread.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Parallel {
+WriterThread::~WriterThread() {
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  task_submitted_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void WriterThread::submit(std::function<void()> task,
+                          const size_t max_pending) {
+  std::unique_lock lock(mutex_);
+  rethrow_error();
+  if (max_pending == 0) {
+    task_finished_.wait(
+        lock, [this]() { return tasks_.empty() and not running_task_; });
+    rethrow_error();
+    lock.unlock();
+    task();
+    return;
+  }
+  task_finished_.wait(lock, [this, &max_pending]() {
+    return tasks_.size() + (running_task_ ? 1 : 0) < max_pending or
+           error_ != nullptr;
+  });
+  rethrow_error();
+  tasks_.push_back(std::move(task));
+  if (not thread_.joinable()) {
+    thread_ = std::thread([this]() { run(); });
+  }
+  lock.unlock();
+  task_submitted_.notify_one();
+}
+
+void WriterThread::wait() {
+  std::unique_lock lock(mutex_);
+  // The callbacks may submit tasks, so they are called without the lock.
+  const std::vector<std::function<void()>> flush_callbacks = flush_callbacks_;
+  lock.unlock();
+  for (const auto& flush : flush_callbacks) {
+    flush();
+  }
+  lock.lock();
+  task_finished_.wait(
+      lock, [this]() { return tasks_.empty() and not running_task_; });
+  rethrow_error();
+}
+
+void WriterThread::add_flush_callback(std::function<void()> flush) {
+  const std::lock_guard lock(mutex_);
+  flush_callbacks_.push_back(std::move(flush));
+}
+
+size_t WriterThread::pending() const {
+  const std::lock_guard lock(mutex_);
+  return tasks_.size() + (running_task_ ? 1 : 0);
+}
+
+void WriterThread::run() {
+  std::unique_lock lock(mutex_);
+  while (true) {
+    task_submitted_.wait(lock,
+                         [this]() { return stop_ or not tasks_.empty(); });
+    if (tasks_.empty()) {
+      return;
+    }
+    std::function<void()> task = std::move(tasks_.front());
+    tasks_.pop_front();
+    running_task_ = true;
+    lock.unlock();
+    std::exception_ptr error{};
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    running_task_ = false;
+    if (error != nullptr and error_ == nullptr) {
+      error_ = std::move(error);
+    }
+    task_finished_.notify_all();
+  }
+}
+
+void WriterThread::rethrow_error() {
+  if (error_ != nullptr) {
+    std::rethrow_exception(std::exchange(error_, nullptr));
+  }
+}
+
+WriterThread& writer_thread() {
+  static WriterThread result{};
+  return result;
+}
+}  // namespace Parallel
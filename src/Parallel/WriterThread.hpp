@@ -0,0 +1,83 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief A thread that runs tasks, typically writes to disk, in the background
+ * in the order they were submitted.
+ *
+ * \details Moving slow file system operations to this thread keeps them from
+ * stalling the PE that submits them. The number of pending tasks is bounded
+ * by each `submit` call, which blocks while too many tasks are waiting, so a
+ * file system that cannot keep up slows the submitters down instead of
+ * exhausting the memory.
+ *
+ * An exception thrown by a task is rethrown by the next call to `submit` or
+ * `wait`.
+ *
+ * \warning The tasks do not run on a Charm++ PE, so they must not call into
+ * Charm++ (e.g., `Parallel::printf` or the `GlobalCache`). Everything they
+ * need must be captured when they are submitted.
+ */
+class WriterThread {
+ public:
+  WriterThread() = default;
+  WriterThread(const WriterThread&) = delete;
+  WriterThread& operator=(const WriterThread&) = delete;
+  WriterThread(WriterThread&&) = delete;
+  WriterThread& operator=(WriterThread&&) = delete;
+  /// Runs the pending tasks and joins the thread
+  ~WriterThread();
+
+  /// Run `task` on the thread once the tasks submitted before it have
+  /// finished, blocking while `max_pending` tasks are pending.
+  ///
+  /// If `max_pending` is zero, the task runs on the calling thread after the
+  /// pending tasks have finished.
+  void submit(std::function<void()> task, size_t max_pending);
+
+  /// Call the flush callbacks and block until all submitted tasks have
+  /// finished.
+  void wait();
+
+  /// Register `flush` to be called by every `wait` before it blocks.
+  ///
+  /// This lets data that is buffered elsewhere before it is written, e.g.,
+  /// rows of reduction data, be submitted so it is on disk once `wait`
+  /// returns. `flush` may call `submit`.
+  void add_flush_callback(std::function<void()> flush);
+
+  /// The number of tasks submitted that have not finished yet
+  size_t pending() const;
+
+ private:
+  void run();
+  void rethrow_error();
+
+  mutable std::mutex mutex_{};
+  std::condition_variable task_submitted_{};
+  std::condition_variable task_finished_{};
+  std::deque<std::function<void()>> tasks_{};
+  std::vector<std::function<void()>> flush_callbacks_{};
+  bool running_task_{false};
+  bool stop_{false};
+  std::exception_ptr error_{};
+  std::thread thread_{};
+};
+
+/// The `Parallel::WriterThread` shared by everything in this process, so the
+/// writes of a node are serialized.
+WriterThread& writer_thread();
+}  // namespace Parallel
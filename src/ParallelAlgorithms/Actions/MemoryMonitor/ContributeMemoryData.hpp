@@ -17,6 +17,7 @@
 #include "Parallel/Local.hpp"
 #include "Parallel/MemoryMonitor/MemoryMonitor.hpp"
 #include "Parallel/MemoryMonitor/Tags.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/UpdateMemoryHistory.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
@@ -39,6 +40,8 @@ namespace mem_monitor {
  * - Size on node 1 (MB)
  * - Size on node 2 (MB)
  * - Average size per node (MB)
+ * - Maximum total size (MB)
+ * - Change in total size (MB)
  *
  * The columns in the dat file for a group when running on 3 nodes will be
  *
@@ -49,6 +52,11 @@ namespace mem_monitor {
  * - Proc of max size
  * - Size on proc of max size (MB)
  * - Average size per node (MB)
+ * - Maximum total size (MB)
+ * - Change in total size (MB)
+ *
+ * where the last two columns are described in
+ * `mem_monitor::update_memory_history`.
  *
  * The dat file will be placed in the `/MemoryMonitors/` group in the reduction
  * file. The name of the dat file is the `pretty_type::name` of the component.
@@ -65,12 +73,16 @@ struct ContributeMemoryData {
                   Parallel::is_nodegroup_v<ContributingComponent>);
 
     using tag = Tags::MemoryHolder;
-    db::mutate<tag>(
+    db::mutate<tag, Tags::MaximumTotalMemory, Tags::PreviousTotalMemory>(
         [&cache, &time, &node_or_proc, &size_in_megabytes](
             const gsl::not_null<std::unordered_map<
                 std::string,
                 std::unordered_map<double, std::unordered_map<int, double>>>*>
-                memory_holder_all) {
+                memory_holder_all,
+            const gsl::not_null<Tags::MaximumTotalMemory::type*>
+                maximum_totals,
+            const gsl::not_null<Tags::PreviousTotalMemory::type*>
+                previous_totals) {
           auto memory_holder_pair = memory_holder_all->try_emplace(
               pretty_type::name<ContributingComponent>());
           auto& memory_holder = (*memory_holder_pair.first).second;
@@ -143,12 +155,20 @@ struct ContributeMemoryData {
               legend.emplace_back("Size on proc of max size (MB)");
             }
 
+            const double total_size = avg_size_per_node;
             avg_size_per_node /= static_cast<double>(num_nodes);
 
-            // Last column is average over all nodes
+            // Then the average over all nodes
             data_to_append.push_back(avg_size_per_node);
             legend.emplace_back("Average size per node (MB)");
 
+            // Last are the high-water mark and the change of the total
+            const auto history = update_memory_history<ContributingComponent>(
+                maximum_totals, previous_totals, make_not_null(&legend),
+                total_size);
+            data_to_append.insert(data_to_append.end(), history.begin(),
+                                  history.end());
+
             auto& observer_writer_proxy = Parallel::get_parallel_component<
                 observers::ObserverWriter<Metavariables>>(cache);
 
@@ -12,7 +12,10 @@
 #include "IO/Observer/ReductionActions.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/MemoryMonitor/Tags.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/UpdateMemoryHistory.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Numeric.hpp"
 
 namespace mem_monitor {
@@ -28,6 +31,11 @@ namespace mem_monitor {
  * - Size on node 1 (MB)
  * - Size on node 2 (MB)
  * - Average size per node (MB)
+ * - Maximum total size (MB)
+ * - Change in total size (MB)
+ *
+ * where the last two columns are described in
+ * `mem_monitor::update_memory_history`.
  *
  * The dat file will be placed in the `/MemoryMonitors/` group in the reduction
  * file. The name of the dat file is the `pretty_type::name` of the component.
@@ -36,7 +44,7 @@ template <typename ArrayComponent>
 struct ProcessArray {
   template <typename ParallelComponent, typename DbTags, typename Metavariables,
             typename ArrayIndex>
-  static void apply(db::DataBox<DbTags>& /*box*/,
+  static void apply(db::DataBox<DbTags>& box,
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/, const double time,
                     const std::vector<double>& size_per_node) {
@@ -49,14 +57,28 @@ struct ProcessArray {
     }
     legend.emplace_back("Average size per node (MB)");
 
-    const double avg_size = alg::accumulate(size_per_node, 0.0) /
-                            static_cast<double>(size_per_node.size());
+    const double total_size = alg::accumulate(size_per_node, 0.0);
+    const double avg_size =
+        total_size / static_cast<double>(size_per_node.size());
+    const auto [maximum_total_size, change_in_total_size] =
+        db::mutate<Tags::MaximumTotalMemory, Tags::PreviousTotalMemory>(
+            [&legend, &total_size](
+                const gsl::not_null<Tags::MaximumTotalMemory::type*>
+                    maximum_totals,
+                const gsl::not_null<Tags::PreviousTotalMemory::type*>
+                    previous_totals) {
+              return update_memory_history<ArrayComponent>(
+                  maximum_totals, previous_totals, make_not_null(&legend),
+                  total_size);
+            },
+            make_not_null(&box));
 
     Parallel::threaded_action<
         observers::ThreadedActions::WriteReductionDataRow>(
         // Node 0 is always the writer
         observer_writer_proxy[0], subfile_name<ArrayComponent>(), legend,
-        std::make_tuple(time, size_per_node, avg_size));
+        std::make_tuple(time, size_per_node, avg_size, maximum_total_size,
+                        change_in_total_size));
   }
 };
 }  // namespace mem_monitor
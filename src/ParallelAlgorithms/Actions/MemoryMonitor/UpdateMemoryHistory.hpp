@@ -0,0 +1,50 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "Parallel/MemoryMonitor/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Records a new measurement of the total memory usage of
+ * `ParallelComponent` in the memory history held by the MemoryMonitor.
+ *
+ * \details Returns the high-water mark of the total memory usage over all the
+ * observations so far and the change since the previous observation (zero for
+ * the first one), both in MB, and appends the corresponding column names
+ *
+ * - Maximum total size (MB)
+ * - Change in total size (MB)
+ *
+ * to `legend`. Steady growth in the second column, e.g. of interpolator
+ * buffers or time-stepper histories, shows up long before the first column
+ * reaches the memory available to the job.
+ */
+template <typename ParallelComponent>
+std::array<double, 2> update_memory_history(
+    const gsl::not_null<Tags::MaximumTotalMemory::type*> maximum_totals,
+    const gsl::not_null<Tags::PreviousTotalMemory::type*> previous_totals,
+    const gsl::not_null<std::vector<std::string>*> legend,
+    const double total_size_in_megabytes) {
+  const std::string name = pretty_type::name<ParallelComponent>();
+  double& maximum =
+      maximum_totals->try_emplace(name, total_size_in_megabytes).first->second;
+  double& previous =
+      previous_totals->try_emplace(name, total_size_in_megabytes).first->second;
+  maximum = std::max(maximum, total_size_in_megabytes);
+  const double change = total_size_in_megabytes - previous;
+  previous = total_size_in_megabytes;
+
+  legend->emplace_back("Maximum total size (MB)");
+  legend->emplace_back("Change in total size (MB)");
+  return {{maximum, change}};
+}
+}  // namespace mem_monitor
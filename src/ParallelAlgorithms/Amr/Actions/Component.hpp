@@ -23,6 +23,30 @@ namespace amr {
 ///   on global processor 0.
 /// - As a reduction target to perform sanity checks after AMR, output
 ///   AMR diagnostics, or determine when to trigger AMR.
+///
+/// AMR is done in global phases.  In Parallel::Phase::EvaluateAmrCriteria each
+/// element evaluates the refinement criteria and exchanges its decision with
+/// its neighbors only (see amr::Actions::EvaluateRefinementCriteria and
+/// amr::Actions::UpdateAmrDecision).  The end of the phase, i.e. quiescence,
+/// is what guarantees that all decisions are final and consistent (e.g. 2:1
+/// balanced) before Parallel::Phase::AdjustDomain creates and destroys
+/// elements.  Adapting some elements while others keep evolving is not
+/// supported: the mortars and time-stepper histories of the neighbors of an
+/// adapted element would have to be updated at the same step as the element
+/// (see evolution::dg::Initialization::ProjectMortars).
+///
+/// New elements are inserted by this component without choosing their
+/// processor, so after h-refinement the load quickly becomes imbalanced.  The
+/// elements created during AMR are migratable, so executables should visit
+/// Parallel::Phase::LoadBalancing right after Parallel::Phase::AdjustDomain,
+/// e.g. with the phase changes
+/// \code{.yaml}
+///   - VisitAndReturn(EvaluateAmrCriteria)
+///   - VisitAndReturn(AdjustDomain)
+///   - VisitAndReturn(LoadBalancing)
+/// \endcode
+/// in the input file.  This lets the Charm++ load balancer migrate the
+/// elements based on their measured cost.
 template <class Metavariables>
 struct Component {
   using metavariables = Metavariables;
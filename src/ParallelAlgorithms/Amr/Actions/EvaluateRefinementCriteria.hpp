@@ -23,7 +23,9 @@
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Amr/Actions/UpdateAmrDecision.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/GridPointBudget.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/GridPointBudget.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -55,6 +57,9 @@ namespace amr::Actions {
 ///   * domain::Tags::Element<volume_dim>
 ///   * amr::Tags::NeighborFlags<volume_dim>
 ///   * amr::Criteria::Tags::Criteria (from GlobalCache)
+///   * amr::Criteria::Tags::MaximumGridPointsPerElement (from GlobalCache,
+///     if present)
+///   * domain::Tags::Mesh<volume_dim> (if the above tag is present)
 ///   * any tags requested by the refinement criteria
 /// - Modifies:
 ///   * amr::Tags::Flags<volume_dim>
@@ -66,6 +71,9 @@ namespace amr::Actions {
 /// - Evaluates each refinement criteria held by amr::Criteria::Tags::Criteria,
 ///   and in each dimension selects the amr::Flag with the highest
 ///   priority (i.e the highest integral value).
+/// - If amr::Criteria::Tags::MaximumGridPointsPerElement holds a value,
+///   increases of resolution that exceed the budget are dropped (see
+///   amr::Criteria::limit_to_grid_point_budget)
 /// - An Element that is splitting in one dimension is not allowed to join
 ///   in another dimension.  If this is requested by the refinement critiera,
 ///   the decision to join is changed to do nothing
@@ -99,6 +107,20 @@ struct EvaluateRefinementCriteria {
       }
     }
 
+    // Drop increases of resolution that exceed the grid point budget, if any
+    if constexpr (db::tag_is_retrievable_v<
+                      amr::Criteria::Tags::MaximumGridPointsPerElement,
+                      db::DataBox<DbTagList>>) {
+      const auto& maximum_grid_points =
+          db::get<amr::Criteria::Tags::MaximumGridPointsPerElement>(box);
+      if (maximum_grid_points.has_value()) {
+        amr::Criteria::limit_to_grid_point_budget(
+            make_not_null(&overall_decision),
+            db::get<::domain::Tags::Mesh<volume_dim>>(box),
+            maximum_grid_points.value());
+      }
+    }
+
     // An element cannot join if it is splitting in another dimension.
     // Update the flags now before sending to neighbors as each time
     // a flag is changed by UpdateAmrDecision, it sends the new flags
@@ -132,12 +154,9 @@ struct EvaluateRefinementCriteria {
 
     const std::array<amr::Flag, Metavariables::volume_dim>& my_flags =
         get<amr::Tags::Flags<volume_dim>>(box);
-    for (const auto& [direction, neighbors] : my_element.neighbors()) {
-      (void)direction;
-      for (const auto& neighbor_id : neighbors.ids()) {
-        Parallel::simple_action<UpdateAmrDecision>(
-            amr_element_array[neighbor_id], element_id, my_flags);
-      }
+    for (const auto& neighbor_id : amr::ids_of_neighbors(my_element)) {
+      Parallel::simple_action<UpdateAmrDecision>(amr_element_array[neighbor_id],
+                                                 element_id, my_flags);
     }
   }
 };
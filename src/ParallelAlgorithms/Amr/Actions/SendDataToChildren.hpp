@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -11,16 +12,18 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Amr/Actions/InitializeChild.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace amr::Actions {
 /// \brief Sends data from the parent element to its children elements during
 /// adaptive mesh refinement
 ///
 /// \details  This action should be called after all children elements have been
-/// created by amr::Actions::CreateChild.  This action sends a copy of all items
+/// created by amr::Actions::CreateChild.  This action sends all items
 /// corresponding to the mutable_item_creation_tags of `box` to each of the
-/// elements with `ids_of_children`.  Finally, the parent element destroys
-/// itself.
+/// elements with `ids_of_children`.  The items are moved to the last child
+/// and copied to the others.  Finally, the parent element destroys itself.
 struct SendDataToChildren {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables>
@@ -29,17 +32,23 @@ struct SendDataToChildren {
                     const ElementId<Metavariables::volume_dim>& element_id,
                     const std::vector<ElementId<Metavariables::volume_dim>>&
                         ids_of_children) {
+    using items_tags =
+        typename db::DataBox<DbTagList>::mutable_item_creation_tags;
     auto& array_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
-    for (const auto& child_id : ids_of_children) {
+    Parallel::deregister_element<ParallelComponent>(box, cache, element_id);
+    ASSERT(not ids_of_children.empty(),
+           "Element " << element_id << " has no children to send data to.");
+
+    // The last child gets the items of the parent element, which is destroyed
+    // below, so only the other children need a copy
+    for (size_t i = 0; i + 1 < ids_of_children.size(); ++i) {
       Parallel::simple_action<amr::Actions::InitializeChild>(
-          array_proxy[child_id],
-          db::copy_items<
-              typename db::DataBox<DbTagList>::mutable_item_creation_tags>(
-              box));
+          array_proxy[ids_of_children[i]], db::copy_items<items_tags>(box));
     }
-
-    Parallel::deregister_element<ParallelComponent>(box, cache, element_id);
+    Parallel::simple_action<amr::Actions::InitializeChild>(
+        array_proxy[ids_of_children.back()],
+        db::move_items<items_tags>(make_not_null(&box)));
 
     array_proxy[element_id].ckDestroy();
   }
@@ -10,6 +10,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Helpers.hpp"
 #include "Domain/Amr/Tags/Flags.hpp"
 #include "Domain/Amr/Tags/NeighborFlags.hpp"
 #include "Domain/Amr/UpdateAmrDecision.hpp"
@@ -38,7 +39,8 @@ namespace amr::Actions {
 ///
 /// Invokes:
 /// - amr::Actions::UpdateAmrDecision on all neighboring Element%s (if AMR
-///   decision is updated)
+///   decision is updated), once per neighbor even if it is a neighbor in
+///   several directions
 ///
 /// \details This Element calls amr::update_amr_decision to see if its
 /// AMR decision needs to be updated.  If it does, the Element will call
@@ -96,11 +98,9 @@ struct UpdateAmrDecision {
     if (my_amr_decision_changed) {
       auto& amr_element_array =
           Parallel::get_parallel_component<ParallelComponent>(cache);
-      for (const auto& direction_neighbors : element.neighbors()) {
-        for (const auto& id : direction_neighbors.second.ids()) {
-          Parallel::simple_action<UpdateAmrDecision>(
-              amr_element_array[id], element.id(), my_amr_flags);
-        }
+      for (const auto& id : amr::ids_of_neighbors(element)) {
+        Parallel::simple_action<UpdateAmrDecision>(amr_element_array[id],
+                                                   element.id(), my_amr_flags);
       }
     }
   }
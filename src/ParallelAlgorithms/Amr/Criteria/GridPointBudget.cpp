@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Amr/Criteria/GridPointBudget.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+
+#include "DataStructures/Index.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace amr::Criteria {
+template <size_t Dim>
+void limit_to_grid_point_budget(
+    const gsl::not_null<std::array<Flag, Dim>*> flags, const Mesh<Dim>& mesh,
+    const size_t maximum_number_of_grid_points) {
+  std::array<size_t, Dim> new_extents = mesh.extents().indices();
+  for (size_t d = 0; d < Dim; ++d) {
+    if (gsl::at(*flags, d) == Flag::IncreaseResolution) {
+      ++gsl::at(new_extents, d);
+    } else if (gsl::at(*flags, d) == Flag::DecreaseResolution) {
+      --gsl::at(new_extents, d);
+    }
+  }
+  size_t new_number_of_grid_points =
+      std::accumulate(new_extents.begin(), new_extents.end(), 1_st,
+                      std::multiplies<size_t>{});
+  while (new_number_of_grid_points > maximum_number_of_grid_points) {
+    // The number of grid points added by increasing the resolution in a
+    // dimension is the number of grid points of a slice through it
+    size_t most_expensive_dim = Dim;
+    size_t most_added_grid_points = 0;
+    for (size_t d = 0; d < Dim; ++d) {
+      if (gsl::at(*flags, d) != Flag::IncreaseResolution) {
+        continue;
+      }
+      const size_t added_grid_points =
+          new_number_of_grid_points / gsl::at(new_extents, d);
+      if (added_grid_points > most_added_grid_points) {
+        most_expensive_dim = d;
+        most_added_grid_points = added_grid_points;
+      }
+    }
+    if (most_expensive_dim == Dim) {
+      return;
+    }
+    gsl::at(*flags, most_expensive_dim) = Flag::DoNothing;
+    --gsl::at(new_extents, most_expensive_dim);
+    new_number_of_grid_points -= most_added_grid_points;
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                             \
+  template void limit_to_grid_point_budget(              \
+      gsl::not_null<std::array<Flag, DIM(data)>*> flags, \
+      const Mesh<DIM(data)>& mesh, size_t maximum_number_of_grid_points);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+}  // namespace amr::Criteria
@@ -0,0 +1,37 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Domain/Amr/Flag.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace amr::Criteria {
+/*!
+ * \brief Drop p-refinements of an element that would exceed a budget of grid
+ * points
+ *
+ * \details The refinement criteria only decide whether to refine, not what
+ * the refinement costs. This function computes the number of grid points of
+ * the element after applying the `flags` to its `mesh`. While it exceeds
+ * `maximum_number_of_grid_points`, the `amr::Flag::IncreaseResolution` that
+ * adds the most grid points is changed to `amr::Flag::DoNothing`, so the
+ * cheapest p-refinements are kept. All other flags are left unchanged. In
+ * particular h-refinement does not increase the number of grid points of an
+ * element, so it is not limited by the budget.
+ *
+ * \see amr::Criteria::Tags::MaximumGridPointsPerElement
+ */
+template <size_t Dim>
+void limit_to_grid_point_budget(gsl::not_null<std::array<Flag, Dim>*> flags,
+                                const Mesh<Dim>& mesh,
+                                size_t maximum_number_of_grid_points);
+}  // namespace amr::Criteria
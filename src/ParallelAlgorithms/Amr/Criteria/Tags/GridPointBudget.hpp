@@ -0,0 +1,43 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Options/Auto.hpp"
+#include "Options/String.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace amr::Criteria {
+namespace OptionTags {
+/// \ingroup OptionTagsGroup
+/// The maximum number of grid points of an element after p-refinement
+struct MaximumGridPointsPerElement {
+  using type = Options::Auto<size_t, Options::AutoLabel::None>;
+  static constexpr Options::String help =
+      "Increases of resolution that would give an element more grid points "
+      "than this are not done, dropping the most expensive ones first. "
+      "Specify 'None' to not limit the resolution.";
+  using group = amr::OptionTags::AmrGroup;
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// The maximum number of grid points of an element after p-refinement
+///
+/// \details If this tag is in the global cache, AMR decisions are limited
+/// with amr::Criteria::limit_to_grid_point_budget.
+struct MaximumGridPointsPerElement : db::SimpleTag {
+  using type = std::optional<size_t>;
+  using option_tags =
+      tmpl::list<amr::Criteria::OptionTags::MaximumGridPointsPerElement>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& value) { return value; }
+};
+}  // namespace Tags
+}  // namespace amr::Criteria
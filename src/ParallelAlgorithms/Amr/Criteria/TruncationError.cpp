@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -20,6 +21,7 @@ template <size_t Dim>
 void max_over_components(
     const gsl::not_null<std::array<Flag, Dim>*> result,
     const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
+    const gsl::not_null<ModalVector*> modal_coefficients_buffer,
     const DataVector& tensor_component, const Mesh<Dim>& mesh,
     const std::optional<double> target_abs_truncation_error,
     const std::optional<double> target_rel_truncation_error) {
@@ -28,7 +30,9 @@ void max_over_components(
   // increase p refinement in that dimension. And only if all tensor components
   // still satisfy the target with the highest mode removed will the element
   // decrease p refinement in that dimension.
-  PowerMonitors::power_monitors(power_monitors_buffer, tensor_component, mesh);
+  PowerMonitors::power_monitors(power_monitors_buffer,
+                                modal_coefficients_buffer, tensor_component,
+                                mesh);
   const double umax = max(abs(tensor_component));
   for (size_t d = 0; d < Dim; ++d) {
     // Skip this dimension if we have already decided to refine it
@@ -86,6 +90,7 @@ void max_over_components(
       gsl::not_null<std::array<Flag, DIM(data)>*> result,              \
       const gsl::not_null<std::array<DataVector, DIM(data)>*>          \
           power_monitors_buffer,                                       \
+      gsl::not_null<ModalVector*> modal_coefficients_buffer,           \
       const DataVector& tensor_component, const Mesh<DIM(data)>& mesh, \
       std::optional<double> target_abs_truncation_error,               \
       std::optional<double> target_rel_truncation_error);
@@ -3,7 +3,6 @@
 
 #pragma once
 
-#include <cmath>
 #include <deque>
 #include <utility>
 
@@ -16,6 +15,7 @@
 #include "IO/Logging/Verbosity.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -99,6 +99,18 @@ namespace callbacks {
 /// see intrp::protocols::InterpolationTargetTag for details on
 /// InterpolationTargetTag.
 ///
+/// ### Placement
+///
+/// The FastFlow iterations and the post_horizon_find_callbacks run on the
+/// proc of the `intrp::InterpolationTarget` singleton, while the volume
+/// quantities are computed and interpolated by the `intrp::Interpolator`
+/// on the procs of the elements.  Different horizons (e.g. AhA and AhB) are
+/// different singletons, so they are found concurrently if their singletons
+/// are on different procs.  Placing each of them exclusively on its own proc
+/// (see `Parallel::ResourceInfo`) keeps the iterations from competing with the
+/// evolution, while the interpolation for one horizon proceeds as another one
+/// iterates.
+///
 /// ### Output
 ///
 /// Optionally, a single line of output is printed to stdout either on each
@@ -184,26 +196,15 @@ struct FindApparentHorizon
             // again we do nothing.
             //
             // If we have 2 or more valid previous_strahlkorpers, then
-            // we set the initial guess by linear extrapolation in time
-            // using the last 2 previous_strahlkorpers.
-            if (previous_strahlkorpers->size() > 1 and
-                not std::isnan((*previous_strahlkorpers)[1].first)) {
-              const double new_time =
-                  InterpolationTarget_detail::get_temporal_id_value(
-                      temporal_id);
-              const double dt_0 = (*previous_strahlkorpers)[0].first - new_time;
-              const double dt_1 = (*previous_strahlkorpers)[1].first - new_time;
-              const double fac_0 = dt_1 / (dt_1 - dt_0);
-              const double fac_1 = 1.0 - fac_0;
-              // Here we assume that
-              // * Expansion center of all the Strahlkorpers are equal.
-              // * Maximum L of all the Strahlkorpers are equal.
-              // It is easy to relax the max L assumption once we start
-              // adaptively changing the L of the strahlkorpers.
-              strahlkorper->coefficients() =
-                  fac_0 * (*previous_strahlkorpers)[0].second.coefficients() +
-                  fac_1 * (*previous_strahlkorpers)[1].second.coefficients();
-            }
+            // we set the initial guess by polynomial extrapolation in time
+            // using all the valid previous_strahlkorpers, so fewer
+            // iterations are needed when the horizon moves quickly.
+            // The previous_strahlkorpers are prolonged or restricted to
+            // the resolution of strahlkorper.
+            ylm::extrapolate_strahlkorper(
+                strahlkorper, *previous_strahlkorpers,
+                InterpolationTarget_detail::get_temporal_id_value(
+                    temporal_id));
           },
           box);
     }
@@ -6,10 +6,14 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "ParallelAlgorithms/Events/ObserveActionProfile.hpp"
 #include "ParallelAlgorithms/Events/ObserveAdaptiveSteppingDiagnostics.hpp"
+#include "ParallelAlgorithms/Events/ObserveDataBoxProfile.hpp"
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"
+#include "ParallelAlgorithms/Events/ObserveLoadImbalance.hpp"
 #include "ParallelAlgorithms/Events/ObserveNorms.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
+#include "ParallelAlgorithms/Events/WriteTrace.hpp"
 #include "Time/Actions/ChangeSlabSize.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -26,6 +30,9 @@ using field_observations = tmpl::flatten<
 namespace Events {
 template <typename System>
 using time_events =
-    tmpl::list<Events::ObserveAdaptiveSteppingDiagnostics,
-               Events::ObserveTimeStep<System>, Events::ChangeSlabSize>;
+    tmpl::list<Events::ObserveActionProfile,
+               Events::ObserveAdaptiveSteppingDiagnostics,
+               Events::ObserveDataBoxProfile, Events::ObserveLoadImbalance,
+               Events::ObserveTimeStep<System>, Events::ChangeSlabSize,
+               Events::WriteTrace>;
 }  // namespace Events
@@ -62,7 +62,11 @@ namespace Events {
  * \details Given a list of parallel component names from Options, this will
  * calculate the memory usage of each component and write it to disk in the
  * reductions file under the `/MemoryMonitors/` group. The name of each file is
- * the `pretty_type::name` of each parallel component.
+ * the `pretty_type::name` of each parallel component. For arrays, groups, and
+ * nodegroups, each row also holds the high-water mark of the total memory
+ * usage of the component and its change since the previous observation (see
+ * `mem_monitor::update_memory_history`), so steady growth can be caught before
+ * the job runs out of memory.
  *
  * The parallel components available to monitor are the ones defined in the
  * `component_list` type alias in the metavariables. In addition to these
@@ -0,0 +1,8 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveActionProfile.hpp"
+
+namespace Events {
+PUP::able::PUP_ID ObserveActionProfile::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
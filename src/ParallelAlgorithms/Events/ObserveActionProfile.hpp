@@ -0,0 +1,152 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ActionProfile.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tags/ActionProfiles.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief %Observe how often and for how long the iterable actions of the
+ * elements were run
+ *
+ * Writes reduction quantities:
+ * - `%Time`
+ * - `<Phase>/<Action> invocations` for every action of every phase
+ * - `<Phase>/<Action> time` for every action of every phase
+ *
+ * The numbers of invocations and the wall times in seconds are summed over
+ * all elements and are cumulative since the start of the run (or the last
+ * restart from a checkpoint). Elements created by AMR start from zero. See
+ * `Parallel::ActionProfile` for details.
+ *
+ * The action that runs this event is still running when the event is run, so
+ * its current invocation is not yet included.
+ */
+class ObserveActionProfile : public Event {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveActionProfile(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveActionProfile);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe how often and for how long the iterable actions of the\n"
+      "elements were run, summed over all elements.";
+
+  ObserveActionProfile() = default;
+  explicit ObserveActionProfile(const std::string& subfile_name)
+      : subfile_path_("/" + subfile_name) {}
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using argument_tags = tmpl::list<Parallel::Tags::ActionProfiles>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(const std::vector<Parallel::ActionProfile>& profiles,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    std::vector<std::string> legend{observation_value.name};
+    legend.reserve(1 + 2 * profiles.size());
+    std::vector<double> number_of_invocations{};
+    number_of_invocations.reserve(profiles.size());
+    std::vector<double> total_times{};
+    total_times.reserve(profiles.size());
+    for (const auto& profile : profiles) {
+      legend.push_back(profile.name + " invocations");
+      number_of_invocations.push_back(
+          static_cast<double>(profile.number_of_invocations));
+      total_times.push_back(profile.total_time);
+    }
+    for (const auto& profile : profiles) {
+      legend.push_back(profile.name + " time");
+    }
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache));
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(observation_value.value,
+                                 subfile_path_ + ".dat"),
+        Parallel::make_array_component_id<ParallelComponent>(array_index),
+        subfile_path_, std::move(legend),
+        ReductionData{observation_value.value, std::move(number_of_invocations),
+                      std::move(total_times)});
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+}  // namespace Events
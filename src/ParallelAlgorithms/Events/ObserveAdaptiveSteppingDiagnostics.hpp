@@ -46,9 +46,16 @@ namespace Events {
  * - `Total steps on all elements`
  * - `Number of LTS step changes`
  * - `Number of step rejections`
+ * - `Total substeps on all elements`
+ * - `Total time derivative wall time`
+ * - `Maximum element time derivative wall time`
  *
  * The slab information is the same on all elements.  The step
- * information is summed over the elements.
+ * information is summed over the elements.  The substep counts and
+ * wall times measure the cost of evaluating the time derivative, and
+ * can be compared between runs with and without local time stepping.
+ * The maximum over the elements shows whether the cost is concentrated
+ * in a few elements.
  */
 class ObserveAdaptiveSteppingDiagnostics : public Event {
  private:
@@ -58,7 +65,10 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
       Parallel::ReductionDatum<uint64_t, funcl::AssertEqual<>>,
       Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
       Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
-      Parallel::ReductionDatum<uint64_t, funcl::Plus<>>>;
+      Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<double, funcl::Plus<>>,
+      Parallel::ReductionDatum<double, funcl::Max<>>>;
 
  public:
   /// The name of the subfile inside the HDF5 file
@@ -86,9 +96,13 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
       " - Total steps on all elements\n"
       " - Number of LTS step changes\n"
       " - Number of step rejections\n"
+      " - Total substeps on all elements\n"
+      " - Total time derivative wall time\n"
+      " - Maximum element time derivative wall time\n"
       "\n"
       "The slab information is the same on all elements.  The step\n"
-      "information is summed over the elements.";
+      "information is summed over the elements.  The wall times measure\n"
+      "the cost of evaluating the time derivative.";
 
   ObserveAdaptiveSteppingDiagnostics() = default;
   explicit ObserveAdaptiveSteppingDiagnostics(const std::string& subfile_name)
@@ -120,11 +134,15 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
         std::vector<std::string>{
             observation_value.name, "Number of slabs",
             "Number of slab size changes", "Total steps on all elements",
-            "Number of LTS step changes", "Number of step rejections"},
+            "Number of LTS step changes", "Number of step rejections",
+            "Total substeps on all elements", "Total time derivative wall time",
+            "Maximum element time derivative wall time"},
         ReductionData{observation_value.value, diags.number_of_slabs,
                       diags.number_of_slab_size_changes, diags.number_of_steps,
                       diags.number_of_step_fraction_changes,
-                      diags.number_of_step_rejections});
+                      diags.number_of_step_rejections, diags.number_of_substeps,
+                      diags.time_derivative_wall_time,
+                      diags.time_derivative_wall_time});
   }
 
   using observation_registration_tags = tmpl::list<>;
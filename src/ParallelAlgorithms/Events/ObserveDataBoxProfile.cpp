@@ -0,0 +1,8 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveDataBoxProfile.hpp"
+
+namespace Events {
+PUP::able::PUP_ID ObserveDataBoxProfile::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
@@ -0,0 +1,158 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief %Observe how often and for how long the compute and reference items
+ * of the DataBox were evaluated
+ *
+ * Writes reduction quantities:
+ * - `%Time`
+ * - `<Item> evaluations` for every compute and reference item
+ * - `<Item> time` for every compute and reference item
+ *
+ * The numbers of evaluations and the wall times in seconds are summed over
+ * all elements and are cumulative since the start of the run (or the last
+ * restart from a checkpoint). See `db::compute_item_profiles` for details.
+ *
+ * \note Profiles are only recorded if SpECTRE is configured with
+ * `-D ENABLE_DATABOX_PROFILING=ON`. Otherwise only the time is written.
+ */
+class ObserveDataBoxProfile : public Event {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveDataBoxProfile(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveDataBoxProfile);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe how often and for how long the compute and reference items of\n"
+      "the DataBox were evaluated, summed over all elements.\n"
+      "\n"
+      "Only records data if SpECTRE is configured with\n"
+      "ENABLE_DATABOX_PROFILING=ON.";
+
+  ObserveDataBoxProfile() = default;
+  explicit ObserveDataBoxProfile(const std::string& subfile_name)
+      : subfile_path_("/" + subfile_name) {}
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using argument_tags = tmpl::list<::Tags::DataBox>;
+
+  template <typename DbTagsList, typename ArrayIndex,
+            typename ParallelComponent, typename Metavariables>
+  void operator()(const db::DataBox<DbTagsList>& box,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    const std::vector<db::ComputeItemProfile> profiles =
+        db::compute_item_profiles(box);
+    std::vector<std::string> legend{observation_value.name};
+    legend.reserve(1 + 2 * profiles.size());
+    std::vector<double> number_of_evaluations{};
+    number_of_evaluations.reserve(profiles.size());
+    std::vector<double> evaluation_times{};
+    evaluation_times.reserve(profiles.size());
+    for (const auto& profile : profiles) {
+      legend.push_back(profile.name + " evaluations");
+      number_of_evaluations.push_back(
+          static_cast<double>(profile.number_of_evaluations));
+      evaluation_times.push_back(profile.total_time);
+    }
+    for (const auto& profile : profiles) {
+      legend.push_back(profile.name + " time");
+    }
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache));
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(observation_value.value,
+                                 subfile_path_ + ".dat"),
+        Parallel::make_array_component_id<ParallelComponent>(array_index),
+        subfile_path_, std::move(legend),
+        ReductionData{observation_value.value,
+                      std::move(number_of_evaluations),
+                      std::move(evaluation_times)});
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+}  // namespace Events
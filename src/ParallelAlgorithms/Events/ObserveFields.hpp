@@ -12,6 +12,7 @@
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataBox/ObservationBox.hpp"
@@ -20,6 +21,9 @@
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/FloatingPointType.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "IO/H5/TensorData.hpp"
@@ -29,6 +33,7 @@
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/VolumeActions.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
@@ -41,6 +46,7 @@
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
@@ -52,8 +58,6 @@
 #include "Utilities/TypeTraits/IsA.hpp"
 
 /// \cond
-template <size_t Dim>
-class Mesh;
 namespace Frame {
 struct Inertial;
 }  // namespace Frame
@@ -61,6 +65,62 @@ struct Inertial;
 
 namespace dg {
 namespace Events {
+namespace ObserveFields_detail {
+/*!
+ * \brief Interpolate a snapshot of volume tensor components taken by
+ * `dg::Events::ObserveFields` and send it to the local observer.
+ *
+ * \details Invoked on the element that took the snapshot with
+ * `Parallel::low_priority_simple_action`, so the work runs when the PE is
+ * otherwise idle rather than on the step that triggered the observation. The
+ * `floating_point_types` hold the output precision of each of the
+ * `components`.
+ */
+template <size_t VolumeDim>
+struct ContributeVolumeDataSnapshot {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index,
+      const observers::ObservationId& observation_id,
+      const std::string& subfile_path, const Mesh<VolumeDim>& mesh,
+      const Mesh<VolumeDim>& interpolation_mesh,
+      std::vector<TensorComponent> components,
+      const std::vector<FloatingPointType>& floating_point_types) {
+    ASSERT(components.size() == floating_point_types.size(),
+           "Expected a floating point type for each of the "
+               << components.size() << " tensor components, but got "
+               << floating_point_types.size());
+    // If the interpolation mesh is the evolution mesh the interpolation is
+    // essentially ignored by the RegularGridInterpolant except for a single
+    // copy.
+    const bool interpolate = interpolation_mesh != mesh;
+    const intrp::RegularGrid interpolant(mesh, interpolation_mesh);
+    for (size_t i = 0; i < components.size(); ++i) {
+      auto& component_data = std::get<DataVector>(components[i].data);
+      if (interpolate) {
+        component_data = interpolant.interpolate(component_data);
+      }
+      if (floating_point_types[i] == FloatingPointType::Float) {
+        components[i].data =
+            std::vector<float>{component_data.begin(), component_data.end()};
+      }
+    }
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache));
+    Parallel::simple_action<observers::Actions::ContributeVolumeData>(
+        local_observer, observation_id, subfile_path,
+        Parallel::make_array_component_id<ParallelComponent>(array_index),
+        ElementVolumeData{array_index, std::move(components),
+                          interpolation_mesh});
+  }
+};
+}  // namespace ObserveFields_detail
+
 /// \cond
 template <size_t VolumeDim, typename Tensors,
           typename NonTensorComputeTagsList = tmpl::list<>,
@@ -82,7 +142,19 @@ class ObserveFields;
  * `InertialCoordinates` are always observed.
  *
  * The user may specify an `interpolation_mesh` to which the
- * data is interpolated.
+ * data is interpolated. Choosing a mesh with fewer points than the evolution
+ * mesh downsamples the output.
+ *
+ * The observation is staged: when the event runs, the element only copies the
+ * observed tensor components. Interpolating and converting them and sending
+ * them to the observer happens later in a low-priority action on the element
+ * (see `dg::Events::ObserveFields_detail::ContributeVolumeDataSnapshot`), so
+ * observations don't cause spikes in the step time.
+ *
+ * The user may also restrict the observation to the elements in some blocks
+ * with the `BlocksToObserve` option, which takes block names and block group
+ * names. Only these elements register with the observers and send data, so
+ * the cost of the output scales with the region that is observed.
  *
  * \note The `NonTensorComputeTags` are intended to be used for `Variables`
  * compute tags like `Tags::DerivCompute`
@@ -132,6 +204,15 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
         "on a new mesh.";
   };
 
+  struct BlocksToObserve {
+    using type =
+        Options::Auto<std::vector<std::string>, Options::AutoLabel::All>;
+    static constexpr Options::String help = {
+        "List of blocks or block groups to observe. Elements in all other "
+        "blocks write no volume data. Specify 'All' to observe all blocks of "
+        "the domain."};
+  };
+
   /// The floating point type/precision with which to write the data to disk.
   ///
   /// Must be specified once for all data or individually for each variable
@@ -158,7 +239,7 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
 
   using options =
       tmpl::list<SubfileName, CoordinatesFloatingPointType, FloatingPointTypes,
-                 VariablesToObserve, InterpolateToMesh>;
+                 VariablesToObserve, InterpolateToMesh, BlocksToObserve>;
 
   static constexpr Options::String help =
       "Observe volume tensor fields.\n"
@@ -174,6 +255,7 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                 const std::vector<FloatingPointType>& floating_point_types,
                 const std::vector<std::string>& variables_to_observe,
                 std::optional<Mesh<VolumeDim>> interpolation_mesh = {},
+                std::optional<std::vector<std::string>> blocks_to_observe = {},
                 const Options::Context& context = {});
 
   using compute_tags_for_observation_box =
@@ -196,6 +278,11 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     if (not section_observation_key.has_value()) {
       return;
     }
+    // Skip observation on elements that are not in the observed blocks
+    if (not is_observed_block(get<domain::Tags::Domain<VolumeDim>>(box),
+                              array_index.block_id())) {
+      return;
+    }
     call_operator_impl(subfile_path_ + *section_observation_key,
                        variables_to_observe_, interpolation_mesh_, mesh, box,
                        cache, array_index, component, observation_value);
@@ -217,40 +304,24 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
       const ElementId<VolumeDim>& element_id,
       const ParallelComponent* const /*meta*/,
       const ObservationValue& observation_value) {
-    // if no interpolation_mesh is provided, the interpolation is essentially
-    // ignored by the RegularGridInterpolant except for a single copy.
-    const intrp::RegularGrid interpolant(mesh,
-                                         interpolation_mesh.value_or(mesh));
-
-    // Remove tensor types, only storing individual components.
+    // Only copy the observed tensor components here. Interpolating them,
+    // converting them to the output precision and sending them to the
+    // observer is deferred to a low-priority action on this element, so it
+    // runs when the PE would otherwise idle instead of during the step.
     std::vector<TensorComponent> components;
+    std::vector<FloatingPointType> floating_point_types;
     // This is larger than we need if we are only observing some
     // tensors, but that's not a big deal and calculating the correct
     // size is nontrivial.
-    components.reserve(alg::accumulate(
+    const size_t max_number_of_components = alg::accumulate(
         std::initializer_list<size_t>{
             std::decay_t<decltype(value(typename Tensors::type{}))>::size()...},
-        0_st));
-
-    const auto record_tensor_component_impl =
-        [&components, &interpolant](const auto& tensor,
-                                    const FloatingPointType floating_point_type,
-                                    const std::string& tag_name) {
-          for (size_t i = 0; i < tensor.size(); ++i) {
-            const auto tensor_component = interpolant.interpolate(tensor[i]);
-            if (floating_point_type == FloatingPointType::Float) {
-              components.emplace_back(
-                  tag_name + tensor.component_suffix(i),
-                  std::vector<float>{tensor_component.begin(),
-                                     tensor_component.end()});
-            } else {
-              components.emplace_back(tag_name + tensor.component_suffix(i),
-                                      tensor_component);
-            }
-          }
-        };
+        0_st);
+    components.reserve(max_number_of_components);
+    floating_point_types.reserve(max_number_of_components);
+
     const auto record_tensor_components =
-        [&box, &record_tensor_component_impl,
+        [&box, &components, &floating_point_types,
          &variables_to_observe](const auto tensor_tag_v) {
           using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
           const std::string tag_name = db::tag_name<tensor_tag>();
@@ -264,25 +335,23 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                   ObserveFields::print_warning_about_optional<tensor_tag>();
               return;
             }
-            const auto floating_point_type = var_to_observe->second;
-            record_tensor_component_impl(value(tensor), floating_point_type,
-                                         tag_name);
+            for (size_t i = 0; i < value(tensor).size(); ++i) {
+              components.emplace_back(
+                  tag_name + value(tensor).component_suffix(i),
+                  DataVector(value(tensor)[i]));
+              floating_point_types.push_back(var_to_observe->second);
+            }
           }
         };
     EXPAND_PACK_LEFT_TO_RIGHT(record_tensor_components(tmpl::type_<Tensors>{}));
 
-    // Send data to volume observer
-    auto& local_observer = *Parallel::local_branch(
-        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
-            cache));
-    Parallel::simple_action<observers::Actions::ContributeVolumeData>(
-        local_observer,
+    Parallel::low_priority_simple_action<
+        ObserveFields_detail::ContributeVolumeDataSnapshot<VolumeDim>>(
+        Parallel::get_parallel_component<ParallelComponent>(cache)[element_id],
         observers::ObservationId(observation_value.value,
                                  subfile_path + ".vol"),
-        subfile_path,
-        Parallel::make_array_component_id<ParallelComponent>(element_id),
-        ElementVolumeData{element_id, std::move(components),
-                          interpolation_mesh.value_or(mesh)});
+        subfile_path, mesh, interpolation_mesh.value_or(mesh),
+        std::move(components), std::move(floating_point_types));
   }
 
   using observation_registration_tags = tmpl::list<::Tags::DataBox>;
@@ -297,6 +366,11 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     if (not section_observation_key.has_value()) {
       return std::nullopt;
     }
+    if (not is_observed_block(
+            db::get<domain::Tags::Domain<VolumeDim>>(box),
+            db::get<domain::Tags::Element<VolumeDim>>(box).id().block_id())) {
+      return std::nullopt;
+    }
     return {{observers::TypeOfObservation::Volume,
              observers::ObservationKey(
                  subfile_path_ + section_observation_key.value() + ".vol")}};
@@ -319,9 +393,37 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
     p | subfile_path_;
     p | variables_to_observe_;
     p | interpolation_mesh_;
+    p | blocks_to_observe_;
   }
 
  private:
+  bool is_observed_block(const Domain<VolumeDim>& domain,
+                         const size_t block_id) const {
+    if (not blocks_to_observe_.has_value()) {
+      return true;
+    }
+    const auto& block_groups = domain.block_groups();
+    const std::string& block_name = domain.blocks()[block_id].name();
+    bool result = false;
+    for (const std::string& block_to_observe : *blocks_to_observe_) {
+      if (block_to_observe == block_name) {
+        result = true;
+      } else if (const auto group = block_groups.find(block_to_observe);
+                 group != block_groups.end()) {
+        result = result or group->second.count(block_name) == 1;
+      } else if (alg::none_of(domain.blocks(),
+                              [&block_to_observe](const auto& block) {
+                                return block.name() == block_to_observe;
+                              })) {
+        ERROR("The block or block group '"
+              << block_to_observe
+              << "' in the BlocksToObserve of ObserveFields is not in the "
+                 "domain.");
+      }
+    }
+    return result;
+  }
+
   template <typename Tag>
   static bool print_warning_about_optional() {
     Parallel::printf(
@@ -337,6 +439,7 @@ class ObserveFields<VolumeDim, tmpl::list<Tensors...>,
   std::string subfile_path_;
   std::unordered_map<std::string, FloatingPointType> variables_to_observe_{};
   std::optional<Mesh<VolumeDim>> interpolation_mesh_{};
+  std::optional<std::vector<std::string>> blocks_to_observe_{};
 };
 
 template <size_t VolumeDim, typename... Tensors,
@@ -348,6 +451,7 @@ ObserveFields<VolumeDim, tmpl::list<Tensors...>,
                   const std::vector<FloatingPointType>& floating_point_types,
                   const std::vector<std::string>& variables_to_observe,
                   std::optional<Mesh<VolumeDim>> interpolation_mesh,
+                  std::optional<std::vector<std::string>> blocks_to_observe,
                   const Options::Context& context)
     : subfile_path_("/" + subfile_name),
       variables_to_observe_([&context, &floating_point_types,
@@ -375,7 +479,8 @@ ObserveFields<VolumeDim, tmpl::list<Tensors...>,
         }
         return result;
       }()),
-      interpolation_mesh_(interpolation_mesh) {
+      interpolation_mesh_(interpolation_mesh),
+      blocks_to_observe_(std::move(blocks_to_observe)) {
   ASSERT(
       (... or (db::tag_name<Tensors>() == "InertialCoordinates")),
       "There is no tag with name 'InertialCoordinates' specified "
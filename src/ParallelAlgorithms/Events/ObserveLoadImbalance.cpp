@@ -0,0 +1,33 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveLoadImbalance.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Events {
+namespace ObserveLoadImbalance_detail {
+std::vector<double> SummarizeProcCosts::operator()(
+    const std::vector<double>& proc_costs) const {
+  double maximum = 0.0;
+  double total = 0.0;
+  size_t procs_with_cost = 0;
+  for (const double cost : proc_costs) {
+    if (cost > 0.0) {
+      maximum = std::max(maximum, cost);
+      total += cost;
+      ++procs_with_cost;
+    }
+  }
+  if (procs_with_cost == 0) {
+    return {0.0, 0.0, 1.0};
+  }
+  const double mean = total / static_cast<double>(procs_with_cost);
+  return {maximum, mean, maximum / mean};
+}
+}  // namespace ObserveLoadImbalance_detail
+
+PUP::able::PUP_ID ObserveLoadImbalance::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
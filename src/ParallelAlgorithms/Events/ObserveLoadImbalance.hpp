@@ -0,0 +1,159 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ActionProfile.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tags/ActionProfiles.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+namespace ObserveLoadImbalance_detail {
+// Reduces the summed cost of each processor to the maximum, the mean
+// over the processors with elements, and their ratio.
+struct SummarizeProcCosts {
+  std::vector<double> operator()(const std::vector<double>& proc_costs) const;
+};
+}  // namespace ObserveLoadImbalance_detail
+
+/*!
+ * \brief %Observe how evenly the measured cost of the elements is spread
+ * over the processors
+ *
+ * The measured cost of an element is the wall time spent in its iterable
+ * actions (see `Parallel::ActionProfile`), so it includes the differences
+ * between, for instance, DG and FD elements or elements taking different
+ * numbers of local time steps. The costs are summed over the elements on each
+ * processor.
+ *
+ * Writes reduction quantities:
+ * - `%Time`
+ * - `Maximum proc cost`
+ * - `Mean proc cost`: the mean over the processors that have elements
+ * - `Imbalance`: the ratio of the maximum to the mean, equal to one for a
+ *   perfectly balanced distribution
+ *
+ * The costs are cumulative since the start of the run (or the last restart
+ * from a checkpoint) and move with the elements when they migrate, so
+ * observing before and after a `Parallel::Phase::LoadBalancing` phase
+ * triggered by `PhaseControl::VisitAndReturn` reports the imbalance of the
+ * old and new distributions of the same work.
+ */
+class ObserveLoadImbalance : public Event {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<
+          std::vector<double>, funcl::ElementWise<funcl::Plus<>>,
+          ObserveLoadImbalance_detail::SummarizeProcCosts>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveLoadImbalance(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveLoadImbalance);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe how evenly the measured cost of the elements is spread over\n"
+      "the processors.";
+
+  ObserveLoadImbalance() = default;
+  explicit ObserveLoadImbalance(const std::string& subfile_name)
+      : subfile_path_("/" + subfile_name) {}
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using argument_tags = tmpl::list<Parallel::Tags::ActionProfiles>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(const std::vector<Parallel::ActionProfile>& profiles,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    std::vector<double> proc_costs(Parallel::number_of_procs<size_t>(cache),
+                                   0.0);
+    double& cost = proc_costs[Parallel::my_proc<size_t>(cache)];
+    for (const auto& profile : profiles) {
+      cost += profile.total_time;
+    }
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache));
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(observation_value.value,
+                                 subfile_path_ + ".dat"),
+        Parallel::make_array_component_id<ParallelComponent>(array_index),
+        subfile_path_,
+        std::vector<std::string>{observation_value.name, "Maximum proc cost",
+                                 "Mean proc cost", "Imbalance"},
+        ReductionData{observation_value.value, std::move(proc_costs)});
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+}  // namespace Events
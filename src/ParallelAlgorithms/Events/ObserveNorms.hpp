@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <optional>
 #include <pup.h>
 #include <string>
-#include <unordered_map>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -38,7 +40,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
-#include "Utilities/Numeric.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/OptionalHelpers.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
@@ -340,9 +342,18 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
 
   using tensor_tags = tmpl::list<ObservableTensorTags...>;
 
-  std::unordered_map<std::string,
-                     std::pair<std::vector<double>, std::vector<std::string>>>
-      norm_values_and_names{};
+  // The values and legend names of each norm type, in the order of the
+  // `ReductionData`
+  constexpr size_t number_of_norm_types = 5;
+  const auto norm_type_index = [](const std::string& norm_type) -> size_t {
+    return norm_type == "Max"              ? 0
+           : norm_type == "Min"            ? 1
+           : norm_type == "L2Norm"         ? 2
+           : norm_type == "L2IntegralNorm" ? 3
+                                           : 4;
+  };
+  std::array<std::vector<double>, number_of_norm_types> norm_values{};
+  std::array<std::vector<std::string>, number_of_norm_types> norm_names{};
   const auto& mesh = get<::Events::Tags::ObserverMesh<VolumeDim>>(box);
   const DataVector det_jacobian =
     1. / get(get<::Events::Tags::ObserverDetInvJacobian
@@ -350,108 +361,190 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
   const size_t number_of_points = mesh.number_of_grid_points();
   const double local_volume = definite_integral(det_jacobian, mesh);
 
+  // The integrands of all integral norms are collected in one buffer so they
+  // are integrated together at the end. Its size is known from the tensor
+  // types without evaluating any compute tags.
+  size_t number_of_integrands = 0;
+  tmpl::for_each<tensor_tags>([this, &number_of_integrands](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    const std::string tensor_name = db::tag_name<tag>();
+    for (size_t i = 0; i < tensor_names_.size(); ++i) {
+      if (tensor_name == tensor_names_[i] and
+          (tensor_norm_types_[i] == "L2IntegralNorm" or
+           tensor_norm_types_[i] == "VolumeIntegral")) {
+        number_of_integrands += std::decay_t<decltype(value(
+            std::declval<typename tag::type>()))>::size();
+      }
+    }
+  });
+  DataVector integrands(number_of_integrands * number_of_points);
+  // For each integral norm: the norm type, the position of its value, the
+  // first integrand, and the number of integrands summed into the value.
+  std::vector<std::array<size_t, 4>> integral_norms{};
+  size_t next_integrand = 0;
+
   // Loop over ObservableTensorTags and see if it was requested to be observed.
   // This approach allows us to delay evaluating any compute tags until they're
   // actually needed for observing.
-  tmpl::for_each<tensor_tags>([this, &box, &norm_values_and_names,
-                               &number_of_points, &mesh,
-                               &det_jacobian](auto tag_v) {
+  tmpl::for_each<tensor_tags>([this, &box, &norm_type_index, &norm_values,
+                               &norm_names, &number_of_points, &integrands,
+                               &integral_norms, &next_integrand](auto tag_v) {
     using tag = tmpl::type_from<decltype(tag_v)>;
     const std::string tensor_name = db::tag_name<tag>();
+    // The statistics of each component are computed at most once, in a single
+    // pass over the grid, no matter how many norms of the tensor are observed.
+    // Each entry holds the max, min, and sum of squares of a component.
+    std::vector<std::array<double, 3>> component_stats{};
+    // The first integrand holding the square of each component, or the
+    // component itself.
+    std::optional<size_t> squares_integrand{};
+    std::optional<size_t> values_integrand{};
     for (size_t i = 0; i < tensor_names_.size(); ++i) {
-      if (tensor_name == tensor_names_[i]) {
-        if (UNLIKELY(not has_value(get<tag>(box)))) {
-          ERROR("Cannot observe a norm of '"
-                << tensor_name
-                << "' because it is a std::optional and wasn't able to be "
-                   "computed. This can happen when you try to observe errors "
-                   "without an analytic solution.");
-        }
-        const auto& tensor = value(get<tag>(box));
-
-        auto& [values, names] = norm_values_and_names[tensor_norm_types_[i]];
-        const auto names_and_components = tensor.get_vector_of_data();
-        const auto& component_names = names_and_components.first;
-        const auto& components = names_and_components.second;
-        if (components[0].size() != number_of_points) {
-          ERROR("The number of grid points of the mesh is "
-                << number_of_points << " but the tensor '" << tensor_name
-                << "' has " << components[0].size()
-                << " points. This means you're computing norms of tensors over "
-                   "different grids, which will give the wrong answer for "
-                   "norms that use the grid points.");
+      if (tensor_name != tensor_names_[i]) {
+        continue;
+      }
+      if (UNLIKELY(not has_value(get<tag>(box)))) {
+        ERROR("Cannot observe a norm of '"
+              << tensor_name
+              << "' because it is a std::optional and wasn't able to be "
+                 "computed. This can happen when you try to observe errors "
+                 "without an analytic solution.");
+      }
+      const auto& tensor = value(get<tag>(box));
+      const size_t number_of_components = tensor.size();
+      if (tensor[0].size() != number_of_points) {
+        ERROR("The number of grid points of the mesh is "
+              << number_of_points << " but the tensor '" << tensor_name
+              << "' has " << tensor[0].size()
+              << " points. This means you're computing norms of tensors over "
+                 "different grids, which will give the wrong answer for "
+                 "norms that use the grid points.");
+      }
+
+      const size_t norm_type = norm_type_index(tensor_norm_types_[i]);
+      auto& values = gsl::at(norm_values, norm_type);
+      auto& names = gsl::at(norm_names, norm_type);
+      const bool sum_components = tensor_components_[i] == "Sum";
+      if (sum_components) {
+        names.push_back(tensor_norm_types_[i] + "(" + tensor_name + ")");
+      } else {
+        for (size_t storage_index = 0; storage_index < number_of_components;
+             ++storage_index) {
+          names.push_back(
+              tensor_norm_types_[i] + "(" +
+              (number_of_components == 1
+                   ? tensor_name
+                   : (tensor_name + "_" +
+                      tensor.component_name(
+                          tensor.get_tensor_index(storage_index)))) +
+              ")");
         }
+      }
 
-        if (tensor_components_[i] == "Individual") {
-          for (size_t storage_index = 0; storage_index < component_names.size();
+      // L2IntegralNorm or VolumeIntegral
+      if (norm_type >= 3) {
+        // Integral norms: fill the integrands once per tensor and record where
+        // the values go
+        auto& integrand_offset =
+            norm_type == 3 ? squares_integrand : values_integrand;
+        if (not integrand_offset.has_value()) {
+          integrand_offset = next_integrand;
+          for (size_t storage_index = 0; storage_index < number_of_components;
                ++storage_index) {
-            if (tensor_norm_types_[i] == "Max") {
-              values.push_back(max(components[storage_index]));
-            } else if (tensor_norm_types_[i] == "Min") {
-              values.push_back(min(components[storage_index]));
-            } else if (tensor_norm_types_[i] == "L2Norm") {
-              values.push_back(
-                  alg::accumulate(square(components[storage_index]), 0.0));
-            } else if (tensor_norm_types_[i] == "L2IntegralNorm") {
-              values.push_back(definite_integral(
-                  square(components[storage_index]) * det_jacobian, mesh));
-            } else if (tensor_norm_types_[i] == "VolumeIntegral") {
-              values.push_back(definite_integral(
-                         components[storage_index] * det_jacobian, mesh));
+            DataVector integrand(
+                integrands.data() +
+                    (next_integrand + storage_index) * number_of_points,
+                number_of_points);
+            if (norm_type == 3) {
+              integrand = square(tensor[storage_index]);
+            } else {
+              integrand = tensor[storage_index];
             }
-            names.push_back(
-                tensor_norm_types_[i] + "(" +
-                (component_names.size() == 1
-                     ? tensor_name
-                     : (tensor_name + "_" + component_names[storage_index])) +
-                ")");
-          }
-        } else if (tensor_components_[i] == "Sum") {
-          double value = 0.0;
-          if (tensor_norm_types_[i] == "Max") {
-            value = std::numeric_limits<double>::min();
-          } else if (tensor_norm_types_[i] == "Min") {
-            value = std::numeric_limits<double>::max();
           }
-          for (size_t storage_index = 0; storage_index < component_names.size();
+          next_integrand += number_of_components;
+        }
+        if (sum_components) {
+          integral_norms.push_back({{norm_type, values.size(),
+                                     *integrand_offset, number_of_components}});
+          values.push_back(0.0);
+        } else {
+          for (size_t storage_index = 0; storage_index < number_of_components;
                ++storage_index) {
-            if (tensor_norm_types_[i] == "Max") {
-              value = std::max(value, max(components[storage_index]));
-            } else if (tensor_norm_types_[i] == "Min") {
-              value = std::min(value, min(components[storage_index]));
-            } else if (tensor_norm_types_[i] == "L2Norm") {
-              value += alg::accumulate(square(components[storage_index]), 0.0);
-            } else if (tensor_norm_types_[i] == "L2IntegralNorm") {
-              value += definite_integral(
-                  square(components[storage_index]) * det_jacobian, mesh);
-            } else if (tensor_norm_types_[i] == "VolumeIntegral") {
-              value += definite_integral(
-                  components[storage_index] * det_jacobian, mesh);
-            }
+            integral_norms.push_back({{norm_type, values.size(),
+                                       *integrand_offset + storage_index, 1}});
+            values.push_back(0.0);
           }
+        }
+        continue;
+      }
 
-          names.push_back(tensor_norm_types_[i] + "(" + tensor_name + ")");
-          values.push_back(value);
+      if (component_stats.empty()) {
+        component_stats.resize(number_of_components);
+        for (size_t storage_index = 0; storage_index < number_of_components;
+             ++storage_index) {
+          const double* const component = tensor[storage_index].data();
+          double component_max = -std::numeric_limits<double>::infinity();
+          double component_min = std::numeric_limits<double>::infinity();
+          double sum_of_squares = 0.0;
+          for (size_t point = 0; point < number_of_points; ++point) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const double x = component[point];
+            component_max = std::max(component_max, x);
+            component_min = std::min(component_min, x);
+            sum_of_squares += x * x;
+          }
+          component_stats[storage_index] = {
+              {component_max, component_min, sum_of_squares}};
+        }
+      }
+      if (sum_components) {
+        double value = 0.0;
+        if (norm_type == 0) {
+          value = std::numeric_limits<double>::min();
+        } else if (norm_type == 1) {
+          value = std::numeric_limits<double>::max();
+        }
+        for (const auto& stats : component_stats) {
+          if (norm_type == 0) {
+            value = std::max(value, stats[0]);
+          } else if (norm_type == 1) {
+            value = std::min(value, stats[1]);
+          } else {
+            value += stats[2];
+          }
+        }
+        values.push_back(value);
+      } else {
+        for (const auto& stats : component_stats) {
+          values.push_back(gsl::at(stats, norm_type));
         }
       }
     }
   });
 
+  if (not integral_norms.empty()) {
+    // Tensors observed with the same integral norm more than once share their
+    // integrands, so only part of the buffer may be in use
+    const DataVector used_integrands(integrands.data(),
+                                     next_integrand * number_of_points);
+    DataVector integrals{};
+    definite_integrals(make_not_null(&integrals), used_integrands, mesh,
+                       det_jacobian);
+    for (const auto& [norm_type, value_index, first_integrand,
+                      number_of_summed_integrands] : integral_norms) {
+      double& value = gsl::at(norm_values, norm_type)[value_index];
+      for (size_t j = 0; j < number_of_summed_integrands; ++j) {
+        value += integrals[first_integrand + j];
+      }
+    }
+  }
+
   // Concatenate the legend info together.
   std::vector<std::string> legend{observation_value.name, "NumberOfPoints",
                                   "Volume"};
-  legend.insert(legend.end(), norm_values_and_names["Max"].second.begin(),
-                norm_values_and_names["Max"].second.end());
-  legend.insert(legend.end(), norm_values_and_names["Min"].second.begin(),
-                norm_values_and_names["Min"].second.end());
-  legend.insert(legend.end(), norm_values_and_names["L2Norm"].second.begin(),
-                norm_values_and_names["L2Norm"].second.end());
-  legend.insert(legend.end(),
-                norm_values_and_names["L2IntegralNorm"].second.begin(),
-                norm_values_and_names["L2IntegralNorm"].second.end());
-  legend.insert(legend.end(),
-                norm_values_and_names["VolumeIntegral"].second.begin(),
-                norm_values_and_names["VolumeIntegral"].second.end());
+  for (const auto& names : norm_names) {
+    legend.insert(legend.end(), names.begin(), names.end());
+  }
 
   // Send data to reduction observer
   auto& local_observer = *Parallel::local_branch(
@@ -466,11 +559,9 @@ operator()(const ObservationBox<ComputeTagsList, DataBoxType>& box,
       Parallel::make_array_component_id<ParallelComponent>(array_index),
       subfile_path_with_suffix, std::move(legend),
       ReductionData{observation_value.value, number_of_points, local_volume,
-                    std::move(norm_values_and_names["Max"].first),
-                    std::move(norm_values_and_names["Min"].first),
-                    std::move(norm_values_and_names["L2Norm"].first),
-                    std::move(norm_values_and_names["L2IntegralNorm"].first),
-                    std::move(norm_values_and_names["VolumeIntegral"].first)});
+                    std::move(norm_values[0]), std::move(norm_values[1]),
+                    std::move(norm_values[2]), std::move(norm_values[3]),
+                    std::move(norm_values[4])});
 }
 
 template <typename... ObservableTensorTags, typename... NonTensorComputeTags,
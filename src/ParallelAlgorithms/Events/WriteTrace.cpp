@@ -0,0 +1,51 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/WriteTrace.hpp"
+
+#include <fstream>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "Parallel/Tracing.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace Events {
+WriteTrace::WriteTrace(std::string file_name)
+    : file_name_(std::move(file_name)) {}
+
+void WriteTrace::write_trace(const int node,
+                             const double observation_value) const {
+  // All elements on the node run the event, but the trace holds the spans of
+  // the whole node, so only the first one writes it.
+  static std::mutex mutex{};
+  static std::unordered_map<std::string, double> last_observation_values{};
+  const std::string file = file_name_ + std::to_string(node) + ".json";
+  const std::lock_guard lock(mutex);
+  const auto [last_observation_value, first_write] =
+      last_observation_values.try_emplace(file, observation_value);
+  if (not first_write) {
+    if (last_observation_value->second == observation_value) {
+      return;
+    }
+    last_observation_value->second = observation_value;
+  }
+
+  std::ofstream stream(file);
+  if (not stream) {
+    ERROR("Could not open trace file '" << file << "'.");
+  }
+  Parallel::tracing::write_chrome_trace(stream, node);
+}
+
+void WriteTrace::pup(PUP::er& p) {
+  Event::pup(p);
+  p | file_name_;
+}
+
+PUP::able::PUP_ID WriteTrace::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <pup.h>
+#include <string>
+
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write the spans recorded by `Parallel::tracing` on each node to disk
+ *
+ * \details Each node writes the spans currently held in the ring buffers of
+ * its threads to the file `FileName` followed by the node number and
+ * `.json`, replacing the file written at the previous observation. The files
+ * are in the Chrome trace event format and can be loaded together in the
+ * Perfetto UI or `chrome://tracing` to see what every thread was running up to
+ * the observation.
+ *
+ * Running this event at a low frequency, e.g., together with checkpoints,
+ * keeps the latest trace available after a stalled job is killed.
+ */
+class WriteTrace : public Event {
+ public:
+  struct FileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "Start of the name of the trace files. The node number and '.json' "
+        "are appended."};
+  };
+
+  /// \cond
+  explicit WriteTrace(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(WriteTrace);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<FileName>;
+  static constexpr Options::String help =
+      "Write the recent actions and entry methods run on each thread to disk "
+      "in the Chrome trace event format.";
+
+  WriteTrace() = default;
+  explicit WriteTrace(std::string file_name);
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const Component* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    write_trace(Parallel::my_node<int>(cache), observation_value.value);
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  // Writes the file of `node` unless it was already written for this
+  // observation by another element on the node.
+  void write_trace(int node, double observation_value) const;
+
+  std::string file_name_;
+};
+}  // namespace Events
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <pup.h>  // IWYU pragma: keep
@@ -107,6 +108,10 @@ class EventsAndTriggers {
     }
   }
 
+  /// The number of triggers, i.e., the number of calls to the trigger check
+  /// in `run_events`
+  size_t number_of_triggers() const { return events_and_triggers_.size(); }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) { p | events_and_triggers_; }
 
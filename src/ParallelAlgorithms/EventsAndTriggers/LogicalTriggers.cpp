@@ -3,7 +3,47 @@
 
 #include "ParallelAlgorithms/EventsAndTriggers/LogicalTriggers.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
 namespace Triggers {
+std::optional<Trigger::FiringBound> And::next_firing_bound(
+    const std::int64_t slab_number, const double time) const {
+  std::optional<FiringBound> result{};
+  for (const auto& trigger : combined_triggers_) {
+    const auto bound = trigger->next_firing_bound(slab_number, time);
+    if (not bound.has_value()) {
+      continue;
+    }
+    if (not result.has_value()) {
+      result = bound;
+    } else {
+      result->slab_number = std::max(result->slab_number, bound->slab_number);
+      result->time = std::max(result->time, bound->time);
+    }
+  }
+  return result;
+}
+
+std::optional<Trigger::FiringBound> Or::next_firing_bound(
+    const std::int64_t slab_number, const double time) const {
+  std::optional<FiringBound> result{};
+  for (const auto& trigger : combined_triggers_) {
+    const auto bound = trigger->next_firing_bound(slab_number, time);
+    if (not bound.has_value()) {
+      return std::nullopt;
+    }
+    if (not result.has_value()) {
+      result = bound;
+    } else {
+      result->slab_number = std::min(result->slab_number, bound->slab_number);
+      result->time = std::min(result->time, bound->time);
+    }
+  }
+  return result;
+}
+
 PUP::able::PUP_ID Always::my_PUP_ID = 0;  // NOLINT
 PUP::able::PUP_ID Not::my_PUP_ID = 0;  // NOLINT
 PUP::able::PUP_ID And::my_PUP_ID = 0;  // NOLINT
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <pup_stl.h>
 #include <vector>
 
@@ -93,6 +95,10 @@ class And : public Trigger {
     return true;
   }
 
+  /// The latest of the bounds of the combined triggers that have one
+  std::optional<FiringBound> next_firing_bound(std::int64_t slab_number,
+                                               double time) const override;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) { p | combined_triggers_; }
 
@@ -129,6 +135,11 @@ class Or : public Trigger {
     return false;
   }
 
+  /// The earliest of the bounds of the combined triggers, if they all have
+  /// one
+  std::optional<FiringBound> next_firing_bound(std::int64_t slab_number,
+                                               double time) const override;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) { p | combined_triggers_; }
 
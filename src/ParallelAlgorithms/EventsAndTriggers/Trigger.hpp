@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
+#include <optional>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
 #include "Utilities/CallWithDynamicType.hpp"
@@ -29,6 +33,27 @@ class Trigger : public PUP::able {
 
   WRAPPED_PUPable_abstract(Trigger);  // NOLINT
 
+  /// Lower bounds on the slab number and the time at which a trigger can
+  /// fire. The trigger can't fire before both bounds are reached.
+  struct FiringBound {
+    std::int64_t slab_number{std::numeric_limits<std::int64_t>::min()};
+    double time{-std::numeric_limits<double>::infinity()};
+  };
+
+  /// \brief When the trigger can fire at the earliest after being checked at
+  /// the slab `slab_number` and time `time`, assuming time runs forward.
+  ///
+  /// \details Triggers that depend only on the slab number and the time can
+  /// override this so that they aren't checked again until the bound is
+  /// reached, see `evolution::Actions::RunEventsAndTriggers`. The bound on the
+  /// time doesn't include roundoff, which the caller must allow for. Triggers
+  /// that can't bound when they fire return `std::nullopt` (the default) and
+  /// are checked every time.
+  virtual std::optional<FiringBound> next_firing_bound(
+      const std::int64_t /*slab_number*/, const double /*time*/) const {
+    return std::nullopt;
+  }
+
   template <typename DbTags>
   bool is_triggered(const db::DataBox<DbTags>& box) const {
     using factory_classes =
@@ -29,6 +29,8 @@ namespace Actions {
 /// \brief Adds interpolation point holders to the Element's DataBox.
 ///
 /// This action is for the case in which the points are time-independent.
+/// For sequential targets that the `Element`s interpolate to themselves,
+/// `intrp::Tags::ElementVolumeVars` should be added as well.
 ///
 /// This action should be placed in the Initialization PDAL for DgElementArray.
 ///
@@ -36,12 +38,13 @@ namespace Actions {
 ///
 /// DataBox changes:
 /// - Adds:
-///   - `intrp::Tags::InterpPointInfo<Metavariables>`
+///   - `InterpPointInfoTags...`, e.g.,
+///     `intrp::Tags::InterpPointInfo<Metavariables>`
 /// - Removes: nothing
 /// - Modifies: nothing
-template <typename InterpPointInfoTag>
+template <typename... InterpPointInfoTags>
 struct ElementInitInterpPoints {
-  using simple_tags = tmpl::list<InterpPointInfoTag>;
+  using simple_tags = tmpl::list<InterpPointInfoTags...>;
   template <typename DbTags, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
@@ -51,7 +54,7 @@ struct ElementInitInterpPoints {
       const Parallel::GlobalCache<Metavariables>& /*cache*/,
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
-    // Here we only want the `InterpPointInfoTag` default constructed
+    // Here we only want the `InterpPointInfoTags` default constructed
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
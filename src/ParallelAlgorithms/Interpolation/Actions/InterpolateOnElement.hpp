@@ -0,0 +1,225 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolatorReceiveVolumeData.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace intrp {
+template <typename Metavariables, typename Tag>
+struct InterpolationTarget;
+namespace Actions {
+template <typename InterpolationTargetTag>
+struct InterpolationTargetReceiveVars;
+}  // namespace Actions
+}  // namespace intrp
+/// \endcond
+
+namespace intrp {
+namespace Actions {
+namespace detail {
+/// Whether the `Element`s interpolate to the sequential
+/// `InterpolationTargetTag` themselves, instead of sending their volume data
+/// to the `Interpolator`.
+template <typename Metavariables, typename InterpolationTargetTag>
+constexpr bool interpolates_on_elements_v =
+    InterpolationTargetTag::compute_target_points::is_sequential::value and
+    not using_interpolator_component_v<Metavariables, InterpolationTargetTag>;
+
+// Interpolates the volume data held by the `Element` to the target points
+// that it holds at `temporal_id`, if it has both, and sends the result to the
+// `InterpolationTarget`.
+template <typename InterpolationTargetTag, size_t VolumeDim,
+          typename Metavariables>
+void interpolate_held_volume_vars(
+    const gsl::not_null<
+        Vars::ElementHolder<VolumeDim, InterpolationTargetTag>*>
+        holder,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const ElementId<VolumeDim>& element_id,
+    const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
+  const auto volume_vars = holder->volume_vars.find(temporal_id);
+  const auto target_points = holder->target_points.find(temporal_id);
+  if (volume_vars == holder->volume_vars.end() or
+      target_points == holder->target_points.end()) {
+    return;
+  }
+  const auto element_coord_holders = element_logical_coordinates(
+      std::vector<ElementId<VolumeDim>>{{element_id}}, target_points->second);
+  holder->target_points.erase(target_points);
+  if (element_coord_holders.count(element_id) == 0) {
+    // There are no target points in this element.
+    return;
+  }
+  const auto& element_coord_holder = element_coord_holders.at(element_id);
+  const intrp::Irregular<VolumeDim> interpolator(
+      volume_vars->second.first, element_coord_holder.element_logical_coords);
+  auto& receiver_proxy = Parallel::get_parallel_component<
+      InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+  Parallel::simple_action<
+      Actions::InterpolationTargetReceiveVars<InterpolationTargetTag>>(
+      receiver_proxy,
+      std::vector<Variables<
+          typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
+          {interpolator.interpolate(volume_vars->second.second)}),
+      std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
+      temporal_id);
+}
+}  // namespace detail
+
+/// \ingroup ActionsGroup
+/// \brief Receives the volume data of an `Element` at a `temporal_id` of a
+/// sequential `InterpolationTargetTag`, from the `Element` itself.
+///
+/// Sent by `intrp::Events::InterpolateWithoutInterpComponent`.  Interpolates
+/// to the target points if they have already been received.
+///
+/// Uses: nothing
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `Tags::ElementVolumeVars<InterpolationTargetTag, Dim>`
+template <typename InterpolationTargetTag>
+struct ElementReceiveVolumeVars {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            size_t VolumeDim>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& element_id,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      const Mesh<VolumeDim>& mesh,
+      Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+          vars) {
+    db::mutate<Tags::ElementVolumeVars<InterpolationTargetTag, VolumeDim>>(
+        [&cache, &element_id, &temporal_id, &mesh,
+         &vars](const gsl::not_null<
+                Vars::ElementHolder<VolumeDim, InterpolationTargetTag>*>
+                    holder) {
+          if (holder->last_completed_temporal_id.has_value() and
+              not(*holder->last_completed_temporal_id < temporal_id)) {
+            // The target is already done at this temporal_id.
+            return;
+          }
+          holder->volume_vars.insert_or_assign(
+              temporal_id, std::make_pair(mesh, std::move(vars)));
+          detail::interpolate_held_volume_vars<InterpolationTargetTag>(
+              holder, cache, element_id, temporal_id);
+        },
+        make_not_null(&box));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Receives the points of a sequential `InterpolationTargetTag` at a
+/// `temporal_id`, from the `InterpolationTarget`.
+///
+/// Sent to all `Element`s by `SendPointsToInterpolator`.  Interpolates the
+/// volume data at `temporal_id` to the points in the `Element` and sends the
+/// result to the `InterpolationTarget`, or keeps the points until the volume
+/// data arrives.
+///
+/// Uses: nothing
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `Tags::ElementVolumeVars<InterpolationTargetTag, Dim>`
+template <typename InterpolationTargetTag>
+struct ElementReceiveTargetPoints {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            size_t VolumeDim>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& element_id,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      typename Vars::ElementHolder<VolumeDim,
+                                   InterpolationTargetTag>::BlockCoords
+          block_logical_coords) {
+    db::mutate<Tags::ElementVolumeVars<InterpolationTargetTag, VolumeDim>>(
+        [&cache, &element_id, &temporal_id, &block_logical_coords](
+            const gsl::not_null<
+                Vars::ElementHolder<VolumeDim, InterpolationTargetTag>*>
+                holder) {
+          if (holder->last_completed_temporal_id.has_value() and
+              not(*holder->last_completed_temporal_id < temporal_id)) {
+            // The target is already done at this temporal_id.
+            return;
+          }
+          // Newer points at the same temporal_id replace older ones, which
+          // can only be left over if there were none in this element.
+          holder->target_points.insert_or_assign(
+              temporal_id, std::move(block_logical_coords));
+          detail::interpolate_held_volume_vars<InterpolationTargetTag>(
+              holder, cache, element_id, temporal_id);
+        },
+        make_not_null(&box));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief Removes the volume data and points of a sequential
+/// `InterpolationTargetTag` at `temporal_id` and earlier from an `Element`.
+///
+/// Sent to all `Element`s by `InterpolationTargetReceiveVars` when the target
+/// is done at `temporal_id`.
+///
+/// Uses: nothing
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `Tags::ElementVolumeVars<InterpolationTargetTag, Dim>`
+template <typename InterpolationTargetTag>
+struct CleanUpElementVolumeVars {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            size_t VolumeDim>
+  static void apply(
+      db::DataBox<DbTags>& box,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<VolumeDim>& /*element_id*/,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
+    db::mutate<Tags::ElementVolumeVars<InterpolationTargetTag, VolumeDim>>(
+        [&temporal_id](const gsl::not_null<
+                       Vars::ElementHolder<VolumeDim, InterpolationTargetTag>*>
+                           holder) {
+          if (not holder->last_completed_temporal_id.has_value() or
+              *holder->last_completed_temporal_id < temporal_id) {
+            holder->last_completed_temporal_id = temporal_id;
+          }
+          const auto erase_done = [&holder](const auto map) {
+            for (auto it = map->begin(); it != map->end();) {
+              if (*holder->last_completed_temporal_id < it->first) {
+                ++it;
+              } else {
+                it = map->erase(it);
+              }
+            }
+          };
+          erase_done(make_not_null(&holder->volume_vars));
+          erase_done(make_not_null(&holder->target_points));
+        },
+        make_not_null(&box));
+  }
+};
+}  // namespace Actions
+}  // namespace intrp
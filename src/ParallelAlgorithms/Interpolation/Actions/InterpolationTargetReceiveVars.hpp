@@ -13,6 +13,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolateOnElement.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/SendPointsToInterpolator.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/VerifyTemporalIdsAndSendPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
@@ -45,11 +46,16 @@ namespace Actions {
 /// \brief Receives interpolated variables from an `Interpolator` on a subset
 ///  of the target points.
 ///
+/// The variables come from the `Element`s instead if the target is
+/// sequential and has an `interpolating_component`.
+///
 /// If interpolated variables for all target points have been received, then
 /// - Calls `InterpolationTargetTag::post_interpolation_callback`
 /// - Tells `Interpolator`s that the interpolation is complete
 ///  (by calling
-///  `Actions::CleanUpInterpolator<InterpolationTargetTag>`)
+///  `Actions::CleanUpInterpolator<InterpolationTargetTag>`), or tells the
+///  `Element`s (by calling
+///  `Actions::CleanUpElementVolumeVars<InterpolationTargetTag>`)
 /// - Removes the first `temporal_id` from `Tags::TemporalIds<TemporalId>`
 /// - If there are more `temporal_id`s, begins interpolation at the next
 ///  `temporal_id` (by calling `InterpolationTargetTag::compute_target_points`)
@@ -133,12 +139,22 @@ struct InterpolationTargetReceiveVars {
               make_not_null(&box), make_not_null(&cache), temporal_id)) {
         InterpolationTarget_detail::clean_up_interpolation_target<
             InterpolationTargetTag>(make_not_null(&box), temporal_id);
-        auto& interpolator_proxy =
-            Parallel::get_parallel_component<Interpolator<Metavariables>>(
-                cache);
-        Parallel::simple_action<
-            Actions::CleanUpInterpolator<InterpolationTargetTag>>(
-            interpolator_proxy, temporal_id);
+        if constexpr (detail::interpolates_on_elements_v<
+                          Metavariables, InterpolationTargetTag>) {
+          auto& elements_proxy = Parallel::get_parallel_component<
+              typename InterpolationTargetTag::template interpolating_component<
+                  Metavariables>>(cache);
+          Parallel::simple_action<
+              Actions::CleanUpElementVolumeVars<InterpolationTargetTag>>(
+              elements_proxy, temporal_id);
+        } else {
+          auto& interpolator_proxy =
+              Parallel::get_parallel_component<Interpolator<Metavariables>>(
+                  cache);
+          Parallel::simple_action<
+              Actions::CleanUpInterpolator<InterpolationTargetTag>>(
+              interpolator_proxy, temporal_id);
+        }
 
         // If we have a sequential target, and there are further
         // temporal_ids, begin interpolation for the next one.
@@ -75,17 +75,29 @@ struct ReceivePoints {
             const gsl::not_null<typename intrp::Tags::InterpolatedVarsHolders<
                 Metavariables>::type*>
                 vars_holders) {
-          auto& vars_infos =
-              get<intrp::Vars::HolderTag<InterpolationTargetTag,
-                                         Metavariables>>(*vars_holders)
-                  .infos;
+          auto& holder = get<intrp::Vars::HolderTag<InterpolationTargetTag,
+                                                    Metavariables>>(
+              *vars_holders);
+          auto& vars_infos = holder.infos;
+
+          // The interpolants computed for other points can't be reused.
+          if (holder.cached_block_coord_holders != block_logical_coords) {
+            holder.cached_block_coord_holders = block_logical_coords;
+            holder.interpolants.clear();
+            for (auto& id_and_info : vars_infos) {
+              id_and_info.second.uses_cached_interpolants = false;
+            }
+          }
 
           // Add the target interpolation points at this temporal_id.
-          vars_infos.emplace(std::make_pair(
+          const auto [info, inserted] = vars_infos.emplace(std::make_pair(
               temporal_id,
               intrp::Vars::Info<VolumeDim, typename InterpolationTargetTag::
                                                vars_to_interpolate_to_target>{
                   std::move(block_logical_coords)}));
+          if (inserted) {
+            info->second.uses_cached_interpolants = true;
+          }
         },
         make_not_null(&box));
 
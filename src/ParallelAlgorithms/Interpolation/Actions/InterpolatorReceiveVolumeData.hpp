@@ -4,7 +4,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <deque>
+#include <sstream>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -14,8 +16,11 @@
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Printf.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/TryToInterpolate.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataBudget.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -44,6 +49,39 @@ template <typename Metavariables, typename Tag>
 constexpr bool using_interpolator_component_v = std::is_same_v<
     get_interpolating_component_or_interpolator_t<Metavariables, Tag>,
     Interpolator<Metavariables>>;
+
+// Applies the `intrp::VolumeDataBudget` after `new_bytes` of volume data were
+// added to `volume_vars_info`.
+template <typename VolumeVarsInfoType>
+void check_volume_data_budget(const VolumeDataBudget& budget,
+                              const VolumeVarsInfoType& volume_vars_info,
+                              const size_t new_bytes) {
+  if (budget.policy == OverBudgetPolicy::Recompute) {
+    // Applied when the targets compute their variables.
+    return;
+  }
+  const size_t total_bytes = total_buffered_volume_data_bytes(volume_vars_info);
+  if (total_bytes <= budget.max_bytes) {
+    return;
+  }
+  if (budget.policy == OverBudgetPolicy::Warn and
+      total_bytes - new_bytes > budget.max_bytes) {
+    // Only warn when the budget is first exceeded.
+    return;
+  }
+  std::ostringstream message{};
+  message << "The Interpolator buffers " << total_bytes
+          << " bytes of volume data, more than its budget of "
+          << budget.max_bytes << " bytes. Bytes at each temporal id:";
+  for (const auto& [temporal_id, bytes] :
+       buffered_volume_data_bytes(volume_vars_info)) {
+    message << "\n  " << temporal_id << ": " << bytes;
+  }
+  if (budget.policy == OverBudgetPolicy::Error) {
+    ERROR(message.str());
+  }
+  Parallel::printf("Warning: %s\n", message.str());
+}
 }  // namespace detail
 
 /// \ingroup ActionsGroup
@@ -52,6 +90,9 @@ constexpr bool using_interpolator_component_v = std::is_same_v<
 /// Attempts to interpolate if it already has received target points from
 /// any InterpolationTargets.
 ///
+/// If `Tags::VolumeDataBudget` is in the global cache, the
+/// `intrp::VolumeDataBudget` is applied to the buffered volume data.
+///
 /// Uses:
 /// - DataBox:
 ///   - `Tags::NumberOfElements`
@@ -120,6 +161,7 @@ struct InterpolatorReceiveVolumeData {
     // for this_temporal_id_is_done and the interpolation below are
     // done only for this TemporalId type and not for any other
     // VolumeVarsInfos that might be in the DataBox.)
+    const size_t new_bytes = interpolator_source_vars.size() * sizeof(double);
     db::mutate<Tags::VolumeVarsInfo<Metavariables, TemporalId>>(
         [&temporal_id, &element_id, &mesh, &interpolator_source_vars](
             const gsl::not_null<
@@ -140,15 +182,22 @@ struct InterpolatorReceiveVolumeData {
                       mesh, std::move(interpolator_source_vars), {}}));
         },
         make_not_null(&box));
+    if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                               Tags::VolumeDataBudget>) {
+      detail::check_volume_data_budget(
+          Parallel::get<Tags::VolumeDataBudget>(cache),
+          db::get<Tags::VolumeVarsInfo<Metavariables, TemporalId>>(box),
+          new_bytes);
+    }
 
     // Try to interpolate data for all InterpolationTargets for this
-    // temporal_id.
+    // temporal_id.  Only the data of this element is new.
     tmpl::for_each<typename Metavariables::interpolation_target_tags>(
-        [&box, &cache, &temporal_id](auto tag_v) {
+        [&box, &cache, &element_id, &temporal_id](auto tag_v) {
           using tag = typename decltype(tag_v)::type;
           if constexpr (std::is_same_v<typename tag::temporal_id, TemporalId>) {
             try_to_interpolate<tag>(make_not_null(&box), make_not_null(&cache),
-                                    temporal_id);
+                                    temporal_id, element_id);
           }
         });
   }
@@ -8,6 +8,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolateOnElement.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -18,6 +19,10 @@ namespace Actions {
 /// \brief Sets up points on an `InterpolationTarget` at a new `temporal_id`
 /// and sends these points to an `Interpolator`.
 ///
+/// If the `InterpolationTargetTag` is sequential and has an
+/// `interpolating_component`, the points are instead sent to all the
+/// `Element`s of that component, which interpolate to them themselves.
+///
 /// Uses:
 /// - DataBox:
 ///   - `domain::Tags::Domain<3>`
@@ -43,10 +48,20 @@ struct SendPointsToInterpolator {
         InterpolationTargetTag>(box, cache, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
         make_not_null(&box), temporal_id, coords);
-    auto& receiver_proxy =
-        Parallel::get_parallel_component<Interpolator<Metavariables>>(cache);
-    Parallel::simple_action<Actions::ReceivePoints<InterpolationTargetTag>>(
-        receiver_proxy, temporal_id, std::move(coords));
+    if constexpr (detail::interpolates_on_elements_v<Metavariables,
+                                                     InterpolationTargetTag>) {
+      auto& receiver_proxy = Parallel::get_parallel_component<
+          typename InterpolationTargetTag::template interpolating_component<
+              Metavariables>>(cache);
+      Parallel::simple_action<
+          Actions::ElementReceiveTargetPoints<InterpolationTargetTag>>(
+          receiver_proxy, temporal_id, std::move(coords));
+    } else {
+      auto& receiver_proxy =
+          Parallel::get_parallel_component<Interpolator<Metavariables>>(cache);
+      Parallel::simple_action<Actions::ReceivePoints<InterpolationTargetTag>>(
+          receiver_proxy, temporal_id, std::move(coords));
+    }
   }
 };
 
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -13,8 +17,10 @@
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataBudget.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -35,19 +41,24 @@ namespace intrp {
 namespace interpolator_detail {
 
 // Interpolates data onto a set of points desired by an InterpolationTarget.
+// If `new_element_id` is given, only the volume data of that element is
+// considered, because the data of all other elements has already been
+// interpolated for the target.
 template <typename InterpolationTargetTag, typename Metavariables,
           typename DbTags>
 void interpolate_data(
     const gsl::not_null<db::DataBox<DbTags>*> box,
     Parallel::GlobalCache<Metavariables>& cache,
-    const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
+    const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+    const std::optional<ElementId<Metavariables::volume_dim>>&
+        new_element_id) {
   db::mutate_apply<
       tmpl::list<
           ::intrp::Tags::InterpolatedVarsHolders<Metavariables>,
           ::intrp::Tags::VolumeVarsInfo<
               Metavariables, typename InterpolationTargetTag::temporal_id>>,
       tmpl::list<domain::Tags::Domain<Metavariables::volume_dim>>>(
-      [&cache, &temporal_id](
+      [&cache, &temporal_id, &new_element_id](
           const gsl::not_null<typename ::intrp::Tags::InterpolatedVarsHolders<
               Metavariables>::type*>
               holders,
@@ -56,14 +67,37 @@ void interpolate_data(
               typename InterpolationTargetTag::temporal_id>::type*>
               volume_vars_info,
           const Domain<Metavariables::volume_dim>& domain) {
-        auto& interp_info =
+        auto& holder =
             get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-                *holders)
-                .infos.at(temporal_id);
+                *holders);
+        auto& interp_info = holder.infos.at(temporal_id);
+        // Reuse the interpolants of earlier observations if the target
+        // points are the same.
+        std::unordered_map<ElementId<Metavariables::volume_dim>,
+                           Vars::ElementInterpolant<Metavariables::volume_dim>>
+            uncached_interpolants{};
+        auto& interpolants = interp_info.uses_cached_interpolants
+                                 ? holder.interpolants
+                                 : uncached_interpolants;
+
+        // While the buffered volume data exceeds a budget with the
+        // Recompute policy, the variables computed for the target are not
+        // kept once they have been interpolated.
+        bool keep_vars_to_interpolate = true;
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, ::intrp::Tags::VolumeDataBudget>) {
+          const auto& budget =
+              Parallel::get<::intrp::Tags::VolumeDataBudget>(cache);
+          keep_vars_to_interpolate =
+              budget.policy != OverBudgetPolicy::Recompute or
+              total_buffered_volume_data_bytes(*volume_vars_info) <=
+                  budget.max_bytes;
+        }
 
         // Avoid compiler warning for unused variable in some 'if
         // constexpr' branches.
         (void)cache;
+        (void)keep_vars_to_interpolate;
 
         for (auto& volume_info_outer : *volume_vars_info) {
           // Are we at the right time?
@@ -74,25 +108,64 @@ void interpolate_data(
           // Get list of ElementIds that have the correct temporal_id and that
           // have not yet been interpolated.
           std::vector<ElementId<Metavariables::volume_dim>> element_ids;
-
-          for (const auto& volume_info_inner : volume_info_outer.second) {
-            // Have we interpolated this element before?
-            if (interp_info.interpolation_is_done_for_these_elements.find(
-                    volume_info_inner.first) ==
-                interp_info.interpolation_is_done_for_these_elements.end()) {
-              interp_info.interpolation_is_done_for_these_elements.emplace(
-                  volume_info_inner.first);
-              element_ids.push_back(volume_info_inner.first);
+          const auto add_if_not_done =
+              [&element_ids, &interp_info](
+                  const ElementId<Metavariables::volume_dim>& element_id) {
+                // Have we interpolated this element before?
+                if (interp_info.interpolation_is_done_for_these_elements
+                        .insert(element_id)
+                        .second) {
+                  element_ids.push_back(element_id);
+                }
+              };
+          if (new_element_id.has_value()) {
+            if (volume_info_outer.second.count(*new_element_id) == 1) {
+              add_if_not_done(*new_element_id);
+            }
+          } else {
+            for (const auto& volume_info_inner : volume_info_outer.second) {
+              add_if_not_done(volume_info_inner.first);
             }
           }
 
-          // Get element logical coordinates.
+          // Get element logical coordinates and set up the interpolants for
+          // the elements that don't have one for their current mesh.
+          std::vector<ElementId<Metavariables::volume_dim>>
+              element_ids_to_set_up{};
+          for (const auto& element_id : element_ids) {
+            const auto interpolant = interpolants.find(element_id);
+            if (interpolant == interpolants.end() or
+                interpolant->second.mesh !=
+                    volume_info_outer.second.at(element_id).mesh) {
+              element_ids_to_set_up.push_back(element_id);
+            }
+          }
           const auto element_coord_holders = element_logical_coordinates(
-              element_ids, interp_info.block_coord_holders);
+              element_ids_to_set_up, interp_info.block_coord_holders);
+          for (const auto& element_id : element_ids_to_set_up) {
+            auto& interpolant = interpolants[element_id];
+            interpolant.mesh = volume_info_outer.second.at(element_id).mesh;
+            const auto element_coord_holder =
+                element_coord_holders.find(element_id);
+            if (element_coord_holder == element_coord_holders.end()) {
+              // No target points are in this element.
+              interpolant.offsets.clear();
+              interpolant.interpolant = {};
+            } else {
+              interpolant.offsets = element_coord_holder->second.offsets;
+              interpolant.interpolant =
+                  intrp::Irregular<Metavariables::volume_dim>(
+                      interpolant.mesh,
+                      element_coord_holder->second.element_logical_coords);
+            }
+          }
 
           // Construct local vars and interpolate.
-          for (const auto& element_coord_pair : element_coord_holders) {
-            const auto& element_id = element_coord_pair.first;
+          for (const auto& element_id : element_ids) {
+            const auto& interpolant = interpolants.at(element_id);
+            if (interpolant.offsets.empty()) {
+              continue;
+            }
             auto& volume_info = volume_info_outer.second.at(element_id);
             auto& vars_to_interpolate =
                 get<::intrp::Tags::VarsToInterpolateToTarget<
@@ -117,9 +190,7 @@ void interpolate_data(
             }
 
             // Now interpolate.
-            const auto& element_coord_holder = element_coord_pair.second;
-            intrp::Irregular<Metavariables::volume_dim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
+            const auto& interpolator = interpolant.interpolant;
             // This first branch is used if compute_vars_to_interpolate exists
             // or if the vars_to_interpolate_to_target is a subset of the
             // interpolator_source_vars.
@@ -134,6 +205,13 @@ void interpolate_data(
                     tmpl::list<>>) {
               interp_info.vars.emplace_back(
                   interpolator.interpolate(vars_to_interpolate));
+              if constexpr (InterpolationTarget_detail::
+                                has_compute_vars_to_interpolate_v<
+                                    InterpolationTargetTag>) {
+                if (not keep_vars_to_interpolate) {
+                  vars_to_interpolate = {};
+                }
+              }
             } else {
               // If compute_vars_to_interpolate does not exist and
               // vars_to_interpolate_to_target isn't a subset of
@@ -143,8 +221,7 @@ void interpolate_data(
               interp_info.vars.emplace_back(interpolator.interpolate(
                   volume_info.source_vars_from_element));
             }
-            interp_info.global_offsets.emplace_back(
-                element_coord_holder.offsets);
+            interp_info.global_offsets.emplace_back(interpolant.offsets);
           }
         }
       },
@@ -154,12 +231,20 @@ void interpolate_data(
 
 /// Check if we have enough information to interpolate.  If so, do the
 /// interpolation and send data to the InterpolationTarget.
+///
+/// When called because the volume data of the element `new_element_id`
+/// arrived, only that element is interpolated: the data of the elements that
+/// arrived earlier was interpolated either when it arrived or when the target
+/// points arrived.  This way each element's volume data is visited once per
+/// target instead of once per element that sends data.
 template <typename InterpolationTargetTag, typename Metavariables,
           typename DbTags>
 void try_to_interpolate(
     const gsl::not_null<db::DataBox<DbTags>*> box,
     const gsl::not_null<Parallel::GlobalCache<Metavariables>*> cache,
-    const typename InterpolationTargetTag::temporal_id::type& temporal_id) {
+    const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+    const std::optional<ElementId<Metavariables::volume_dim>>& new_element_id =
+        std::nullopt) {
   const auto& holders =
       db::get<Tags::InterpolatedVarsHolders<Metavariables>>(*box);
   const auto& vars_infos =
@@ -173,7 +258,7 @@ void try_to_interpolate(
   }
 
   interpolator_detail::interpolate_data<InterpolationTargetTag, Metavariables>(
-      box, *cache, temporal_id);
+      box, *cache, temporal_id, new_element_id);
 
   // Send interpolated data only if interpolation has been done on all
   // of the local elements.
@@ -197,9 +282,26 @@ void try_to_interpolate(
             const gsl::not_null<
                 typename Tags::InterpolatedVarsHolders<Metavariables>::type*>
                 holders_l) {
-          get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-              *holders_l)
-              .infos.erase(temporal_id);
+          auto& holder =
+              get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+                  *holders_l);
+          // All local elements have sent data, so the cached interpolants
+          // of other elements are from before AMR and can be dropped.
+          const auto& info = holder.infos.at(temporal_id);
+          if (info.uses_cached_interpolants and
+              holder.interpolants.size() >
+                  info.interpolation_is_done_for_these_elements.size()) {
+            for (auto it = holder.interpolants.begin();
+                 it != holder.interpolants.end();) {
+              if (info.interpolation_is_done_for_these_elements.count(
+                      it->first) == 0) {
+                it = holder.interpolants.erase(it);
+              } else {
+                ++it;
+              }
+            }
+          }
+          holder.infos.erase(temporal_id);
         },
         box);
   }
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <pup.h>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
@@ -16,6 +17,8 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/AddTemporalIdsToInterpolationTarget.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolateOnElement.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
 #include "ParallelAlgorithms/Interpolation/Events/GetComputeItemsOnSource.hpp"
 #include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
@@ -51,6 +54,14 @@ class InterpolateWithoutInterpComponent;
 
 /// Does an interpolation onto an InterpolationTargetTag by calling Actions on
 /// the InterpolationTarget component.
+///
+/// A sequential InterpolationTargetTag, e.g., an apparent horizon, sends new
+/// points after each interpolation, so for such a target the `Element` keeps
+/// its volume data in `intrp::Tags::ElementVolumeVars` (which must be added to
+/// its DataBox, e.g., by `intrp::Actions::ElementInitInterpPoints`) until the
+/// target is done at the `temporal_id`.  The `Element` interpolates to every
+/// set of points that the target sends and sends back only the results.  The
+/// InterpolationTargetTag must have an `interpolating_component`.
 template <size_t VolumeDim, typename InterpolationTargetTag,
           typename... SourceVarTags>
 class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
@@ -92,29 +103,99 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       const ElementId<VolumeDim>& array_index,
       const ParallelComponent* const /*meta*/,
       const ObservationValue& /*observation_value*/) const {
-    const auto& block_logical_coords =
-        InterpolationTarget_detail::block_logical_coords<
-            InterpolationTargetTag>(
-            cache,
-            get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(
-                point_infos),
-            temporal_id);
-    const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
-    const auto element_coord_holders =
-        element_logical_coordinates(element_ids, block_logical_coords);
-
-    if (element_coord_holders.count(array_index) == 0) {
-      // There are no target points in this element, so we don't need
-      // to do anything.
-      return;
+    if constexpr (InterpolationTargetTag::compute_target_points::
+                      is_sequential::value) {
+      static_assert(
+          Actions::detail::interpolates_on_elements_v<Metavariables,
+                                                      InterpolationTargetTag>,
+          "A sequential InterpolationTargetTag needs an "
+          "interpolating_component to be used without an Interpolator.");
+      // The points of a sequential target depend on the results of its
+      // previous interpolations, so the element keeps the volume data until
+      // the target sends points to it.  The event cannot modify the DataBox,
+      // so the element sends the volume data to itself.
+      auto& element_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      Parallel::simple_action<
+          Actions::ElementReceiveVolumeVars<InterpolationTargetTag>>(
+          element_proxy[array_index], temporal_id, mesh,
+          vars_to_interpolate(mesh, cache, array_index, temporal_id,
+                              source_vars_input...));
+
+      auto& target = Parallel::get_parallel_component<
+          InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+      Parallel::simple_action<
+          Actions::AddTemporalIdsToInterpolationTarget<InterpolationTargetTag>>(
+          target,
+          std::vector<typename InterpolationTargetTag::temporal_id::type>{
+              temporal_id});
+    } else {
+      const auto& block_logical_coords =
+          InterpolationTarget_detail::block_logical_coords<
+              InterpolationTargetTag>(
+              cache,
+              get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(
+                  point_infos),
+              temporal_id);
+      const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
+      const auto element_coord_holders =
+          element_logical_coordinates(element_ids, block_logical_coords);
+
+      if (element_coord_holders.count(array_index) == 0) {
+        // There are no target points in this element, so we don't need
+        // to do anything.
+        return;
+      }
+
+      // There are points in this element, so interpolate to them and
+      // send the interpolated data to the target.  This is done
+      // in several steps:
+      const auto& element_coord_holder = element_coord_holders.at(array_index);
+
+      // 1. Get the list of variables
+      const auto interp_vars = vars_to_interpolate(
+          mesh, cache, array_index, temporal_id, source_vars_input...);
+
+      // 2. Set up interpolator
+      intrp::Irregular<VolumeDim> interpolator(
+          mesh, element_coord_holder.element_logical_coords);
+
+      // 3. Interpolate and send interpolated data to target
+      auto& receiver_proxy = Parallel::get_parallel_component<
+          InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+      Parallel::simple_action<
+          Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
+          receiver_proxy,
+          std::vector<Variables<
+              typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
+              {interpolator.interpolate(interp_vars)}),
+          block_logical_coords,
+          std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
+          temporal_id);
     }
+  }
 
-    // There are points in this element, so interpolate to them and
-    // send the interpolated data to the target.  This is done
-    // in several steps:
-    const auto& element_coord_holder = element_coord_holders.at(array_index);
+  using is_ready_argument_tags = tmpl::list<>;
 
-    // 1. Get the list of variables
+  template <typename ArrayIndex, typename Component, typename Metavariables>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return true; }
+
+ private:
+  template <typename Metavariables>
+  static Variables<
+      typename InterpolationTargetTag::vars_to_interpolate_to_target>
+  vars_to_interpolate(
+      const Mesh<VolumeDim>& mesh,
+      const Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& array_index,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      const typename SourceVarTags::type&... source_vars_input) {
     Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
         interp_vars(mesh.number_of_grid_points());
 
@@ -168,35 +249,8 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
                                     source_vars_input)...);
     }
-
-    // 2. Set up interpolator
-    intrp::Irregular<VolumeDim> interpolator(
-        mesh, element_coord_holder.element_logical_coords);
-
-    // 3. Interpolate and send interpolated data to target
-    auto& receiver_proxy = Parallel::get_parallel_component<
-        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
-    Parallel::simple_action<
-        Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
-        receiver_proxy,
-        std::vector<Variables<
-            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
-        block_logical_coords,
-        std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
-        temporal_id);
-  }
-
-  using is_ready_argument_tags = tmpl::list<>;
-
-  template <typename ArrayIndex, typename Component, typename Metavariables>
-  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
-                const ArrayIndex& /*array_index*/,
-                const Component* const /*meta*/) const {
-    return true;
+    return interp_vars;
   }
-
-  bool needs_evolved_variables() const override { return true; }
 };
 
 /// \cond
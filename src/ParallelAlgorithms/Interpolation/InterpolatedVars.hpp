@@ -6,8 +6,11 @@
 #include <cstddef>
 #include <deque>
 #include <optional>
+#include <pup.h>
+#include <pup_stl.h>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/IdPair.hpp"
@@ -15,6 +18,9 @@
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
 
 namespace intrp {
 
@@ -59,6 +65,9 @@ struct Info {
   /// already been done for this `Info`.
   std::unordered_set<ElementId<VolumeDim>>
       interpolation_is_done_for_these_elements{};
+  /// Whether `block_coord_holders` are the points for which the
+  /// `Holder::interpolants` were computed, so they can be reused.
+  bool uses_cached_interpolants{false};
 };
 
 template <size_t VolumeDim, typename TagList>
@@ -67,6 +76,31 @@ void pup(PUP::er& p, Info<VolumeDim, TagList>& t) {  // NOLINT
   p | t.vars;
   p | t.global_offsets;
   p | t.interpolation_is_done_for_these_elements;
+  p | t.uses_cached_interpolants;
+}
+
+/// \brief The interpolation from an `Element` onto the target points that
+/// lie in it.
+template <size_t VolumeDim>
+struct ElementInterpolant {
+  /// The `Mesh` of the `Element` that the interpolant was computed for.
+  Mesh<VolumeDim> mesh{};
+  /// The indices of the target points in the `Element`, as in
+  /// `Info::global_offsets`.  Empty if no target points are in the `Element`.
+  std::vector<size_t> offsets{};
+  intrp::Irregular<VolumeDim> interpolant{};
+};
+
+template <size_t VolumeDim>
+void pup(PUP::er& p, ElementInterpolant<VolumeDim>& t) {  // NOLINT
+  p | t.mesh;
+  p | t.offsets;
+  p | t.interpolant;
+}
+
+template <size_t VolumeDim>
+void operator|(PUP::er& p, ElementInterpolant<VolumeDim>& t) {  // NOLINT
+  pup(p, t);
 }
 
 template <size_t VolumeDim, typename TagList>
@@ -89,6 +123,21 @@ struct Holder {
       infos;
   std::deque<typename InterpolationTargetTag::temporal_id::type>
       temporal_ids_when_data_has_been_interpolated;
+  /// The target points that `interpolants` were computed for.
+  ///
+  /// Targets whose points do not change between observations (e.g.,
+  /// time-independent points in a frame whose maps don't change) reuse the
+  /// assignment of points to elements and the interpolation matrices. They
+  /// are recomputed when the points change (e.g., because a map or a function
+  /// of time changed) or when the `Mesh` of an `Element` changes, and are
+  /// dropped for `Element`s that no longer send data (e.g., after AMR).
+  std::vector<std::optional<
+      IdPair<domain::BlockId, tnsr::I<double, Metavariables::volume_dim,
+                                      typename ::Frame::BlockLogical>>>>
+      cached_block_coord_holders{};
+  std::unordered_map<ElementId<Metavariables::volume_dim>,
+                     ElementInterpolant<Metavariables::volume_dim>>
+      interpolants{};
 };
 
 template <typename Metavariables, typename InterpolationTargetTag,
@@ -98,6 +147,8 @@ void pup(PUP::er& p,                                              // NOLINT
              t) {                                                 // NOLINT
   p | t.infos;
   p | t.temporal_ids_when_data_has_been_interpolated;
+  p | t.cached_block_coord_holders;
+  p | t.interpolants;
 }
 
 template <typename Metavariables, typename InterpolationTargetTag,
@@ -108,6 +159,41 @@ void operator|(
   pup(p, t);
 }
 
+/// \brief The volume data and target points that an `Element` holds to
+/// interpolate to a sequential `InterpolationTargetTag` itself, without an
+/// `Interpolator`.
+///
+/// A sequential target (e.g., an apparent horizon) sends new points for the
+/// same `temporal_id` until it is done at that `temporal_id`, so the volume
+/// data is kept until then.  The points may arrive before the volume data,
+/// in which case they are kept until the volume data arrives.
+template <size_t VolumeDim, typename InterpolationTargetTag>
+struct ElementHolder {
+  using TemporalId = typename InterpolationTargetTag::temporal_id::type;
+  using BlockCoords = std::vector<std::optional<IdPair<
+      domain::BlockId, tnsr::I<double, VolumeDim, ::Frame::BlockLogical>>>>;
+  /// The `Mesh` and the variables to interpolate at each `temporal_id`
+  std::unordered_map<
+      TemporalId,
+      std::pair<Mesh<VolumeDim>,
+                Variables<typename InterpolationTargetTag::
+                              vars_to_interpolate_to_target>>>
+      volume_vars{};
+  /// The latest points at each `temporal_id` that have not been interpolated
+  /// to because the volume data has not arrived yet
+  std::unordered_map<TemporalId, BlockCoords> target_points{};
+  /// The latest `temporal_id` at which the target is done.  No volume data
+  /// is kept at it or earlier `temporal_id`s.
+  std::optional<TemporalId> last_completed_temporal_id{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | volume_vars;
+    p | target_points;
+    p | last_completed_temporal_id;
+  }
+};
+
 /// Indexes a particular `Holder` in the `TaggedTuple` that is
 /// accessed from the `Interpolator`'s `DataBox` with tag
 /// `Tags::InterpolatedVarsHolders`.
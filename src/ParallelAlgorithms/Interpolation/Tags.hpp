@@ -16,6 +16,8 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataBudget.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 /// \cond
@@ -53,6 +55,13 @@ struct DumpVolumeDataOnFailure {
       "node it was collected on."};
   using group = Interpolator;
 };
+
+/// Option tag for the bound on the volume data buffered by the Interpolator.
+struct VolumeDataBudget {
+  using type = intrp::VolumeDataBudget;
+  static constexpr Options::String help{type::help};
+  using group = Interpolator;
+};
 }  // namespace OptionTags
 
 /// Tags for items held in the `DataBox` of `InterpolationTarget` or
@@ -68,6 +77,17 @@ struct DumpVolumeDataOnFailure : db::SimpleTag {
   static bool create_from_options(const bool input) { return input; }
 };
 
+/// The bound on the volume data buffered by the Interpolator on each node.
+///
+/// The bound is only enforced if this tag is in the global cache.
+struct VolumeDataBudget : db::SimpleTag {
+  using type = intrp::VolumeDataBudget;
+  using option_tags = tmpl::list<OptionTags::VolumeDataBudget>;
+  static constexpr bool pass_metavariables = false;
+
+  static type create_from_options(const type& input) { return input; }
+};
+
 /// Keeps track of which points have been filled with interpolated data.
 template <typename TemporalId>
 struct IndicesOfFilledInterpPoints : db::SimpleTag {
@@ -139,6 +159,19 @@ struct VolumeVarsInfo : db::SimpleTag {
         db::wrap_tags_in<VarsToInterpolateToTarget,
                          typename Metavariables::interpolation_target_tags>>
         vars_to_interpolate;
+    /// The number of bytes of volume data held.
+    size_t size_in_bytes() const {
+      size_t result = source_vars_from_element.size();
+      tmpl::for_each<
+          db::wrap_tags_in<VarsToInterpolateToTarget,
+                           typename Metavariables::interpolation_target_tags>>(
+          [this, &result](auto tag_v) {
+            using tag = tmpl::type_from<decltype(tag_v)>;
+            result += tuples::get<tag>(vars_to_interpolate).size();
+          });
+      return result * sizeof(double);
+    }
+
     // NOLINTNEXTLINE(google-runtime-references)
     void pup(PUP::er& p) {
       p | mesh;
@@ -170,6 +203,16 @@ struct InterpolatedVarsHolders : db::SimpleTag {
       typename Metavariables::interpolation_target_tags, Metavariables>>;
 };
 
+/// The volume data and target points that an `Element` holds to interpolate
+/// to the sequential `InterpolationTargetTag` itself.
+///
+/// Held by the `Element`s when `InterpolationTargetTag` has an
+/// `interpolating_component`.
+template <typename InterpolationTargetTag, size_t VolumeDim>
+struct ElementVolumeVars : db::SimpleTag {
+  using type = Vars::ElementHolder<VolumeDim, InterpolationTargetTag>;
+};
+
 /// Number of local `Element`s.
 struct NumberOfElements : db::SimpleTag {
   using type = size_t;
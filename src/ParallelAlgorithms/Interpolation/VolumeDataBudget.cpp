@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Interpolation/VolumeDataBudget.hpp"
+
+#include <pup.h>
+#include <string>
+
+#include "Options/Options.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace intrp {
+std::ostream& operator<<(std::ostream& os, const OverBudgetPolicy policy) {
+  switch (policy) {
+    case OverBudgetPolicy::Warn:
+      return os << "Warn";
+    case OverBudgetPolicy::Recompute:
+      return os << "Recompute";
+    case OverBudgetPolicy::Error:
+      return os << "Error";
+    default:
+      ERROR("Unknown OverBudgetPolicy type");
+  }
+}
+
+VolumeDataBudget::VolumeDataBudget(const size_t max_bytes_in,
+                                   const OverBudgetPolicy policy_in)
+    : max_bytes(max_bytes_in), policy(policy_in) {}
+
+void VolumeDataBudget::pup(PUP::er& p) {
+  p | max_bytes;
+  p | policy;
+}
+
+bool operator==(const VolumeDataBudget& lhs, const VolumeDataBudget& rhs) {
+  return lhs.max_bytes == rhs.max_bytes and lhs.policy == rhs.policy;
+}
+
+bool operator!=(const VolumeDataBudget& lhs, const VolumeDataBudget& rhs) {
+  return not(lhs == rhs);
+}
+}  // namespace intrp
+
+template <>
+intrp::OverBudgetPolicy
+Options::create_from_yaml<intrp::OverBudgetPolicy>::create<void>(
+    const Options::Option& options) {
+  const auto policy = options.parse_as<std::string>();
+  if (policy == "Warn") {
+    return intrp::OverBudgetPolicy::Warn;
+  } else if (policy == "Recompute") {
+    return intrp::OverBudgetPolicy::Recompute;
+  } else if (policy == "Error") {
+    return intrp::OverBudgetPolicy::Error;
+  }
+  PARSE_ERROR(options.context(),
+              "OverBudgetPolicy must be 'Warn', 'Recompute', or 'Error'");
+}
@@ -0,0 +1,126 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <ostream>
+
+#include "Options/String.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Options {
+class Option;
+template <typename T>
+struct create_from_yaml;
+}  // namespace Options
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace intrp {
+/*!
+ * \brief What the `Interpolator` does when the volume data it buffers exceeds
+ * its `intrp::VolumeDataBudget`.
+ *
+ * \details
+ * - `Warn`: print a warning when the buffered data first exceeds the budget.
+ * - `Recompute`: while over the budget, do not keep the variables computed
+ *   from the source variables for each target once they have been
+ *   interpolated. They are computed again if a sequential target sends new
+ *   points at the same temporal id, trading time for memory.
+ * - `Error`: abort, listing the buffered bytes at each temporal id.
+ */
+enum class OverBudgetPolicy { Warn, Recompute, Error };
+
+std::ostream& operator<<(std::ostream& os, OverBudgetPolicy policy);
+
+/*!
+ * \brief A bound on the volume data that an `Interpolator` buffers on a node.
+ *
+ * \details The buffered data are the source variables sent by the local
+ * `Element`s and the variables computed from them for each
+ * `InterpolationTarget`, at all the temporal ids that are not yet cleaned up.
+ * The bound applies separately to the data of each type of temporal id. The
+ * data piles up when a target, e.g. a slow horizon find, falls behind the
+ * evolution.
+ *
+ * The budget is opt-in: it is only enforced if `intrp::Tags::VolumeDataBudget`
+ * is in the `const_global_cache_tags` of the metavariables.
+ */
+struct VolumeDataBudget {
+  struct MaxBytes {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Size in bytes of the volume data buffered on a node above which the "
+        "Policy applies."};
+  };
+  struct Policy {
+    using type = OverBudgetPolicy;
+    static constexpr Options::String help = {
+        "What to do when the buffered volume data exceeds MaxBytes: Warn, "
+        "Recompute, or Error."};
+  };
+  using options = tmpl::list<MaxBytes, Policy>;
+  static constexpr Options::String help = {
+      "A bound on the volume data the Interpolator buffers on a node."};
+
+  VolumeDataBudget() = default;
+  VolumeDataBudget(size_t max_bytes_in, OverBudgetPolicy policy_in);
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+  size_t max_bytes{std::numeric_limits<size_t>::max()};
+  OverBudgetPolicy policy{OverBudgetPolicy::Warn};
+};
+
+bool operator==(const VolumeDataBudget& lhs, const VolumeDataBudget& rhs);
+bool operator!=(const VolumeDataBudget& lhs, const VolumeDataBudget& rhs);
+
+/// The number of bytes of volume data buffered at each temporal id in the
+/// `intrp::Tags::VolumeVarsInfo` of an `Interpolator`.
+template <typename VolumeVarsInfoType>
+std::map<typename VolumeVarsInfoType::key_type, size_t>
+buffered_volume_data_bytes(const VolumeVarsInfoType& volume_vars_info) {
+  std::map<typename VolumeVarsInfoType::key_type, size_t> result{};
+  for (const auto& [temporal_id, infos] : volume_vars_info) {
+    size_t& bytes = result[temporal_id];
+    for (const auto& element_and_info : infos) {
+      bytes += element_and_info.second.size_in_bytes();
+    }
+  }
+  return result;
+}
+
+/// The number of bytes of volume data buffered at all temporal ids in the
+/// `intrp::Tags::VolumeVarsInfo` of an `Interpolator`.
+template <typename VolumeVarsInfoType>
+size_t total_buffered_volume_data_bytes(
+    const VolumeVarsInfoType& volume_vars_info) {
+  size_t result = 0;
+  for (const auto& temporal_id_and_infos : volume_vars_info) {
+    for (const auto& element_and_info : temporal_id_and_infos.second) {
+      result += element_and_info.second.size_in_bytes();
+    }
+  }
+  return result;
+}
+}  // namespace intrp
+
+template <>
+struct Options::create_from_yaml<intrp::OverBudgetPolicy> {
+  template <typename Metavariables>
+  static intrp::OverBudgetPolicy create(const Options::Option& options) {
+    return create<void>(options);
+  }
+};
+
+template <>
+intrp::OverBudgetPolicy
+Options::create_from_yaml<intrp::OverBudgetPolicy>::create<void>(
+    const Options::Option& options);
@@ -9,6 +9,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -109,13 +110,24 @@ struct PrepareSolve {
         make_not_null(&box), get<source_tag>(box),
         get<operator_applied_to_fields_tag>(box), get<fields_tag>(box));
 
+    // A nonlinear solver may have set a forcing term for this solve, which is
+    // the same on all elements
+    double forcing_term = 0.;
+    if constexpr (db::tag_is_retrievable_v<
+                      LinearSolver::Tags::ForcingTerm<fields_tag>,
+                      db::DataBox<DbTagsList>>) {
+      forcing_term = get<LinearSolver::Tags::ForcingTerm<fields_tag>>(box);
+    }
+
     auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
         make_not_null(&box));
     Parallel::contribute_to_reduction<InitializeResidualMagnitude<
         FieldsTag, OptionsGroup, ParallelComponent>>(
         Parallel::ReductionData<
-            Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Sqrt<>>>{
-            inner_product(get<operand_tag>(box), get<operand_tag>(box))},
+            Parallel::ReductionDatum<double, funcl::Plus<>, funcl::Sqrt<>>,
+            Parallel::ReductionDatum<double, funcl::AssertEqual<>>>{
+            inner_product(get<operand_tag>(box), get<operand_tag>(box)),
+            forcing_term},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
@@ -290,6 +302,18 @@ struct PrepareStep {
   }
 };
 
+// The local contributions to the inner products of the `operand` with all
+// vectors in the `basis_history`
+template <typename BasisHistory, typename Operand>
+std::vector<double> local_orthogonalizations(const BasisHistory& basis_history,
+                                             const Operand& operand) {
+  std::vector<double> result(basis_history.size());
+  for (size_t i = 0; i < basis_history.size(); ++i) {
+    result[i] = inner_product(basis_history[i], operand);
+  }
+  return result;
+}
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
           typename Label, typename ArraySectionIdTag>
 struct PerformStep {
@@ -373,11 +397,12 @@ struct PerformStep {
         Parallel::ReductionData<
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<double, funcl::Plus<>>>{
+            Parallel::ReductionDatum<std::vector<double>,
+                                     funcl::ElementWise<funcl::Plus<>>>>{
             get<Convergence::Tags::IterationId<OptionsGroup>>(box),
             get<orthogonalization_iteration_id_tag>(box),
-            inner_product(get<basis_history_tag>(box)[0],
-                          get<operand_tag>(box))},
+            local_orthogonalizations(get<basis_history_tag>(box),
+                                     get<operand_tag>(box))},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
@@ -418,30 +443,39 @@ struct OrthogonalizeOperand {
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
 
-    const double orthogonalization =
+    const std::vector<double> orthogonalization =
         std::move(inbox.extract(iteration_id).mapped());
 
+    // Classical Gram-Schmidt: remove the projections on all basis vectors at
+    // once
     db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
-        [orthogonalization](
+        [&orthogonalization](
             const auto operand,
             const gsl::not_null<size_t*> orthogonalization_iteration_id,
             const auto& basis_history) {
-          *operand -= orthogonalization *
-                      gsl::at(basis_history, *orthogonalization_iteration_id);
+          ASSERT(orthogonalization.size() == basis_history.size(),
+                 "Expected " << basis_history.size()
+                             << " orthogonalizations, but received "
+                             << orthogonalization.size() << ".");
+          for (size_t i = 0; i < basis_history.size(); ++i) {
+            *operand -= orthogonalization[i] * basis_history[i];
+          }
           ++(*orthogonalization_iteration_id);
         },
         make_not_null(&box), get<basis_history_tag>(box));
 
-    const auto& next_orthogonalization_iteration_id =
-        get<orthogonalization_iteration_id_tag>(box);
+    // Repeat the orthogonalization once to remove the components that the
+    // roundoff error of the first pass reintroduced, then compute the
+    // magnitude of the new orthogonal vector
     const bool orthogonalization_complete =
-        next_orthogonalization_iteration_id == iteration_id;
-    const double local_orthogonalization =
-        inner_product(orthogonalization_complete
-                          ? get<operand_tag>(box)
-                          : gsl::at(get<basis_history_tag>(box),
-                                    next_orthogonalization_iteration_id),
-                      get<operand_tag>(box));
+        get<orthogonalization_iteration_id_tag>(box) ==
+        orthogonalization_passes;
+    std::vector<double> local_orthogonalization =
+        orthogonalization_complete
+            ? std::vector<double>{inner_product(get<operand_tag>(box),
+                                                get<operand_tag>(box))}
+            : local_orthogonalizations(get<basis_history_tag>(box),
+                                       get<operand_tag>(box));
 
     auto& section = Parallel::get_section<ParallelComponent, ArraySectionIdTag>(
         make_not_null(&box));
@@ -450,9 +484,10 @@ struct OrthogonalizeOperand {
         Parallel::ReductionData<
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
             Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<double, funcl::Plus<>>>{
-            iteration_id, next_orthogonalization_iteration_id,
-            local_orthogonalization},
+            Parallel::ReductionDatum<std::vector<double>,
+                                     funcl::ElementWise<funcl::Plus<>>>>{
+            iteration_id, get<orthogonalization_iteration_id_tag>(box),
+            std::move(local_orthogonalization)},
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
         Parallel::get_parallel_component<
             ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache),
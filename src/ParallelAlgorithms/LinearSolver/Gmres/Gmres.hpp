@@ -56,20 +56,26 @@ namespace LinearSolver::gmres {
  * will converge the field \f$x\f$ towards the solution and update the operand
  * \f$q\f$ in the process. This requires reductions over all elements that are
  * received by a `ResidualMonitor` singleton parallel component, processed, and
- * then broadcast back to all elements. Since the reductions are performed to
- * find a vector that is orthogonal to those used in previous steps, the number
- * of reductions increases linearly with iterations. No restarting mechanism is
- * currently implemented. The actions are implemented in the `gmres::detail`
- * namespace and constitute the full algorithm in the following order:
+ * then broadcast back to all elements. The reductions are performed to find a
+ * vector that is orthogonal to those used in previous steps. The Arnoldi
+ * orthogonalization uses classical Gram-Schmidt with one reorthogonalization
+ * (see `gmres::detail::orthogonalization_passes`), so each reduction computes
+ * the inner products with all previous vectors at once. Therefore, the number
+ * of reductions per iteration is constant, but the size of the reduced data
+ * and the number of inner products increase linearly with iterations. No
+ * restarting mechanism is currently implemented. The actions are implemented
+ * in the `gmres::detail` namespace and constitute the full algorithm in the
+ * following order:
  * 1. `PerformStep` (on elements): Start an Arnoldi orthogonalization by
- * computing the inner product between \f$A(q)\f$ and the first of the
- * previously determined set of orthogonal vectors.
+ * computing the inner products between \f$A(q)\f$ and all of the previously
+ * determined set of orthogonal vectors.
  * 2. `StoreOrthogonalization` (on `ResidualMonitor`): Keep track of the
- * computed inner product in a Hessenberg matrix, then broadcast.
- * 3. `OrthogonalizeOperand` (on elements): Proceed with the Arnoldi
- * orthogonalization by computing inner products and reducing to
- * `StoreOrthogonalization` on the `ResidualMonitor` until the new orthogonal
- * vector is constructed. Then compute its magnitude and reduce.
+ * computed inner products in a Hessenberg matrix, then broadcast.
+ * 3. `OrthogonalizeOperand` (on elements): Subtract the projections on the
+ * orthogonal vectors from the operand. Repeat the inner products and
+ * reduce to `StoreOrthogonalization` on the `ResidualMonitor` once more to
+ * remove the components that were reintroduced by roundoff error. Then
+ * compute the magnitude of the new orthogonal vector and reduce.
  * 4. `StoreOrthogonalization` (on `ResidualMonitor`): Perform a QR
  * decomposition of the Hessenberg matrix to produce a residual vector.
  * Broadcast to `NormalizeOperandAndUpdateField` along with a termination
@@ -89,6 +95,12 @@ namespace LinearSolver::gmres {
  * elements, so all elements in the array may participate in preconditioning
  * (see LinearSolver::multigrid::Multigrid).
  *
+ * \par Inexact solves
+ * If the elements hold a `LinearSolver::Tags::ForcingTerm` for the `FieldsTag`,
+ * e.g. because a `NonlinearSolver::newton_raphson::NewtonRaphson` solver with
+ * an adaptive linear tolerance has set it, the solve also converges when the
+ * residual has decreased by that relative amount.
+ *
  * \see ConjugateGradient for a linear solver that is more efficient when the
  * linear operator \f$A\f$ is symmetric.
  */
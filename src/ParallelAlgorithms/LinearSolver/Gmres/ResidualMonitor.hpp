@@ -73,7 +73,9 @@ struct InitializeResidualMonitor {
 
  public:
   using simple_tags =
-      tmpl::list<initial_residual_magnitude_tag, orthogonalization_history_tag>;
+      tmpl::list<initial_residual_magnitude_tag,
+                 LinearSolver::Tags::ForcingTerm<fields_tag>,
+                 orthogonalization_history_tag>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
@@ -87,8 +89,11 @@ struct InitializeResidualMonitor {
       const ParallelComponent* const /*meta*/) {
     // The `InitializeResidualMagnitude` action populates these tags
     // with initial values
-    Initialization::mutate_assign<tmpl::list<initial_residual_magnitude_tag>>(
-        make_not_null(&box), std::numeric_limits<double>::signaling_NaN());
+    Initialization::mutate_assign<
+        tmpl::list<initial_residual_magnitude_tag,
+                   LinearSolver::Tags::ForcingTerm<fields_tag>>>(
+        make_not_null(&box), std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN());
     return {Parallel::AlgorithmExecution::Pause, std::nullopt};
   }
 };
@@ -4,15 +4,19 @@
 #pragma once
 
 #include <blaze/math/DynamicMatrix.h>
+#include <algorithm>
 #include <blaze/math/DynamicVector.h>
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/Criteria.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -21,6 +25,7 @@
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
@@ -34,6 +39,21 @@ class TaggedTuple;
 
 namespace LinearSolver::gmres::detail {
 
+/// The number of classical Gram-Schmidt passes that orthogonalize the operand
+/// against the Krylov basis in each iteration. Two passes are as accurate as
+/// modified Gram-Schmidt, but need a constant number of reductions per
+/// iteration instead of one per basis vector.
+constexpr size_t orthogonalization_passes = 2;
+
+/// The convergence criteria with the relative residual relaxed to the
+/// `forcing_term`, see `LinearSolver::Tags::ForcingTerm`
+inline Convergence::Criteria relax_criteria(
+    Convergence::Criteria criteria, const double forcing_term) {
+  criteria.relative_residual =
+      std::max(criteria.relative_residual, forcing_term);
+  return criteria;
+}
+
 template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
 struct InitializeResidualMagnitude {
  private:
@@ -51,13 +71,17 @@ struct InitializeResidualMagnitude {
   static void apply(db::DataBox<DbTagsList>& box,
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
-                    const double residual_magnitude) {
+                    const double residual_magnitude,
+                    const double forcing_term) {
     constexpr size_t iteration_id = 0;
 
-    db::mutate<initial_residual_magnitude_tag>(
-        [residual_magnitude](
-            const gsl::not_null<double*> initial_residual_magnitude) {
+    db::mutate<initial_residual_magnitude_tag,
+               LinearSolver::Tags::ForcingTerm<fields_tag>>(
+        [residual_magnitude, forcing_term](
+            const gsl::not_null<double*> initial_residual_magnitude,
+            const gsl::not_null<double*> local_forcing_term) {
           *initial_residual_magnitude = residual_magnitude;
+          *local_forcing_term = forcing_term;
         },
         make_not_null(&box));
 
@@ -67,8 +91,9 @@ struct InitializeResidualMagnitude {
 
     // Determine whether the linear solver has already converged
     Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box), iteration_id,
-        residual_magnitude, residual_magnitude};
+        relax_criteria(get<Convergence::Tags::Criteria<OptionsGroup>>(box),
+                       forcing_term),
+        iteration_id, residual_magnitude, residual_magnitude};
 
     // Do some logging
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
@@ -108,30 +133,37 @@ struct StoreOrthogonalization {
                     const ArrayIndex& /*array_index*/,
                     const size_t iteration_id,
                     const size_t orthogonalization_iteration_id,
-                    const double orthogonalization) {
+                    const std::vector<double>& orthogonalization) {
     if (UNLIKELY(orthogonalization_iteration_id == 0)) {
       // Append a row and a column to the orthogonalization history. Zero the
-      // entries that won't be set during the orthogonalization procedure below.
+      // new entries, since the orthogonalization passes below accumulate into
+      // the new column.
       db::mutate<orthogonalization_history_tag>(
           [iteration_id](const auto orthogonalization_history) {
             orthogonalization_history->resize(iteration_id + 1, iteration_id);
-            for (size_t j = 0; j < orthogonalization_history->columns() - 1;
-                 ++j) {
-              (*orthogonalization_history)(
-                  orthogonalization_history->rows() - 1, j) = 0.;
+            for (size_t j = 0; j < iteration_id; ++j) {
+              (*orthogonalization_history)(iteration_id, j) = 0.;
+              (*orthogonalization_history)(j, iteration_id - 1) = 0.;
             }
           },
           make_not_null(&box));
     }
 
-    // While the orthogonalization procedure is not complete, store the
-    // orthogonalization, broadcast it back to all elements and return early
-    if (orthogonalization_iteration_id < iteration_id) {
+    // While the orthogonalization procedure is not complete, accumulate the
+    // orthogonalizations with all basis vectors, broadcast them back to all
+    // elements and return early
+    if (orthogonalization_iteration_id < orthogonalization_passes) {
+      ASSERT(orthogonalization.size() == iteration_id,
+             "Expected " << iteration_id
+                         << " orthogonalizations, but received "
+                         << orthogonalization.size() << ".");
       db::mutate<orthogonalization_history_tag>(
-          [orthogonalization, iteration_id, orthogonalization_iteration_id](
-              const auto orthogonalization_history) {
-            (*orthogonalization_history)(orthogonalization_iteration_id,
-                                         iteration_id - 1) = orthogonalization;
+          [&orthogonalization,
+           iteration_id](const auto orthogonalization_history) {
+            for (size_t i = 0; i < iteration_id; ++i) {
+              (*orthogonalization_history)(i, iteration_id - 1) +=
+                  orthogonalization[i];
+            }
           },
           make_not_null(&box));
 
@@ -141,13 +173,17 @@ struct StoreOrthogonalization {
       return;
     }
 
-    // At this point, the orthogonalization procedure is complete.
+    // At this point, the orthogonalization procedure is complete and we have
+    // received the squared magnitude of the new orthogonal vector.
+    ASSERT(orthogonalization.size() == 1,
+           "Expected only the magnitude of the orthogonalized operand, but "
+           "received "
+               << orthogonalization.size() << " values.");
+    const double normalization = sqrt(orthogonalization[0]);
     db::mutate<orthogonalization_history_tag>(
-        [orthogonalization, iteration_id,
-         orthogonalization_iteration_id](const auto orthogonalization_history) {
-          (*orthogonalization_history)(orthogonalization_iteration_id,
-                                       iteration_id - 1) =
-              sqrt(orthogonalization);
+        [normalization, iteration_id](const auto orthogonalization_history) {
+          (*orthogonalization_history)(iteration_id, iteration_id - 1) =
+              normalization;
         },
         make_not_null(&box));
 
@@ -155,7 +191,7 @@ struct StoreOrthogonalization {
     // the orthogonalization
     const auto& orthogonalization_history =
         get<orthogonalization_history_tag>(box);
-    const auto num_rows = orthogonalization_iteration_id + 1;
+    const auto num_rows = iteration_id + 1;
     blaze::DynamicMatrix<double> qr_Q;
     blaze::DynamicMatrix<double> qr_R;
     blaze::qr(orthogonalization_history, qr_Q, qr_R);
@@ -177,8 +213,10 @@ struct StoreOrthogonalization {
 
     // Determine whether the linear solver has converged
     Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box), iteration_id,
-        residual_magnitude, get<initial_residual_magnitude_tag>(box)};
+        relax_criteria(get<Convergence::Tags::Criteria<OptionsGroup>>(box),
+                       get<LinearSolver::Tags::ForcingTerm<fields_tag>>(box)),
+        iteration_id, residual_magnitude,
+        get<initial_residual_magnitude_tag>(box)};
 
     // Do some logging
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
@@ -196,7 +234,7 @@ struct StoreOrthogonalization {
 
     Parallel::receive_data<Tags::FinalOrthogonalization<OptionsGroup>>(
         Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        std::make_tuple(sqrt(orthogonalization), std::move(minres),
+        std::make_tuple(normalization, std::move(minres),
                         // NOLINTNEXTLINE(performance-move-const-arg)
                         std::move(has_converged)));
   }
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <map>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/DynamicVector.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
@@ -26,7 +27,7 @@ template <typename OptionsGroup>
 struct Orthogonalization
     : Parallel::InboxInserters::Value<Orthogonalization<OptionsGroup>> {
   using temporal_id = size_t;
-  using type = std::map<temporal_id, double>;
+  using type = std::map<temporal_id, std::vector<double>>;
 };
 
 template <typename OptionsGroup>
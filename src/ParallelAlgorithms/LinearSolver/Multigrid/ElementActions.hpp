@@ -64,6 +64,7 @@ struct InitializeElement {
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<Tags::MaxLevels<OptionsGroup>,
+                 Tags::AgglomerateCoarsestGrid<OptionsGroup>,
                  Tags::OutputVolumeData<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -67,7 +67,12 @@ namespace LinearSolver::multigrid {
  * The elements are distributed on processors using the
  * `domain::BlockZCurveProcDistribution` for every grid independently. An
  * unordered set of `size_t`s can be passed to the `apply` function which
- * represents physical processors to avoid placing elements on.
+ * represents physical processors to avoid placing elements on. If
+ * `LinearSolver::multigrid::Tags::AgglomerateCoarsestGrid` is enabled, the
+ * elements of the coarsest grid are distributed only on the processors of the
+ * first node that has processors to place elements on. This keeps the messages
+ * between elements on the coarsest grid, which has few grid points and is
+ * therefore bound by the latency of these messages, within a single node.
  */
 template <size_t Dim, typename OptionsGroup>
 struct ElementsAllocator
@@ -110,6 +115,8 @@ struct ElementsAllocator
           "valid value. Set the option to '1' to effectively disable "
           "multigrid.");
     }
+    const bool agglomerate_coarsest_grid =
+        get<Tags::AgglomerateCoarsestGrid<OptionsGroup>>(local_cache);
     const size_t num_iterations =
         get<Convergence::Tags::Iterations<OptionsGroup>>(local_cache);
     if (UNLIKELY(num_iterations == 0)) {
@@ -165,8 +172,15 @@ struct ElementsAllocator
               : std::nullopt;
       // Create the elements for this refinement level and distribute them among
       // processors
+      const bool is_coarsest_grid =
+          initial_refinement_levels == parent_refinement_levels;
+      std::unordered_set<size_t> level_procs_to_ignore = procs_to_ignore;
+      if (agglomerate_coarsest_grid and is_coarsest_grid) {
+        level_procs_to_ignore = procs_off_first_usable_node(procs_to_ignore);
+      }
       const size_t num_of_procs_to_use =
-          static_cast<size_t>(sys::number_of_procs()) - procs_to_ignore.size();
+          static_cast<size_t>(sys::number_of_procs()) -
+          level_procs_to_ignore.size();
       const std::unordered_map<ElementId<Dim>, double> element_costs =
           domain::get_element_costs(
               blocks, initial_refinement_levels, initial_extents,
@@ -174,7 +188,7 @@ struct ElementsAllocator
       const domain::BlockZCurveProcDistribution<Dim> element_distribution{
           element_costs,   num_of_procs_to_use,
           blocks,          initial_refinement_levels,
-          initial_extents, procs_to_ignore};
+          initial_extents, level_procs_to_ignore};
       for (const auto& element_id : element_ids) {
         const size_t target_proc =
             element_distribution.get_proc_for_element(element_id);
@@ -190,6 +204,27 @@ struct ElementsAllocator
     } while (initial_refinement_levels != parent_refinement_levels);
     element_array.doneInserting();
   }
+
+ private:
+  // All processors that are either in `procs_to_ignore` or not on the first
+  // node that has a processor that is not in `procs_to_ignore`
+  static std::unordered_set<size_t> procs_off_first_usable_node(
+      const std::unordered_set<size_t>& procs_to_ignore) {
+    std::unordered_set<size_t> result = procs_to_ignore;
+    std::optional<int> usable_node{};
+    for (int proc = 0; proc < sys::number_of_procs(); ++proc) {
+      if (procs_to_ignore.count(static_cast<size_t>(proc)) == 1) {
+        continue;
+      }
+      if (not usable_node.has_value()) {
+        usable_node = sys::node_of(proc);
+      }
+      if (sys::node_of(proc) != *usable_node) {
+        result.insert(static_cast<size_t>(proc));
+      }
+    }
+    return result;
+  }
 };
 
 }  // namespace LinearSolver::multigrid
@@ -72,6 +72,17 @@ struct EnablePostSmoothingAtBottom {
   using group = OptionsGroup;
 };
 
+template <typename OptionsGroup>
+struct AgglomerateCoarsestGrid {
+  using type = bool;
+  static constexpr Options::String help =
+      "Place all elements of the coarsest grid on the processors of a single "
+      "node. The coarsest grid has few grid points, so distributing it over "
+      "many nodes makes its smoothing bound by the latency of the messages "
+      "between its elements.";
+  using group = OptionsGroup;
+};
+
 }  // namespace OptionTags
 
 /// DataBox tags for the `LinearSolver::multigrid::Multigrid` linear solver
@@ -159,6 +170,20 @@ struct EnablePostSmoothingAtBottom : db::SimpleTag {
   }
 };
 
+/// Whether or not to place all elements of the coarsest grid on a single node
+template <typename OptionsGroup>
+struct AgglomerateCoarsestGrid : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::AgglomerateCoarsestGrid<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "AgglomerateCoarsestGrid(" + pretty_type::name<OptionsGroup>() +
+           ")";
+  }
+};
+
 /// The multigrid level. The finest grid is always level 0 and the coarsest grid
 /// has the highest level.
 struct MultigridLevel : db::SimpleTag {
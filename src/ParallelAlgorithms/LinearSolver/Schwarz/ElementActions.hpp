@@ -36,6 +36,7 @@
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/HasReceivedFromAllMortars.hpp"
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
+#include "NumericalAlgorithms/LinearSolver/LuFactorization.hpp"
 #include "NumericalAlgorithms/LinearSolver/Gmres.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -176,6 +177,17 @@ struct SubdomainDataBufferTag : db::SimpleTag {
   using type = SubdomainDataType;
 };
 
+// The solution of the subdomain problem with only the residual on the central
+// element, and the number of iterations the subdomain solver took to find it.
+// Computed while the residuals on overlaps are still being communicated.
+template <typename SubdomainDataType, typename OptionsGroup>
+struct EagerSubdomainSolutionTag : db::SimpleTag {
+  static std::string name() {
+    return "EagerSubdomainSolution(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+  using type = std::optional<std::pair<SubdomainDataType, size_t>>;
+};
+
 // Allow factory-creating any of these serial linear solvers for use as
 // subdomain solver
 template <typename FieldsTag, typename SubdomainOperator,
@@ -186,7 +198,8 @@ template <typename FieldsTag, typename SubdomainOperator,
                                           FieldsTag>::tags_list>>
 using subdomain_solver = LinearSolver::Serial::LinearSolver<tmpl::append<
     tmpl::list<::LinearSolver::Serial::Registrars::Gmres<SubdomainData>,
-               ::LinearSolver::Serial::Registrars::ExplicitInverse>,
+               ::LinearSolver::Serial::Registrars::ExplicitInverse,
+               ::LinearSolver::Serial::Registrars::LuFactorization>,
     SubdomainPreconditioners>>;
 
 template <typename FieldsTag, typename OptionsGroup, typename SubdomainOperator,
@@ -214,7 +227,8 @@ struct InitializeElement {
       tmpl::list<Tags::IntrudingExtents<Dim, OptionsGroup>,
                  Tags::Weight<OptionsGroup>,
                  domain::Tags::Faces<Dim, Tags::Weight<OptionsGroup>>,
-                 SubdomainDataBufferTag<SubdomainData, OptionsGroup>>;
+                 SubdomainDataBufferTag<SubdomainData, OptionsGroup>,
+                 EagerSubdomainSolutionTag<SubdomainData, OptionsGroup>>;
   using compute_tags = tmpl::list<>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ActionList, typename ParallelComponent>
@@ -275,7 +289,7 @@ struct InitializeElement {
     Initialization::mutate_assign<simple_tags>(
         make_not_null(&box), std::move(intruding_extents),
         std::move(element_weight), std::move(intruding_overlap_weights),
-        SubdomainData{num_points});
+        SubdomainData{num_points}, std::nullopt);
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -298,8 +312,15 @@ struct OverlapSolutionInboxTag
 // Wait for the residual data on regions of this element's subdomain that
 // overlap with other elements. Once the residual data is available on all
 // overlaps, solve the restricted problem for this element-centered subdomain.
-// Apply the weighted solution on this element directly and send the solution on
-// overlap regions to the neighbors that they overlap with.
+// Send the solution on overlap regions to the neighbors that they overlap with
+// and apply the weighted solution on this element directly.
+//
+// With `Tags::EagerSubdomainSolves` the subdomain problem is solved with only
+// the residual on this element while the overlap data is still in flight. Once
+// the overlap data has arrived the subdomain problem is solved with only the
+// overlap residuals and the two solutions are added, since the subdomain
+// operator is linear. The structure of the overlap data is taken from the
+// previous iteration, so the first iteration is never solved eagerly.
 template <typename FieldsTag, typename OptionsGroup, typename SubdomainOperator,
           typename ArraySectionIdTag>
 struct SolveSubdomain {
@@ -316,10 +337,13 @@ struct SolveSubdomain {
   using OverlapData = typename SubdomainData::OverlapData;
   using overlap_solution_inbox_tag =
       OverlapSolutionInboxTag<Dim, OptionsGroup, OverlapData>;
+  using eager_solution_tag =
+      EagerSubdomainSolutionTag<SubdomainData, OptionsGroup>;
 
  public:
   using const_global_cache_tags =
       tmpl::list<Tags::MaxOverlap<OptionsGroup>,
+                 Tags::EagerSubdomainSolves<OptionsGroup>,
                  logging::Tags::Verbosity<OptionsGroup>,
                  Tags::ObservePerCoreReductions<OptionsGroup>>;
   using inbox_tags = tmpl::list<overlap_residuals_inbox_tag>;
@@ -342,6 +366,10 @@ struct SolveSubdomain {
     if (LIKELY(has_overlap_data) and
         not dg::has_received_from_all_mortars<overlap_residuals_inbox_tag>(
             iteration_id, element, inboxes)) {
+      if (db::get<Tags::EagerSubdomainSolves<OptionsGroup>>(box) and
+          not db::get<eager_solution_tag>(box).has_value()) {
+        solve_element_residual(make_not_null(&box), element_id, iteration_id);
+      }
       return {Parallel::AlgorithmExecution::Retry, std::nullopt};
     }
 
@@ -353,12 +381,24 @@ struct SolveSubdomain {
     }
 
     // Assemble the subdomain data from the data on the element and the
-    // communicated overlap data
+    // communicated overlap data. If the subdomain problem was already solved
+    // with the residual on the element, only the overlap residuals remain.
+    const bool has_eager_solution =
+        LIKELY(has_overlap_data) and
+        db::get<eager_solution_tag>(box).has_value() and
+        has_same_overlaps(
+            db::get<eager_solution_tag>(box)->first.overlap_data,
+            tuples::get<overlap_residuals_inbox_tag>(inboxes).at(iteration_id));
     db::mutate<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(
-        [&inboxes, &iteration_id, &has_overlap_data](
+        [&inboxes, &iteration_id, &has_overlap_data, &has_eager_solution](
             const gsl::not_null<SubdomainData*> subdomain_data,
             const auto& residual) {
-          subdomain_data->element_data = residual;
+          if (has_eager_solution) {
+            subdomain_data->element_data.initialize(
+                residual.number_of_grid_points(), 0.);
+          } else {
+            subdomain_data->element_data = residual;
+          }
           // Nothing was communicated if the overlaps are empty
           if (LIKELY(has_overlap_data)) {
             subdomain_data->overlap_data =
@@ -384,6 +424,56 @@ struct SolveSubdomain {
         subdomain_operator, subdomain_residual, std::forward_as_tuple(box));
     // Re-naming the solution buffer for the code below
     auto& subdomain_solution = subdomain_solve_initial_guess_in_solution_out;
+    size_t subdomain_solve_num_iterations =
+        subdomain_solve_has_converged.num_iterations();
+    // Add the solution for the residual on the element. The eager solution is
+    // discarded if the overlaps have changed since the previous iteration.
+    if (db::get<eager_solution_tag>(box).has_value()) {
+      db::mutate<eager_solution_tag>(
+          [&subdomain_solution, &subdomain_solve_num_iterations,
+           &has_eager_solution](const auto eager_solution) {
+            if (has_eager_solution) {
+              subdomain_solution += (*eager_solution)->first;
+              subdomain_solve_num_iterations += (*eager_solution)->second;
+            }
+            *eager_solution = std::nullopt;
+          },
+          make_not_null(&box));
+    }
+
+    // Apply weighting
+    if (LIKELY(max_overlap > 0)) {
+      subdomain_solution.element_data *=
+          get(db::get<Tags::Weight<OptionsGroup>>(box));
+    }
+
+    // Send overlap solutions back to the neighbors that they are on. Sending
+    // them before applying the solution on this element lets the neighbors
+    // continue as early as possible.
+    if (LIKELY(max_overlap > 0)) {
+      auto& receiver_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      for (auto& [overlap_id, overlap_solution] :
+           subdomain_solution.overlap_data) {
+        const auto& direction = overlap_id.first;
+        const auto& neighbor_id = overlap_id.second;
+        const auto& orientation =
+            element.neighbors().at(direction).orientation();
+        const auto direction_from_neighbor = orientation(direction.opposite());
+        Parallel::receive_data<overlap_solution_inbox_tag>(
+            receiver_proxy[neighbor_id], iteration_id,
+            std::make_pair(
+                OverlapId<Dim>{direction_from_neighbor, element.id()},
+                std::move(overlap_solution)));
+      }
+    }
+
+    // Apply solution to central element
+    db::mutate<fields_tag>(
+        [&subdomain_solution](const auto fields) {
+          *fields += subdomain_solution.element_data;
+        },
+        make_not_null(&box));
 
     // Do some logging and observing
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
@@ -415,43 +505,64 @@ struct SolveSubdomain {
     if (section_observation_key.has_value()) {
       contribute_to_subdomain_stats_observation<OptionsGroup,
                                                 ParallelComponent>(
-          iteration_id + 1, subdomain_solve_has_converged.num_iterations(),
-          cache, element_id, *section_observation_key,
+          iteration_id + 1, subdomain_solve_num_iterations, cache, element_id,
+          *section_observation_key,
           db::get<Tags::ObservePerCoreReductions<OptionsGroup>>(box));
     }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
 
-    // Apply weighting
-    if (LIKELY(max_overlap > 0)) {
-      subdomain_solution.element_data *=
-          get(db::get<Tags::Weight<OptionsGroup>>(box));
+ private:
+  // Solve the subdomain problem with only the residual on the element. The
+  // overlap data of the previous iteration, if any, provides the structure of
+  // the subdomain data.
+  template <typename DbTagsList>
+  static void solve_element_residual(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      const ElementId<Dim>& element_id, const size_t iteration_id) {
+    const auto& previous_subdomain_data =
+        db::get<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(*box);
+    if (previous_subdomain_data.overlap_data.empty()) {
+      return;
     }
-
-    // Apply solution to central element
-    db::mutate<fields_tag>(
-        [&subdomain_solution](const auto fields) {
-          *fields += subdomain_solution.element_data;
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(*box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Solve subdomain eagerly\n", element_id,
+                       pretty_type::name<OptionsGroup>(), iteration_id);
+    }
+    auto element_residual =
+        make_with_value<SubdomainData>(previous_subdomain_data, 0.);
+    element_residual.element_data = db::get<residual_tag>(*box);
+    auto element_solution =
+        make_with_value<SubdomainData>(previous_subdomain_data, 0.);
+    const SubdomainOperator subdomain_operator{};
+    const auto has_converged =
+        get<Tags::SubdomainSolverBase<OptionsGroup>>(*box).solve(
+            make_not_null(&element_solution), subdomain_operator,
+            element_residual, std::forward_as_tuple(*box));
+    db::mutate<eager_solution_tag>(
+        [&element_solution, &has_converged](const auto eager_solution) {
+          *eager_solution = std::make_pair(std::move(element_solution),
+                                           has_converged.num_iterations());
         },
-        make_not_null(&box));
+        box);
+  }
 
-    // Send overlap solutions back to the neighbors that they are on
-    if (LIKELY(max_overlap > 0)) {
-      auto& receiver_proxy =
-          Parallel::get_parallel_component<ParallelComponent>(cache);
-      for (auto& [overlap_id, overlap_solution] :
-           subdomain_solution.overlap_data) {
-        const auto& direction = overlap_id.first;
-        const auto& neighbor_id = overlap_id.second;
-        const auto& orientation =
-            element.neighbors().at(direction).orientation();
-        const auto direction_from_neighbor = orientation(direction.opposite());
-        Parallel::receive_data<overlap_solution_inbox_tag>(
-            receiver_proxy[neighbor_id], iteration_id,
-            std::make_pair(
-                OverlapId<Dim>{direction_from_neighbor, element.id()},
-                std::move(overlap_solution)));
+  static bool has_same_overlaps(
+      const OverlapMap<Dim, OverlapData>& lhs,
+      const OverlapMap<Dim, OverlapData>& rhs) {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (const auto& [overlap_id, overlap_data] : lhs) {
+      const auto found_overlap = rhs.find(overlap_id);
+      if (found_overlap == rhs.end() or
+          found_overlap->second.number_of_grid_points() !=
+              overlap_data.number_of_grid_points()) {
+        return false;
       }
     }
-    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    return true;
   }
 };
 
@@ -125,6 +125,18 @@ namespace LinearSolver::Schwarz {
  * convergence or parallelization properties (assuming the subdomain solutions
  * it produces are sufficiently precise).
  *
+ * \par Hiding communication latency:
+ * Elements send the subdomain solutions on overlaps to their neighbors before
+ * applying the solution on the element itself. With the `EagerSolves` option
+ * elements also don't wait idly for the residuals on overlaps. They start
+ * solving the subdomain problem with the residual on the element while the
+ * overlap data is in flight, and solve for the overlap residuals once they have
+ * arrived. The two solutions add up to the subdomain solution because the
+ * subdomain operator is linear. This costs a second subdomain solve when the
+ * overlap data arrives late, so it is most useful with subdomain solvers that
+ * solve cheaply once they are set up, such as `ExplicitInverse` and
+ * `LuFactorization`.
+ *
  * \par Weighting:
  * Once the subdomain solutions \f$\delta x_s\f$ have been found they must be
  * combined where they have multiple values, i.e. on overlap regions of the
@@ -54,6 +54,21 @@ struct SkipSubdomainSolverResets {
       "overall is highly problem-dependent.";
 };
 
+template <typename OptionsGroup>
+struct EagerSubdomainSolves {
+  static std::string name() { return "EagerSolves"; }
+  using type = bool;
+  using group = OptionsGroup;
+  static constexpr Options::String help =
+      "Start solving the subdomain problem with the residual on the element "
+      "while the residuals on overlaps with neighbors are still being "
+      "communicated, and add the solution for the overlap residuals once they "
+      "have arrived. This hides communication latency, but solves the "
+      "subdomain problem twice when the overlap data arrives late. It pays off "
+      "mostly for subdomain solvers that solve cheaply once they are set up, "
+      "such as 'ExplicitInverse' and 'LuFactorization'.";
+};
+
 template <typename OptionsGroup>
 struct ObservePerCoreReductions {
   using type = bool;
@@ -113,6 +128,18 @@ struct SkipSubdomainSolverResets : db::SimpleTag {
   static bool create_from_options(const bool value) { return value; }
 };
 
+/// Start subdomain solves before the overlap data has arrived.
+///
+/// \see LinearSolver::Schwarz::OptionTags::EagerSubdomainSolves
+template <typename OptionsGroup>
+struct EagerSubdomainSolves : db::SimpleTag {
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::EagerSubdomainSolves<OptionsGroup>>;
+  static bool create_from_options(const bool value) { return value; }
+};
+
 /// Enable per-core reduction observations
 template <typename OptionsGroup>
 struct ObservePerCoreReductions : db::SimpleTag {
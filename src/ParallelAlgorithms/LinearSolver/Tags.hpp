@@ -172,5 +172,27 @@ struct Preconditioned : db::PrefixTag, db::SimpleTag {
   using tag = Tag;
 };
 
+/*!
+ * \brief A relative residual at which the linear solve for the `Tag` is
+ * considered converged, in addition to its convergence criteria
+ *
+ * \details An inexact Newton method, such as
+ * `NonlinearSolver::newton_raphson::NewtonRaphson` with an adaptive linear
+ * tolerance, sets this "forcing term" in each step to solve the linearized
+ * problem only as accurately as the nonlinear convergence warrants. Linear
+ * solvers that support it, such as `LinearSolver::gmres::Gmres`, read it from
+ * the DataBox of the elements if it is present and relax the relative residual
+ * in their `Convergence::Criteria` to it. A value of zero leaves the criteria
+ * unchanged.
+ */
+template <typename Tag>
+struct ForcingTerm : db::PrefixTag, db::SimpleTag {
+  static std::string name() {
+    return "ForcingTerm(" + db::tag_name<Tag>() + ")";
+  }
+  using type = double;
+  using tag = Tag;
+};
+
 }  // namespace Tags
 }  // namespace LinearSolver
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <limits>
@@ -27,6 +28,7 @@
 #include "Parallel/Tags/Section.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ForcingTerm.hpp"
 #include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ResidualMonitorActions.hpp"
 #include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/Tags/InboxTags.hpp"
 #include "ParallelAlgorithms/NonlinearSolver/Tags.hpp"
@@ -90,7 +92,8 @@ struct InitializeElement {
                  NonlinearSolver::Tags::Globalization<
                      Convergence::Tags::IterationId<OptionsGroup>>,
                  NonlinearSolver::Tags::StepLength<OptionsGroup>,
-                 globalization_fields_tag>;
+                 globalization_fields_tag,
+                 LinearSolver::Tags::ForcingTerm<correction_tag>>;
   using compute_tags = tmpl::list<
       NonlinearSolver::Tags::ResidualCompute<fields_tag, source_tag>>;
 
@@ -107,10 +110,11 @@ struct InitializeElement {
         tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
                    NonlinearSolver::Tags::Globalization<
                        Convergence::Tags::IterationId<OptionsGroup>>,
-                   NonlinearSolver::Tags::StepLength<OptionsGroup>>>(
+                   NonlinearSolver::Tags::StepLength<OptionsGroup>,
+                   LinearSolver::Tags::ForcingTerm<correction_tag>>>(
         make_not_null(&box), std::numeric_limits<size_t>::max(),
         std::numeric_limits<size_t>::max(),
-        std::numeric_limits<double>::signaling_NaN());
+        std::numeric_limits<double>::signaling_NaN(), 0.);
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -209,6 +213,13 @@ struct SendInitialResidualMagnitude {
 template <typename FieldsTag, typename OptionsGroup, typename Label,
           typename ArraySectionIdTag>
 struct ReceiveInitialHasConverged {
+ private:
+  using correction_tag =
+      db::add_tag_prefix<NonlinearSolver::Tags::Correction, FieldsTag>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<NonlinearSolver::Tags::MaxForcingTerm<OptionsGroup>>;
   using inbox_tags = tmpl::list<Tags::GlobalizationResult<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -234,12 +245,19 @@ struct ReceiveInitialHasConverged {
         "No globalization should occur for the initial residual. This is a "
         "bug, so please file an issue.");
     auto& has_converged = get<Convergence::HasConverged>(globalization_result);
-    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
+    // The first linear solve of an inexact Newton method uses the largest
+    // forcing term, see `NonlinearSolver::newton_raphson::next_forcing_term`
+    db::mutate<Convergence::Tags::HasConverged<OptionsGroup>,
+               LinearSolver::Tags::ForcingTerm<correction_tag>>(
         [&has_converged](const gsl::not_null<Convergence::HasConverged*>
-                             local_has_converged) {
+                             local_has_converged,
+                         const gsl::not_null<double*> forcing_term,
+                         const std::optional<double>& max_forcing_term) {
           *local_has_converged = std::move(has_converged);
+          *forcing_term = max_forcing_term.value_or(0.);
         },
-        make_not_null(&box));
+        make_not_null(&box),
+        db::get<NonlinearSolver::Tags::MaxForcingTerm<OptionsGroup>>(box));
 
     // Skip steps entirely if the solve has already converged
     constexpr size_t complete_step_index =
@@ -473,8 +491,15 @@ struct ContributeToResidualMagnitudeReduction {
 template <typename FieldsTag, typename OptionsGroup, typename Label,
           typename ArraySectionIdTag>
 struct Globalize {
+ private:
+  using correction_tag =
+      db::add_tag_prefix<NonlinearSolver::Tags::Correction, FieldsTag>;
+
+ public:
   using const_global_cache_tags =
-      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>,
+                 Convergence::Tags::Criteria<OptionsGroup>,
+                 NonlinearSolver::Tags::MaxForcingTerm<OptionsGroup>>;
   using inbox_tags = tmpl::list<Tags::GlobalizationResult<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -516,6 +541,7 @@ struct Globalize {
         }
         auto& has_converged =
             get<Convergence::HasConverged>(globalization_result);
+        update_forcing_term(make_not_null(&box), has_converged);
 
         db::mutate<Convergence::Tags::HasConverged<OptionsGroup>,
                    Convergence::Tags::IterationId<OptionsGroup>>(
@@ -566,6 +592,7 @@ struct Globalize {
 
     // At this point globalization is complete, so we proceed with the algorithm
     auto& has_converged = get<Convergence::HasConverged>(globalization_result);
+    update_forcing_term(make_not_null(&box), has_converged);
 
     db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
         [&has_converged](const gsl::not_null<Convergence::HasConverged*>
@@ -576,6 +603,38 @@ struct Globalize {
 
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
+
+ private:
+  // Choose the forcing term for the next linear solve of an inexact Newton
+  // method from the decrease of the nonlinear residual in this step. This
+  // happens before the `has_converged` of this step is stored, so the DataBox
+  // still holds the residual magnitude of the previous step.
+  template <typename DbTagsList>
+  static void update_forcing_term(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      const Convergence::HasConverged& has_converged) {
+    const auto& max_forcing_term =
+        db::get<NonlinearSolver::Tags::MaxForcingTerm<OptionsGroup>>(*box);
+    if (not max_forcing_term.has_value()) {
+      return;
+    }
+    const auto& criteria =
+        db::get<Convergence::Tags::Criteria<OptionsGroup>>(*box);
+    const double stopping_residual_magnitude =
+        std::max(criteria.absolute_residual,
+                 criteria.relative_residual *
+                     has_converged.initial_residual_magnitude());
+    db::mutate<LinearSolver::Tags::ForcingTerm<correction_tag>>(
+        [&has_converged, &stopping_residual_magnitude, &max_forcing_term](
+            const gsl::not_null<double*> forcing_term,
+            const Convergence::HasConverged& prev_has_converged) {
+          *forcing_term = next_forcing_term(
+              *forcing_term, has_converged.residual_magnitude(),
+              prev_has_converged.residual_magnitude(),
+              stopping_residual_magnitude, *max_forcing_term);
+        },
+        box, db::get<Convergence::Tags::HasConverged<OptionsGroup>>(*box));
+  }
 };
 
 // Jump back to `PrepareStep` to continue iterating if the algorithm has not yet
@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ForcingTerm.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace NonlinearSolver::newton_raphson {
+
+double next_forcing_term(const double prev_forcing_term,
+                         const double residual_magnitude,
+                         const double prev_residual_magnitude,
+                         const double stopping_residual_magnitude,
+                         const double max_forcing_term) {
+  ASSERT(max_forcing_term > 0. and max_forcing_term < 1.,
+         "The maximum forcing term must be in (0, 1) but is: "
+             << max_forcing_term);
+  if (prev_residual_magnitude == 0.) {
+    return max_forcing_term;
+  }
+  constexpr double gamma = 0.9;
+  constexpr double alpha = 2.;
+  double forcing_term =
+      gamma * pow(residual_magnitude / prev_residual_magnitude, alpha);
+  // Don't let the forcing term decrease too fast
+  const double safeguard = gamma * pow(prev_forcing_term, alpha);
+  if (safeguard > 0.1) {
+    forcing_term = std::max(forcing_term, safeguard);
+  }
+  // Don't oversolve the last steps
+  if (residual_magnitude > 0.) {
+    forcing_term = std::max(
+        forcing_term, 0.5 * stopping_residual_magnitude / residual_magnitude);
+  }
+  return std::min(forcing_term, max_forcing_term);
+}
+
+}  // namespace NonlinearSolver::newton_raphson
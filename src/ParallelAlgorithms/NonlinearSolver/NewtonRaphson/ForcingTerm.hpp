@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+namespace NonlinearSolver::newton_raphson {
+/*!
+ * \brief Find the forcing term for the next linear solve of an inexact Newton
+ * method
+ *
+ * The forcing term \f$\eta_k\f$ is the relative residual to which the
+ * linearized problem in step \f$k\f$ of the Newton-Raphson algorithm is solved.
+ * It is chosen large while the nonlinear residual is far from converged, so
+ * the linear solver doesn't oversolve, and small once the nonlinear solve
+ * converges quickly, so the superlinear convergence of the Newton-Raphson
+ * algorithm is retained. This function implements "Choice 2" of
+ * \cite EisenstatWalker1996 with \f$\gamma=0.9\f$ and \f$\alpha=2\f$,
+ *
+ * \f{equation}
+ * \eta_k = \gamma \left(\frac{|r_k|}{|r_{k-1}|}\right)^\alpha
+ * \text{,}
+ * \f}
+ *
+ * with the safeguards suggested in that paper and in \cite Kelley1995 (Eq.
+ * 6.20): The forcing term decreases no faster than
+ * \f$\gamma\eta_{k-1}^\alpha\f$ unless that is below 0.1, it never exceeds the
+ * `max_forcing_term` \f$\eta_\mathrm{max}\f$, and it never drops below
+ * \f$0.5\,r_\mathrm{stop}/|r_k|\f$ so the last linear solve doesn't reduce the
+ * residual much further than the nonlinear convergence criteria require. This
+ * is how argument names map to symbols:
+ *
+ * - `prev_forcing_term`: \f$\eta_{k-1}\f$
+ * - `residual_magnitude`: \f$|r_k|\f$
+ * - `prev_residual_magnitude`: \f$|r_{k-1}|\f$
+ * - `stopping_residual_magnitude`: \f$r_\mathrm{stop}\f$, the residual
+ *   magnitude at which the nonlinear solve is converged
+ * - `max_forcing_term`: \f$\eta_\mathrm{max}\f$, which is also the forcing term
+ *   \f$\eta_0\f$ for the first step
+ */
+double next_forcing_term(double prev_forcing_term, double residual_magnitude,
+                         double prev_residual_magnitude,
+                         double stopping_residual_magnitude,
+                         double max_forcing_term);
+}  // namespace NonlinearSolver::newton_raphson
@@ -65,6 +65,18 @@ namespace newton_raphson {
  * sophisticated nonlinear preconditioning techniques (see e.g. \cite Brune2015
  * for an overview), are not currently implemented.
  *
+ * \par Inexact Newton steps:
+ * The linearized problems need not be solved exactly, in particular in early
+ * steps where the linearization is a poor model of the nonlinear problem. Set
+ * `NonlinearSolver::OptionTags::MaxForcingTerm` to solve each linearized
+ * problem only to an adaptive relative residual \f$\eta_k\f$ (see
+ * `NonlinearSolver::newton_raphson::next_forcing_term`). The forcing term is
+ * stored on the elements as `LinearSolver::Tags::ForcingTerm` for the
+ * `linear_solver_fields_tag`, where linear solvers such as
+ * `LinearSolver::gmres::Gmres` pick it up. Each linear solver iteration already
+ * applies the linearized operator matrix-free, so the Jacobian is never
+ * assembled or stored.
+ *
  * \par Array sections
  * This nonlinear solver supports running over a subset of the elements in the
  * array parallel component (see `Parallel::Section`). Set the
@@ -7,11 +7,14 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <string>
 
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
+#include "Options/Auto.hpp"
 #include "Options/String.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 
@@ -91,6 +94,32 @@ struct MaxGlobalizationSteps {
   using group = OptionsGroup;
 };
 
+/*!
+ * \brief Solve the linearized problems only as accurately as the nonlinear
+ * convergence warrants
+ *
+ * If enabled, the nonlinear solver is an inexact Newton method: the linear
+ * solver in each step only reduces the residual by the relative amount
+ * \f$\eta_k\leq\eta_\mathrm{max}\f$ (the "forcing term") unless its own
+ * convergence criteria are met first. The forcing term adapts to the nonlinear
+ * convergence as described in
+ * `NonlinearSolver::newton_raphson::next_forcing_term`. Early steps, where the
+ * linearization is a poor model of the nonlinear problem anyway, then take only
+ * a few linear solver iterations. Set the linear solver's own relative residual
+ * criterion to a small value, or zero, so the forcing term controls the linear
+ * solves. A typical value for \f$\eta_\mathrm{max}\f$ is 0.9. Select 'None'
+ * to solve each linearized problem to the linear solver's convergence criteria.
+ */
+template <typename OptionsGroup>
+struct MaxForcingTerm {
+  using type = Options::Auto<double, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "Solve each linearized problem to an adaptive relative residual no "
+      "larger than this value. Must be in (0, 1). Select 'None' to solve to "
+      "the linear solver's convergence criteria."};
+  using group = OptionsGroup;
+};
+
 }  // namespace OptionTags
 
 namespace Tags {
@@ -236,6 +265,30 @@ struct MaxGlobalizationSteps : db::SimpleTag {
   static type create_from_options(const type& option) { return option; }
 };
 
+/*!
+ * \brief The maximum forcing term of an inexact Newton method, or
+ * `std::nullopt` if the linearized problems are solved to the linear solver's
+ * convergence criteria
+ *
+ * \see `NonlinearSolver::OptionTags::MaxForcingTerm`
+ */
+template <typename OptionsGroup>
+struct MaxForcingTerm : db::SimpleTag {
+  static std::string name() {
+    return "MaxForcingTerm(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+  using type = std::optional<double>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::MaxForcingTerm<OptionsGroup>>;
+  static type create_from_options(const type& option) {
+    if (option.has_value() and (*option <= 0. or *option >= 1.)) {
+      ERROR_NO_TRACE("The option 'MaxForcingTerm' must be in (0, 1) but is: "
+                     << *option);
+    }
+    return option;
+  }
+};
+
 /// Prefix indicating the `Tag` is related to the globalization procedure
 template <typename Tag>
 struct Globalization : db::PrefixTag, db::SimpleTag {
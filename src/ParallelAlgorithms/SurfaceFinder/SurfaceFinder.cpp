@@ -3,35 +3,37 @@
 
 #include "ParallelAlgorithms/SurfaceFinder/SurfaceFinder.hpp"
 
-#include <array>
+#include <cmath>
 #include <cstddef>
+#include <optional>
 #include <vector>
 
-#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace SurfaceFinder {
 namespace {
-// Wrapping for the interpolator for Toms748 rootfind.
-struct RayInterpolant {
- public:
-  double operator()(double x) const {
-    std::array<Matrix, 1> interpolation_matrices{
-        Spectral::interpolation_matrix(mesh, x)};
-    return apply_matrices(interpolation_matrices, values, mesh.extents())[0];
+// Evaluates the radial profile of every ray at one point per ray, i.e.
+// `result[i] = sum_k L_k(x[i]) ray_values(i, k)`, where `L_k` are the
+// Lagrange polynomials of the radial mesh.
+void evaluate_rays(const gsl::not_null<DataVector*> result,
+                   const Matrix& ray_values, const Mesh<1>& radial_mesh,
+                   const DataVector& x) {
+  const Matrix radial_interpolation =
+      Spectral::interpolation_matrix(radial_mesh, x);
+  *result = 0.0;
+  for (size_t k = 0; k < ray_values.columns(); ++k) {
+    for (size_t i = 0; i < x.size(); ++i) {
+      (*result)[i] += radial_interpolation(i, k) * ray_values(i, k);
+    }
   }
-
-  const DataVector& values{};
-  const Mesh<1>& mesh{};
-};
+}
 }  // namespace
 
 std::vector<std::optional<double>> find_radial_surface(
@@ -39,46 +41,91 @@ std::vector<std::optional<double>> find_radial_surface(
     const tnsr::I<DataVector, 2, Frame::ElementLogical>& angular_coords,
     const double relative_tolerance, const double absolute_tolerance) {
   const size_t num_rays = angular_coords[0].size();
-  const DataVector subtracted_data = get(data) - target;
-  // The third Matrix in this array is not initialised so it is skipped by
-  // apply_matrices()
-  std::array<Matrix, 3> interpolation_matrices;
   std::vector<std::optional<double>> result(num_rays, std::nullopt);
-  const double ray_size = mesh.extents(2);
-  DataVector interpolated_data(ray_size);
-  const auto xi_mesh = mesh.slice_through(0);
-  const auto eta_mesh = mesh.slice_through(1);
+  if (num_rays == 0) {
+    return result;
+  }
+  const size_t num_xi_points = mesh.extents(0);
+  const size_t num_angular_points = num_xi_points * mesh.extents(1);
+  const size_t ray_size = mesh.extents(2);
+  const auto radial_mesh = mesh.slice_through(2);
 
-  for (size_t i = 0; i < num_rays; i++) {
-    // Potential speed-up: Currently, the interpolation is done one ray at a
-    // time (i.e. the interpolation matrices are built to interpolate to one
-    // ray, and then applied to the data sequentially). Instead one could use
-    // something like irregular interpolant to do this all at once.
-    interpolation_matrices[0] =
-        Spectral::interpolation_matrix(xi_mesh, get<0>(angular_coords)[i]);
-    interpolation_matrices[1] =
-        Spectral::interpolation_matrix(eta_mesh, get<1>(angular_coords)[i]);
+  // Interpolate the data onto all rays at once. The angular interpolation
+  // weights of each ray are the outer product of its xi and eta interpolation
+  // weights, so all rays are interpolated by a single matrix application to
+  // the data, viewed as a (xi-eta) x zeta matrix.
+  const Matrix xi_interpolation = Spectral::interpolation_matrix(
+      mesh.slice_through(0), get<0>(angular_coords));
+  const Matrix eta_interpolation = Spectral::interpolation_matrix(
+      mesh.slice_through(1), get<1>(angular_coords));
+  Matrix angular_interpolation(num_rays, num_angular_points);
+  for (size_t eta_index = 0; eta_index < mesh.extents(1); ++eta_index) {
+    for (size_t xi_index = 0; xi_index < num_xi_points; ++xi_index) {
+      for (size_t i = 0; i < num_rays; ++i) {
+        angular_interpolation(i, xi_index + num_xi_points * eta_index) =
+            xi_interpolation(i, xi_index) * eta_interpolation(i, eta_index);
+      }
+    }
+  }
+  const DataVector subtracted_data = get(data) - target;
+  Matrix ray_values(num_rays, ray_size);
+  dgemm_<true>('N', 'N', num_rays, ray_size, num_angular_points, 1.0,
+               angular_interpolation.data(), angular_interpolation.spacing(),
+               subtracted_data.data(), num_angular_points, 0.0,
+               ray_values.data(), ray_values.spacing());
 
-    // Interpolate data onto the ray.
-    apply_matrices(make_not_null(&interpolated_data), interpolation_matrices,
-                   subtracted_data, mesh.extents());
-    const RayInterpolant data_interpolator{interpolated_data,
-                                           mesh.slice_through(2)};
+  // Find the rays along which the element brackets a root
+  DataVector lower_radial_bounds(num_rays);
+  DataVector upper_radial_bounds(num_rays);
+  if (mesh.quadrature(2) == Spectral::Quadrature::GaussLobatto) {
+    for (size_t i = 0; i < num_rays; ++i) {
+      lower_radial_bounds[i] = ray_values(i, 0);
+      upper_radial_bounds[i] = ray_values(i, ray_size - 1);
+    }
+  } else {
+    evaluate_rays(make_not_null(&lower_radial_bounds), ray_values, radial_mesh,
+                  DataVector(num_rays, -1.));
+    evaluate_rays(make_not_null(&upper_radial_bounds), ray_values, radial_mesh,
+                  DataVector(num_rays, 1.));
+  }
+  std::vector<size_t> bracketed_rays{};
+  bracketed_rays.reserve(num_rays);
+  for (size_t i = 0; i < num_rays; ++i) {
+    if (std::signbit(lower_radial_bounds[i]) !=
+        std::signbit(upper_radial_bounds[i])) {
+      bracketed_rays.push_back(i);
+    }
+  }
+  if (bracketed_rays.empty()) {
+    return result;
+  }
 
-    // Perform root-find only if the element brackets a root.
-    const double lower_radial_bound =
-        mesh.quadrature(2) == Spectral::Quadrature::GaussLobatto
-            ? interpolated_data[0]
-            : data_interpolator(-1.);
-    const double upper_radial_bound =
-        mesh.quadrature(2) == Spectral::Quadrature::GaussLobatto
-            ? interpolated_data[mesh.extents(2) - 1]
-            : data_interpolator(1.);
-    if (std::signbit(lower_radial_bound) != std::signbit(upper_radial_bound)) {
-      result[i] = RootFinder::toms748(data_interpolator, -1., 1.,
-                                      lower_radial_bound, upper_radial_bound,
-                                      relative_tolerance, absolute_tolerance);
+  // Root-find along all bracketed rays in lockstep, so every iteration
+  // evaluates all radial profiles at once
+  const size_t num_bracketed = bracketed_rays.size();
+  Matrix bracketed_ray_values(num_bracketed, ray_size);
+  DataVector f_at_lower_bound(num_bracketed);
+  DataVector f_at_upper_bound(num_bracketed);
+  for (size_t j = 0; j < num_bracketed; ++j) {
+    const size_t i = bracketed_rays[j];
+    for (size_t k = 0; k < ray_size; ++k) {
+      bracketed_ray_values(j, k) = ray_values(i, k);
     }
+    f_at_lower_bound[j] = lower_radial_bounds[i];
+    f_at_upper_bound[j] = upper_radial_bounds[i];
+  }
+  const auto roots = RootFinder::toms748(
+      [&bracketed_ray_values, &radial_mesh](const DataVector& x) {
+        DataVector values(x.size());
+        evaluate_rays(make_not_null(&values), bracketed_ray_values,
+                      radial_mesh, x);
+        return values;
+      },
+      DataVector(num_bracketed, -1.), DataVector(num_bracketed, 1.),
+      f_at_lower_bound, f_at_upper_bound, absolute_tolerance,
+      relative_tolerance);
+  for (size_t j = 0; j < num_bracketed; ++j) {
+    result[bracketed_rays[j]] = roots[j];
   }
   return result;
 }
@@ -27,13 +27,18 @@ namespace SurfaceFinder {
  * than a wedge if necessary by passing in which logical direction points
  * radially.
  *
+ * The data is interpolated onto all rays with a single matrix multiplication,
+ * and the root finds along all rays that bracket a root proceed in lockstep
+ * (see `RootFinder::toms748`), so the cost is dominated by a few vectorized
+ * operations per element rather than by the number of rays.
+ *
  * \param data data to find the contour in.
  * \param target target value for the contour level in the data.
  * \param mesh mesh for the element.
  * \param angular_coords tensor containing the \f$\xi\f$ and \f$\eta\f$
  * values of the rays extending into \f$\zeta\f$ direction.
  * \param relative_tolerance relative tolerance for toms748 rootfind.
- * \param absolute_tolerance relative tolerance for toms748 rootfind.
+ * \param absolute_tolerance absolute tolerance for toms748 rootfind.
  */
 std::vector<std::optional<double>> find_radial_surface(
     const Scalar<DataVector>& data, const double target, const Mesh<3>& mesh,
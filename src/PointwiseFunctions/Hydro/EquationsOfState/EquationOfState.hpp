@@ -13,6 +13,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -259,6 +260,47 @@ class EquationOfState<IsRelativistic, 1> : public PUP::able {
       const Scalar<double>& /*rest_mass_density*/) const = 0;
   virtual Scalar<DataVector> kappa_times_p_over_rho_squared_from_density(
       const Scalar<DataVector>& /*rest_mass_density*/) const = 0;
+  /// @}
+
+  /// @{
+  /*!
+   * Computes the pressure \f$p\f$, the specific internal energy
+   * \f$\epsilon\f$, \f$\chi\f$ and \f$\kappa p/\rho^2\f$ from the rest mass
+   * density \f$\rho\f$ in one call.
+   *
+   * This gives the same result as calling `pressure_from_density`,
+   * `specific_internal_energy_from_density`, `chi_from_density` and
+   * `kappa_times_p_over_rho_squared_from_density`. Equations of state override
+   * it to share the work between the quantities, e.g. the selection of the
+   * polytropic piece.
+   */
+  virtual void thermodynamic_state_from_density(
+      const gsl::not_null<Scalar<double>*> pressure,
+      const gsl::not_null<Scalar<double>*> specific_internal_energy,
+      const gsl::not_null<Scalar<double>*> chi,
+      const gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+      const Scalar<double>& rest_mass_density) const {
+    *pressure = pressure_from_density(rest_mass_density);
+    *specific_internal_energy =
+        specific_internal_energy_from_density(rest_mass_density);
+    *chi = chi_from_density(rest_mass_density);
+    *kappa_times_p_over_rho_squared =
+        kappa_times_p_over_rho_squared_from_density(rest_mass_density);
+  }
+  virtual void thermodynamic_state_from_density(
+      const gsl::not_null<Scalar<DataVector>*> pressure,
+      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      const gsl::not_null<Scalar<DataVector>*> chi,
+      const gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataVector>& rest_mass_density) const {
+    *pressure = pressure_from_density(rest_mass_density);
+    *specific_internal_energy =
+        specific_internal_energy_from_density(rest_mass_density);
+    *chi = chi_from_density(rest_mass_density);
+    *kappa_times_p_over_rho_squared =
+        kappa_times_p_over_rho_squared_from_density(rest_mass_density);
+  }
+  /// @}
 
   /// The lower bound of the electron fraction that is valid for this EOS
   virtual double electron_fraction_lower_bound() const { return 0.0; }
@@ -444,6 +486,48 @@ class EquationOfState<IsRelativistic, 2> : public PUP::able {
       const Scalar<DataVector>& /*specific_internal_energy*/) const = 0;
   /// @}
 
+  /// @{
+  /*!
+   * Computes the pressure \f$p\f$, \f$\chi\f$ and \f$\kappa p/\rho^2\f$
+   * from the rest mass density \f$\rho\f$ and the specific internal energy
+   * \f$\epsilon\f$ in one call.
+   *
+   * This gives the same result as calling `pressure_from_density_and_energy`,
+   * `chi_from_density_and_energy` and
+   * `kappa_times_p_over_rho_squared_from_density_and_energy`. Equations of
+   * state override it to share the work between the quantities, e.g. the
+   * evaluation of a cold part.
+   */
+  virtual void thermodynamic_state_from_density_and_energy(
+      const gsl::not_null<Scalar<double>*> pressure,
+      const gsl::not_null<Scalar<double>*> chi,
+      const gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+      const Scalar<double>& rest_mass_density,
+      const Scalar<double>& specific_internal_energy) const {
+    *pressure = pressure_from_density_and_energy(rest_mass_density,
+                                                 specific_internal_energy);
+    *chi = chi_from_density_and_energy(rest_mass_density,
+                                       specific_internal_energy);
+    *kappa_times_p_over_rho_squared =
+        kappa_times_p_over_rho_squared_from_density_and_energy(
+            rest_mass_density, specific_internal_energy);
+  }
+  virtual void thermodynamic_state_from_density_and_energy(
+      const gsl::not_null<Scalar<DataVector>*> pressure,
+      const gsl::not_null<Scalar<DataVector>*> chi,
+      const gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& specific_internal_energy) const {
+    *pressure = pressure_from_density_and_energy(rest_mass_density,
+                                                 specific_internal_energy);
+    *chi = chi_from_density_and_energy(rest_mass_density,
+                                       specific_internal_energy);
+    *kappa_times_p_over_rho_squared =
+        kappa_times_p_over_rho_squared_from_density_and_energy(
+            rest_mass_density, specific_internal_energy);
+  }
+  /// @}
+
   /// The lower bound of the electron fraction that is valid for this EOS
   virtual double electron_fraction_lower_bound() const { return 0.0; }
 
@@ -606,6 +690,52 @@ class EquationOfState<IsRelativistic, 3> : public PUP::able {
       const Scalar<DataVector>& /*electron_fraction*/) const = 0;
   /// @}
 
+  /// @{
+  /*!
+   * Computes the pressure \f$p\f$, the specific internal energy
+   * \f$\epsilon\f$ and the sound speed squared \f$c_s^2\f$ from the rest
+   * mass density \f$\rho\f$, the temperature \f$T\f$ and the electron
+   * fraction \f$Y_e\f$ in one call.
+   *
+   * This gives the same result as calling
+   * `pressure_from_density_and_temperature`,
+   * `specific_internal_energy_from_density_and_temperature` and
+   * `sound_speed_squared_from_density_and_temperature`. Equations of state
+   * override it to share the work between the quantities, e.g. the table
+   * lookup.
+   */
+  virtual void thermodynamic_state_from_density_and_temperature(
+      const gsl::not_null<Scalar<double>*> pressure,
+      const gsl::not_null<Scalar<double>*> specific_internal_energy,
+      const gsl::not_null<Scalar<double>*> sound_speed_squared,
+      const Scalar<double>& rest_mass_density,
+      const Scalar<double>& temperature,
+      const Scalar<double>& electron_fraction) const {
+    *pressure = pressure_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction);
+    *specific_internal_energy =
+        specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction);
+    *sound_speed_squared = sound_speed_squared_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction);
+  }
+  virtual void thermodynamic_state_from_density_and_temperature(
+      const gsl::not_null<Scalar<DataVector>*> pressure,
+      const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      const gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& temperature,
+      const Scalar<DataVector>& electron_fraction) const {
+    *pressure = pressure_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction);
+    *specific_internal_energy =
+        specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction);
+    *sound_speed_squared = sound_speed_squared_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction);
+  }
+  /// @}
+
   /// The lower bound of the electron fraction that is valid for this EOS
   virtual double electron_fraction_lower_bound() const = 0;
 
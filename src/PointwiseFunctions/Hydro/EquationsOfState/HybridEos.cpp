@@ -11,6 +11,7 @@
 #include "PointwiseFunctions//Hydro/EquationsOfState/Spectral.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace EquationsOfState {
 template <typename ColdEquationOfState>
@@ -172,6 +173,64 @@ Scalar<DataType> HybridEos<ColdEquationOfState>::
            get(cold_eos_.specific_internal_energy_from_density(
                rest_mass_density)))};
 }
+
+template <typename ColdEquationOfState>
+template <class DataType>
+void HybridEos<ColdEquationOfState>::
+    thermodynamic_state_from_density_and_energy_impl(
+        const gsl::not_null<Scalar<DataType>*> pressure,
+        const gsl::not_null<Scalar<DataType>*> chi,
+        const gsl::not_null<Scalar<DataType>*> kappa_times_p_over_rho_squared,
+        const Scalar<DataType>& rest_mass_density,
+        const Scalar<DataType>& specific_internal_energy) const {
+  // The cold quantities are computed into the return buffers, which are then
+  // updated with the thermal contributions. The cold kappa is overwritten.
+  const Scalar<DataType>& cold_pressure = *pressure;
+  Scalar<DataType> cold_specific_internal_energy{};
+  cold_eos_.thermodynamic_state_from_density(
+      pressure, make_not_null(&cold_specific_internal_energy), chi,
+      kappa_times_p_over_rho_squared, rest_mass_density);
+
+  // thermal specific internal energy, reusing the cold energy buffer
+  get(cold_specific_internal_energy) =
+      get(specific_internal_energy) - get(cold_specific_internal_energy);
+  const auto& thermal_specific_internal_energy = cold_specific_internal_energy;
+  const double gamma_th_minus_one = thermal_adiabatic_index_ - 1.0;
+  get(*kappa_times_p_over_rho_squared) =
+      gamma_th_minus_one * get(cold_pressure) / get(rest_mass_density) +
+      square(gamma_th_minus_one) * get(thermal_specific_internal_energy);
+  get(*chi) += gamma_th_minus_one * (get(thermal_specific_internal_energy) -
+                                     get(cold_pressure) /
+                                         get(rest_mass_density));
+  get(*pressure) += get(rest_mass_density) * gamma_th_minus_one *
+                    get(thermal_specific_internal_energy);
+}
+
+template <typename ColdEquationOfState>
+void HybridEos<ColdEquationOfState>::
+    thermodynamic_state_from_density_and_energy(
+        const gsl::not_null<Scalar<double>*> pressure,
+        const gsl::not_null<Scalar<double>*> chi,
+        const gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+        const Scalar<double>& rest_mass_density,
+        const Scalar<double>& specific_internal_energy) const {
+  thermodynamic_state_from_density_and_energy_impl(
+      pressure, chi, kappa_times_p_over_rho_squared, rest_mass_density,
+      specific_internal_energy);
+}
+
+template <typename ColdEquationOfState>
+void HybridEos<ColdEquationOfState>::
+    thermodynamic_state_from_density_and_energy(
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> chi,
+        const gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+        const Scalar<DataVector>& rest_mass_density,
+        const Scalar<DataVector>& specific_internal_energy) const {
+  thermodynamic_state_from_density_and_energy_impl(
+      pressure, chi, kappa_times_p_over_rho_squared, rest_mass_density,
+      specific_internal_energy);
+}
 }  // namespace EquationsOfState
 
 template class EquationsOfState::HybridEos<
@@ -93,6 +93,22 @@ class HybridEos
 
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(HybridEos, 2)
 
+  /// @{
+  /// Evaluates the cold equation of state once per point for all quantities
+  void thermodynamic_state_from_density_and_energy(
+      gsl::not_null<Scalar<double>*> pressure,
+      gsl::not_null<Scalar<double>*> chi,
+      gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+      const Scalar<double>& rest_mass_density,
+      const Scalar<double>& specific_internal_energy) const override;
+  void thermodynamic_state_from_density_and_energy(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> chi,
+      gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& specific_internal_energy) const override;
+  /// @}
+
   WRAPPED_PUPable_decl_base_template(  // NOLINT
       SINGLE_ARG(EquationOfState<is_relativistic, 2>), HybridEos);
 
@@ -144,6 +160,14 @@ class HybridEos
  private:
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBER_IMPLS(2)
 
+  template <class DataType>
+  void thermodynamic_state_from_density_and_energy_impl(
+      gsl::not_null<Scalar<DataType>*> pressure,
+      gsl::not_null<Scalar<DataType>*> chi,
+      gsl::not_null<Scalar<DataType>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataType>& rest_mass_density,
+      const Scalar<DataType>& specific_internal_energy) const;
+
   ColdEquationOfState cold_eos_;
   double thermal_adiabatic_index_ =
       std::numeric_limits<double>::signaling_NaN();
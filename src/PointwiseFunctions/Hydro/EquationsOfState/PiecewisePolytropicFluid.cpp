@@ -8,7 +8,9 @@
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 
@@ -268,6 +270,69 @@ Scalar<DataType> PiecewisePolytropicFluid<IsRelativistic>::
   return make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 }
 
+template <bool IsRelativistic>
+template <class DataType>
+void PiecewisePolytropicFluid<IsRelativistic>::
+    thermodynamic_state_from_density_impl(
+        const gsl::not_null<Scalar<DataType>*> pressure,
+        const gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+        const gsl::not_null<Scalar<DataType>*> chi,
+        const gsl::not_null<Scalar<DataType>*> kappa_times_p_over_rho_squared,
+        const Scalar<DataType>& rest_mass_density) const {
+  set_number_of_grid_points(pressure, rest_mass_density);
+  set_number_of_grid_points(specific_internal_energy, rest_mass_density);
+  set_number_of_grid_points(chi, rest_mass_density);
+  *kappa_times_p_over_rho_squared =
+      make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
+  // Offset of the specific internal energy of the high density piece that
+  // makes it continuous at the transition density
+  const double specific_internal_energy_offset_hi =
+      (polytropic_exponent_hi_ - polytropic_exponent_lo_) /
+      ((polytropic_exponent_hi_ - 1.0) * (polytropic_exponent_lo_ - 1.0)) *
+      polytropic_constant_lo_ *
+      pow(transition_density_, polytropic_exponent_lo_ - 1.0);
+
+  for (size_t i = 0; i < get_size(get(rest_mass_density)); ++i) {
+    const double density = get_element(get(rest_mass_density), i);
+    const bool is_hi = density >= transition_density_;
+    const double polytropic_exponent =
+        is_hi ? polytropic_exponent_hi_ : polytropic_exponent_lo_;
+    // K rho^(Gamma - 1), from which all quantities follow
+    const double k_rho_to_gamma_minus_one =
+        (is_hi ? polytropic_constant_hi_ : polytropic_constant_lo_) *
+        pow(density, polytropic_exponent - 1.0);
+    get_element(get(*pressure), i) = k_rho_to_gamma_minus_one * density;
+    get_element(get(*specific_internal_energy), i) =
+        k_rho_to_gamma_minus_one / (polytropic_exponent - 1.0) +
+        (is_hi ? specific_internal_energy_offset_hi : 0.0);
+    get_element(get(*chi), i) = polytropic_exponent * k_rho_to_gamma_minus_one;
+  }
+}
+
+template <bool IsRelativistic>
+void PiecewisePolytropicFluid<IsRelativistic>::thermodynamic_state_from_density(
+    const gsl::not_null<Scalar<double>*> pressure,
+    const gsl::not_null<Scalar<double>*> specific_internal_energy,
+    const gsl::not_null<Scalar<double>*> chi,
+    const gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+    const Scalar<double>& rest_mass_density) const {
+  thermodynamic_state_from_density_impl(pressure, specific_internal_energy,
+                                        chi, kappa_times_p_over_rho_squared,
+                                        rest_mass_density);
+}
+
+template <bool IsRelativistic>
+void PiecewisePolytropicFluid<IsRelativistic>::thermodynamic_state_from_density(
+    const gsl::not_null<Scalar<DataVector>*> pressure,
+    const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+    const gsl::not_null<Scalar<DataVector>*> chi,
+    const gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+    const Scalar<DataVector>& rest_mass_density) const {
+  thermodynamic_state_from_density_impl(pressure, specific_internal_energy,
+                                        chi, kappa_times_p_over_rho_squared,
+                                        rest_mass_density);
+}
+
 template <bool IsRelativistic>
 double PiecewisePolytropicFluid<IsRelativistic>::rest_mass_density_upper_bound()
     const {
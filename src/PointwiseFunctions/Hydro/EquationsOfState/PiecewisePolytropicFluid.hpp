@@ -132,6 +132,23 @@ class PiecewisePolytropicFluid : public EquationOfState<IsRelativistic, 1> {
 
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(PiecewisePolytropicFluid, 1)
 
+  /// @{
+  /// Selects the polytropic piece and evaluates the power of the density once
+  /// per point for all quantities
+  void thermodynamic_state_from_density(
+      gsl::not_null<Scalar<double>*> pressure,
+      gsl::not_null<Scalar<double>*> specific_internal_energy,
+      gsl::not_null<Scalar<double>*> chi,
+      gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+      const Scalar<double>& rest_mass_density) const override;
+  void thermodynamic_state_from_density(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataVector>*> chi,
+      gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataVector>& rest_mass_density) const override;
+  /// @}
+
   WRAPPED_PUPable_decl_base_template(  // NOLINT
       SINGLE_ARG(EquationOfState<IsRelativistic, 1>), PiecewisePolytropicFluid);
 
@@ -168,6 +185,14 @@ class PiecewisePolytropicFluid : public EquationOfState<IsRelativistic, 1> {
  private:
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBER_IMPLS(1)
 
+  template <class DataType>
+  void thermodynamic_state_from_density_impl(
+      gsl::not_null<Scalar<DataType>*> pressure,
+      gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataType>*> chi,
+      gsl::not_null<Scalar<DataType>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataType>& rest_mass_density) const;
+
   double transition_density_ = std::numeric_limits<double>::signaling_NaN();
   double transition_pressure_ = std::numeric_limits<double>::signaling_NaN();
   double transition_spec_eint_ = std::numeric_limits<double>::signaling_NaN();
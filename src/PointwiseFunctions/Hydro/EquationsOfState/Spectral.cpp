@@ -9,7 +9,10 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace {
 std::vector<double> compute_integral_coefficients(
@@ -180,6 +183,54 @@ Scalar<DataType> Spectral::kappa_times_p_over_rho_squared_from_density_impl(
   return make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 }
 
+template <class DataType>
+void Spectral::thermodynamic_state_from_density_impl(
+    const gsl::not_null<Scalar<DataType>*> pressure,
+    const gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+    const gsl::not_null<Scalar<DataType>*> chi,
+    const gsl::not_null<Scalar<DataType>*> kappa_times_p_over_rho_squared,
+    const Scalar<DataType>& rest_mass_density) const {
+  set_number_of_grid_points(pressure, rest_mass_density);
+  set_number_of_grid_points(specific_internal_energy, rest_mass_density);
+  set_number_of_grid_points(chi, rest_mass_density);
+  *kappa_times_p_over_rho_squared =
+      make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
+  for (size_t i = 0; i < get_size(get(rest_mass_density)); ++i) {
+    const double density = get_element(get(rest_mass_density), i);
+    const double x = log(density / reference_density_);
+    const double pressure_at_x = pressure_from_log_density(x);
+    get_element(get(*pressure), i) = pressure_at_x;
+    get_element(get(*specific_internal_energy), i) =
+        specific_internal_energy_from_log_density(x);
+    get_element(get(*chi), i) =
+        pressure_at_x / density *
+        (x <= 0.0 ? integral_coefficients_[0]
+                  : (x < x_max_ ? gamma(x) : gamma(x_max_)));
+  }
+}
+
+void Spectral::thermodynamic_state_from_density(
+    const gsl::not_null<Scalar<double>*> pressure,
+    const gsl::not_null<Scalar<double>*> specific_internal_energy,
+    const gsl::not_null<Scalar<double>*> chi,
+    const gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+    const Scalar<double>& rest_mass_density) const {
+  thermodynamic_state_from_density_impl(pressure, specific_internal_energy,
+                                        chi, kappa_times_p_over_rho_squared,
+                                        rest_mass_density);
+}
+
+void Spectral::thermodynamic_state_from_density(
+    const gsl::not_null<Scalar<DataVector>*> pressure,
+    const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+    const gsl::not_null<Scalar<DataVector>*> chi,
+    const gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+    const Scalar<DataVector>& rest_mass_density) const {
+  thermodynamic_state_from_density_impl(pressure, specific_internal_energy,
+                                        chi, kappa_times_p_over_rho_squared,
+                                        rest_mass_density);
+}
+
 // this evaluates the power series
 // Gamma(x) = Sum_{n=0}^N gamma_n x^n
 double Spectral::gamma(const double x) const {
@@ -197,7 +248,12 @@ double Spectral::chi_from_density(const double rest_mass_density) const {
 
 double Spectral::specific_internal_energy_from_density(
     const double rest_mass_density) const {
-  const double x = log(rest_mass_density / reference_density_);
+  return specific_internal_energy_from_log_density(
+      log(rest_mass_density / reference_density_));
+}
+
+double Spectral::specific_internal_energy_from_log_density(
+    const double x) const {
   if (x <= 0.) {
     return reference_pressure_ / reference_density_ /
            (gamma_coefficients_[0] - 1.0) *
@@ -107,6 +107,23 @@ class Spectral : public EquationOfState<true, 1> {
 
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(Spectral, 1)
 
+  /// @{
+  /// Evaluates the logarithm of the density and the pressure once per point
+  /// for all quantities
+  void thermodynamic_state_from_density(
+      gsl::not_null<Scalar<double>*> pressure,
+      gsl::not_null<Scalar<double>*> specific_internal_energy,
+      gsl::not_null<Scalar<double>*> chi,
+      gsl::not_null<Scalar<double>*> kappa_times_p_over_rho_squared,
+      const Scalar<double>& rest_mass_density) const override;
+  void thermodynamic_state_from_density(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataVector>*> chi,
+      gsl::not_null<Scalar<DataVector>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataVector>& rest_mass_density) const override;
+  /// @}
+
   std::unique_ptr<EquationOfState<true, 1>> get_clone() const override;
 
   bool operator==(const Spectral& rhs) const;
@@ -151,10 +168,19 @@ class Spectral : public EquationOfState<true, 1> {
  private:
   EQUATION_OF_STATE_FORWARD_DECLARE_MEMBER_IMPLS(1)
 
+  template <class DataType>
+  void thermodynamic_state_from_density_impl(
+      gsl::not_null<Scalar<DataType>*> pressure,
+      gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataType>*> chi,
+      gsl::not_null<Scalar<DataType>*> kappa_times_p_over_rho_squared,
+      const Scalar<DataType>& rest_mass_density) const;
+
   double gamma(const double x) const;
   double integral_of_gamma(const double x) const;
   double chi_from_density(const double density) const;
   double specific_internal_energy_from_density(const double density) const;
+  double specific_internal_energy_from_log_density(const double x) const;
   double specific_enthalpy_from_density(const double density) const;
   double pressure_from_density(const double density) const;
   double pressure_from_log_density(const double x) const;
@@ -4,9 +4,17 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "IO/H5/AccessType.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -14,6 +22,41 @@
 // IWYU pragma: no_forward_declare Tensor
 
 namespace EquationsOfState {
+namespace {
+// Returns the table stored in `subfilename` of `filename`, reading it only if
+// no other EoS in this process currently holds it. Only weak references are
+// kept here, so a table is freed once the last EoS using it is destroyed.
+std::shared_ptr<const detail::Tabulated3DTable> shared_table_from_file(
+    const std::string& filename, const std::string& subfilename,
+    std::shared_ptr<const detail::Tabulated3DTable> (*const read_table)(
+        const h5::EosTable&)) {
+  static std::mutex tables_mutex{};
+  static std::map<std::pair<std::string, std::string>,
+                  std::weak_ptr<const detail::Tabulated3DTable>>
+      tables{};
+
+  // Holding the lock while reading makes other threads wait for the table
+  // instead of reading their own copy.
+  const std::lock_guard lock{tables_mutex};
+  auto& weak_table = tables[std::make_pair(filename, subfilename)];
+  std::shared_ptr<const detail::Tabulated3DTable> table = weak_table.lock();
+  if (table == nullptr) {
+    h5::H5File<h5::AccessType::ReadOnly> eos_file{filename};
+    table = read_table(eos_file.get<h5::EosTable>("/" + subfilename));
+    weak_table = table;
+  }
+  return table;
+}
+}  // namespace
+
+void detail::Tabulated3DTable::pup(PUP::er& p) {
+  p | energy_shift;
+  p | enthalpy_minimum;
+  p | electron_fraction;
+  p | log_density;
+  p | log_temperature;
+  p | data;
+}
 
 EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
                                      Tabulated3D<IsRelativistic>, double, 3)
@@ -90,6 +133,15 @@ Tabulated3D<IsRelativistic>::get_clone() const {
 
 template <bool IsRelativistic>
 void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos) {
+  filename_.clear();
+  subfilename_.clear();
+  table_ = read_table(spectre_eos);
+  initialize_interpolator();
+}
+
+template <bool IsRelativistic>
+std::shared_ptr<const detail::Tabulated3DTable>
+Tabulated3D<IsRelativistic>::read_table(const h5::EosTable& spectre_eos) {
   // STEP 0: Allocate intermediate data structures for initialization
 
   auto setup_index_variable = [&spectre_eos](const std::string& name) {
@@ -197,8 +249,11 @@ void Tabulated3D<IsRelativistic>::initialize(const h5::EosTable& spectre_eos) {
     }
   }
 
-  initialize(electron_fraction, log_density, log_temperature, table_data,
-             energy_shift, enthalpy_minimum);
+  return std::make_shared<const detail::Tabulated3DTable>(
+      detail::Tabulated3DTable{
+          std::move(electron_fraction), std::move(log_density),
+          std::move(log_temperature), std::move(table_data), energy_shift,
+          enthalpy_minimum});
 }
 
 template <bool IsRelativistic>
@@ -206,12 +261,14 @@ void Tabulated3D<IsRelativistic>::initialize(
     std::vector<double> electron_fraction, std::vector<double> log_density,
     std::vector<double> log_temperature, std::vector<double> table_data,
     double energy_shift, double enthalpy_minimum) {
-  energy_shift_ = energy_shift;
-  enthalpy_minimum_ = enthalpy_minimum;
-  table_electron_fraction_ = std::move(electron_fraction);
-  table_log_density_ = std::move(log_density);
-  table_log_temperature_ = std::move(log_temperature);
-  table_data_ = std::move(table_data);
+  filename_.clear();
+  subfilename_.clear();
+  table_ = std::make_shared<const detail::Tabulated3DTable>(
+      detail::Tabulated3DTable{std::move(electron_fraction),
+                               std::move(log_density),
+                               std::move(log_temperature),
+                               std::move(table_data), energy_shift,
+                               enthalpy_minimum});
 
   initialize_interpolator();
 }
@@ -221,23 +278,23 @@ void Tabulated3D<IsRelativistic>::initialize_interpolator() {
   Index<3> num_x_points;
 
   // The order is T, rho, Ye
-  num_x_points[0] = table_log_temperature_.size();
-  num_x_points[1] = table_log_density_.size();
-  num_x_points[2] = table_electron_fraction_.size();
+  num_x_points[0] = table_->log_temperature.size();
+  num_x_points[1] = table_->log_density.size();
+  num_x_points[2] = table_->electron_fraction.size();
 
   std::array<gsl::span<double const>, 3> independent_data_view;
 
   independent_data_view[0] =
-      gsl::span<double const>{table_log_temperature_.data(), num_x_points[0]};
+      gsl::span<double const>{table_->log_temperature.data(), num_x_points[0]};
 
   independent_data_view[1] =
-      gsl::span<double const>{table_log_density_.data(), num_x_points[1]};
+      gsl::span<double const>{table_->log_density.data(), num_x_points[1]};
 
-  independent_data_view[2] =
-      gsl::span<double const>{table_electron_fraction_.data(), num_x_points[2]};
+  independent_data_view[2] = gsl::span<double const>{
+      table_->electron_fraction.data(), num_x_points[2]};
 
   interpolator_ = intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars>(
-      independent_data_view, {table_data_.data(), table_data_.size()},
+      independent_data_view, {table_->data.data(), table_->data.size()},
       num_x_points);
 }
 
@@ -252,13 +309,17 @@ bool Tabulated3D<IsRelativistic>::is_equal(
 template <bool IsRelativistic>
 bool Tabulated3D<IsRelativistic>::operator==(
     const Tabulated3D<IsRelativistic>& rhs) const {
+  if (rhs.table_ == this->table_) {
+    return true;
+  }
   bool result = true;
-  result &= (rhs.enthalpy_minimum_ == this->enthalpy_minimum_);
-  result &= (rhs.energy_shift_ == this->energy_shift_);
-  result &= (rhs.table_electron_fraction_ == this->table_electron_fraction_);
-  result &= (rhs.table_log_density_ == this->table_log_density_);
-  result &= (rhs.table_log_temperature_ == this->table_log_temperature_);
-  result &= (rhs.table_data_ == this->table_data_);
+  result &= (rhs.table_->enthalpy_minimum == this->table_->enthalpy_minimum);
+  result &= (rhs.table_->energy_shift == this->table_->energy_shift);
+  result &=
+      (rhs.table_->electron_fraction == this->table_->electron_fraction);
+  result &= (rhs.table_->log_density == this->table_->log_density);
+  result &= (rhs.table_->log_temperature == this->table_->log_temperature);
+  result &= (rhs.table_->data == this->table_->data);
 
   return result;
 }
@@ -365,15 +426,25 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
 template <bool IsRelativistic>
 void Tabulated3D<IsRelativistic>::pup(PUP::er& p) {
   EquationOfState<IsRelativistic, 3>::pup(p);
-  p | energy_shift_;
-  p | enthalpy_minimum_;
-  p | table_electron_fraction_;
-  p | table_log_density_;
-  p | table_log_temperature_;
-  p | table_data_;
+  p | filename_;
+  p | subfilename_;
+  if (not filename_.empty()) {
+    // Only the location of the table is stored
+    if (p.isUnpacking()) {
+      table_ = shared_table_from_file(filename_, subfilename_, &read_table);
+      initialize_interpolator();
+    }
+    return;
+  }
 
   if (p.isUnpacking()) {
+    auto table = std::make_shared<detail::Tabulated3DTable>();
+    table->pup(p);
+    table_ = std::move(table);
     initialize_interpolator();
+  } else {
+    // Sizing and packing only read the table
+    const_cast<detail::Tabulated3DTable&>(*table_).pup(p);  // NOLINT
   }
 }
 
@@ -420,7 +491,7 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
   }
 
   // Correct for negative eps
-  get(log_specific_internal_energy) -= energy_shift_;
+  get(log_specific_internal_energy) -= table_->energy_shift;
   get(log_specific_internal_energy) = log(get(log_specific_internal_energy));
 
   if constexpr (std::is_same_v<DataType, double>) {
@@ -439,21 +510,21 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
     };
 
     bool need_root_finding = true;
-    double root_from_lambda = table_log_temperature_.front();
-    if (fabs(f(table_log_temperature_.front())) <= 1.0e-14) {
+    double root_from_lambda = table_->log_temperature.front();
+    if (fabs(f(table_->log_temperature.front())) <= 1.0e-14) {
       need_root_finding = false;
     }
 
-    if (fabs(f(upper_bound_tolerance_ * table_log_temperature_.back())) <=
+    if (fabs(f(upper_bound_tolerance_ * table_->log_temperature.back())) <=
         1.0e-14) {
-      root_from_lambda = table_log_temperature_.back();
+      root_from_lambda = table_->log_temperature.back();
       need_root_finding = false;
     }
 
     if (need_root_finding) {
       root_from_lambda = RootFinder::toms748(
-          f, table_log_temperature_.front(),
-          upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
+          f, table_->log_temperature.front(),
+          upper_bound_tolerance_ * table_->log_temperature.back(), 1.0e-14,
           1.0e-15);
     }
 
@@ -477,20 +548,20 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
 
       // Check bounds to avoid error in TOMS748 if bracket is zero
       bool need_root_finding = true;
-      double root_from_lambda = table_log_temperature_.front();
-      if (fabs(f(table_log_temperature_.front())) <= 1.0e-14) {
+      double root_from_lambda = table_->log_temperature.front();
+      if (fabs(f(table_->log_temperature.front())) <= 1.0e-14) {
         need_root_finding = false;
       }
 
-      if (fabs(f(upper_bound_tolerance_ * table_log_temperature_.back())) <=
+      if (fabs(f(upper_bound_tolerance_ * table_->log_temperature.back())) <=
                1.0e-14) {
-        root_from_lambda = table_log_temperature_.back();
+        root_from_lambda = table_->log_temperature.back();
         need_root_finding = false;
       }
       if (need_root_finding) {
         root_from_lambda = RootFinder::toms748(
-            f, table_log_temperature_.front(),
-            upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
+            f, table_->log_temperature.front(),
+            upper_bound_tolerance_ * table_->log_temperature.back(), 1.0e-14,
             1.0e-15);
       }
 
@@ -526,7 +597,7 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     auto interpolated_state =
         interpolator_.template interpolate<Epsilon>(weights);
     get(specific_internal_energy) =
-        std::exp(interpolated_state[0]) + energy_shift_;
+        std::exp(interpolated_state[0]) + table_->energy_shift;
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
     for (size_t s = 0; s < electron_fraction.size(); ++s) {
       auto weights = interpolator_.get_weights(
@@ -535,7 +606,7 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
       auto interpolated_state =
           interpolator_.template interpolate<Epsilon>(weights);
       get(specific_internal_energy)[s] =
-          std::exp(interpolated_state[0]) + energy_shift_;
+          std::exp(interpolated_state[0]) + table_->energy_shift;
     }
   }
 
@@ -583,6 +654,88 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
   return cs2;
 }
 
+template <bool IsRelativistic>
+template <class DataType>
+void Tabulated3D<IsRelativistic>::
+    thermodynamic_state_from_density_and_temperature_impl(
+        const gsl::not_null<Scalar<DataType>*> pressure,
+        const gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+        const gsl::not_null<Scalar<DataType>*> sound_speed_squared,
+        const Scalar<DataType>& rest_mass_density,
+        const Scalar<DataType>& temperature,
+        const Scalar<DataType>& electron_fraction) const {
+  Scalar<DataType> converted_electron_fraction;
+  Scalar<DataType> log_rest_mass_density;
+  Scalar<DataType> log_temperature;
+
+  convert_to_table_quantities(
+      make_not_null(&converted_electron_fraction),
+      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+      electron_fraction, rest_mass_density, temperature);
+
+  // A single set of weights is shared by all interpolated quantities
+  const auto interpolate_state = [this](const double log_T,
+                                        const double log_rho,
+                                        const double ye) {
+    const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
+    return interpolator_.template interpolate<Pressure, Epsilon, CsSquared>(
+        weights);
+  };
+
+  if constexpr (std::is_same_v<DataType, double>) {
+    const auto interpolated_state = interpolate_state(
+        get(log_temperature), get(log_rest_mass_density),
+        get(converted_electron_fraction));
+    get(*pressure) = std::exp(interpolated_state[0]);
+    get(*specific_internal_energy) =
+        std::exp(interpolated_state[1]) + table_->energy_shift;
+    get(*sound_speed_squared) = interpolated_state[2];
+
+  } else if constexpr (std::is_same_v<DataType, DataVector>) {
+    const size_t number_of_points = get(rest_mass_density).size();
+    get(*pressure).destructive_resize(number_of_points);
+    get(*specific_internal_energy).destructive_resize(number_of_points);
+    get(*sound_speed_squared).destructive_resize(number_of_points);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      const auto interpolated_state = interpolate_state(
+          get(log_temperature)[s], get(log_rest_mass_density)[s],
+          get(converted_electron_fraction)[s]);
+      get(*pressure)[s] = std::exp(interpolated_state[0]);
+      get(*specific_internal_energy)[s] =
+          std::exp(interpolated_state[1]) + table_->energy_shift;
+      get(*sound_speed_squared)[s] = interpolated_state[2];
+    }
+  }
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::
+    thermodynamic_state_from_density_and_temperature(
+        const gsl::not_null<Scalar<double>*> pressure,
+        const gsl::not_null<Scalar<double>*> specific_internal_energy,
+        const gsl::not_null<Scalar<double>*> sound_speed_squared,
+        const Scalar<double>& rest_mass_density,
+        const Scalar<double>& temperature,
+        const Scalar<double>& electron_fraction) const {
+  thermodynamic_state_from_density_and_temperature_impl(
+      pressure, specific_internal_energy, sound_speed_squared,
+      rest_mass_density, temperature, electron_fraction);
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::
+    thermodynamic_state_from_density_and_temperature(
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+        const gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+        const Scalar<DataVector>& rest_mass_density,
+        const Scalar<DataVector>& temperature,
+        const Scalar<DataVector>& electron_fraction) const {
+  thermodynamic_state_from_density_and_temperature_impl(
+      pressure, specific_internal_energy, sound_speed_squared,
+      rest_mass_density, temperature, electron_fraction);
+}
+
 template <bool IsRelativistic>
 double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
     const double rest_mass_density, const double electron_fraction) const {
@@ -602,7 +755,7 @@ double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
   auto interpolated_state =
       interpolator_.template interpolate<Epsilon>(weights);
 
-  return exp(interpolated_state[0]) + energy_shift_;
+  return exp(interpolated_state[0]) + table_->energy_shift;
 }
 
 template <bool IsRelativistic>
@@ -624,7 +777,7 @@ double Tabulated3D<IsRelativistic>::specific_internal_energy_upper_bound(
   auto interpolated_state =
       interpolator_.template interpolate<Epsilon>(weights);
 
-  return exp(interpolated_state[0]) + energy_shift_;
+  return exp(interpolated_state[0]) + table_->energy_shift;
 }
 
 template <bool IsRelativistic>
@@ -650,11 +803,11 @@ Tabulated3D<IsRelativistic>::Tabulated3D(const h5::EosTable& spectre_eos) {
 
 template <bool IsRelativistic>
 Tabulated3D<IsRelativistic>::Tabulated3D(const std::string& filename,
-                                         const std::string& subfilename) {
-  h5::H5File<h5::AccessType::ReadOnly> eos_file{filename};
-  const auto& spectre_eos = eos_file.get<h5::EosTable>("/" + subfilename);
-
-  initialize(spectre_eos);
+                                         const std::string& subfilename)
+    : filename_(filename),
+      subfilename_(subfilename),
+      table_(shared_table_from_file(filename, subfilename, &read_table)) {
+  initialize_interpolator();
 }
 
 }  // namespace EquationsOfState
@@ -11,7 +11,10 @@
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/tuple/to_list.hpp>
 #include <limits>
+#include <memory>
 #include <pup.h>
+#include <string>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "IO/H5/EosTable.hpp"
@@ -28,6 +31,28 @@ class DataVector;
 /// \endcond
 
 namespace EquationsOfState {
+namespace detail {
+/// The read-only table data of a `Tabulated3D` equation of state.
+struct Tabulated3DTable {
+  /// Electron fraction
+  std::vector<double> electron_fraction{};
+  /// Logarithmic rest-mass denisty
+  std::vector<double> log_density{};
+  /// Logarithmic temperature
+  std::vector<double> log_temperature{};
+  /// Tabulate data. Entries are stated in the `Tabulated3D` enum
+  std::vector<double> data{};
+  /// Energy shift used to account for negative specific internal energies,
+  /// which are only stored logarithmically
+  double energy_shift = 0.;
+  /// Enthalpy minium  across the table
+  double enthalpy_minimum = 1.;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+}  // namespace detail
+
 /*!
  * \ingroup EquationsOfStateGroup
  * \brief Nuclear matter equation of state in tabulated form.
@@ -41,6 +66,15 @@ namespace EquationsOfState {
  * where \f$\rho\f$ is the rest mass density, \f$T\f$ is the
  * temperature, and \f$Y_e\f$ is the electron fraction.
  * The temperature is given in units of MeV.
+ *
+ * The table is never modified after it has been read, so copies of the EoS
+ * share a single copy of the table. Tables read from a file with the
+ * `TableFilename` and `TableSubFilename` options are additionally shared by
+ * all `Tabulated3D` objects in the process that use the same file, so in an
+ * SMP build the table is held in memory once per process instead of once per
+ * core. Serializing such an EoS stores only the file and subfile names, and
+ * the table is read again (or picked up from another object still using it)
+ * when the EoS is deserialized.
  */
 template <bool IsRelativistic>
 class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
@@ -154,6 +188,37 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
         DataVector>(rest_mass_density, temperature);
   }
   /// @}
+
+  /// @{
+  /*!
+   * Computes the pressure, the specific internal energy and the sound speed
+   * squared from the rest mass density \f$\rho\f$, the temperature \f$T\f$ and
+   * the electron fraction \f$Y_e\f$.
+   *
+   * This gives the same result as calling
+   * `pressure_from_density_and_temperature`,
+   * `specific_internal_energy_from_density_and_temperature` and
+   * `sound_speed_squared_from_density_and_temperature`, but the inputs are
+   * converted to table quantities and the bracketing table cell and the
+   * interpolation weights are computed only once per point for all three
+   * quantities.
+   */
+  void thermodynamic_state_from_density_and_temperature(
+      gsl::not_null<Scalar<double>*> pressure,
+      gsl::not_null<Scalar<double>*> specific_internal_energy,
+      gsl::not_null<Scalar<double>*> sound_speed_squared,
+      const Scalar<double>& rest_mass_density,
+      const Scalar<double>& temperature,
+      const Scalar<double>& electron_fraction) const override;
+
+  void thermodynamic_state_from_density_and_temperature(
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataVector>*> sound_speed_squared,
+      const Scalar<DataVector>& rest_mass_density,
+      const Scalar<DataVector>& temperature,
+      const Scalar<DataVector>& electron_fraction) const override;
+  /// @}
   //
 
   template <typename DataType>
@@ -166,32 +231,32 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
 
   /// The lower bound of the electron fraction that is valid for this EOS
   double electron_fraction_lower_bound() const override {
-    return table_electron_fraction_.front();
+    return table_->electron_fraction.front();
   }
 
   /// The upper bound of the electron fraction that is valid for this EOS
   double electron_fraction_upper_bound() const override {
-    return table_electron_fraction_.back();
+    return table_->electron_fraction.back();
   }
 
   /// The lower bound of the rest mass density that is valid for this EOS
   double rest_mass_density_lower_bound() const override {
-    return std::exp((table_log_density_.front()));
+    return std::exp((table_->log_density.front()));
   }
 
   /// The upper bound of the rest mass density that is valid for this EOS
   double rest_mass_density_upper_bound() const override {
-    return std::exp((table_log_density_.back()));
+    return std::exp((table_->log_density.back()));
   }
 
   /// The lower bound of the temperature that is valid for this EOS
   double temperature_lower_bound() const override {
-    return std::exp((table_log_temperature_.front()));
+    return std::exp((table_->log_temperature.front()));
   }
 
   /// The upper bound of the temperature that is valid for this EOS
   double temperature_upper_bound() const override {
-    return std::exp((table_log_temperature_.back()));
+    return std::exp((table_->log_temperature.back()));
   }
 
   /// The lower bound of the specific internal energy that is valid for this EOS
@@ -208,7 +273,7 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
 
   /// The lower bound of the specific enthalpy that is valid for this EOS
   double specific_enthalpy_lower_bound() const override {
-    return enthalpy_minimum_;
+    return table_->enthalpy_minimum;
   }
 
   /// The baryon mass for this EoS
@@ -221,25 +286,31 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
 
   void initialize_interpolator();
 
-  /// Energy shift used to account for negative specific internal energies,
-  /// which are only stored logarithmically
-  double energy_shift_ = 0.;
+  static std::shared_ptr<const detail::Tabulated3DTable> read_table(
+      const h5::EosTable& spectre_eos);
 
-  /// Enthalpy minium  across the table
-  double enthalpy_minimum_ = 1.;
+  template <class DataType>
+  void thermodynamic_state_from_density_and_temperature_impl(
+      gsl::not_null<Scalar<DataType>*> pressure,
+      gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataType>*> sound_speed_squared,
+      const Scalar<DataType>& rest_mass_density,
+      const Scalar<DataType>& temperature,
+      const Scalar<DataType>& electron_fraction) const;
+
+  /// The file and subfile the table was read from, empty if the table was
+  /// passed in directly.
+  std::string filename_{};
+  std::string subfilename_{};
+
+  /// The table, shared with all copies of this EoS.
+  std::shared_ptr<const detail::Tabulated3DTable> table_ =
+      std::make_shared<const detail::Tabulated3DTable>();
 
   /// Main interpolator for the EoS.
   /// The ordering is  \f$(\log T. \log \rho, Y_e)\f$.
   /// Assumed to be sorted in ascending order.
   intrp::UniformMultiLinearSpanInterpolation<3, NumberOfVars> interpolator_{};
-  /// Electron fraction
-  std::vector<double> table_electron_fraction_{};
-  /// Logarithmic rest-mass denisty
-  std::vector<double> table_log_density_{};
-  /// Logarithmic temperature
-  std::vector<double> table_log_temperature_{};
-  /// Tabulate data. Entries are stated in the enum
-  std::vector<double> table_data_{};
 
   /// Tolerance on upper bound for root finding
   static constexpr double upper_bound_tolerance_ = 0.9999;
@@ -159,18 +159,40 @@ struct ChangeSlabSize {
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
+    const auto slab_number = time_step_id.slab_number();
+    auto& new_slab_size_inbox =
+        tuples::get<ChangeSlabSize_detail::NewSlabSizeInbox>(inboxes);
+    // Discard sizes for changes that were skipped below without
+    // waiting for all their messages.
+    while (not new_slab_size_inbox.empty() and
+           new_slab_size_inbox.begin()->first < slab_number) {
+      new_slab_size_inbox.erase(new_slab_size_inbox.begin());
+    }
+
     auto& message_count_inbox =
         tuples::get<ChangeSlabSize_detail::NumberOfExpectedMessagesInbox>(
             inboxes);
     if (message_count_inbox.empty() or
-        message_count_inbox.begin()->first != time_step_id.slab_number()) {
+        message_count_inbox.begin()->first != slab_number) {
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
-    auto& new_slab_size_inbox =
-        tuples::get<ChangeSlabSize_detail::NewSlabSizeInbox>(inboxes);
+    const TimeStepper& time_stepper = db::get<::Tags::TimeStepper<>>(box);
+
+    // Sometimes time steppers need to run with a fixed step size.
+    // This is generally at the start of an evolution when the history
+    // is in an unusual state.  The change would be ignored, so don't
+    // wait for the (possibly reduced) new sizes to arrive.
+    if (not time_stepper.can_change_step_size(
+            time_step_id, db::get<::Tags::HistoryEvolvedVariables<>>(box))) {
+      message_count_inbox.erase(message_count_inbox.begin());
+      if (not new_slab_size_inbox.empty() and
+          new_slab_size_inbox.begin()->first == slab_number) {
+        new_slab_size_inbox.erase(new_slab_size_inbox.begin());
+      }
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
 
-    const auto slab_number = time_step_id.slab_number();
     const auto number_of_changes = [&slab_number](const auto& inbox) -> size_t {
       if (inbox.empty()) {
         return 0;
@@ -200,16 +222,6 @@ struct ChangeSlabSize {
         *alg::min_element(new_slab_size_inbox.begin()->second);
     new_slab_size_inbox.erase(new_slab_size_inbox.begin());
 
-    const TimeStepper& time_stepper = db::get<::Tags::TimeStepper<>>(box);
-
-    // Sometimes time steppers need to run with a fixed step size.
-    // This is generally at the start of an evolution when the history
-    // is in an unusual state.
-    if (not time_stepper.can_change_step_size(
-            time_step_id, db::get<::Tags::HistoryEvolvedVariables<>>(box))) {
-      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
-    }
-
     const auto& current_step = db::get<::Tags::TimeStep>(box);
     const auto& current_slab = current_step.slab();
 
@@ -260,6 +272,13 @@ namespace Events {
 /// a global synchronization.  The actual change is carried out by
 /// Actions::ChangeSlabSize.
 ///
+/// Only step choosers using element-local data require the reduction.
+/// With a nonzero `DelayChange`, the reduction runs while the
+/// intervening slabs are evolved, and elements only wait for it if it
+/// has not completed when the change is due.  Changes that the time
+/// stepper cannot currently perform, such as during initialization of
+/// a multistep history, are skipped without waiting for the reduction.
+///
 /// When running with global time-stepping, the slab size and step
 /// size are the same, so this adjusts the step size used by the time
 /// integration.  With local time-stepping this controls the interval
@@ -100,6 +100,18 @@ struct TimeStepId;
 /// not be initiated until the self-start values have expired from the
 /// history.  These restrictions on step-size changing are checked in
 /// the TimeStepper::can_change_step_size method.
+///
+/// The iteration at integration order \f$k\f$ takes \f$k\f$ steps, so
+/// starting an order-\f$N\f$ AdamsBashforth integrator takes
+/// \f$N(N-1)/2\f$ steps, each requiring one evaluation of the time
+/// derivative (two for AdamsMoultonPc).  For comparison, seeding the
+/// history with a Runge-Kutta method requires at least one derivative
+/// evaluation at each of the \f$N-1\f$ generated times, in addition to
+/// the stages of the Runge-Kutta steps themselves, while also limiting
+/// the accuracy of the history to that of the Runge-Kutta method.  For
+/// the orders in common use this saves at most a few evaluations, and
+/// it would require the step actions to switch time steppers, so it is
+/// not done.
 namespace SelfStart {
 /// Self-start tags
 namespace Tags {
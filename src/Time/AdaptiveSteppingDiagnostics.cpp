@@ -19,6 +19,8 @@ AdaptiveSteppingDiagnostics& AdaptiveSteppingDiagnostics::operator+=(
   number_of_steps += other.number_of_steps;
   number_of_step_fraction_changes += other.number_of_step_fraction_changes;
   number_of_step_rejections += other.number_of_step_rejections;
+  number_of_substeps += other.number_of_substeps;
+  time_derivative_wall_time += other.time_derivative_wall_time;
   return *this;
 }
 
@@ -28,6 +30,8 @@ void AdaptiveSteppingDiagnostics::pup(PUP::er& p) {
   p | number_of_steps;
   p | number_of_step_fraction_changes;
   p | number_of_step_rejections;
+  p | number_of_substeps;
+  p | time_derivative_wall_time;
 }
 
 bool operator==(const AdaptiveSteppingDiagnostics& a,
@@ -37,7 +41,9 @@ bool operator==(const AdaptiveSteppingDiagnostics& a,
          a.number_of_steps == b.number_of_steps and
          a.number_of_step_fraction_changes ==
              b.number_of_step_fraction_changes and
-         a.number_of_step_rejections == b.number_of_step_rejections;
+         a.number_of_step_rejections == b.number_of_step_rejections and
+         a.number_of_substeps == b.number_of_substeps and
+         a.time_derivative_wall_time == b.time_derivative_wall_time;
 }
 
 bool operator!=(const AdaptiveSteppingDiagnostics& a,
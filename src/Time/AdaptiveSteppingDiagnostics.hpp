@@ -17,6 +17,11 @@ struct AdaptiveSteppingDiagnostics {
   uint64_t number_of_steps = 0;
   uint64_t number_of_step_fraction_changes = 0;
   uint64_t number_of_step_rejections = 0;
+  /// Number of time derivative evaluations, including those for
+  /// rejected steps and self-start.
+  uint64_t number_of_substeps = 0;
+  /// Wall time, in seconds, spent evaluating the time derivative.
+  double time_derivative_wall_time = 0.0;
 
   AdaptiveSteppingDiagnostics& operator+=(
       const AdaptiveSteppingDiagnostics& other);
@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/BoundaryCoefficientCache.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace TimeSteppers {
+namespace {
+bool times_match(const std::vector<double>& cached,
+                 const gsl::span<const double> times) {
+  if (cached.size() != times.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < times.size(); ++i) {
+    if (not equal_within_roundoff(cached[i], times[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+const std::vector<BoundaryCoefficientCache::Term>*
+BoundaryCoefficientCache::find(const gsl::span<const double> local_times,
+                               const gsl::span<const double> remote_times) {
+  for (const auto& entry : entries_) {
+    if (not(times_match(entry.local_times, local_times) and
+            times_match(entry.remote_times, remote_times))) {
+      continue;
+    }
+    bool same_coincidences = true;
+    for (size_t i = 0; i < local_times.size() and same_coincidences; ++i) {
+      for (size_t j = 0; j < remote_times.size(); ++j) {
+        if ((entry.local_times[i] == entry.remote_times[j]) !=
+            (local_times[i] == remote_times[j])) {
+          same_coincidences = false;
+          break;
+        }
+      }
+    }
+    if (same_coincidences) {
+      ++hits_;
+      return &entry.terms;
+    }
+  }
+  ++misses_;
+  return nullptr;
+}
+
+void BoundaryCoefficientCache::insert(
+    const gsl::span<const double> local_times,
+    const gsl::span<const double> remote_times, std::vector<Term> terms) {
+  Entry entry{{local_times.begin(), local_times.end()},
+              {remote_times.begin(), remote_times.end()},
+              std::move(terms)};
+  if (entries_.size() < maximum_size) {
+    entries_.push_back(std::move(entry));
+  } else {
+    entries_[next_replaced_] = std::move(entry);
+    next_replaced_ = (next_replaced_ + 1) % maximum_size;
+  }
+}
+
+void BoundaryCoefficientCache::clear() {
+  entries_.clear();
+  next_replaced_ = 0;
+}
+}  // namespace TimeSteppers
@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+namespace TimeSteppers {
+
+/// \ingroup TimeSteppersGroup
+/// Cache of the coefficients of local time-stepping boundary steps.
+///
+/// Local time-stepping evolutions usually settle into a few repeating
+/// patterns of local and remote step sizes.  The coefficients
+/// multiplying the coupling evaluations in an LTS boundary step only
+/// depend on the history times relative to the start of the step, and
+/// are proportional to the step size.  A pattern is therefore described
+/// by the times of the local and remote history entries used in the
+/// step, measured from the start of the step in units of the step
+/// size, and the coefficients are stored in units of the step size.
+///
+/// Patterns match if their times agree to roundoff and the same local
+/// and remote times coincide.  Callers must pass identical values for
+/// coinciding times.  At most `maximum_size` patterns are stored, and
+/// when the cache is full the oldest pattern is replaced.
+class BoundaryCoefficientCache {
+ public:
+  static constexpr size_t maximum_size = 8;
+
+  /// A coupling evaluation contributing to a step.  The indices are
+  /// counted from the first local and remote time of the pattern.
+  struct Term {
+    double coefficient;
+    size_t local_index;
+    size_t remote_index;
+  };
+
+  /// The terms of the step with the passed pattern, or `nullptr` if
+  /// the pattern is not cached.  Counts a hit or a miss.
+  const std::vector<Term>* find(gsl::span<const double> local_times,
+                                gsl::span<const double> remote_times);
+
+  /// Store the terms of the step with the passed pattern.
+  void insert(gsl::span<const double> local_times,
+              gsl::span<const double> remote_times, std::vector<Term> terms);
+
+  /// Remove all patterns.  Does not reset the hit and miss counts.
+  void clear();
+
+  size_t size() const { return entries_.size(); }
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+ private:
+  struct Entry {
+    std::vector<double> local_times;
+    std::vector<double> remote_times;
+    std::vector<Term> terms;
+  };
+
+  std::vector<Entry> entries_{};
+  size_t next_replaced_ = 0;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+};
+}  // namespace TimeSteppers
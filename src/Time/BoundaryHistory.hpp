@@ -3,17 +3,19 @@
 
 #pragma once
 
-#include <algorithm>
+#include <array>
 #include <cstddef>
-#include <deque>
 #include <map>
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>  // IWYU pragma: keep
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "DataStructures/CircularDeque.hpp"
 #include "DataStructures/MathWrapper.hpp"
+#include "Time/BoundaryCoefficientCache.hpp"
 #include "Time/Time.hpp"  // IWYU pragma: keep
 #include "Time/TimeStepId.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -38,7 +40,7 @@ class BoundaryHistoryEvaluator {
   ~BoundaryHistoryEvaluator() = default;
 
  public:
-  using iterator = std::deque<Time>::const_iterator;
+  using iterator = CircularDeque<Time>::const_iterator;
 
   /// The current order of integration.
   virtual size_t integration_order() const = 0;
@@ -61,6 +63,10 @@ class BoundaryHistoryEvaluator {
   /// cached in the associated BoundaryHistory object.
   virtual MathWrapper<const T> operator()(const iterator& local,
                                           const iterator& remote) const = 0;
+
+  /// The cache of local time-stepping step coefficients stored in the
+  /// associated BoundaryHistory object.
+  virtual BoundaryCoefficientCache& coefficient_cache() const = 0;
 };
 
 /// \ingroup TimeSteppersGroup
@@ -75,7 +81,7 @@ class BoundaryHistoryCleaner {
   ~BoundaryHistoryCleaner() = default;
 
  public:
-  using iterator = std::deque<Time>::const_iterator;
+  using iterator = CircularDeque<Time>::const_iterator;
 
   /// The current order of integration.
   virtual size_t integration_order() const = 0;
@@ -104,17 +110,26 @@ class BoundaryHistoryCleaner {
 
 /// \ingroup TimeSteppersGroup
 /// History data used by a TimeStepper for boundary integration.
+///
+/// The entries and the cached coupling results are stored in
+/// `CircularDeque`s and a `std::map` whose nodes are recycled when
+/// entries are removed, so once the number of stored entries reaches a
+/// steady state the history itself performs no heap allocations.  (The
+/// coupling function and the inserted vars may still allocate.)
+///
+/// The history also holds a `BoundaryCoefficientCache` that time
+/// steppers can use to reuse the coefficients of local time-stepping
+/// steps with repeating step patterns.  It is not serialized.
+///
 /// \tparam LocalVars local variables passed to the boundary coupling
 /// \tparam RemoteVars remote variables passed to the boundary coupling
 /// \tparam CouplingResult result of the coupling function
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
 class BoundaryHistory {
  public:
-  using iterator = std::deque<Time>::const_iterator;
+  using iterator = CircularDeque<Time>::const_iterator;
 
-  // No copying because of the pointers in the cache.  Moving is fine
-  // because we also move the container being pointed into and maps
-  // guarantee that this doesn't invalidate pointers.
+  // No copying because the recycled cache nodes are move-only.
   BoundaryHistory() = default;
   BoundaryHistory(const BoundaryHistory&) = delete;
   BoundaryHistory(BoundaryHistory&&) = default;
@@ -155,11 +170,13 @@ class BoundaryHistory {
     ASSERT(time_id.substep() == 0, "Substeps not supported in LTS");
     local_data_.first.emplace_front(time_id.step_time());
     local_data_.second.emplace_front(std::move(vars));
+    --entries_removed_[0];
   }
   void remote_insert_initial(const TimeStepId& time_id, RemoteVars vars) {
     ASSERT(time_id.substep() == 0, "Substeps not supported in LTS");
     remote_data_.first.emplace_front(time_id.step_time());
     remote_data_.second.emplace_front(std::move(vars));
+    --entries_removed_[1];
   }
   /// @}
 
@@ -179,6 +196,11 @@ class BoundaryHistory {
   /// data at a `time_id` that has not been inserted yet.
   const LocalVars& local_data(const TimeStepId& time_id) const;
 
+  /// The most recently inserted local data, or `nullptr` if there is none
+  const LocalVars* latest_local_data() const {
+    return local_data_.second.empty() ? nullptr : &local_data_.second.back();
+  }
+
   /// Apply \p local_func and \p remote_func to `make_not_null(&e)`
   /// for `e` every local and remote value in the history,
   /// respectively.  Invalidates all cached values.
@@ -193,6 +215,11 @@ class BoundaryHistory {
   void map_entries(Func&& func);
   /// @}
 
+  /// The cache of local time-stepping step coefficients.
+  const BoundaryCoefficientCache& coefficient_cache() const {
+    return coefficient_cache_;
+  }
+
  private:
   template <typename Coupling>
   class BoundaryHistoryEvaluatorImpl final
@@ -228,6 +255,10 @@ class BoundaryHistory {
     MathWrapper<const math_wrapper_type<CouplingResult>> operator()(
         const iterator& local, const iterator& remote) const override;
 
+    BoundaryCoefficientCache& coefficient_cache() const override {
+      return history_->coefficient_cache_;
+    }
+
    private:
     gsl::not_null<const BoundaryHistory*> history_;
     Coupling coupling_;
@@ -302,17 +333,28 @@ class BoundaryHistory {
   void mark_unneeded(const iterator& first_needed);
 
   size_t integration_order_{0};
+  using CouplingCache = std::map<std::pair<size_t, size_t>, CouplingResult>;
+
+  // Removes the cache entry and keeps its node for reuse.
+  void recycle_cache_entry(typename CouplingCache::const_iterator entry);
+
+  // Number of entries that have been removed from the front of each
+  // side, minus the number inserted there.  The coupling cache is
+  // keyed on the index of each entry plus this offset, so the keys do
+  // not change when entries are added or removed.  All arithmetic on
+  // the keys is modulo 2^64, so the offsets may wrap.
+  std::array<size_t, 2> entries_removed_{};
   // The type erased classes need access to the list of times, so we
   // can't store the (time, data) pairs in the natural data structure
   // but have to invert the deque and pair entries.
-  std::pair<std::deque<Time>, std::deque<LocalVars>> local_data_;
-  std::pair<std::deque<Time>, std::deque<RemoteVars>> remote_data_;
-  // We use pointers instead of iterators because deque invalidates
-  // iterators when elements are inserted or removed at the ends, but
-  // not pointers.
+  std::pair<CircularDeque<Time>, CircularDeque<LocalVars>> local_data_;
+  std::pair<CircularDeque<Time>, CircularDeque<RemoteVars>> remote_data_;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable CouplingCache coupling_cache_;
   // NOLINTNEXTLINE(spectre-mutable)
-  mutable std::map<std::pair<const Time*, const Time*>, CouplingResult>
-      coupling_cache_;
+  mutable std::vector<typename CouplingCache::node_type> unused_cache_nodes_;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable BoundaryCoefficientCache coefficient_cache_{};
 };
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
@@ -326,20 +368,29 @@ void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::mark_unneeded(
       return remote_data_;
     }
   }();
-  for (auto it = data.first.begin(); it != first_needed; ++it) {
-    // Clean out cache entries referring to the entry we are removing.
-    for (auto cache_entry = coupling_cache_.begin();
-         cache_entry != coupling_cache_.end();) {
-      if (std::get<Side>(cache_entry->first) == &*it) {
-        cache_entry = coupling_cache_.erase(cache_entry);
-      } else {
-        ++cache_entry;
-      }
+  const auto number_to_remove =
+      static_cast<size_t>(first_needed - data.first.begin());
+  // Clean out cache entries referring to the entries we are removing.
+  for (auto cache_entry = coupling_cache_.begin();
+       cache_entry != coupling_cache_.end();) {
+    if (std::get<Side>(cache_entry->first) - std::get<Side>(entries_removed_) <
+        number_to_remove) {
+      recycle_cache_entry(cache_entry++);
+    } else {
+      ++cache_entry;
     }
   }
-  data.second.erase(data.second.begin(),
-                    data.second.begin() + (first_needed - data.first.begin()));
+  data.second.erase(
+      data.second.begin(),
+      data.second.begin() + static_cast<std::ptrdiff_t>(number_to_remove));
   data.first.erase(data.first.begin(), first_needed);
+  std::get<Side>(entries_removed_) += number_to_remove;
+}
+
+template <typename LocalVars, typename RemoteVars, typename CouplingResult>
+void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::
+    recycle_cache_entry(const typename CouplingCache::const_iterator entry) {
+  unused_cache_nodes_.push_back(coupling_cache_.extract(entry));
 }
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
@@ -347,7 +398,7 @@ const LocalVars&
 BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::local_data(
     const TimeStepId& time_id) const {
   const Time& time = time_id.step_time();
-  // Look up the data for this time, starting at the end of the `std::deque`,
+  // Look up the data for this time, starting at the end of the deque,
   // i.e. the most-recently inserted data.
   auto value_it = local_data_.second.rbegin();
   for (auto time_it = local_data_.first.rbegin();
@@ -364,7 +415,9 @@ template <typename LocalVars, typename RemoteVars, typename CouplingResult>
 template <typename LocalFunc, typename RemoteFunc>
 void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::map_entries(
     LocalFunc&& local_func, RemoteFunc&& remote_func) {
-  coupling_cache_.clear();
+  while (not coupling_cache_.empty()) {
+    recycle_cache_entry(coupling_cache_.begin());
+  }
   alg::for_each(local_data_.second,
                 [&](LocalVars& v) { local_func(make_not_null(&v)); });
   alg::for_each(remote_data_.second,
@@ -383,6 +436,8 @@ void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::pup(PUP::er& p) {
   p | integration_order_;
   p | local_data_;
   p | remote_data_;
+  // The recycled cache nodes and the coefficient cache are not
+  // serialized.
 
   const size_t cache_size = PUP_stl_container_size(p, coupling_cache_);
   if (p.isUnpacking()) {
@@ -393,33 +448,16 @@ void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::pup(PUP::er& p) {
       p | local_index;
       p | remote_index;
       p | cache_value;
-      const auto cache_key = std::make_pair(&local_data_.first[local_index],
-                                            &remote_data_.first[remote_index]);
-      coupling_cache_.insert(std::make_pair(cache_key, cache_value));
+      coupling_cache_.emplace(std::make_pair(local_index, remote_index),
+                              std::move(cache_value));
     }
+    entries_removed_ = {};
   } else {
     for (auto& cache_entry : coupling_cache_) {
-      // clang-tidy: modernize-use-auto - Ensuring the correct type is
-      // important here to prevent undefined behavior in charm.  I
-      // want to be explicit.
-      size_t local_index = static_cast<size_t>(  // NOLINT
-          std::find_if(local_data_.first.begin(), local_data_.first.end(),
-                       [goal = cache_entry.first.first](const auto& entry) {
-                         return &entry == goal;
-                       }) -
-          local_data_.first.begin());
+      size_t local_index = cache_entry.first.first - entries_removed_[0];
+      size_t remote_index = cache_entry.first.second - entries_removed_[1];
       ASSERT(local_index < local_data_.first.size(),
              "Failed to find local history entry for cache entry");
-
-      // clang-tidy: modernize-use-auto - Ensuring the correct type is
-      // important here to prevent undefined behavior in charm.  I
-      // want to be explicit.
-      size_t remote_index = static_cast<size_t>(  // NOLINT
-          std::find_if(remote_data_.first.begin(), remote_data_.first.end(),
-                       [goal = cache_entry.first.second](const auto& entry) {
-                         return &entry == goal;
-                       }) -
-          remote_data_.first.begin());
       ASSERT(remote_index < remote_data_.first.size(),
              "Failed to find remote history entry for cache entry");
 
@@ -436,18 +474,34 @@ MathWrapper<const math_wrapper_type<CouplingResult>>
 BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::
     BoundaryHistoryEvaluatorImpl<Coupling>::operator()(
         const iterator& local, const iterator& remote) const {
-  const auto insert_result = history_->coupling_cache_.insert(
-      std::make_pair(std::make_pair(&*local, &*remote), CouplingResult{}));
-  CouplingResult& inserted_value = insert_result.first->second;
-  const bool is_new_value = insert_result.second;
-  if (is_new_value) {
-    inserted_value =
-        coupling_(history_->local_data_.second[static_cast<size_t>(
-                      local - history_->local_data_.first.begin())],
-                  history_->remote_data_.second[static_cast<size_t>(
-                      remote - history_->remote_data_.first.begin())]);
+  const auto local_offset =
+      static_cast<size_t>(local - history_->local_data_.first.begin());
+  const auto remote_offset =
+      static_cast<size_t>(remote - history_->remote_data_.first.begin());
+  const std::pair<size_t, size_t> cache_key{
+      history_->entries_removed_[0] + local_offset,
+      history_->entries_removed_[1] + remote_offset};
+  const auto cached_value = history_->coupling_cache_.find(cache_key);
+  if (cached_value != history_->coupling_cache_.end()) {
+    return make_math_wrapper(cached_value->second);
+  }
+
+  auto& unused_nodes = history_->unused_cache_nodes_;
+  if (unused_nodes.empty()) {
+    return make_math_wrapper(
+        history_->coupling_cache_
+            .emplace(cache_key,
+                     coupling_(history_->local_data_.second[local_offset],
+                               history_->remote_data_.second[remote_offset]))
+            .first->second);
   }
-  return make_math_wrapper(inserted_value);
+  auto node = std::move(unused_nodes.back());
+  unused_nodes.pop_back();
+  node.key() = cache_key;
+  node.mapped() = coupling_(history_->local_data_.second[local_offset],
+                            history_->remote_data_.second[remote_offset]);
+  return make_math_wrapper(
+      history_->coupling_cache_.insert(std::move(node)).position->second);
 }
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
@@ -0,0 +1,117 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/History.hpp"
+#include "Time/Tags/ImplicitHistory.hpp"
+#include "Time/Tags/TimeStepper.hpp"
+#include "Time/TimeSteppers/ImexTimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
+
+/// \cond
+class TimeDelta;
+class TimeStepId;
+namespace Tags {
+struct TimeStep;
+struct TimeStepId;
+}  // namespace Tags
+/// \endcond
+
+namespace implicit_step_detail {
+CREATE_HAS_TYPE_ALIAS(implicit_sector)
+CREATE_HAS_TYPE_ALIAS_V(implicit_sector)
+}  // namespace implicit_step_detail
+
+/// \ingroup TimeGroup
+/// Whether `System` has stiff sources evolved implicitly with an IMEX
+/// time stepper.
+///
+/// Such a system defines a type alias `implicit_sector` to a struct
+/// with
+///
+/// - `argument_tags`: a typelist of additional DataBox items needed
+///   to evaluate and solve for the source.
+/// - `static void source(gsl::not_null<dt_vars*> source, const vars&
+///   vars, const ArgumentTags::type&... args)`: computes the implicit
+///   source \f$S(u)\f$.  The source is sized like the variables before
+///   the call.
+/// - `static void solve(gsl::not_null<vars*> vars, double weight, const
+///   ArgumentTags::type&... args)`: replaces \f$u^*\f$ in `vars` by the
+///   solution \f$u\f$ of \f$u = u^* + w S(u)\f$, with \f$w\f$ the
+///   `weight`.  This is expected to be a pointwise solve, so it does
+///   not limit the step size the way an explicit treatment of a stiff
+///   source would.
+///
+/// where `vars` is the type of `System::variables_tag` and `dt_vars`
+/// is the type of its `Tags::dt` prefix.  Only systems with a single
+/// variables tag are supported.  The DataBox must contain
+/// `Tags::ImplicitHistory<variables_tag>` and
+/// `Tags::TimeStepper<ImexTimeStepper>`.
+template <typename System>
+constexpr bool has_implicit_sector_v =
+    implicit_step_detail::has_implicit_sector_v<System>;
+
+/// \ingroup TimeGroup
+/// Records the implicit source of the current state in the implicit
+/// history.  Must be called at the start of each substep, along with
+/// `record_time_stepper_data`.
+template <typename System, typename DbTags>
+void record_implicit_source(const gsl::not_null<db::DataBox<DbTags>*> box) {
+  using variables_tag = typename System::variables_tag;
+  using sector = typename System::implicit_sector;
+  using history_tag = Tags::ImplicitHistory<variables_tag>;
+  using DerivVars = typename db::add_tag_prefix<Tags::dt, variables_tag>::type;
+
+  db::mutate_apply<
+      tmpl::list<history_tag>,
+      tmpl::push_front<typename sector::argument_tags, Tags::TimeStepId,
+                       variables_tag>>(
+      [](const gsl::not_null<typename history_tag::type*> history,
+         const TimeStepId& time_step_id,
+         const typename variables_tag::type& vars, const auto&... args) {
+        history->insert_in_place(
+            time_step_id, history_tag::type::no_value,
+            [&](const gsl::not_null<DerivVars*> source) {
+              set_number_of_grid_points(source, vars);
+              sector::source(source, vars, args...);
+            });
+      },
+      box);
+}
+
+/// \ingroup TimeGroup
+/// Applies the implicit part of the current substep, following the
+/// explicit update performed by `update_u`.  This adds the
+/// contributions of the previously recorded implicit sources and then,
+/// if the stepper requires it, calls the system's pointwise implicit
+/// solve.
+template <typename System, typename DbTags>
+void solve_implicit_step(const gsl::not_null<db::DataBox<DbTags>*> box) {
+  using variables_tag = typename System::variables_tag;
+  using sector = typename System::implicit_sector;
+  using history_tag = Tags::ImplicitHistory<variables_tag>;
+
+  db::mutate_apply<
+      tmpl::list<variables_tag, history_tag>,
+      tmpl::push_front<typename sector::argument_tags, Tags::TimeStep,
+                       Tags::TimeStepper<ImexTimeStepper>>>(
+      [](const gsl::not_null<typename variables_tag::type*> vars,
+         const gsl::not_null<typename history_tag::type*> history,
+         const TimeDelta& time_step, const ImexTimeStepper& time_stepper,
+         const auto&... args) {
+        time_stepper.add_inhomogeneous_implicit_terms(vars, history,
+                                                      time_step);
+        const double weight = time_stepper.implicit_weight(*history, time_step);
+        if (weight != 0.0) {
+          sector::solve(vars, weight, args...);
+        }
+      },
+      box);
+}
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <limits>
 #include <pup.h>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -56,9 +57,14 @@ class Cfl : public StepChooser<StepChooserUse> {
                  ::Tags::TimeStepper<>,
                  typename System::compute_largest_characteristic_speed>;
 
-  using compute_tags = tmpl::list<
-      domain::Tags::MinimumGridSpacingCompute<System::volume_dim, Frame>,
-      typename System::compute_largest_characteristic_speed>;
+  // The inertial spacing is computed by
+  // `evolution::dg::Initialization::Domain`, much more cheaply on rigidly
+  // moving meshes, so that compute tag is not added here.
+  using compute_tags = tmpl::flatten<tmpl::list<
+      tmpl::conditional_t<
+          std::is_same_v<Frame, ::Frame::Inertial>, tmpl::list<>,
+          domain::Tags::MinimumGridSpacingCompute<System::volume_dim, Frame>>,
+      typename System::compute_largest_characteristic_speed>>;
 
   std::pair<double, bool> operator()(
       const double minimum_grid_spacing,
@@ -28,6 +28,7 @@
 #include "Time/Tags/StepperErrorUpdated.hpp"
 #include "Time/Tags/TimeStepper.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/TMPL.hpp"
@@ -102,6 +103,23 @@ struct IsAnErrorControl {};
  *
  * where \f$E_{\text{prev}}\f$ is the error computed in the previous step.
  *
+ * If the `Lookahead` option is set and the error is growing, the step
+ * is additionally limited so that the error of the next step will be
+ * within the tolerance if it grows by the same factor again,
+ *
+ * \f[
+ * h_{\text{new}} \le h \cdot \min\left(F_{\text{max}},
+ * \max\left(F_{\text{min}},
+ * F_{\text{safety}} \left(\frac{E^2}{E_{\text{prev}}}\right)^{-1/(q + 1)}
+ * \right)\right).
+ * \f]
+ *
+ * This anticipates the growth of the error, such as when a feature in
+ * the solution steepens, and so reduces the number of rejected steps,
+ * each of which requires redoing the full step.  The number of
+ * rejections is reported as `Number of step rejections` by
+ * `Events::ObserveAdaptiveSteppingDiagnostics`.
+ *
  * \note The template parameter `ErrorControlSelector` is used to disambiguate
  * in the input-file options between `ErrorControl` step choosers that are
  * based on different variables. This is needed if multiple systems are evolved
@@ -167,19 +185,28 @@ class ErrorControl : public StepChooser<StepChooserUse>,
     static type lower_bound() { return 0.0; }
   };
 
+  struct Lookahead {
+    using type = bool;
+    static constexpr Options::String help{
+        "Reduce the step in advance when the error is growing, assuming the "
+        "next error will grow by the same factor as the last one.  This "
+        "reduces the number of rejected steps."};
+  };
+
   static constexpr Options::String help{
       "Chooses a step based on a target relative and absolute error tolerance"};
   using options = tmpl::list<AbsoluteTolerance, RelativeTolerance, MaxFactor,
-                             MinFactor, SafetyFactor>;
+                             MinFactor, SafetyFactor, Lookahead>;
 
   ErrorControl(const double absolute_tolerance, const double relative_tolerance,
                const double max_factor, const double min_factor,
-               const double safety_factor)
+               const double safety_factor, const bool lookahead = false)
       : absolute_tolerance_{absolute_tolerance},
         relative_tolerance_{relative_tolerance},
         max_factor_{max_factor},
         min_factor_{min_factor},
-        safety_factor_{safety_factor} {}
+        safety_factor_{safety_factor},
+        lookahead_{lookahead} {}
 
   using simple_tags =
       tmpl::list<::Tags::StepperError<EvolvedVariableTag>,
@@ -229,6 +256,17 @@ class ErrorControl : public StepChooser<StepChooserUse>,
                   pow(1.0 / std::max(l_inf_error, 1e-14), alpha_factor) *
                   pow(std::max(previous_l_inf_error, 1e-14), beta_factor),
               min_factor_, max_factor_);
+      if (lookahead_ and l_inf_error > previous_l_inf_error) {
+        const double predicted_l_inf_error =
+            square(l_inf_error) / std::max(previous_l_inf_error, 1e-14);
+        new_step = std::min(
+            new_step,
+            previous_step *
+                std::clamp(safety_factor_ *
+                               pow(1.0 / predicted_l_inf_error,
+                                   1.0 / (stepper.error_estimate_order() + 1)),
+                           min_factor_, max_factor_));
+      }
     }
     return std::make_pair(new_step, l_inf_error <= 1.0);
   }
@@ -241,6 +279,7 @@ class ErrorControl : public StepChooser<StepChooserUse>,
     p | min_factor_;
     p | max_factor_;
     p | safety_factor_;
+    p | lookahead_;
   }
 
  private:
@@ -293,6 +332,7 @@ class ErrorControl : public StepChooser<StepChooserUse>,
   double max_factor_ = std::numeric_limits<double>::signaling_NaN();
   double min_factor_ = std::numeric_limits<double>::signaling_NaN();
   double safety_factor_ = std::numeric_limits<double>::signaling_NaN();
+  bool lookahead_ = false;
 };
 /// \cond
 template <typename StepChooserUse, typename EvolvedVariableTag,
@@ -0,0 +1,22 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Time/History.hpp"
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// Tag for the history of the implicit sources of an IMEX evolution.
+///
+/// The history contains only derivatives, inserted with
+/// `TimeSteppers::History::no_value`.
+///
+/// \tparam Tag tag for the variables
+template <typename Tag>
+struct ImplicitHistory : db::SimpleTag {
+  using type = TimeSteppers::History<typename Tag::type>;
+};
+}  // namespace Tags
@@ -11,6 +11,7 @@
 #include "Time/Actions/RecordTimeStepperData.hpp"
 #include "Time/Actions/UpdateU.hpp"
 #include "Time/AdaptiveSteppingDiagnostics.hpp"
+#include "Time/ImplicitStep.hpp"
 #include "Time/Tags/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/Time.hpp"
 #include "Utilities/Gsl.hpp"
@@ -30,16 +31,29 @@ struct TimeStep;
 /// This function is used to encapsulate any needed logic for updating the
 /// system, and in the case for which step parameters may need to be rejected
 /// and re-tried, looping until an acceptable step is performed.
+///
+/// If the system has an `implicit_sector` (see `has_implicit_sector_v`), its
+/// stiff sources are recorded and solved for pointwise after each explicit
+/// update, so the step size is not limited by the stiffness of the sources.
 template <typename System, bool LocalTimeStepping,
           typename StepChoosersToUse = AllStepChoosers, typename DbTags>
 void take_step(const gsl::not_null<db::DataBox<DbTags>*> box) {
   record_time_stepper_data<System>(box);
+  if constexpr (has_implicit_sector_v<System>) {
+    record_implicit_source<System>(box);
+  }
+  const auto update = [&box]() {
+    update_u<System>(box);
+    if constexpr (has_implicit_sector_v<System>) {
+      solve_implicit_step<System>(box);
+    }
+  };
   if constexpr (LocalTimeStepping) {
     uint64_t step_attempts = 0;
     const auto original_step = db::get<Tags::TimeStep>(*box);
     do {
       ++step_attempts;
-      update_u<System>(box);
+      update();
     } while (not change_step_size<StepChoosersToUse>(box));
     db::mutate<Tags::AdaptiveSteppingDiagnostics>(
         [&](const gsl::not_null<AdaptiveSteppingDiagnostics*> diags,
@@ -51,6 +65,6 @@ void take_step(const gsl::not_null<db::DataBox<DbTags>*> box) {
         },
         box, db::get<Tags::TimeStep>(*box));
   } else {
-    update_u<System>(box);
+    update();
   }
 }
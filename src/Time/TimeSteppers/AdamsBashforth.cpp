@@ -6,14 +6,18 @@
 #include <algorithm>
 #include <boost/container/small_vector.hpp>
 #include <boost/iterator/transform_iterator.hpp>
+#include <complex>
 #include <cstddef>
 #include <iterator>
 #include <limits>
 #include <pup.h>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
 #include "Time/ApproximateTime.hpp"
+#include "Time/BoundaryCoefficientCache.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/History.hpp"
@@ -21,10 +25,12 @@
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
+#include "Time/TimeSteppers/FusedLinearCombination.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/System/Prefetch.hpp"
 
 namespace TimeSteppers {
 
@@ -51,6 +57,54 @@ auto history_time_iterator(const Iter& it) {
   return boost::transform_iterator(it, TimeFromRecord<Iter>{});
 }
 
+// The history entries and coupling results are separate allocations, so the
+// start of each one is prefetched while the previous one is accumulated.
+template <typename T>
+void prefetch_start_of(const T& data) {
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    (void)data;
+  } else {
+    sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(data);
+  }
+}
+
+// Non-owning copy of a vector, so that it can be stored without
+// copying the data.
+template <typename T>
+T make_view(const T& data) {
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    return data;
+  } else {
+    return T(const_cast<typename T::value_type*>(data.data()), data.size());
+  }
+}
+
+// Terms coefficient * value of a boundary sum.  They are collected before
+// being added to the result so the next value can be prefetched.
+template <typename T>
+using BoundaryTerms =
+    boost::container::small_vector<std::pair<double, T>,
+                                   adams_coefficients::maximum_order>;
+
+template <typename T>
+void add_boundary_terms(const gsl::not_null<T*> result,
+                        const BoundaryTerms<T>& terms) {
+  for (size_t i = 0; i < terms.size(); ++i) {
+    if (i + 1 < terms.size()) {
+      prefetch_start_of(terms[i + 1].second);
+    }
+    *result += terms[i].first * terms[i].second;
+  }
+}
+
+// Times of the history entries used in an LTS step, in the form used
+// by the BoundaryCoefficientCache.
+using PatternTimes =
+    boost::container::small_vector<double,
+                                   2 * adams_coefficients::maximum_order>;
+
 template <typename T>
 void clean_history(const MutableUntypedHistory<T>& history) {
   ASSERT(history.size() >= history.integration_order(),
@@ -121,11 +175,10 @@ bool AdamsBashforth::update_u_impl(
     const gsl::not_null<T*> u, const gsl::not_null<T*> u_error,
     const MutableUntypedHistory<T>& history, const TimeDelta& time_step) const {
   clean_history(history);
-  update_u_common(u, history, time_step, history.integration_order());
   // the error estimate is only useful once the history has enough elements to
   // do more than one order of step
-  update_u_common(u_error, history, time_step, history.integration_order() - 1);
-  *u_error = *u - *u_error;
+  update_u_common(u, history, time_step, history.integration_order(),
+                  u_error.get());
   return true;
 }
 
@@ -142,30 +195,55 @@ bool AdamsBashforth::dense_update_u_impl(const gsl::not_null<T*> u,
 template <typename T, typename Delta>
 void AdamsBashforth::update_u_common(const gsl::not_null<T*> u,
                                      const ConstUntypedHistory<T>& history,
-                                     const Delta& time_step,
-                                     const size_t order) const {
+                                     const Delta& time_step, const size_t order,
+                                     T* const u_error) const {
   ASSERT(
       history.size() > 0,
       "Cannot meaningfully update the evolved variables with an empty history");
   ASSERT(order <= order_,
          "Requested integration order higher than integrator order");
 
+  using difference_type = typename ConstUntypedHistory<T>::difference_type;
   const auto history_start =
-      history.end() -
-      static_cast<typename ConstUntypedHistory<T>::difference_type>(order);
+      history.end() - static_cast<difference_type>(order);
+  const auto step_start = history.back().time_step_id.step_time();
+  const auto step_end = step_start + time_step;
   const auto coefficients = adams_coefficients::coefficients(
       history_time_iterator(history_start),
-      history_time_iterator(history.end()),
-      history.back().time_step_id.step_time(),
-      history.back().time_step_id.step_time() + time_step);
+      history_time_iterator(history.end()), step_start, step_end);
 
-  *u = *history.back().value;
+  FusedTerms<T> terms{};
   auto coefficient = coefficients.begin();
-  for (auto history_entry = history_start;
-       history_entry != history.end();
+  for (auto history_entry = history_start; history_entry != history.end();
        ++history_entry, ++coefficient) {
-    *u += *coefficient * history_entry->derivative;
+    terms.push_back({*coefficient, 0.0, &history_entry->derivative});
+  }
+
+  if (u_error == nullptr) {
+    fused_linear_combination(u, *history.back().value, terms);
+    return;
+  }
+
+  // The error estimate is the difference from the solution one order
+  // lower, which does not use the oldest entry.  It is computed in the
+  // same pass as the result.
+  if (order > 1) {
+    const auto lower_order_coefficients = adams_coefficients::coefficients(
+        history_time_iterator(history_start + 1),
+        history_time_iterator(history.end()), step_start, step_end);
+    auto lower_order_coefficient = lower_order_coefficients.begin();
+    terms.front().error_coefficient = terms.front().coefficient;
+    for (size_t i = 1; i < terms.size(); ++i, ++lower_order_coefficient) {
+      terms[i].error_coefficient =
+          terms[i].coefficient - *lower_order_coefficient;
+    }
+  } else {
+    for (auto& term : terms) {
+      term.error_coefficient = term.coefficient;
+    }
   }
+  fused_linear_combination(u, make_not_null(u_error), *history.back().value,
+                           terms);
 }
 
 template <typename T>
@@ -420,13 +498,16 @@ void AdamsBashforth::boundary_impl(const gsl::not_null<T*> result,
     const auto coefficients = adams_coefficients::coefficients(
         local_begin, coupling.local_end(), start_time, end_time);
 
+    BoundaryTerms<T> terms{};
     auto local_it = local_begin;
     auto remote_it = coupling.remote_end() - order_s;
     for (auto coefficients_it = coefficients.begin();
          coefficients_it != coefficients.end();
          ++coefficients_it, ++local_it, ++remote_it) {
-      *result += *coefficients_it * *coupling(local_it, remote_it);
+      terms.emplace_back(*coefficients_it,
+                         make_view(*coupling(local_it, remote_it)));
     }
+    add_boundary_terms(result, terms);
     return;
   }
 
@@ -451,6 +532,69 @@ void AdamsBashforth::boundary_impl(const gsl::not_null<T*> result,
 
   using difference_type = std::ptrdiff_t;
 
+  // The coefficients of a step only depend on the pattern of history
+  // times relative to the step, so steps repeating an earlier pattern
+  // can reuse them.  Dense output ends at arbitrary times, so only
+  // full steps are cached.
+  constexpr bool use_coefficient_cache = std::is_same_v<TimeType, Time>;
+  PatternTimes local_pattern{};
+  PatternTimes remote_pattern{};
+  std::vector<BoundaryCoefficientCache::Term> new_cache_terms{};
+  if constexpr (use_coefficient_cache) {
+    const auto pattern_time = [&start_time, &time_step](const Time& t) {
+      return (t.value() - start_time.value()) / time_step.value();
+    };
+    std::transform(local_begin, coupling.local_end(),
+                   std::back_inserter(local_pattern), pattern_time);
+    // Coinciding times must be passed to the cache as identical values.
+    for (auto remote_it = remote_begin; remote_it != coupling.remote_end();
+         ++remote_it) {
+      const auto local_match =
+          std::find(local_begin, coupling.local_end(), *remote_it);
+      remote_pattern.push_back(
+          local_match == coupling.local_end()
+              ? pattern_time(*remote_it)
+              : local_pattern[static_cast<size_t>(local_match - local_begin)]);
+    }
+    const auto* const cached_terms = coupling.coefficient_cache().find(
+        {local_pattern.data(), local_pattern.size()},
+        {remote_pattern.data(), remote_pattern.size()});
+    if (cached_terms != nullptr) {
+      BoundaryTerms<T> terms{};
+      for (const auto& term : *cached_terms) {
+        terms.emplace_back(
+            term.coefficient * time_step.value(),
+            make_view(*coupling(
+                local_begin + static_cast<difference_type>(term.local_index),
+                remote_begin +
+                    static_cast<difference_type>(term.remote_index))));
+      }
+      add_boundary_terms(result, terms);
+      return;
+    }
+  }
+
+  BoundaryTerms<T> terms{};
+  const auto add_term =
+      [&coupling, &local_begin, &new_cache_terms, &remote_begin, &terms,
+       &time_step](const double coefficient,
+                   const typename BoundaryHistoryEvaluator<T>::iterator& local,
+                   const typename BoundaryHistoryEvaluator<T>::iterator&
+                       remote) {
+        terms.emplace_back(coefficient, make_view(*coupling(local, remote)));
+        if constexpr (use_coefficient_cache) {
+          new_cache_terms.push_back(
+              {coefficient / time_step.value(),
+               static_cast<size_t>(local - local_begin),
+               static_cast<size_t>(remote - remote_begin)});
+        } else {
+          (void)local_begin;
+          (void)new_cache_terms;
+          (void)remote_begin;
+          (void)time_step;
+        }
+      };
+
   SmallStepIterator<T> contributing_small_step(
       time_step.is_positive(), local_begin, remote_begin, coupling.local_end(),
       coupling.remote_end());
@@ -504,9 +648,8 @@ void AdamsBashforth::boundary_impl(const gsl::not_null<T*> result,
                                     small_step_within_current_step];
       }
       if (contributing_small_step.side() == SmallStepIterator<T>::Side::Both) {
-        *result += overall_prefactor *
-                   *coupling(contributing_small_step.local_iterator(),
-                             contributing_small_step.remote_iterator());
+        add_term(overall_prefactor, contributing_small_step.local_iterator(),
+                 contributing_small_step.remote_iterator());
       } else {
         // Side::Remote
         OrderVector<double> past_steps(current_order);
@@ -525,9 +668,8 @@ void AdamsBashforth::boundary_impl(const gsl::not_null<T*> result,
               lagrange_polynomial(interpolation_index,
                                   contributing_small_step->value(),
                                   past_steps.begin(), past_steps.end());
-          *result += coefficient *
-                     *coupling(interpolation_time,
-                               contributing_small_step.remote_iterator());
+          add_term(coefficient, interpolation_time,
+                   contributing_small_step.remote_iterator());
         }
       }
     } else {
@@ -588,12 +730,18 @@ void AdamsBashforth::boundary_impl(const gsl::not_null<T*> result,
                                      [contributing_step_index -
                                       small_step_within_current_step_index];
         }
-        *result +=
-            coefficient * *coupling(contributing_small_step.local_iterator(),
-                                    interpolation_time);
+        add_term(coefficient, contributing_small_step.local_iterator(),
+                 interpolation_time);
       }
     }
   }
+  add_boundary_terms(result, terms);
+  if constexpr (use_coefficient_cache) {
+    coupling.coefficient_cache().insert(
+        {local_pattern.data(), local_pattern.size()},
+        {remote_pattern.data(), remote_pattern.size()},
+        std::move(new_cache_terms));
+  }
 }
 
 bool operator==(const AdamsBashforth& lhs, const AdamsBashforth& rhs) {
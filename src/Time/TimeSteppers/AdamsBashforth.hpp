@@ -252,10 +252,13 @@ class AdamsBashforth : public LtsTimeStepper {
                            const ConstUntypedHistory<T>& history,
                            double time) const;
 
+  // If u_error is not null, it is set to the difference from the
+  // solution one order lower.
   template <typename T, typename Delta>
   void update_u_common(gsl::not_null<T*> u,
                        const ConstUntypedHistory<T>& history,
-                       const Delta& time_step, size_t order) const;
+                       const Delta& time_step, size_t order,
+                       T* u_error = nullptr) const;
 
   template <typename T>
   bool can_change_step_size_impl(const TimeStepId& time_id,
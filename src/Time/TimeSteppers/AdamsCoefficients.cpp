@@ -3,6 +3,11 @@
 
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
 
+#include <algorithm>
+#include <boost/container/static_vector.hpp>
+#include <iterator>
+#include <utility>
+
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
@@ -116,6 +121,28 @@ OrderVector<T> variable_coefficients(OrderVector<T> control_times,
   return result;
 }
 
+OrderVector<double> normalized_variable_coefficients(
+    const OrderVector<double>& control_times) {
+  // Most recently used first
+  thread_local boost::container::static_vector<
+      std::pair<OrderVector<double>, OrderVector<double>>,
+      memoization_cache_size>
+      cache{};
+  const auto entry = alg::find_if(cache, [&control_times](const auto& e) {
+    return e.first == control_times;
+  });
+  if (entry != cache.end()) {
+    std::rotate(cache.begin(), entry, std::next(entry));
+    return cache.front().second;
+  }
+  if (cache.size() == memoization_cache_size) {
+    cache.pop_back();
+  }
+  cache.emplace(cache.begin(), control_times,
+                variable_coefficients(control_times, 0.0, 1.0));
+  return cache.front().second;
+}
+
 #define TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                                                \
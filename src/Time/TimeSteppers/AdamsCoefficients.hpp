@@ -53,6 +53,19 @@ template <typename T>
 OrderVector<T> variable_coefficients(OrderVector<T> control_times,
                                      const T& step_start, const T& step_end);
 
+/// \brief Memoized `variable_coefficients` for a step from 0 to 1.
+///
+/// The \p control_times must be given relative to the start of the
+/// step in units of the step size.  Elements with the same history of
+/// step sizes need the same coefficients, so the results for the last
+/// `memoization_cache_size` distinct sets of control times are kept in
+/// a least-recently-used cache shared by all calls on a thread, i.e.,
+/// by every element on a PE.  The control times are compared exactly.
+OrderVector<double> normalized_variable_coefficients(
+    const OrderVector<double>& control_times);
+
+constexpr size_t memoization_cache_size = 16;
+
 /// \brief Get coefficients for a time step.
 ///
 /// Arguments are an iterator pair to past times (of type `Time`),
@@ -60,7 +73,9 @@ OrderVector<T> variable_coefficients(OrderVector<T> control_times,
 /// to take, with the end a `Time` or `ApproximateTime`.  This
 /// performs the same calculation as `variable_coefficients`, except
 /// that it works with `Time`s and will detect and optimize the
-/// constant-step-size case.
+/// constant-step-size case.  Variable-step coefficients for steps
+/// ending at a `Time` are memoized using
+/// `normalized_variable_coefficients`.
 template <typename Iterator, typename TimeType>
 OrderVector<double> coefficients(const Iterator& times_begin,
                                  const Iterator& times_end,
@@ -97,9 +112,19 @@ OrderVector<double> coefficients(const Iterator& times_begin,
     return result;
   }
 
-  return variable_coefficients(
-      control_times,
-      control_times.back() + (step_start - previous_time).value(),
-      control_times.back() + (step_end - previous_time).value());
+  const double shifted_step_start =
+      control_times.back() + (step_start - previous_time).value();
+  if constexpr (std::is_same_v<TimeType, Time>) {
+    alg::for_each(control_times, [&](double& t) {
+      t = (t - shifted_step_start) / step_size;
+    });
+    auto result = normalized_variable_coefficients(control_times);
+    alg::for_each(result, [&](double& coef) { coef *= step_size; });
+    return result;
+  } else {
+    return variable_coefficients(
+        control_times, shifted_step_start,
+        control_times.back() + (step_end - previous_time).value());
+  }
 }
 }  // namespace TimeSteppers::adams_coefficients
@@ -13,6 +13,7 @@
 #include "Time/History.hpp"
 #include "Time/SelfStart.hpp"
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
+#include "Time/TimeSteppers/FusedLinearCombination.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -47,11 +48,12 @@ void clean_history(const MutableUntypedHistory<T>& history) {
   }
 }
 
+// Terms of the predictor or corrector update, in history order with
+// the predicted derivative last.
 template <typename T, typename TimeType>
-void update_u_common(const gsl::not_null<T*> u,
-                     const ConstUntypedHistory<T>& history,
-                     const TimeType& step_end, const size_t method_order,
-                     const bool corrector) {
+FusedTerms<T> update_terms(const ConstUntypedHistory<T>& history,
+                           const TimeType& step_end, const size_t method_order,
+                           const bool corrector) {
   ASSERT(history.size() >= method_order - 1, "Insufficient history");
   // Pass in whether to run the predictor or corrector even though we
   // can compute it as a sanity check.
@@ -76,16 +78,28 @@ void update_u_common(const gsl::not_null<T*> u,
       control_times.begin(), control_times.end(),
       history.back().time_step_id.step_time(), step_end);
 
-  *u = *history.back().value;
+  FusedTerms<T> terms{};
   auto coefficient = coefficients.begin();
   for (auto history_entry = used_history_begin;
        history_entry != history.end();
        ++history_entry, ++coefficient) {
-    *u += *coefficient * history_entry->derivative;
+    terms.push_back({*coefficient, 0.0, &history_entry->derivative});
   }
   if (corrector) {
-    *u += coefficients.back() * history.substeps().front().derivative;
+    terms.push_back(
+        {coefficients.back(), 0.0, &history.substeps().front().derivative});
   }
+  return terms;
+}
+
+template <typename T, typename TimeType>
+void update_u_common(const gsl::not_null<T*> u,
+                     const ConstUntypedHistory<T>& history,
+                     const TimeType& step_end, const size_t method_order,
+                     const bool corrector) {
+  fused_linear_combination(
+      u, *history.back().value,
+      update_terms(history, step_end, method_order, corrector));
 }
 }  // namespace
 
@@ -167,14 +181,25 @@ bool AdamsMoultonPc::update_u_impl(const gsl::not_null<T*> u,
   clean_history(history);
   const bool predictor = history.at_step_start();
   const Time next_time = history.back().time_step_id.step_time() + time_step;
-  update_u_common(u, history, next_time, history.integration_order(),
-                  not predictor);
   if (predictor) {
+    update_u_common(u, history, next_time, history.integration_order(), false);
     return false;
   }
-  update_u_common(u_error, history, next_time, history.integration_order() - 1,
-                  true);
-  *u_error = *u - *u_error;
+  // The error estimate is the difference from the corrector one order
+  // lower, which does not use the oldest entry.  It is computed in the
+  // same pass as the result.
+  auto terms =
+      update_terms(history, next_time, history.integration_order(), true);
+  const auto lower_order_terms =
+      update_terms(history, next_time, history.integration_order() - 1, true);
+  ASSERT(lower_order_terms.size() + 1 == terms.size(),
+         "Lower-order corrector should use one fewer term.");
+  terms.front().error_coefficient = terms.front().coefficient;
+  for (size_t i = 1; i < terms.size(); ++i) {
+    terms[i].error_coefficient =
+        terms[i].coefficient - lower_order_terms[i - 1].coefficient;
+  }
+  fused_linear_combination(u, u_error, *history.back().value, terms);
   return true;
 }
 
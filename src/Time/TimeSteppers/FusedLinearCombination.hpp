@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <boost/container/small_vector.hpp>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/Prefetch.hpp"
+
+namespace TimeSteppers {
+/// \ingroup TimeSteppersGroup
+/// A term \f$c_i d_i\f$ in a fused_linear_combination, with an
+/// optional second coefficient \f$e_i\f$ used for an error estimate.
+template <typename T>
+struct FusedTerm {
+  double coefficient;
+  double error_coefficient;
+  const T* derivative;
+};
+
+/// \ingroup TimeSteppersGroup
+/// Storage for the terms of a fused_linear_combination.  The inline
+/// capacity covers the history lengths of all the steppers.
+template <typename T>
+using FusedTerms = boost::container::small_vector<FusedTerm<T>, 8>;
+
+namespace fused_linear_combination_detail {
+// Number of points processed per block.  The block of the result
+// stays in the L1 cache while all the terms are added to it.
+constexpr size_t block_size = 256;
+
+template <typename T>
+void impl(const gsl::not_null<T*> result, T* const error, const T& initial,
+          const FusedTerms<T>& terms) {
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    *result = initial;
+    if (error != nullptr) {
+      *error = 0.0;
+    }
+    for (const auto& term : terms) {
+      *result += term.coefficient * *term.derivative;
+      if (error != nullptr) {
+        *error += term.error_coefficient * *term.derivative;
+      }
+    }
+  } else {
+    const size_t size = result->size();
+    ASSERT(initial.size() == size, "Initial value has size "
+                                       << initial.size() << ", not " << size);
+    ASSERT(error == nullptr or error->size() == size,
+           "Error has size " << error->size() << ", not " << size);
+    for (const auto& term : terms) {
+      ASSERT(term.derivative->size() == size,
+             "Derivative has size " << term.derivative->size() << ", not "
+                                    << size);
+      sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(*term.derivative);
+    }
+    auto* const result_data = result->data();
+    auto* const error_data = error == nullptr ? nullptr : error->data();
+    const auto* const initial_data = initial.data();
+    for (size_t block_start = 0; block_start < size;
+         block_start += block_size) {
+      const size_t block_end = std::min(size, block_start + block_size);
+      if (result_data != initial_data) {
+        std::copy(initial_data + block_start, initial_data + block_end,
+                  result_data + block_start);
+      }
+      if (error_data != nullptr) {
+        std::fill(error_data + block_start, error_data + block_end, 0.0);
+      }
+      for (const auto& term : terms) {
+        const auto* const derivative_data = term.derivative->data();
+        if (term.coefficient != 0.0) {
+          for (size_t i = block_start; i < block_end; ++i) {
+            result_data[i] += term.coefficient * derivative_data[i];
+          }
+        }
+        if (error_data != nullptr and term.error_coefficient != 0.0) {
+          for (size_t i = block_start; i < block_end; ++i) {
+            error_data[i] += term.error_coefficient * derivative_data[i];
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace fused_linear_combination_detail
+
+/// @{
+/// \ingroup TimeSteppersGroup
+/// Sets \f$\text{result} = \text{initial} + \sum_i c_i d_i\f$ and,
+/// optionally, \f$\text{error} = \sum_i e_i d_i\f$, in a single pass
+/// over the data.
+///
+/// The terms are accumulated block by block, so each block of the
+/// result is written to memory once, however many terms there are,
+/// and no temporaries are allocated.  Terms with a zero coefficient
+/// are skipped.  \p result may be the same object as \p initial, but
+/// must not alias any of the derivatives.
+template <typename T>
+void fused_linear_combination(const gsl::not_null<T*> result,
+                              const T& initial, const FusedTerms<T>& terms) {
+  fused_linear_combination_detail::impl(result, nullptr, initial, terms);
+}
+
+template <typename T>
+void fused_linear_combination(const gsl::not_null<T*> result,
+                              const gsl::not_null<T*> error, const T& initial,
+                              const FusedTerms<T>& terms) {
+  fused_linear_combination_detail::impl(result, error.get(), initial, terms);
+}
+/// @}
+}  // namespace TimeSteppers
@@ -9,6 +9,8 @@ size_t Heun2::order() const { return 2; }
 
 size_t Heun2::error_estimate_order() const { return 1; }
 
+size_t Heun2::imex_order() const { return 2; }
+
 // The stability polynomial is
 //
 //   p(z) = \sum_{n=0}^{stages-1} alpha_n z^n / n!,
@@ -31,6 +33,14 @@ const RungeKutta::ButcherTableau& Heun2::butcher_tableau() const {
        {0.0, 0.0, 0.5}}};
   return tableau;
 }
+
+const ImexRungeKutta::ImplicitButcherTableau& Heun2::implicit_butcher_tableau()
+    const {
+  static const ImplicitButcherTableau tableau{
+      // Substep coefficients
+      {{0.5, 0.5}}};
+  return tableau;
+}
 }  // namespace TimeSteppers
 
 PUP::able::PUP_ID TimeSteppers::Heun2::my_PUP_ID = 0;  // NOLINT
@@ -6,7 +6,7 @@
 #include <cstddef>
 
 #include "Options/String.hpp"
-#include "Time/TimeSteppers/RungeKutta.hpp"
+#include "Time/TimeSteppers/ImexRungeKutta.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -34,8 +34,20 @@ namespace TimeSteppers {
  * of stages, and \f$\theta\f$ is the fraction of the step.
  *
  * The CFL factor/stable step size is 1.0.
+ *
+ * When used as an IMEX stepper, the implicit part is the trapezoidal
+ * rule, with the implicit tableau
+ *
+ * \f{align}{
+ *   \tilde{c}   &= \{0, 1\}, &
+ *   \tilde{A}   &= \begin{pmatrix} 0 & 0 \\ 1/2 & 1/2 \end{pmatrix}, &
+ *   \tilde{b}   &= \{1/2, 1/2\}.
+ * \f}
+ *
+ * The combined method is second order.  The implicit part is A-stable,
+ * but not L-stable, so very stiff modes are not damped.
  */
-class Heun2 : public RungeKutta {
+class Heun2 : public ImexRungeKutta {
  public:
   using options = tmpl::list<>;
   static constexpr Options::String help = {
@@ -52,6 +64,8 @@ class Heun2 : public RungeKutta {
 
   size_t error_estimate_order() const override;
 
+  size_t imex_order() const override;
+
   double stable_step() const override;
 
   WRAPPED_PUPable_decl_template(Heun2);  // NOLINT
@@ -59,6 +73,8 @@ class Heun2 : public RungeKutta {
   explicit Heun2(CkMigrateMessage* /*unused*/) {}
 
   const ButcherTableau& butcher_tableau() const override;
+
+  const ImplicitButcherTableau& implicit_butcher_tableau() const override;
 };
 
 inline bool constexpr operator==(const Heun2& /*lhs*/, const Heun2& /*rhs*/) {
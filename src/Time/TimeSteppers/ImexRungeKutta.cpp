@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/ImexRungeKutta.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Time/History.hpp"
+#include "Time/Time.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace TimeSteppers {
+
+template <typename T>
+void ImexRungeKutta::add_inhomogeneous_implicit_terms_impl(
+    const gsl::not_null<T*> u, const MutableUntypedHistory<T>& implicit_history,
+    const TimeDelta& time_step) const {
+  // Clean up old history.  The implicit history has no values, so
+  // there is nothing to discard on substeps.
+  if (implicit_history.at_step_start()) {
+    implicit_history.clear_substeps();
+    if (implicit_history.size() > 1) {
+      implicit_history.pop_front();
+    }
+  }
+  ASSERT(implicit_history.size() == 1,
+         "Have more than one step after cleanup.");
+
+  const uint64_t number_of_substeps = this->number_of_substeps();
+  const size_t substep = implicit_history.substeps().size();
+  const double dt = time_step.value();
+  const auto add_terms = [&](const std::vector<double>& coefficients,
+                             const size_t number_of_terms) {
+    for (size_t i = 0; i < number_of_terms; ++i) {
+      if (coefficients[i] != 0.0) {
+        *u += coefficients[i] * dt *
+              (i == 0 ? implicit_history.front()
+                      : implicit_history.substeps()[i - 1])
+                  .derivative;
+      }
+    }
+  };
+
+  if (substep == number_of_substeps - 1) {
+    const auto& coefficients = butcher_tableau().result_coefficients;
+    add_terms(coefficients, coefficients.size());
+  } else if (substep < number_of_substeps - 1) {
+    const auto& coefficients =
+        implicit_butcher_tableau().substep_coefficients[substep];
+    ASSERT(coefficients.size() == substep + 2,
+           "Implicit substep " << substep << " should have " << substep + 2
+                               << " coefficients, not "
+                               << coefficients.size());
+    // The last coefficient multiplies the unknown source at the end
+    // of the substep, and is handled by the implicit solve.
+    add_terms(coefficients, substep + 1);
+  } else {
+    ERROR("Substep should be less than " << number_of_substeps << ", not "
+                                         << substep);
+  }
+}
+
+template <typename T>
+double ImexRungeKutta::implicit_weight_impl(
+    const ConstUntypedHistory<T>& implicit_history,
+    const TimeDelta& time_step) const {
+  const size_t substep = implicit_history.at_step_start()
+                             ? 0
+                             : implicit_history.substeps().size();
+  if (substep >= number_of_substeps() - 1) {
+    return 0.0;
+  }
+  return implicit_butcher_tableau().substep_coefficients[substep].back() *
+         time_step.value();
+}
+
+IMEX_TIME_STEPPER_DEFINE_OVERLOADS(ImexRungeKutta)
+}  // namespace TimeSteppers
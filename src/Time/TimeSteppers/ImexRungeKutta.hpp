@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <vector>
+
+#include "Time/TimeSteppers/ImexTimeStepper.hpp"
+#include "Time/TimeSteppers/RungeKutta.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class TimeDelta;
+namespace TimeSteppers {
+template <typename T>
+class ConstUntypedHistory;
+template <typename T>
+class MutableUntypedHistory;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+/*!
+ * \ingroup TimeSteppersGroup
+ * Intermediate base class implementing a generic additive IMEX
+ * Runge-Kutta scheme.
+ *
+ * Implements the ImexTimeStepper interface in terms of an implicit
+ * Butcher tableau \f$\tilde{A}\f$ returned by the
+ * `implicit_butcher_tableau` function, in addition to the explicit
+ * tableau used by RungeKutta.  The implicit part uses the explicit
+ * substep times and result coefficients, and the final result does not
+ * require an implicit solve.  Derived classes must implement `imex_order`
+ * in addition to the RungeKutta requirements, and should not include the
+ * `IMEX_TIME_STEPPER_*` macros.
+ */
+class ImexRungeKutta : public ImexTimeStepper, public RungeKutta {
+ public:
+  struct ImplicitButcherTableau {
+    /*!
+     * The implicit coefficient matrix of the substeps.  Do not include
+     * the initial empty row or the coefficients for the full step.
+     * Each row contains one more entry than the corresponding row of
+     * the explicit tableau, with the last entry being the diagonal
+     * coefficient \f$\tilde{a}_{ii}\f$ multiplying the source at the
+     * new substep.  Often called \f$\tilde{A}\f$ in the literature.
+     */
+    std::vector<std::vector<double>> substep_coefficients;
+  };
+
+  virtual const ImplicitButcherTableau& implicit_butcher_tableau() const = 0;
+
+ private:
+  template <typename T>
+  void add_inhomogeneous_implicit_terms_impl(
+      gsl::not_null<T*> u, const MutableUntypedHistory<T>& implicit_history,
+      const TimeDelta& time_step) const;
+
+  template <typename T>
+  double implicit_weight_impl(const ConstUntypedHistory<T>& implicit_history,
+                              const TimeDelta& time_step) const;
+
+  IMEX_TIME_STEPPER_DECLARE_OVERLOADS
+};
+}  // namespace TimeSteppers
@@ -0,0 +1,173 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+
+#include "DataStructures/MathWrapper.hpp"
+#include "Time/History.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+
+/// \cond
+class TimeDelta;
+/// \endcond
+
+/// \cond
+#define IMEX_TIME_STEPPER_WRAPPED_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define IMEX_TIME_STEPPER_DERIVED_CLASS(data) BOOST_PP_TUPLE_ELEM(1, data)
+/// \endcond
+
+/// \ingroup TimeSteppersGroup
+///
+/// Base class for TimeSteppers with implicit-explicit (IMEX) support,
+/// derived from TimeStepper.
+///
+/// An IMEX stepper integrates an equation
+/// \f$\dot{u} = \mathcal{L}(u) + S(u)\f$, treating the (non-stiff)
+/// \f$\mathcal{L}\f$ explicitly using the usual TimeStepper interface
+/// and the (stiff) source \f$S\f$ implicitly.  The implicit source is
+/// recorded in a separate history containing no values, and each
+/// substep proceeds as:
+///
+/// 1. Record the explicit derivative in the main history and the
+///    implicit source in the implicit history.
+/// 2. Call `update_u` to apply the explicit part of the update.
+/// 3. Call `add_inhomogeneous_implicit_terms` to add the contributions
+///    of the already known implicit sources.
+/// 4. If `implicit_weight` returns a nonzero value \f$w\f$, solve
+///    \f$u = u^* + w S(u)\f$ for \f$u\f$, where \f$u^*\f$ is the value
+///    after step 3.  This solve is independent at each grid point for
+///    local sources.
+///
+/// Error estimates and dense output only include the explicit part of
+/// the evolution.
+///
+/// Several of the member functions of this class are templated and
+/// perform type erasure before forwarding their arguments to the
+/// derived classes.  This is implemented using the macros \ref
+/// IMEX_TIME_STEPPER_DECLARE_OVERLOADS, which must be placed in a
+/// private section of the class body, and
+/// IMEX_TIME_STEPPER_DEFINE_OVERLOADS(derived_class), which must be
+/// placed in the cpp file.
+class ImexTimeStepper : public virtual TimeStepper {
+ public:
+  WRAPPED_PUPable_abstract(ImexTimeStepper);  // NOLINT
+
+/// \cond
+#define IMEX_TIME_STEPPER_DECLARE_VIRTUALS_IMPL(_, data)                   \
+  virtual void add_inhomogeneous_implicit_terms_forward(                   \
+      gsl::not_null<IMEX_TIME_STEPPER_WRAPPED_TYPE(data)*> u,              \
+      const TimeSteppers::MutableUntypedHistory<                           \
+          IMEX_TIME_STEPPER_WRAPPED_TYPE(data)>& implicit_history,         \
+      const TimeDelta& time_step) const = 0;                               \
+  virtual double implicit_weight_forward(                                  \
+      const TimeSteppers::ConstUntypedHistory<                             \
+          IMEX_TIME_STEPPER_WRAPPED_TYPE(data)>& implicit_history,         \
+      const TimeDelta& time_step) const = 0;
+
+  GENERATE_INSTANTIATIONS(IMEX_TIME_STEPPER_DECLARE_VIRTUALS_IMPL,
+                          (MATH_WRAPPER_TYPES))
+#undef IMEX_TIME_STEPPER_DECLARE_VIRTUALS_IMPL
+  /// \endcond
+
+  /// Convergence order of the integrator when used in IMEX mode.
+  virtual size_t imex_order() const = 0;
+
+  /// Add the change for the current implicit substep,
+  /// \f$\Delta t \sum_j \tilde{a}_{ij} S_j\f$, from the already known
+  /// implicit sources in \p implicit_history.  This also discards
+  /// implicit history entries that are no longer needed, so it must be
+  /// called for every substep.
+  ///
+  /// Derived classes must implement this as a function with signature
+  ///
+  /// ```
+  /// template <typename T>
+  /// void add_inhomogeneous_implicit_terms_impl(
+  ///     gsl::not_null<T*> u, const MutableUntypedHistory<T>& implicit_history,
+  ///     const TimeDelta& time_step) const;
+  /// ```
+  ///
+  /// \note
+  /// Unlike the `update_u` methods, which overwrite the `u` argument,
+  /// this function adds the result to the existing value.
+  template <typename Vars>
+  void add_inhomogeneous_implicit_terms(
+      const gsl::not_null<Vars*> u,
+      const gsl::not_null<TimeSteppers::History<Vars>*> implicit_history,
+      const TimeDelta& time_step) const {
+    return add_inhomogeneous_implicit_terms_forward(
+        &*make_math_wrapper(u), implicit_history->untyped(), time_step);
+  }
+
+  /// The coefficient \f$w\f$ of the implicit source at the end of the
+  /// current substep, \f$u = u^* + w S(u)\f$.  A value of zero means
+  /// no implicit solve is required.  Must be called after
+  /// `add_inhomogeneous_implicit_terms`.
+  ///
+  /// Derived classes must implement this as a function with signature
+  ///
+  /// ```
+  /// template <typename T>
+  /// double implicit_weight_impl(
+  ///     const ConstUntypedHistory<T>& implicit_history,
+  ///     const TimeDelta& time_step) const;
+  /// ```
+  template <typename Vars>
+  double implicit_weight(
+      const TimeSteppers::History<Vars>& implicit_history,
+      const TimeDelta& time_step) const {
+    return implicit_weight_forward(implicit_history.untyped(), time_step);
+  }
+};
+
+/// \cond
+#define IMEX_TIME_STEPPER_DECLARE_OVERLOADS_IMPL(_, data)          \
+  void add_inhomogeneous_implicit_terms_forward(                   \
+      gsl::not_null<IMEX_TIME_STEPPER_WRAPPED_TYPE(data)*> u,      \
+      const TimeSteppers::MutableUntypedHistory<                   \
+          IMEX_TIME_STEPPER_WRAPPED_TYPE(data)>& implicit_history, \
+      const TimeDelta& time_step) const override;                  \
+  double implicit_weight_forward(                                  \
+      const TimeSteppers::ConstUntypedHistory<                     \
+          IMEX_TIME_STEPPER_WRAPPED_TYPE(data)>& implicit_history, \
+      const TimeDelta& time_step) const override;
+
+#define IMEX_TIME_STEPPER_DEFINE_OVERLOADS_IMPL(_, data)                  \
+  void IMEX_TIME_STEPPER_DERIVED_CLASS(data)::                            \
+      add_inhomogeneous_implicit_terms_forward(                           \
+          const gsl::not_null<IMEX_TIME_STEPPER_WRAPPED_TYPE(data)*> u,   \
+          const TimeSteppers::MutableUntypedHistory<                      \
+              IMEX_TIME_STEPPER_WRAPPED_TYPE(data)>& implicit_history,    \
+          const TimeDelta& time_step) const {                             \
+    return add_inhomogeneous_implicit_terms_impl(u, implicit_history,     \
+                                                 time_step);              \
+  }                                                                       \
+  double IMEX_TIME_STEPPER_DERIVED_CLASS(data)::implicit_weight_forward(  \
+      const TimeSteppers::ConstUntypedHistory<                            \
+          IMEX_TIME_STEPPER_WRAPPED_TYPE(data)>& implicit_history,        \
+      const TimeDelta& time_step) const {                                 \
+    return implicit_weight_impl(implicit_history, time_step);             \
+  }
+/// \endcond
+
+/// \ingroup TimeSteppersGroup
+/// Macro declaring overloaded detail methods in classes derived from
+/// ImexTimeStepper.  Must be placed in a private section of the class
+/// body.
+#define IMEX_TIME_STEPPER_DECLARE_OVERLOADS                         \
+  GENERATE_INSTANTIATIONS(IMEX_TIME_STEPPER_DECLARE_OVERLOADS_IMPL, \
+                          (MATH_WRAPPER_TYPES))
+
+/// \ingroup TimeSteppersGroup
+/// Macro defining overloaded detail methods in classes derived from
+/// ImexTimeStepper.  Must be placed in the cpp file for the derived
+/// class.
+#define IMEX_TIME_STEPPER_DEFINE_OVERLOADS(derived_class)          \
+  GENERATE_INSTANTIATIONS(IMEX_TIME_STEPPER_DEFINE_OVERLOADS_IMPL, \
+                          (MATH_WRAPPER_TYPES), (derived_class))
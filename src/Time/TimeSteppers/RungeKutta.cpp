@@ -4,10 +4,13 @@
 #include "Time/TimeSteppers/RungeKutta.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <vector>
 
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/History.hpp"
 #include "Time/Time.hpp"
+#include "Time/TimeSteppers/FusedLinearCombination.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Math.hpp"
@@ -60,27 +63,47 @@ TimeStepId RungeKutta::next_time_id_for_error(
 }
 
 namespace {
+// The derivative k_i of the current step used in the Butcher tableau.
 template <typename T>
-void compute_substep(const gsl::not_null<T*> u,
-                     const ConstUntypedHistory<T>& history, const double dt,
-                     const std::vector<double>& substep_coefficients) {
-  *u = *history.front().value;
-  if (substep_coefficients[0] != 0.0) {
-    *u += substep_coefficients[0] * dt * history.front().derivative;
-  }
-  for (size_t i = 1; i < substep_coefficients.size(); ++i) {
-    if (substep_coefficients[i] != 0.0) {
-      *u += substep_coefficients[i] * dt * history.substeps()[i - 1].derivative;
+const T& tableau_derivative(const ConstUntypedHistory<T>& history,
+                            const size_t i) {
+  return (i == 0 ? history.front() : history.substeps()[i - 1]).derivative;
+}
+
+// Terms a_i dt k_i of a substep.  If error coefficients are passed,
+// the terms also include the error estimate (a_i - e_i) dt k_i, so
+// that it can be computed in the same pass as the value.
+template <typename T>
+FusedTerms<T> substep_terms(
+    const ConstUntypedHistory<T>& history, const double dt,
+    const std::vector<double>& substep_coefficients,
+    const std::vector<double>& error_coefficients = {}) {
+  FusedTerms<T> terms{};
+  const size_t number_of_terms =
+      std::max(substep_coefficients.size(), error_coefficients.size());
+  for (size_t i = 0; i < number_of_terms; ++i) {
+    const double coefficient =
+        i < substep_coefficients.size() ? substep_coefficients[i] : 0.0;
+    const double error_coefficient =
+        error_coefficients.empty()
+            ? 0.0
+            : coefficient -
+                  (i < error_coefficients.size() ? error_coefficients[i] : 0.0);
+    if (coefficient != 0.0 or error_coefficient != 0.0) {
+      terms.push_back({coefficient * dt, error_coefficient * dt,
+                       &tableau_derivative(history, i)});
     }
   }
+  return terms;
 }
 
+// Cleans up the history and returns the coefficients for the current
+// substep.
 template <typename T>
-void update_u_impl_with_tableau(const gsl::not_null<T*> u,
-                                const MutableUntypedHistory<T>& history,
-                                const TimeDelta& time_step,
-                                const RungeKutta::ButcherTableau& tableau,
-                                const size_t number_of_substeps) {
+const std::vector<double>& prepare_substep(
+    const MutableUntypedHistory<T>& history,
+    const RungeKutta::ButcherTableau& tableau,
+    const size_t number_of_substeps) {
   // Clean up old history
   if (history.at_step_start()) {
     history.clear_substeps();
@@ -92,13 +115,11 @@ void update_u_impl_with_tableau(const gsl::not_null<T*> u,
   }
   ASSERT(history.size() == 1, "Have more than one step after cleanup.");
 
-  const double dt = time_step.value();
-
   const auto substep = history.substeps().size();
   if (substep == number_of_substeps - 1) {
-    compute_substep(u, history, dt, tableau.result_coefficients);
+    return tableau.result_coefficients;
   } else if (substep < number_of_substeps - 1) {
-    compute_substep(u, history, dt, tableau.substep_coefficients[substep]);
+    return tableau.substep_coefficients[substep];
   } else {
     ERROR("Substep should be less than " << number_of_substeps << ", not "
                                          << substep);
@@ -113,8 +134,11 @@ void RungeKutta::update_u_impl(const gsl::not_null<T*> u,
   ASSERT(history.integration_order() == order(),
          "Fixed-order stepper cannot run at order "
              << history.integration_order());
-  return update_u_impl_with_tableau(u, history, time_step, butcher_tableau(),
-                                    number_of_substeps());
+  const auto& coefficients =
+      prepare_substep(history, butcher_tableau(), number_of_substeps());
+  fused_linear_combination(
+      u, *history.front().value,
+      substep_terms(history, time_step.value(), coefficients));
 }
 
 template <typename T>
@@ -128,19 +152,22 @@ bool RungeKutta::update_u_impl(const gsl::not_null<T*> u,
 
   const auto& tableau = butcher_tableau();
   const auto number_of_substeps = number_of_substeps_for_error();
-  update_u_impl_with_tableau(u, history, time_step, tableau,
-                             number_of_substeps);
+  const auto& coefficients =
+      prepare_substep(history, tableau, number_of_substeps);
+  const double dt = time_step.value();
 
   const size_t substep = history.substeps().size();
 
   if (substep < number_of_substeps - 1) {
+    fused_linear_combination(u, *history.front().value,
+                             substep_terms(history, dt, coefficients));
     return false;
   }
 
-  const double dt = time_step.value();
-  compute_substep(u_error, history, dt, tableau.error_coefficients);
-  *u_error = *u - *u_error;
-
+  // The error estimate is computed in the same pass as the result.
+  fused_linear_combination(
+      u, u_error, *history.front().value,
+      substep_terms(history, dt, coefficients, tableau.error_coefficients));
   return true;
 }
 
@@ -171,7 +198,7 @@ bool RungeKutta::dense_update_u_impl(const gsl::not_null<T*> u,
 
   const auto& tableau = butcher_tableau();
 
-  *u = *history.front().value;
+  FusedTerms<T> terms{};
   const auto number_of_dense_coefficients = tableau.dense_coefficients.size();
   const size_t number_of_substep_terms = std::min(
       tableau.result_coefficients.size(), number_of_dense_coefficients);
@@ -179,8 +206,8 @@ bool RungeKutta::dense_update_u_impl(const gsl::not_null<T*> u,
     const double coef =
         evaluate_polynomial(tableau.dense_coefficients[i], output_fraction);
     if (coef != 0.0) {
-      *u += coef * step_size *
-            (i == 0 ? history.front() : history.substeps()[i - 1]).derivative;
+      terms.push_back(
+          {coef * step_size, 0.0, &tableau_derivative(history, i)});
     }
   }
 
@@ -189,10 +216,11 @@ bool RungeKutta::dense_update_u_impl(const gsl::not_null<T*> u,
     const double coef =
         evaluate_polynomial(tableau.dense_coefficients.back(), output_fraction);
     if (coef != 0.0) {
-      *u += coef * step_size * history.back().derivative;
+      terms.push_back({coef * step_size, 0.0, &history.back().derivative});
     }
   }
 
+  fused_linear_combination(u, *history.front().value, terms);
   return true;
 }
 
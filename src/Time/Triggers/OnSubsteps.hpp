@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <pup_stl.h>
 #include <utility>
@@ -59,6 +61,11 @@ class OnSubsteps : public Trigger {
     return trigger_->is_triggered(box);
   }
 
+  std::optional<FiringBound> next_firing_bound(
+      const std::int64_t slab_number, const double time) const override {
+    return trigger_->next_firing_bound(slab_number, time);
+  }
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override { p | trigger_; }
 
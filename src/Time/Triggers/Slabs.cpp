@@ -3,6 +3,30 @@
 
 #include "Time/Triggers/Slabs.hpp"
 
+#include <cstdint>
+#include <limits>
+#include <optional>
+
 namespace Triggers {
+std::optional<Trigger::FiringBound> Slabs::next_firing_bound(
+    const std::int64_t slab_number, const double /*time*/) const {
+  if (slab_number < 0) {
+    return std::nullopt;
+  }
+  const auto unsigned_slab = static_cast<std::uint64_t>(slab_number);
+  const auto slabs_near = slabs_->times_near(unsigned_slab);
+  const std::optional<std::uint64_t> next_slab =
+      slabs_near[1].has_value() and *slabs_near[1] > unsigned_slab
+          ? slabs_near[1]
+          : slabs_near[2];
+  FiringBound bound{};
+  bound.slab_number = std::numeric_limits<std::int64_t>::max();
+  if (next_slab.has_value() and
+      *next_slab < static_cast<std::uint64_t>(bound.slab_number)) {
+    bound.slab_number = static_cast<std::int64_t>(*next_slab);
+  }
+  return bound;
+}
+
 PUP::able::PUP_ID Slabs::my_PUP_ID = 0;  // NOLINT
 }  // namespace Triggers
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <pup_stl.h>
 #include <utility>
@@ -50,6 +51,10 @@ class Slabs : public Trigger {
     return slabs_->times_near(unsigned_slab)[1] == unsigned_slab;
   }
 
+  /// The next slab in the sequence
+  std::optional<FiringBound> next_firing_bound(std::int64_t slab_number,
+                                               double time) const override;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override { p | slabs_; }
 
@@ -3,6 +3,21 @@
 
 #include "Time/Triggers/Times.hpp"
 
+#include <cstdint>
+#include <limits>
+#include <optional>
+
 namespace Triggers {
+std::optional<Trigger::FiringBound> Times::next_firing_bound(
+    const std::int64_t /*slab_number*/, const double time) const {
+  const auto times_near = times_->times_near(time);
+  const std::optional<double> next_time =
+      times_near[1].has_value() and *times_near[1] > time ? times_near[1]
+                                                          : times_near[2];
+  FiringBound bound{};
+  bound.time = next_time.value_or(std::numeric_limits<double>::infinity());
+  return bound;
+}
+
 PUP::able::PUP_ID Times::my_PUP_ID = 0;  // NOLINT
 }  // namespace Triggers
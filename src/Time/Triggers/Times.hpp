@@ -4,7 +4,9 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <pup_stl.h>
 #include <utility>
@@ -59,6 +61,10 @@ class Times : public Trigger {
     return nearby_time and std::abs(*nearby_time - now) < sloppiness;
   }
 
+  /// The next time in the sequence
+  std::optional<FiringBound> next_firing_bound(std::int64_t slab_number,
+                                               double time) const override;
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override { p | times_; }
 
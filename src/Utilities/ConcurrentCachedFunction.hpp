@@ -0,0 +1,224 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines classes ConcurrentCachedFunction and LruCachedFunction
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <pup_stl.h>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+/// Usage statistics of a `ConcurrentCachedFunction` or `LruCachedFunction`
+struct CacheStatistics {
+  /// Number of calls that found the value in the cache
+  size_t hits = 0;
+  /// Number of calls that had to compute the value
+  size_t misses = 0;
+  /// Number of values that were removed to stay within the capacity
+  size_t evictions = 0;
+  size_t number_of_entries = 0;
+  /// Memory held by the cached values, as measured by their `pup` function
+  size_t size_in_bytes = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& os,
+                                const CacheStatistics& statistics) {
+  return os << "hits: " << statistics.hits << ", misses: " << statistics.misses
+            << ", evictions: " << statistics.evictions
+            << ", entries: " << statistics.number_of_entries
+            << ", bytes: " << statistics.size_in_bytes;
+}
+
+/*!
+ * \brief A function wrapper that caches function values and may be shared
+ * between threads.
+ *
+ * Unlike `CachedFunction`, values can be requested from multiple threads at
+ * once. Lookups of values that are already cached only take a shared lock, so
+ * they do not block each other. The function is evaluated without holding
+ * the lock, so it may itself use other cached functions. If two threads miss
+ * on the same input at the same time both evaluate the function and the
+ * first value inserted is kept.
+ *
+ * References returned by the call operator remain valid for the lifetime of
+ * the `ConcurrentCachedFunction`.
+ */
+template <typename Function, typename Input, typename Output>
+class ConcurrentCachedFunction {
+ public:
+  using input = Input;
+  using output = Output;
+
+  explicit ConcurrentCachedFunction(Function function)
+      : function_(std::move(function)) {}
+
+  /// Obtain the function result
+  const output& operator()(const input& x) const {
+    {
+      const std::shared_lock lock(mutex_);
+      const auto it = cache_.find(x);
+      if (it != cache_.end()) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+      }
+    }
+    output value = function_(x);
+    const std::unique_lock lock(mutex_);
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return cache_.try_emplace(x, std::move(value)).first->second;
+  }
+
+  CacheStatistics statistics() const {
+    const std::shared_lock lock(mutex_);
+    CacheStatistics result{};
+    result.hits = hits_.load(std::memory_order_relaxed);
+    result.misses = misses_.load(std::memory_order_relaxed);
+    result.number_of_entries = cache_.size();
+    for (const auto& [key, value] : cache_) {
+      result.size_in_bytes += size_of_object_in_bytes(value);
+    }
+    return result;
+  }
+
+ private:
+  Function function_;
+  mutable std::shared_mutex mutex_{};
+  // Elements of an `std::unordered_map` are not moved on insertion, so
+  // references to them stay valid.
+  mutable std::unordered_map<input, output> cache_{};
+  mutable std::atomic<size_t> hits_{0};
+  mutable std::atomic<size_t> misses_{0};
+};
+
+/// Construct a ConcurrentCachedFunction wrapping the given function
+///
+/// \example
+/// \snippet Test_ConcurrentCachedFunction.cpp make_concurrent_cached_function
+///
+/// \tparam Input function argument type
+/// \param function the function
+template <typename Input, typename Function>
+auto make_concurrent_cached_function(Function function) {
+  using output = std::invoke_result_t<const Function&, const Input&>;
+  return ConcurrentCachedFunction<Function, std::decay_t<Input>,
+                                  std::decay_t<output>>(std::move(function));
+}
+
+/*!
+ * \brief A function wrapper that caches at most `capacity` function values
+ * and may be shared between threads.
+ *
+ * When the cache is full, the value that was requested least recently is
+ * evicted. Use this instead of `ConcurrentCachedFunction` when the inputs keep
+ * changing over a run, e.g. when caching by time or by mesh, so the cache
+ * doesn't grow without bound.
+ *
+ * Since values can be evicted, the call operator returns a shared pointer to
+ * the value instead of a reference. The value stays alive as long as the
+ * pointer does, even if it is evicted from the cache in the meantime. All
+ * accesses take the same lock because hits reorder the entries, but the
+ * function is evaluated without holding the lock. If two threads miss on the
+ * same input at the same time both evaluate the function and the first value
+ * inserted is kept.
+ */
+template <typename Function, typename Input, typename Output>
+class LruCachedFunction {
+ public:
+  using input = Input;
+  using output = Output;
+
+  LruCachedFunction(Function function, const size_t capacity)
+      : function_(std::move(function)), capacity_(capacity) {
+    ASSERT(capacity_ > 0, "The capacity of the cache must be positive.");
+  }
+
+  /// Obtain the function result
+  std::shared_ptr<const output> operator()(const input& x) const {
+    {
+      const std::lock_guard lock(mutex_);
+      if (const auto it = index_.find(x); it != index_.end()) {
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->second;
+      }
+    }
+    auto value = std::make_shared<const output>(function_(x));
+    const std::lock_guard lock(mutex_);
+    ++misses_;
+    if (const auto it = index_.find(x); it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->second;
+    }
+    entries_.emplace_front(x, value);
+    index_.emplace(x, entries_.begin());
+    while (entries_.size() > capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+      ++evictions_;
+    }
+    return value;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  /// Clear the cache entries
+  void clear() {
+    const std::lock_guard lock(mutex_);
+    index_.clear();
+    entries_.clear();
+  }
+
+  CacheStatistics statistics() const {
+    const std::lock_guard lock(mutex_);
+    CacheStatistics result{};
+    result.hits = hits_;
+    result.misses = misses_;
+    result.evictions = evictions_;
+    result.number_of_entries = entries_.size();
+    for (const auto& [key, value] : entries_) {
+      result.size_in_bytes += size_of_object_in_bytes(*value);
+    }
+    return result;
+  }
+
+ private:
+  Function function_;
+  size_t capacity_;
+  mutable std::mutex mutex_{};
+  // Entries ordered from the most to the least recently requested.
+  // Iterators into an `std::list` stay valid when it is reordered.
+  using Entries = std::list<std::pair<input, std::shared_ptr<const output>>>;
+  mutable Entries entries_{};
+  mutable std::unordered_map<input, typename Entries::iterator> index_{};
+  mutable size_t hits_ = 0;
+  mutable size_t misses_ = 0;
+  mutable size_t evictions_ = 0;
+};
+
+/// Construct an LruCachedFunction wrapping the given function
+///
+/// \example
+/// \snippet Test_ConcurrentCachedFunction.cpp make_lru_cached_function
+///
+/// \tparam Input function argument type
+/// \param function the function
+/// \param capacity the maximum number of cached values
+template <typename Input, typename Function>
+auto make_lru_cached_function(Function function, const size_t capacity) {
+  using output = std::invoke_result_t<const Function&, const Input&>;
+  return LruCachedFunction<Function, std::decay_t<Input>,
+                           std::decay_t<output>>(std::move(function), capacity);
+}
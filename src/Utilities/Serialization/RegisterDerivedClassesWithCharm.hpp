@@ -53,6 +53,24 @@ std::string registration_name() {
   return result;
 }
 
+namespace detail {
+// Many classes appear in several of the lists registered at startup, e.g. the
+// coordinate maps of the domain creators and the factory classes of the
+// executable. We register each class only once so the duplicates don't have to
+// demangle the class name again.
+template <typename T>
+void register_class_with_charm() {
+  static const bool registered = []() {
+    // We use PUPable_reg2 because this takes as a second argument the name of
+    // the class (as a `const char*`), while PUPable_reg converts the argument
+    // verbatim to a string using the `#` preprocessor operator.
+    PUPable_reg2(T, registration_name<T>().c_str());
+    return true;
+  }();
+  (void)registered;
+}
+}  // namespace detail
+
 /// Register specified classes.  This function can either take classes
 /// to register as template arguments or take a `tmpl::list` of
 /// classes as a function argument.
@@ -60,12 +78,7 @@ template <typename... Registrants>
 void register_classes_with_charm(
     const tmpl::list<Registrants...> /*meta*/ = {}) {
   const auto helper = [](auto class_v) {
-    using class_to_register = typename decltype(class_v)::type;
-    // We use PUPable_reg2 because this takes as a second argument the name of
-    // the class (as a `const char*`), while PUPable_reg converts the argument
-    // verbatim to a string using the `#` preprocessor operator.
-    PUPable_reg2(class_to_register,
-                 registration_name<class_to_register>().c_str());
+    detail::register_class_with_charm<typename decltype(class_v)::type>();
   };
   (void)helper;
   EXPAND_PACK_LEFT_TO_RIGHT(helper(tmpl::type_<Registrants>{}));
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <iosfwd>
 
 namespace sys {
@@ -44,5 +46,49 @@ void prefetch(const void* address_to_prefetch) {
                      static_cast<int>(CacheLocation) & 0x3);
 }
 
+/// The size of a cache line in bytes on the architectures we run on.
+constexpr size_t cache_line_size = 64;
+
+/// \brief Prefetch the cache lines holding the `number_of_bytes` bytes
+/// starting at `address_to_prefetch` into a specific level of data cache.
+template <PrefetchTo CacheLocation>
+#if defined(__GNUC__)
+__attribute__((always_inline)) inline
+#endif
+void prefetch(const void* address_to_prefetch, const size_t number_of_bytes) {
+  const auto* const bytes = static_cast<const char*>(address_to_prefetch);
+  for (size_t offset = 0; offset < number_of_bytes;
+       offset += cache_line_size) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    prefetch<CacheLocation>(bytes + offset);
+  }
+}
+
+/// The number of bytes prefetched by `sys::prefetch_start_of`.
+constexpr size_t prefetch_start_of_bytes = 16 * cache_line_size;
+
+/*!
+ * \brief Prefetch the start of the contiguous `container` into a specific
+ * level of data cache.
+ *
+ * Use this in loops that traverse several separately allocated arrays, such
+ * as the entries of a time stepper history, by prefetching the next array
+ * while the current one is processed. The hardware prefetchers only pick up
+ * a sequential access pattern after a few cache misses and do not follow it
+ * across page boundaries, so the first cache lines of each array are
+ * otherwise always missed. The rest of the array is left to the hardware, so
+ * only the first `sys::prefetch_start_of_bytes` bytes are prefetched.
+ *
+ * The `Container` must have contiguous storage accessible through `data()`
+ * and `size()`.
+ */
+template <PrefetchTo CacheLocation, typename Container>
+void prefetch_start_of(const Container& container) {
+  prefetch<CacheLocation>(
+      container.data(),
+      std::min(prefetch_start_of_bytes,
+               container.size() * sizeof(*container.data())));
+}
+
 std::ostream& operator<<(std::ostream& os, PrefetchTo cache_location);
 }  // namespace sys
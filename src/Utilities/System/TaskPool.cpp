@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/System/TaskPool.hpp"
+
+#include <algorithm>
+#include <converse.h>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sys {
+namespace {
+size_t max_chunks_from_environment() {
+  const char* const env = std::getenv("SPECTRE_INTRA_ELEMENT_TASKS");
+  if (env == nullptr or std::string{env}.empty()) {
+    return 1;
+  }
+  const long value = std::strtol(env, nullptr, 10);
+  return value > 1 ? static_cast<size_t>(value) : 1;
+}
+
+void run_pending_chunks_while_idle(void* /*unused*/) {
+  // Only one chunk per call so incoming messages aren't delayed by more than
+  // a chunk.
+  task_pool().run_pending_chunk();
+}
+}  // namespace
+
+TaskPool::TaskPool() : max_chunks_(max_chunks_from_environment()) {}
+
+void TaskPool::parallel_for(const size_t size, const size_t min_chunk_size,
+                            const std::function<void(size_t, size_t)>& f) {
+  const size_t max_number_of_chunks = std::max(max_chunks(), size_t{1});
+  const size_t chunk_size =
+      std::max({min_chunk_size, size_t{1},
+                (size + max_number_of_chunks - 1) / max_number_of_chunks});
+  const size_t number_of_chunks = (size + chunk_size - 1) / chunk_size;
+  if (number_of_chunks < 2) {
+    f(0, size);
+    return;
+  }
+
+  const auto loop = std::make_shared<Loop>();
+  loop->function = &f;
+  loop->size = size;
+  loop->chunk_size = chunk_size;
+  loop->number_of_chunks = number_of_chunks;
+  loop->unfinished_chunks.store(number_of_chunks);
+  {
+    const std::lock_guard lock(mutex_);
+    loops_.push_back(loop);
+    ++number_of_loops_;
+  }
+
+  while (run_chunk(*loop)) {
+  }
+  {
+    const std::lock_guard lock(mutex_);
+    loops_.erase(std::find(loops_.begin(), loops_.end(), loop));
+    --number_of_loops_;
+  }
+  // Wait for the chunks other PEs are still running. Help with other loops
+  // in the meantime, e.g. those started by the helpers themselves.
+  while (loop->unfinished_chunks.load() != 0) {
+    if (not run_pending_chunk()) {
+      std::this_thread::yield();
+    }
+  }
+
+  if (loop->error != nullptr) {
+    std::rethrow_exception(loop->error);
+  }
+}
+
+bool TaskPool::run_pending_chunk() {
+  if (number_of_loops_.load() == 0) {
+    return false;
+  }
+  std::vector<std::shared_ptr<Loop>> loops{};
+  {
+    const std::lock_guard lock(mutex_);
+    loops = loops_;
+  }
+  for (const auto& loop : loops) {
+    if (run_chunk(*loop)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TaskPool::run_chunk(Loop& loop) {
+  const size_t chunk = loop.next_chunk.fetch_add(1);
+  if (chunk >= loop.number_of_chunks) {
+    return false;
+  }
+  const size_t begin = chunk * loop.chunk_size;
+  const size_t end = std::min(begin + loop.chunk_size, loop.size);
+  try {
+    (*loop.function)(begin, end);
+  } catch (...) {
+    const std::lock_guard lock(loop.error_mutex);
+    if (loop.error == nullptr) {
+      loop.error = std::current_exception();
+    }
+  }
+  --loop.unfinished_chunks;
+  return true;
+}
+
+TaskPool& task_pool() {
+  static TaskPool pool{};
+  return pool;
+}
+
+void register_task_pool_idle_helper() {
+  if (task_pool().max_chunks() > 1) {
+    CcdCallOnConditionKeep(CcdPROCESSOR_STILL_IDLE,
+                           &run_pending_chunks_while_idle, nullptr);
+  }
+}
+}  // namespace sys
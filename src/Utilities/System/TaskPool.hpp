@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sys {
+/*!
+ * \brief Splits loops over the data of a single element into chunks that the
+ * idle PEs of the process can help with.
+ *
+ * \details When there are few, very large elements per core, the volume work
+ * of one element can't be split between PEs by Charm++, so a PE that is done
+ * with its elements idles while another is still working. `parallel_for`
+ * splits a loop into chunks and runs them on the calling PE. At the same
+ * time, the other PEs of the process pick up chunks from the scheduler's idle
+ * callback (see `sys::register_task_pool_idle_helper`), so they only help
+ * when they have no messages to process. This includes the PEs kept free of
+ * elements with the `ReservedProcsPerNode` option of `Parallel::ResourceInfo`.
+ *
+ * The number of chunks a loop is split into is at most `max_chunks()`, which
+ * defaults to the value of the `SPECTRE_INTRA_ELEMENT_TASKS` environment
+ * variable. If the variable is not set or is smaller than 2 the loops are not
+ * split, and `parallel_for` simply calls the function on the whole range.
+ *
+ * The chunks must only write to disjoint data and must not call into
+ * Charm++, since they may run on any PE of the process. An exception thrown by
+ * a chunk is rethrown by `parallel_for` once all chunks have finished.
+ */
+class TaskPool {
+ public:
+  TaskPool();
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+  TaskPool(TaskPool&&) = delete;
+  TaskPool& operator=(TaskPool&&) = delete;
+  ~TaskPool() = default;
+
+  /// Call `f(begin, end)` on chunks of `[0, size)` of at least
+  /// `min_chunk_size` items (except for the last chunk), returning once all
+  /// chunks have finished.
+  void parallel_for(size_t size, size_t min_chunk_size,
+                    const std::function<void(size_t, size_t)>& f);
+
+  /// Run one pending chunk of a loop started by another thread, returning
+  /// `false` if there was none.
+  bool run_pending_chunk();
+
+  /// The maximum number of chunks a loop is split into
+  size_t max_chunks() const { return max_chunks_.load(); }
+  void set_max_chunks(size_t max_chunks) { max_chunks_.store(max_chunks); }
+
+ private:
+  struct Loop {
+    const std::function<void(size_t, size_t)>* function{nullptr};
+    size_t size{0};
+    size_t chunk_size{0};
+    size_t number_of_chunks{0};
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<size_t> unfinished_chunks{0};
+    std::mutex error_mutex{};
+    std::exception_ptr error{};
+  };
+
+  // Returns `false` if all chunks of `loop` have already been claimed.
+  static bool run_chunk(Loop& loop);
+
+  std::atomic<size_t> max_chunks_{1};
+  std::mutex mutex_{};
+  std::vector<std::shared_ptr<Loop>> loops_{};
+  // Lets idle PEs skip the mutex when there is nothing to do.
+  std::atomic<size_t> number_of_loops_{0};
+};
+
+/// Loops are only split into chunks of at least this many grid points, so the
+/// work of a chunk outweighs the cost of handing it to another PE.
+constexpr size_t min_points_per_task = 4096;
+
+/// The `min_chunk_size` to pass to `sys::TaskPool::parallel_for` for a loop
+/// over items, e.g. tensor components, of `points_per_item` grid points each
+constexpr size_t min_items_per_task(const size_t points_per_item) {
+  return points_per_item >= min_points_per_task
+             ? 1
+             : (min_points_per_task + points_per_item - 1) /
+                   (points_per_item == 0 ? 1 : points_per_item);
+}
+
+/// The `sys::TaskPool` shared by all PEs of this process
+TaskPool& task_pool();
+
+/// Register a callback with the Charm++ scheduler of this PE that runs pending
+/// `sys::TaskPool` chunks while the PE is idle. Called on every PE at startup.
+void register_task_pool_idle_helper();
+}  // namespace sys
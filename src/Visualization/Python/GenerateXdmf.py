@@ -13,6 +13,7 @@ import logging
 import os
 import sys
 import xml.etree.ElementTree as ET
+from multiprocessing import Pool
 from typing import Optional
 
 import click
@@ -268,6 +269,27 @@ def _xmf_grid(
     return xmf_grid
 
 
+def _missing_connectivity(h5file, subfile_name: str) -> bool:
+    if subfile_name not in h5file:
+        return False
+    return any(
+        "connectivity" not in observation
+        for observation in h5file[subfile_name].values()
+    )
+
+
+def _generate_connectivity(filename_and_subfile_name):
+    import spectre.IO.H5 as spectre_h5
+
+    filename, subfile_name = filename_and_subfile_name
+    logger.info(f"Generating connectivity in '{filename}'.")
+    h5file = spectre_h5.H5File(filename, "a")
+    volfile = h5file.get_vol("/" + subfile_name.lstrip("/"))
+    for observation_id in volfile.list_observation_ids():
+        volfile.generate_connectivity(observation_id)
+    h5file.close()
+
+
 def generate_xdmf(
     h5files,
     output: str,
@@ -277,6 +299,8 @@ def generate_xdmf(
     stop_time: Optional[float] = None,
     stride: int = 1,
     coordinates: str = "InertialCoordinates",
+    num_jobs: Optional[int] = None,
+    incremental: bool = False,
 ):
     """Generate an XDMF file for ParaView and VisIt
 
@@ -288,6 +312,15 @@ def generate_xdmf(
     To load the XDMF file in ParaView you must choose the 'Xdmf Reader', NOT
     'Xdmf3 Reader'.
 
+    The connectivity of the elements is generated from the stored extents and
+    written to the 'H5FILES' if the simulation didn't write it (see the
+    'WriteVolumeConnectivity' option of the observers). The files are
+    processed in parallel.
+
+    To monitor a run that is still writing volume data, regenerate the XDMF
+    file with '--incremental'. Then only observations that are not yet in the
+    output file are read from the H5 files and appended.
+
     \f
     Arguments:
       h5files: List of H5 volume data files.
@@ -302,11 +335,20 @@ def generate_xdmf(
       stride: Optional. View only every stride'th time step.
       coordinates: Optional. Name of coordinates dataset. Default:
         "InertialCoordinates".
+      num_jobs: Optional. The maximum number of processes that generate
+        missing connectivity. Default: the number of CPUs.
+      incremental: Optional. If True, keep the grids in an existing 'output'
+        file and only add the observations that are missing from it.
     """
     # CLI scripts should be noops when input is empty
     if not h5files:
         return
 
+    if output and not output.endswith(".xmf"):
+        output += ".xmf"
+    if incremental and not output:
+        raise ValueError("Specify an 'output' file to update incrementally.")
+
     h5files = [(h5py.File(filename, "r"), filename) for filename in h5files]
 
     if not subfile_name:
@@ -324,19 +366,61 @@ def generate_xdmf(
     if not subfile_name.endswith(".vol"):
         subfile_name += ".vol"
 
-    # Prepare XDMF document by building up an XML tree
-    xmf_root = ET.Element("Xdmf", Version="2.0")
-    xmf_domain = ET.SubElement(xmf_root, "Domain")
-    xmf_timesteps = ET.SubElement(
-        xmf_domain,
-        "Grid",
-        Name="Evolution",
-        GridType="Collection",
-        CollectionType="Temporal",
-    )
+    # Generate the connectivity where it is missing. This needs write access,
+    # so the files are reopened afterwards.
+    files_missing_connectivity = [
+        filename
+        for h5file, filename in h5files
+        if _missing_connectivity(h5file, subfile_name)
+    ]
+    if files_missing_connectivity:
+        for h5file, _ in h5files:
+            h5file.close()
+        with Pool(num_jobs) as pool:
+            pool.map(
+                _generate_connectivity,
+                [
+                    (filename, subfile_name)
+                    for filename in files_missing_connectivity
+                ],
+            )
+        h5files = [
+            (h5py.File(filename, "r"), filename) for _, filename in h5files
+        ]
+
     # Collect timesteps in a hash map before inserting into XML so we can insert
     # grids while stepping through H5 files
     timesteps = dict()
+    # The (filename, subfile name, temporal ID) of the grids that are already
+    # in the output file when updating it incrementally
+    existing_grids = set()
+
+    if incremental and os.path.exists(output):
+        # Continue the existing XDMF document. Its grids point into the H5
+        # files, so they tell us which observations we have already processed.
+        xmf_root = ET.parse(output).getroot()
+        xmf_timesteps = xmf_root.find("Domain/Grid")
+        for xmf_timestep_grid in xmf_timesteps:
+            for xmf_data_item in xmf_timestep_grid.iter("DataItem"):
+                if xmf_data_item.text is None or ":/" not in xmf_data_item.text:
+                    continue
+                grid_filename, grid_path = xmf_data_item.text.split(":/", 1)
+                grid_subfile_name, temporal_id, _ = grid_path.rsplit("/", 2)
+                existing_grids.add(
+                    (grid_filename, grid_subfile_name, temporal_id)
+                )
+                timesteps[temporal_id] = xmf_timestep_grid
+    else:
+        # Prepare XDMF document by building up an XML tree
+        xmf_root = ET.Element("Xdmf", Version="2.0")
+        xmf_domain = ET.SubElement(xmf_root, "Domain")
+        xmf_timesteps = ET.SubElement(
+            xmf_domain,
+            "Grid",
+            Name="Evolution",
+            GridType="Collection",
+            CollectionType="Temporal",
+        )
 
     for h5file, filename in h5files:
         # Open subfile
@@ -375,6 +459,13 @@ def generate_xdmf(
                 continue
             if stop_time is not None and time > stop_time:
                 break
+            # Skip observations that are already in the output file
+            if (
+                filename_in_output,
+                subfile_name,
+                temporal_id,
+            ) in existing_grids:
+                continue
 
             # A timestep is represented by a collection of grids. We store the
             # grid collection in a hash map so each H5 file can insert grids.
@@ -417,6 +508,14 @@ def generate_xdmf(
     for h5file in h5files:
         h5file[0].close()
 
+    # Appended timesteps may be earlier than existing ones, e.g. if files of
+    # another segment were added, so we sort the timesteps by time again
+    if incremental:
+        xmf_timesteps[:] = sorted(
+            xmf_timesteps,
+            key=lambda xmf_grid: float(xmf_grid.find("Time").get("Value")),
+        )
+
     # Pretty-print XML
     try:
         # Added in Py 3.9
@@ -432,8 +531,6 @@ def generate_xdmf(
     xmf_document += ET.tostring(xmf_root, encoding="unicode")
     xmf_document += "\n"
     if output:
-        if not output.endswith(".xmf"):
-            output += ".xmf"
         with open(output, "w") as open_output_file:
             open_output_file.write(xmf_document)
     else:
@@ -496,6 +593,25 @@ def generate_xdmf(
     show_default=True,
     help="The coordinates to use for visualization",
 )
+@click.option(
+    "-j",
+    "--num-jobs",
+    type=int,
+    default=None,
+    help=(
+        "The maximum number of processes that generate missing connectivity. "
+        "Defaults to the number of CPUs."
+    ),
+)
+@click.option(
+    "--incremental",
+    is_flag=True,
+    help=(
+        "Keep the grids in an existing output file and only add the "
+        "observations that are missing from it. Useful to monitor a run that "
+        "is still writing volume data."
+    ),
+)
 def generate_xdmf_command(**kwargs):
     _rich_traceback_guard = True  # Hide traceback until here
     generate_xdmf(**kwargs)
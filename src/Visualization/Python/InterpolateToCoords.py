@@ -100,24 +100,29 @@ def interpolate_to_coords(
                 for component in tensor_components
             ]
         )
+        # The grids are stored one after the other, so we compute all offsets
+        # at once instead of searching for each grid
+        grid_lengths = np.prod(all_extents, axis=1)
+        grid_offsets = dict(
+            zip(
+                all_element_ids,
+                zip(np.cumsum(grid_lengths) - grid_lengths, grid_lengths),
+            )
+        )
         # Map the target points to element-logical coordinates
         element_logical_coords = element_logical_coordinates(
             all_element_ids, block_logical_coords
         )
         for element_id, point in element_logical_coords.items():
-            offset, length = spectre_h5.offset_and_length_for_grid(
-                str(element_id), all_grid_names, all_extents
-            )
+            offset, length = grid_offsets[element_id]
             element_data = tensor_data[:, offset : offset + length]
             interpolant = Irregular[dim](
                 source_mesh=meshes[element_id],
                 target_logical_coords=point.element_logical_coords,
             )
-            interpolated_data[:, point.offsets] = np.asarray(
-                [
-                    interpolant.interpolate(DataVector(component))
-                    for component in element_data
-                ]
+            # Interpolate all tensor components at once
+            interpolated_data[:, point.offsets] = interpolant.interpolate(
+                element_data
             )
             filled_data[point.offsets] = True
         # Terminate early if all data has been filled
@@ -143,20 +143,26 @@ def interpolate_to_mesh(
         source_file.close_current_object()
 
         volume_data = []
+        # Most elements share their mesh, so we construct an interpolant only
+        # once for each distinct source mesh
+        interpolants = {}
+        # The grids are stored one after the other, so we compute the offsets
+        # as we go instead of searching for each grid
+        offset = 0
         # iterate over elements
         for grid_name, extent, basis, quadrature in zip(
             grid_names, extents, bases, quadratures
         ):
-            source_mesh = Spectral.Mesh[dim](extent, basis, quadrature)
-
-            interpolant = Interpolation.RegularGrid[dim](
-                source_mesh, target_mesh
-            )
+            mesh_key = (tuple(extent), tuple(basis), tuple(quadrature))
+            if mesh_key not in interpolants:
+                source_mesh = Spectral.Mesh[dim](extent, basis, quadrature)
+                interpolants[mesh_key] = Interpolation.RegularGrid[dim](
+                    source_mesh, target_mesh
+                )
+            interpolant = interpolants[mesh_key]
 
             tensor_comps = []
-            offset, length = spectre_h5.offset_and_length_for_grid(
-                grid_name, grid_names, extents
-            )
+            length = int(np.prod(extent))
             # iterate over tensors
             for j, tensor in enumerate(tensors):
                 component_data = DataVector(
@@ -170,6 +176,8 @@ def interpolate_to_mesh(
                     )
                 )
 
+            offset += length
+
             volume_data.append(
                 ElementVolumeData(
                     element_name=grid_name,
@@ -3,7 +3,7 @@
 
 import logging
 from pathlib import Path
-from typing import Iterable, List, Tuple, Union
+from typing import Iterable, Iterator, List, Tuple, Union
 
 import h5py
 import numpy as np
@@ -95,6 +95,151 @@ def to_dataframe(
     return pd.DataFrame(data, columns=legend)
 
 
+# Datasets in an observation of a volume data subfile that are not tensor
+# components
+_VOLUME_METADATA = {
+    "bases",
+    "connectivity",
+    "domain",
+    "functions_of_time",
+    "grid_names",
+    "pole_connectivity",
+    "quadratures",
+    "total_extents",
+}
+
+
+def _grid_names(observation: h5py.Group) -> List[str]:
+    # The grid names are stored as characters, separated by ':'
+    return (
+        np.asarray(observation["grid_names"]).tobytes().decode().split(":")
+    )
+
+
+class LazyVolumeData:
+    """Read volume data from one or more H5 files on demand
+
+    Nothing but the observation values is read when the files are opened.
+    Tensor components are read only when requested, one observation at a time
+    or even one element at a time, so the volume data doesn't have to fit in
+    memory. Use this class in analysis scripts that step through large volume
+    data, and the 'spectre.IO.H5' bindings for everything that needs
+    structural information such as the domain.
+
+    The H5 files of a single observation, e.g. the 'VolumeData*.h5' files
+    written by all nodes, are combined. Files of different segments can be
+    combined as well. Observations are ordered by time and counted by their
+    'step' starting at 0.
+
+    Use as a context manager so the files get closed:
+
+        with LazyVolumeData(glob.glob("VolumeData*.h5"), "VolumeData") as data:
+            for step in range(len(data)):
+                psi = data.tensor_component("Psi", step)
+    """
+
+    def __init__(
+        self,
+        h5files: Union[str, Path, Iterable[Union[str, Path]]],
+        subfile_name: str,
+    ):
+        if isinstance(h5files, (str, Path)):
+            h5files = [h5files]
+        if not subfile_name.endswith(".vol"):
+            subfile_name += ".vol"
+        self._open_files = [h5py.File(h5file, "r") for h5file in h5files]
+        self._subfiles = [
+            open_file[subfile_name]
+            for open_file in self._open_files
+            if subfile_name in open_file
+        ]
+        assert self._subfiles, f"No subfile '{subfile_name}' found in files."
+        self.dim = int(self._subfiles[0].attrs["dimension"])
+        observation_values = {}
+        for subfile in self._subfiles:
+            for obs_id, observation in subfile.items():
+                observation_values.setdefault(
+                    obs_id, observation.attrs["observation_value"]
+                )
+        self._observation_ids = sorted(
+            observation_values, key=observation_values.get
+        )
+        self.times = np.array(
+            [observation_values[obs_id] for obs_id in self._observation_ids]
+        )
+
+    def close(self):
+        for open_file in self._open_files:
+            open_file.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+    def __len__(self) -> int:
+        return len(self._observation_ids)
+
+    def _observations(self, step: int) -> Iterator[h5py.Group]:
+        obs_id = self._observation_ids[step]
+        for subfile in self._subfiles:
+            if obs_id in subfile:
+                yield subfile[obs_id]
+
+    def tensor_components(self, step: int) -> List[str]:
+        """Names of all tensor components at the observation 'step'"""
+        observation = next(self._observations(step))
+        return sorted(set(observation.keys()) - _VOLUME_METADATA)
+
+    def grid_names(self, step: int) -> List[str]:
+        """Names of all elements at the observation 'step', in the order in
+        which their data are stored"""
+        return [
+            grid_name
+            for observation in self._observations(step)
+            for grid_name in _grid_names(observation)
+        ]
+
+    def extents(self, step: int) -> np.ndarray:
+        """Extents of all elements at the observation 'step', as an array of
+        shape (num_elements, dim)"""
+        return np.concatenate(
+            [
+                np.reshape(observation["total_extents"], (-1, self.dim))
+                for observation in self._observations(step)
+            ]
+        )
+
+    def tensor_component(self, component: str, step: int) -> np.ndarray:
+        """Read the data of a tensor component at the observation 'step' for
+        all elements"""
+        return np.concatenate(
+            [
+                np.asarray(observation[component])
+                for observation in self._observations(step)
+            ]
+        )
+
+    def iter_elements(
+        self, component: str, step: int
+    ) -> Iterator[Tuple[str, np.ndarray]]:
+        """Read the data of a tensor component at the observation 'step' one
+        element at a time
+
+        Yields: Tuples of the element name and its data.
+        """
+        for observation in self._observations(step):
+            grid_names = _grid_names(observation)
+            extents = np.reshape(observation["total_extents"], (-1, self.dim))
+            dataset = observation[component]
+            offset = 0
+            for grid_name, grid_extents in zip(grid_names, extents):
+                length = int(np.prod(grid_extents))
+                yield grid_name, dataset[offset : offset + length]
+                offset += length
+
+
 def select_observation(
     volfiles: Union["spectre.IO.H5.H5Vol", Iterable["spectre.IO.H5.H5Vol"]],
     step: int = None,
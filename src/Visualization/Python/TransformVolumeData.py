@@ -3,10 +3,12 @@
 
 import importlib
 import inspect
+import io
 import logging
 import re
 from dataclasses import dataclass
 from functools import cached_property
+from multiprocessing import Pool
 from pydoc import locate
 from typing import Dict, Iterable, List, Optional, Sequence, Tuple, Type, Union
 
@@ -508,13 +510,8 @@ def transform_volume_data(
             # Load tensor data for all kernels
             all_tensor_data = {
                 tensor_name: tensor_arg.tensor_type(
-                    np.array(
-                        [
-                            volfile.get_tensor_component(
-                                obs_id, component_name
-                            ).data
-                            for component_name in tensor_arg.component_names
-                        ]
+                    volfile.get_tensor_components_array(
+                        obs_id, tensor_arg.component_names
                     )
                 )
                 for tensor_name, tensor_arg in all_tensors.items()
@@ -553,15 +550,20 @@ def transform_volume_data(
                                 )
                 continue
 
-            # Apply kernels
-            for kernel in kernels:
-                # Elementwise kernels need to slice the tensor data into
-                # elements, and reassemble the result into a contiguous dataset
-                if kernel.elementwise:
-                    transformed_tensors_data: Dict[
-                        str, Tuple[np.ndarray, Type[Tensor]]
-                    ] = {}
-                    for element in iter_elements(volfile, obs_id):
+            # Apply elementwise kernels. They need to slice the tensor data
+            # into elements, and reassemble the result into contiguous
+            # datasets. We iterate over the elements only once for all kernels
+            # because setting up the elements (e.g. their Jacobians) is
+            # expensive.
+            elementwise_kernels = [
+                kernel for kernel in kernels if kernel.elementwise
+            ]
+            transformed_tensors_data: Dict[
+                str, Tuple[np.ndarray, Type[Tensor]]
+            ] = {}
+            if elementwise_kernels:
+                for element in iter_elements(volfile, obs_id):
+                    for kernel in elementwise_kernels:
                         transformed_tensors = kernel(all_tensor_data, element)
                         for (
                             output_name,
@@ -585,40 +587,93 @@ def transform_volume_data(
                                 transformed_tensor_data[
                                     i, element.data_slice
                                 ] = component
-                    transformed_tensors = {
-                        output_name: tensor_type(
-                            transformed_tensor_data, copy=False
-                        )
-                        for output_name, (
-                            transformed_tensor_data,
-                            tensor_type,
-                        ) in transformed_tensors_data.items()
-                    }
-                else:
-                    transformed_tensors = kernel(all_tensor_data, None)
-
-                # Write result back into volfile
-                for (
-                    output_name,
-                    transformed_tensor,
-                ) in transformed_tensors.items():
-                    output_names.add(output_name)
-                    for i, component in enumerate(transformed_tensor):
-                        volfile.write_tensor_component(
-                            obs_id,
-                            component_name=(
-                                output_name
-                                + transformed_tensor.component_suffix(i)
-                            ),
-                            contiguous_tensor_data=component,
-                            overwrite_existing=force,
-                        )
+            transformed_tensors = {
+                output_name: tensor_type(transformed_tensor_data, copy=False)
+                for output_name, (
+                    transformed_tensor_data,
+                    tensor_type,
+                ) in transformed_tensors_data.items()
+            }
+            # Apply kernels that operate on the full volume data
+            for kernel in kernels:
+                if not kernel.elementwise:
+                    transformed_tensors.update(kernel(all_tensor_data, None))
+
+            # Write results back into volfile
+            for (
+                output_name,
+                transformed_tensor,
+            ) in transformed_tensors.items():
+                output_names.add(output_name)
+                for i, component in enumerate(transformed_tensor):
+                    volfile.write_tensor_component(
+                        obs_id,
+                        component_name=(
+                            output_name + transformed_tensor.component_suffix(i)
+                        ),
+                        contiguous_tensor_data=component,
+                        overwrite_existing=force,
+                    )
     if integrate:
         return integrals
     else:
         logger.info(f"Output datasets: {output_names}")
 
 
+def _transform_volume_file(
+    h5file: str,
+    subfile_name: str,
+    kernel_names: Sequence[str],
+    exec_sources: Sequence[str],
+    map_input_names: Dict[str, str],
+    integrate: bool,
+    force: bool,
+) -> Union[None, Dict[str, Sequence[float]]]:
+    """Applies the kernels to a single H5 file
+
+    This runs in the worker processes of 'transform_volume_data_command', so
+    the kernels are loaded again from their names because functions can't
+    always be sent to other processes.
+    """
+    kernels = list(
+        parse_kernels(
+            kernel_names,
+            [io.StringIO(exec_source) for exec_source in exec_sources],
+            map_input_names,
+        )
+    )
+    with spectre_h5.H5File(h5file, "r" if integrate else "a") as open_h5_file:
+        return transform_volume_data(
+            open_h5_file.get_vol(subfile_name),
+            kernels=kernels,
+            integrate=integrate,
+            force=force,
+        )
+
+
+# Function to forward arguments to the multiprocessing Pool. We can not use a
+# lambda because the function needs to be pickled.
+def _forward_kwargs(kwargs):
+    return _transform_volume_file(**kwargs)
+
+
+def _sum_integrals(
+    all_integrals: Iterable[Dict[str, Sequence[float]]]
+) -> Dict[str, Sequence[float]]:
+    """Sums the integrals over several files, like 'transform_volume_data'
+    does when it is called with all files at once"""
+    integrals: Dict[str, Sequence[float]] = {}
+    for file_integrals in all_integrals:
+        for name, values in file_integrals.items():
+            if name == "Time":
+                integrals.setdefault(name, values)
+            elif name in integrals:
+                integrals[name] += values
+            else:
+                integrals[name] = np.array(values)
+    return integrals
+
+
 def parse_input_names(ctx, param, all_values):
     if all_values is None:
         return {}
@@ -728,6 +783,18 @@ def parse_kernels(kernels, exec_files, map_input_names):
     is_flag=True,
     help="Overwrite existing data.",
 )
+@click.option(
+    "-j",
+    "--num-jobs",
+    type=int,
+    default=1,
+    show_default=True,
+    help=(
+        "The maximum number of processes to be started. "
+        "The files are distributed over the processes, so "
+        "more processes than files don't speed things up."
+    ),
+)
 def transform_volume_data_command(
     h5files,
     subfile_name,
@@ -738,6 +805,7 @@ def transform_volume_data_command(
     output,
     output_subfile,
     force,
+    num_jobs,
     **kwargs,
 ):
     """Transform volume data with Python functions
@@ -810,7 +878,15 @@ def transform_volume_data_command(
     # Load kernels
     if not kernels:
         raise click.UsageError("No '--kernel' / '-k' specified.")
-    kernels = list(parse_kernels(kernels, exec_files, map_input_names))
+    kernel_names = kernels
+    exec_sources = [exec_file.read() for exec_file in exec_files]
+    kernels = list(
+        parse_kernels(
+            kernel_names,
+            [io.StringIO(exec_source) for exec_source in exec_sources],
+            map_input_names,
+        )
+    )
 
     # Apply!
     import rich.progress
@@ -823,16 +899,42 @@ def transform_volume_data_command(
         disable=(len(volfiles) == 1),
     )
     task_id = progress.add_task("Applying to files")
-    volfiles_progress = progress.track(volfiles, task_id=task_id)
-    with progress:
-        integrals = transform_volume_data(
-            volfiles_progress,
-            kernels=kernels,
-            integrate=integrate,
-            force=force,
-            **kwargs,
-        )
-        progress.update(task_id, completed=len(volfiles))
+    if num_jobs == 1 or len(volfiles) == 1:
+        volfiles_progress = progress.track(volfiles, task_id=task_id)
+        with progress:
+            integrals = transform_volume_data(
+                volfiles_progress,
+                kernels=kernels,
+                integrate=integrate,
+                force=force,
+                **kwargs,
+            )
+            progress.update(task_id, completed=len(volfiles))
+    else:
+        # Each process opens its own file, so we close the files here
+        for open_h5_file in open_h5_files:
+            open_h5_file.close()
+        transform_kwargs = [
+            dict(
+                h5file=h5file,
+                subfile_name=subfile_name,
+                kernel_names=kernel_names,
+                exec_sources=exec_sources,
+                map_input_names=map_input_names,
+                integrate=integrate,
+                force=force,
+            )
+            for h5file in h5files
+        ]
+        with progress, Pool(num_jobs) as pool:
+            all_integrals = list(
+                progress.track(
+                    pool.imap(_forward_kwargs, transform_kwargs),
+                    total=len(transform_kwargs),
+                    task_id=task_id,
+                )
+            )
+        integrals = _sum_integrals(all_integrals) if integrate else None
 
     # Write integrals to output file or print to terminal
     if integrate:
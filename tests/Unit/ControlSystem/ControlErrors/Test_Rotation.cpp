@@ -49,6 +49,7 @@ void test_rotation_control_error() {
       "ControlSystems:\n"
       "  WriteDataToDisk: false\n"
       "  MeasurementsPerUpdate: 4\n"
+      "  MeasurementsBeforeExpiration: 1\n"
       "  Rotation:\n"
       "    IsActive: true\n"
       "    Averager:\n"
@@ -90,8 +91,8 @@ void test_rotation_control_error() {
   // global cache
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   MockRuntimeSystem runner{
-      {"DummyFileName", std::move(domain), 4, false, ::Verbosity::Silent,
-       std::move(is_active_map), std::move(grid_center_A),
+      {"DummyFileName", std::move(domain), 4, 1, 1.0, false,
+       ::Verbosity::Silent, std::move(is_active_map), std::move(grid_center_A),
        std::move(grid_center_B), std::move(system_to_combined_names)},
       {std::move(initial_functions_of_time),
        std::move(initial_measurement_timescales)}};
@@ -152,9 +152,10 @@ void test_shape_control_error() {
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   // Excision centers aren't used so their values can be anything
   MockRuntimeSystem runner{
-      {"DummyFilename", std::move(fake_domain), 4, false, ::Verbosity::Silent,
-       std::unordered_map<std::string, bool>{}, std::move(grid_center_A),
-       std::move(grid_center_B), std::move(system_to_combined_names)},
+      {"DummyFilename", std::move(fake_domain), 4, 1, 1.0, false,
+       ::Verbosity::Silent, std::unordered_map<std::string, bool>{},
+       std::move(grid_center_A), std::move(grid_center_B),
+       std::move(system_to_combined_names)},
       {std::move(initial_functions_of_time),
        std::move(initial_measurement_timescales)}};
   ActionTesting::emplace_array_component<element_component>(
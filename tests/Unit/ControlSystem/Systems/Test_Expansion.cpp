@@ -66,6 +66,7 @@ void test_expansion_control_system() {
       "ControlSystems:\n"
       "  WriteDataToDisk: false\n"
       "  MeasurementsPerUpdate: 4\n"
+      "  MeasurementsBeforeExpiration: 1\n"
       "  Expansion:\n"
       "    IsActive: true\n"
       "    Averager:\n"
@@ -106,8 +107,8 @@ void test_expansion_control_system() {
   // Setup runner and all components
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   MockRuntimeSystem runner{
-      {"DummyFileName", std::move(domain), 4, false, ::Verbosity::Silent,
-       std::move(is_active_map), std::move(grid_center_A),
+      {"DummyFileName", std::move(domain), 4, 1, 1.0, false,
+       ::Verbosity::Silent, std::move(is_active_map), std::move(grid_center_A),
        std::move(grid_center_B), std::move(system_to_combined_names)},
       {std::move(initial_functions_of_time),
        std::move(initial_measurement_timescales)}};
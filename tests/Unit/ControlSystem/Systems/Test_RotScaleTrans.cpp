@@ -115,7 +115,8 @@ void test_rotscaletrans_control_system(const double rotation_eps = 5.0e-5) {
       "      Expansion: 1\n"
       "ControlSystems:\n"
       "  WriteDataToDisk: false\n"
-      "  MeasurementsPerUpdate: 4\n";
+      "  MeasurementsPerUpdate: 4\n"
+      "  MeasurementsBeforeExpiration: 1\n";
   input_options += create_input_string(translation_name);
   input_options += create_input_string(rotation_name);
   input_options += create_input_string(expansion_name);
@@ -161,8 +162,8 @@ void test_rotscaletrans_control_system(const double rotation_eps = 5.0e-5) {
   // Setup runner and all components
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   MockRuntimeSystem runner{
-      {"DummyFileName", std::move(domain), 4, false, ::Verbosity::Silent,
-       std::move(is_active_map),
+      {"DummyFileName", std::move(domain), 4, 1, 1.0, false,
+       ::Verbosity::Silent, std::move(is_active_map),
        tnsr::I<double, 3, Frame::Grid>{{0.5 * initial_separation, 0.0, 0.0}},
        tnsr::I<double, 3, Frame::Grid>{{-0.5 * initial_separation, 0.0, 0.0}},
        std::move(system_to_combined_names)},
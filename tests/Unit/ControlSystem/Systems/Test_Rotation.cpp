@@ -71,6 +71,7 @@ void test_rotation_control_system(const bool newtonian) {
       "ControlSystems:\n"
       "  WriteDataToDisk: false\n"
       "  MeasurementsPerUpdate: 4\n"
+      "  MeasurementsBeforeExpiration: 1\n"
       "  Rotation:\n"
       "    IsActive: true\n"
       "    Averager:\n"
@@ -111,8 +112,8 @@ void test_rotation_control_system(const bool newtonian) {
   // Setup runner and all components
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   MockRuntimeSystem runner{
-      {"DummyFileName", std::move(domain), 4, false, ::Verbosity::Silent,
-       std::move(is_active_map), std::move(grid_center_A),
+      {"DummyFileName", std::move(domain), 4, 1, 1.0, false,
+       ::Verbosity::Silent, std::move(is_active_map), std::move(grid_center_A),
        std::move(grid_center_B), std::move(system_to_combined_names)},
       {std::move(initial_functions_of_time),
        std::move(initial_measurement_timescales)}};
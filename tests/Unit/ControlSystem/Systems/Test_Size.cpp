@@ -113,7 +113,7 @@ void test_size_process_measurement() {
   using component = MockComponent<Metavars>;
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavars>;
   MockRuntimeSystem runner{
-      {creator->create_domain(), ::Verbosity::Silent, 4, false,
+      {creator->create_domain(), ::Verbosity::Silent, 4, 1, 1.0, false,
        std::unordered_map<std::string, bool>{},
        tnsr::I<double, 3, Frame::Grid>{std::array{0.0, 0.0, 0.0}},
        tnsr::I<double, 3, Frame::Grid>{std::array{0.0, 0.0, 0.0}},
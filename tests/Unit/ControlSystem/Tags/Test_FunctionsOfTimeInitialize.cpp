@@ -225,7 +225,7 @@ void test_functions_of_time_tag() {
 
   // First test construction with only control systems
   fot_tag::type functions_of_time = fot_tag::create_from_options<Metavariables>(
-      creator, measurements_per_update, initial_time, option_holder1,
+      creator, measurements_per_update, 1, initial_time, option_holder1,
       option_holder2, option_holder3);
 
   const double expiration_controlled_2 =
@@ -251,6 +251,7 @@ void test_functions_of_time_tag() {
           tmpl::list<
               domain::OptionTags::DomainCreator<Metavariables::volume_dim>,
               control_system::OptionTags::MeasurementsPerUpdate,
+              control_system::OptionTags::MeasurementsBeforeExpiration,
               ::OptionTags::InitialTime, ControlSysInputs<FakeControlSystem<1>>,
               ControlSysInputs<FakeControlSystem<2>>,
               ControlSysInputs<FakeControlSystem<3>>>>);
@@ -298,7 +299,7 @@ void not_controlling(const bool is_active) {
 
   [[maybe_unused]] fot_tag::type functions_of_time =
       fot_tag::create_from_options<Metavariables>(
-          creator, measurements_per_update, initial_time, option_holder1,
+          creator, measurements_per_update, 1, initial_time, option_holder1,
           option_holder2, option_holder3, option_holder4);
 }
 
@@ -321,7 +322,7 @@ void incompatible(const bool is_active) {
 
   [[maybe_unused]] fot_tag::type functions_of_time =
       fot_tag::create_from_options<Metavariables>(
-          creator, measurements_per_update, initial_time, option_holder1,
+          creator, measurements_per_update, 1, initial_time, option_holder1,
           option_holder2, option_holder3);
 }
 
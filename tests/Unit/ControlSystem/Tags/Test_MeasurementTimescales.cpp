@@ -95,7 +95,7 @@ void test_measurement_tag() {
   INFO("Test measurement tag");
   using measurement_tag = control_system::Tags::MeasurementTimescales;
   static_assert(
-      tmpl::size<measurement_tag::option_tags<Metavariables>>::value == 9);
+      tmpl::size<measurement_tag::option_tags<Metavariables>>::value == 10);
 
   using FakeCreator = control_system::TestHelpers::FakeCreator;
 
@@ -144,6 +144,7 @@ void test_measurement_tag() {
         std::is_same_v<
             measurement_tag::option_tags<Metavariables>,
             tmpl::list<control_system::OptionTags::MeasurementsPerUpdate,
+                       control_system::OptionTags::MeasurementsBeforeExpiration,
                        domain::OptionTags::DomainCreator<3>,
                        ::OptionTags::InitialTime, ::OptionTags::InitialTimeStep,
                        control_system::OptionTags::ControlSystemInputs<
@@ -159,7 +160,7 @@ void test_measurement_tag() {
     const int measurements_per_update = 4;
     const measurement_tag::type timescales =
         measurement_tag::create_from_options<Metavariables>(
-            measurements_per_update, creator, initial_time, time_step,
+            measurements_per_update, 1, creator, initial_time, time_step,
             option_holder1, option_holder2, option_holder4, option_holder5,
             option_holder6);
     CHECK(timescales.size() == 3);
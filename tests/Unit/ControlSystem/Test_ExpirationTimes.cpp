@@ -98,7 +98,7 @@ void test_expiration_time_construction() {
     INFO("No control systems");
     const auto initial_expiration_times =
         control_system::initial_expiration_times(
-            initial_time, measurements_per_update, creator1);
+            initial_time, measurements_per_update, 1, creator1);
 
     const std::unordered_map<std::string, double>
         expected_initial_expiration_times{};
@@ -110,7 +110,8 @@ void test_expiration_time_construction() {
     INFO("One control system");
     const auto initial_expiration_times =
         control_system::initial_expiration_times(
-            initial_time, measurements_per_update, creator2, option_holder1);
+            initial_time, measurements_per_update, 1, creator2,
+            option_holder1);
 
     const std::unordered_map<std::string, double>
         expected_initial_expiration_times{
@@ -120,17 +121,40 @@ void test_expiration_time_construction() {
                  initial_time, DataVector{0.0},
                  control_system::calculate_measurement_timescales(
                      controller, tuner1, measurements_per_update),
-                 measurements_per_update)}};
+                 measurements_per_update, 1)}};
 
     check_expiration_times(initial_expiration_times,
                            expected_initial_expiration_times);
   }
+  {
+    INFO("One control system updating three measurements before expiration");
+    const auto initial_expiration_times =
+        control_system::initial_expiration_times(
+            initial_time, measurements_per_update, 3, creator2,
+            option_holder1);
+
+    const double measurement_timescale =
+        min(control_system::calculate_measurement_timescales(
+            controller, tuner1, measurements_per_update));
+    // The first update happens at the fourth measurement, three measurements
+    // before the expiration
+    const std::unordered_map<std::string, double>
+        expected_initial_expiration_times{
+            {FakeControlSystem<1>::name(),
+             initial_time + (measurements_per_update + 2) *
+                                measurement_timescale}};
+
+    CHECK(initial_expiration_times.size() == 1);
+    CHECK(initial_expiration_times.at(FakeControlSystem<1>::name()) ==
+          approx(expected_initial_expiration_times.at(
+              FakeControlSystem<1>::name())));
+  }
   {
     INFO("Three control system");
     const auto initial_expiration_times =
         control_system::initial_expiration_times(
-            initial_time, measurements_per_update, creator3, option_holder1,
-            option_holder2, option_holder3);
+            initial_time, measurements_per_update, 1, creator3,
+            option_holder1, option_holder2, option_holder3);
 
     const double min_measurement_timescale =
         std::min(min(control_system::calculate_measurement_timescales(
@@ -140,7 +164,7 @@ void test_expiration_time_construction() {
     const double min_expiration_time =
         control_system::function_of_time_expiration_time(
             initial_time, DataVector{0.0},
-            DataVector{min_measurement_timescale}, measurements_per_update);
+            DataVector{min_measurement_timescale}, measurements_per_update, 1);
 
     const std::unordered_map<std::string, double>
         expected_initial_expiration_times{
@@ -161,24 +185,30 @@ void test_fot_measurement_expr_time() {
   const double time = 0.6;
   const int measurements_per_update = 3;
 
-  const double fot_expr_time = control_system::function_of_time_expiration_time(
-      time, old_measurement_timescales, new_measurement_timescales,
-      measurements_per_update);
-  const double expected_fot_expr_time =
-      time + min(old_measurement_timescales) +
-      measurements_per_update * min(new_measurement_timescales);
-
-  CHECK(fot_expr_time == expected_fot_expr_time);
-
-  const double measurement_expr_time =
-      control_system::measurement_expiration_time(
-          time, old_measurement_timescales, new_measurement_timescales,
-          measurements_per_update);
-  const double expected_measurement_expr_time =
-      time + min(old_measurement_timescales) +
-      (double(measurements_per_update) - 0.5) * min(new_measurement_timescales);
-
-  CHECK(measurement_expr_time == expected_measurement_expr_time);
+  for (const int measurements_before_expiration : {1, 2}) {
+    const double fot_expr_time =
+        control_system::function_of_time_expiration_time(
+            time, old_measurement_timescales, new_measurement_timescales,
+            measurements_per_update, measurements_before_expiration);
+    const double expected_fot_expr_time =
+        time +
+        measurements_before_expiration * min(old_measurement_timescales) +
+        measurements_per_update * min(new_measurement_timescales);
+
+    CHECK(fot_expr_time == approx(expected_fot_expr_time));
+
+    const double measurement_expr_time =
+        control_system::measurement_expiration_time(
+            time, old_measurement_timescales, new_measurement_timescales,
+            measurements_per_update, measurements_before_expiration);
+    const double expected_measurement_expr_time =
+        time +
+        measurements_before_expiration * min(old_measurement_timescales) +
+        (double(measurements_per_update) - 0.5) *
+            min(new_measurement_timescales);
+
+    CHECK(measurement_expr_time == approx(expected_measurement_expr_time));
+  }
 }
 }  // namespace
 
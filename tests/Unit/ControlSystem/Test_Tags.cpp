@@ -75,6 +75,14 @@ void test_all_tags() {
       control_system::Tags::MeasurementsPerUpdate;
   TestHelpers::db::test_simple_tag<measurements_per_update_tag>(
       "MeasurementsPerUpdate");
+  using measurements_before_expiration_tag =
+      control_system::Tags::MeasurementsBeforeExpiration;
+  TestHelpers::db::test_simple_tag<measurements_before_expiration_tag>(
+      "MeasurementsBeforeExpiration");
+  using quiescent_stretch_factor_tag =
+      control_system::Tags::QuiescentStretchFactor;
+  TestHelpers::db::test_simple_tag<quiescent_stretch_factor_tag>(
+      "QuiescentStretchFactor");
   using current_measurement_tag =
       control_system::Tags::CurrentNumberOfMeasurements;
   TestHelpers::db::test_simple_tag<current_measurement_tag>(
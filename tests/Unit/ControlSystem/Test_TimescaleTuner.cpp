@@ -284,6 +284,28 @@ void test_no_change_to_timescale() {
   run_tests(-1.0);  // test negative Q
 }
 
+void test_is_quiescent() {
+  const double increase_timescale_threshold = 1.0e-4;
+  TimescaleTuner tst(std::vector<double>{2.0, 2.0}, 10.0, 1.0e-3, 1.0e-2,
+                     increase_timescale_threshold, 1.01, 0.99);
+
+  const double small = 0.5 * increase_timescale_threshold;
+  const double large = 2.0 * increase_timescale_threshold;
+  CHECK(tst.is_quiescent({{DataVector{small, -small},
+                           DataVector{0.25 * small, -0.25 * small}}}));
+  // Q of one component is above the threshold
+  CHECK_FALSE(tst.is_quiescent(
+      {{DataVector{small, -large}, DataVector{0.0, 0.0}}}));
+  // dtQ times the timescale of one component is above the threshold
+  CHECK_FALSE(tst.is_quiescent(
+      {{DataVector{small, small}, DataVector{0.0, 0.75 * large}}}));
+
+  // Quiescent control errors are exactly those that increase all timescales
+  TimescaleTuner copy = tst;
+  copy.update_timescale({{DataVector{small, -small}, DataVector{0.0, 0.0}}});
+  CHECK(copy.current_timescale() == DataVector{2.0 * 1.01, 2.0 * 1.01});
+}
+
 void test_create_from_options() {
   const double decrease_timescale_threshold = 1.0e-2;
   const double increase_timescale_threshold = 1.0e-4;
@@ -566,6 +588,7 @@ SPECTRE_TEST_CASE("Unit.ControlSystem.TimescaleTuner",
                   "[ControlSystem][Unit]") {
   test_increase_or_decrease();
   test_no_change_to_timescale();
+  test_is_quiescent();
   test_create_from_options();
   test_equality_and_serialization();
   test_errors();
@@ -22,6 +22,7 @@
 #include "Domain/FunctionsOfTime/SettleToConstant.hpp"
 #include "Domain/FunctionsOfTime/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
+#include "IO/Logging/Verbosity.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Utilities/CloneUniquePtrs.hpp"
@@ -45,7 +46,7 @@ struct TestSingleton {
   using chare_type = ActionTesting::MockSingletonChare;
   using array_index = size_t;
   using metavariables = Metavariables;
-  using const_global_cache_tags = tmpl::list<>;
+  using const_global_cache_tags = tmpl::list<control_system::Tags::Verbosity>;
   using mutable_global_cache_tags =
       tmpl::list<domain::Tags::FunctionsOfTimeInitialize,
                  control_system::Tags::MeasurementTimescales,
@@ -100,7 +101,7 @@ void test_mutates() {
 
   // Construct mock system and set to Testing phase
   ActionTesting::MockRuntimeSystem<TestingMetavariables> runsys{
-      {},
+      {::Verbosity::Silent},
       {std::move(f_of_t_map), std::move(measurement_timescales),
        std::unordered_map<std::string, std::string>{}}};
   ActionTesting::emplace_singleton_component_and_initialize<
@@ -180,10 +181,16 @@ void test_update_aggregator() {
 
   control_system::UpdateAggregator unserialized_aggregator{combined_name,
                                                            names};
+  CHECK(unserialized_aggregator.number_of_broadcasts() == 0);
+  CHECK(unserialized_aggregator.bytes_broadcast() == 0);
+  unserialized_aggregator.record_broadcast(10);
+  unserialized_aggregator.record_broadcast(32);
   control_system::UpdateAggregator aggregator =
       serialize_and_deserialize(unserialized_aggregator);
 
   CHECK(aggregator.combined_name() == combined_name);
+  CHECK(aggregator.number_of_broadcasts() == 2);
+  CHECK(aggregator.bytes_broadcast() == 42);
 
   aggregator.insert("Wisconsin", DataVector{1.0}, 10.0, signals.at("Wisconsin"),
                     5.0);
@@ -306,7 +313,7 @@ void test_aggregate_update_action() {
   auto system_to_combined_names_copy = system_to_combined_names;
 
   ActionTesting::MockRuntimeSystem<metavars> runner{
-      {},
+      {::Verbosity::Verbose},
       {std::move(f_of_t_map), std::move(measurement_map),
        std::move(system_to_combined_names_copy)}};
   ActionTesting::emplace_singleton_component_and_initialize<component1>(
@@ -472,6 +479,11 @@ void test_aggregate_update_action() {
 
   check_equal("FoT2", functions_of_time, expected_f_of_t_map);
   check_equal("FoT2", measurement_timescales, expected_measurement_map);
+  CHECK(box_aggregator13.number_of_broadcasts() == 0);
+  CHECK(box_aggregator13.bytes_broadcast() == 0);
+  CHECK(box_aggregator2.number_of_broadcasts() == 2);
+  CHECK(box_aggregator2.bytes_broadcast() > 0);
+  const size_t bytes_broadcast2 = box_aggregator2.bytes_broadcast();
 
   // Update the second of the 13 measurement which should update both functions
   // of time and just the one measurement timescale
@@ -497,6 +509,12 @@ void test_aggregate_update_action() {
   check_equal("FoT1", functions_of_time, expected_f_of_t_map);
   check_equal("FoT3", functions_of_time, expected_f_of_t_map);
   check_equal("FoT1FoT3", measurement_timescales, expected_measurement_map);
+  // Both functions of time are updated in the same broadcast, so it is
+  // larger than the one for FoT2 alone.
+  CHECK(box_aggregator13.number_of_broadcasts() == 2);
+  CHECK(box_aggregator13.bytes_broadcast() > bytes_broadcast2);
+  CHECK(box_aggregator2.number_of_broadcasts() == 2);
+  CHECK(box_aggregator2.bytes_broadcast() == bytes_broadcast2);
 }
 
 SPECTRE_TEST_CASE("Unit.ControlSystem.UpdateFunctionOfTime",
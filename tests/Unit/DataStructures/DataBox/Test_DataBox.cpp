@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataBox/ComputeItemProfile.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/DataOnSlice.hpp"
@@ -2640,12 +2641,34 @@ void serialization_of_pointers() {
         &db::get<test_databox_tags::Pointer>(box));
 }
 
+void move_items_out_of_box() {
+  INFO("Move items out of a DataBox");
+  auto box = db::create<
+      db::AddSimpleTags<test_databox_tags::Tag2, test_databox_tags::Pointer>,
+      db::AddComputeTags<test_databox_tags::Tag6Compute,
+                         test_databox_tags::PointerToCounterCompute>>(
+      "My Sample String"s, std::make_unique<int>(3));
+  CHECK(db::get<test_databox_tags::Tag6>(box) == "My Sample String");
+  CHECK(db::get<test_databox_tags::PointerToCounter>(box) == 4);
+  const int* const pointer = &db::get<test_databox_tags::Pointer>(box);
+
+  auto moved_items =
+      db::move_items<tmpl::list<test_databox_tags::Tag2,
+                                test_databox_tags::Pointer>>(
+          make_not_null(&box));
+  CHECK(get<test_databox_tags::Tag2>(moved_items) == "My Sample String");
+  CHECK(*get<test_databox_tags::Pointer>(moved_items) == 3);
+  // The object owned by the DataBox was moved, not copied
+  CHECK(get<test_databox_tags::Pointer>(moved_items).get() == pointer);
+}
+
 void test_serialization_and_copy_items() {
   serialization_non_subitem_simple_items();
   serialization_subitems_simple_items();
   serialization_subitem_compute_items();
   serialization_compute_items_of_base_tags();
   serialization_of_pointers();
+  move_items_out_of_box();
 }
 
 namespace test_databox_tags {
@@ -2791,6 +2814,34 @@ void test_get_mutable_reference() {
   // db::get_mutable_reference<First<0>>(make_not_null(&box));
 }
 
+void test_compute_item_profiles() {
+  INFO("test compute item profiles");
+  auto box = db::create<db::AddSimpleTags<test_databox_tags::Tag0>,
+                        db::AddComputeTags<test_databox_tags::Lambda0Compute>>(
+      3.14);
+  for (size_t i = 0; i < 4; ++i) {
+    CHECK(db::get<test_databox_tags::Lambda0>(box) ==
+          approx(3.0 * (3.14 + static_cast<double>(i))));
+    // Retrieving an up to date compute item does not evaluate it again.
+    CHECK(db::get<test_databox_tags::Lambda0>(box) ==
+          approx(3.0 * (3.14 + static_cast<double>(i))));
+    db::mutate<test_databox_tags::Tag0>(
+        [](const gsl::not_null<double*> tag0) { *tag0 += 1.0; },
+        make_not_null(&box));
+  }
+  const auto moved_box = std::move(box);
+  const std::vector<db::ComputeItemProfile> profiles =
+      db::compute_item_profiles(moved_box);
+#ifdef SPECTRE_DATABOX_PROFILING
+  REQUIRE(profiles.size() == 1);
+  CHECK(profiles[0].name == "Lambda0");
+  CHECK(profiles[0].number_of_evaluations == 4);
+  CHECK(profiles[0].total_time >= 0.0);
+#else
+  CHECK(profiles.empty());
+#endif  // SPECTRE_DATABOX_PROFILING
+}
+
 void test_output() {
   INFO("test output");
   auto box = db::create<
@@ -3007,6 +3058,7 @@ SPECTRE_TEST_CASE("Unit.DataStructures.DataBox", "[Unit][DataStructures]") {
   test_serialization_and_copy_items();
   test_reference_item();
   test_get_mutable_reference();
+  test_compute_item_profiles();
   test_output();
   test_exception_safety();
 }
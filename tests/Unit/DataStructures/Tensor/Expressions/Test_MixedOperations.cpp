@@ -299,6 +299,22 @@ void test_mixed_arithmetic_ops(const gsl::not_null<Generator*> generator,
       CHECK_ITERABLE_APPROX(actual_result_tensor_temp.get(a),
                             expected_result_tensor.get(a));
     }
+
+    // Test chunked evaluation, including a chunk size that does not divide
+    // the number of grid points and one that is larger than it
+    for (const size_t chunk_size :
+         {size_t{1}, size_t{2}, tenex::default_evaluation_chunk_size}) {
+      CAPTURE(chunk_size);
+      result_tensor_type actual_result_tensor_chunked{};
+      tenex::evaluate_chunked<ti::a>(
+          make_not_null(&actual_result_tensor_chunked),
+          R(ti::a, ti::b) * S(ti::B) + G(ti::a) - H(ti::b, ti::a, ti::B) * T(),
+          chunk_size);
+      for (size_t a = 0; a < 4; a++) {
+        CHECK_ITERABLE_APPROX(actual_result_tensor_chunked.get(a),
+                              expected_result_tensor.get(a));
+      }
+    }
   }
 }
 
@@ -10,6 +10,7 @@
 #include <functional>
 #include <random>
 #include <type_traits>
+#include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/ComplexDataVector.hpp"
@@ -198,6 +199,25 @@ void test_interpolation() {
     }
   }
 }
+
+// Interpolate between meshes on either side of the extent at which
+// `apply_matrices` switches from the specialized small-matrix kernels to BLAS.
+template <typename LocalScalarTag, typename LocalTensorTag, size_t Dim>
+void test_kernel_crossover() {
+  constexpr size_t max_small =
+      apply_matrices_detail::max_extent_for_small_kernels;
+  for (const auto& [source_extent, dest_extent] :
+       std::array{std::pair{max_small - 1, max_small},
+                  std::pair{max_small, max_small + 1},
+                  std::pair{max_small + 1, max_small - 1}}) {
+    CAPTURE(source_extent);
+    CAPTURE(dest_extent);
+    const Mesh<Dim> source_mesh{source_extent, basis, quadrature};
+    const Mesh<Dim> dest_mesh{dest_extent, basis, quadrature};
+    CheckApply<LocalScalarTag, LocalTensorTag, Dim>::apply(
+        source_mesh, dest_mesh, Index<Dim>(2));
+  }
+}
 }  // namespace
 
 // [[TimeOut, 8]]
@@ -208,12 +228,18 @@ SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrices",
     test_interpolation<ScalarTag, TensorTag, 1>();
     test_interpolation<ScalarTag, TensorTag, 2>();
     test_interpolation<ScalarTag, TensorTag, 3>();
+    test_kernel_crossover<ScalarTag, TensorTag, 1>();
+    test_kernel_crossover<ScalarTag, TensorTag, 2>();
+    test_kernel_crossover<ScalarTag, TensorTag, 3>();
   }
   {
     INFO("ComplexDataVector test");
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 1>();
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 2>();
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 3>();
+    test_kernel_crossover<ComplexScalarTag, ComplexTensorTag, 1>();
+    test_kernel_crossover<ComplexScalarTag, ComplexTensorTag, 2>();
+    test_kernel_crossover<ComplexScalarTag, ComplexTensorTag, 3>();
   }
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
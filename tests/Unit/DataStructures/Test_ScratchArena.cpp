@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+using VarsTags = tmpl::list<::Tags::TempScalar<0>,
+                            ::Tags::TempI<1, 3, Frame::Inertial>>;
+
+// Mimics a kernel that allocates some scratch memory, including from a nested
+// scope, and returns the total of the data it wrote.
+double run_kernel(const gsl::not_null<ScratchArena*> arena,
+                  const size_t number_of_grid_points) {
+  ScratchArena::Scope scope{arena};
+  auto vars =
+      scope.make_variables<Variables<VarsTags>>(number_of_grid_points);
+  CHECK_FALSE(vars.is_owning());
+  CHECK(vars.number_of_grid_points() == number_of_grid_points);
+  get(get<::Tags::TempScalar<0>>(vars)) = 1.0;
+  for (size_t i = 0; i < 3; ++i) {
+    get<::Tags::TempI<1, 3, Frame::Inertial>>(vars).get(i) = 2.0;
+  }
+  double total = 0.0;
+  {
+    ScratchArena::Scope inner_scope{arena};
+    CHECK(arena->number_of_active_scopes() == 2);
+    auto buffer = inner_scope.make_variables<TempBuffer<VarsTags>>(
+        2 * number_of_grid_points);
+    get(get<::Tags::TempScalar<0>>(buffer)) = 3.0;
+    const auto raw = inner_scope.allocate(number_of_grid_points);
+    CHECK(raw.size() == number_of_grid_points);
+    for (auto& value : raw) {
+      value = 4.0;
+    }
+    for (const double value : raw) {
+      total += value;
+    }
+    total += sum(get(get<::Tags::TempScalar<0>>(buffer)));
+  }
+  // The memory of the inner scope must not overlap with that of `vars`.
+  total += sum(get(get<::Tags::TempScalar<0>>(vars)));
+  for (size_t i = 0; i < 3; ++i) {
+    total += sum(get<::Tags::TempI<1, 3, Frame::Inertial>>(vars).get(i));
+  }
+  CHECK(arena->size_in_use() ==
+        Variables<VarsTags>::number_of_independent_components *
+            number_of_grid_points);
+  return total;
+}
+
+void test_steady_state() {
+  ScratchArena arena{};
+  CHECK(arena.capacity() == 0);
+  CHECK(arena.number_of_heap_allocations() == 0);
+  const size_t number_of_grid_points = 5;
+  const double expected_sum =
+      (4.0 + 6.0 + 1.0 + 6.0) * static_cast<double>(number_of_grid_points);
+  CHECK(run_kernel(make_not_null(&arena), number_of_grid_points) ==
+        approx(expected_sum));
+  CHECK(arena.number_of_active_scopes() == 0);
+  CHECK(arena.size_in_use() == 0);
+  const size_t capacity = arena.capacity();
+  CHECK(capacity >= (4 + 8 + 1) * number_of_grid_points);
+  const size_t allocations_after_warm_up = arena.number_of_heap_allocations();
+  CHECK(allocations_after_warm_up > 0);
+
+  // Once warmed up, repeated invocations must not allocate.
+  for (size_t i = 0; i < 10; ++i) {
+    CHECK(run_kernel(make_not_null(&arena), number_of_grid_points) ==
+          approx(expected_sum));
+  }
+  CHECK(arena.number_of_heap_allocations() == allocations_after_warm_up);
+  CHECK(arena.capacity() == capacity);
+
+  // Smaller invocations also do not allocate
+  CHECK(run_kernel(make_not_null(&arena), 2) == approx(expected_sum * 0.4));
+  CHECK(arena.number_of_heap_allocations() == allocations_after_warm_up);
+
+  // Larger invocations grow the arena once
+  CHECK(run_kernel(make_not_null(&arena), 20) == approx(expected_sum * 4.0));
+  const size_t allocations_after_growth = arena.number_of_heap_allocations();
+  CHECK(allocations_after_growth > allocations_after_warm_up);
+  CHECK(run_kernel(make_not_null(&arena), 20) == approx(expected_sum * 4.0));
+  CHECK(arena.number_of_heap_allocations() == allocations_after_growth);
+}
+
+void test_empty_allocation() {
+  ScratchArena arena{};
+  {
+    ScratchArena::Scope scope{make_not_null(&arena)};
+    CHECK(scope.allocate(0).empty());
+  }
+  CHECK(arena.number_of_heap_allocations() == 0);
+}
+
+void test_local() {
+  ScratchArena& arena = ScratchArena::local();
+  CHECK(&arena == &ScratchArena::local());
+  CHECK(run_kernel(make_not_null(&arena), 3) ==
+        approx((4.0 + 6.0 + 1.0 + 6.0) * 3.0));
+  CHECK(arena.number_of_active_scopes() == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ScratchArena",
+                  "[DataStructures][Unit]") {
+  test_steady_state();
+  test_empty_allocation();
+  test_local();
+}
@@ -12,6 +12,7 @@
 #include "DataStructures/Transpose.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
 
 template <typename TagsList>
@@ -33,6 +34,31 @@ using two_vars = tmpl::list<Var1<Dim>, Var2>;
 
 template <size_t Dim>
 using one_var = tmpl::list<Var1<Dim>>;
+
+// Sizes larger than the internal cache tiles with remainders in both
+// directions, as well as square matrices for the in-place swap.
+void test_large_and_in_place(const size_t chunk_size,
+                             const size_t number_of_chunks) {
+  CAPTURE(chunk_size);
+  CAPTURE(number_of_chunks);
+  DataVector data(chunk_size * number_of_chunks);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<double>(i);
+  }
+  DataVector expected(data.size());
+  for (size_t i = 0; i < chunk_size; ++i) {
+    for (size_t j = 0; j < number_of_chunks; ++j) {
+      expected[j + number_of_chunks * i] = data[i + chunk_size * j];
+    }
+  }
+  CHECK(transpose(data, chunk_size, number_of_chunks) == expected);
+
+  DataVector in_place = data;
+  transpose_in_place(make_not_null(&in_place), chunk_size, number_of_chunks);
+  CHECK(in_place == expected);
+  transpose_in_place(make_not_null(&in_place), number_of_chunks, chunk_size);
+  CHECK(in_place == data);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Transpose", "[DataStructures][Unit]") {
@@ -143,4 +169,15 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Transpose", "[DataStructures][Unit]") {
             partial_vars.data()[i + chunk_size_vars * j]);    // NOLINT
     }
   }
+
+  auto in_place_vars = variables;
+  transpose_in_place(make_not_null(&in_place_vars), chunk_size_vars,
+                     number_of_chunks_vars);
+  CHECK(in_place_vars == transposed_vars);
+
+  for (const size_t chunk_size_large : {1_st, 5_st, 32_st, 37_st, 70_st}) {
+    for (const size_t number_of_chunks_large : {1_st, 3_st, 32_st, 37_st}) {
+      test_large_and_in_place(chunk_size_large, number_of_chunks_large);
+    }
+  }
 }
@@ -7,6 +7,7 @@
 #include <boost/rational.hpp>
 #include <cstddef>
 #include <deque>
+#include <unordered_set>
 
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Amr/Helpers.hpp"
@@ -408,6 +409,26 @@ void test_ids_of_joining_neighbors() {
             stay_join) == std::deque{id_leta_s_s});
 }
 
+void test_ids_of_neighbors() {
+  const ElementId<1> element_id_1d{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> sibling_id{0, {{SegmentId{1, 1}}}};
+  // A periodic interval with two elements
+  CHECK(amr::ids_of_neighbors(
+            make_element(element_id_1d, {sibling_id}, {sibling_id})) ==
+        std::unordered_set{sibling_id});
+
+  const ElementId<2> element_id_2d{0, {{SegmentId{3, 5}, SegmentId{6, 15}}}};
+  const ElementId<2> id_lxi{0, {{SegmentId{3, 4}, SegmentId{6, 15}}}};
+  const ElementId<2> id_uxi_lower{0, {{SegmentId{4, 12}, SegmentId{7, 30}}}};
+  const ElementId<2> id_uxi_upper{0, {{SegmentId{4, 12}, SegmentId{7, 31}}}};
+  const ElementId<2> id_leta{0, {{SegmentId{3, 5}, SegmentId{6, 14}}}};
+  CHECK(amr::ids_of_neighbors(make_element(element_id_2d, {id_lxi},
+                                           {id_uxi_lower, id_uxi_upper},
+                                           {id_leta}, {})) ==
+        std::unordered_set{id_lxi, id_uxi_lower, id_uxi_upper, id_leta});
+  CHECK(amr::ids_of_neighbors(Element<2>{element_id_2d, {}}).empty());
+}
+
 void test_is_child_that_creates_parent() {
   const SegmentId xi_segment{3, 5};
   const auto join = std::array{amr::Flag::Join};
@@ -647,6 +668,7 @@ SPECTRE_TEST_CASE("Unit.Domain.Amr.Helpers", "[Domain][Unit]") {
   test_id_of_parent();
   test_ids_of_children();
   test_ids_of_joining_neighbors();
+  test_ids_of_neighbors();
   test_is_child_that_creates_parent();
   test_prevent_element_from_joining_while_splitting();
   test_assertions();
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <pup.h>
@@ -15,6 +16,7 @@
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
 #include "Domain/CoordinateMaps/BulgedCube.hpp"
@@ -31,6 +33,7 @@
 #include "Domain/CoordinateMaps/TimeDependent/CubicScale.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/ProductMaps.tpp"
+#include "Domain/CoordinateMaps/TimeDependent/Rotation.hpp"
 #include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
 #include "Domain/CoordinateMaps/Wedge.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
@@ -142,8 +145,8 @@ void test_single_coordinate_map() {
     const auto coords_jacs_velocity =
         map_base->coords_frame_velocity_jacobians(local_source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == map(local_source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          map.inv_jacobian(local_source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          map.inv_jacobian(local_source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           map.jacobian(local_source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -350,7 +353,8 @@ void test_coordinate_map_with_affine_map() {
     const auto coords_jacs_velocity =
         map.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == map(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) == map.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          map.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) == map.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
           tnsr::I<double, 1, Frame::Grid>{0.0});
@@ -397,8 +401,8 @@ void test_coordinate_map_with_affine_map() {
     const auto coords_jacs_velocity =
         prod_map2d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == prod_map2d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          prod_map2d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          prod_map2d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           prod_map2d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -463,8 +467,8 @@ void test_coordinate_map_with_affine_map() {
     const auto coords_jacs_velocity =
         prod_map3d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == prod_map3d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          prod_map3d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          prod_map3d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           prod_map3d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -517,8 +521,8 @@ void test_coordinate_map_with_rotation_map() {
     const auto coords_jacs_velocity =
         double_rotated2d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated2d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated2d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated2d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated2d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -565,8 +569,8 @@ void test_coordinate_map_with_rotation_map() {
     const auto coords_jacs_velocity =
         double_rotated3d.coords_frame_velocity_jacobians(source_points);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated3d(source_points));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated3d.inv_jacobian(source_points));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated3d.inv_jacobian(source_points));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated3d.jacobian(source_points));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -615,8 +619,8 @@ void test_coordinate_map_with_rotation_map_datavector() {
     const auto coords_jacs_velocity =
         double_rotated2d.coords_frame_velocity_jacobians(coords2d);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated2d(coords2d));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated2d.inv_jacobian(coords2d));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated2d.inv_jacobian(coords2d));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated2d.jacobian(coords2d));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -672,8 +676,8 @@ void test_coordinate_map_with_rotation_map_datavector() {
     const auto coords_jacs_velocity =
         double_rotated3d.coords_frame_velocity_jacobians(coords3d);
     CHECK(std::get<0>(coords_jacs_velocity) == double_rotated3d(coords3d));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          double_rotated3d.inv_jacobian(coords3d));
+    CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                          double_rotated3d.inv_jacobian(coords3d));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           double_rotated3d.jacobian(coords3d));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -719,12 +723,33 @@ void test_coordinate_map_with_rotation_wedge() {
   const auto coords_jacs_velocity =
       composed_map.coords_frame_velocity_jacobians(test_point_vector);
   CHECK(std::get<0>(coords_jacs_velocity) == composed_map(test_point_vector));
-  CHECK(std::get<1>(coords_jacs_velocity) ==
-        composed_map.inv_jacobian(test_point_vector));
+  CHECK_ITERABLE_APPROX(std::get<1>(coords_jacs_velocity),
+                        composed_map.inv_jacobian(test_point_vector));
   CHECK(std::get<2>(coords_jacs_velocity) ==
         composed_map.jacobian(test_point_vector));
   CHECK(std::get<3>(coords_jacs_velocity) ==
         tnsr::I<double, 2, Frame::Grid>{0.0});
+
+  // The Wedge inverts all points at once and the Rotation one at a time.
+  // Points at which the inverse fails, or that are NaN, become NaN.
+  const auto other_mapped_point = second_map(first_map(std::array{-0.5, 0.3}));
+  tnsr::I<DataVector, 2, Frame::Grid> target_points{};
+  for (size_t d = 0; d < 2; ++d) {
+    target_points.get(d) = DataVector{
+        gsl::at(mapped_point_array, d), gsl::at(other_mapped_point, d),
+        -gsl::at(mapped_point_array, d),
+        std::numeric_limits<double>::quiet_NaN()};
+  }
+  const auto source_points =
+      composed_map.get_clone()->inverse(target_points);
+  CHECK(get<0>(source_points)[0] == approx(0.1));
+  CHECK(get<1>(source_points)[0] == approx(0.8));
+  CHECK(get<0>(source_points)[1] == approx(-0.5));
+  CHECK(get<1>(source_points)[1] == approx(0.3));
+  for (size_t d = 0; d < 2; ++d) {
+    CHECK(std::isnan(source_points.get(d)[2]));
+    CHECK(std::isnan(source_points.get(d)[3]));
+  }
 }
 
 void test_make_vector_coordinate_map_base() {
@@ -1076,8 +1101,9 @@ void test_coordinate_maps_are_identity() {
             source_point);
     CHECK(std::get<0>(coords_jacs_velocity) ==
           wedge_composed_with_giant_identity(source_point));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          wedge_composed_with_giant_identity.inv_jacobian(source_point));
+    CHECK_ITERABLE_APPROX(
+        std::get<1>(coords_jacs_velocity),
+        wedge_composed_with_giant_identity.inv_jacobian(source_point));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           wedge_composed_with_giant_identity.jacobian(source_point));
     CHECK(std::get<3>(coords_jacs_velocity) ==
@@ -1155,6 +1181,10 @@ void test_time_dependent_map() {
       *(time_dependent_map_first.inverse(tnsr_double_inertial_1, final_time,
                                          functions_of_time)),
       tnsr_double_logical);
+  CHECK_ITERABLE_APPROX(
+      time_dependent_map_first.inverse(tnsr_datavector_inertial_1, final_time,
+                                       functions_of_time),
+      tnsr_datavector_logical);
   CHECK_ITERABLE_APPROX(
       *(time_dependent_map_second.inverse(tnsr_double_inertial_2, final_time,
                                           functions_of_time)),
@@ -1218,9 +1248,10 @@ void test_time_dependent_map() {
             tnsr_double_logical, final_time, functions_of_time);
     CHECK(std::get<0>(coords_jacs_velocity) ==
           serialized_map(tnsr_double_logical, final_time, functions_of_time));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          serialized_map.inv_jacobian(tnsr_double_logical, final_time,
-                                      functions_of_time));
+    CHECK_ITERABLE_APPROX(
+        std::get<1>(coords_jacs_velocity),
+        serialized_map.inv_jacobian(tnsr_double_logical, final_time,
+                                    functions_of_time));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           serialized_map.jacobian(tnsr_double_logical, final_time,
                                   functions_of_time));
@@ -1238,9 +1269,10 @@ void test_time_dependent_map() {
     CHECK(
         std::get<0>(coords_jacs_velocity) ==
         serialized_map(tnsr_datavector_logical, final_time, functions_of_time));
-    CHECK(std::get<1>(coords_jacs_velocity) ==
-          serialized_map.inv_jacobian(tnsr_datavector_logical, final_time,
-                                      functions_of_time));
+    CHECK_ITERABLE_APPROX(
+        std::get<1>(coords_jacs_velocity),
+        serialized_map.inv_jacobian(tnsr_datavector_logical, final_time,
+                                    functions_of_time));
     CHECK(std::get<2>(coords_jacs_velocity) ==
           serialized_map.jacobian(tnsr_datavector_logical, final_time,
                                   functions_of_time));
@@ -1490,6 +1522,131 @@ void test_coords_frame_velocity_jacobians() {
               functions_of_time)) == expected_velocity);
   }
 }
+
+// Compares the composed map to applying the maps one after the other
+template <typename... Maps>
+void check_composed_time_dependent_maps(
+    const std::unordered_map<
+        std::string,
+        std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    const double time, const Maps&... maps) {
+  const auto composed_map =
+      make_coordinate_map<Frame::Grid, Frame::Inertial>(maps...);
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  const auto source_point = make_with_random_values<std::array<DataVector, 2>>(
+      make_not_null(&generator), make_not_null(&dist), DataVector{5});
+
+  std::array<DataVector, 2> expected_point = source_point;
+  auto expected_jacobian = identity<2>(source_point[0]);
+  std::array<DataVector, 2> expected_velocity{DataVector{5, 0.0},
+                                              DataVector{5, 0.0}};
+  const auto apply_map = [&expected_point, &expected_jacobian,
+                          &expected_velocity, &functions_of_time,
+                          &time](const auto& map) {
+    const auto jacobian = map.jacobian(expected_point, time, functions_of_time);
+    auto velocity =
+        map.frame_velocity(expected_point, time, functions_of_time);
+    auto composed_jacobian = expected_jacobian;
+    for (size_t i = 0; i < 2; ++i) {
+      for (size_t j = 0; j < 2; ++j) {
+        gsl::at(velocity, i) +=
+            jacobian.get(i, j) * gsl::at(expected_velocity, j);
+        composed_jacobian.get(i, j) =
+            jacobian.get(i, 0) * expected_jacobian.get(0, j) +
+            jacobian.get(i, 1) * expected_jacobian.get(1, j);
+      }
+    }
+    expected_velocity = std::move(velocity);
+    expected_jacobian = std::move(composed_jacobian);
+    expected_point = map(expected_point, time, functions_of_time);
+  };
+  (apply_map(maps), ...);
+
+  const tnsr::I<DataVector, 2, Frame::Grid> source_tensor{source_point};
+  const auto mapped_point =
+      composed_map(source_tensor, time, functions_of_time);
+  const auto jacobian =
+      composed_map.jacobian(source_tensor, time, functions_of_time);
+  const auto [coords, inv_jacobian, jacobian_from_all, velocity] =
+      composed_map.coords_frame_velocity_jacobians(source_tensor, time,
+                                                   functions_of_time);
+  const auto expected_inv_jacobian =
+      composed_map.inv_jacobian(source_tensor, time, functions_of_time);
+  for (size_t i = 0; i < 2; ++i) {
+    CHECK_ITERABLE_APPROX(mapped_point.get(i), gsl::at(expected_point, i));
+    CHECK_ITERABLE_APPROX(coords.get(i), gsl::at(expected_point, i));
+    CHECK_ITERABLE_APPROX(velocity.get(i), gsl::at(expected_velocity, i));
+    for (size_t j = 0; j < 2; ++j) {
+      CHECK_ITERABLE_APPROX(jacobian.get(i, j), expected_jacobian.get(i, j));
+      CHECK_ITERABLE_APPROX(jacobian_from_all.get(i, j),
+                            expected_jacobian.get(i, j));
+      CHECK_ITERABLE_APPROX(inv_jacobian.get(i, j),
+                            expected_inv_jacobian.get(i, j));
+    }
+  }
+}
+
+void test_affine_time_dependent_maps() {
+  using Polynomial = domain::FunctionsOfTime::PiecewisePolynomial<2>;
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  functions_of_time["ExpansionA"] = std::make_unique<Polynomial>(
+      0.0, std::array<DataVector, 3>{{{1.0}, {-0.01}, {0.0}}}, 5.0);
+  functions_of_time["ExpansionB"] = std::make_unique<Polynomial>(
+      0.0, std::array<DataVector, 3>{{{1.0}, {0.0}, {0.0}}}, 5.0);
+  functions_of_time["Rotation"] = std::make_unique<Polynomial>(
+      0.0, std::array<DataVector, 3>{{{0.3}, {0.2}, {0.0}}}, 5.0);
+  functions_of_time["Translation"] = std::make_unique<Polynomial>(
+      0.0,
+      std::array<DataVector, 3>{{{0.1, -0.2}, {0.5, 0.4}, {0.0, 0.0}}}, 5.0);
+  const double time = 1.5;
+
+  using Expansion = CoordinateMaps::TimeDependent::CubicScale<2>;
+  using Rotation = CoordinateMaps::TimeDependent::Rotation<2>;
+  using Translation = CoordinateMaps::TimeDependent::Translation<2>;
+  static_assert(domain::has_affine_transformation_v<Expansion>);
+  static_assert(domain::has_affine_transformation_v<Rotation>);
+  static_assert(domain::has_affine_transformation_v<Translation>);
+  static_assert(not domain::has_affine_transformation_v<
+                CoordinateMaps::TimeDependent::ProductOf2Maps<
+                    CoordinateMaps::TimeDependent::Translation<1>,
+                    CoordinateMaps::TimeDependent::Translation<1>>>);
+
+  const Expansion linear_expansion{20.0, "ExpansionA", "ExpansionA"};
+  const Expansion cubic_expansion{20.0, "ExpansionA", "ExpansionB"};
+  const Rotation rotation{"Rotation"};
+  const Translation translation{"Translation"};
+  const Translation translation_with_falloff{"Translation", 5.0, 10.0};
+  CHECK(linear_expansion.affine_transformation(time, functions_of_time)
+            .has_value());
+  CHECK_FALSE(cubic_expansion.affine_transformation(time, functions_of_time)
+                  .has_value());
+  CHECK_FALSE(translation_with_falloff
+                  .affine_transformation(time, functions_of_time)
+                  .has_value());
+  {
+    const auto affine_rotation =
+        rotation.affine_transformation(time, functions_of_time);
+    REQUIRE(affine_rotation.has_value());
+    const std::array<double, 2> point{{0.4, -0.7}};
+    CHECK_ITERABLE_APPROX((*affine_rotation)(point),
+                          rotation(point, time, functions_of_time));
+  }
+
+  // All maps are affine and are applied as a single transformation
+  check_composed_time_dependent_maps(functions_of_time, time,
+                                     linear_expansion, rotation, translation);
+  // Affine maps separated by maps that are not
+  check_composed_time_dependent_maps(functions_of_time, time,
+                                     linear_expansion, cubic_expansion,
+                                     rotation, translation_with_falloff,
+                                     translation);
+  check_composed_time_dependent_maps(functions_of_time, time, rotation,
+                                     translation_with_falloff, rotation);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
@@ -1504,5 +1661,6 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
   test_push_back();
   test_jacobian_is_time_dependent();
   test_coords_frame_velocity_jacobians();
+  test_affine_time_dependent_maps();
 }
 }  // namespace domain
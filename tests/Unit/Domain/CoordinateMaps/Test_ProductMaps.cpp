@@ -11,9 +11,15 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/HasDiagonalJacobian.hpp"
+#include "Domain/CoordinateMaps/Identity.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/CoordinateMaps/Rotation.hpp"
 #include "Domain/CoordinateMaps/Wedge.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
 #include "Framework/TestHelpers.hpp"
@@ -366,10 +372,78 @@ void test_product_of_3_maps() {
           CoordinateMaps::Affine{-1.0, 1.0, -1.0, 1.0},
           CoordinateMaps::Affine{-1.0, 1.0, -1.0, 1.0}});
 }
+
+void test_diagonal_jacobians() {
+  using Affine = CoordinateMaps::Affine;
+  using Affine2D = CoordinateMaps::ProductOf2Maps<Affine, Affine>;
+  using Affine3D = CoordinateMaps::ProductOf3Maps<Affine, Affine, Affine>;
+  static_assert(has_diagonal_jacobian_v<Affine>);
+  static_assert(has_diagonal_jacobian_v<Affine2D>);
+  static_assert(has_diagonal_jacobian_v<Affine3D>);
+  static_assert(has_diagonal_jacobian_v<
+                CoordinateMaps::ProductOf2Maps<Affine2D, Affine>>);
+  static_assert(has_diagonal_jacobian_v<CoordinateMaps::Identity<3>>);
+  static_assert(not has_diagonal_jacobian_v<CoordinateMaps::Rotation<2>>);
+  static_assert(not has_diagonal_jacobian_v<
+                CoordinateMaps::ProductOf2Maps<CoordinateMaps::Wedge<2>,
+                                               Affine>>);
+
+  // Diagonal maps composed with a non-diagonal one, so that the diagonal
+  // products act on a full Jacobian
+  const Affine2D stretch{Affine{-1.0, 1.0, 2.0, 8.0},
+                         Affine{-1.0, 1.0, -3.0, -2.0}};
+  const CoordinateMaps::Rotation<2> rotation{0.7};
+  const Affine2D shift{Affine{-10.0, 10.0, -5.0, 25.0},
+                       Affine{-10.0, 10.0, 0.0, 4.0}};
+  const auto map = make_coordinate_map<Frame::BlockLogical, Frame::Inertial>(
+      stretch, rotation, shift);
+  const tnsr::I<DataVector, 2, Frame::BlockLogical> points{
+      {{DataVector{-1.0, 0.3, 0.9}, DataVector{0.5, -0.2, 1.0}}}};
+  const auto stretched = stretch(std::array{get<0>(points), get<1>(points)});
+  const auto rotated = rotation(stretched);
+  const auto stretch_jac = stretch.jacobian(
+      std::array{get<0>(points), get<1>(points)});
+  const auto rotation_jac = rotation.jacobian(stretched);
+  const auto shift_jac = shift.jacobian(rotated);
+  Jacobian<DataVector, 2, Frame::BlockLogical, Frame::Inertial> expected_jac{};
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      expected_jac.get(i, j) = DataVector(3, 0.0);
+      for (size_t k = 0; k < 2; ++k) {
+        for (size_t l = 0; l < 2; ++l) {
+          expected_jac.get(i, j) += shift_jac.get(i, k) *
+                                    rotation_jac.get(k, l) *
+                                    stretch_jac.get(l, j);
+        }
+      }
+    }
+  }
+  CHECK_ITERABLE_APPROX(map.jacobian(points), expected_jac);
+  const auto expected_inv_jac = determinant_and_inverse(expected_jac).second;
+  CHECK_ITERABLE_APPROX(map.inv_jacobian(points), expected_inv_jac);
+  const auto [coords, inv_jac, jac, frame_velocity] =
+      map.coords_frame_velocity_jacobians(points);
+  CHECK_ITERABLE_APPROX(jac, expected_jac);
+  CHECK_ITERABLE_APPROX(inv_jac, expected_inv_jac);
+
+  // Only diagonal maps, for which the inverse Jacobian is not computed by a
+  // general matrix inverse
+  const auto diagonal_map =
+      make_coordinate_map<Frame::BlockLogical, Frame::Inertial>(stretch, shift);
+  const auto diagonal_jac = diagonal_map.jacobian(points);
+  const auto diagonal_inv_jac = diagonal_map.inv_jacobian(points);
+  const auto diagonal_jacobians =
+      diagonal_map.coords_frame_velocity_jacobians(points);
+  CHECK_ITERABLE_APPROX(std::get<1>(diagonal_jacobians), diagonal_inv_jac);
+  CHECK_ITERABLE_APPROX(std::get<2>(diagonal_jacobians), diagonal_jac);
+  CHECK_ITERABLE_APPROX(determinant_and_inverse(diagonal_jac).second,
+                        diagonal_inv_jac);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.ProductMaps", "[Domain][Unit]") {
   test_product_of_2_maps();
   test_product_of_3_maps();
+  test_diagonal_jacobians();
 }
 }  // namespace domain
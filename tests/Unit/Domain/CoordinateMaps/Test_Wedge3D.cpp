@@ -5,9 +5,13 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <limits>
 #include <optional>
 #include <random>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "Domain/CoordinateMaps/Distribution.hpp"
 #include "Domain/CoordinateMaps/Wedge.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -15,6 +19,7 @@
 #include "Helpers/Domain/CoordinateMaps/TestMapHelpers.hpp"
 #include "Utilities/CartesianProduct.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -365,10 +370,75 @@ void test_wedge3d_fail() {
                           test_mapped_point7);
   }
 }
+}
+
+void test_wedge3d_batched_inverse() {
+  INFO("Wedge3d batched inverse");
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> logical_dis(-1.0, 1.0);
+  using WedgeHalves = Wedge3D::WedgeHalves;
+  for (const auto& [halves, orientation, with_equiangular_map,
+                    radial_distribution] :
+       random_sample<5>(
+           cartesian_product(
+               make_array(WedgeHalves::UpperOnly, WedgeHalves::LowerOnly,
+                          WedgeHalves::Both),
+               all_wedge_directions(), make_array(true, false),
+               make_array(CoordinateMaps::Distribution::Linear,
+                          CoordinateMaps::Distribution::Logarithmic,
+                          CoordinateMaps::Distribution::Inverse)),
+           make_not_null(&gen))) {
+    CAPTURE(halves);
+    CAPTURE(orientation);
+    CAPTURE(with_equiangular_map);
+    CAPTURE(radial_distribution);
+    const bool is_linear =
+        radial_distribution == CoordinateMaps::Distribution::Linear;
+    const Wedge3D map(0.2, 4.0, is_linear ? 0.0 : 1.0, 1.0, orientation,
+                      with_equiangular_map, halves, radial_distribution);
+    // Points in the wedge, points at which the inverse fails, and a masked
+    // point.
+    std::vector<std::array<double, 3>> points{};
+    for (size_t i = 0; i < 5; ++i) {
+      points.push_back(map(std::array{logical_dis(gen), logical_dis(gen),
+                                      logical_dis(gen)}));
+    }
+    points.push_back(
+        discrete_rotation(orientation, std::array{3.0, 3.0, 0.0}));
+    points.push_back(
+        discrete_rotation(orientation, std::array{-3.0, 3.0, -1.0}));
+    points.push_back(discrete_rotation(
+        orientation, std::array{sqrt(1198.0), 1.0, 1.0}));
+    points.push_back(make_array<3>(std::numeric_limits<double>::quiet_NaN()));
+
+    std::array<DataVector, 3> target_points =
+        make_array<3>(DataVector(points.size()));
+    for (size_t s = 0; s < points.size(); ++s) {
+      for (size_t d = 0; d < 3; ++d) {
+        gsl::at(target_points, d)[s] = gsl::at(points[s], d);
+      }
+    }
+    const auto source_points = map.inverse(target_points);
+    for (size_t s = 0; s < points.size(); ++s) {
+      CAPTURE(points[s]);
+      const auto expected =
+          std::isnan(points[s][0]) ? std::nullopt : map.inverse(points[s]);
+      for (size_t d = 0; d < 3; ++d) {
+        if (expected.has_value()) {
+          CHECK(gsl::at(source_points, d)[s] ==
+                approx(gsl::at(*expected, d)));
+        } else {
+          CHECK(std::isnan(gsl::at(source_points, d)[s]));
+        }
+      }
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.Wedge3D.Map", "[Domain][Unit]") {
   test_wedge3d_fail();
+  test_wedge3d_batched_inverse();
   test_wedge3d_all_directions();
   test_wedge3d_alignment();
   test_wedge3d_random_radii();
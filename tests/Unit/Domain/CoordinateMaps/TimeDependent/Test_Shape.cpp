@@ -379,6 +379,21 @@ void test_analytical_solution(const TransitionFunction& transition_func,
       calculate_analytical_map(target_data, center, l_max, m_max, random_coefs,
                                random_00_coef, transition_func);
   CHECK_ITERABLE_APPROX(mapped_result, analytical_result);
+
+  // Evaluating the map at the same points again uses the cached interpolation
+  // info, which is shared with copies of the map and replaced when the map is
+  // evaluated at other points.
+  CHECK(map(target_data, time, functions_of_time) == mapped_result);
+  const auto other_target_data =
+      make_with_random_values<std::array<DataVector, 3>>(generator, dist,
+                                                         num_points + 1);
+  const auto map_copy = map;
+  CHECK_ITERABLE_APPROX(
+      map(other_target_data, time, functions_of_time),
+      calculate_analytical_map(other_target_data, center, l_max, m_max,
+                               random_coefs, random_00_coef, transition_func));
+  CHECK(map_copy(target_data, time, functions_of_time) == mapped_result);
+  CHECK(map(target_data, time, functions_of_time) == mapped_result);
 }
 
 // calculate the Jacobian using spherical harmonics directly
@@ -487,6 +502,8 @@ void test_analytical_jacobian(const TransitionFunction& transition_func,
       target_data, center, l_max, m_max, random_coefs, random_00_coef,
       transition_func);
   CHECK_ITERABLE_APPROX(mapped_jacobian, analytical_jacobian);
+  // Uses the cached interpolation info
+  CHECK(map.jacobian(target_data, time, functions_of_time) == mapped_jacobian);
 }
 
 template <typename Generator>
@@ -4,6 +4,8 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <cstdlib>
+#include <memory>
 #include <string>
 #include <type_traits>
 
@@ -19,6 +21,7 @@
 #include "Domain/Creators/Tags/ObjectCenter.hpp"
 #include "Domain/FunctionsOfTime/OptionTags.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Utilities/FileSystem.hpp"
 
 namespace domain {
 namespace {
@@ -32,6 +35,38 @@ void test_simple_tags() {
       "ExternalBoundaryConditions");
 }
 
+void test_domain_cache() {
+  const std::string cache_file = "Unit.Domain.Creators.Tags.DomainCache";
+  if (file_system::check_if_file_exists(cache_file)) {
+    file_system::rm(cache_file, false);
+  }
+  const auto make_brick = [](const size_t refinement) {
+    return std::unique_ptr<DomainCreator<3>>{
+        std::make_unique<domain::creators::Brick>(
+            std::array{0.0, 0.0, 0.0}, std::array{1.0, 1.0, 1.0},
+            std::array{refinement, refinement, refinement},
+            std::array{2_st, 2_st, 2_st}, std::array{false, false, false})};
+  };
+  const auto brick = make_brick(1);
+  const auto refined_brick = make_brick(2);
+
+  setenv("SPECTRE_DOMAIN_CACHE", cache_file.c_str(), 1);
+  const auto written = Tags::Domain<3>::create_from_options(brick);
+  CHECK(written == brick->create_domain());
+  CHECK(file_system::check_if_file_exists(cache_file));
+  CHECK(Tags::Domain<3>::create_from_options(brick) == written);
+  // A cache written for a different domain is replaced
+  CHECK(Tags::Domain<3>::create_from_options(refined_brick) ==
+        refined_brick->create_domain());
+  CHECK(Tags::Domain<3>::create_from_options(refined_brick) ==
+        refined_brick->create_domain());
+  unsetenv("SPECTRE_DOMAIN_CACHE");
+  file_system::rm(cache_file, false);
+
+  CHECK(Tags::Domain<3>::create_from_options(brick) == written);
+  CHECK_FALSE(file_system::check_if_file_exists(cache_file));
+}
+
 void test_center_tags() {
   TestHelpers::db::test_simple_tag<Tags::ObjectCenter<ObjectLabel::A>>(
       "ObjectCenterA");
@@ -86,6 +121,7 @@ SPECTRE_TEST_CASE("Unit.Domain.Creators.Tags", "[Unit][Domain]") {
   test_simple_tags<2>();
   test_simple_tags<3>();
 
+  test_domain_cache();
   test_center_tags();
 
   test_functions_of_time();
@@ -182,6 +182,99 @@ void test_func_and_derivs() {
       quartic(std::array<DataVector, 5>{{c0, c1, c2, c3, c4}}));
 }
 
+void test_long_history_and_truncation() {
+  INFO("Long history and truncation");
+  // The value is k between the update times k and k + 1
+  FunctionsOfTime::PiecewisePolynomial<0> f_of_t(0.0, {{{0.0}}}, 1.0);
+  const size_t number_of_updates = 40;
+  for (size_t k = 1; k <= number_of_updates; ++k) {
+    const auto update_time = static_cast<double>(k);
+    f_of_t.update(update_time, {update_time}, update_time + 1.0);
+  }
+  const auto check_at = [&f_of_t](const double t, const double expected) {
+    CAPTURE(t);
+    CHECK(f_of_t.func(t)[0] == DataVector{expected});
+  };
+  // Evaluations in order reuse the interval of the previous one, the others
+  // search for it.
+  for (size_t k = 0; k <= number_of_updates; ++k) {
+    const auto start = static_cast<double>(k);
+    check_at(start + 0.25, start);
+    check_at(start + 1.0, start);
+  }
+  for (size_t k = number_of_updates + 1; k-- > 0;) {
+    const auto start = static_cast<double>(k);
+    check_at(start + 0.5, start);
+  }
+  check_at(0.0, 0.0);
+  check_at(17.5, 17.0);
+  check_at(3.0, 2.0);
+  check_at(33.25, 33.0);
+
+  const auto f_of_t_copy = f_of_t;
+  f_of_t.truncate_at_time(10.5);
+  CHECK(f_of_t.time_bounds() == std::array{10.0, 41.0});
+  check_at(10.5, 10.0);
+  check_at(11.0, 10.0);
+  check_at(40.5, 40.0);
+  CHECK_THROWS_WITH(f_of_t.func(9.0),
+                    Catch::Matchers::ContainsSubstring("requested time 9") and
+                        Catch::Matchers::ContainsSubstring(
+                            " precedes earliest time 10"));
+  // Truncating at an earlier time than the history requires no changes
+  f_of_t.truncate_at_time(10.5);
+  f_of_t.truncate_at_time(3.0);
+  CHECK(f_of_t.time_bounds() == std::array{10.0, 41.0});
+  CHECK(f_of_t != f_of_t_copy);
+  const auto deserialized_f_of_t = serialize_and_deserialize(f_of_t);
+  CHECK(deserialized_f_of_t == f_of_t);
+  CHECK(deserialized_f_of_t.func(25.5)[0] == DataVector{25.0});
+  f_of_t.update(41.0, {41.0}, 42.0);
+  check_at(41.5, 41.0);
+  CHECK(f_of_t_copy.func(5.5)[0] == DataVector{5.0});
+}
+
+void test_cached_evaluations() {
+  INFO("Cached evaluations");
+  FunctionsOfTime::PiecewisePolynomial<3> f_of_t(
+      0.0, {{{1.0, 2.0}, {0.5, -1.0}, {0.2, 0.3}, {-0.1, 0.4}}}, 2.0);
+  const auto uncached_f_of_t = f_of_t;
+  // More times than are cached, evaluated with decreasing and increasing
+  // numbers of derivatives so that lower ones are read from higher ones.
+  const std::array times{0.1, 0.3, 0.7, 0.8, 1.1, 1.5};
+  for (size_t repeat = 0; repeat < 2; ++repeat) {
+    for (const double t : times) {
+      CAPTURE(t);
+      const auto expected = uncached_f_of_t.func_and_2_derivs(t);
+      const auto fresh_copy = uncached_f_of_t;
+      CHECK(fresh_copy.func_and_2_derivs(t) == expected);
+      CHECK(f_of_t.func_and_2_derivs(t) == expected);
+      CHECK(f_of_t.func_and_deriv(t)[1] == expected[1]);
+      CHECK(f_of_t.func(t)[0] == expected[0]);
+      CHECK(f_of_t.func(t + 0.01)[0] == fresh_copy.func(t + 0.01)[0]);
+      CHECK(f_of_t.func_and_2_derivs(t + 0.01) ==
+            fresh_copy.func_and_2_derivs(t + 0.01));
+    }
+  }
+
+  // Updating doesn't change the values at or before the update time.
+  const auto at_update = f_of_t.func_and_2_derivs(2.0);
+  f_of_t.update(2.0, {1.0, 1.0}, 3.0);
+  CHECK(f_of_t.func_and_2_derivs(2.0) == at_update);
+  CHECK(f_of_t.func_and_2_derivs(2.5) ==
+        FunctionsOfTime::PiecewisePolynomial<3>{f_of_t}.func_and_2_derivs(2.5));
+
+  // Assigning doesn't keep the cached values of the assigned-to object.
+  FunctionsOfTime::PiecewisePolynomial<3> other_f_of_t(
+      0.0, {{{3.0, 4.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}}, 2.0);
+  CHECK(other_f_of_t.func(0.7)[0] == DataVector{3.0, 4.0});
+  other_f_of_t = uncached_f_of_t;
+  CHECK(other_f_of_t.func(0.7)[0] == uncached_f_of_t.func(0.7)[0]);
+  other_f_of_t = FunctionsOfTime::PiecewisePolynomial<3>(
+      0.0, {{{3.0, 4.0}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}}, 2.0);
+  CHECK(other_f_of_t.func(0.7)[0] == DataVector{3.0, 4.0});
+}
+
 void test_serialization_versioning() {
   using Poly = FunctionsOfTime::PiecewisePolynomial<1>;
   register_classes_with_charm<Poly>();
@@ -427,6 +520,8 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.PiecewisePolynomial",
           Catch::Matchers::ContainsSubstring(
               " that is after the expiration time 2"));
 
+  test_long_history_and_truncation();
+  test_cached_evaluations();
   test_serialization_versioning();
 }
 }  // namespace domain
@@ -76,6 +76,37 @@ void test_serialization_versioning() {
   CHECK(dynamic_cast<const QuatFoT&>(*func) ==
         dynamic_cast<const QuatFoT&>(*deserialized));
 }
+
+void test_cached_quaternions() {
+  INFO("Cached quaternions");
+  domain::FunctionsOfTime::QuaternionFunctionOfTime<2> quat_f_of_t{
+      0.0, std::array<DataVector, 1>{DataVector{{1.0, 0.0, 0.0, 0.0}}},
+      std::array<DataVector, 3>{DataVector{3, 0.0},
+                                DataVector{0.1, -0.2, 0.3},
+                                DataVector{0.0, 0.05, 0.0}},
+      1.0};
+  const auto uncached_quat_f_of_t = quat_f_of_t;
+  // More times than are cached, each evaluated repeatedly and then again
+  // after the cache has moved on
+  const std::vector<double> times{0.1, 0.35, 0.5, 0.62, 0.8, 0.95, 1.0};
+  for (size_t repeat = 0; repeat < 2; ++repeat) {
+    for (const double t : times) {
+      CAPTURE(t);
+      const auto expected = uncached_quat_f_of_t.func_and_2_derivs(t);
+      const auto copy = uncached_quat_f_of_t;
+      CHECK(copy.func_and_2_derivs(t) == expected);
+      CHECK(quat_f_of_t.func_and_2_derivs(t) == expected);
+      CHECK(quat_f_of_t.func_and_deriv(t)[1] == expected[1]);
+      CHECK(quat_f_of_t.func(t)[0] == expected[0]);
+    }
+  }
+  // Evaluations at the update time are the same after the update.
+  const auto quaternion_at_update = quat_f_of_t.func(1.0);
+  quat_f_of_t.update(1.0, DataVector{3, 0.1}, 2.0);
+  CHECK(quat_f_of_t.func(1.0) == quaternion_at_update);
+  const auto copy = quat_f_of_t;
+  CHECK(quat_f_of_t.func(1.5) == copy.func(1.5));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.QuaternionFunctionOfTime",
@@ -432,5 +463,6 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.QuaternionFunctionOfTime",
     }
   }
 
+  test_cached_quaternions();
   test_serialization_versioning();
 }
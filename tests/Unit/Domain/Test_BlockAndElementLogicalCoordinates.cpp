@@ -173,6 +173,21 @@ void fuzzy_test_block_and_element_logical_coordinates(
     const auto pos = expected_coord_holders.find(holder_pair.first);
     CHECK(pos != expected_coord_holders.end());
   }
+
+  // The ElementLocator finds the same elements
+  const ElementLocator<Dim> locator{all_element_ids};
+  CHECK(locator.element_ids() == all_element_ids);
+  const auto located_result =
+      locator.element_logical_coordinates(block_logical_result);
+  CHECK(located_result.size() == element_logical_result.size());
+  for (const auto& [element_id, holder] : element_logical_result) {
+    const auto pos = located_result.find(element_id);
+    REQUIRE(pos != located_result.end());
+    using ::operator<<;
+    CHECK(pos->second.offsets == holder.offsets);
+    CHECK_ITERABLE_APPROX(pos->second.element_logical_coords,
+                          holder.element_logical_coords);
+  }
 }
 
 template <size_t Dim>
@@ -458,6 +473,11 @@ void test_block_and_element_logical_coordinates(
     expected_elem_logical.emplace_back(std::move(dum));
   }
 
+  const auto located_result =
+      ElementLocator<Dim>{element_ids}.element_logical_coordinates(
+          block_logical_result);
+  CHECK(located_result.size() == element_logical_result.size());
+
   for (size_t s = 0; s < expected_ids.size(); ++s) {
     const auto pos = element_logical_result.find(expected_ids[s]);
     INFO(expected_ids[s]);
@@ -468,6 +488,11 @@ void test_block_and_element_logical_coordinates(
       CHECK_ITERABLE_APPROX(holder.element_logical_coords,
                             expected_elem_logical[s]);
     }
+    const auto located = located_result.find(expected_ids[s]);
+    REQUIRE(located != located_result.end());
+    CHECK(located->second.offsets == expected_offset[s]);
+    CHECK_ITERABLE_APPROX(located->second.element_logical_coords,
+                          expected_elem_logical[s]);
   }
   // Make sure we got all the elements
   for (const auto& holder_pair : element_logical_result) {
@@ -756,6 +781,28 @@ void test_block_logical_coordinates_with_roundoff_error() {
     REQUIRE(result.has_value());
     CHECK(result->id.get_index() == expected_block_ids[i]);
   }
+  // With enough points the candidate blocks are proposed by bounding boxes,
+  // which must not change which block a boundary point is assigned to.
+  const size_t num_copies = 20;
+  tnsr::I<DataVector, 3> many_inertial_coords{num_copies * points.size()};
+  for (size_t d = 0; d < 3; ++d) {
+    for (size_t copy = 0; copy < num_copies; ++copy) {
+      for (size_t i = 0; i < points.size(); ++i) {
+        many_inertial_coords.get(d)[copy * points.size() + i] =
+            inertial_coords.get(d)[i];
+      }
+    }
+  }
+  const auto many_block_logical_coords =
+      block_logical_coordinates(domain, many_inertial_coords);
+  for (size_t j = 0; j < many_block_logical_coords.size(); ++j) {
+    CAPTURE(j);
+    REQUIRE(many_block_logical_coords[j].has_value());
+    CHECK(many_block_logical_coords[j]->id ==
+          block_logical_coords[j % points.size()]->id);
+    CHECK(many_block_logical_coords[j]->data ==
+          block_logical_coords[j % points.size()]->data);
+  }
   // See also WedgeOrientations.png in the Sphere docs.
   CHECK(get<0>(block_logical_coords[0]->data) < 1.0);
   CHECK(get<1>(block_logical_coords[1]->data) < 1.0);
@@ -778,6 +825,11 @@ SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
   fuzzy_test_block_and_element_logical_coordinates_shell(20);
   fuzzy_test_block_and_element_logical_coordinates_time_dependent_brick(20);
   fuzzy_test_block_and_element_logical_coordinates_distorted_brick(20);
+  // Enough points to search the blocks using their bounding boxes
+  fuzzy_test_block_and_element_logical_coordinates3(200);
+  fuzzy_test_block_and_element_logical_coordinates_shell(200);
+  fuzzy_test_block_and_element_logical_coordinates_time_dependent_brick(200);
+  fuzzy_test_block_and_element_logical_coordinates_distorted_brick(200);
   test_block_logical_coordinates1fail();
   test_element_ids_are_uniquely_determined();
   test_block_logical_coordinates_with_roundoff_error();
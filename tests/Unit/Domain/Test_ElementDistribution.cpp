@@ -3,10 +3,12 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -24,6 +26,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 // Test the weighting done by `domain::get_element_costs` for a uniform cost
@@ -114,8 +117,11 @@ void test_weighted_cost_function(const domain::ElementWeight element_weight) {
     elemental_cost_it3++;
   }
 
-  if (element_weight == domain::ElementWeight::NumGridPoints) {
-    // check that varying refinement doesn't affect the cost
+  if (element_weight == domain::ElementWeight::NumGridPoints or
+      element_weight == domain::ElementWeight::NumGridPointsAndLtsStepRate) {
+    // check that varying refinement doesn't affect the cost.  For
+    // NumGridPointsAndLtsStepRate the step rates are relative to the coarsest
+    // element, and all elements are the same size in each domain.
     CHECK(elemental_cost2 == elemental_cost1);
   } else {
     // element_weight == domain::ElementWeight::NumGridPointsAndGridSpacing
@@ -133,13 +139,37 @@ void test_weighted_cost_function(const domain::ElementWeight element_weight) {
   // The minimum grid spacing for the first and third domain are equal, but the
   // number of grid points in an element in the first is 64 while the number of
   // grid points in an element in the third is 24. Since elemental cost for
-  // either domain::Elementweight::NumGridPoints or
-  // domain::Elementweight::NumGridPointsAndGridSpacing should only scale by
+  // domain::Elementweight::NumGridPoints,
+  // domain::Elementweight::NumGridPointsAndGridSpacing, or
+  // domain::Elementweight::NumGridPointsAndLtsStepRate should only scale by
   // the # of grid points, the elemental cost of the third domain should be a
   // factor of 24/64 = 3/8 the cost of the first domain.
   CHECK(elemental_cost3 == elemental_cost1 * 3.0 / 8.0);
 }
 
+// Test the step rates used by
+// `domain::ElementWeight::NumGridPointsAndLtsStepRate`
+void test_lts_step_rate_cost_function() {
+  // Block 0 is split into two elements of width 0.5 and block 1 is a single
+  // element of width 3, so block 0 wants steps 6 times smaller, which is
+  // rounded up to 8 steps per step of block 1.
+  const auto domain_creator = domain::creators::AlignedLattice<1>(
+      {{{{0.0, 1.0, 4.0}}}}, {{0}}, {{4}}, {{{{{0}}, {{1}}, {{1}}}}}, {}, {});
+  const auto domain = domain_creator.create_domain();
+
+  const auto costs = domain::get_element_costs(
+      domain.blocks(), domain_creator.initial_refinement_levels(),
+      domain_creator.initial_extents(),
+      domain::ElementWeight::NumGridPointsAndLtsStepRate,
+      Spectral::Quadrature::GaussLobatto);
+
+  CHECK(costs.size() == 3);
+  for (const auto& [element_id, cost] : costs) {
+    CAPTURE(element_id);
+    CHECK(cost == (element_id.block_id() == 0 ? 32.0 : 4.0));
+  }
+}
+
 // Test the processor distribution logic of the
 // `domain::BlockZCurveProcDistribution` constructor for an unweighted element
 // distribution
@@ -498,6 +528,63 @@ void test_proc_retrieval(
     }
   }
 }
+
+// Test that `domain::BlockZCurveProcDistribution` never splits a tile of
+// elements across processors
+template <size_t Dim>
+void test_tiles(const DomainCreator<Dim>& domain_creator,
+                const size_t number_of_procs_with_elements,
+                const size_t tile_refinement_level) {
+  CAPTURE(tile_refinement_level);
+  const auto domain = domain_creator.create_domain();
+  const auto& blocks = domain.blocks();
+  const auto initial_refinement_levels =
+      domain_creator.initial_refinement_levels();
+  const auto initial_extents = domain_creator.initial_extents();
+
+  const auto costs = domain::get_element_costs(
+      blocks, initial_refinement_levels, initial_extents,
+      domain::ElementWeight::NumGridPointsAndGridSpacing,
+      Spectral::Quadrature::GaussLobatto);
+
+  const domain::BlockZCurveProcDistribution<Dim> element_distribution(
+      costs, number_of_procs_with_elements, blocks, initial_refinement_levels,
+      initial_extents, {}, tile_refinement_level);
+
+  std::unordered_set<size_t> procs_with_elements{};
+  for (size_t i = 0; i < blocks.size(); i++) {
+    const auto& refinement_levels = gsl::at(initial_refinement_levels, i);
+    size_t elements_per_tile = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      elements_per_tile *= two_to_the(
+          std::min(gsl::at(refinement_levels, d), tile_refinement_level));
+    }
+    for (const auto& proc_and_allowance :
+         element_distribution.block_element_distribution()[i]) {
+      CHECK(proc_and_allowance.second % elements_per_tile == 0);
+    }
+
+    // Elements in the same tile share their segment indices with the lowest
+    // `tile_refinement_level` bits removed
+    std::map<std::array<size_t, Dim>, size_t> proc_of_tile{};
+    for (const auto& element_id : initial_element_ids(i, refinement_levels)) {
+      std::array<size_t, Dim> tile_index{};
+      for (size_t d = 0; d < Dim; ++d) {
+        const auto& segment_id = element_id.segment_id(d);
+        gsl::at(tile_index, d) =
+            segment_id.index() >>
+            std::min(segment_id.refinement_level(), tile_refinement_level);
+      }
+      const size_t proc = element_distribution.get_proc_for_element(element_id);
+      procs_with_elements.insert(proc);
+      CHECK(proc_of_tile.emplace(tile_index, proc).first->second == proc);
+    }
+  }
+  // Tiles are still spread over the procs when there are enough of them
+  if (tile_refinement_level == 0) {
+    CHECK(procs_with_elements.size() == number_of_procs_with_elements);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
@@ -506,6 +593,9 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   test_weighted_cost_function(domain::ElementWeight::NumGridPoints);
   test_weighted_cost_function(
       domain::ElementWeight::NumGridPointsAndGridSpacing);
+  test_weighted_cost_function(
+      domain::ElementWeight::NumGridPointsAndLtsStepRate);
+  test_lts_step_rate_cost_function();
 
   // Inputs for testing `BlockZCurveProcDistribution`
 
@@ -531,6 +621,8 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   test_weighted_element_distribution_construction(
       domain::ElementWeight::NumGridPointsAndGridSpacing, lattice_3d, 22,
       std::unordered_set<size_t>{3, 4});
+  test_weighted_element_distribution_construction(
+      domain::ElementWeight::NumGridPointsAndLtsStepRate, lattice_3d, 7);
   // weighted distribution, more procs than elements to distribute
   test_weighted_element_distribution_construction(
       domain::ElementWeight::NumGridPoints, lattice_2d, 100,
@@ -543,4 +635,11 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   // `Element`s in the domain
   test_proc_retrieval(domain::ElementWeight::NumGridPointsAndGridSpacing,
                       lattice_2d, 100, std::unordered_set<size_t>{17});
+
+  // Test keeping tiles of elements on the same processor
+  for (const size_t tile_refinement_level : {0_st, 1_st, 2_st, 4_st}) {
+    test_tiles(lattice_1d, 3, tile_refinement_level);
+    test_tiles(lattice_2d, 7, tile_refinement_level);
+    test_tiles(lattice_3d, 5, tile_refinement_level);
+  }
 }
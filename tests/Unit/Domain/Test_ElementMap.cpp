@@ -185,11 +185,51 @@ void test_element_map<3>() {
       CoordinateMaps::Wedge<3>{3.0, 7.0, 0.8, 0.9, OrientationMap<3>{}, true},
       logical_point_double, logical_point_dv);
 }
+
+void test_shared_block_map() {
+  using Affine = CoordinateMaps::Affine;
+  PUPable_reg(
+      SINGLE_ARG(CoordinateMap<Frame::BlockLogical, Frame::Inertial, Affine>));
+  const std::shared_ptr<
+      const CoordinateMapBase<Frame::BlockLogical, Frame::Inertial, 1>>
+      block_map{make_coordinate_map_base<Frame::BlockLogical, Frame::Inertial>(
+          Affine{-1.0, 1.0, 2.0, 8.0})};
+  const ElementMap lower_map{
+      ElementId<1>(0, std::array<SegmentId, 1>({{SegmentId(1, 0)}})),
+      block_map};
+  const ElementMap upper_map{
+      ElementId<1>(0, std::array<SegmentId, 1>({{SegmentId(1, 1)}})),
+      block_map};
+  CHECK(&lower_map.block_map() == block_map.get());
+  CHECK(&upper_map.block_map() == block_map.get());
+  CHECK(lower_map(tnsr::I<double, 1, Frame::ElementLogical>{1.0}) ==
+        upper_map(tnsr::I<double, 1, Frame::ElementLogical>{-1.0}));
+
+  // Equal maps unpacked in the same process are shared
+  const auto lower_map_deserialized = serialize_and_deserialize(lower_map);
+  const auto upper_map_deserialized = serialize_and_deserialize(upper_map);
+  CHECK(&lower_map_deserialized.block_map() ==
+        &upper_map_deserialized.block_map());
+  CHECK(&lower_map_deserialized.block_map() != block_map.get());
+  CHECK(lower_map_deserialized.block_map() == *block_map);
+  CHECK(lower_map_deserialized.element_id() == lower_map.element_id());
+  CHECK(upper_map_deserialized.element_id() == upper_map.element_id());
+
+  const ElementMap other_map{
+      ElementId<1>(0, std::array<SegmentId, 1>({{SegmentId(1, 0)}})),
+      make_coordinate_map_base<Frame::BlockLogical, Frame::Inertial>(
+          Affine{-1.0, 1.0, 2.0, 9.0})};
+  const auto other_map_deserialized = serialize_and_deserialize(other_map);
+  CHECK(&other_map_deserialized.block_map() !=
+        &lower_map_deserialized.block_map());
+  CHECK(other_map_deserialized.block_map() == other_map.block_map());
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.ElementMap", "[Unit][Domain]") {
   test_element_map<1>();
   test_element_map<2>();
   test_element_map<3>();
+  test_shared_block_map();
 }
 }  // namespace domain
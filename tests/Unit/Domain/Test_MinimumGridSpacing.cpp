@@ -5,14 +5,26 @@
 
 #include <cmath>
 #include <cstddef>
+#include <limits>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/CoordinateMaps/Rotation.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
 
 // IWYU pragma: no_include "Utilities/Array.hpp"
 
@@ -93,6 +105,51 @@ void check_frame() {
   check<3, Frame>(
       Matrix{{1.0, 1.0, -1.0}, {1.0, -1.0, 1.0}, {-1.0, 1.0, 1.0}}, sqrt(3.));
 }
+
+void check_inertial_spacing() {
+  using Affine = domain::CoordinateMaps::Affine;
+  using Affine2D = domain::CoordinateMaps::ProductOf2Maps<Affine, Affine>;
+  const Mesh<2> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, 2, Frame::Inertial> inertial_coords{};
+  for (size_t d = 0; d < 2; ++d) {
+    inertial_coords.get(d) = 2.0 * logical_coords.get(d);
+  }
+  // Deliberately inconsistent with the inertial coordinates, to check which
+  // one is used.
+  const double grid_spacing = 0.3;
+
+  const auto inertial_spacing =
+      [&mesh, &grid_spacing, &inertial_coords](const auto& map) {
+        double result = std::numeric_limits<double>::signaling_NaN();
+        domain::Tags::MinimumInertialGridSpacingCompute<2>::function(
+            make_not_null(&result), mesh, grid_spacing, map, inertial_coords);
+        return result;
+      };
+
+  const auto identity =
+      domain::make_coordinate_map<Frame::Grid, Frame::Inertial>(
+          Affine2D{Affine{-1.0, 1.0, -1.0, 1.0}, Affine{-1.0, 1.0, -1.0, 1.0}});
+  CHECK(identity.preserves_distances());
+  CHECK(inertial_spacing(identity) == grid_spacing);
+  const auto rotation =
+      domain::make_coordinate_map<Frame::Grid, Frame::Inertial>(
+          domain::CoordinateMaps::Rotation<2>{0.7});
+  CHECK(rotation.preserves_distances());
+  CHECK(inertial_spacing(rotation) == grid_spacing);
+  const auto expansion =
+      domain::make_coordinate_map<Frame::Grid, Frame::Inertial>(
+          Affine2D{Affine{-1.0, 1.0, -2.0, 2.0}, Affine{-1.0, 1.0, -2.0, 2.0}});
+  CHECK_FALSE(expansion.preserves_distances());
+  CHECK(inertial_spacing(expansion) == approx(2.0));
+  const auto rotation_and_expansion =
+      domain::make_coordinate_map<Frame::Grid, Frame::Inertial>(
+          domain::CoordinateMaps::Rotation<2>{0.7},
+          Affine2D{Affine{-1.0, 1.0, -2.0, 2.0}, Affine{-1.0, 1.0, -2.0, 2.0}});
+  CHECK_FALSE(rotation_and_expansion.preserves_distances());
+  CHECK(inertial_spacing(rotation_and_expansion) == approx(2.0));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.MinimumGridSpacing", "[Domain][Unit]") {
@@ -102,6 +159,10 @@ SPECTRE_TEST_CASE("Unit.Domain.MinimumGridSpacing", "[Domain][Unit]") {
   TestHelpers::db::test_compute_tag<
       domain::Tags::MinimumGridSpacingCompute<3, Frame::Inertial>>(
       "MinimumGridSpacing");
+  TestHelpers::db::test_compute_tag<
+      domain::Tags::MinimumInertialGridSpacingCompute<3>>(
+      "MinimumGridSpacing");
   check_frame<Frame::Grid>();
   check_frame<Frame::Inertial>();
+  check_inertial_spacing();
 }
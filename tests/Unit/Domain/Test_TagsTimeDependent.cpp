@@ -337,6 +337,69 @@ void test() {
   check_helper(4.5);
 }
 
+// The map must only be evaluated again when the functions of time it uses
+// change.
+template <size_t Dim>
+void test_recompute_only_if_functions_of_time_change() {
+  using map_tag =
+      domain::CoordinateMaps::Tags::CoordinateMap<Dim, Frame::Grid,
+                                                  Frame::Inertial>;
+  using quantities_tag = domain::Tags::CoordinatesMeshVelocityAndJacobians<Dim>;
+  const std::string function_of_time_name = "Translation";
+  const size_t num_pts = 4;
+  tnsr::I<DataVector, Dim, Frame::Grid> grid_coords{num_pts};
+  for (size_t i = 0; i < Dim; ++i) {
+    grid_coords.get(i) = DataVector{num_pts, 0.1 * static_cast<double>(i + 1)};
+  }
+
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  // Constant until t = 2, after which the translation moves
+  functions_of_time[function_of_time_name] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<1>>(
+          0.0, std::array<DataVector, 2>{{{Dim, 1.0}, {Dim, 0.0}}}, 2.0);
+  dynamic_cast<domain::FunctionsOfTime::PiecewisePolynomial<1>&>(
+      *functions_of_time[function_of_time_name])
+      .update(2.0, DataVector{Dim, 3.0}, 10.0);
+
+  auto box = db::create<
+      db::AddSimpleTags<Tags::Time, domain::Tags::Coordinates<Dim, Frame::Grid>,
+                        domain::Tags::FunctionsOfTimeInitialize, map_tag>,
+      db::AddComputeTags<
+          domain::Tags::CoordinatesMeshVelocityAndJacobiansCompute<map_tag>>>(
+      0.5, grid_coords, std::move(functions_of_time),
+      std::unique_ptr<
+          domain::CoordinateMapBase<Frame::Grid, Frame::Inertial, Dim>>{
+          std::make_unique<ConcreteMap<Dim>>(
+              create_coord_map<Dim>(function_of_time_name))});
+
+  const auto check = [&box, &grid_coords]() {
+    const auto expected = db::get<map_tag>(box).coords_frame_velocity_jacobians(
+        grid_coords, db::get<Tags::Time>(box),
+        db::get<domain::Tags::FunctionsOfTime>(box));
+    const auto& quantities = db::get<quantities_tag>(box);
+    REQUIRE(quantities.has_value());
+    CHECK_ITERABLE_APPROX(std::get<0>(*quantities), std::get<0>(expected));
+    CHECK_ITERABLE_APPROX(std::get<3>(*quantities), std::get<3>(expected));
+    return std::get<0>(*quantities).get(0).data();
+  };
+  const auto set_time = [&box](const double time) {
+    db::mutate<Tags::Time>(
+        [time](const gsl::not_null<double*> local_time) { *local_time = time; },
+        make_not_null(&box));
+  };
+
+  const double* const initial_data = check();
+  set_time(1.5);
+  CHECK(check() == initial_data);
+  set_time(2.5);
+  CHECK(check() != initial_data);
+  const double* const moving_data = check();
+  set_time(3.5);
+  CHECK(check() != moving_data);
+}
+
 SPECTRE_TEST_CASE("Unit.Domain.TagsTimeDependent", "[Unit][Actions]") {
   test_tags<1>();
   test_tags<2>();
@@ -349,5 +412,9 @@ SPECTRE_TEST_CASE("Unit.Domain.TagsTimeDependent", "[Unit][Actions]") {
   test<1, false>();
   test<2, false>();
   test<3, false>();
+
+  test_recompute_only_if_functions_of_time_change<1>();
+  test_recompute_only_if_functions_of_time_change<2>();
+  test_recompute_only_if_functions_of_time_change<3>();
 }
 }  // namespace
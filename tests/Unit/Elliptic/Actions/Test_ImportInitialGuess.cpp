@@ -0,0 +1,193 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Elliptic/Actions/ImportInitialGuess.hpp"
+#include "Elliptic/Actions/InitializeFields.hpp"
+#include "Elliptic/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Importers/Actions/ReadVolumeData.hpp"
+#include "IO/Importers/ElementDataReader.hpp"
+#include "IO/Importers/Tags.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/Phase.hpp"
+#include "PointwiseFunctions/InitialDataUtilities/InitialGuess.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+
+struct ScalarFieldTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+struct VectorFieldTag : db::SimpleTag {
+  using type = tnsr::I<DataVector, 1>;
+};
+
+struct System {
+  using primal_fields = tmpl::list<ScalarFieldTag, VectorFieldTag>;
+};
+
+using NumericInitialGuess =
+    elliptic::NumericInitialGuess<typename System::primal_fields>;
+using initial_guess_tag =
+    elliptic::Tags::InitialGuess<elliptic::analytic_data::InitialGuess>;
+
+template <typename Metavariables>
+struct ElementArray {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          Parallel::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<
+              tmpl::list<domain::Tags::Coordinates<1, Frame::Inertial>>>>>,
+      Parallel::PhaseActions<
+          Parallel::Phase::Testing,
+          tmpl::list<
+              elliptic::Actions::InitializeFields<System, initial_guess_tag>,
+              elliptic::Actions::ReadNumericInitialGuess<System,
+                                                         initial_guess_tag>,
+              elliptic::Actions::ReceiveNumericInitialGuess<
+                  System, initial_guess_tag>>>>;
+};
+
+struct MockReadVolumeData {
+  template <typename ParallelComponent, typename DataBox,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(
+      DataBox& /*box*/, Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/,
+      const importers::ImporterOptions& options, const size_t volume_data_id,
+      tuples::tagged_tuple_from_typelist<
+          db::wrap_tags_in<importers::Tags::Selected,
+                           typename System::primal_fields>>
+          selected_fields) {
+    const auto& initial_guess =
+        dynamic_cast<const NumericInitialGuess&>(get<initial_guess_tag>(cache));
+    CHECK(options == initial_guess.importer_options());
+    CHECK(volume_data_id == initial_guess.volume_data_id());
+    CHECK(get<importers::Tags::Selected<ScalarFieldTag>>(selected_fields) ==
+          "CustomScalar");
+    CHECK(get<importers::Tags::Selected<VectorFieldTag>>(selected_fields) ==
+          "CustomVector");
+  }
+};
+
+template <typename Metavariables>
+struct MockVolumeDataReader {
+  using component_being_mocked = importers::ElementDataReader<Metavariables>;
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = size_t;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+  using replace_these_simple_actions =
+      tmpl::list<importers::Actions::ReadAllVolumeDataAndDistribute<
+          1, typename System::primal_fields, ElementArray<Metavariables>>>;
+  using with_these_simple_actions = tmpl::list<MockReadVolumeData>;
+};
+
+struct Metavariables {
+  static constexpr size_t volume_dim = 1;
+  using component_list = tmpl::list<ElementArray<Metavariables>,
+                                    MockVolumeDataReader<Metavariables>>;
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes =
+        tmpl::map<tmpl::pair<elliptic::analytic_data::InitialGuess,
+                             tmpl::list<NumericInitialGuess>>>;
+  };
+};
+
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Elliptic.Actions.ImportInitialGuess",
+                  "[Unit][Elliptic][Actions]") {
+  register_factory_classes_with_charm<Metavariables>();
+  const NumericInitialGuess initial_guess{
+      "Solution*.h5", "VolumeData", importers::ObservationSelector::Last, true,
+      NumericInitialGuess::SelectedVariables{"CustomScalar", "CustomVector"}};
+  {
+    INFO("Options and serialization");
+    const auto created = TestHelpers::test_creation<
+        std::unique_ptr<elliptic::analytic_data::InitialGuess>, Metavariables>(
+        "NumericInitialGuess:\n"
+        "  FileGlob: Solution*.h5\n"
+        "  Subgroup: VolumeData\n"
+        "  ObservationValue: Last\n"
+        "  Interpolate: True\n"
+        "  Variables:\n"
+        "    ScalarFieldTag: CustomScalar\n"
+        "    VectorFieldTag: CustomVector\n");
+    CHECK(dynamic_cast<const NumericInitialGuess&>(*created) == initial_guess);
+    test_serialization(initial_guess);
+    const NumericInitialGuess other_file{
+        "OtherSolution.h5", "VolumeData", importers::ObservationSelector::Last,
+        true,
+        NumericInitialGuess::SelectedVariables{"CustomScalar", "CustomVector"}};
+    CHECK(other_file != initial_guess);
+    CHECK(other_file.volume_data_id() != initial_guess.volume_data_id());
+  }
+
+  using element_array = ElementArray<Metavariables>;
+  using reader_component = MockVolumeDataReader<Metavariables>;
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {std::make_unique<NumericInitialGuess>(initial_guess)}};
+  ActionTesting::emplace_nodegroup_component<reader_component>(
+      make_not_null(&runner));
+  const ElementId<1> element_id{0};
+  const tnsr::I<DataVector, 1> inertial_coords{
+      {{DataVector{-1., 0., 1.}}}};
+  ActionTesting::emplace_component_and_initialize<element_array>(
+      make_not_null(&runner), element_id, {inertial_coords});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+  const auto get_tag = [&runner, &element_id](auto tag_v) -> const auto& {
+    using tag = std::decay_t<decltype(tag_v)>;
+    return ActionTesting::get_databox_tag<element_array, tag>(runner,
+                                                              element_id);
+  };
+
+  // InitializeFields
+  ActionTesting::next_action<element_array>(make_not_null(&runner), element_id);
+  CHECK(get(get_tag(ScalarFieldTag{})) == DataVector(3, 0.));
+  CHECK(get<0>(get_tag(VectorFieldTag{})) == DataVector(3, 0.));
+
+  // ReadNumericInitialGuess
+  ActionTesting::next_action<element_array>(make_not_null(&runner), element_id);
+  REQUIRE_FALSE(ActionTesting::next_action_if_ready<element_array>(
+      make_not_null(&runner), element_id));
+  ActionTesting::invoke_queued_simple_action<reader_component>(
+      make_not_null(&runner), 0);
+
+  // ReceiveNumericInitialGuess
+  using inbox_tag = importers::Tags::VolumeData<System::primal_fields>;
+  auto& inbox =
+      ActionTesting::get_inbox_tag<element_array, inbox_tag, Metavariables>(
+          make_not_null(&runner), element_id)[initial_guess.volume_data_id()];
+  get<ScalarFieldTag>(inbox) = Scalar<DataVector>{DataVector{1., 2., 3.}};
+  get<VectorFieldTag>(inbox) =
+      tnsr::I<DataVector, 1>{{{DataVector{4., 5., 6.}}}};
+  ActionTesting::next_action<element_array>(make_not_null(&runner), element_id);
+  CHECK(get(get_tag(ScalarFieldTag{})) == DataVector{1., 2., 3.});
+  CHECK(get<0>(get_tag(VectorFieldTag{})) == DataVector{4., 5., 6.});
+}
@@ -533,6 +533,19 @@ void test(const bool time_runs_forward) {
         {{step_center, center_vars},
          {second_trigger, initial_vars + 0.75 * step_size * deriv_vars}});
   }
+
+  // Multiple triggers at the same time
+  {
+    MockRuntimeSystem runner{
+        {std::make_unique<TimeSteppers::AdamsBashforth>(1)}};
+    set_up_component(&runner, {{step_center, true, done_time, true},
+                               {step_center, true, done_time, false},
+                               {step_center, true, done_time, true}});
+    TestCase::check_dense(&runner, true,
+                          {{step_center, center_vars},
+                           {step_center, center_vars},
+                           {step_center, center_vars}});
+  }
 }
 
 namespace test_postprocessors {
@@ -600,6 +613,16 @@ struct ModifyEvolved {
   }
 };
 
+struct CountEvaluations {
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+  static void apply() { ++evaluations; }
+
+  static size_t evaluations;
+};
+
+size_t CountEvaluations::evaluations = 0;
+
 struct NotReady {
   using return_tags = tmpl::list<>;
   using argument_tags = tmpl::list<>;
@@ -704,6 +727,29 @@ struct PostprocessEvolved {
                   [](const Scalar<DataVector>& v) { return -2.0 * get(v); }});
   }
 };
+
+struct CountEvaluations {
+  using postprocessors = tmpl::list<
+      AlwaysReadyPostprocessor<test_postprocessors::CountEvaluations>>;
+  using metavariables = Metavariables<postprocessors>;
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavariables>;
+  static void check_dense(
+      const gsl::not_null<MockRuntimeSystem*> runner, const bool should_run,
+      const std::vector<std::pair<double, EvolvedVariables>>& expected_calls) {
+    test_postprocessors::CountEvaluations::evaluations = 0;
+    CHECK(run_if_ready(runner) == should_run);
+    // All events at the same time should share a single dense output
+    // evaluation.
+    std::vector<double> times{};
+    for (const auto& call : expected_calls) {
+      if (times.empty() or times.back() != call.first) {
+        times.push_back(call.first);
+      }
+    }
+    CHECK(test_postprocessors::CountEvaluations::evaluations == times.size());
+    TestEvent::check_calls(expected_calls);
+  }
+};
 }  // namespace test_cases
 
 evolution::EventsAndDenseTriggers make_events_and_dense_triggers() {
@@ -768,6 +814,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.RunEventsAndDenseTriggers",
     test<test_cases::PostprocessA>(time_runs_forward);
     test<test_cases::PostprocessAll>(time_runs_forward);
     test<test_cases::PostprocessEvolved>(time_runs_forward);
+    test<test_cases::CountEvaluations>(time_runs_forward);
   }
   static_assert(tt::assert_conforms_to_v<
                 evolution::Actions::ProjectRunEventsAndDenseTriggers,
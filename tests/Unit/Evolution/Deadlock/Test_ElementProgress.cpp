@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <optional>
+#include <string>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/Deadlock/ElementProgress.hpp"
+#include "Time/Slab.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.Deadlock.ElementProgress",
+                  "[Unit][Evolution]") {
+  deadlock::ProgressRegistry<1> registry{};
+  const Slab slab(0.0, 1.0);
+  const TimeStepId first_step(true, 0, slab.start());
+  const TimeStepId second_step(true, 1, slab.end());
+  const ElementId<1> element_0(0);
+  const ElementId<1> element_1(1);
+  const ElementId<1> element_2(2);
+  const ElementId<1> element_3(3);
+
+  registry.record({element_0, second_step, 10.0, 0, std::nullopt});
+  registry.record({element_1, first_step, 5.0, 1, element_2});
+  registry.record({element_2, first_step, 3.0, 0, element_3});
+  registry.record({element_3, second_step, 4.0, 2, ElementId<1>(7)});
+  // Later records replace earlier ones
+  registry.record({element_0, second_step, 11.0, 0, std::nullopt});
+
+  const auto slowest = registry.slowest(3);
+  REQUIRE(slowest.size() == 3);
+  CHECK(slowest[0].element_id == element_2);
+  CHECK(slowest[1].element_id == element_1);
+  CHECK(slowest[2].element_id == element_3);
+  CHECK(registry.slowest(10).size() == 4);
+
+  const std::string report = registry.report(2, 12.0);
+  CAPTURE(report);
+  CHECK(report.find("2 slowest of 4 elements") != std::string::npos);
+  CHECK(report.find(get_output(element_1) + " at " + get_output(first_step) +
+                    ", last heartbeat 7s ago, 1 pending boundary messages, " +
+                    "waiting on " + get_output(element_2) + " at " +
+                    get_output(first_step) + " -> " + get_output(element_3) +
+                    " at " + get_output(second_step) + " -> " +
+                    get_output(ElementId<1>(7)) + " (not on this node)") !=
+        std::string::npos);
+  CHECK(report.find(get_output(element_0)) == std::string::npos);
+
+  registry.record({element_3, second_step, 4.0, 2, element_1});
+  CHECK(registry.report(1, 12.0).find(get_output(element_1) + " (cycle)") !=
+        std::string::npos);
+
+  registry.set_report_interval(std::nullopt);
+  CHECK_FALSE(registry.claim_report(0.0));
+  CHECK_FALSE(registry.claim_report(100.0));
+  registry.set_report_interval(2.0);
+  CHECK_FALSE(registry.claim_report(100.0));
+  CHECK_FALSE(registry.claim_report(101.0));
+  CHECK(registry.claim_report(102.5));
+  CHECK_FALSE(registry.claim_report(103.0));
+  CHECK(registry.claim_report(104.5));
+}
@@ -43,6 +43,7 @@
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
+#include "Evolution/DgSubcell/Tags/TciCadence.hpp"
 #include "Evolution/DgSubcell/Tags/TciGridHistory.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/Initialization/SetVariables.hpp"
@@ -520,6 +521,9 @@ void test(const bool always_use_subcell, const bool interior_element,
       runner, self_id));
   CHECK(ActionTesting::tag_is_retrievable<
         comp, evolution::dg::subcell::Tags::TciDecision>(runner, self_id));
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::TciCadence>(runner, self_id) ==
+        evolution::dg::subcell::TciCadence{});
   CHECK(ActionTesting::tag_is_retrievable<
         comp, evolution::dg::subcell::Tags::NeighborTciDecisions<Dim>>(
       runner, self_id));
@@ -0,0 +1,72 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "Evolution/DgSubcell/GhostDataPrecision.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace evolution::dg::subcell {
+namespace {
+struct DefaultMetavariables {
+  struct SubcellOptions {};
+};
+
+struct FloatMetavariables {
+  struct SubcellOptions {
+    static constexpr bool send_ghost_data_as_float = true;
+  };
+};
+
+static_assert(not send_ghost_data_as_float_v<DefaultMetavariables>);
+static_assert(send_ghost_data_as_float_v<FloatMetavariables>);
+
+void test(const size_t number_of_ghost_values,
+          const size_t number_of_trailing_doubles) {
+  CAPTURE(number_of_ghost_values);
+  CAPTURE(number_of_trailing_doubles);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  MAKE_GENERATOR(gen);
+
+  const auto data = make_with_random_values<DataVector>(
+      make_not_null(&gen), make_not_null(&dist),
+      DataVector{number_of_ghost_values + number_of_trailing_doubles});
+
+  const DataVector packed =
+      pack_ghost_data_as_float(data, number_of_trailing_doubles);
+  CHECK(packed.size() == 1 + (number_of_ghost_values + 1) / 2 +
+                             number_of_trailing_doubles);
+
+  const DataVector unpacked = unpack_ghost_data_from_float(packed);
+  REQUIRE(unpacked.size() == data.size());
+  Approx custom_approx =
+      Approx::custom()
+          .epsilon(10.0 * std::numeric_limits<float>::epsilon())
+          .scale(1.0);
+  for (size_t i = 0; i < number_of_ghost_values; ++i) {
+    CHECK(custom_approx(unpacked[i]) == data[i]);
+    CHECK(unpacked[i] == static_cast<double>(static_cast<float>(data[i])));
+  }
+  // The RDMP data must round trip exactly.
+  for (size_t i = number_of_ghost_values; i < data.size(); ++i) {
+    CHECK(unpacked[i] == data[i]);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.GhostDataPrecision",
+                  "[Evolution][Unit]") {
+  for (const size_t number_of_ghost_values : {0_st, 1_st, 2_st, 7_st, 48_st}) {
+    for (const size_t number_of_trailing_doubles : {0_st, 1_st, 10_st}) {
+      test(number_of_ghost_values, number_of_trailing_doubles);
+    }
+  }
+}
+}  // namespace
+}  // namespace evolution::dg::subcell
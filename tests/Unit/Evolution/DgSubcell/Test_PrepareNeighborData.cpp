@@ -5,8 +5,11 @@
 
 #include <cstddef>
 #include <iterator>
+#include <optional>
+#include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -175,8 +178,10 @@ class TestCreator : public DomainCreator<Dim> {
 
 template <size_t Dim>
 void test(const bool all_neighbors_are_doing_dg,
-          const ::fd::DerivativeOrder fd_derivative_order) {
+          const ::fd::DerivativeOrder fd_derivative_order,
+          const bool element_is_dg_only = false) {
   CAPTURE(all_neighbors_are_doing_dg);
+  CAPTURE(element_is_dg_only);
   CAPTURE(fd_derivative_order);
   CAPTURE(Dim);
   using variables_tag = ::Tags::Variables<tmpl::list<Var1>>;
@@ -202,6 +207,13 @@ void test(const bool all_neighbors_are_doing_dg,
   const bool always_use_subcell = false;
   const bool use_halo = false;
 
+  std::optional<std::vector<std::string>> only_dg_block_names{};
+  if (element_is_dg_only) {
+    only_dg_block_names = std::vector<std::string>{"Block0"};
+  } else if (all_neighbors_are_doing_dg) {
+    only_dg_block_names = std::vector<std::string>{"Block1"};
+  }
+
   // set subcell options
   const evolution::dg::subcell::SubcellOptions& subcell_options =
       evolution::dg::subcell::SubcellOptions{
@@ -209,9 +221,7 @@ void test(const bool all_neighbors_are_doing_dg,
               1.0e-3, 1.0e-4, 2.0e-3, 2.0e-4, 5.0, 4.0, always_use_subcell,
               evolution::dg::subcell::fd::ReconstructionMethod::DimByDim,
               use_halo,
-              all_neighbors_are_doing_dg
-                  ? std::optional{std::vector<std::string>{"Block1"}}
-                  : std::optional<std::vector<std::string>>{},
+              only_dg_block_names,
               fd_derivative_order},
           TestCreator<Dim>{}};
 
@@ -235,7 +245,8 @@ void test(const bool all_neighbors_are_doing_dg,
       make_not_null(&box), volume_fluxes);
 
   CHECK(ghost_data_mesh ==
-        (all_neighbors_are_doing_dg ? dg_mesh : subcell_mesh));
+        (all_neighbors_are_doing_dg or element_is_dg_only ? dg_mesh
+                                                          : subcell_mesh));
 
   const auto& rdmp_tci_data =
       db::get<evolution::dg::subcell::Tags::DataForRdmpTci>(box);
@@ -248,7 +259,12 @@ void test(const bool all_neighbors_are_doing_dg,
   DirectionMap<Dim, DataVector> expected_neighbor_data{};
 
   const bool need_fluxes = fd_derivative_order != ::fd::DerivativeOrder::Two;
-  if (all_neighbors_are_doing_dg) {
+  if (element_is_dg_only) {
+    // Neighbors of elements in DG-only blocks only get the RDMP data.
+    for (const auto& direction : expected_neighbor_directions<Dim>()) {
+      expected_neighbor_data.insert(std::pair{direction, DataVector{}});
+    }
+  } else if (all_neighbors_are_doing_dg) {
     DataVector data{expected_vars.size() +
                     (need_fluxes ? volume_fluxes.size() : 0)};
     std::copy(get(get<Var1>(expected_vars)).begin(),
@@ -262,7 +278,12 @@ void test(const bool all_neighbors_are_doing_dg,
     }
 
     for (const auto& direction : expected_neighbor_directions<Dim>()) {
-      expected_neighbor_data.insert(std::pair{direction, data});
+      // Neighbors in the DG-only block only get the RDMP data.
+      expected_neighbor_data.insert(std::pair{
+          direction,
+          element.neighbors().at(direction).ids().begin()->block_id() == 1
+              ? DataVector{}
+              : data});
     }
   } else {
     // Set all directions to false, enable the desired ones below
@@ -310,10 +331,14 @@ void test(const bool all_neighbors_are_doing_dg,
 
   for (const auto& direction : expected_neighbor_directions<Dim>()) {
     const auto& data_in_direction = data_for_neighbors.at(direction);
-    CHECK_ITERABLE_APPROX(
-        expected_neighbor_data.at(direction),
-        (DataVector{const_cast<double*>(data_in_direction.data()),
-                    data_in_direction.size() - 2}));
+    if (expected_neighbor_data.at(direction).empty()) {
+      CHECK(data_in_direction.size() == 2);
+    } else {
+      CHECK_ITERABLE_APPROX(
+          expected_neighbor_data.at(direction),
+          (DataVector{const_cast<double*>(data_in_direction.data()),
+                      data_in_direction.size() - 2}));
+    }
     CHECK(*std::prev(data_in_direction.end(), 2) == approx(1.0));
     CHECK(*std::prev(data_in_direction.end(), 1) == approx(-1.0));
   }
@@ -330,5 +355,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.PrepareNeighborData",
     test<1>(all_neighbors_are_doing_dg, fd_deriv_order);
     test<2>(all_neighbors_are_doing_dg, fd_deriv_order);
     test<3>(all_neighbors_are_doing_dg, fd_deriv_order);
+    test<1>(all_neighbors_are_doing_dg, fd_deriv_order, true);
+    test<2>(all_neighbors_are_doing_dg, fd_deriv_order, true);
+    test<3>(all_neighbors_are_doing_dg, fd_deriv_order, true);
   }
 }
@@ -5,13 +5,17 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <unordered_set>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Evolution/DgSubcell/Projection.hpp"
+#include "Evolution/DgSubcell/SliceData.hpp"
 #include "Helpers/Evolution/DgSubcell/ProjectionTestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
@@ -172,6 +176,65 @@ void test_project_on_face_fd() {
   }
 }
 
+template <size_t MaxPts, size_t Dim, Spectral::Basis BasisType,
+          Spectral::Quadrature QuadratureType>
+void test_project_to_ghost_zones() {
+  CAPTURE(Dim);
+  CAPTURE(BasisType);
+  CAPTURE(QuadratureType);
+  const size_t ghost_zone_size = 2;
+  const size_t additional_buffer = 3;
+  const size_t number_of_components = 2;
+
+  for (size_t num_pts_1d = std::max(
+           static_cast<size_t>(2),
+           Spectral::minimum_number_of_points<BasisType, QuadratureType>);
+       num_pts_1d < MaxPts + 1; ++num_pts_1d) {
+    CAPTURE(num_pts_1d);
+    const Mesh<Dim> dg_mesh{num_pts_1d, BasisType, QuadratureType};
+    const Index<Dim> subcell_extents{2 * num_pts_1d - 1};
+    const DataVector nodal_values =
+        TestHelpers::evolution::dg::subcell::cell_values(
+            dg_mesh.extents(0) - 2, logical_coordinates(dg_mesh));
+    DataVector dg_u{number_of_components * dg_mesh.number_of_grid_points()};
+    for (size_t i = 0; i < number_of_components; ++i) {
+      DataVector component{dg_u.data() + i * dg_mesh.number_of_grid_points(),
+                           dg_mesh.number_of_grid_points()};
+      component = (i + 1.0) * nodal_values;
+    }
+    const DataVector subcell_u =
+        evolution::dg::subcell::fd::project(dg_u, dg_mesh, subcell_extents);
+
+    // A single direction uses the fused projection, all directions project
+    // onto the whole subcell grid first.
+    std::unordered_set<Direction<Dim>> all_directions{};
+    for (const auto& direction : Direction<Dim>::all_directions()) {
+      all_directions.insert(direction);
+      const std::unordered_set<Direction<Dim>> one_direction{direction};
+      for (const auto& directions : {one_direction, all_directions}) {
+        const auto ghost_data =
+            evolution::dg::subcell::fd::project_to_ghost_zones(
+                dg_u, dg_mesh, subcell_extents, ghost_zone_size, directions,
+                additional_buffer);
+        const auto expected_ghost_data = evolution::dg::subcell::slice_data(
+            subcell_u, subcell_extents, ghost_zone_size, directions,
+            additional_buffer);
+        REQUIRE(ghost_data.size() == directions.size());
+        for (const auto& [ghost_direction, expected] : expected_ghost_data) {
+          CAPTURE(ghost_direction);
+          REQUIRE(ghost_data.contains(ghost_direction));
+          const DataVector& data = ghost_data.at(ghost_direction);
+          REQUIRE(data.size() == expected.size());
+          const size_t ghost_size = expected.size() - additional_buffer;
+          CHECK_ITERABLE_APPROX(
+              DataVector(const_cast<double*>(data.data()), ghost_size),
+              DataVector(const_cast<double*>(expected.data()), ghost_size));
+        }
+      }
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.Projection", "[Evolution][Unit]") {
   test_project_fd<10, 1, Spectral::Basis::Legendre,
                   Spectral::Quadrature::GaussLobatto>();
@@ -203,5 +266,14 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.Projection", "[Evolution][Unit]") {
                           Spectral::Quadrature::GaussLobatto>();
   test_project_on_face_fd<4, 3, 2, Spectral::Basis::Legendre,
                           Spectral::Quadrature::Gauss>();
+
+  test_project_to_ghost_zones<10, 1, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto>();
+  test_project_to_ghost_zones<10, 2, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::Gauss>();
+  test_project_to_ghost_zones<5, 3, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto>();
+  test_project_to_ghost_zones<4, 3, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::Gauss>();
 }
 }  // namespace
@@ -41,6 +41,7 @@
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciGridHistory.hpp"
+#include "Evolution/DgSubcell/Tags/TciCadence.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "NumericalAlgorithms/FiniteDifference/DerivativeOrder.hpp"
@@ -159,6 +160,9 @@ void test(const bool moving_mesh) {
       "Variables(DetInvJacobian(Grid,Inertial),Jacobian(Grid,Inertial))");
   TestHelpers::db::test_compute_tag<subcell::Tags::TciStatusCompute<Dim>>(
       "TciStatus");
+  TestHelpers::db::test_simple_tag<subcell::Tags::TciCadence>("TciCadence");
+  TestHelpers::db::test_compute_tag<subcell::Tags::TciIntervalCompute<Dim>>(
+      "TciInterval");
   TestHelpers::db::test_compute_tag<subcell::Tags::MethodOrderCompute<Dim>>(
       "MethodOrder");
   TestHelpers::db::test_compute_tag<
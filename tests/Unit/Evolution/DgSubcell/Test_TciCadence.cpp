@@ -0,0 +1,163 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/RdmpTciData.hpp"
+#include "Evolution/DgSubcell/Tags/TciCadence.hpp"
+#include "Evolution/DgSubcell/TciCadence.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg::subcell {
+namespace {
+struct DefaultMetavariables {
+  struct SubcellOptions {};
+};
+
+struct SkippingMetavariables {
+  struct SubcellOptions {
+    static constexpr size_t maximum_tci_interval = 8;
+  };
+};
+
+static_assert(maximum_tci_interval_v<DefaultMetavariables> == 1);
+static_assert(maximum_tci_interval_v<SkippingMetavariables> == 8);
+
+// Advance one time step, returning whether the TCI was checked.
+bool step(const gsl::not_null<TciCadence*> cadence, const bool passed,
+          const bool rdmp_bound_is_near, const size_t maximum_interval) {
+  if (cadence->check_this_step()) {
+    cadence->record_check(passed, rdmp_bound_is_near, maximum_interval);
+    return true;
+  }
+  cadence->skip();
+  return false;
+}
+
+void test_cadence() {
+  TciCadence cadence{};
+  CHECK(cadence.check_this_step());
+  CHECK(cadence.interval() == 1);
+  CHECK(cadence.number_of_checks() == 0);
+  CHECK(cadence.number_of_skips() == 0);
+
+  // With a maximum interval of one every step is checked.
+  for (size_t i = 0; i < 5; ++i) {
+    CHECK(step(make_not_null(&cadence), true, false, 1));
+    CHECK(cadence.interval() == 1);
+  }
+  CHECK(cadence.number_of_checks() == 5);
+  CHECK(cadence.number_of_skips() == 0);
+
+  // The interval doubles after as many consecutive passes as the current
+  // interval, up to the maximum interval.
+  cadence = TciCadence{};
+  const std::vector<bool> expected_checks{
+      true,  false, true,  false, true, false, false, false, true, false,
+      false, false, true,  false, false, false, true, false, false};
+  const std::vector<size_t> expected_intervals{2, 2, 2, 2, 4, 4, 4, 4, 4, 4,
+                                               4, 4, 4, 4, 4, 4, 4, 4, 4};
+  for (size_t i = 0; i < expected_checks.size(); ++i) {
+    CAPTURE(i);
+    CHECK(step(make_not_null(&cadence), true, false, 4) == expected_checks[i]);
+    CHECK(cadence.interval() == expected_intervals[i]);
+  }
+  CHECK(cadence.number_of_checks() + cadence.number_of_skips() ==
+        expected_checks.size());
+  CHECK(cadence.number_of_checks() == 6);
+  test_serialization(cadence);
+  {
+    const TciCadence copy = cadence;
+    CHECK(copy == cadence);
+    CHECK_FALSE(copy != cadence);
+  }
+
+  // A failed check goes back to checking every step.
+  while (not cadence.check_this_step()) {
+    cadence.skip();
+  }
+  CHECK(step(make_not_null(&cadence), false, false, 4));
+  CHECK(cadence.interval() == 1);
+  CHECK(cadence.consecutive_passes() == 0);
+  CHECK(cadence.check_this_step());
+
+  // So does being close to the RDMP bound.
+  CHECK(step(make_not_null(&cadence), true, false, 4));
+  CHECK(cadence.interval() == 2);
+  CHECK_FALSE(step(make_not_null(&cadence), true, false, 4));
+  CHECK(step(make_not_null(&cadence), true, true, 4));
+  CHECK(cadence.interval() == 1);
+  CHECK(cadence.check_this_step());
+
+  // Resetting forces a check on the next step but keeps the counters.
+  CHECK(step(make_not_null(&cadence), true, false, 4));
+  const size_t checks = cadence.number_of_checks();
+  const size_t skips = cadence.number_of_skips();
+  CHECK_FALSE(cadence.check_this_step());
+  cadence.reset();
+  CHECK(cadence.check_this_step());
+  CHECK(cadence.interval() == 1);
+  CHECK(cadence.number_of_checks() == checks);
+  CHECK(cadence.number_of_skips() == skips);
+}
+
+void test_rdmp_bound_is_near() {
+  const RdmpTciData past{{2.0, 1.0}, {0.0, 1.0}};
+  const double delta0 = 1.0e-4;
+  const double epsilon = 1.0e-3;
+  // delta is 2e-3 for the first variable and 1e-4 for the second.
+  CHECK_FALSE(rdmp_bound_is_near(past, past, delta0, epsilon));
+  CHECK_FALSE(
+      rdmp_bound_is_near({{2.0009, 1.0}, {-0.0009, 1.0}}, past, delta0,
+                         epsilon));
+  CHECK(rdmp_bound_is_near({{2.0011, 1.0}, {0.0, 1.0}}, past, delta0,
+                           epsilon));
+  CHECK(rdmp_bound_is_near({{2.0, 1.0}, {-0.0011, 1.0}}, past, delta0,
+                           epsilon));
+  CHECK_FALSE(rdmp_bound_is_near({{2.0, 1.00004}, {0.0, 0.99996}}, past,
+                                 delta0, epsilon));
+  CHECK(rdmp_bound_is_near({{2.0, 1.00006}, {0.0, 1.0}}, past, delta0,
+                           epsilon));
+  CHECK(rdmp_bound_is_near({{2.0, 1.0}, {0.0, 0.99994}}, past, delta0,
+                           epsilon));
+}
+
+template <size_t Dim>
+void test_interval_compute() {
+  const Mesh<Dim> dg_mesh{4, Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto};
+  const Mesh<Dim> subcell_mesh{7, Spectral::Basis::FiniteDifference,
+                               Spectral::Quadrature::CellCentered};
+  TciCadence cadence{};
+  cadence.record_check(true, false, 8);
+  Scalar<DataVector> interval{};
+  Tags::TciIntervalCompute<Dim>::function(make_not_null(&interval), cadence,
+                                          ActiveGrid::Dg, subcell_mesh,
+                                          dg_mesh);
+  CHECK(get(interval) == DataVector(dg_mesh.number_of_grid_points(), 2.0));
+  Tags::TciIntervalCompute<Dim>::function(make_not_null(&interval), cadence,
+                                          ActiveGrid::Subcell, subcell_mesh,
+                                          dg_mesh);
+  CHECK(get(interval) ==
+        DataVector(subcell_mesh.number_of_grid_points(), 0.0));
+}
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.TciCadence", "[Evolution][Unit]") {
+  test_cadence();
+  test_rdmp_bound_is_near();
+  test_interval_compute<1>();
+  test_interval_compute<2>();
+  test_interval_compute<3>();
+}
+}  // namespace
+}  // namespace evolution::dg::subcell
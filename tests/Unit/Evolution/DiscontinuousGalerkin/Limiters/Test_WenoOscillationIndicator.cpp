@@ -6,6 +6,7 @@
 #include <string>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoOscillationIndicator.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -14,6 +15,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -66,6 +68,19 @@ void test_oscillation_indicator_1d_impl(const size_t number_of_points,
       mesh);
   const double expected3 = 76196. / 105.;
   CHECK(indicator3 == approx(expected3));
+
+  // The overload with a buffer for the modal coefficients gives the same
+  // results, independently of the initial size of the buffer
+  ModalVector buffer{};
+  CHECK(Limiters::Weno_detail::oscillation_indicator(
+            make_not_null(&buffer),
+            Limiters::Weno_detail::DerivativeWeight::Unity, data, mesh) ==
+        approx(expected));
+  CHECK(buffer.size() == mesh.number_of_grid_points());
+  CHECK(Limiters::Weno_detail::oscillation_indicator(
+            make_not_null(&buffer),
+            Limiters::Weno_detail::DerivativeWeight::PowTwoEll, data, mesh) ==
+        approx(expected2));
 }
 
 void test_oscillation_indicator_1d() {
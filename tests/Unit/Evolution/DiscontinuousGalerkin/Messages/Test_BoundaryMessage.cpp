@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <random>
 #include <sstream>
@@ -107,6 +108,143 @@ void test_boundary_message(const gsl::not_null<Generator*> generator,
   CHECK(unpacked_message == repacked_unpacked_message);
 }
 
+template <size_t Dim>
+void test_allocate(const size_t subcell_size, const size_t dg_size) {
+  CAPTURE(Dim);
+  CAPTURE(subcell_size);
+  CAPTURE(dg_size);
+
+  const Slab slab{0.1, 0.5};
+  const TimeStepId time_id{true, 0, Time{slab, {0, 1}}};
+  const Mesh<Dim> volume_mesh{4, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto};
+  DataVector subcell_data{subcell_size};
+  DataVector dg_data{dg_size};
+  for (size_t i = 0; i < subcell_size; ++i) {
+    subcell_data[i] = static_cast<double>(i) + 0.5;
+  }
+  for (size_t i = 0; i < dg_size; ++i) {
+    dg_data[i] = -static_cast<double>(i);
+  }
+
+  auto* boundary_message = BoundaryMessage<Dim>::allocate(
+      subcell_size, dg_size, false, 2, 15, -3, time_id, time_id,
+      Direction<Dim>::lower_xi(), ElementId<Dim>{0}, volume_mesh,
+      volume_mesh.slice_away(0));
+  CHECK(boundary_message->owning);
+  CHECK((boundary_message->subcell_ghost_data == nullptr) ==
+        (subcell_size == 0));
+  CHECK((boundary_message->dg_flux_data == nullptr) == (dg_size == 0));
+  // Write the data directly into the message
+  for (size_t i = 0; i < subcell_size; ++i) {
+    boundary_message->subcell_ghost_data[i] = subcell_data[i];
+  }
+  for (size_t i = 0; i < dg_size; ++i) {
+    boundary_message->dg_flux_data[i] = dg_data[i];
+  }
+
+  const auto* const expected_message = new BoundaryMessage<Dim>(
+      subcell_size, dg_size, true, false, 2, 15, -3, time_id, time_id,
+      Direction<Dim>::lower_xi(), ElementId<Dim>{0}, volume_mesh,
+      volume_mesh.slice_away(0),
+      subcell_size != 0 ? subcell_data.data() : nullptr,
+      dg_size != 0 ? dg_data.data() : nullptr);
+  CHECK(*boundary_message == *expected_message);
+  CHECK(boundary_message->packed_bytes() ==
+        BoundaryMessage<Dim>::total_bytes_with_data(subcell_size, dg_size));
+
+  // The data is neither copied into nor out of the packed message
+  void* packed_message = BoundaryMessage<Dim>::pack(boundary_message);
+  CHECK(packed_message == boundary_message);
+  BoundaryMessage<Dim>* unpacked_message =
+      BoundaryMessage<Dim>::unpack(packed_message);
+  CHECK(unpacked_message == boundary_message);
+  CHECK(*unpacked_message == *expected_message);
+
+  delete unpacked_message;
+  delete expected_message;
+}
+
+template <size_t Dim>
+void test_encoding(const BoundaryMessageEncoding encoding,
+                   const size_t subcell_size, const size_t dg_size) {
+  CAPTURE(Dim);
+  CAPTURE(encoding);
+  CAPTURE(subcell_size);
+  CAPTURE(dg_size);
+
+  const Slab slab{0.1, 0.5};
+  const TimeStepId time_id{true, 0, Time{slab, {0, 1}}};
+  const Mesh<Dim> volume_mesh{4, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto};
+
+  // Smooth data, as is typical for boundary data, with a few special values
+  DataVector subcell_data{subcell_size};
+  DataVector dg_data{dg_size};
+  for (size_t i = 0; i < subcell_size; ++i) {
+    subcell_data[i] = 1.0 + 0.01 * static_cast<double>(i * i);
+  }
+  for (size_t i = 0; i < dg_size; ++i) {
+    dg_data[i] = sin(0.05 * static_cast<double>(i));
+  }
+  if (dg_size > 3) {
+    dg_data[1] = dg_data[2];
+    dg_data[3] = -0.0;
+  }
+
+  auto* boundary_message = new BoundaryMessage<Dim>(
+      subcell_size, dg_size, false, false, 0, 1, 0, time_id, time_id,
+      Direction<Dim>::lower_xi(), ElementId<Dim>{0}, volume_mesh,
+      volume_mesh.slice_away(0),
+      subcell_size != 0 ? subcell_data.data() : nullptr,
+      dg_size != 0 ? dg_data.data() : nullptr);
+  boundary_message->encoding = encoding;
+
+  const size_t double_bytes =
+      BoundaryMessage<Dim>::total_bytes_with_data(subcell_size, dg_size);
+  const size_t packed_bytes = boundary_message->packed_bytes();
+  if (encoding == BoundaryMessageEncoding::Double) {
+    CHECK(packed_bytes == double_bytes);
+  } else if (encoding == BoundaryMessageEncoding::Float) {
+    CHECK(packed_bytes == (dg_size == 0 ? double_bytes
+                                        : double_bytes - 4 * dg_size));
+  } else {
+    CHECK(packed_bytes <= double_bytes);
+    if (dg_size > 20) {
+      CHECK(packed_bytes < double_bytes);
+    }
+  }
+
+  BoundaryMessage<Dim>* unpacked_message = BoundaryMessage<Dim>::unpack(
+      BoundaryMessage<Dim>::pack(boundary_message));
+  CHECK(unpacked_message->owning);
+  CHECK(unpacked_message->encoding == encoding);
+  CHECK(unpacked_message->encoded_data_bytes == 0);
+  REQUIRE(unpacked_message->subcell_ghost_data_size == subcell_size);
+  REQUIRE(unpacked_message->dg_flux_data_size == dg_size);
+  // The subcell data is never sent with reduced precision
+  for (size_t i = 0; i < subcell_size; ++i) {
+    CHECK(unpacked_message->subcell_ghost_data[i] == subcell_data[i]);
+  }
+  for (size_t i = 0; i < dg_size; ++i) {
+    if (encoding == BoundaryMessageEncoding::Float) {
+      CHECK(unpacked_message->dg_flux_data[i] ==
+            static_cast<double>(static_cast<float>(dg_data[i])));
+    } else {
+      CHECK(unpacked_message->dg_flux_data[i] == dg_data[i]);
+    }
+  }
+  if (dg_size > 3 and encoding == BoundaryMessageEncoding::Lossless) {
+    CHECK(std::signbit(unpacked_message->dg_flux_data[3]));
+  }
+
+  // Packing the unpacked message sends the decoded data as is
+  BoundaryMessage<Dim>* repacked_unpacked_message =
+      BoundaryMessage<Dim>::unpack(
+          BoundaryMessage<Dim>::pack(unpacked_message));
+  CHECK(unpacked_message == repacked_unpacked_message);
+}
+
 void test_output() {
   const size_t subcell_size = 4;
   const size_t dg_size = 3;
@@ -162,6 +300,7 @@ void test_output() {
      << "volume_or_ghost_mesh = "
         "[(4,4),(Legendre,Legendre),(GaussLobatto,GaussLobatto)]\n"
      << "interface_mesh = [(4),(Legendre),(GaussLobatto)]\n"
+     << "encoding = Double\n"
      << "subcell_ghost_data = (0.1,0.2,0.3,0.4)\n"
      << "dg_flux_data = (-0.3,-0.2,-0.1)";
 
@@ -191,6 +330,20 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.BoundaryMessage", "[Unit][Evolution]") {
         // test it for completeness to ensure pack/unpack are doing the correct
         // thing
         test_boundary_message<Dim>(make_not_null(&generator), 0, 0);
+
+        test_allocate<Dim>(0, 0);
+        test_allocate<Dim>(5, 0);
+        test_allocate<Dim>(0, 7);
+        test_allocate<Dim>(30, 100);
+
+        for (const auto encoding :
+             {BoundaryMessageEncoding::Double, BoundaryMessageEncoding::Float,
+              BoundaryMessageEncoding::Lossless}) {
+          test_encoding<Dim>(encoding, 0, 0);
+          test_encoding<Dim>(encoding, 5, 0);
+          test_encoding<Dim>(encoding, 0, 7);
+          test_encoding<Dim>(encoding, 30, 100);
+        }
       });
 }
 }  // namespace
@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.hpp"
+#include "Evolution/DiscontinuousGalerkin/Messages/NodeLocalBoundaryBuffer.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+
+namespace evolution::dg {
+namespace {
+BoundaryMessage<1>* make_message(const NodeLocalBoundaryBuffer::Handle& handle,
+                                 const size_t subcell_size) {
+  const Slab slab{0.1, 0.5};
+  const TimeStepId time_step_id{true, 0, slab.start()};
+  const Mesh<1> volume_mesh{4, Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto};
+  const size_t dg_size = handle.data.size() - subcell_size;
+  return new BoundaryMessage<1>(
+      subcell_size, dg_size, false, false, 0, 0, 0, time_step_id, time_step_id,
+      Direction<1>::upper_xi(), ElementId<1>{0}, volume_mesh,
+      volume_mesh.slice_away(0),
+      subcell_size != 0 ? handle.data.data() : nullptr,
+      dg_size != 0 ? std::next(handle.data.data(),
+                               static_cast<std::ptrdiff_t>(subcell_size))
+                   : nullptr,
+      handle.slot, handle.version);
+}
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.NodeLocalBoundaryBuffer",
+                  "[Unit][Evolution]") {
+  NodeLocalBoundaryBuffer buffer{};
+  CHECK(buffer.number_of_slots() == 0);
+
+  const auto first = buffer.acquire(5, 2);
+  CHECK(first.data.size() == 5);
+  std::fill(first.data.begin(), first.data.end(), 1.0);
+  CHECK(buffer.number_of_slots() == 1);
+  CHECK(buffer.number_of_slots_in_use() == 1);
+
+  auto* const first_message_a = make_message(first, 2);
+  auto* const first_message_b = make_message(first, 0);
+  CHECK(first_message_a->node_local_data_is_current());
+  CHECK(first_message_a->subcell_ghost_data == first.data.data());
+  CHECK(first_message_b->dg_flux_data == first.data.data());
+
+  // The first slot is still in use, so a new one is created.
+  const auto second = buffer.acquire(3, 1);
+  CHECK(buffer.number_of_slots() == 2);
+  CHECK(buffer.number_of_slots_in_use() == 2);
+  CHECK(second.slot != first.slot);
+  auto* const second_message = make_message(second, 0);
+
+  delete first_message_a;  // NOLINT
+  CHECK(buffer.number_of_slots_in_use() == 2);
+  // Packing copies the data and releases the node-local memory.
+  void* const packed = BoundaryMessage<1>::pack(first_message_b);
+  CHECK(buffer.number_of_slots_in_use() == 1);
+  auto* const unpacked = BoundaryMessage<1>::unpack(packed);
+  CHECK(unpacked->owning);
+  CHECK(unpacked->node_local_slot == nullptr);
+  CHECK(unpacked->node_local_data_is_current());
+  CHECK(unpacked->dg_flux_data != first.data.data());
+  CHECK(std::all_of(
+      unpacked->dg_flux_data,
+      std::next(unpacked->dg_flux_data,
+                static_cast<std::ptrdiff_t>(unpacked->dg_flux_data_size)),
+      [](const double x) { return x == 1.0; }));
+  delete unpacked;  // NOLINT
+
+  // The released slot and its memory are reused with a new version.
+  const auto third = buffer.acquire(4, 1);
+  CHECK(buffer.number_of_slots() == 2);
+  CHECK(third.slot == first.slot);
+  CHECK(third.data.data() == first.data.data());
+  CHECK(third.version == first.version + 1);
+  auto* const third_message = make_message(third, 1);
+  CHECK(third_message->node_local_data_is_current());
+
+  second_message->release_node_local_data();
+  CHECK(second_message->node_local_slot == nullptr);
+  CHECK(buffer.number_of_slots_in_use() == 1);
+  delete second_message;  // NOLINT
+  delete third_message;   // NOLINT
+  CHECK(buffer.number_of_slots_in_use() == 0);
+
+  auto moved_buffer = serialize_and_deserialize(buffer);
+  CHECK(moved_buffer.number_of_slots() == 0);
+}
+}  // namespace
+}  // namespace evolution::dg
@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <utility>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Evolution/DiscontinuousGalerkin/Tags/StoredTemporary.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Var : db::SimpleTag {
+  using type = double;
+};
+
+struct Arg : db::SimpleTag {
+  using type = double;
+};
+
+struct VarCompute : Var, db::ComputeTag {
+  using base = Var;
+  using return_type = double;
+  using argument_tags = tmpl::list<Arg>;
+  static void function(const gsl::not_null<double*> result, const double arg) {
+    *result = 2. * arg;
+  }
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Tags.StoredTemporary",
+                  "[Unit][Evolution]") {
+  using stored_tag = evolution::dg::Tags::StoredTemporary<Var>;
+  using reuse_tag =
+      evolution::dg::Tags::ReuseStoredTemporaryCompute<VarCompute>;
+  TestHelpers::db::test_simple_tag<stored_tag>("StoredTemporary(Var)");
+  TestHelpers::db::test_compute_tag<reuse_tag>("Var");
+
+  const Slab slab(1., 3.);
+  const TimeStepId step_start(true, 0, slab.start());
+  const TimeStepId substep(true, 0, slab.start(), 1, slab.duration(), 2.);
+  const TimeStepId next_step(true, 0, slab.end());
+  const std::pair<TimeStepId, double> stored{step_start, 5.};
+  double result = 0.;
+
+  // Reuse the stored value at the step time
+  reuse_tag::function(make_not_null(&result), stored, step_start, 1., 1.);
+  CHECK(result == 5.);
+  // Compute at a dense output time within the step
+  reuse_tag::function(make_not_null(&result), stored, step_start, 1.5, 1.);
+  CHECK(result == 2.);
+  // Compute at a substep
+  const std::pair<TimeStepId, double> stored_substep{substep, 5.};
+  reuse_tag::function(make_not_null(&result), stored_substep, substep, 2., 3.);
+  CHECK(result == 6.);
+  // Compute if the stored value is from another step
+  reuse_tag::function(make_not_null(&result), stored, next_step, 3., 4.);
+  CHECK(result == 8.);
+}
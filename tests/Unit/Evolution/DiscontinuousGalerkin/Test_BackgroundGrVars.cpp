@@ -137,8 +137,9 @@ void test(const gsl::not_null<std::mt19937*> gen) {
   const Mesh<3> mesh{num_dg_pts, Spectral::Basis::Legendre,
                      Spectral::Quadrature::GaussLobatto};
 
-  const auto compute_inertial_coords = [&brick, &domain, &element_id,
-                                        &mesh](const double time) {
+  const auto compute_inertial_coords = [&brick, &domain, &element_id](
+                                           const double time,
+                                           const Mesh<3>& coords_mesh) {
     const auto& block = domain.blocks()[element_id.block_id()];
     const auto element_map = ElementMap<3, Frame::Grid>{
         element_id, block.is_time_dependent()
@@ -155,11 +156,13 @@ void test(const gsl::not_null<std::mt19937*> gen) {
           ::domain::make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
               ::domain::CoordinateMaps::Identity<3>{});
     }
-    return (*grid_to_inertial_map)(element_map(logical_coordinates(mesh)), time,
-                                   brick.functions_of_time());
+    return (*grid_to_inertial_map)(
+        element_map(logical_coordinates(coords_mesh)), time,
+        brick.functions_of_time());
   };
 
-  const auto initial_inertial_coords = compute_inertial_coords(initial_time);
+  const auto initial_inertial_coords =
+      compute_inertial_coords(initial_time, mesh);
 
   using gr_variables_tag =
       ::Tags::Variables<tmpl::remove_duplicates<tmpl::append<
@@ -223,7 +226,7 @@ void test(const gsl::not_null<std::mt19937*> gen) {
   // Mutate time and inertial coords to those at t = `random_time` and apply the
   // mutator again.. Then check that the mutator has evaluated correct values of
   // GR variables at a later random time.
-  const auto inertial_coords = compute_inertial_coords(random_time);
+  const auto inertial_coords = compute_inertial_coords(random_time, mesh);
   db::mutate<::Tags::Time, domain::Tags::Coordinates<3, Frame::Inertial>>(
       [&random_time, &inertial_coords](const auto time_ptr,
                                        const auto inertial_coords_ptr) {
@@ -255,6 +258,52 @@ void test(const gsl::not_null<std::mt19937*> gen) {
                                 get<tag>(gr_vars_in_box));
         });
   }
+
+  // Changing the mesh, e.g. by p-refinement, recomputes the GR variables even
+  // if the mesh is not moving
+  const Mesh<3> refined_mesh{num_dg_pts + 1, Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto};
+  const auto refined_inertial_coords =
+      compute_inertial_coords(random_time, refined_mesh);
+  db::mutate<domain::Tags::Mesh<3>,
+             domain::Tags::Coordinates<3, Frame::Inertial>>(
+      [&refined_mesh, &refined_inertial_coords](
+          const auto mesh_ptr, const auto inertial_coords_ptr) {
+        *mesh_ptr = refined_mesh;
+        *inertial_coords_ptr = refined_inertial_coords;
+      },
+      make_not_null(&box));
+  db::mutate_apply<evolution::dg::BackgroundGrVars<
+      SystemForTest, MetavariablesForTest, TestRuntimeInitialData>>(
+      make_not_null(&box));
+  const auto expected_refined_gr_vars = solution.variables(
+      refined_inertial_coords, random_time, gr_variables_tag::tags_list{});
+  tmpl::for_each<gr_variables_tag::tags_list>(
+      [&box, &expected_refined_gr_vars](const auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        const auto& gr_vars_in_box = get<gr_variables_tag>(box);
+        CHECK_ITERABLE_APPROX(get<tag>(expected_refined_gr_vars),
+                              get<tag>(gr_vars_in_box));
+      });
+
+  // A time-dependent background is recomputed on every call even if the mesh
+  // is not moving
+  const double later_time = random_time + 1.0;
+  db::mutate<::Tags::Time>(
+      [&later_time](const auto time_ptr) { *time_ptr = later_time; },
+      make_not_null(&box));
+  db::mutate_apply<evolution::dg::BackgroundGrVars<
+      SystemForTest, MetavariablesForTest, TestRuntimeInitialData, true>>(
+      make_not_null(&box));
+  const auto expected_later_gr_vars = solution.variables(
+      refined_inertial_coords, later_time, gr_variables_tag::tags_list{});
+  tmpl::for_each<gr_variables_tag::tags_list>(
+      [&box, &expected_later_gr_vars](const auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        const auto& gr_vars_in_box = get<gr_variables_tag>(box);
+        CHECK_ITERABLE_APPROX(get<tag>(expected_later_gr_vars),
+                              get<tag>(gr_vars_in_box));
+      });
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.BackgroundGrVars", "[Unit][Evolution]") {
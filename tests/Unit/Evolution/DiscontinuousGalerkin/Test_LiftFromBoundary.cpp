@@ -4,7 +4,9 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
+#include <random>
 #include <type_traits>
 #include <vector>
 
@@ -12,6 +14,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
+#include "DataStructures/SliceVariables.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -24,17 +27,23 @@
 #include "Domain/FaceNormal.hpp"
 #include "Domain/InterfaceLogicalCoordinates.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/IndexToSliceAt.hpp"
 #include "Evolution/DiscontinuousGalerkin/LiftFromBoundary.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MetricIdentityJacobian.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
 #include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
 #include "NumericalAlgorithms/LinearOperators/WeakDivergence.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -246,6 +255,134 @@ void test(const double eps) {
                                      get<tag>(expected_dt_vars), local_approx);
       });
 }
+
+template <size_t Dim>
+void test_project_and_lift(
+    const Spectral::Quadrature quadrature,
+    const std::array<Spectral::MortarSize, Dim - 1>& mortar_size,
+    const size_t extra_mortar_points) {
+  // Compare the fused projection and lifting against projecting the
+  // corrections to the face and then lifting them.
+  using tags = tmpl::list<Var1, Var2<Dim>>;
+  using dt_tags = db::wrap_tags_in<Tags::dt, tags>;
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist(0.5, 2.0);
+  const Mesh<Dim> volume_mesh{5, Spectral::Basis::Legendre, quadrature};
+  CAPTURE(volume_mesh);
+  CAPTURE(mortar_size);
+  CAPTURE(extra_mortar_points);
+  const size_t num_volume_pts = volume_mesh.number_of_grid_points();
+  const auto volume_det_inv_jacobian = make_with_random_values<
+      Scalar<DataVector>>(make_not_null(&gen), make_not_null(&dist),
+                          DataVector{num_volume_pts});
+
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    CAPTURE(direction);
+    const Mesh<Dim - 1> face_mesh =
+        volume_mesh.slice_away(direction.dimension());
+    Mesh<Dim - 1> mortar_mesh = face_mesh;
+    if constexpr (Dim > 1) {
+      mortar_mesh = Mesh<Dim - 1>{5 + extra_mortar_points,
+                                  Spectral::Basis::Legendre, quadrature};
+    }
+    const size_t num_face_pts = face_mesh.number_of_grid_points();
+
+    const auto boundary_corrections_on_mortar =
+        make_with_random_values<Variables<dt_tags>>(
+            make_not_null(&gen), make_not_null(&dist),
+            Variables<dt_tags>{mortar_mesh.number_of_grid_points()});
+    const auto magnitude_of_face_normal = make_with_random_values<
+        Scalar<DataVector>>(make_not_null(&gen), make_not_null(&dist),
+                            DataVector{num_face_pts});
+    const auto face_det_jacobian = make_with_random_values<Scalar<DataVector>>(
+        make_not_null(&gen), make_not_null(&dist), DataVector{num_face_pts});
+    auto dt_vars = make_with_random_values<Variables<dt_tags>>(
+        make_not_null(&gen), make_not_null(&dist),
+        Variables<dt_tags>{num_volume_pts});
+    auto expected_dt_vars = dt_vars;
+
+    auto boundary_corrections =
+        Spectral::needs_projection(face_mesh, mortar_mesh, mortar_size)
+            ? ::dg::project_from_mortar(boundary_corrections_on_mortar,
+                                        face_mesh, mortar_mesh, mortar_size)
+            : boundary_corrections_on_mortar;
+    if (quadrature == Spectral::Quadrature::Gauss) {
+      evolution::dg::lift_boundary_terms_gauss_points(
+          make_not_null(&expected_dt_vars), volume_det_inv_jacobian,
+          volume_mesh, direction, boundary_corrections,
+          magnitude_of_face_normal, face_det_jacobian);
+    } else {
+      ::dg::lift_flux(make_not_null(&boundary_corrections),
+                      volume_mesh.extents(direction.dimension()),
+                      magnitude_of_face_normal);
+      add_slice_to_data(make_not_null(&expected_dt_vars), boundary_corrections,
+                        volume_mesh.extents(), direction.dimension(),
+                        index_to_slice_at(volume_mesh.extents(), direction));
+    }
+
+    evolution::dg::project_and_lift_boundary_terms(
+        make_not_null(&dt_vars), volume_det_inv_jacobian, volume_mesh,
+        direction, boundary_corrections_on_mortar, mortar_mesh, mortar_size,
+        magnitude_of_face_normal, face_det_jacobian);
+    CHECK_VARIABLES_APPROX(dt_vars, expected_dt_vars);
+  }
+}
+
+template <size_t Dim>
+void test_lift_all_faces(const bool skip_lower_xi) {
+  // Compare lifting all faces at once against lifting one face at a time.
+  using tags = tmpl::list<Var1, Var2<Dim>>;
+  using dt_tags = db::wrap_tags_in<Tags::dt, tags>;
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<double> dist(0.5, 2.0);
+  // Different extents in each dimension to test the face indexing.
+  std::array<size_t, Dim> extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(extents, d) = 3 + d;
+  }
+  const Mesh<Dim> volume_mesh{extents, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::Gauss};
+  CAPTURE(volume_mesh);
+  CAPTURE(skip_lower_xi);
+  const size_t num_volume_pts = volume_mesh.number_of_grid_points();
+  const auto volume_det_inv_jacobian = make_with_random_values<
+      Scalar<DataVector>>(make_not_null(&gen), make_not_null(&dist),
+                          DataVector{num_volume_pts});
+  auto dt_vars = make_with_random_values<Variables<dt_tags>>(
+      make_not_null(&gen), make_not_null(&dist),
+      Variables<dt_tags>{num_volume_pts});
+  auto expected_dt_vars = dt_vars;
+
+  DirectionMap<Dim, Variables<dt_tags>> boundary_corrections{};
+  DirectionMap<Dim, Scalar<DataVector>> magnitude_of_face_normal{};
+  DirectionMap<Dim, Scalar<DataVector>> face_det_jacobian{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    if (skip_lower_xi and direction == Direction<Dim>::lower_xi()) {
+      continue;
+    }
+    const size_t num_face_pts =
+        volume_mesh.slice_away(direction.dimension()).number_of_grid_points();
+    boundary_corrections[direction] =
+        make_with_random_values<Variables<dt_tags>>(
+            make_not_null(&gen), make_not_null(&dist),
+            Variables<dt_tags>{num_face_pts});
+    magnitude_of_face_normal[direction] = make_with_random_values<
+        Scalar<DataVector>>(make_not_null(&gen), make_not_null(&dist),
+                            DataVector{num_face_pts});
+    face_det_jacobian[direction] = make_with_random_values<Scalar<DataVector>>(
+        make_not_null(&gen), make_not_null(&dist), DataVector{num_face_pts});
+    evolution::dg::lift_boundary_terms_gauss_points(
+        make_not_null(&expected_dt_vars), volume_det_inv_jacobian, volume_mesh,
+        direction, boundary_corrections.at(direction),
+        magnitude_of_face_normal.at(direction),
+        face_det_jacobian.at(direction));
+  }
+
+  evolution::dg::lift_boundary_terms_gauss_points(
+      make_not_null(&dt_vars), volume_det_inv_jacobian, volume_mesh,
+      boundary_corrections, magnitude_of_face_normal, face_det_jacobian);
+  CHECK_VARIABLES_APPROX(dt_vars, expected_dt_vars);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.LiftFromBoundary", "[Unit][Evolution]") {
@@ -260,4 +397,22 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.LiftFromBoundary", "[Unit][Evolution]") {
   test<1>(1.0e-12);
   test<2>(1.0e-8);
   test<3>(1.0e-8);
+
+  for (const auto quadrature :
+       {Spectral::Quadrature::Gauss, Spectral::Quadrature::GaussLobatto}) {
+    test_project_and_lift<1>(quadrature, {}, 0);
+    test_project_and_lift<2>(quadrature, {{Spectral::MortarSize::Full}}, 0);
+    test_project_and_lift<2>(quadrature, {{Spectral::MortarSize::UpperHalf}},
+                             0);
+    test_project_and_lift<2>(quadrature, {{Spectral::MortarSize::Full}}, 2);
+    test_project_and_lift<3>(
+        quadrature,
+        {{Spectral::MortarSize::LowerHalf, Spectral::MortarSize::Full}}, 1);
+  }
+
+  for (const bool skip_lower_xi : {false, true}) {
+    test_lift_all_faces<1>(skip_lower_xi);
+    test_lift_all_faces<2>(skip_lower_xi);
+    test_lift_all_faces<3>(skip_lower_xi);
+  }
 }
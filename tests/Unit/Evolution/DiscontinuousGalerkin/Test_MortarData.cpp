@@ -4,8 +4,10 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <initializer_list>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
@@ -268,6 +270,58 @@ void test_local_time_stepping_usage(const bool use_gauss_points) {
 
   CHECK(mortar_data == deserialized_mortar_data);
   CHECK_FALSE(mortar_data != deserialized_mortar_data);
+
+  // Inserting the same geometric quantities into another MortarData reuses
+  // the buffers of a candidate that holds them, and different quantities are
+  // stored separately
+  const auto insert_with_reuse =
+      [&local_mesh, &local_data, &time_step_id, &local_volume_det_inv_jacobian,
+       &local_face_det_jacobian, use_gauss_points](
+          const Scalar<DataVector>& face_normal_magnitude,
+          const std::initializer_list<const MortarData<Dim>*> candidates) {
+        MortarData<Dim> result{};
+        result.insert_local_mortar_data(time_step_id, local_mesh, local_data);
+        if (use_gauss_points) {
+          result.insert_local_geometric_quantities(
+              local_volume_det_inv_jacobian, local_face_det_jacobian,
+              face_normal_magnitude, candidates);
+        } else {
+          result.insert_local_face_normal_magnitude(face_normal_magnitude,
+                                                    candidates);
+        }
+        return result;
+      };
+  const auto storage = [use_gauss_points](const MortarData<Dim>& data) {
+    Scalar<DataVector> volume{};
+    Scalar<DataVector> face{};
+    if (use_gauss_points) {
+      data.get_local_volume_det_inv_jacobian(make_not_null(&volume));
+    }
+    data.get_local_face_normal_magnitude(make_not_null(&face));
+    return std::pair{get(volume).data(), get(face).data()};
+  };
+  const auto shared_mortar_data = insert_with_reuse(
+      local_face_normal_magnitude,
+      {nullptr, &deserialized_mortar_data, &mortar_data});
+  check_geometric_quantities(shared_mortar_data);
+  CHECK(shared_mortar_data == mortar_data);
+  CHECK(storage(shared_mortar_data) == storage(deserialized_mortar_data));
+
+  const auto other_face_normal_magnitude =
+      make_with_random_values<Scalar<DataVector>>(
+          make_not_null(&gen), make_not_null(&dist),
+          mortar_mesh.number_of_grid_points());
+  const auto other_mortar_data =
+      insert_with_reuse(other_face_normal_magnitude, {&mortar_data});
+  Scalar<DataVector> retrieved_other_face_normal_magnitude{};
+  other_mortar_data.get_local_face_normal_magnitude(
+      make_not_null(&retrieved_other_face_normal_magnitude));
+  CHECK(retrieved_other_face_normal_magnitude == other_face_normal_magnitude);
+  CHECK(storage(other_mortar_data).second != storage(mortar_data).second);
+  if (use_gauss_points) {
+    CHECK(storage(other_mortar_data).first == storage(mortar_data).first);
+  }
+  CHECK(other_mortar_data != mortar_data);
 }
 
 template <size_t Dim>
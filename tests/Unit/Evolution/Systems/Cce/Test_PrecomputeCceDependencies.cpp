@@ -187,6 +187,33 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.PrecomputeCceDependencies",
       db::get<independent_of_integration_variables_tag>(precomputation_box),
       db::get<independent_of_integration_variables_tag>(expected_box),
       angular_derivative_approx);
+
+  // the separate mutators for the angular derivatives of R agree with the
+  // batched computation used by `mutate_all_precompute_cce_dependencies`
+  const auto batched_eth_r_divided_by_r =
+      db::get<Tags::EthRDividedByR>(precomputation_box);
+  const auto batched_eth_eth_r_divided_by_r =
+      db::get<Tags::EthEthRDividedByR>(precomputation_box);
+  const auto batched_eth_ethbar_r_divided_by_r =
+      db::get<Tags::EthEthbarRDividedByR>(precomputation_box);
+  db::mutate_apply<
+      PrecomputeCceDependencies<Tags::BoundaryValue, Tags::EthRDividedByR>>(
+      make_not_null(&precomputation_box));
+  db::mutate_apply<
+      PrecomputeCceDependencies<Tags::BoundaryValue, Tags::EthEthRDividedByR>>(
+      make_not_null(&precomputation_box));
+  db::mutate_apply<PrecomputeCceDependencies<Tags::BoundaryValue,
+                                             Tags::EthEthbarRDividedByR>>(
+      make_not_null(&precomputation_box));
+  CHECK_ITERABLE_APPROX(
+      get(db::get<Tags::EthRDividedByR>(precomputation_box)).data(),
+      get(batched_eth_r_divided_by_r).data());
+  CHECK_ITERABLE_APPROX(
+      get(db::get<Tags::EthEthRDividedByR>(precomputation_box)).data(),
+      get(batched_eth_eth_r_divided_by_r).data());
+  CHECK_ITERABLE_APPROX(
+      get(db::get<Tags::EthEthbarRDividedByR>(precomputation_box)).data(),
+      get(batched_eth_ethbar_r_divided_by_r).data());
 }
 
 }  // namespace Cce
@@ -3,13 +3,18 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <complex>
 #include <cstddef>
+#include <string>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
@@ -21,6 +26,8 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/BoundaryTestHelpers.hpp"
 #include "Helpers/Evolution/Systems/Cce/WriteToWorldtubeH5.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
 #include "NumericalAlgorithms/Interpolation/BarycentricRationalSpanInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/CubicSpanInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/LinearSpanInterpolator.hpp"
@@ -479,6 +486,111 @@ void test_data_manager_with_dummy_buffer_updater(
       });
 }
 
+// Reads the buffers in small windows so that many of them are prefetched.
+template <typename Generator>
+void test_prefetching_data_manager(const gsl::not_null<Generator*> gen) {
+  UniformCustomDistribution<double> value_dist{0.1, 0.5};
+  const gr::Solutions::KerrSchild solution{
+      value_dist(*gen),
+      {{value_dist(*gen), value_dist(*gen), value_dist(*gen)}},
+      {{value_dist(*gen), value_dist(*gen), value_dist(*gen)}}};
+  const double frequency = 0.1 * value_dist(*gen);
+  const double amplitude = 0.1 * value_dist(*gen);
+
+  const size_t buffer_size = 4;
+  const size_t l_max = 8;
+  DataVector time_buffer{30};
+  for (size_t i = 0; i < time_buffer.size(); ++i) {
+    time_buffer[i] = 0.1 * i;
+  }
+  const auto make_manager = [&](const bool prefetch) {
+    return BondiWorldtubeDataManager{
+        std::make_unique<ReducedDummyBufferUpdater>(
+            time_buffer, solution, std::nullopt, amplitude, frequency, l_max),
+        l_max, buffer_size,
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+        prefetch};
+  };
+  const auto boundary_data_manager = make_manager(false);
+  const auto prefetching_boundary_data_manager = make_manager(true);
+  CHECK(boundary_data_manager.get_stall_time() == 0.0);
+
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+      expected_boundary_variables{number_of_angular_points};
+  Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+      prefetched_boundary_variables{number_of_angular_points};
+  Parallel::NodeLock hdf5_lock{};
+  // The steps are shorter than the spacing of the times in the buffer, so the
+  // interpolation uses the same points with and without prefetching.
+  for (size_t step = 0; step < 30; ++step) {
+    const double time = 0.3 + 0.07 * static_cast<double>(step);
+    CAPTURE(time);
+    REQUIRE(boundary_data_manager.populate_hypersurface_boundary_data(
+        make_not_null(&expected_boundary_variables), time,
+        make_not_null(&hdf5_lock)));
+    REQUIRE(
+        prefetching_boundary_data_manager.populate_hypersurface_boundary_data(
+            make_not_null(&prefetched_boundary_variables), time,
+            make_not_null(&hdf5_lock)));
+    tmpl::for_each<
+        Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>(
+        [&expected_boundary_variables,
+         &prefetched_boundary_variables](auto tag_v) {
+          using tag = typename decltype(tag_v)::type;
+          INFO(db::tag_name<tag>());
+          CHECK_ITERABLE_APPROX(get<tag>(prefetched_boundary_variables),
+                                get<tag>(expected_boundary_variables));
+        });
+  }
+  CHECK(boundary_data_manager.get_stall_time() > 0.0);
+  CHECK(prefetching_boundary_data_manager.get_stall_time() >= 0.0);
+}
+
+void test_reduced_worldtube_mode_recorder() {
+  const std::string filename = "ReducedWorldtubeModeRecorderTest.h5";
+  if (file_system::check_if_file_exists(filename)) {
+    file_system::rm(filename, true);
+  }
+  const size_t l_max = 3;
+  const std::vector<double> times{0.0, 0.5, 1.0};
+  std::vector<ComplexModalVector> modes(times.size());
+  for (size_t t = 0; t < times.size(); ++t) {
+    modes[t] = ComplexModalVector{square(l_max + 1)};
+    for (size_t i = 0; i < modes[t].size(); ++i) {
+      modes[t][i] = std::complex<double>(static_cast<double>(i + t),
+                                         -static_cast<double>(i));
+    }
+  }
+  // Appending the rows together gives the same dataset as appending them one
+  // at a time.
+  {
+    Cce::ReducedWorldtubeModeRecorder recorder{filename};
+    for (const bool is_real : {true, false}) {
+      const std::string suffix = is_real ? "Real" : "Complex";
+      for (size_t t = 0; t < times.size(); ++t) {
+        recorder.append_worldtube_mode_data("/SingleRows" + suffix, times[t],
+                                            modes[t], l_max, is_real);
+      }
+      recorder.append_worldtube_mode_data("/ManyRows" + suffix, times, modes,
+                                          l_max, is_real);
+    }
+  }
+  const h5::H5File<h5::AccessType::ReadOnly> file{filename};
+  for (const std::string suffix : {"Real", "Complex"}) {
+    const auto& single_rows = file.get<h5::Dat>("/SingleRows" + suffix);
+    const Matrix single_rows_data = single_rows.get_data();
+    const auto single_rows_legend = single_rows.get_legend();
+    file.close_current_object();
+    const auto& many_rows = file.get<h5::Dat>("/ManyRows" + suffix);
+    CHECK(many_rows.get_data() == single_rows_data);
+    CHECK(many_rows.get_legend() == single_rows_legend);
+    file.close_current_object();
+  }
+  file_system::rm(filename, true);
+}
+
 template <typename Generator>
 void test_spec_worldtube_buffer_updater(
     const gsl::not_null<Generator*> gen,
@@ -797,6 +909,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
     test_spec_worldtube_buffer_updater(make_not_null(&gen), false);
     test_reduced_spec_worldtube_buffer_updater(make_not_null(&gen), true);
     test_reduced_spec_worldtube_buffer_updater(make_not_null(&gen), false);
+    test_reduced_worldtube_mode_recorder();
   }
   {
     INFO("Testing data managers");
@@ -820,6 +933,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
     test_data_manager_with_dummy_buffer_updater<BondiWorldtubeDataManager,
                                                 ReducedDummyBufferUpdater>(
         make_not_null(&gen));
+    test_prefetching_data_manager(make_not_null(&gen));
   }
 }
 }  // namespace Cce
@@ -70,7 +70,8 @@ struct MockElementArray {
                   typename CurvedScalarWave::System<Dim>::variables_tag,
                   domain::Tags::MeshVelocity<Dim>, ::Tags::TimeStepId>,
               db::AddComputeTags<
-                  Tags::FaceCoordinatesCompute<Dim, Frame::Grid, true>>>>>,
+                  Tags::FaceCoordinatesCompute<Dim, Frame::Grid, true>,
+                  Tags::FaceSphericalHarmonicsCompute<Dim>>>>>,
       Parallel::PhaseActions<Parallel::Phase::Testing,
                              tmpl::list<Actions::SendToWorldtube>>>;
 };
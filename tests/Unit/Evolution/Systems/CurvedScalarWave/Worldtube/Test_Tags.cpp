@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
@@ -36,6 +37,7 @@
 #include "Helpers/Evolution/Systems/CurvedScalarWave/Worldtube/TestHelpers.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/RealSphericalHarmonics.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
 #include "Time/Tags/Time.hpp"
@@ -371,6 +373,49 @@ void test_puncture_field() {
   CHECK(not puncture_field_nullopt.has_value());
 }
 
+void test_face_spherical_harmonics() {
+  static constexpr size_t Dim = 3;
+  ::TestHelpers::db::test_compute_tag<Tags::FaceSphericalHarmonicsCompute<Dim>>(
+      "FaceSphericalHarmonics");
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-1., 1.);
+  const auto centered_face_coords =
+      make_with_random_values<tnsr::I<DataVector, Dim, Frame::Grid>>(
+          make_not_null(&gen), dist, DataVector(20));
+  const DataVector theta =
+      atan2(hypot(get<0>(centered_face_coords), get<1>(centered_face_coords)),
+            get<2>(centered_face_coords));
+  const DataVector phi =
+      atan2(get<1>(centered_face_coords), get<0>(centered_face_coords));
+  for (const size_t order : std::array<size_t, 3>{{0, 1, 2}}) {
+    CAPTURE(order);
+    const auto box_abutting = db::create<
+        db::AddSimpleTags<Tags::FaceCoordinates<Dim, Frame::Grid, true>,
+                          Tags::ExpansionOrder>,
+        db::AddComputeTags<Tags::FaceSphericalHarmonicsCompute<Dim>>>(
+        std::make_optional(centered_face_coords), order);
+    const auto& spherical_harmonics =
+        get<Tags::FaceSphericalHarmonics<Dim>>(box_abutting);
+    REQUIRE(spherical_harmonics.has_value());
+    REQUIRE(spherical_harmonics->size() == (order + 1) * (order + 1));
+    size_t index = 0;
+    for (size_t l = 0; l <= order; ++l) {
+      for (int m = -static_cast<int>(l); m <= static_cast<int>(l);
+           ++m, ++index) {
+        CHECK_ITERABLE_APPROX(spherical_harmonics.value()[index],
+                              ylm::real_spherical_harmonic(theta, phi, l, m));
+      }
+    }
+  }
+  const auto box_not_abutting = db::create<
+      db::AddSimpleTags<Tags::FaceCoordinates<Dim, Frame::Grid, true>,
+                        Tags::ExpansionOrder>,
+      db::AddComputeTags<Tags::FaceSphericalHarmonicsCompute<Dim>>>(
+      std::optional<tnsr::I<DataVector, Dim, Frame::Grid>>{}, size_t{1});
+  CHECK(not get<Tags::FaceSphericalHarmonics<Dim>>(box_not_abutting)
+                .has_value());
+}
+
 void test_check_input_file() {
   const auto bbh_correct =
       TestHelpers::CurvedScalarWave::Worldtube::worldtube_binary_compact_object(
@@ -470,6 +515,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.CurvedScalarWave.Worldtube.Tags",
   test_compute_face_coordinates();
   test_inertial_particle_position_compute();
   test_puncture_field();
+  test_face_spherical_harmonics();
   test_check_input_file();
 }
 }  // namespace CurvedScalarWave::Worldtube
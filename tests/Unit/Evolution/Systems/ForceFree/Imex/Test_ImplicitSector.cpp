@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/Determinant.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/ForceFree/Imex/ImplicitSector.hpp"
+#include "Evolution/Systems/ForceFree/Tags.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+using sector = ForceFree::Imex::ImplicitSector;
+using Vars = Variables<sector::variables_tags>;
+using DtVars =
+    Variables<db::wrap_tags_in<::Tags::dt, sector::variables_tags>>;
+
+void test_solve(const gsl::not_null<std::mt19937*> gen,
+                const double parallel_conductivity, const double weight) {
+  const DataVector used_for_size(20);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  const auto explicit_vars =
+      make_with_random_values<Vars>(gen, make_not_null(&dist), used_for_size);
+  const auto lapse = TestHelpers::gr::random_lapse(gen, used_for_size);
+  const auto spatial_metric =
+      TestHelpers::gr::random_spatial_metric<3>(gen, used_for_size);
+  const Scalar<DataVector> sqrt_det_spatial_metric{
+      sqrt(get(determinant(spatial_metric)))};
+
+  auto vars = explicit_vars;
+  sector::solve(make_not_null(&vars), weight, parallel_conductivity, lapse,
+                sqrt_det_spatial_metric, spatial_metric);
+
+  // The solution satisfies u = u* + w S(u)
+  DtVars source{used_for_size.size()};
+  sector::source(make_not_null(&source), vars, parallel_conductivity, lapse,
+                 sqrt_det_spatial_metric, spatial_metric);
+  Approx custom_approx = Approx::custom().epsilon(1.0e-10).scale(1.0);
+  for (size_t i = 0; i < 3; ++i) {
+    const DataVector expected_tilde_e =
+        get<ForceFree::Tags::TildeE>(explicit_vars).get(i) +
+        weight * get<::Tags::dt<ForceFree::Tags::TildeE>>(source).get(i);
+    CHECK_ITERABLE_CUSTOM_APPROX(get<ForceFree::Tags::TildeE>(vars).get(i),
+                                 expected_tilde_e, custom_approx);
+    CHECK(get<::Tags::dt<ForceFree::Tags::TildeB>>(source).get(i) ==
+          DataVector(used_for_size.size(), 0.0));
+  }
+  CHECK(get<ForceFree::Tags::TildeB>(vars) ==
+        get<ForceFree::Tags::TildeB>(explicit_vars));
+  CHECK(get<ForceFree::Tags::TildePsi>(vars) ==
+        get<ForceFree::Tags::TildePsi>(explicit_vars));
+  CHECK(get<ForceFree::Tags::TildePhi>(vars) ==
+        get<ForceFree::Tags::TildePhi>(explicit_vars));
+  CHECK(get<ForceFree::Tags::TildeQ>(vars) ==
+        get<ForceFree::Tags::TildeQ>(explicit_vars));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.ForceFree.Imex.ImplicitSector",
+                  "[Unit][Evolution]") {
+  MAKE_GENERATOR(gen);
+  test_solve(make_not_null(&gen), 1.0, 0.1);
+  // Stiff regime, in which the solution is nearly force-free
+  test_solve(make_not_null(&gen), 1.0e4, 0.1);
+  // Zero weight leaves the fields unchanged
+  test_solve(make_not_null(&gen), 1.0e4, 0.0);
+}
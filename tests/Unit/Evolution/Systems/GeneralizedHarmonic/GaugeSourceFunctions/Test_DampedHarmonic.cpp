@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <random>
 #include <string>
@@ -292,6 +293,22 @@ void test_derived_class(const Mesh<Dim>& mesh) {
 
   CHECK_ITERABLE_APPROX(gauge_h, expected_gauge_h);
   CHECK_ITERABLE_APPROX(d4_gauge_h, expected_d4_gauge_h);
+
+  // Passing the cached spatial weight gives the same result
+  std::optional<Scalar<DataVector>> spatial_weight{Scalar<DataVector>{}};
+  dynamic_cast<const gh::gauges::DampedHarmonic&>(*gauge_condition)
+      .spatial_weight(make_not_null(&spatial_weight.value()), inertial_coords);
+  Scalar<DataVector> expected_spatial_weight{num_points};
+  gh::gauges::DampedHarmonicGauge_detail::spatial_weight_function(
+      make_not_null(&expected_spatial_weight), inertial_coords, 100.0);
+  CHECK_ITERABLE_APPROX(spatial_weight.value(), expected_spatial_weight);
+  gh::gauges::dispatch(
+      make_not_null(&gauge_h), make_not_null(&d4_gauge_h), lapse, shift,
+      sqrt_det_spatial_metric, inverse_spatial_metric, d4_spacetime_metric,
+      half_pi_two_normals, half_phi_two_normals, spacetime_metric, phi, mesh,
+      time, inertial_coords, {}, *gauge_condition, spatial_weight);
+  CHECK_ITERABLE_APPROX(gauge_h, expected_gauge_h);
+  CHECK_ITERABLE_APPROX(d4_gauge_h, expected_d4_gauge_h);
 }
 }  // namespace
 
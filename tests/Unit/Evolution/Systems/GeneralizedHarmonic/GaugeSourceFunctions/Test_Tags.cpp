@@ -5,10 +5,14 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedWaveHelpers.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Tags/GaugeCondition.hpp"
@@ -20,6 +24,7 @@
 #include "ParallelAlgorithms/Events/Tags.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Tags/Time.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 template <size_t Dim>
@@ -68,6 +73,44 @@ void test() {
   CHECK(db::get<gh::Tags::SpacetimeDerivGaugeH<DataVector, Dim>>(box) ==
         tnsr::ab<DataVector, Dim, Frame::Inertial>(num_points, 0.0));
 }
+
+template <size_t Dim>
+void test_spatial_weight() {
+  TestHelpers::db::test_compute_tag<
+      gh::gauges::Tags::DampedHarmonicSpatialWeightCompute<Dim>>(
+      "DampedHarmonicSpatialWeight");
+
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{size_t{3}};
+  for (size_t i = 0; i < Dim; ++i) {
+    inertial_coords.get(i) = DataVector{1., 2., 3.} + static_cast<double>(i);
+  }
+  auto box = db::create<
+      db::AddSimpleTags<domain::Tags::Coordinates<Dim, Frame::Inertial>,
+                        gh::gauges::Tags::GaugeCondition>,
+      db::AddComputeTags<
+          gh::gauges::Tags::DampedHarmonicSpatialWeightCompute<Dim>>>(
+      inertial_coords,
+      std::unique_ptr<gh::gauges::GaugeCondition>{
+          std::make_unique<gh::gauges::DampedHarmonic>(
+              2., std::array{1., 1., 1.}, std::array{1, 1, 1})});
+  Scalar<DataVector> expected_weight{size_t{3}};
+  gh::gauges::DampedHarmonicGauge_detail::spatial_weight_function(
+      make_not_null(&expected_weight), inertial_coords, 2.);
+  const auto& weight =
+      db::get<gh::gauges::Tags::DampedHarmonicSpatialWeight>(box);
+  REQUIRE(weight.has_value());
+  CHECK_ITERABLE_APPROX(weight.value(), expected_weight);
+
+  // Other gauge conditions don't have a spatial weight
+  db::mutate<gh::gauges::Tags::GaugeCondition>(
+      [](const gsl::not_null<std::unique_ptr<gh::gauges::GaugeCondition>*>
+             gauge_condition) {
+        *gauge_condition = std::make_unique<gh::gauges::Harmonic>();
+      },
+      make_not_null(&box));
+  CHECK_FALSE(
+      db::get<gh::gauges::Tags::DampedHarmonicSpatialWeight>(box).has_value());
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.Gauge.Tags",
@@ -78,4 +121,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.Gauge.Tags",
   test<1>();
   test<2>();
   test<3>();
+  test_spatial_weight<1>();
+  test_spatial_weight<2>();
+  test_spatial_weight<3>();
 }
@@ -630,6 +630,12 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
       gr::Tags::SpacetimeNormalVector<DataVector, Dim>>>
       buffer(mesh.number_of_grid_points());
 
+  // Pass the cached spatial weight of the damped harmonic gauge, which must
+  // give the same result as computing it
+  std::optional<Scalar<DataVector>> damped_harmonic_spatial_weight{
+      Scalar<DataVector>{}};
+  gauge_condition.spatial_weight(
+      make_not_null(&damped_harmonic_spatial_weight.value()), inertial_coords);
   gh::TimeDerivative<Dim>::apply(
       make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
       make_not_null(&dt_phi),
@@ -680,7 +686,7 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
           &get<gr::Tags::SpacetimeNormalVector<DataVector, Dim>>(buffer)),
       d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
       gamma1, gamma2, gauge_condition, mesh, time, inertial_coords, inv_jac,
-      {});
+      {}, damped_harmonic_spatial_weight);
 
   CHECK_ITERABLE_APPROX(
       get<gh::ConstraintDamping::Tags::ConstraintGamma1>(buffer), gamma1);
@@ -781,7 +787,7 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
           &get<gr::Tags::SpacetimeNormalVector<DataVector, Dim>>(buffer)),
       d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
       gamma1, gamma2, gauge_condition, mesh, time, inertial_coords, inv_jac,
-      {});
+      {}, {});
 
   tnsr::aa<DataVector, Dim, Frame::Inertial> dt_spacetime_metric_moving_mesh(
       mesh.number_of_grid_points());
@@ -838,7 +844,7 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
           &get<gr::Tags::SpacetimeNormalVector<DataVector, Dim>>(buffer)),
       d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
       gamma1, gamma2, gauge_condition, mesh, time, inertial_coords, inv_jac,
-      std::optional{mesh_velocity});
+      std::optional{mesh_velocity}, {});
 
   for (size_t a = 0; a < Dim + 1; ++a) {
     for (size_t b = a; b < Dim + 1; ++b) {
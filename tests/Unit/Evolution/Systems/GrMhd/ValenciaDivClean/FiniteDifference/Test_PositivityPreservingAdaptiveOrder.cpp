@@ -24,6 +24,17 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GrMhd.ValenciaDivClean.Fd.PpaoPrim",
   helpers::test_prim_reconstructor(
       8, grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim{
              4.0, 4.0, 4.0, mc});
+  // The linear test data is either treated as smooth everywhere, so that the
+  // ghost data is narrowed for the 5th-order scheme, or never.
+  helpers::test_prim_reconstructor(
+      8, grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim{
+             4.0, 4.0, 4.0, mc, 1.0e10});
+  helpers::test_prim_reconstructor(
+      8, grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim{
+             4.0, 4.0, 4.0, mc, 0.0});
+  helpers::test_prim_reconstructor(
+      6, grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim{
+             4.0, 4.0, std::nullopt, mc, 1.0e10});
 
   const grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim
       ppao_recons{4.0, std::nullopt, std::nullopt, mc};
@@ -36,7 +47,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GrMhd.ValenciaDivClean.Fd.PpaoPrim",
       "  Alpha5: 4.0\n"
       "  Alpha7: None\n"
       "  Alpha9: None\n"
-      "  LowOrderReconstructor: MonotonisedCentral\n");
+      "  LowOrderReconstructor: MonotonisedCentral\n"
+      "  SmoothElementTolerance: None\n");
   auto* const ppao_from_options =
       dynamic_cast<const grmhd::ValenciaDivClean::fd::
                        PositivityPreservingAdaptiveOrderPrim*>(
@@ -90,6 +102,13 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GrMhd.ValenciaDivClean.Fd.PpaoPrim",
         grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim(
             4.0, std::nullopt, std::nullopt,
             fd::reconstruction::FallbackReconstructorType::Minmod));
+  CHECK(ppao_recons !=
+        grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim(
+            4.0, std::nullopt, std::nullopt, mc, 1.0e-8));
+  CHECK(grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim(
+            5.0, 6.0, 4.0, mc, 1.0e-8) !=
+        grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim(
+            5.0, 6.0, 4.0, mc, 2.0e-8));
 
   CHECK_THROWS_WITH(
       grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim(
@@ -97,4 +116,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GrMhd.ValenciaDivClean.Fd.PpaoPrim",
           fd::reconstruction::FallbackReconstructorType::None),
       Catch::Matchers::ContainsSubstring(
           "None is not an allowed low-order reconstructor."));
+  CHECK_THROWS_WITH(
+      grmhd::ValenciaDivClean::fd::PositivityPreservingAdaptiveOrderPrim(
+          4.5, std::nullopt, std::nullopt, mc, -1.0),
+      Catch::Matchers::ContainsSubstring(
+          "The smooth element tolerance must be non-negative"));
 }
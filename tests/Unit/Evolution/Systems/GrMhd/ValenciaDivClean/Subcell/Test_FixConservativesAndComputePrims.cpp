@@ -50,6 +50,7 @@ SPECTRE_TEST_CASE(
 
   auto box = db::create<db::AddSimpleTags<
       grmhd::ValenciaDivClean::Tags::VariablesNeededFixing,
+      grmhd::ValenciaDivClean::Tags::NumberOfPointsNeededFixing,
       typename System::variables_tag, typename System::primitive_variables_tag,
       ::Tags::VariableFixer<grmhd::ValenciaDivClean::FixConservatives>,
       hydro::Tags::EquationOfState<
@@ -58,7 +59,7 @@ SPECTRE_TEST_CASE(
       gr::Tags::InverseSpatialMetric<DataVector, 3>,
       gr::Tags::SqrtDetSpatialMetric<DataVector>,
       grmhd::ValenciaDivClean::Tags::PrimitiveFromConservativeOptions>>(
-      false, cons_vars,
+      false, size_t{0}, cons_vars,
       typename System::primitive_variables_tag::type{num_pts, 1.0e-4},
       variable_fixer,
       std::unique_ptr<EquationsOfState::EquationOfState<true, 1>>{
@@ -74,6 +75,8 @@ SPECTRE_TEST_CASE(
 
   // Verify that the conserved variables were fixed
   CHECK(db::get<grmhd::ValenciaDivClean::Tags::VariablesNeededFixing>(box));
+  CHECK(db::get<grmhd::ValenciaDivClean::Tags::NumberOfPointsNeededFixing>(
+            box) == 1);
 
   // Manually do a primitive recovery and see that the values match what's in
   // the DataBox.
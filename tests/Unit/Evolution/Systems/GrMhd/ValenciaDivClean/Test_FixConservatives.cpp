@@ -68,6 +68,16 @@ void test_variable_fixer(
     inv_spatial_metric.get(d, d) = get(sqrt_det_spatial_metric);
   }
 
+  // Points 0 to 3 need fixing
+  auto counted_tilde_d = tilde_d;
+  auto counted_tilde_ye = tilde_ye;
+  auto counted_tilde_tau = tilde_tau;
+  auto counted_tilde_s = tilde_s;
+  CHECK(variable_fixer.fix_and_count_points(
+            &counted_tilde_d, &counted_tilde_ye, &counted_tilde_tau,
+            &counted_tilde_s, tilde_b, spatial_metric, inv_spatial_metric,
+            sqrt_det_spatial_metric) == 4);
+
   CHECK(variable_fixer(&tilde_d, &tilde_ye, &tilde_tau, &tilde_s, tilde_b,
                        spatial_metric, inv_spatial_metric,
                        sqrt_det_spatial_metric));
@@ -76,6 +86,10 @@ void test_variable_fixer(
   CHECK_ITERABLE_APPROX(tilde_ye, expected_tilde_ye);
   CHECK_ITERABLE_APPROX(tilde_tau, expected_tilde_tau);
   CHECK_ITERABLE_APPROX(tilde_s, expected_tilde_s);
+  CHECK(counted_tilde_d == tilde_d);
+  CHECK(counted_tilde_ye == tilde_ye);
+  CHECK(counted_tilde_tau == tilde_tau);
+  CHECK(counted_tilde_s == tilde_s);
 }
 }  // namespace
 
@@ -18,6 +18,7 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservativeOptions.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryStatistics.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/Hydro/TestHelpers.hpp"
@@ -285,6 +286,39 @@ void test_primitive_from_conservative_known(const DataVector& used_for_size) {
   CHECK_ITERABLE_APPROX(expected_divergence_cleaning_field,
                         divergence_cleaning_field);
 
+  // Recording the statistics of the recovery gives the same primitives.
+  grmhd::ValenciaDivClean::PrimitiveRecoveryStatistics statistics{};
+  get(pressure) = 0.0;
+  get(rest_mass_density) = 0.0;
+  grmhd::ValenciaDivClean::
+      PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes>::apply(
+          make_not_null(&rest_mass_density), make_not_null(&electron_fraction),
+          make_not_null(&specific_internal_energy),
+          make_not_null(&spatial_velocity), make_not_null(&magnetic_field),
+          make_not_null(&divergence_cleaning_field),
+          make_not_null(&lorentz_factor), make_not_null(&pressure),
+          make_not_null(&specific_enthalpy), make_not_null(&temperature),
+          make_not_null(&statistics), tilde_d, tilde_ye, tilde_tau, tilde_s,
+          tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+          sqrt_det_spatial_metric, ideal_fluid,
+          primitive_from_conservative_options);
+  CHECK_ITERABLE_APPROX(expected_rest_mass_density, rest_mass_density);
+  CHECK_ITERABLE_APPROX(expected_pressure, pressure);
+  REQUIRE(statistics.number_of_schemes() == 1);
+  if constexpr (UseMagneticField) {
+    CHECK(statistics.number_of_attempts(0) == number_of_points);
+    CHECK(statistics.number_of_successes(0) == number_of_points);
+    CHECK(statistics.number_of_iterations(0) > 0);
+    size_t histogram_total = 0;
+    for (const size_t count : statistics.iteration_histogram(0)) {
+      histogram_total += count;
+    }
+    CHECK(histogram_total == number_of_points);
+  } else {
+    // The hydro-only inversion is not recorded.
+    CHECK(statistics.number_of_attempts(0) == 0);
+  }
+
   if constexpr (not UseMagneticField) {
     // Test KastaunHydro for FPE safety
     tilde_tau = make_with_value<Scalar<DataVector>>(used_for_size, -10.);
@@ -333,6 +367,18 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>,
       2>(&generator, ideal_fluid, dv);
+  {
+    // Use many points so the batched recovery handles points that converge
+    // after different numbers of iterations.
+    const DataVector many_points(100);
+    using NewmanHamlinThenPalenzuelaEtAl = tmpl::list<
+        grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+        grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>;
+    test_primitive_from_conservative_random<NewmanHamlinThenPalenzuelaEtAl, 1>(
+        &generator, polytropic_fluid, many_points);
+    test_primitive_from_conservative_random<NewmanHamlinThenPalenzuelaEtAl, 2>(
+        &generator, ideal_fluid, many_points);
+  }
   test_primitive_from_conservative_random<
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryStatistics.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace grmhd::ValenciaDivClean {
+namespace {
+void test_histogram() {
+  PrimitiveRecoveryStatistics statistics{1};
+  CHECK(statistics.number_of_schemes() == 1);
+  for (const size_t iterations : {0_st, 1_st, 2_st, 3_st, 4_st, 7_st, 8_st,
+                                  63_st, 64_st, 1000_st}) {
+    statistics.record_attempt(0, true, iterations);
+  }
+  statistics.record_attempt(0, false, 500);
+  CHECK(statistics.number_of_attempts(0) == 11);
+  CHECK(statistics.number_of_successes(0) == 10);
+  CHECK(statistics.number_of_iterations(0) == 1152);
+  CHECK(statistics.iteration_histogram(0) ==
+        std::array<size_t, PrimitiveRecoveryStatistics::
+                               number_of_iteration_bins>{
+            {1, 1, 2, 2, 1, 0, 1, 2}});
+}
+
+void test_starting_scheme() {
+  PrimitiveRecoveryStatistics statistics{3};
+  CHECK(statistics.starting_scheme() == 0);
+
+  // The first scheme always succeeds but needs many iterations. The second
+  // scheme is cheaper but has only been tried a few times.
+  for (size_t i = 0;
+       i < PrimitiveRecoveryStatistics::minimum_number_of_attempts; ++i) {
+    statistics.record_attempt(0, true, 20);
+  }
+  for (size_t i = 0;
+       i < PrimitiveRecoveryStatistics::minimum_number_of_attempts - 1; ++i) {
+    statistics.record_attempt(1, true, 5);
+  }
+  CHECK(statistics.starting_scheme() == 0);
+  statistics.record_attempt(1, true, 5);
+  CHECK(statistics.starting_scheme() == 1);
+
+  // Schemes that fail too often are not used first however cheap they are.
+  statistics.record_attempt(1, false, 0);
+  CHECK(statistics.starting_scheme() == 0);
+  for (size_t i = 0;
+       i < PrimitiveRecoveryStatistics::minimum_number_of_attempts; ++i) {
+    statistics.record_attempt(2, true, 10);
+  }
+  CHECK(statistics.starting_scheme() == 2);
+
+  test_serialization(statistics);
+  const PrimitiveRecoveryStatistics copy = statistics;
+  CHECK(copy == statistics);
+  CHECK_FALSE(copy != statistics);
+  CHECK(PrimitiveRecoveryStatistics{3} != statistics);
+  CHECK(PrimitiveRecoveryStatistics{} != PrimitiveRecoveryStatistics{3});
+}
+
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveRecoveryStatistics",
+                  "[Unit][GrMhd]") {
+  test_histogram();
+  test_starting_scheme();
+}
+}  // namespace
+}  // namespace grmhd::ValenciaDivClean
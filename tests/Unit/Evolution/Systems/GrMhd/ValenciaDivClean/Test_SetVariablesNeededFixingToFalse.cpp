@@ -3,18 +3,23 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/SetVariablesNeededFixingToFalse.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Utilities/Literals.hpp"
 
 SPECTRE_TEST_CASE(
     "Unit.Evolution.Systems.ValenciaDivClean.SetVariablesNeededFixingToFalse",
     "[Unit][Evolution]") {
-  auto box = db::create<
-      db::AddSimpleTags<grmhd::ValenciaDivClean::Tags::VariablesNeededFixing>>(
-      true);
+  auto box = db::create<db::AddSimpleTags<
+      grmhd::ValenciaDivClean::Tags::VariablesNeededFixing,
+      grmhd::ValenciaDivClean::Tags::NumberOfPointsNeededFixing>>(true, 5_st);
   db::mutate_apply<grmhd::ValenciaDivClean::SetVariablesNeededFixingToFalse>(
       make_not_null(&box));
   CHECK_FALSE(
       db::get<grmhd::ValenciaDivClean::Tags::VariablesNeededFixing>(box));
+  CHECK(db::get<grmhd::ValenciaDivClean::Tags::NumberOfPointsNeededFixing>(
+            box) == 0);
 }
@@ -13,4 +13,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ValenciaDivClean.Tags",
   TestHelpers::db::test_simple_tag<
       grmhd::ValenciaDivClean::Tags::VariablesNeededFixing>(
           "VariablesNeededFixing");
+  TestHelpers::db::test_simple_tag<
+      grmhd::ValenciaDivClean::Tags::NumberOfPointsNeededFixing>(
+          "NumberOfPointsNeededFixing");
+  TestHelpers::db::test_simple_tag<
+      grmhd::ValenciaDivClean::Tags::PrimitiveRecoveryStatistics>(
+          "PrimitiveRecoveryStatistics");
 }
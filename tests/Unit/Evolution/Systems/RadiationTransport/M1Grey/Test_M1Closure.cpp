@@ -97,4 +97,42 @@ SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
   const DataVector expected_xi1{1.0, 1.0, 1.0, 1.0, 1.0};
   CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), expected_xi1,
                                custom_approx);
+
+  // (3) Intermediate regime, where the closure factor is found by root finding
+  get(energy_density) = 1.;
+  momentum_density.get(0) = 0.2;
+  momentum_density.get(1) = 0.1;
+  momentum_density.get(2) = -0.1;
+  get(closure_factor) = -1.;
+  const auto apply_closure = [&]() {
+    closure.apply(
+        make_not_null(&closure_factor), make_not_null(&pressure_tensor),
+        make_not_null(&comoving_energy_density),
+        make_not_null(&comoving_momentum_density_normal),
+        make_not_null(&comoving_momentum_density_spatial), energy_density,
+        momentum_density, fluid_velocity, fluid_lorentz_factor, spatial_metric,
+        inv_spatial_metric);
+  };
+  apply_closure();
+  // The closure factor solves xi^2 J^2 = H^a H_a
+  DataVector h_sqr = -square(get(comoving_momentum_density_normal));
+  for (size_t m = 0; m < 3; m++) {
+    for (size_t n = 0; n < 3; n++) {
+      h_sqr += inv_spatial_metric.get(m, n) *
+               comoving_momentum_density_spatial.get(m) *
+               comoving_momentum_density_spatial.get(n);
+    }
+  }
+  const DataVector zero(used_for_size.size(), 0.);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      DataVector{square(get(closure_factor) * get(comoving_energy_density)) -
+                 h_sqr},
+      zero, custom_approx);
+  // Warm-starting from the previous closure factor finds the same root
+  const DataVector cold_start_xi = get(closure_factor);
+  CHECK(min(cold_start_xi) > 0.);
+  CHECK(max(cold_start_xi) < 1.);
+  apply_closure();
+  CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), cold_start_xi,
+                               custom_approx);
 }
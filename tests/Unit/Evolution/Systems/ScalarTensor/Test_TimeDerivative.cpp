@@ -20,10 +20,12 @@
 #include "Evolution/Systems/ScalarTensor/TimeDerivative.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Christoffel.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/DerivSpatialMetric.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/ExtrinsicCurvature.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpatialDerivOfLapse.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpatialDerivOfShift.hpp"
+#include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -200,8 +202,56 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
                                                 Frame::Inertial>>(
           arg_variables),
       tuples::get<domain::Tags::MeshVelocity<3, Frame::Inertial>>(
+          arg_variables),
+      tuples::get<gh::gauges::Tags::DampedHarmonicSpatialWeight>(
           arg_variables));
 
+  // The spacetime quantities of the scalar equation are computed from the GH
+  // temporaries
+  const auto& expected_lapse =
+      get<gr::Tags::Lapse<DataVector>>(expected_temp_variables);
+  const auto& expected_inverse_spatial_metric =
+      get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(
+          expected_temp_variables);
+  const auto& expected_normal_vector =
+      get<gr::Tags::SpacetimeNormalVector<DataVector, 3>>(
+          expected_temp_variables);
+  const auto& phi = tuples::get<gh::Tags::Phi<DataVector, 3>>(arg_variables);
+  auto& expected_deriv_lapse =
+      get<::Tags::deriv<gr::Tags::Lapse<DataVector>, tmpl::size_t<3>,
+                        Frame::Inertial>>(expected_temp_variables);
+  gh::spatial_deriv_of_lapse(make_not_null(&expected_deriv_lapse),
+                             expected_lapse, expected_normal_vector, phi);
+  auto& expected_deriv_shift =
+      get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
+                        Frame::Inertial>>(expected_temp_variables);
+  gh::spatial_deriv_of_shift(
+      make_not_null(&expected_deriv_shift), expected_lapse,
+      get<gr::Tags::InverseSpacetimeMetric<DataVector, 3>>(
+          expected_temp_variables),
+      expected_normal_vector, phi);
+  auto& expected_trace_christoffel_first_kind =
+      get<gr::Tags::TraceSpatialChristoffelFirstKind<DataVector, 3>>(
+          expected_temp_variables);
+  trace_last_indices(
+      make_not_null(&expected_trace_christoffel_first_kind),
+      gr::christoffel_first_kind(gh::deriv_spatial_metric(phi)),
+      expected_inverse_spatial_metric);
+  auto& expected_trace_christoffel =
+      get<gr::Tags::TraceSpatialChristoffelSecondKind<DataVector, 3>>(
+          expected_temp_variables);
+  raise_or_lower_index(make_not_null(&expected_trace_christoffel),
+                       expected_trace_christoffel_first_kind,
+                       expected_inverse_spatial_metric);
+  auto& expected_trace_extrinsic_curvature =
+      get<gr::Tags::TraceExtrinsicCurvature<DataVector>>(
+          expected_temp_variables);
+  trace(make_not_null(&expected_trace_extrinsic_curvature),
+        gh::extrinsic_curvature(
+            expected_normal_vector,
+            tuples::get<gh::Tags::Pi<DataVector, 3>>(arg_variables), phi),
+        expected_inverse_spatial_metric);
+
   // The time derivative function for CurvedScalarWave is
   CurvedScalarWave::TimeDerivative<3>::apply(
       // Scalar evolved variables
@@ -232,16 +282,11 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
       tuples::get<CurvedScalarWave::Tags::Pi>(arg_variables),
       tuples::get<CurvedScalarWave::Tags::Phi<3>>(arg_variables),
 
-      tuples::get<gr::Tags::Lapse<DataVector>>(arg_variables),
-      tuples::get<gr::Tags::Shift<DataVector, 3>>(arg_variables),
-      tuples::get<::Tags::deriv<gr::Tags::Lapse<DataVector>, tmpl::size_t<3>,
-                                Frame::Inertial>>(arg_variables),
-      tuples::get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
-                                Frame::Inertial>>(arg_variables),
-      tuples::get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(arg_variables),
-      tuples::get<gr::Tags::TraceSpatialChristoffelSecondKind<DataVector, 3>>(
-          arg_variables),
-      tuples::get<gr::Tags::TraceExtrinsicCurvature<DataVector>>(arg_variables),
+      expected_lapse,
+      get<gr::Tags::Shift<DataVector, 3>>(expected_temp_variables),
+      expected_deriv_lapse, expected_deriv_shift,
+      expected_inverse_spatial_metric, expected_trace_christoffel,
+      expected_trace_extrinsic_curvature,
       tuples::get<CurvedScalarWave::Tags::ConstraintGamma1>(arg_variables),
       tuples::get<CurvedScalarWave::Tags::ConstraintGamma2>(arg_variables));
 
@@ -253,7 +298,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
               DataVector, 3, ::Frame::Inertial>>(expected_temp_variables)),
       tuples::get<CurvedScalarWave::Tags::Pi>(arg_variables),
       tuples::get<CurvedScalarWave::Tags::Phi<3>>(arg_variables),
-      tuples::get<gr::Tags::Lapse<DataVector>>(arg_variables));
+      expected_lapse);
 
   // When we have backreaction we also need to compute and apply the correction
   // to dt pi for the expected variables
@@ -264,13 +309,13 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
       get<ScalarTensor::Tags::TraceReversedStressEnergy<DataVector, 3,
                                                         ::Frame::Inertial>>(
           expected_temp_variables),
-      tuples::get<gr::Tags::Lapse<DataVector>>(arg_variables));
+      expected_lapse);
 
   ScalarTensor::add_scalar_source_to_dt_pi_scalar(
       make_not_null(
           &get<::Tags::dt<CurvedScalarWave::Tags::Pi>>(expected_dt_variables)),
       tuples::get<ScalarTensor::Tags::ScalarSource>(arg_variables),
-      tuples::get<gr::Tags::Lapse<DataVector>>(arg_variables));
+      expected_lapse);
 
   // The time derivative function for the combined system is
   ScalarTensor::TimeDerivative::apply(
@@ -346,6 +391,20 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
       // Extra scalar temporaries
       make_not_null(&get<ScalarTensor::Tags::TraceReversedStressEnergy<
                         DataVector, 3, ::Frame::Inertial>>(temp_variables)),
+      make_not_null(&get<::Tags::deriv<gr::Tags::Lapse<DataVector>,
+                                       tmpl::size_t<3>, Frame::Inertial>>(
+          temp_variables)),
+      make_not_null(&get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>,
+                                       tmpl::size_t<3>, Frame::Inertial>>(
+          temp_variables)),
+      make_not_null(
+          &get<gr::Tags::TraceSpatialChristoffelFirstKind<DataVector, 3>>(
+              temp_variables)),
+      make_not_null(
+          &get<gr::Tags::TraceSpatialChristoffelSecondKind<DataVector, 3>>(
+              temp_variables)),
+      make_not_null(
+          &get<gr::Tags::TraceExtrinsicCurvature<DataVector>>(temp_variables)),
       // GH gradient tags
       get<::Tags::deriv<gr::Tags::SpacetimeMetric<DataVector, 3>,
                         tmpl::size_t<3>, Frame::Inertial>>(gradient_variables),
@@ -382,17 +441,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.ScalarTensor.TimeDerivative",
       // Scalar argument tags
       tuples::get<CurvedScalarWave::Tags::Pi>(arg_variables),
       tuples::get<CurvedScalarWave::Tags::Phi<3>>(arg_variables),
-
-      tuples::get<gr::Tags::Lapse<DataVector>>(arg_variables),
-      tuples::get<gr::Tags::Shift<DataVector, 3>>(arg_variables),
-      tuples::get<::Tags::deriv<gr::Tags::Lapse<DataVector>, tmpl::size_t<3>,
-                                Frame::Inertial>>(arg_variables),
-      tuples::get<::Tags::deriv<gr::Tags::Shift<DataVector, 3>, tmpl::size_t<3>,
-                                Frame::Inertial>>(arg_variables),
-      tuples::get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(arg_variables),
-      tuples::get<gr::Tags::TraceSpatialChristoffelSecondKind<DataVector, 3>>(
-          arg_variables),
-      tuples::get<gr::Tags::TraceExtrinsicCurvature<DataVector>>(arg_variables),
       tuples::get<CurvedScalarWave::Tags::ConstraintGamma1>(arg_variables),
       tuples::get<CurvedScalarWave::Tags::ConstraintGamma2>(arg_variables),
 
@@ -487,6 +487,14 @@ class MockDistributedObjectProxy : public CProxyElement_ArrayElement {
     mock_distributed_object_.template simple_action<Action>(std::move(args));
   }
 
+  // Message priorities have no effect since tests invoke queued actions
+  // manually.
+  template <typename Action, typename... Args>
+  void simple_action(std::tuple<Args...> args,
+                     const CkEntryOptions* /*options*/) {
+    simple_action<Action>(std::move(args));
+  }
+
   template <typename Action>
   void simple_action() {
     mock_distributed_object_.template simple_action<Action>();
@@ -671,6 +679,12 @@ class MockCollectionOfDistributedObjectsProxy
                   });
   }
 
+  template <typename Action, typename... Args>
+  void simple_action(std::tuple<Args...> args,
+                     const CkEntryOptions* /*options*/) {
+    simple_action<Action>(std::move(args));
+  }
+
   template <typename Action>
   void simple_action() {
     alg::for_each(*mock_distributed_objects_,
@@ -208,6 +208,8 @@ struct MockControlComponent {
 
   using const_global_cache_tags =
       tmpl::list<control_system::Tags::MeasurementsPerUpdate,
+                 control_system::Tags::MeasurementsBeforeExpiration,
+                 control_system::Tags::QuiescentStretchFactor,
                  control_system::Tags::WriteDataToDisk,
                  control_system::Tags::Verbosity,
                  control_system::Tags::IsActiveMap,
@@ -596,8 +598,10 @@ struct SystemHelper {
       averager.assign_time_between_measurements(min_measurement_timescale);
 
       const double measurement_expr_time = measurement_expiration_time(
-          initial_time_, DataVector{0.0}, DataVector{min_measurement_timescale},
-          measurements_per_update_);
+          initial_time_ + (measurements_before_expiration_ - 1) *
+                              min_measurement_timescale,
+          DataVector{0.0}, DataVector{min_measurement_timescale},
+          measurements_per_update_, measurements_before_expiration_);
 
       individual_minimums[name<system>()] =
           std::make_pair(min_measurement_timescale, measurement_expr_time);
@@ -626,9 +630,10 @@ struct SystemHelper {
          individual_minimums) {
       (void)min_measure_expr_time;
       initial_expiration_times[system_name] = function_of_time_expiration_time(
-          initial_time_, DataVector{0.0},
-          DataVector{overall_min_measurement_timescale},
-          measurements_per_update_);
+          initial_time_ + (measurements_before_expiration_ - 1) *
+                              overall_min_measurement_timescale,
+          DataVector{0.0}, DataVector{overall_min_measurement_timescale},
+          measurements_per_update_, measurements_before_expiration_);
     }
 
     const double excision_radius =
@@ -807,14 +812,16 @@ struct SystemHelper {
           control_components, tmpl::bind<option_tag, tmpl::_1>>>,
       control_system::OptionTags::WriteDataToDisk, ::OptionTags::InitialTime,
       domain::OptionTags::DomainCreator<3>,
-      control_system::OptionTags::MeasurementsPerUpdate>;
+      control_system::OptionTags::MeasurementsPerUpdate,
+      control_system::OptionTags::MeasurementsBeforeExpiration>;
   template <typename System>
   using creatable_tags = tmpl::list_difference<
       init_simple_tags<System>,
       tmpl::list<typename System::MeasurementQueue,
                  control_system::Tags::CurrentNumberOfMeasurements,
                  control_system::Tags::UpdateAggregators,
-                 control_system::Tags::MeasurementsPerUpdate>>;
+                 control_system::Tags::MeasurementsPerUpdate,
+                 control_system::Tags::MeasurementsBeforeExpiration>>;
 
   void parse_options(const std::string& option_string) {
     Options::Parser<option_list> parser{"Peter Parker the option parser."};
@@ -825,12 +832,17 @@ struct SystemHelper {
               std::move(args)...);
         });
 
-    const auto created_measurements_per_update =
+    const auto created_measurements =
         Parallel::create_from_options<Metavars>(
-            options, tmpl::list<control_system::Tags::MeasurementsPerUpdate>{});
+            options,
+            tmpl::list<control_system::Tags::MeasurementsPerUpdate,
+                       control_system::Tags::MeasurementsBeforeExpiration>{});
 
     measurements_per_update_ = get<control_system::Tags::MeasurementsPerUpdate>(
-        created_measurements_per_update);
+        created_measurements);
+    measurements_before_expiration_ =
+        get<control_system::Tags::MeasurementsBeforeExpiration>(
+            created_measurements);
 
     std::unordered_map<std::string, control_system::UpdateAggregator>
         update_aggregators{};
@@ -899,6 +911,7 @@ struct SystemHelper {
   ylm::Strahlkorper<Frame::Distorted> horizon_a_{};
   ylm::Strahlkorper<Frame::Distorted> horizon_b_{};
   int measurements_per_update_{};
+  int measurements_before_expiration_{};
   double initial_time_{std::numeric_limits<double>::signaling_NaN()};
   std::unordered_map<std::string, std::string> system_to_combined_names_{
       control_system::system_to_combined_names<control_systems>()};
@@ -214,13 +214,15 @@ struct ScalarSystem {
       "Error(Scalar)]\n"
       "  FloatingPointTypes: [Double]\n";
   static ObserveEvent make_test_object(
-      const std::optional<Mesh<volume_dim>>& interpolating_mesh) {
+      const std::optional<Mesh<volume_dim>>& interpolating_mesh,
+      const std::optional<std::vector<std::string>>& blocks_to_observe = {}) {
     return ObserveEvent{
         "element_data",
         FloatingPointType::Double,
         {FloatingPointType::Double},
         {"Scalar", "ScalarVarTimesTwo", "ScalarVarTimesThree", "Error(Scalar)"},
-        interpolating_mesh};
+        interpolating_mesh,
+        blocks_to_observe};
   }
 };
 
@@ -335,7 +337,8 @@ struct ComplicatedSystem {
       "                       Double, Float]\n";
 
   static ObserveEvent make_test_object(
-      const std::optional<Mesh<volume_dim>>& interpolating_mesh) {
+      const std::optional<Mesh<volume_dim>>& interpolating_mesh,
+      const std::optional<std::vector<std::string>>& blocks_to_observe = {}) {
     return ObserveEvent(
         "element_data", FloatingPointType::Double,
         {FloatingPointType::Double, FloatingPointType::Double,
@@ -344,7 +347,7 @@ struct ComplicatedSystem {
          FloatingPointType::Double, FloatingPointType::Float},
         {"Scalar", "ScalarVarTimesTwo", "ScalarVarTimesThree", "Vector",
          "Tensor", "Tensor2", "Error(Vector)", "Error(Tensor2)"},
-        interpolating_mesh);
+        interpolating_mesh, blocks_to_observe);
   }
 };
 }  // namespace TestHelpers::dg::Events::ObserveFields
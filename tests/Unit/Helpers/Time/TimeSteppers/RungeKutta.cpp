@@ -92,4 +92,24 @@ void check_tableau(const TimeSteppers::RungeKutta& stepper) {
   check_tableau(stepper.butcher_tableau(), stepper.order(),
                 stepper.error_estimate_order());
 }
+
+void check_implicit_tableau(const TimeSteppers::ImexRungeKutta& stepper) {
+  const auto& explicit_tableau = stepper.butcher_tableau();
+  const auto& implicit_coefficients =
+      stepper.implicit_butcher_tableau().substep_coefficients;
+
+  // The implicit part is only used for the substeps contributing to
+  // the result.
+  CHECK(implicit_coefficients.size() + 1 ==
+        explicit_tableau.result_coefficients.size());
+  for (size_t substep = 1; substep <= implicit_coefficients.size();
+       ++substep) {
+    const auto& coefficients = implicit_coefficients[substep - 1];
+    // Includes the diagonal term
+    CHECK(coefficients.size() == substep + 1);
+    // Substep is order 1, with the same times as the explicit part
+    CHECK(alg::accumulate(coefficients, 0.0) ==
+          approx(explicit_tableau.substep_times[substep - 1]));
+  }
+}
 }  // namespace TestHelpers::RungeKutta
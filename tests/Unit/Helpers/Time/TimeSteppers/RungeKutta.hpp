@@ -5,6 +5,7 @@
 
 #include <cstddef>
 
+#include "Time/TimeSteppers/ImexRungeKutta.hpp"
 #include "Time/TimeSteppers/RungeKutta.hpp"
 
 namespace TestHelpers::RungeKutta {
@@ -13,4 +14,7 @@ void check_tableau(const TimeSteppers::RungeKutta::ButcherTableau& tableau,
                    size_t expected_order, size_t expected_error_order);
 /// Convenience wrapper for the previous function
 void check_tableau(const TimeSteppers::RungeKutta& stepper);
+
+/// Sanity-check the implicit Butcher tableau of an IMEX stepper
+void check_implicit_tableau(const TimeSteppers::ImexRungeKutta& stepper);
 }  // namespace TestHelpers::RungeKutta
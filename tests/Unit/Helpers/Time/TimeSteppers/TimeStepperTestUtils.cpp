@@ -24,6 +24,7 @@
 #include "Time/Slab.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/ImexTimeStepper.hpp"
 #include "Time/TimeSteppers/LtsTimeStepper.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -461,6 +462,40 @@ void check_convergence_order(const TimeStepper& stepper,
                          output) == approx(stepper.order()).margin(0.4));
 }
 
+void check_imex_convergence_order(
+    const ImexTimeStepper& stepper,
+    const std::pair<int32_t, int32_t>& step_range, const bool output) {
+  const auto do_integral = [&stepper](const int32_t num_steps) {
+    const Slab slab(0., 1.);
+    const TimeDelta step_size = slab.duration() / num_steps;
+
+    // Solve y' = y - 2 y, with the second term treated implicitly.
+    Time time = slab.start();
+    double y = 1.;
+    TimeSteppers::History<double> history{stepper.order()};
+    TimeSteppers::History<double> implicit_history{stepper.order()};
+    while (time < slab.end()) {
+      TimeStepId time_id(true, 0, time);
+      for (uint64_t substep = 0; substep < stepper.number_of_substeps();
+           ++substep) {
+        history.insert(time_id, y, y);
+        implicit_history.insert(
+            time_id, TimeSteppers::History<double>::no_value, -2.0 * y);
+        stepper.update_u(make_not_null(&y), make_not_null(&history),
+                         step_size);
+        stepper.add_inhomogeneous_implicit_terms(
+            make_not_null(&y), make_not_null(&implicit_history), step_size);
+        y /= 1.0 + 2.0 * stepper.implicit_weight(implicit_history, step_size);
+        time_id = stepper.next_time_id(time_id, step_size);
+      }
+      time = time_id.step_time();
+    }
+    return abs(y - exp(-1.));
+  };
+  CHECK(convergence_rate(step_range.first, step_range.second, do_integral,
+                         output) == approx(stepper.imex_order()).margin(0.4));
+}
+
 void check_dense_output(const TimeStepper& stepper,
                         const size_t history_integration_order) {
   const auto get_dense = [&stepper, &history_integration_order](
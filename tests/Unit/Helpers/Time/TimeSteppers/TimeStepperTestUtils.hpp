@@ -16,6 +16,7 @@
 #include "Utilities/Gsl.hpp"
 
 /// \cond
+class ImexTimeStepper;
 class LtsTimeStepper;
 class TimeStepper;
 /// \endcond
@@ -88,6 +89,12 @@ void check_convergence_order(const TimeStepper& stepper,
                              const std::pair<int32_t, int32_t>& step_range,
                              bool output = false);
 
+/// Check that IMEX integration converges as expected.  The arguments
+/// are as for `check_convergence_order`.
+void check_imex_convergence_order(
+    const ImexTimeStepper& stepper,
+    const std::pair<int32_t, int32_t>& step_range, bool output = false);
+
 void check_dense_output(const TimeStepper& stepper,
                         const size_t history_integration_order);
 
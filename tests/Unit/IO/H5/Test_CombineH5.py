@@ -235,6 +235,45 @@ class TestCombineH5(unittest.TestCase):
             )
             self.assertEqual(value, True)
 
+    def test_combine_h5_split(self):
+        # Each process combines a disjoint subset of the observations into its
+        # own output file
+        output_files = [
+            os.path.join(
+                Informer.unit_test_build_path(), f"IO/TestOutput{i}.h5"
+            )
+            for i in range(2)
+        ]
+        for process_index, output_file in enumerate(output_files):
+            if os.path.isfile(output_file):
+                os.remove(output_file)
+            combine_h5(
+                self.file_names,
+                self.subfile_name,
+                output_file,
+                False,
+                process_index=process_index,
+                number_of_processes=2,
+                compress=False,
+            )
+        for process_index, output_file in enumerate(output_files):
+            h5_output = spectre_h5.H5File(file_name=output_file, mode="r")
+            output_vol = h5_output.get_vol(self.subfile_name)
+            self.assertEqual(
+                output_vol.list_observation_ids(),
+                [self.observation_ids[process_index]],
+            )
+            self.assertEqual(
+                len(
+                    output_vol.get_tensor_component(
+                        self.observation_ids[process_index], "field_1"
+                    ).data
+                ),
+                16,
+            )
+            h5_output.close()
+            os.remove(output_file)
+
     def test_cli(self):
         # Checks if the CLI for CombineH5 runs properly
         runner = CliRunner()
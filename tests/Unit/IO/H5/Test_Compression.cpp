@@ -0,0 +1,98 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <hdf5.h>
+#include <string>
+#include <vector>
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/OpenGroup.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+void test_options() {
+  const auto compression = TestHelpers::test_creation<h5::Compression>(
+      "DeflateLevel: 9\n"
+      "Shuffle: false\n"
+      "ChunkBytes: 1024\n"
+      "PluginFilter: []");
+  CHECK(compression == h5::Compression{9, false, 1024});
+  CHECK(compression != h5::Compression{});
+  CHECK(compression != h5::Compression::none());
+  CHECK(h5::Compression{} == h5::Compression{5, true, 131'072});
+  test_serialization(compression);
+  test_serialization(h5::Compression{0, true, 8, {32013, 1, 2}});
+}
+
+// Returns the number of filters and the chunk size of the dataset `name`
+std::pair<int, hsize_t> filters_and_chunk_size(const hid_t group_id,
+                                               const std::string& name) {
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5::h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset");
+  const hid_t property_list = H5Dget_create_plist(dataset_id);
+  CHECK_H5(property_list, "Failed to get property list");
+  const int number_of_filters = H5Pget_nfilters(property_list);
+  hsize_t chunk_size = 0;
+  if (H5Pget_layout(property_list) == H5D_CHUNKED) {
+    CHECK_H5(H5Pget_chunk(property_list, 1, &chunk_size),
+             "Failed to get chunk size");
+  }
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return {number_of_filters, chunk_size};
+}
+
+void test_write_data() {
+  const std::string h5_file_name("Unit.IO.H5.Compression.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const bool deflate_available = H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+  const bool shuffle_available = H5Zfilter_avail(H5Z_FILTER_SHUFFLE) > 0;
+  {
+    const hid_t file_id = H5Fcreate(h5_file_name.c_str(), h5::h5f_acc_trunc(),
+                                    h5::h5p_default(), h5::h5p_default());
+    CHECK_H5(file_id, "Failed to create file");
+    {
+      const h5::detail::OpenGroup group(file_id, "Data",
+                                        h5::AccessType::ReadWrite);
+      const std::vector<double> data(1000, 1.5);
+      h5::write_data(group.id(), data, {data.size()}, "default");
+      h5::write_data(group.id(), data, {data.size()}, "none", false,
+                     h5::Compression::none());
+      h5::write_data(group.id(), data, {data.size()}, "small_chunks", false,
+                     h5::Compression{1, false, 256});
+
+      if (deflate_available) {
+        CHECK(filters_and_chunk_size(group.id(), "default") ==
+              std::pair<int, hsize_t>{shuffle_available ? 2 : 1, 1000});
+        CHECK(filters_and_chunk_size(group.id(), "small_chunks") ==
+              std::pair<int, hsize_t>{1, 32});
+      }
+      CHECK(filters_and_chunk_size(group.id(), "none") ==
+            std::pair<int, hsize_t>{0, 0});
+
+      // Compression doesn't change the data
+      for (const std::string name : {"default", "none", "small_chunks"}) {
+        CHECK(h5::read_data<1, std::vector<double>>(group.id(), name) == data);
+      }
+    }
+    CHECK_H5(H5Fclose(file_id), "Failed to close file");
+  }
+  file_system::rm(h5_file_name, true);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.Compression", "[Unit][IO][H5]") {
+  test_options();
+  test_write_data();
+}
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <hdf5.h>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,8 @@
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
 #include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/OpenGroup.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -99,6 +102,47 @@ void test_strahlkorper() {
        "InertialCoordinates_z", "TestScalar"},
       {{0, 1, 2, 3}}, {}, observation_values[0]);
 
+  {
+    INFO("Generate connectivity");
+    const size_t lazy_observation_id = 4445;
+    {
+      h5::H5File<h5::AccessType::ReadWrite> strahlkorper_file{h5_file_name,
+                                                              true};
+      auto& volume_file = strahlkorper_file.get<h5::VolumeData>(
+          "/element_data", version_number);
+      volume_file.write_volume_data(
+          lazy_observation_id, 2.0,
+          std::vector<ElementVolumeData>{
+              {grid_name, tensor_components, extents, bases, quadratures}},
+          std::nullopt, std::nullopt, {}, false);
+      CHECK(volume_file.has_connectivity(observation_ids[0]));
+      CHECK_FALSE(volume_file.has_connectivity(lazy_observation_id));
+      CHECK(volume_file.list_tensor_components(lazy_observation_id).size() ==
+            tensor_components.size());
+      volume_file.generate_connectivity(lazy_observation_id);
+      CHECK(volume_file.has_connectivity(lazy_observation_id));
+      // Generating it again does nothing
+      volume_file.generate_connectivity(lazy_observation_id);
+    }
+    const hid_t file_id =
+        H5Fopen(h5_file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    const auto read_connectivity = [&file_id](const size_t observation_id,
+                                              const std::string& name) {
+      const h5::detail::OpenGroup observation_group(
+          file_id,
+          "/element_data.vol/ObservationId" + std::to_string(observation_id),
+          h5::AccessType::ReadOnly);
+      return h5::read_data<1, std::vector<int>>(observation_group.id(), name);
+    };
+    for (const std::string name : {"connectivity", "pole_connectivity"}) {
+      CAPTURE(name);
+      const auto expected = read_connectivity(observation_ids[0], name);
+      CHECK_FALSE(expected.empty());
+      CHECK(read_connectivity(lazy_observation_id, name) == expected);
+    }
+    CHECK_H5(H5Fclose(file_id), "Failed to close file");
+  }
+
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
@@ -282,6 +326,23 @@ void test() {
     CHECK(last_grid_offset_and_length.second == 8);
   }
 
+  {
+    INFO("locations_of_grids");
+    const size_t observation_id = observation_ids.front();
+    const auto all_grid_names = volume_file.get_grid_names(observation_id);
+    const auto all_extents = volume_file.get_extents(observation_id);
+    const auto locations = h5::locations_of_grids(all_grid_names, all_extents);
+    CHECK(locations.size() == all_grid_names.size());
+    for (size_t i = 0; i < all_grid_names.size(); ++i) {
+      const auto& location = locations.at(all_grid_names[i]);
+      CHECK(location.index == i);
+      const auto offset_and_length = h5::offset_and_length_for_grid(
+          all_grid_names[i], all_grid_names, all_extents);
+      CHECK(location.offset == offset_and_length.first);
+      CHECK(location.length == offset_and_length.second);
+    }
+  }
+
   {
     INFO("mesh_for_grid");
     const size_t observation_id = observation_ids.front();
@@ -299,6 +360,8 @@ void test() {
                              all_bases, all_quadratures);
     CHECK(last_mesh == Mesh<3>(2, Spectral::Basis::Legendre,
                                Spectral::Quadrature::GaussLobatto));
+    CHECK(h5::mesh_for_grid<3>(all_grid_names.size() - 1, all_extents,
+                               all_bases, all_quadratures) == last_mesh);
   }
 
   if (file_system::check_if_file_exists(h5_file_name)) {
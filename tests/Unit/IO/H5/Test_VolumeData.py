@@ -190,6 +190,29 @@ class TestVolumeData(unittest.TestCase):
                 expected_tensor_component_data,
             )
 
+    def test_tensor_component_arrays(self):
+        obs_id = 0
+        field_1 = self.vol_file.get_tensor_component_array(
+            observation_id=obs_id, tensor_component="field_1"
+        )
+        self.assertIsInstance(field_1, np.ndarray)
+        self.assertEqual(field_1.shape, (16,))
+        npt.assert_almost_equal(field_1[0:8], self.tensor_component_data[0])
+        npt.assert_almost_equal(field_1[8:16], self.tensor_component_data[1])
+        all_fields = self.vol_file.get_tensor_components_array(
+            observation_id=obs_id, tensor_components=["field_2", "field_1"]
+        )
+        self.assertEqual(all_fields.shape, (2, 16))
+        self.assertEqual(all_fields.dtype, np.float64)
+        npt.assert_almost_equal(all_fields[1], field_1)
+        npt.assert_almost_equal(
+            all_fields[0][0:8], self.tensor_component_data[1]
+        )
+        self.assertEqual(
+            self.vol_file.get_tensor_components_array(obs_id, []).shape,
+            (0, 0),
+        )
+
     def test_get_data_by_element(self):
         obs_id = 0
         volume_data = self.vol_file.get_data_by_element(None, None, None)
@@ -56,4 +56,8 @@ SPECTRE_TEST_CASE("Unit.IO.Importers.Tags", "[Unit][IO]") {
       std::get<importers::ObservationSelector>(
           TestHelpers::test_option_tag<importers::OptionTags::ObservationValue>(
               "Last")) == importers::ObservationSelector::Last);
+  CHECK(
+      std::get<importers::ObservationSelector>(
+          TestHelpers::test_option_tag<importers::OptionTags::ObservationValue>(
+              "All")) == importers::ObservationSelector::All);
 }
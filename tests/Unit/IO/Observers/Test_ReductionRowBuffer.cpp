@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/ReductionRowBuffer.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/WriterThread.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+Matrix read_rows(const std::string& file_name, const std::string& subfile) {
+  const h5::H5File<h5::AccessType::ReadOnly> file(file_name);
+  return file.get<h5::Dat>(subfile).get_data();
+}
+
+void test_buffer(const std::string& file_name) {
+  Parallel::NodeLock file_lock{};
+  observers::ReductionRowBuffer buffer{};
+  const std::vector<std::string> legend{"Time", "Value"};
+
+  for (size_t i = 0; i < 2; ++i) {
+    CHECK_FALSE(buffer
+                    .append(&file_lock, file_name, "/A", "", legend,
+                            {static_cast<double>(i), 1.0}, 3)
+                    .has_value());
+  }
+  CHECK_FALSE(buffer.append(&file_lock, file_name, "/B", "", legend,
+                            {0.0, 2.0}, 3)
+                  .has_value());
+  CHECK(buffer.size() == 3);
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+
+  // The third row of "/A" writes all rows of "/A"
+  const auto write_a =
+      buffer.append(&file_lock, file_name, "/A", "", legend, {2.0, 1.0}, 3);
+  REQUIRE(write_a.has_value());
+  CHECK(buffer.size() == 1);
+  (*write_a)();
+  const Matrix rows_a = read_rows(file_name, "/A");
+  CHECK(rows_a.rows() == 3);
+  CHECK(rows_a(0, 0) == 0.0);
+  CHECK(rows_a(1, 0) == 1.0);
+  CHECK(rows_a(2, 0) == 2.0);
+  CHECK(rows_a(2, 1) == 1.0);
+
+  // A new legend writes the rows buffered with the old one first
+  const auto write_b = buffer.append(&file_lock, file_name, "/B", "",
+                                     {"Time", "Value", "Other"},
+                                     {1.0, 2.0, 3.0}, 3);
+  REQUIRE(write_b.has_value());
+  CHECK(buffer.size() == 1);
+  (*write_b)();
+  CHECK(read_rows(file_name, "/B").rows() == 1);
+
+  CHECK(buffer.take_all().size() == 1);
+  CHECK(buffer.size() == 0);
+  CHECK(buffer.take_all().empty());
+}
+
+void test_flush(const std::string& file_name) {
+  Parallel::NodeLock file_lock{};
+  CHECK_FALSE(observers::reduction_row_buffer()
+                  .append(&file_lock, file_name, "/C", "", {"Time"}, {1.0}, 10)
+                  .has_value());
+  CHECK(observers::reduction_row_buffer().size() == 1);
+  Parallel::writer_thread().wait();
+  CHECK(observers::reduction_row_buffer().size() == 0);
+  CHECK(read_rows(file_name, "/C").rows() == 1);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionRowBuffer",
+                  "[Unit][Observers]") {
+  const std::string file_name = "Unit.IO.Observers.ReductionRowBuffer.h5";
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  test_buffer(file_name);
+  test_flush(file_name);
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
@@ -0,0 +1,85 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Framework/TestCreation.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/Observer/Staging.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace {
+void test_output_backend() {
+  CHECK(get_output(observers::OutputBackend::H5) == "H5");
+  CHECK(get_output(observers::OutputBackend::Staging) == "Staging");
+  CHECK(TestHelpers::test_creation<observers::OutputBackend>("H5") ==
+        observers::OutputBackend::H5);
+  CHECK(TestHelpers::test_creation<observers::OutputBackend>("Staging") ==
+        observers::OutputBackend::Staging);
+  CHECK(TestHelpers::test_option_tag<observers::OptionTags::OutputBackend>(
+            "Staging") == observers::OutputBackend::Staging);
+}
+
+void test_staging_area() {
+  observers::StagingArea staging{};
+  // Nothing happens without consumers
+  staging.publish_reduction_row("/Norms", {"Time"}, {1.0});
+
+  std::vector<std::string> received{};
+  staging.add_volume_consumer(
+      [&received](const std::string& subfile_name, const size_t observation_id,
+                  const double observation_value,
+                  const std::vector<ElementVolumeData>& volume_data) {
+        CHECK(observation_id == 3);
+        CHECK(observation_value == 1.5);
+        REQUIRE(volume_data.size() == 1);
+        CHECK(volume_data[0].element_name == "[B0,(L0I0)]");
+        received.push_back("first " + subfile_name);
+      });
+  staging.add_volume_consumer(
+      [&received](const std::string& subfile_name, const size_t /*id*/,
+                  const double /*value*/,
+                  const std::vector<ElementVolumeData>& /*volume_data*/) {
+        received.push_back("second " + subfile_name);
+      });
+  staging.add_reduction_consumer([&received](
+                                     const std::string& subfile_name,
+                                     const std::vector<std::string>& legend,
+                                     const std::vector<double>& row) {
+    CHECK(legend == std::vector<std::string>{"Time", "Error"});
+    CHECK(row == std::vector<double>{2.0, 0.5});
+    received.push_back("reduction " + subfile_name);
+  });
+
+  const std::vector<ElementVolumeData> volume_data{ElementVolumeData{
+      "[B0,(L0I0)]",
+      {TensorComponent{"U", DataVector{1.0, 2.0}}},
+      {2},
+      {Spectral::Basis::Legendre},
+      {Spectral::Quadrature::GaussLobatto}}};
+  staging.publish_volume_data("/VolumeData", 3, 1.5, volume_data);
+  staging.publish_reduction_row("/Errors", {"Time", "Error"}, {2.0, 0.5});
+  CHECK(received == std::vector<std::string>{"first /VolumeData",
+                                             "second /VolumeData",
+                                             "reduction /Errors"});
+
+  staging.clear();
+  staging.publish_volume_data("/VolumeData", 3, 1.5, volume_data);
+  CHECK(received.size() == 3);
+
+  CHECK(&observers::staging_area() == &observers::staging_area());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.Staging", "[Unit][Observers]") {
+  test_output_backend();
+  test_staging_area();
+}
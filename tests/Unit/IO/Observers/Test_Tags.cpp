@@ -38,6 +38,13 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
   TestHelpers::db::test_simple_tag<SurfaceFileName>("SurfaceFileName");
+  TestHelpers::db::test_simple_tag<VolumeCompression>("VolumeCompression");
+  TestHelpers::db::test_simple_tag<MaxPendingWrites>("MaxPendingWrites");
+  TestHelpers::db::test_simple_tag<BufferedReductionRows>(
+      "BufferedReductionRows");
+  TestHelpers::db::test_simple_tag<OutputBackend>("OutputBackend");
+  TestHelpers::db::test_simple_tag<WriteVolumeConnectivity>(
+      "WriteVolumeConnectivity");
   static_assert(
       std::is_same_v<typename ReductionData<double, int, char>::names_tag,
                      ReductionDataNames<double, int, char>>,
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -280,6 +281,39 @@ void test_error_messages() {
       ([&directory]() { const io::ComposeTable compose_table(directory); })(),
       Catch::Matchers::ContainsSubstring("eos.table' does not exist."));
   file_system::rm(directory, true);
+
+  const auto write_truncated_table = [&directory](const size_t rows,
+                                                  const size_t columns) {
+    std::ifstream full_table(unit_test_src_path() + "/IO/eos.table");
+    std::ofstream truncated_table(directory + "/eos.table");
+    std::string line{};
+    for (size_t i = 0; i < rows and std::getline(full_table, line); ++i) {
+      std::stringstream row(line);
+      std::string value{};
+      for (size_t j = 0; j < columns and row >> value; ++j) {
+        truncated_table << " " << value;
+      }
+      truncated_table << "\n";
+    }
+  };
+  file_system::create_directory(directory);
+  file_system::copy(unit_test_src_path() + "/IO/eos.quantities", directory);
+  file_system::copy(unit_test_src_path() + "/IO/eos.parameters", directory);
+  write_truncated_table(2, 100);
+  CHECK_THROWS_WITH(
+      ([&directory]() { const io::ComposeTable compose_table(directory); })(),
+      Catch::Matchers::ContainsSubstring("eos.table' ends after 2 of"));
+  file_system::rm(directory, true);
+
+  file_system::create_directory(directory);
+  file_system::copy(unit_test_src_path() + "/IO/eos.quantities", directory);
+  file_system::copy(unit_test_src_path() + "/IO/eos.parameters", directory);
+  write_truncated_table(100, 6);
+  CHECK_THROWS_WITH(
+      ([&directory]() { const io::ComposeTable compose_table(directory); })(),
+      Catch::Matchers::ContainsSubstring(
+          "Could not read all values from row 0"));
+  file_system::rm(directory, true);
 }
 }  // namespace
 
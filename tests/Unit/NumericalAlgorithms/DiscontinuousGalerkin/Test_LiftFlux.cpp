@@ -10,6 +10,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/SliceVariables.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
@@ -20,6 +21,7 @@
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/FaceNormal.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -65,4 +67,18 @@ SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.LiftFlux",
 
   CHECK(dg::lift_flux(flux, mesh.extents(1), magnitude_of_face_normal) ==
         expected);
+
+  {
+    INFO("Lift to volume");
+    Variables<tmpl::list<Var>> volume_vars(mesh.number_of_grid_points());
+    get(get<Var>(volume_vars)) =
+        DataVector{1., 2., 3., 4., 5., 6., 7., 8., 9., 10., 11., 12., 13., 14.,
+                   15.};
+    auto expected_volume_vars = volume_vars;
+    add_slice_to_data(make_not_null(&expected_volume_vars), expected,
+                      mesh.extents(), 1, 0);
+    dg::lift_flux_to_volume(make_not_null(&volume_vars), flux, mesh.extents(),
+                            1, 0, magnitude_of_face_normal);
+    CHECK_VARIABLES_APPROX(volume_vars, expected_volume_vars);
+  }
 }
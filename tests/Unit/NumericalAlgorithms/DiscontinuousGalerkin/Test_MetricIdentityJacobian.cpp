@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/AffineTransformation.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
@@ -181,6 +182,70 @@ void test(const Mesh<Dim>& mesh) {
     }
   }
 }
+
+template <size_t Dim>
+void test_affine_grid_to_inertial(const Mesh<Dim>& mesh) {
+  CAPTURE(Dim);
+  CAPTURE(mesh);
+  std::uniform_real_distribution<double> dist(-1.0, 2.3);
+  MAKE_GENERATOR(gen);
+  const size_t num_points = mesh.number_of_grid_points();
+  const DataVector used_for_size(num_points);
+  const auto grid_coords =
+      make_with_random_values<tnsr::I<DataVector, Dim, Frame::Grid>>(
+          make_not_null(&gen), make_not_null(&dist), used_for_size);
+  const auto grid_jacobian = make_with_random_values<
+      Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>>(
+      make_not_null(&gen), make_not_null(&dist), used_for_size);
+
+  // A rotation combined with an anisotropic expansion
+  domain::CoordinateMaps::AffineTransformation<Dim> grid_to_inertial{};
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      gsl::at(gsl::at(grid_to_inertial.matrix, i), j) =
+          i == j ? 1.1 + 0.2 * static_cast<double>(i)
+                 : 0.3 - 0.1 * static_cast<double>(i + 2 * j);
+    }
+  }
+
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{num_points, 0.0};
+  Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      inertial_jacobian{num_points, 0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t k = 0; k < Dim; ++k) {
+      const double matrix_ik = gsl::at(gsl::at(grid_to_inertial.matrix, i), k);
+      inertial_coords.get(i) += matrix_ik * grid_coords.get(k);
+      for (size_t j_hat = 0; j_hat < Dim; ++j_hat) {
+        inertial_jacobian.get(i, j_hat) +=
+            matrix_ik * grid_jacobian.get(k, j_hat);
+      }
+    }
+  }
+
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>
+      grid_result{};
+  dg::metric_identity_det_jac_times_inv_jac(make_not_null(&grid_result), mesh,
+                                            grid_coords, grid_jacobian);
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      transformed_result{};
+  dg::metric_identity_det_jac_times_inv_jac(make_not_null(&transformed_result),
+                                            grid_result, grid_to_inertial);
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      expected_result{};
+  dg::metric_identity_det_jac_times_inv_jac(make_not_null(&expected_result),
+                                            mesh, inertial_coords,
+                                            inertial_jacobian);
+
+  Approx local_approx = Approx::custom().epsilon(1.0e-11).scale(1.);
+  for (size_t i = 0; i < Dim; ++i) {
+    CAPTURE(i);
+    for (size_t j = 0; j < Dim; ++j) {
+      CAPTURE(j);
+      CHECK_ITERABLE_CUSTOM_APPROX(transformed_result.get(i, j),
+                                   expected_result.get(i, j), local_approx);
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DG.MetricIdentityJacobian",
@@ -196,4 +261,11 @@ SPECTRE_TEST_CASE("Unit.DG.MetricIdentityJacobian",
   test(Mesh<3>{5, Spectral::Basis::Legendre,
                Spectral::Quadrature::GaussLobatto});
   test(Mesh<3>{5, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
+
+  test_affine_grid_to_inertial(Mesh<1>{
+      5, Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto});
+  test_affine_grid_to_inertial(Mesh<2>{
+      5, Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto});
+  test_affine_grid_to_inertial(
+      Mesh<3>{5, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
 }
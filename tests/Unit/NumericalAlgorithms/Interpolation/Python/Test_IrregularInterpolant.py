@@ -60,6 +60,16 @@ class TestIrregular(unittest.TestCase):
                     )
                     npt.assert_allclose(interpolated_data, target_data, 1e-14)
 
+                    # Interpolate several components at once
+                    interpolated_data = interpolant.interpolate(
+                        np.array([source_data, 2.0 * source_data])
+                    )
+                    npt.assert_allclose(
+                        interpolated_data,
+                        [target_data, 2.0 * target_data],
+                        1e-14,
+                    )
+
 
 if __name__ == "__main__":
     unittest.main(verbosity=2)
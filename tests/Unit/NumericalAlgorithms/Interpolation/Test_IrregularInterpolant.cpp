@@ -118,7 +118,8 @@ struct SymmetricTensor : db::SimpleTag {
 }  // namespace TestTags
 
 template <size_t Dim>
-void test_interpolate_to_points(const Mesh<Dim>& mesh) {
+void test_interpolate_to_points(const Mesh<Dim>& mesh,
+                                const size_t number_of_points) {
   // Fill target interpolation coordinates with random values
   MAKE_GENERATOR(generator);
   std::uniform_real_distribution<> dist(inertial_coord_min, inertial_coord_max);
@@ -126,7 +127,6 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) {
   const auto nn_generator = make_not_null(&generator);
   const auto nn_dist = make_not_null(&dist);
 
-  const size_t number_of_points = 6;
   const auto target_x_inertial =
       make_with_random_values<tnsr::I<DataVector, Dim>>(
           nn_generator, nn_dist, DataVector(number_of_points));
@@ -151,6 +151,12 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) {
   // Set up interpolator. Need do this only once.
   const intrp::Irregular<Dim> irregular_interpolant(mesh, target_x);
   test_serialization(irregular_interpolant);
+  CHECK(irregular_interpolant !=
+        intrp::Irregular<Dim>(
+            mesh, tnsr::I<DataVector, Dim, Frame::ElementLogical>(
+                      intrp::Irregular<Dim>::max_points_for_direct_evaluation +
+                          number_of_points,
+                      0.0)));
 
   // ... but we construct another interpolator to test operator!=
   {
@@ -207,9 +213,31 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) {
         get<0>(get<TestTags::Vector<Dim>>(src_vars)));
     CHECK_ITERABLE_APPROX(
         result_dv, get<0>(get<TestTags::Vector<Dim>>(expected_dest_vars)));
+
+    // All components at once, stored one after the other
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    const DataVector src_components{const_cast<double*>(src_vars.data()),
+                                    src_vars.size()};
+    const DataVector expected_components{
+        const_cast<double*>(dest_vars.data()), dest_vars.size()};
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+    DataVector result_components{};
+    irregular_interpolant.interpolate(
+        make_not_null(&result_components), src_components,
+        src_vars.number_of_independent_components);
+    CHECK_ITERABLE_APPROX(result_components, expected_components);
   }
 }
 
+// Enough points that the interpolation matrix is built or few enough that it
+// is not.
+template <size_t Dim>
+void test_interpolate_to_points(const Mesh<Dim>& mesh) {
+  test_interpolate_to_points(mesh, 6);
+  test_interpolate_to_points(
+      mesh, intrp::Irregular<Dim>::max_points_for_direct_evaluation + 3);
+}
+
 template <Spectral::Basis Basis, Spectral::Quadrature Quadrature>
 void test_irregular_interpolant() {
   const size_t start_points = 4;
@@ -314,8 +342,8 @@ Variables<var_tags> polynomial(
 }
 
 template <size_t Dim, size_t MaxDegree>
-void test_polynomial_interpolant(const std::array<size_t, Dim>& extents) {
-  const size_t n_random_target_points = 10;
+void test_polynomial_interpolant(const std::array<size_t, Dim>& extents,
+                                 const size_t n_random_target_points) {
 
   const auto domain = create_domain<Dim>(20.0 / 3.0, extents);
   const auto& block = domain.blocks()[0];
@@ -393,13 +421,15 @@ SPECTRE_TEST_CASE("Unit.Numerical.Interpolation.IrregularInterpolant",
   test_irregular_interpolant<Spectral::Basis::Legendre,
                              Spectral::Quadrature::Gauss>();
   test_irregular_interpolant_mixed_quadrature();
-  test_polynomial_interpolant<1, 1>({{11}});
-  test_polynomial_interpolant<2, 1>({{11, 11}});
-  test_polynomial_interpolant<2, 1>({{11, 9}});
-  test_polynomial_interpolant<3, 1>({{11, 11, 11}});
-  test_polynomial_interpolant<3, 1>({{11, 9, 11}});
-  test_polynomial_interpolant<3, 1>({{11, 11, 9}});
-  test_polynomial_interpolant<3, 1>({{11, 9, 9}});
-  test_polynomial_interpolant<3, 1>({{11, 9, 13}});
+  for (const size_t n_points : {10_st, 50_st}) {
+    test_polynomial_interpolant<1, 1>({{11}}, n_points);
+    test_polynomial_interpolant<2, 1>({{11, 11}}, n_points);
+    test_polynomial_interpolant<2, 1>({{11, 9}}, n_points);
+    test_polynomial_interpolant<3, 1>({{11, 11, 11}}, n_points);
+    test_polynomial_interpolant<3, 1>({{11, 9, 11}}, n_points);
+    test_polynomial_interpolant<3, 1>({{11, 11, 9}}, n_points);
+    test_polynomial_interpolant<3, 1>({{11, 9, 9}}, n_points);
+    test_polynomial_interpolant<3, 1>({{11, 9, 13}}, n_points);
+  }
   test_tov();
 }
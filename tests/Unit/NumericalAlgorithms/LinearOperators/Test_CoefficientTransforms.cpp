@@ -162,6 +162,28 @@ void test_3d(const gsl::not_null<Generator*> generator) {
       mesh,
       {{{order, order - 1, order - 2}}, {{order / 3, order / 3, order / 3}}});
 }
+
+// Meshes with many points are transformed with an even-odd decomposition in
+// the dimensions that hold enough points, so test them explicitly
+template <Spectral::Basis Basis, Spectral::Quadrature Quadrature>
+void test_parity_split() {
+  constexpr size_t max_points = Spectral::maximum_number_of_points<Basis>;
+  for (const size_t num_points : {max_points - 1, max_points}) {
+    CAPTURE(num_points);
+    const size_t order = num_points - 1;
+    check_transforms<ModalVector, DataVector, Basis, Quadrature>(
+        Mesh<1>{num_points, Basis, Quadrature},
+        {{{order}}, {{order - 1}}, {{order / 2}}});
+    check_transforms<ModalVector, DataVector, Basis, Quadrature>(
+        Mesh<2>{{{num_points, 3}}, Basis, Quadrature},
+        {{{order, 2}}, {{order - 1, 1}}, {{0, 0}}});
+    check_transforms<ModalVector, DataVector, Basis, Quadrature>(
+        Mesh<3>{{{4, num_points, max_points - 1}}, Basis, Quadrature},
+        {{{3, order, order - 1}},
+         {{0, order - 1, 1}},
+         {{2, 1, max_points - 2}}});
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.CoefficientTransforms",
@@ -218,4 +240,11 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.CoefficientTransforms",
           Spectral::Quadrature::GaussLobatto>(make_not_null(&generator));
   test_3d<ComplexModalVector, ComplexDataVector, Spectral::Basis::Chebyshev,
           Spectral::Quadrature::Gauss>(make_not_null(&generator));
+
+  test_parity_split<Spectral::Basis::Legendre,
+                    Spectral::Quadrature::GaussLobatto>();
+  test_parity_split<Spectral::Basis::Legendre, Spectral::Quadrature::Gauss>();
+  test_parity_split<Spectral::Basis::Chebyshev,
+                    Spectral::Quadrature::GaussLobatto>();
+  test_parity_split<Spectral::Basis::Chebyshev, Spectral::Quadrature::Gauss>();
 }
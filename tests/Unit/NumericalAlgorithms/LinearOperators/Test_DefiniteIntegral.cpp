@@ -14,6 +14,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 
 namespace {
@@ -105,6 +106,35 @@ void test_definite_integral_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+template <size_t Dim>
+void test_definite_integrals(const Mesh<Dim>& mesh) {
+  const size_t num_points = mesh.number_of_grid_points();
+  const size_t num_integrands = 3;
+  DataVector integrands(num_integrands * num_points);
+  DataVector det_jacobian(num_points);
+  for (size_t s = 0; s < num_points; ++s) {
+    const auto x = static_cast<double>(s);
+    det_jacobian[s] = 1.5 + 0.1 * x;
+    for (size_t n = 0; n < num_integrands; ++n) {
+      integrands[s + n * num_points] =
+          static_cast<double>(n) + 0.5 * x - 0.01 * x * x;
+    }
+  }
+  DataVector integrals{};
+  DataVector jacobian_integrals{};
+  definite_integrals(make_not_null(&integrals), integrands, mesh);
+  definite_integrals(make_not_null(&jacobian_integrals), integrands, mesh,
+                     det_jacobian);
+  REQUIRE(integrals.size() == num_integrands);
+  REQUIRE(jacobian_integrals.size() == num_integrands);
+  for (size_t n = 0; n < num_integrands; ++n) {
+    const DataVector integrand(integrands.data() + n * num_points, num_points);
+    CHECK(integrals[n] == approx(definite_integral(integrand, mesh)));
+    CHECK(jacobian_integrals[n] ==
+          approx(definite_integral(integrand * det_jacobian, mesh)));
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.DefiniteIntegral",
@@ -137,6 +167,19 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.DefiniteIntegral",
     }
   }
 
+  test_definite_integrals(Mesh<0>{});
+  test_definite_integrals(Mesh<1>{5, Spectral::Basis::Legendre,
+                                  Spectral::Quadrature::GaussLobatto});
+  test_definite_integrals(Mesh<2>{{{3, 4}},
+                                  Spectral::Basis::Legendre,
+                                  Spectral::Quadrature::Gauss});
+  test_definite_integrals(Mesh<3>{{{3, 4, 5}},
+                                  Spectral::Basis::Legendre,
+                                  Spectral::Quadrature::GaussLobatto});
+  test_definite_integrals(Mesh<2>{{{4, 6}},
+                                  Spectral::Basis::FiniteDifference,
+                                  Spectral::Quadrature::CellCentered});
+
   // Test finite difference integral
   constexpr size_t min_extents_fd =
       Spectral::minimum_number_of_points<Spectral::Basis::FiniteDifference,
@@ -202,6 +202,24 @@ void test_mean_value_on_boundary_1d() {
                                                 Side::Lower)));
   }
 }
+
+void test_mean_values() {
+  const Mesh<2> mesh{{{3, 4}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const size_t num_points = mesh.number_of_grid_points();
+  DataVector f(2 * num_points);
+  for (size_t s = 0; s < num_points; ++s) {
+    f[s] = 2.0 + static_cast<double>(s);
+    f[s + num_points] = -1.0;
+  }
+  DataVector means{};
+  mean_values(make_not_null(&means), f, mesh);
+  REQUIRE(means.size() == 2);
+  CHECK(means[0] ==
+        approx(mean_value(DataVector(f.data(), num_points), mesh)));
+  CHECK(means[1] == approx(-1.0));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.MeanValue",
@@ -209,4 +227,5 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.MeanValue",
   SECTION("Mean Value") { test_mean_value(); }
   SECTION("Mean Value on Boundary") { test_mean_value_on_boundary(); }
   SECTION("Mean Value on Boundary 1d") { test_mean_value_on_boundary_1d(); }
+  SECTION("Mean Values") { test_mean_values(); }
 }
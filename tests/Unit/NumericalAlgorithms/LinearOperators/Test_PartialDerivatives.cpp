@@ -11,6 +11,7 @@
 #include <string>
 #include <type_traits>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"  // IWYU pragma: keep
@@ -38,6 +39,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/System/TaskPool.hpp"
 #include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tags::deriv
@@ -372,6 +374,11 @@ void test_partial_derivatives_1d(const Mesh<1>& mesh) {
                         logical_partial_derivatives<GradientTags>(u, mesh),
                         inverse_jacobian);
     helper(du_with_logical);
+    helper(fused_partial_derivatives<GradientTags>(u, mesh, inverse_jacobian));
+    vars_type fused_du{};
+    fused_partial_derivatives(make_not_null(&fused_du), u, mesh,
+                              inverse_jacobian);
+    helper(fused_du);
 
     // We've checked that du is correct, now test that taking derivatives of
     // individual tensors gets the matching result.
@@ -425,6 +432,12 @@ void test_partial_derivatives_2d(const Mesh<2>& mesh) {
                           logical_partial_derivatives<GradientTags>(u, mesh),
                           inverse_jacobian);
       helper(du_with_logical);
+      helper(
+          fused_partial_derivatives<GradientTags>(u, mesh, inverse_jacobian));
+      vars_type fused_du{};
+      fused_partial_derivatives(make_not_null(&fused_du), u, mesh,
+                                inverse_jacobian);
+      helper(fused_du);
 
       // We've checked that du is correct, now test that taking derivatives of
       // individual tensors gets the matching result.
@@ -482,6 +495,12 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
                             logical_partial_derivatives<GradientTags>(u, mesh),
                             inverse_jacobian);
         helper(du_with_logical);
+        helper(fused_partial_derivatives<GradientTags>(u, mesh,
+                                                       inverse_jacobian));
+        vars_type fused_du{};
+        fused_partial_derivatives(make_not_null(&fused_du), u, mesh,
+                                  inverse_jacobian);
+        helper(fused_du);
 
         // We've checked that du is correct, now test that taking derivatives of
         // individual tensors gets the matching result.
@@ -543,6 +562,21 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs",
                         Spectral::Quadrature::GaussLobatto};
   test_partial_derivatives_3d<two_vars<3>>(mesh_3d);
   test_partial_derivatives_3d<two_vars<3>, one_var<3>>(mesh_3d);
+  {
+    INFO("Split into tasks");
+    const size_t max_chunks = sys::task_pool().max_chunks();
+    sys::task_pool().set_max_chunks(4);
+    test_partial_derivatives_3d<two_vars<3>>(mesh_3d);
+    sys::task_pool().set_max_chunks(max_chunks);
+  }
+  // This mesh is too large for the specialized kernels used by
+  // fused_partial_derivatives, so it tests the fallback.
+  const Mesh<1> large_mesh_1d{
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>,
+      Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto};
+  static_assert(Spectral::maximum_number_of_points<Spectral::Basis::Legendre> >
+                apply_matrices_detail::max_extent_for_small_kernels);
+  test_partial_derivatives_1d<two_vars<1>>(large_mesh_1d);
 
   TestHelpers::db::test_prefix_tag<
       Tags::deriv<Var1<3>, tmpl::size_t<3>, Frame::Grid>>("deriv(Var1)");
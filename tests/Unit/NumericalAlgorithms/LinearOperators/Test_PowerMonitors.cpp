@@ -11,8 +11,10 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Framework/TestCreation.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
@@ -156,6 +158,30 @@ void test_relative_truncation_error_impl() {
   CHECK_ITERABLE_APPROX(test_truncation_error, expected_truncation_error_x);
 }
 
+void test_power_monitors_overloads() {
+  const Mesh<2_st> mesh{{{4, 5}},
+                        Spectral::Basis::Legendre,
+                        Spectral::Quadrature::GaussLobatto};
+  const auto logical_coords = logical_coordinates(mesh);
+  const DataVector u_nodal =
+      exp(get<0>(logical_coords)) * cos(get<1>(logical_coords));
+  const auto expected_power_monitors =
+      PowerMonitors::power_monitors<2_st>(u_nodal, mesh);
+
+  // The buffers are resized as needed
+  std::array<DataVector, 2> power_monitors{};
+  ModalVector modal_coefficients_buffer(2_st);
+  PowerMonitors::power_monitors(make_not_null(&power_monitors),
+                                make_not_null(&modal_coefficients_buffer),
+                                u_nodal, mesh);
+  CHECK_ITERABLE_APPROX(power_monitors, expected_power_monitors);
+  CHECK(modal_coefficients_buffer == to_modal_coefficients(u_nodal, mesh));
+
+  PowerMonitors::power_monitors(make_not_null(&power_monitors),
+                                modal_coefficients_buffer, mesh);
+  CHECK_ITERABLE_APPROX(power_monitors, expected_power_monitors);
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PowerMonitors",
@@ -163,4 +189,5 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PowerMonitors",
   test_power_monitors_impl();
   test_power_monitors_second_impl();
   test_relative_truncation_error_impl();
+  test_power_monitors_overloads();
 }
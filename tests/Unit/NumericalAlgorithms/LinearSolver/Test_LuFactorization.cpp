@@ -0,0 +1,157 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <functional>
+#include <utility>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/NumericalAlgorithms/LinearSolver/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearSolver/LuFactorization.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
+#include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace helpers = TestHelpers::LinearSolver;
+
+namespace {
+struct ScalarFieldTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+}  // namespace
+
+namespace LinearSolver::Serial {
+
+SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.LuFactorization",
+                  "[Unit][NumericalAlgorithms][LinearSolver]") {
+  {
+    INFO("Solve a simple matrix");
+    // The first column has a zero on the diagonal, so this needs pivoting
+    const blaze::DynamicMatrix<double> matrix{{0., 1.}, {3., 1.}};
+    const helpers::ApplyMatrix linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2.};
+    const blaze::DynamicVector<double> expected_solution{1. / 3., 1.};
+    blaze::DynamicVector<double> solution(2);
+    const LuFactorization<> solver{};
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK(solver.size() == 2);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+    {
+      INFO("Serialization");
+      // The factorization is serialized, so the deserialized solver keeps
+      // applying it even when solving a different operator
+      const auto deserialized_solver = serialize_and_deserialize(solver);
+      const helpers::ApplyMatrix other_linear_operator{
+          blaze::DynamicMatrix<double>{{1., 0.}, {0., 1.}}};
+      blaze::DynamicVector<double> deserialized_solution(2);
+      deserialized_solver.solve(make_not_null(&deserialized_solution),
+                                other_linear_operator, source);
+      CHECK_ITERABLE_APPROX(deserialized_solution, expected_solution);
+    }
+    {
+      INFO("Resetting");
+      LuFactorization<> resetting_solver{};
+      resetting_solver.solve(make_not_null(&solution), linear_operator, source);
+      // Solving a different operator after resetting should work
+      resetting_solver.reset();
+      const blaze::DynamicMatrix<double> matrix2{{4., 1.}, {1., 3.}};
+      const helpers::ApplyMatrix linear_operator2{matrix2};
+      const blaze::DynamicVector<double> expected_solution2{0.0909090909090909,
+                                                            0.6363636363636364};
+      resetting_solver.solve(make_not_null(&solution), linear_operator2,
+                             source);
+      CHECK_ITERABLE_APPROX(solution, expected_solution2);
+      // Without resetting, the solver should keep applying the cached
+      // factorization even when solving a different operator
+      solver.solve(make_not_null(&solution), linear_operator2, source);
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+    }
+  }
+  {
+    INFO("Single precision");
+    const blaze::DynamicMatrix<double> matrix{{4., 1.}, {1., 3.}};
+    const helpers::ApplyMatrix linear_operator{matrix};
+    const blaze::DynamicVector<double> source{1., 2.};
+    const blaze::DynamicVector<double> expected_solution{0.0909090909090909,
+                                                         0.6363636363636364};
+    blaze::DynamicVector<double> solution(2);
+    const LuFactorization<> solver{true};
+    CHECK(solver.single_precision());
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    Approx single_precision_approx = Approx::custom().epsilon(1.e-6).scale(1.);
+    CHECK_ITERABLE_CUSTOM_APPROX(solution, expected_solution,
+                                 single_precision_approx);
+    const auto deserialized_solver = serialize_and_deserialize(solver);
+    CHECK(deserialized_solver.single_precision());
+    blaze::DynamicVector<double> deserialized_solution(2);
+    deserialized_solver.solve(make_not_null(&deserialized_solution),
+                              linear_operator, source);
+    CHECK(deserialized_solution == solution);
+    CHECK(TestHelpers::test_creation<LuFactorization<>>(
+              "SinglePrecision: True")
+              .single_precision());
+  }
+  {
+    INFO("Solve a heterogeneous data structure");
+    using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
+        1, tmpl::list<ScalarFieldTag>>;
+
+    const Matrix matrix_element{{4., 1., 1.}, {1., 1., 3.}, {0., 2., 0.}};
+    const Matrix matrix_overlap{{4., 1.}, {3., 1.}};
+    const ::LinearSolver::Schwarz::OverlapId<1> overlap_id{
+        Direction<1>::lower_xi(), ElementId<1>{0}};
+    const std::array<std::reference_wrapper<const Matrix>, 1> matrices_element{
+        matrix_element};
+    const std::array<std::reference_wrapper<const Matrix>, 1> matrices_overlap{
+        matrix_overlap};
+    const auto linear_operator = [&matrices_element, &matrices_overlap,
+                                  &overlap_id](
+                                     const gsl::not_null<SubdomainData*> result,
+                                     const SubdomainData& operand) {
+      apply_matrices(make_not_null(&result->element_data), matrices_element,
+                     operand.element_data, Index<1>{3});
+      apply_matrices(make_not_null(&result->overlap_data.at(overlap_id)),
+                     matrices_overlap, operand.overlap_data.at(overlap_id),
+                     Index<1>{2});
+    };
+
+    SubdomainData source{3};
+    get(get<ScalarFieldTag>(source.element_data)) = DataVector{1., 2., 1.};
+    source.overlap_data.emplace(overlap_id,
+                                typename SubdomainData::OverlapData{2});
+    get(get<ScalarFieldTag>(source.overlap_data.at(overlap_id))) =
+        DataVector{1., 2.};
+    auto expected_solution = make_with_value<SubdomainData>(source, 0.);
+    get(get<ScalarFieldTag>(expected_solution.element_data)) =
+        DataVector{0., 0.5, 0.5};
+    get(get<ScalarFieldTag>(expected_solution.overlap_data.at(overlap_id))) =
+        DataVector{-1., 5.};
+
+    const LuFactorization<> solver{};
+    auto solution = make_with_value<SubdomainData>(source, 0.);
+    solver.solve(make_not_null(&solution), linear_operator, source);
+    CHECK(solver.size() == 5);
+    CHECK_VARIABLES_APPROX(solution.element_data,
+                           expected_solution.element_data);
+    CHECK_VARIABLES_APPROX(solution.overlap_data.at(overlap_id),
+                           expected_solution.overlap_data.at(overlap_id));
+  }
+}
+
+}  // namespace LinearSolver::Serial
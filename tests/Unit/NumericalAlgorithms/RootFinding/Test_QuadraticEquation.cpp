@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <limits>
 
 #include "DataStructures/DataVector.hpp"
@@ -74,6 +75,34 @@ void test_largest_root_between_values_within_roundoff(const T& used_for_size) {
       6.0 * (1.0 - std::numeric_limits<double>::epsilon() * 10.0));
   CHECK_ITERABLE_APPROX(expected_root_2, root);
 }
+
+void test_data_vector_roots_match_double_roots() {
+  // Roots on both sides of the bounds, and a point with b = 0, which the
+  // vectorized implementation handles like gsl_poly_solve_quadratic.
+  DataVector a{2.0, 1.0, 1.0e-3, 3.0, 1.0, -2.0};
+  DataVector b{-11.0, -3.0, 1.0, 0.0, 1.0e-6, 7.0};
+  DataVector c{5.0, 1.5, -0.5, -12.0, -0.25, -3.0};
+  for (const bool with_b_zero : {true, false}) {
+    CAPTURE(with_b_zero);
+    const size_t size = with_b_zero ? a.size() : 3;
+    const DataVector a_used{a.data(), size};
+    const DataVector b_used{b.data(), size};
+    const DataVector c_used{c.data(), size};
+    const DataVector smallest =
+        smallest_root_greater_than_value_within_roundoff(a_used, b_used,
+                                                         c_used, 0.4);
+    const DataVector largest = largest_root_between_values_within_roundoff(
+        a_used, b_used, c_used, -5.0, 2.5);
+    for (size_t i = 0; i < size; ++i) {
+      CAPTURE(i);
+      CHECK(smallest[i] ==
+            approx(smallest_root_greater_than_value_within_roundoff(
+                a[i], b[i], c[i], 0.4)));
+      CHECK(largest[i] == approx(largest_root_between_values_within_roundoff(
+                              a[i], b[i], c[i], -5.0, 2.5)));
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.QuadraticEquation",
@@ -107,6 +136,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.QuadraticEquation",
   test_smallest_root_greater_than_value_within_roundoff(DataVector(5));
   test_largest_root_between_values_within_roundoff<double>(1.0);
   test_largest_root_between_values_within_roundoff(DataVector(5));
+  test_data_vector_roots_match_double_roots();
 
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH(
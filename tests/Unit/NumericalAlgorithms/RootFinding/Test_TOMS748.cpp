@@ -10,6 +10,7 @@
 #include <string>
 
 #include "DataStructures/DataVector.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -121,6 +122,52 @@ void test_datavector() {
   check_root(root_function_values);
 }
 
+void test_lockstep() {
+  // [lockstep_root_find]
+  const double abs_tol = 1e-15;
+  const double rel_tol = 1e-15;
+  const DataVector upper{2.0, 3.0, -sqrt(2.0) + abs_tol, -sqrt(2.0), 2.0};
+  const DataVector lower{sqrt(2.0) - abs_tol, sqrt(2.0), -2.0, -3.0, 0.0};
+
+  const DataVector constant{2.0, 4.0, 2.0, 4.0, 4.0};
+  size_t number_of_calls = 0;
+  const auto f_lambda = [&constant,
+                         &number_of_calls](const DataVector& x) -> DataVector {
+    ++number_of_calls;
+    return constant - square(x);
+  };
+
+  const auto root = RootFinder::toms748(f_lambda, lower, upper, abs_tol,
+                                        rel_tol);
+  // [lockstep_root_find]
+  CHECK_ITERABLE_APPROX(root, (DataVector{sqrt(2.0), 2.0, -sqrt(2.0), -2.0,
+                                          2.0}));
+
+  // The lockstep iteration takes the same steps as the root find point by
+  // point
+  const auto f_pointwise = [&constant](const double x, const size_t i) {
+    return constant[i] - square(x);
+  };
+  CHECK_ITERABLE_APPROX(
+      root, RootFinder::toms748(f_pointwise, lower, upper, abs_tol, rel_tol));
+  // Points converge at different rates, but `f` is evaluated on all of them
+  // at once
+  const size_t calls_with_bounds = number_of_calls;
+  CHECK(calls_with_bounds < 20);
+  CHECK_ITERABLE_APPROX(
+      RootFinder::toms748(f_lambda, lower, upper, f_lambda(lower),
+                          f_lambda(upper), abs_tol, rel_tol),
+      root);
+  CHECK(number_of_calls == 2 * calls_with_bounds);
+
+  CHECK_THROWS_AS(
+      RootFinder::toms748(f_lambda, lower, upper, abs_tol, rel_tol, 2),
+      convergence_error);
+  CHECK_THROWS_WITH(
+      RootFinder::toms748(f_lambda, lower, upper - 1.0, abs_tol, rel_tol),
+      Catch::Matchers::ContainsSubstring("Root not bracketed at index 0"));
+}
+
 void test_convergence_error_double() {
   CHECK_THROWS_AS(
       []() {
@@ -155,6 +202,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.TOMS748",
   test_simple();
   test_bounds();
   test_datavector();
+  test_lockstep();
   test_convergence_error_double();
   test_convergence_error_datavector();
 
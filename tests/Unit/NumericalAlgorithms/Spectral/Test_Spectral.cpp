@@ -531,6 +531,38 @@ void test_double_instantiation() {
       mesh1d, std::vector<double>{interpolation_target});
   CHECK_MATRIX_APPROX(double_matrix, vector_matrix);
 }
+
+void test_beyond_maximum_number_of_points() {
+  INFO("Test more than the maximum number of points.");
+  constexpr size_t max_points =
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+  for (size_t n = max_points + 1; n <= max_points + 4; ++n) {
+    CAPTURE(n);
+    const auto& collocation_pts =
+        Spectral::collocation_points<Spectral::Basis::Legendre,
+                                     Spectral::Quadrature::GaussLobatto>(n);
+    const Matrix& diff_matrix =
+        Spectral::differentiation_matrix<Spectral::Basis::Legendre,
+                                         Spectral::Quadrature::GaussLobatto>(n);
+    CHECK(&diff_matrix ==
+          &Spectral::differentiation_matrix(
+              Mesh<1>{n, Spectral::Basis::Legendre,
+                      Spectral::Quadrature::GaussLobatto}));
+    const size_t p = n - 1;
+    const auto u = unit_polynomial(p, collocation_pts);
+    DataVector numeric_derivative{n};
+    dgemv_('N', n, n, 1., diff_matrix.data(), diff_matrix.spacing(), u.data(),
+           1, 0.0, numeric_derivative.data(), 1);
+    Approx local_approx = Approx::custom().epsilon(1.0e-11).scale(1.0);
+    CHECK_ITERABLE_CUSTOM_APPROX(unit_polynomial_derivative(p, collocation_pts),
+                                 numeric_derivative, local_approx);
+  }
+  const std::string statistics = Spectral::uncapped_cache_statistics();
+  CAPTURE(statistics);
+  CHECK(statistics.find("DifferentiationMatrixGenerator") !=
+        std::string::npos);
+  CHECK(statistics.find("misses: 4") != std::string::npos);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.Spectral",
@@ -543,4 +575,5 @@ SPECTRE_TEST_CASE("Unit.Numerical.Spectral",
   test_spectral_quantities_for_mesh();
   test_gauss_points_boundary_interpolation_and_lifting();
   test_double_instantiation();
+  test_beyond_maximum_number_of_points();
 }
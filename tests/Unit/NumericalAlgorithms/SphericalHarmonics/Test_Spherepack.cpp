@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstddef>
 #include <random>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -765,12 +766,43 @@ void test_ylm_errors() {
           "and Spherepack instance (4)"));
 }
 
+void test_shared_storage() {
+  // Instances with the same resolution share their constant storage
+  const Spherepack ylm(6, 5);
+  const Spherepack same_resolution(6, 5);
+  const Spherepack other_resolution(6, 4);
+  CHECK(&ylm.theta_points() == &same_resolution.theta_points());
+  CHECK(&ylm.theta_points() != &other_resolution.theta_points());
+
+  // Transforms may run concurrently on different threads
+  const DataVector collocation_values =
+      1.0 + cos(ylm.theta_phi_points()[0]) * sin(ylm.theta_phi_points()[1]);
+  const DataVector expected = ylm.phys_to_spec(collocation_values);
+  std::vector<DataVector> results(4);
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&ylm, &collocation_values, &results, i]() {
+      const Spherepack local_ylm(6, 5);
+      for (size_t j = 0; j < 10; ++j) {
+        results[i] = local_ylm.phys_to_spec(collocation_values);
+        results[i] = ylm.phys_to_spec(ylm.spec_to_phys(results[i]));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& result : results) {
+    CHECK_ITERABLE_APPROX(result, expected);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.Spherepack",
                   "[ApparentHorizonFinder][Unit]") {
   test_memory_pool();
   test_ylm_errors();
+  test_shared_storage();
 
   for (size_t l_max = 3; l_max < 5; ++l_max) {
     for (size_t m_max = 2; m_max <= l_max; ++m_max) {
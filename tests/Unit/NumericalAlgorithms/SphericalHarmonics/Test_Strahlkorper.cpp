@@ -18,6 +18,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "Options/ParseOptions.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
@@ -90,6 +91,45 @@ void test_copy_and_move() {
   test_move_semantics(std::move(s), s_copy);
 }
 
+void test_derived_quantities() {
+  Strahlkorper<Frame::Inertial> s(6, 6, 2.0, {{0.1, 0.2, 0.3}});
+  s.coefficients()[SpherepackIterator(6, 6).set(2, 1)()] = 0.3;
+
+  const auto quantities = s.derived_quantities();
+  const auto theta_phi = ylm::theta_phi(s);
+  const auto radius = ylm::radius(s);
+  const auto rhat = ylm::rhat(theta_phi);
+  const auto jacobian = ylm::jacobian(theta_phi);
+  const auto inv_jacobian = ylm::inv_jacobian(theta_phi);
+  const auto dx_radius =
+      ylm::cartesian_derivs_of_scalar(radius, s, radius, inv_jacobian);
+  CHECK_ITERABLE_APPROX(quantities->theta_phi, theta_phi);
+  CHECK_ITERABLE_APPROX(quantities->radius, radius);
+  CHECK_ITERABLE_APPROX(quantities->rhat, rhat);
+  CHECK_ITERABLE_APPROX(quantities->jacobian, jacobian);
+  CHECK_ITERABLE_APPROX(quantities->inv_jacobian, inv_jacobian);
+  CHECK_ITERABLE_APPROX(quantities->cartesian_coords,
+                        ylm::cartesian_coords(s, radius, rhat));
+  CHECK_ITERABLE_APPROX(quantities->dx_radius, dx_radius);
+  CHECK_ITERABLE_APPROX(quantities->normal_one_form,
+                        ylm::normal_one_form(dx_radius, rhat));
+  CHECK_ITERABLE_APPROX(quantities->tangents,
+                        ylm::tangents(s, radius, rhat, jacobian));
+
+  // The quantities are computed once, and shared by copies
+  CHECK(s.derived_quantities() == quantities);
+  const auto s_copy = s;
+  CHECK(s_copy.derived_quantities() == quantities);
+
+  // Modifying the surface invalidates the quantities, but not the pointer
+  s.coefficients()[0] += 0.1;
+  const auto new_quantities = s.derived_quantities();
+  CHECK(new_quantities != quantities);
+  CHECK_ITERABLE_APPROX(new_quantities->radius, ylm::radius(s));
+  CHECK_ITERABLE_APPROX(quantities->radius, radius);
+  CHECK(s_copy.derived_quantities() == quantities);
+}
+
 void test_physical_center() {
   const std::array<double, 3> physical_center = {{1.5, 0.5, 1.0}};
   const std::array<double, 3> expansion_center = {{0.0, 0.0, 0.0}};
@@ -172,6 +212,7 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.Strahlkorper",
                   "[ApparentHorizonFinder][Unit]") {
   test_invert_spec_phys_transform();
   test_copy_and_move();
+  test_derived_quantities();
   test_average_radius();
   test_physical_center();
   test_point_is_contained();
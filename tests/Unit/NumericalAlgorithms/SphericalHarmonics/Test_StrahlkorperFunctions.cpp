@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <deque>
+#include <limits>
 #include <utility>
 
 #include "DataStructures/DataVector.hpp"
@@ -16,6 +17,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace Frame {
@@ -509,6 +511,69 @@ void test_time_deriv_strahlkorper() {
     }
   }
 }
+
+void test_extrapolate_strahlkorper() {
+  const size_t l_max = 2;
+  SpherepackIterator iter{l_max, l_max};
+  // A coefficient that depends quadratically on time
+  const auto strahlkorper_at = [&iter](const double time) {
+    Strahlkorper<Frame::Inertial> strahlkorper{l_max, l_max, 1.0,
+                                               std::array{0.0, 0.0, 0.0}};
+    strahlkorper.coefficients()[iter.set(2, 1)()] =
+        1.3 - 0.4 * time + 0.2 * square(time);
+    return strahlkorper;
+  };
+  std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>
+      previous_strahlkorpers{};
+  for (size_t i = 0; i < 3; ++i) {
+    const double time = static_cast<double>(i);
+    previous_strahlkorpers.emplace_front(time, strahlkorper_at(time));
+  }
+
+  // Three previous Strahlkorpers extrapolate a quadratic exactly
+  auto extrapolated = strahlkorper_at(0.0);
+  ylm::extrapolate_strahlkorper(make_not_null(&extrapolated),
+                                previous_strahlkorpers, 3.5);
+  CHECK_ITERABLE_APPROX(extrapolated.coefficients(),
+                        strahlkorper_at(3.5).coefficients());
+
+  // An initial guess with a NaN time is not used, so only the two most recent
+  // Strahlkorpers are extrapolated linearly.
+  previous_strahlkorpers.back().first =
+      std::numeric_limits<double>::quiet_NaN();
+  ylm::extrapolate_strahlkorper(make_not_null(&extrapolated),
+                                previous_strahlkorpers, 3.0);
+  // The coefficient is 1.3 at t=2 and 1.1 at t=1
+  CHECK(extrapolated.coefficients()[iter.set(2, 1)()] == approx(1.5));
+
+  // With a single valid Strahlkorper nothing changes
+  previous_strahlkorpers.pop_back();
+  previous_strahlkorpers.back().first =
+      std::numeric_limits<double>::quiet_NaN();
+  const auto unchanged = extrapolated;
+  ylm::extrapolate_strahlkorper(make_not_null(&extrapolated),
+                                previous_strahlkorpers, 5.0);
+  CHECK(extrapolated == unchanged);
+
+  // The previous Strahlkorpers are prolonged to the resolution of the
+  // extrapolated one
+  previous_strahlkorpers.clear();
+  for (size_t i = 0; i < 3; ++i) {
+    const double time = static_cast<double>(i);
+    previous_strahlkorpers.emplace_front(time, strahlkorper_at(time));
+  }
+  const size_t higher_l_max = 4;
+  Strahlkorper<Frame::Inertial> prolonged{higher_l_max, higher_l_max, 1.0,
+                                          std::array{0.0, 0.0, 0.0}};
+  ylm::extrapolate_strahlkorper(make_not_null(&prolonged),
+                                previous_strahlkorpers, 3.5);
+  CHECK(prolonged.l_max() == higher_l_max);
+  CHECK_ITERABLE_APPROX(
+      prolonged.coefficients(),
+      (Strahlkorper<Frame::Inertial>{higher_l_max, higher_l_max,
+                                     strahlkorper_at(3.5)}
+           .coefficients()));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.StrahlkorperFunctions",
@@ -521,5 +586,6 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.StrahlkorperFunctions",
   test_fit_ylm_coeffs_same();
   test_fit_ylm_coeffs_diff();
   test_time_deriv_strahlkorper();
+  test_extrapolate_strahlkorper();
 }
 }  // namespace ylm
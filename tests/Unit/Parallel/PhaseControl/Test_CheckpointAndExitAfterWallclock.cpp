@@ -53,6 +53,14 @@ SPECTRE_TEST_CASE("Unit.Parallel.PhaseControl.CheckpointAndExitAfterWallclock",
 
   const PhaseControl::CheckpointAndExitAfterWallclock phase_change0(0.0);
   const PhaseControl::CheckpointAndExitAfterWallclock phase_change1(1.0);
+  {
+    INFO("Test whether a halt is needed");
+    CHECK(phase_change0.needs_synchronization());
+    CHECK(phase_change1.needs_synchronization());
+    const PhaseControl::CheckpointAndExitAfterWallclock phase_change_none(
+        std::nullopt);
+    CHECK_FALSE(phase_change_none.needs_synchronization());
+  }
   {
     INFO("Test initialize phase change decision data");
     PhaseChangeDecisionData phase_change_decision_data{
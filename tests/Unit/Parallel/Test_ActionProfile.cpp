@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ActionProfile.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct ActionA {};
+template <typename T>
+struct ActionB {};
+
+using phase_dependent_action_lists = tmpl::list<
+    Parallel::PhaseActions<Parallel::Phase::Initialization,
+                           tmpl::list<ActionA, ActionB<int>>>,
+    Parallel::PhaseActions<Parallel::Phase::Register, tmpl::list<>>,
+    Parallel::PhaseActions<Parallel::Phase::Evolve,
+                           tmpl::list<ActionB<double>, ActionA, ActionA>>>;
+
+static_assert(Parallel::detail::action_profile_offset(
+                  phase_dependent_action_lists{}, 0) == 0);
+static_assert(Parallel::detail::action_profile_offset(
+                  phase_dependent_action_lists{}, 1) == 2);
+static_assert(Parallel::detail::action_profile_offset(
+                  phase_dependent_action_lists{}, 2) == 2);
+static_assert(Parallel::detail::action_profile_offset(
+                  phase_dependent_action_lists{}, 3) == 5);
+
+SPECTRE_TEST_CASE("Unit.Parallel.ActionProfile", "[Unit][Parallel]") {
+  const std::vector<Parallel::ActionProfile> profiles =
+      Parallel::detail::make_action_profiles(phase_dependent_action_lists{});
+  std::vector<std::string> names{};
+  for (const auto& profile : profiles) {
+    names.push_back(profile.name);
+    CHECK(profile.number_of_invocations == 0);
+    CHECK(profile.total_time == 0.0);
+  }
+  CHECK(names == std::vector<std::string>{
+                     "Initialization/ActionA", "Initialization/ActionB",
+                     "Evolve/ActionB", "Evolve/ActionA", "Evolve/ActionA"});
+  CHECK(Parallel::detail::make_action_profiles(tmpl::list<>{}).empty());
+
+  const Parallel::ActionProfile profile{"Evolve/ActionA", 3, 1.5};
+  CHECK(profile == Parallel::ActionProfile{"Evolve/ActionA", 3, 1.5});
+  CHECK(profile != Parallel::ActionProfile{"Evolve/ActionB", 3, 1.5});
+  CHECK(profile != Parallel::ActionProfile{"Evolve/ActionA", 2, 1.5});
+  CHECK(profile != Parallel::ActionProfile{"Evolve/ActionA", 3, 2.5});
+  CHECK(get_output(profile) == "Evolve/ActionA: 3 invocations, 1.5 s");
+  test_serialization(profile);
+}
+}  // namespace
@@ -3,9 +3,11 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/Matrix.hpp"
 #include "Domain/Structure/Element.hpp"
@@ -25,6 +27,7 @@
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/UpdateMemoryHistory.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Numeric.hpp"
@@ -39,7 +42,9 @@ struct MockMemoryMonitor {
   using array_index = int;
   using component_being_mocked = mem_monitor::MemoryMonitor<Metavariables>;
   using metavariables = Metavariables;
-  using simple_tags = tmpl::list<mem_monitor::Tags::MemoryHolder>;
+  using simple_tags = tmpl::list<mem_monitor::Tags::MemoryHolder,
+                                 mem_monitor::Tags::MaximumTotalMemory,
+                                 mem_monitor::Tags::PreviousTotalMemory>;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
@@ -119,6 +124,10 @@ void test_tags() {
   INFO("Test Tags");
   using holder_tag = mem_monitor::Tags::MemoryHolder;
   TestHelpers::db::test_simple_tag<holder_tag>("MemoryHolder");
+  TestHelpers::db::test_simple_tag<mem_monitor::Tags::MaximumTotalMemory>(
+      "MaximumTotalMemory");
+  TestHelpers::db::test_simple_tag<mem_monitor::Tags::PreviousTotalMemory>(
+      "PreviousTotalMemory");
 
   const std::string subpath =
       mem_monitor::subfile_name<MockMemoryMonitor<TestMetavariables>>();
@@ -213,11 +222,12 @@ void check_output(const ActionTesting::MockRuntimeSystem<Metavariables>& runner,
     num_columns = 3;
   } else if constexpr (Parallel::is_group_v<Component>) {
     // time, size on node 0, size on node 1, ...,  proc of max size, max size,
-    // avg per node
-    num_columns = num_nodes + 4;
+    // avg per node, max total, change in total
+    num_columns = num_nodes + 6;
   } else {
-    // time, size on node 0, size on node 1, ..., avg per node
-    num_columns = num_nodes + 2;
+    // time, size on node 0, size on node 1, ..., avg per node, max total,
+    // change in total
+    num_columns = num_nodes + 4;
   }
 
   CHECK(legend.size() == num_columns);
@@ -239,7 +249,15 @@ void check_output(const ActionTesting::MockRuntimeSystem<Metavariables>& runner,
       CHECK(data(0, i + 1) == sizes[i]);
     }
   }
-  CHECK(data(0, num_columns - 1) == average);
+  if constexpr (Parallel::is_singleton_v<Component>) {
+    CHECK(data(0, num_columns - 1) == average);
+  } else {
+    CHECK(data(0, num_columns - 3) == approx(average));
+    // This is the first observation of the component
+    CHECK(data(0, num_columns - 2) ==
+          approx(average * static_cast<double>(num_nodes)));
+    CHECK(data(0, num_columns - 1) == 0.0);
+  }
 }
 
 template <typename Component, typename Metavariables>
@@ -430,6 +448,33 @@ void test_process_array(const gsl::not_null<Gen*> gen) {
   check_output<array_comp<metavars>>(runner, time, num_nodes, size_per_node);
 }
 
+void test_update_memory_history() {
+  INFO("Test update_memory_history");
+  mem_monitor::Tags::MaximumTotalMemory::type maximum_totals{};
+  mem_monitor::Tags::PreviousTotalMemory::type previous_totals{};
+  const auto update = [&maximum_totals, &previous_totals](
+                          const double total_size) {
+    std::vector<std::string> legend{{"Time"}};
+    const auto result =
+        mem_monitor::update_memory_history<sing_comp<metavars>>(
+            make_not_null(&maximum_totals), make_not_null(&previous_totals),
+            make_not_null(&legend), total_size);
+    CHECK(legend == std::vector<std::string>{"Time", "Maximum total size (MB)",
+                                             "Change in total size (MB)"});
+    return result;
+  };
+  CHECK(update(2.0) == std::array{2.0, 0.0});
+  CHECK(update(5.0) == std::array{5.0, 3.0});
+  CHECK(update(4.0) == std::array{5.0, -1.0});
+  // Other components are tracked separately
+  std::vector<std::string> legend{};
+  CHECK(mem_monitor::update_memory_history<group_comp<metavars>>(
+            make_not_null(&maximum_totals), make_not_null(&previous_totals),
+            make_not_null(&legend), 1.0) == std::array{1.0, 0.0});
+  CHECK(maximum_totals.size() == 2);
+  CHECK(previous_totals.at(pretty_type::name<sing_comp<metavars>>()) == 4.0);
+}
+
 void test_process_singleton() {
   INFO("Test ProcessSingleton");
 
@@ -660,6 +705,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   // Then test the Process(Node)Group actions (second arg true)
   test_contribute_memory_data(make_not_null(&gen), true);
   test_process_array(make_not_null(&gen));
+  test_update_memory_history();
   test_process_singleton();
   test_event_construction();
   test_monitor_memory_event();
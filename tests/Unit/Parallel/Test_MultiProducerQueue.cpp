@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Parallel/MultiProducerQueue.hpp"
+
+namespace {
+void test_single_thread() {
+  Parallel::MultiProducerQueue<std::unique_ptr<int>> queue{};
+  CHECK(queue.empty());
+  CHECK(queue.push(std::make_unique<int>(1)));
+  CHECK_FALSE(queue.push(std::make_unique<int>(2)));
+  CHECK_FALSE(queue.push(std::make_unique<int>(3)));
+  CHECK_FALSE(queue.empty());
+
+  std::vector<int> drained{};
+  queue.drain([&drained](std::unique_ptr<int> value) {
+    drained.push_back(*value);
+  });
+  CHECK(drained == std::vector<int>{1, 2, 3});
+  CHECK(queue.empty());
+
+  // The queue is usable after a drain, and values still queued are cleaned
+  // up on destruction.
+  CHECK(queue.push(std::make_unique<int>(4)));
+  CHECK_FALSE(queue.push(std::make_unique<int>(5)));
+}
+
+void test_multiple_producers() {
+  constexpr size_t number_of_threads = 4;
+  constexpr size_t values_per_thread = 1000;
+  Parallel::MultiProducerQueue<size_t> queue{};
+  std::vector<std::thread> threads{};
+  for (size_t t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&queue, t]() {
+      for (size_t i = 0; i < values_per_thread; ++i) {
+        queue.push(t * values_per_thread + i);
+      }
+    });
+  }
+
+  // Drain while the producers are running.  Each producer's values must come
+  // out in the order they were pushed.
+  std::vector<size_t> next_value(number_of_threads, 0);
+  size_t number_drained = 0;
+  const auto check_value = [&next_value, &number_drained](const size_t value) {
+    const size_t thread = value / values_per_thread;
+    CHECK(value % values_per_thread == next_value[thread]);
+    ++next_value[thread];
+    ++number_drained;
+  };
+  while (number_drained < number_of_threads * values_per_thread / 2) {
+    queue.drain(check_value);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  queue.drain(check_value);
+  CHECK(number_drained == number_of_threads * values_per_thread);
+  CHECK(next_value == std::vector<size_t>(number_of_threads,
+                                          values_per_thread));
+  CHECK(queue.empty());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.MultiProducerQueue", "[Unit][Parallel]") {
+  test_single_thread();
+  test_multiple_producers();
+}
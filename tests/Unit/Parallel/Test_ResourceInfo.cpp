@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -153,6 +154,7 @@ void test_single_core() {
     auto resource_info_0 =
         TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcsPerNode: 0\n"
             "Singletons:\n"
             "  FakeSingleton0:\n"
             "    Proc: 0\n"
@@ -160,6 +162,7 @@ void test_single_core() {
     auto resource_info_auto =
         TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcsPerNode: 0\n"
             "Singletons:\n"
             "  FakeSingleton0: Auto\n");
 
@@ -209,6 +212,7 @@ void test_single_core() {
     auto resource_info =
         TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcsPerNode: 0\n"
             "Singletons: Auto\n");
     Parallel::GlobalCache<metavars> cache{};
     resource_info.build_singleton_map(cache);
@@ -242,6 +246,7 @@ void test_errors() {
         const auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: false\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: -2\n"
@@ -255,6 +260,7 @@ void test_errors() {
         const auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -269,6 +275,7 @@ void test_errors() {
         const auto resource_info = TestHelpers::test_option_tag<
             OptionTags::ResourceInfo<Metavariables<0, 1>>>(
             "AvoidGlobalProc0: false\n"
+            "ReservedProcsPerNode: 0\n"
             "Singletons:\n"
             "  FakeSingleton0:\n"
             "    Proc: 0\n"
@@ -286,6 +293,7 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: false\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 2\n"
@@ -299,6 +307,7 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: false\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -314,6 +323,7 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -330,6 +340,7 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -346,6 +357,7 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -362,6 +374,7 @@ void test_errors() {
         auto resource_info =
             TestHelpers::test_option_tag<OptionTags::ResourceInfo<metavars>>(
                 "AvoidGlobalProc0: true\n"
+                "ReservedProcsPerNode: 0\n"
                 "Singletons:\n"
                 "  FakeSingleton0:\n"
                 "    Proc: 0\n"
@@ -377,9 +390,12 @@ void test_errors() {
 template <typename Metavariables>
 Parallel::ResourceInfo<Metavariables> create_resource_info(
     const bool avoid_global_proc_0,
-    const std::vector<std::pair<bool, int>>& singletons) {
+    const std::vector<std::pair<bool, int>>& singletons,
+    const size_t reserved_procs_per_node = 0) {
   std::string option_str =
       "AvoidGlobalProc0: " + (avoid_global_proc_0 ? "true"s : "false"s) + "\n";
+  option_str +=
+      "ReservedProcsPerNode: " + get_output(reserved_procs_per_node) + "\n";
   option_str += "Singletons:\n";
   for (size_t i = 0; i < singletons.size(); i++) {
     const bool exclusive = singletons[i].first;
@@ -905,6 +921,66 @@ void test_multi_node_multi_core_large(const gsl::not_null<Gen*> gen) {
 }
 }  // namespace
 
+void test_reserved_procs() {
+  INFO("Reserved procs");
+  // 2 nodes, 3 procs per node
+  Parallel::GlobalCache<metavars> cache{{}, {}, {3, 3}};
+  const auto check = [&cache](
+                         const std::vector<std::pair<bool, int>>& singletons,
+                         const std::vector<int>& expected_singleton_procs,
+                         const std::set<size_t>& expected_reserved_procs,
+                         const std::set<size_t>& expected_element_procs) {
+    auto resource_info = create_resource_info<metavars>(false, singletons, 1);
+    CHECK(resource_info.reserved_procs_per_node() == 1);
+    resource_info.build_singleton_map(cache);
+    CHECK(resource_info.reserved_procs() == expected_reserved_procs);
+    CHECK(resource_info.procs_available_for_elements() ==
+          expected_element_procs);
+    for (const size_t proc : expected_reserved_procs) {
+      CHECK(resource_info.procs_to_ignore().count(proc) == 1);
+    }
+    tmpl::for_each<tmpl::range<size_t, 0, num_singletons>>(
+        [&expected_singleton_procs, &resource_info](const auto size_holder) {
+          constexpr size_t index =
+              std::decay_t<decltype(size_holder)>::type::value;
+          INFO("Index: " + get_output(index));
+          CHECK(static_cast<int>(
+                    resource_info.template proc_for<component<index>>()) ==
+                expected_singleton_procs[index]);
+        });
+  };
+
+  {
+    INFO("All singletons Auto and not exclusive");
+    const std::vector<std::pair<bool, int>> singletons(num_singletons,
+                                                       {false, -1});
+    check(singletons, {2, 2, 2, 2, 5, 5, 5}, {2, 5}, {0, 1, 3, 4});
+  }
+  {
+    INFO("Requested and exclusive singletons");
+    const std::vector<std::pair<bool, int>> singletons{
+        {false, 0},  {true, 5},   {false, -1}, {false, -1},
+        {false, -1}, {false, -1}, {false, -1}};
+    // Proc 5 is exclusive, so proc 4 is reserved on the second node
+    check(singletons, {0, 5, 2, 2, 2, 4, 4}, {2, 4}, {0, 1, 3});
+  }
+  {
+    INFO("All procs reserved");
+    Parallel::GlobalCache<metavars> single_proc_nodes_cache{{}, {}, {1, 1}};
+    CHECK_THROWS_WITH(
+        ([&single_proc_nodes_cache]() {
+          auto resource_info = create_resource_info<metavars>(
+              false, std::vector<std::pair<bool, int>>(num_singletons,
+                                                       {false, -1}),
+              1);
+          resource_info.build_singleton_map(single_proc_nodes_cache);
+        })(),
+        Catch::Matchers::ContainsSubstring(
+            "No procs are left for array elements after reserving 1 procs on "
+            "each node."));
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
   MAKE_GENERATOR(gen);
   test_singleton_info();
@@ -914,6 +990,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
   test_single_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core_large(make_not_null(&gen));
+  test_reserved_procs();
   test_errors();
 }
 }  // namespace Parallel
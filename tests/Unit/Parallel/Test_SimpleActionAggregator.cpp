@@ -0,0 +1,190 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/SimpleActionAggregator.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Received : db::SimpleTag {
+  using type = std::vector<std::pair<int, std::string>>;
+};
+
+struct Record {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/, const int number,
+                    std::string label) {
+    db::mutate<Received>(
+        [&number, &label](const gsl::not_null<Received::type*> received) {
+          received->emplace_back(number, std::move(label));
+        },
+        make_not_null(&box));
+  }
+};
+
+template <typename Metavariables>
+struct ArrayComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<Received>>>>>;
+};
+
+template <typename Metavariables>
+struct SingletonComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockSingletonChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<Received>>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ArrayComponent<Metavariables>,
+                                    SingletonComponent<Metavariables>>;
+};
+
+using array_component = ArrayComponent<Metavariables>;
+using singleton_component = SingletonComponent<Metavariables>;
+
+void test_policy() {
+  const auto policy = TestHelpers::test_creation<Parallel::AggregationPolicy>(
+      "MaxMessages: 4\n"
+      "MaxBytes: 100\n"
+      "MaxDelay: 0.5");
+  CHECK(policy.max_messages == 4);
+  CHECK(policy.max_bytes == 100);
+  CHECK(policy.max_delay == 0.5);
+  const auto deserialized = serialize_and_deserialize(policy);
+  CHECK(deserialized.max_messages == 4);
+  CHECK(deserialized.max_bytes == 100);
+  CHECK(deserialized.max_delay == 0.5);
+}
+
+void test_aggregation() {
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  for (int i = 0; i < 2; ++i) {
+    ActionTesting::emplace_array_component_and_initialize<array_component>(
+        make_not_null(&runner), ActionTesting::NodeId{0},
+        ActionTesting::LocalCoreId{0}, i, {Received::type{}});
+  }
+  auto& cache = ActionTesting::cache<array_component>(runner, 0);
+  const auto queued = [&runner](const int index) {
+    return ActionTesting::number_of_queued_simple_actions<array_component>(
+        runner, index);
+  };
+
+  // The default policy sends every call immediately
+  Parallel::SimpleActionAggregator<array_component, Record, int, std::string>
+      unbuffered{};
+  unbuffered.push(cache, 1, -1, "a");
+  CHECK(unbuffered.empty());
+  CHECK(queued(1) == 1);
+  ActionTesting::invoke_queued_simple_action<array_component>(
+      make_not_null(&runner), 1);
+  CHECK(ActionTesting::get_databox_tag<array_component, Received>(runner, 1) ==
+        Received::type{{-1, "a"}});
+
+  Parallel::SimpleActionAggregator<array_component, Record, int, std::string>
+      aggregator{Parallel::AggregationPolicy{2, 1000000, 1.0e6}};
+  aggregator.push(cache, 0, 1, "b");
+  aggregator.push(cache, 1, 2, "c");
+  CHECK(queued(0) == 0);
+  CHECK(queued(1) == 0);
+  aggregator.push(cache, 0, 3, "d");
+  CHECK(queued(0) == 1);
+  CHECK(queued(1) == 0);
+  aggregator.push(cache, 0, 4, "e");
+  CHECK_FALSE(aggregator.empty());
+  aggregator.flush_expired(cache);
+  CHECK(queued(0) == 1);
+  aggregator.flush(cache);
+  CHECK(aggregator.empty());
+  CHECK(queued(0) == 2);
+  CHECK(queued(1) == 1);
+
+  CHECK(aggregator.counters().calls == 4);
+  CHECK(aggregator.counters().messages == 3);
+  CHECK(aggregator.counters().bytes > 0);
+
+  for (int i = 0; i < 2; ++i) {
+    ActionTesting::invoke_queued_simple_action<array_component>(
+        make_not_null(&runner), 0);
+  }
+  ActionTesting::invoke_queued_simple_action<array_component>(
+      make_not_null(&runner), 1);
+  CHECK(ActionTesting::get_databox_tag<array_component, Received>(runner, 0) ==
+        Received::type{{1, "b"}, {3, "d"}, {4, "e"}});
+  CHECK(ActionTesting::get_databox_tag<array_component, Received>(runner, 1) ==
+        Received::type{{-1, "a"}, {2, "c"}});
+
+  // A byte limit smaller than a single call sends every call immediately
+  Parallel::SimpleActionAggregator<array_component, Record, int, std::string>
+      byte_limited{Parallel::AggregationPolicy{100, 1, 1.0e6}};
+  byte_limited.push(cache, 0, 5, "f");
+  CHECK(byte_limited.empty());
+  CHECK(queued(0) == 1);
+
+  // Calls that have waited longer than the delay are sent with the next push
+  Parallel::SimpleActionAggregator<array_component, Record, int, std::string>
+      no_delay{Parallel::AggregationPolicy{100, 1000000, 0.0}};
+  no_delay.push(cache, 1, 6, "g");
+  CHECK(no_delay.empty());
+  CHECK(queued(1) == 1);
+
+  const auto deserialized = serialize_and_deserialize(aggregator);
+  CHECK(deserialized.policy().max_messages == 2);
+  CHECK(deserialized.counters().calls == 4);
+  CHECK(deserialized.counters().messages == 3);
+  CHECK(deserialized.empty());
+}
+
+void test_singleton() {
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_singleton_component_and_initialize<
+      singleton_component>(make_not_null(&runner), ActionTesting::NodeId{0},
+                           ActionTesting::LocalCoreId{0}, {Received::type{}});
+  auto& cache = ActionTesting::cache<singleton_component>(runner, 0);
+
+  Parallel::SimpleActionAggregator<singleton_component, Record, int,
+                                   std::string>
+      aggregator{Parallel::AggregationPolicy{3, 1000000, 1.0e6}};
+  aggregator.push(cache, 1, "a");
+  aggregator.push(cache, 2, "b");
+  CHECK(ActionTesting::is_simple_action_queue_empty<singleton_component>(
+      runner, 0));
+  aggregator.push(cache, 3, "c");
+  CHECK(aggregator.empty());
+  ActionTesting::invoke_queued_simple_action<singleton_component>(
+      make_not_null(&runner), 0);
+  CHECK(ActionTesting::get_databox_tag<singleton_component, Received>(
+            runner, 0) == Received::type{{1, "a"}, {2, "b"}, {3, "c"}});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.SimpleActionAggregator", "[Unit][Parallel]") {
+  test_policy();
+  test_aggregation();
+  test_singleton();
+}
@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Parallel/Tracing.hpp"
+
+namespace {
+size_t count(const std::string& haystack, const std::string& needle) {
+  size_t result = 0;
+  for (size_t position = haystack.find(needle); position != std::string::npos;
+       position = haystack.find(needle, position + 1)) {
+    ++result;
+  }
+  return result;
+}
+
+std::string trace(const int process_id) {
+  std::ostringstream os{};
+  Parallel::tracing::write_chrome_trace(os, process_id);
+  return os.str();
+}
+
+void test_record() {
+  Parallel::tracing::clear();
+  CHECK(trace(3) == "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n");
+
+  static const std::string name = "Component simple_action \"Action\"";
+  const auto start = std::chrono::steady_clock::now();
+  Parallel::tracing::record(&name, start,
+                            start + std::chrono::microseconds(250));
+  {
+    const Parallel::tracing::Span span{&name};
+  }
+  const std::string result = trace(3);
+  CHECK(count(result, "{\"name\":\"Component simple_action \\\"Action\\\"\","
+                      "\"ph\":\"X\",\"ts\":") == 2);
+  CHECK(count(result, "\"dur\":250.000,\"pid\":3,\"tid\":") == 1);
+  CHECK(count(result, "\"pid\":3") == 2);
+
+  Parallel::tracing::clear();
+  CHECK(count(trace(0), "\"ph\":\"X\"") == 0);
+}
+
+void test_ring_buffer() {
+  Parallel::tracing::clear();
+  static const std::string old_name = "Old";
+  static const std::string new_name = "New";
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < 10; ++i) {
+    Parallel::tracing::record(&old_name, start, start);
+  }
+  for (size_t i = 0; i < Parallel::tracing::buffer_capacity; ++i) {
+    Parallel::tracing::record(&new_name, start, start);
+  }
+  const std::string result = trace(0);
+  CHECK(count(result, "\"name\":\"Old\"") == 0);
+  CHECK(count(result, "\"name\":\"New\"") ==
+        Parallel::tracing::buffer_capacity);
+}
+
+void test_threads() {
+  Parallel::tracing::clear();
+  static const std::string name = "Threaded";
+  constexpr size_t number_of_threads = 4;
+  constexpr size_t spans_per_thread = 100;
+  std::vector<std::thread> threads{};
+  for (size_t t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([]() {
+      for (size_t i = 0; i < spans_per_thread; ++i) {
+        const Parallel::tracing::Span span{&name};
+      }
+    });
+  }
+  // Writing while the threads are recording must be safe.
+  CHECK(count(trace(0), "\"name\":\"Threaded\"") <=
+        number_of_threads * spans_per_thread);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const std::string result = trace(0);
+  CHECK(count(result, "\"name\":\"Threaded\"") ==
+        number_of_threads * spans_per_thread);
+  Parallel::tracing::clear();
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.Tracing", "[Unit][Parallel]") {
+  test_record();
+  test_ring_buffer();
+  test_threads();
+}
@@ -0,0 +1,118 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Parallel/WriterThread.hpp"
+
+namespace {
+void test_order() {
+  Parallel::WriterThread writer{};
+  std::vector<size_t> written{};
+  for (size_t i = 0; i < 100; ++i) {
+    writer.submit([&written, i]() { written.push_back(i); }, 4);
+    CHECK(writer.pending() <= 4);
+  }
+  writer.wait();
+  CHECK(writer.pending() == 0);
+  std::vector<size_t> expected(100);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = i;
+  }
+  CHECK(written == expected);
+
+  // A synchronous write runs on the calling thread after the pending ones
+  const auto this_thread = std::this_thread::get_id();
+  writer.submit([&written]() { written.push_back(100); }, 4);
+  writer.submit(
+      [&written, &this_thread]() {
+        CHECK(std::this_thread::get_id() == this_thread);
+        written.push_back(101);
+      },
+      0);
+  CHECK(writer.pending() == 0);
+  CHECK(written.size() == 102);
+  CHECK(written.back() == 101);
+}
+
+void test_backpressure() {
+  Parallel::WriterThread writer{};
+  std::mutex gate{};
+  std::unique_lock hold_gate(gate);
+  std::atomic<size_t> written{0};
+  const auto blocked_write = [&gate, &written]() {
+    const std::lock_guard wait_for_gate(gate);
+    ++written;
+  };
+  writer.submit(blocked_write, 2);
+  writer.submit(blocked_write, 2);
+  CHECK(writer.pending() == 2);
+
+  std::atomic<bool> submitted{false};
+  std::thread submitter([&writer, &blocked_write, &submitted]() {
+    writer.submit(blocked_write, 2);
+    submitted = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CHECK_FALSE(submitted.load());
+  hold_gate.unlock();
+  submitter.join();
+  CHECK(submitted.load());
+  writer.wait();
+  CHECK(written.load() == 3);
+}
+
+void test_error() {
+  Parallel::WriterThread writer{};
+  writer.submit([]() { throw std::runtime_error("Write failed"); }, 2);
+  CHECK_THROWS_WITH(writer.wait(), Catch::Matchers::ContainsSubstring(
+                                       "Write failed"));
+  // The error is only reported once and the thread keeps working
+  bool written = false;
+  writer.submit([&written]() { written = true; }, 2);
+  writer.wait();
+  CHECK(written);
+}
+
+void test_flush_callback() {
+  Parallel::WriterThread writer{};
+  size_t buffered = 2;
+  std::atomic<size_t> written{0};
+  writer.add_flush_callback([&writer, &buffered, &written]() {
+    for (; buffered > 0; --buffered) {
+      writer.submit([&written]() { ++written; }, 4);
+    }
+  });
+  writer.wait();
+  CHECK(buffered == 0);
+  CHECK(written.load() == 2);
+}
+
+void test_destructor() {
+  std::atomic<size_t> written{0};
+  {
+    Parallel::WriterThread writer{};
+    for (size_t i = 0; i < 10; ++i) {
+      writer.submit([&written]() { ++written; }, 20);
+    }
+  }
+  CHECK(written.load() == 10);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.WriterThread", "[Unit][Parallel]") {
+  test_order();
+  test_backpressure();
+  test_error();
+  test_flush_callback();
+  test_destructor();
+  CHECK(&Parallel::writer_thread() == &Parallel::writer_thread());
+}
@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "Domain/Amr/Flag.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/GridPointBudget.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/GridPointBudget.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <size_t Dim>
+std::array<amr::Flag, Dim> limited_flags(std::array<amr::Flag, Dim> flags,
+                                         const std::array<size_t, Dim>& extents,
+                                         const size_t maximum_grid_points) {
+  const Mesh<Dim> mesh{extents, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  amr::Criteria::limit_to_grid_point_budget(make_not_null(&flags), mesh,
+                                            maximum_grid_points);
+  return flags;
+}
+
+void test_limit_to_grid_point_budget() {
+  using amr::Flag;
+  // Within the budget nothing changes
+  CHECK(limited_flags(std::array{Flag::IncreaseResolution}, {{4}}, 5) ==
+        std::array{Flag::IncreaseResolution});
+  CHECK(limited_flags(std::array{Flag::IncreaseResolution}, {{5}}, 5) ==
+        std::array{Flag::DoNothing});
+  // Only increases of resolution are dropped
+  CHECK(limited_flags(std::array{Flag::Split}, {{6}}, 5) ==
+        std::array{Flag::Split});
+  CHECK(limited_flags(std::array{Flag::DecreaseResolution, Flag::Join},
+                      {{7, 6}}, 5) ==
+        std::array{Flag::DecreaseResolution, Flag::Join});
+
+  // With all increases of resolution the extents are {7, 3, 4}, so increasing
+  // the resolution in the second dimension adds 28 grid points and in the
+  // third dimension 21 grid points. They are dropped in this order.
+  const std::array<size_t, 3> extents{{6, 2, 3}};
+  const std::array xi_eta_zeta{Flag::IncreaseResolution,
+                               Flag::IncreaseResolution,
+                               Flag::IncreaseResolution};
+  CHECK(limited_flags(xi_eta_zeta, extents, 7 * 3 * 4) == xi_eta_zeta);
+  CHECK(limited_flags(xi_eta_zeta, extents, 7 * 3 * 4 - 1) ==
+        std::array{Flag::IncreaseResolution, Flag::DoNothing,
+                   Flag::IncreaseResolution});
+  CHECK(limited_flags(xi_eta_zeta, extents, 7 * 2 * 4 - 1) ==
+        std::array{Flag::IncreaseResolution, Flag::DoNothing, Flag::DoNothing});
+  CHECK(limited_flags(xi_eta_zeta, extents, 7 * 2 * 3 - 1) ==
+        std::array{Flag::DoNothing, Flag::DoNothing, Flag::DoNothing});
+  // A decrease of resolution in another dimension frees up grid points
+  CHECK(limited_flags(std::array{Flag::IncreaseResolution, Flag::DoNothing,
+                                 Flag::DecreaseResolution},
+                      extents, 7 * 2 * 2) ==
+        std::array{Flag::IncreaseResolution, Flag::DoNothing,
+                   Flag::DecreaseResolution});
+}
+
+void test_tags() {
+  TestHelpers::db::test_simple_tag<
+      amr::Criteria::Tags::MaximumGridPointsPerElement>(
+      "MaximumGridPointsPerElement");
+  CHECK(TestHelpers::test_option_tag<
+            amr::Criteria::OptionTags::MaximumGridPointsPerElement>("1000") ==
+        std::optional<size_t>{1000});
+  CHECK(TestHelpers::test_option_tag<
+            amr::Criteria::OptionTags::MaximumGridPointsPerElement>("None") ==
+        std::optional<size_t>{});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Amr.Criteria.GridPointBudget",
+                  "[Unit][ParallelAlgorithms]") {
+  test_limit_to_grid_point_budget();
+  test_tags();
+}
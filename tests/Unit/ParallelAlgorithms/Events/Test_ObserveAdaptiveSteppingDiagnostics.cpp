@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -146,17 +147,26 @@ void test_observe(const Observer& observer) {
   uint64_t total_num_steps = 0;
   uint64_t total_num_step_changes = 0;
   uint64_t total_num_step_rejections = 0;
+  uint64_t total_num_substeps = 0;
+  double total_wall_time = 0.0;
+  double max_wall_time = 0.0;
 
   const auto create_element = [&](const uint64_t num_steps,
                                   const uint64_t num_step_changes,
-                                  const uint64_t num_step_rejections) {
+                                  const uint64_t num_step_rejections,
+                                  const uint64_t num_substeps,
+                                  const double wall_time) {
     auto box = db::create<tag_list>(
         Metavariables{}, observation_time,
         AdaptiveSteppingDiagnostics{num_slabs, num_slab_changes, num_steps,
-                                    num_step_changes, num_step_rejections});
+                                    num_step_changes, num_step_rejections,
+                                    num_substeps, wall_time});
     total_num_steps += num_steps;
     total_num_step_changes += num_step_changes;
     total_num_step_rejections += num_step_rejections;
+    total_num_substeps += num_substeps;
+    total_wall_time += wall_time;
+    max_wall_time = std::max(max_wall_time, wall_time);
 
     const auto ids_to_register =
         observers::get_registration_observation_type_and_key(observer, box);
@@ -169,9 +179,9 @@ void test_observe(const Observer& observer) {
         &runner, element_boxes.size() - 1);
   };
 
-  create_element(100, 12, 5);
-  create_element(130, 90, 54);
-  create_element(18, 2, 2);
+  create_element(100, 12, 5, 315, 2.5);
+  create_element(130, 90, 54, 552, 4.25);
+  create_element(18, 2, 2, 60, 0.5);
 
   for (size_t index = 0; index < element_boxes.size(); ++index) {
     CHECK(static_cast<const Event&>(observer).is_ready(
@@ -214,6 +224,13 @@ void test_observe(const Observer& observer) {
   CHECK(std::get<4>(reduction_data.data()) == total_num_step_changes);
   CHECK(results->reduction_names[5] == "Number of step rejections");
   CHECK(std::get<5>(reduction_data.data()) == total_num_step_rejections);
+  CHECK(results->reduction_names[6] == "Total substeps on all elements");
+  CHECK(std::get<6>(reduction_data.data()) == total_num_substeps);
+  CHECK(results->reduction_names[7] == "Total time derivative wall time");
+  CHECK(std::get<7>(reduction_data.data()) == approx(total_wall_time));
+  CHECK(results->reduction_names[8] ==
+        "Maximum element time derivative wall time");
+  CHECK(std::get<8>(reduction_data.data()) == max_wall_time);
 }
 }  // namespace
 
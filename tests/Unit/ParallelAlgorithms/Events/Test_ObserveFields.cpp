@@ -21,6 +21,12 @@
 #include "DataStructures/FloatingPointType.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/Identity.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
@@ -44,6 +50,7 @@
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"  // IWYU pragma: keep
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
@@ -92,13 +99,39 @@ struct prim_vars_impl<System,
 template <typename System>
 using prim_vars_list = typename prim_vars_impl<System>::type;
 
+// Three disconnected blocks named "Left", "Middle", and "Right". The group
+// "Outer" holds the first and the last block.
+template <size_t Dim>
+Domain<Dim> make_domain() {
+  std::vector<std::unique_ptr<
+      domain::CoordinateMapBase<Frame::BlockLogical, Frame::Inertial, Dim>>>
+      maps{};
+  std::vector<std::array<size_t, two_to_the(Dim)>> corners{};
+  for (size_t block = 0; block < 3; ++block) {
+    maps.push_back(
+        domain::make_coordinate_map_base<Frame::BlockLogical, Frame::Inertial>(
+            domain::CoordinateMaps::Identity<Dim>{}));
+    std::array<size_t, two_to_the(Dim)> block_corners{};
+    std::iota(block_corners.begin(), block_corners.end(),
+              block * two_to_the(Dim));
+    corners.push_back(block_corners);
+  }
+  return Domain<Dim>{std::move(maps),
+                     corners,
+                     {},
+                     {},
+                     {"Left", "Middle", "Right"},
+                     {{"Outer", {"Left", "Right"}}}};
+}
+
 template <typename System, typename ArraySectionIdTag = void,
           typename ObserveEvent>
 void test_observe(
     const std::unique_ptr<ObserveEvent> observe,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh,
     const bool has_analytic_solutions,
-    const std::optional<std::string>& section = std::nullopt) {
+    const std::optional<std::string>& section = std::nullopt,
+    const bool in_observed_blocks = true) {
   using metavariables = Metavariables<System, false>;
   constexpr size_t volume_dim = System::volume_dim;
   using element_component = ElementComponent<metavariables>;
@@ -118,6 +151,8 @@ void test_observe(
   Variables<tmpl::list<coordinates_tag>> coordinate_vars(
       mesh.number_of_grid_points());
   Variables<prim_vars_list<System>> prim_vars(mesh.number_of_grid_points());
+  // The element is in the block "Right"
+  const Element<volume_dim> element{element_id, {}};
   // Fill the variables with some data.  It doesn't matter much what,
   // but integers are nice in that we don't have to worry about
   // roundoff error.
@@ -165,14 +200,15 @@ void test_observe(
       ::Tags::Variables<typename decltype(vars)::tags_list>,
       ::Tags::Variables<typename decltype(prim_vars)::tags_list>,
       coordinates_tag, ::Tags::AnalyticSolutions<solution_variables>,
-      observers::Tags::ObservationKey<ArraySectionIdTag>>>(
+      observers::Tags::ObservationKey<ArraySectionIdTag>,
+      domain::Tags::Domain<volume_dim>, domain::Tags::Element<volume_dim>>>(
       metavariables{}, mesh, vars, prim_vars,
       get<coordinates_tag>(coordinate_vars),
       [&solutions, &has_analytic_solutions]() {
         return has_analytic_solutions ? std::make_optional(solutions)
                                       : std::nullopt;
       }(),
-      section);
+      section, make_domain<volume_dim>(), element);
 
   const auto ids_to_register =
       observers::get_registration_observation_type_and_key(*observe, box);
@@ -182,7 +218,10 @@ void test_observe(
                                                : section.value_or("Unused"))};
   const observers::ObservationKey expected_observation_key_for_reg(
       expected_subfile_name + ".vol");
-  if (std::is_same_v<ArraySectionIdTag, void> or section.has_value()) {
+  const bool observed =
+      in_observed_blocks and
+      (std::is_same_v<ArraySectionIdTag, void> or section.has_value());
+  if (observed) {
     CHECK(ids_to_register->first == observers::TypeOfObservation::Volume);
     CHECK(ids_to_register->second == expected_observation_key_for_reg);
   } else {
@@ -198,11 +237,20 @@ void test_observe(
       ActionTesting::cache<element_component>(runner, array_index), array_index,
       std::add_pointer_t<element_component>{}, {"TimeName", observation_time});
 
-  if (not std::is_same_v<ArraySectionIdTag, void> and not section.has_value()) {
+  if (not observed) {
+    CHECK(runner.template is_simple_action_queue_empty<element_component>(
+        array_index));
     CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
     return;
   }
 
+  // The element only took a snapshot of the data, so nothing has been sent to
+  // the observer yet
+  CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+  runner.template invoke_queued_simple_action<element_component>(array_index);
+  CHECK(runner.template is_simple_action_queue_empty<element_component>(
+      array_index));
+
   // Process the data
   runner.template invoke_queued_simple_action<observer_component>(0);
   CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
@@ -303,30 +351,36 @@ void test_system(
     const std::string& mesh_creation_string,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh = {},
     const bool has_analytic_solutions = true,
-    const std::optional<std::string>& section = std::nullopt) {
+    const std::optional<std::string>& section = std::nullopt,
+    const std::string& blocks_creation_string = "All",
+    const std::optional<std::vector<std::string>>& blocks_to_observe = {},
+    const bool in_observed_blocks = true) {
   INFO(pretty_type::get_name<System>());
   CAPTURE(has_analytic_solutions);
   CAPTURE(mesh_creation_string);
   using ArraySectionIdTag = typename System::array_section_id;
   INFO(pretty_type::get_name<ArraySectionIdTag>());
   CAPTURE(section);
+  CAPTURE(blocks_creation_string);
   using metavariables = Metavariables<System, false>;
   test_observe<System, ArraySectionIdTag>(
       std::make_unique<typename System::ObserveEvent>(
-          System::make_test_object(interpolating_mesh)),
-      interpolating_mesh, has_analytic_solutions, section);
+          System::make_test_object(interpolating_mesh, blocks_to_observe)),
+      interpolating_mesh, has_analytic_solutions, section, in_observed_blocks);
   INFO("create/serialize");
   register_factory_classes_with_charm<metavariables>();
   {
-    const std::string creation_string = System::creation_string_for_test +
-                                        mesh_creation_string;
+    const std::string creation_string =
+        std::string{System::creation_string_for_test} +
+        "  BlocksToObserve: " + blocks_creation_string + "\n" +
+        mesh_creation_string;
     const auto factory_event =
         TestHelpers::test_creation<std::unique_ptr<Event>, metavariables>(
             creation_string);
     auto serialized_event = serialize_and_deserialize(factory_event);
     test_observe<System, ArraySectionIdTag>(
         std::move(serialized_event), interpolating_mesh, has_analytic_solutions,
-        section);
+        section, in_observed_blocks);
   }
 }
 }  // namespace
@@ -352,6 +406,29 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
                           ComplicatedSystem<dg::Events::ObserveFields>));
   }
 
+  {
+    INFO("Blocks to observe");
+    const std::string interpolating_mesh_str = "  InterpolateToMesh: None";
+    using system = ScalarSystem<dg::Events::ObserveFields>;
+    test_system<system>(interpolating_mesh_str, std::nullopt, true,
+                        std::nullopt, "[Right]",
+                        std::vector<std::string>{"Right"}, true);
+    test_system<system>(interpolating_mesh_str, std::nullopt, true,
+                        std::nullopt, "[Middle, Outer]",
+                        std::vector<std::string>{"Middle", "Outer"}, true);
+    test_system<system>(interpolating_mesh_str, std::nullopt, true,
+                        std::nullopt, "[Left, Middle]",
+                        std::vector<std::string>{"Left", "Middle"}, false);
+    CHECK_THROWS_WITH(
+        test_observe<system>(
+            std::make_unique<typename system::ObserveEvent>(
+                system::make_test_object(std::nullopt,
+                                         std::vector<std::string>{"Top"})),
+            std::nullopt, true),
+        Catch::Matchers::ContainsSubstring(
+            "The block or block group 'Top' in the BlocksToObserve"));
+  }
+
   {
     INFO("Interpolate to finer grid");
     const std::string interpolating_mesh_str =
@@ -462,7 +539,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
           "CoordinatesFloatingPointType: Double\n"
           "VariablesToObserve: [NotAVar]\n"
           "FloatingPointTypes: [Double]\n"
-          "InterpolateToMesh: None\n"),
+          "InterpolateToMesh: None\n"
+          "BlocksToObserve: All\n"),
       Catch::Matchers::ContainsSubstring("Invalid selection: NotAVar"));
 
   CHECK_THROWS_WITH(
@@ -472,6 +550,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
           "CoordinatesFloatingPointType: Double\n"
           "VariablesToObserve: [Scalar, Scalar]\n"
           "FloatingPointTypes: [Double]\n"
-          "InterpolateToMesh: None\n"),
+          "InterpolateToMesh: None\n"
+          "BlocksToObserve: All\n"),
       Catch::Matchers::ContainsSubstring("Scalar specified multiple times"));
 }
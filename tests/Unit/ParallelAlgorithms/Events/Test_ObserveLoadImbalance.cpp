@@ -0,0 +1,232 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ActionProfile.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tags/ActionProfiles.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "ParallelAlgorithms/Events/ObserveLoadImbalance.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+struct MockContributeReductionData {
+  using ReductionData = tmpl::wrap<
+      tmpl::front<Events::ObserveLoadImbalance::observed_reduction_data_tags>,
+      Parallel::ReductionData>;
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names;
+    ReductionData reduction_data;
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::optional<Results> results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    Parallel::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    ReductionData&& reduction_data) {
+    if (results) {
+      CHECK(results->observation_id == observation_id);
+      CHECK(results->subfile_name == subfile_name);
+      CHECK(results->reduction_names == reduction_names);
+      results->reduction_data.combine(std::move(reduction_data));
+    } else {
+      results.emplace();
+      *results = {observation_id, subfile_name, reduction_names,
+                  std::move(reduction_data)};
+    }
+  }
+};
+
+std::optional<MockContributeReductionData::Results>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    MockContributeReductionData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<Event, tmpl::list<Events::ObserveLoadImbalance>>>;
+  };
+};
+
+template <typename Observer>
+void test_observe(const Observer& observer) {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+
+  auto& results = MockContributeReductionData::results;
+  results.reset();
+
+  // One mock node with three mock cores.  The last core has no elements.
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}, {}, {3}};
+  ActionTesting::emplace_group_component<observer_component>(&runner);
+
+  using simple_tags =
+      tmpl::list<Parallel::Tags::MetavariablesImpl<Metavariables>,
+                 Parallel::Tags::ActionProfiles>;
+  std::vector<db::compute_databox_type<simple_tags>> element_boxes;
+  std::vector<size_t> element_cores;
+
+  const double observation_time = 2.0;
+  const auto create_element = [&](const size_t core,
+                                  const double time_in_action) {
+    auto box = db::create<simple_tags>(
+        Metavariables{}, std::vector<Parallel::ActionProfile>{
+                             {"Evolve/ActionA", 3, time_in_action},
+                             {"Evolve/ActionB", 4, 0.5}});
+
+    const auto ids_to_register =
+        observers::get_registration_observation_type_and_key(observer, box);
+    CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+    CHECK(ids_to_register->second == observers::ObservationKey("/subfile.dat"));
+
+    element_boxes.push_back(std::move(box));
+    element_cores.push_back(core);
+
+    ActionTesting::emplace_array_component<element_component>(
+        &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{core},
+        static_cast<int>(element_boxes.size() - 1));
+  };
+
+  // Core 0 has a cost of 2.0 + 0.5 + 1.0 + 0.5 = 4.0 and core 1 has a
+  // cost of 7.5 + 0.5 = 8.0.
+  create_element(0, 2.0);
+  create_element(1, 7.5);
+  create_element(0, 1.0);
+
+  for (size_t index = 0; index < element_boxes.size(); ++index) {
+    CHECK(static_cast<const Event&>(observer).is_ready(
+        element_boxes[index],
+        ActionTesting::cache<element_component>(runner, index),
+        static_cast<element_component::array_index>(index),
+        std::add_pointer_t<element_component>{}));
+    observer.run(
+        make_observation_box<db::AddComputeTags<>>(element_boxes[index]),
+        ActionTesting::cache<element_component>(runner, index),
+        static_cast<element_component::array_index>(index),
+        std::add_pointer_t<element_component>{},
+        {"TimeName", observation_time});
+  }
+
+  // Process the data
+  for (const size_t core : element_cores) {
+    const auto observer_index = static_cast<int>(core);
+    REQUIRE(
+        not runner.template is_simple_action_queue_empty<observer_component>(
+            observer_index));
+    runner.template invoke_queued_simple_action<observer_component>(
+        observer_index);
+  }
+  for (int core = 0; core < 3; ++core) {
+    CHECK(runner.template is_simple_action_queue_empty<observer_component>(
+        core));
+  }
+
+  REQUIRE(results);
+  auto& reduction_data = results->reduction_data;
+  reduction_data.finalize();
+
+  CHECK(results->observation_id.value() == observation_time);
+  CHECK(results->subfile_name == "/subfile");
+  CHECK(results->reduction_names ==
+        std::vector<std::string>{"TimeName", "Maximum proc cost",
+                                 "Mean proc cost", "Imbalance"});
+  CHECK(std::get<0>(reduction_data.data()) == observation_time);
+  CHECK_ITERABLE_APPROX(std::get<1>(reduction_data.data()),
+                        (std::vector<double>{8.0, 6.0, 4.0 / 3.0}));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveLoadImbalance",
+                  "[Unit][ParallelAlgorithms]") {
+  register_factory_classes_with_charm<Metavariables>();
+
+  CHECK(Events::ObserveLoadImbalance_detail::SummarizeProcCosts{}(
+            {0.0, 0.0}) == std::vector<double>{0.0, 0.0, 1.0});
+  {
+    const Events::ObserveLoadImbalance observer("subfile");
+    CHECK(not observer.needs_evolved_variables());
+    test_observe(observer);
+    test_observe(serialize_and_deserialize(observer));
+  }
+  {
+    const auto event =
+        TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+            "ObserveLoadImbalance:\n"
+            "  SubfileName: subfile");
+    test_observe(*event);
+    test_observe(*serialize_and_deserialize(event));
+  }
+}
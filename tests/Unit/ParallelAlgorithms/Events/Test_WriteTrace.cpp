@@ -0,0 +1,42 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <memory>
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "ParallelAlgorithms/Events/WriteTrace.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Metavariables {
+  using component_list = tmpl::list<>;
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes =
+        tmpl::map<tmpl::pair<Event, tmpl::list<Events::WriteTrace>>>;
+  };
+};
+}  // namespace
+
+// The trace itself is tested in Test_Tracing.cpp, which runs with Charm++.
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.WriteTrace",
+                  "[Unit][ParallelAlgorithms]") {
+  register_factory_classes_with_charm<Metavariables>();
+
+  const auto event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "WriteTrace:\n"
+          "  FileName: Trace");
+  CHECK(dynamic_cast<const Events::WriteTrace*>(event.get()) != nullptr);
+  CHECK(not event->needs_evolved_variables());
+  const auto deserialized = serialize_and_deserialize(event);
+  CHECK(dynamic_cast<const Events::WriteTrace*>(deserialized.get()) !=
+        nullptr);
+}
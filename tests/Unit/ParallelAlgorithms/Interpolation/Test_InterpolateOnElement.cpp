@@ -0,0 +1,240 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/IdPair.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/BlockId.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolateOnElement.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "Time/Tags/Time.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace intrp {
+template <typename Metavariables, typename Tag>
+struct InterpolationTarget;
+namespace Actions {
+template <typename InterpolationTargetTag>
+struct InterpolationTargetReceiveVars;
+}  // namespace Actions
+}  // namespace intrp
+
+namespace {
+namespace Tags {
+struct TestSolution : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+}  // namespace Tags
+
+using vars_type = Variables<tmpl::list<Tags::TestSolution>>;
+
+struct Received {
+  vars_type vars{};
+  std::vector<size_t> offsets{};
+  double temporal_id{};
+};
+std::vector<Received> received{};
+
+template <typename InterpolationTargetTag>
+struct MockInterpolationTargetReceiveVars {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const std::vector<vars_type>& vars_src,
+                    const std::vector<std::vector<size_t>>& global_offsets,
+                    const double temporal_id) {
+    REQUIRE(vars_src.size() == 1);
+    REQUIRE(global_offsets.size() == 1);
+    received.push_back({vars_src[0], global_offsets[0], temporal_id});
+  }
+};
+
+template <typename Metavariables>
+struct mock_element {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<3>;
+  using simple_tags = tmpl::list<intrp::Tags::ElementVolumeVars<
+      typename Metavariables::InterpolationTargetA, 3>>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+template <typename Metavariables, typename InterpolationTargetTag>
+struct mock_interpolation_target {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using component_being_mocked =
+      intrp::InterpolationTarget<Metavariables, InterpolationTargetTag>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<>>>>>;
+  using replace_these_simple_actions = tmpl::list<
+      intrp::Actions::InterpolationTargetReceiveVars<InterpolationTargetTag>>;
+  using with_these_simple_actions =
+      tmpl::list<MockInterpolationTargetReceiveVars<InterpolationTargetTag>>;
+};
+
+struct MockMetavariables {
+  struct InterpolationTargetA {
+    using temporal_id = ::Tags::Time;
+    using vars_to_interpolate_to_target = tmpl::list<Tags::TestSolution>;
+    struct compute_target_points {
+      using is_sequential = std::true_type;
+    };
+    template <typename Metavariables>
+    using interpolating_component = mock_element<Metavariables>;
+  };
+  static constexpr size_t volume_dim = 3;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+  using component_list = tmpl::list<
+      mock_element<MockMetavariables>,
+      mock_interpolation_target<MockMetavariables, InterpolationTargetA>>;
+};
+
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.InterpolateOnElement",
+                  "[Unit]") {
+  using metavars = MockMetavariables;
+  using target_tag = metavars::InterpolationTargetA;
+  using elem_component = mock_element<metavars>;
+  using target_component = mock_interpolation_target<metavars, target_tag>;
+  using holder_tag = intrp::Tags::ElementVolumeVars<target_tag, 3>;
+  using BlockCoords = intrp::Vars::ElementHolder<3, target_tag>::BlockCoords;
+
+  // A single element covers block 0, so its logical coordinates are the
+  // block logical coordinates.
+  const ElementId<3> element_id{0};
+  const Mesh<3> mesh{4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto solution = [](const auto& x) {
+    std::decay_t<decltype(get<0>(x))> result =
+        1.0 + 2.0 * get<0>(x) - get<1>(x) * get<2>(x);
+    return result;
+  };
+  vars_type volume_vars{mesh.number_of_grid_points()};
+  get(get<Tags::TestSolution>(volume_vars)) =
+      solution(logical_coordinates(mesh));
+
+  const auto make_points = [](const double shift) {
+    tnsr::I<double, 3, Frame::BlockLogical> first{{{0.1, -0.2, 0.3}}};
+    tnsr::I<double, 3, Frame::BlockLogical> second{{{-0.7, shift, 0.9}}};
+    // The last point is in a different block and the one before is outside
+    // the domain.
+    return BlockCoords{make_id_pair(domain::BlockId{0}, first),
+                       make_id_pair(domain::BlockId{0}, second), std::nullopt,
+                       make_id_pair(domain::BlockId{1}, first)};
+  };
+
+  ActionTesting::MockRuntimeSystem<metavars> runner{{}};
+  ActionTesting::emplace_array_component_and_initialize<elem_component>(
+      make_not_null(&runner), ActionTesting::NodeId{0},
+      ActionTesting::LocalCoreId{0}, element_id, {holder_tag::type{}});
+  ActionTesting::emplace_array_component_and_initialize<target_component>(
+      make_not_null(&runner), ActionTesting::NodeId{0},
+      ActionTesting::LocalCoreId{0}, 0_st, {});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+  const auto& holder =
+      ActionTesting::get_databox_tag<elem_component, holder_tag>(runner,
+                                                                 element_id);
+  const auto check_received = [&solution](const double temporal_id,
+                                          const double shift) {
+    REQUIRE(received.size() == 1);
+    CHECK(received[0].temporal_id == temporal_id);
+    CHECK(received[0].offsets == std::vector<size_t>{0, 1});
+    const DataVector expected{solution(std::array{0.1, -0.2, 0.3}),
+                              solution(std::array{-0.7, shift, 0.9})};
+    CHECK_ITERABLE_APPROX(get(get<Tags::TestSolution>(received[0].vars)),
+                          expected);
+    received.clear();
+  };
+
+  // Points that arrive before the volume data are kept until it arrives.
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveTargetPoints<target_tag>>(
+      make_not_null(&runner), element_id, 1.0, make_points(0.4));
+  CHECK(ActionTesting::is_simple_action_queue_empty<target_component>(runner,
+                                                                      0));
+  CHECK(holder.target_points.count(1.0) == 1);
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveVolumeVars<target_tag>>(
+      make_not_null(&runner), element_id, 1.0, mesh, volume_vars);
+  CHECK(holder.target_points.empty());
+  CHECK(holder.volume_vars.count(1.0) == 1);
+  ActionTesting::invoke_queued_simple_action<target_component>(
+      make_not_null(&runner), 0);
+  check_received(1.0, 0.4);
+
+  // The volume data is kept for new points at the same time.
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveTargetPoints<target_tag>>(
+      make_not_null(&runner), element_id, 1.0, make_points(-0.5));
+  ActionTesting::invoke_queued_simple_action<target_component>(
+      make_not_null(&runner), 0);
+  check_received(1.0, -0.5);
+
+  // Nothing is sent if there are no points in the element.
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveTargetPoints<target_tag>>(
+      make_not_null(&runner), element_id, 1.0,
+      BlockCoords{std::nullopt,
+                  make_id_pair(domain::BlockId{1},
+                               tnsr::I<double, 3, Frame::BlockLogical>{0.0})});
+  CHECK(ActionTesting::is_simple_action_queue_empty<target_component>(runner,
+                                                                      0));
+
+  // Cleaning up removes the data at and before the time, and later data for
+  // those times is ignored.
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveVolumeVars<target_tag>>(
+      make_not_null(&runner), element_id, 2.0, mesh, volume_vars);
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::CleanUpElementVolumeVars<target_tag>>(
+      make_not_null(&runner), element_id, 1.0);
+  CHECK(holder.last_completed_temporal_id == std::optional{1.0});
+  CHECK(holder.volume_vars.size() == 1);
+  CHECK(holder.volume_vars.count(2.0) == 1);
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveVolumeVars<target_tag>>(
+      make_not_null(&runner), element_id, 0.5, mesh, volume_vars);
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveTargetPoints<target_tag>>(
+      make_not_null(&runner), element_id, 1.0, make_points(0.4));
+  CHECK(holder.volume_vars.size() == 1);
+  CHECK(holder.target_points.empty());
+  CHECK(ActionTesting::is_simple_action_queue_empty<target_component>(runner,
+                                                                      0));
+
+  ActionTesting::simple_action<
+      elem_component, intrp::Actions::ElementReceiveTargetPoints<target_tag>>(
+      make_not_null(&runner), element_id, 2.0, make_points(0.0));
+  ActionTesting::invoke_queued_simple_action<target_component>(
+      make_not_null(&runner), 0);
+  check_received(2.0, 0.0);
+  CHECK(serialize_and_deserialize(holder).volume_vars == holder.volume_vars);
+}
+}  // namespace
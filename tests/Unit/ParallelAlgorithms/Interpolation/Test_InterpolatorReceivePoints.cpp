@@ -236,6 +236,33 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceivePoints",
 
   // But block_coord_holders should be filled.
   CHECK(vars_info.block_coord_holders == block_logical_coords);
+  CHECK(vars_info.uses_cached_interpolants);
+  CHECK(holder.cached_block_coord_holders == block_logical_coords);
+  CHECK(holder.interpolants.empty());
+
+  // The same points at a later time reuse the cached interpolants.
+  TimeStepId later_temporal_id(true, 0, Time(slab, Rational(12, 15)));
+  runner.simple_action<
+      mock_interpolator<metavars>,
+      intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
+      0, later_temporal_id, block_logical_coords);
+  CHECK(holder.infos.size() == 2);
+  CHECK(holder.infos.at(temporal_id).uses_cached_interpolants);
+  CHECK(holder.infos.at(later_temporal_id).uses_cached_interpolants);
+
+  // Different points replace the cached points.
+  auto moved_block_logical_coords = block_logical_coords;
+  moved_block_logical_coords.pop_back();
+  TimeStepId moved_temporal_id(true, 0, Time(slab, Rational(13, 15)));
+  runner.simple_action<
+      mock_interpolator<metavars>,
+      intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
+      0, moved_temporal_id, moved_block_logical_coords);
+  CHECK(holder.infos.size() == 3);
+  CHECK_FALSE(holder.infos.at(temporal_id).uses_cached_interpolants);
+  CHECK_FALSE(holder.infos.at(later_temporal_id).uses_cached_interpolants);
+  CHECK(holder.infos.at(moved_temporal_id).uses_cached_interpolants);
+  CHECK(holder.cached_block_coord_holders == moved_block_logical_coords);
 
   // There should be no more queued actions; verify this.
   CHECK(runner.is_simple_action_queue_empty<mock_interpolator<metavars>>(0));
@@ -100,6 +100,8 @@ SPECTRE_TEST_CASE("Unit.Interpolation.Tags", "[Unit][NumericalAlgorithms]") {
       "InterpolatedVarsHolders");
   TestHelpers::db::test_simple_tag<intrp::Tags::NumberOfElements>(
       "NumberOfElements");
+  TestHelpers::db::test_simple_tag<intrp::Tags::VolumeDataBudget>(
+      "VolumeDataBudget");
   TestHelpers::db::test_simple_tag<intrp::Tags::InterpPointInfo<Metavars>>(
       "InterpPointInfo");
   TestHelpers::db::test_base_tag<intrp::Tags::InterpPointInfoBase>(
@@ -111,4 +113,8 @@ SPECTRE_TEST_CASE("Unit.Interpolation.Tags", "[Unit][NumericalAlgorithms]") {
   CHECK_FALSE(
       TestHelpers::test_option_tag<intrp::OptionTags::DumpVolumeDataOnFailure>(
           "false"));
+  CHECK(TestHelpers::test_option_tag<intrp::OptionTags::VolumeDataBudget>(
+            "MaxBytes: 100\n"
+            "Policy: Recompute") ==
+        intrp::VolumeDataBudget{100, intrp::OverBudgetPolicy::Recompute});
 }
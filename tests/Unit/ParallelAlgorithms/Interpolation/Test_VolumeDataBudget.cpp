@@ -0,0 +1,134 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolatorReceiveVolumeData.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataBudget.hpp"
+#include "Time/Tags/Time.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct SourceVar : db::SimpleTag {
+  using type = tnsr::I<DataVector, 3>;
+};
+struct TargetVar : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+struct Metavariables {
+  struct Target {
+    using vars_to_interpolate_to_target = tmpl::list<TargetVar>;
+  };
+  static constexpr size_t volume_dim = 3;
+  using interpolator_source_vars = tmpl::list<SourceVar>;
+  using interpolation_target_tags = tmpl::list<Target>;
+};
+
+void test_options() {
+  CHECK(get_output(intrp::OverBudgetPolicy::Warn) == "Warn");
+  CHECK(get_output(intrp::OverBudgetPolicy::Recompute) == "Recompute");
+  CHECK(get_output(intrp::OverBudgetPolicy::Error) == "Error");
+  CHECK(TestHelpers::test_creation<intrp::OverBudgetPolicy>("Recompute") ==
+        intrp::OverBudgetPolicy::Recompute);
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<intrp::OverBudgetPolicy>("Spill"),
+      Catch::Matchers::ContainsSubstring(
+          "OverBudgetPolicy must be 'Warn', 'Recompute', or 'Error'"));
+
+  const auto budget = TestHelpers::test_creation<intrp::VolumeDataBudget>(
+      "MaxBytes: 1000\n"
+      "Policy: Error");
+  using intrp::OverBudgetPolicy;
+  CHECK(budget == intrp::VolumeDataBudget{1000, OverBudgetPolicy::Error});
+  CHECK(budget != intrp::VolumeDataBudget{1000, OverBudgetPolicy::Warn});
+  CHECK(budget != intrp::VolumeDataBudget{999, OverBudgetPolicy::Error});
+  test_serialization(budget);
+}
+
+void test_buffered_bytes() {
+  using volume_vars_info_tag =
+      intrp::Tags::VolumeVarsInfo<Metavariables, ::Tags::Time>;
+  using Info = volume_vars_info_tag::Info;
+  const Mesh<3> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const size_t num_points = mesh.number_of_grid_points();
+  const auto make_info = [&mesh, &num_points](const bool with_target_vars) {
+    Info info{mesh,
+              Variables<tmpl::list<SourceVar>>{num_points, 1.0},
+              {}};
+    if (with_target_vars) {
+      get<intrp::Tags::VarsToInterpolateToTarget<Metavariables::Target>>(
+          info.vars_to_interpolate)
+          .initialize(num_points, 2.0);
+    }
+    return info;
+  };
+
+  volume_vars_info_tag::type volume_vars_info{};
+  CHECK(intrp::buffered_volume_data_bytes(volume_vars_info).empty());
+  CHECK(intrp::total_buffered_volume_data_bytes(volume_vars_info) == 0);
+
+  volume_vars_info[1.0].emplace(ElementId<3>{0}, make_info(false));
+  volume_vars_info[1.0].emplace(ElementId<3>{1}, make_info(true));
+  volume_vars_info[2.0].emplace(ElementId<3>{0}, make_info(false));
+  CHECK(volume_vars_info.at(1.0).at(ElementId<3>{1}).size_in_bytes() ==
+        4 * num_points * sizeof(double));
+  const size_t source_bytes = 3 * num_points * sizeof(double);
+  CHECK(intrp::buffered_volume_data_bytes(volume_vars_info) ==
+        std::map<double, size_t>{{1.0, 7 * num_points * sizeof(double)},
+                                 {2.0, source_bytes}});
+  const size_t total_bytes = 10 * num_points * sizeof(double);
+  CHECK(intrp::total_buffered_volume_data_bytes(volume_vars_info) ==
+        total_bytes);
+
+  // Within the budget nothing happens, and the Recompute policy is applied
+  // elsewhere.
+  intrp::Actions::detail::check_volume_data_budget(
+      intrp::VolumeDataBudget{total_bytes, intrp::OverBudgetPolicy::Error},
+      volume_vars_info, source_bytes);
+  intrp::Actions::detail::check_volume_data_budget(
+      intrp::VolumeDataBudget{0, intrp::OverBudgetPolicy::Recompute},
+      volume_vars_info, source_bytes);
+  // Over the budget, only warns when the budget is first exceeded.
+  intrp::Actions::detail::check_volume_data_budget(
+      intrp::VolumeDataBudget{total_bytes - 1, intrp::OverBudgetPolicy::Warn},
+      volume_vars_info, source_bytes);
+  intrp::Actions::detail::check_volume_data_budget(
+      intrp::VolumeDataBudget{0, intrp::OverBudgetPolicy::Warn},
+      volume_vars_info, source_bytes);
+  CHECK_THROWS_WITH(
+      intrp::Actions::detail::check_volume_data_budget(
+          intrp::VolumeDataBudget{total_bytes - 1,
+                                  intrp::OverBudgetPolicy::Error},
+          volume_vars_info, source_bytes),
+      Catch::Matchers::ContainsSubstring(
+          "The Interpolator buffers " + std::to_string(total_bytes) +
+          " bytes of volume data, more than its budget of " +
+          std::to_string(total_bytes - 1) + " bytes.") and
+          Catch::Matchers::ContainsSubstring(
+              "\n  2: " + std::to_string(source_bytes)));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.VolumeDataBudget",
+                  "[Unit]") {
+  test_options();
+  test_buffered_bytes();
+}
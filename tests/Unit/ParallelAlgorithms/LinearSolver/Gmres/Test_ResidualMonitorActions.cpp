@@ -144,7 +144,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     // Test residual monitor state
@@ -174,7 +174,7 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0.);
+        make_not_null(&runner), 0, 0., 0.);
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 0.);
     // Test element state
@@ -194,19 +194,23 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 2.);
-    // Test residual monitor state
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{1.5});
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.5});
+    // Test residual monitor state: the orthogonalization passes accumulate
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
           2.);
     // Test element state
     CHECK(get_element_inbox_tag(
               LinearSolver::gmres::detail::Tags::Orthogonalization<
                   TestLinearSolver>{})
-              .at(1) == 2.);
+              .at(1) == std::vector<double>{0.5});
   }
 
   SECTION("StoreOrthogonalization (final)") {
@@ -214,20 +218,24 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{3.});
     // Test intermediate residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
           3.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 4.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.});
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 2_st, std::vector<double>{4.});
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     // Test residual monitor state
@@ -268,15 +276,19 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{1.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 1.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 0.);
+        make_not_null(&runner), 0, 1_st, 2_st, std::vector<double>{0.});
     // Test residual monitor state
     // H = [[1.], [0.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -305,28 +317,32 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1.);
+        make_not_null(&runner), 0, 1., 0.);
     // Perform 2 mock iterations
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 1.);
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{1.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 4.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 2_st, std::vector<double>{4.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2_st, 1_st, 4.);
+        make_not_null(&runner), 0, 2_st, 0_st, std::vector<double>{2.5, 4.5});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2_st, 2_st, 25.);
+        make_not_null(&runner), 0, 2_st, 1_st, std::vector<double>{0.5, -0.5});
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2_st, 2_st, std::vector<double>{25.});
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
           blaze::DynamicMatrix<double>({{1., 3.}, {2., 4.}, {0., 5.}}));
@@ -355,15 +371,19 @@ SPECTRE_TEST_CASE(
         residual_monitor,
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 2.);
+        make_not_null(&runner), 0, 2., 0.);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{3.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 3.);
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 1.);
+        make_not_null(&runner), 0, 1_st, 2_st, std::vector<double>{1.});
     // Test residual monitor state
     // H = [[3.], [1.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -386,4 +406,37 @@ SPECTRE_TEST_CASE(
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
+
+  SECTION("ConvergeByForcingTerm") {
+    // Same iteration as the "StoreOrthogonalization (final)" section, where
+    // |r| / |r_initial| = 0.5547 doesn't reach the relative residual criterion
+    // of 0.5. The forcing term relaxes it.
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::InitializeResidualMagnitude<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2., 0.6);
+    CHECK(get_residual_monitor_tag(
+              LinearSolver::Tags::ForcingTerm<fields_tag>{}) == 0.6);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 0_st, std::vector<double>{3.});
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 1_st, std::vector<double>{0.});
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 2_st, std::vector<double>{4.});
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver>{})
+            .at(1);
+    const auto& has_converged = get<2>(element_inbox);
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
+  }
 }
@@ -28,6 +28,8 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Multigrid.Tags",
       "ParentRefinementLevels");
   TestHelpers::db::test_simple_tag<Tags::MaxLevels<TestSolver>>(
       "MaxLevels(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::AgglomerateCoarsestGrid<TestSolver>>(
+      "AgglomerateCoarsestGrid(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::OutputVolumeData<TestSolver>>(
       "OutputVolumeData(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::MultigridLevel>("MultigridLevel");
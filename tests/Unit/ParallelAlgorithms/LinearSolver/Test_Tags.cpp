@@ -42,6 +42,8 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Tags",
       LinearSolver::Tags::KrylovSubspaceBasis<Tag>>("KrylovSubspaceBasis(Tag)");
   TestHelpers::db::test_prefix_tag<LinearSolver::Tags::Preconditioned<Tag>>(
       "Preconditioned(Tag)");
+  TestHelpers::db::test_prefix_tag<LinearSolver::Tags::ForcingTerm<Tag>>(
+      "ForcingTerm(Tag)");
 
   {
     INFO("ResidualCompute");
@@ -0,0 +1,24 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "ParallelAlgorithms/NonlinearSolver/NewtonRaphson/ForcingTerm.hpp"
+
+SPECTRE_TEST_CASE("Unit.ParallelNewtonRaphson.ForcingTerm",
+                  "[Unit][ParallelAlgorithms]") {
+  using NonlinearSolver::newton_raphson::next_forcing_term;
+  // Slow nonlinear convergence keeps the forcing term at its maximum
+  CHECK(next_forcing_term(0.5, 0.99, 1., 0., 0.5) == 0.5);
+  // Fast nonlinear convergence decreases the forcing term, but no faster than
+  // gamma * eta^2 = 0.9 * 0.5^2 = 0.225
+  CHECK(next_forcing_term(0.5, 0.1, 1., 0., 0.5) == approx(0.225));
+  // Once gamma * eta^2 is small the safeguard is dropped, so the forcing term
+  // is gamma * (0.1 / 1)^2 = 0.009
+  CHECK(next_forcing_term(0.3, 0.1, 1., 0., 0.5) == approx(0.009));
+  // Don't oversolve: the linear solve needs to reduce the residual no further
+  // than to half the stopping residual
+  CHECK(next_forcing_term(0.3, 0.1, 1., 0.01, 0.5) == approx(0.05));
+  // Fall back to the maximum forcing term if there's no previous residual
+  CHECK(next_forcing_term(0.3, 0., 0., 0., 0.5) == 0.5);
+}
@@ -39,6 +39,8 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.NonlinearSolver.Tags",
   TestHelpers::db::test_simple_tag<
       Tags::MaxGlobalizationSteps<TestOptionsGroup>>(
       "MaxGlobalizationSteps(TestNonlinearSolver)");
+  TestHelpers::db::test_simple_tag<Tags::MaxForcingTerm<TestOptionsGroup>>(
+      "MaxForcingTerm(TestNonlinearSolver)");
   TestHelpers::db::test_prefix_tag<Tags::Globalization<Tag>>(
       "Globalization(Tag)");
   {
@@ -167,4 +167,15 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.SurfaceFinder.SurfaceFinder",
   test_bulging_surface(inertial_coords, mesh, ray_directions, element_map);
   test_radius_contour(inertial_coords, mesh, ray_directions, element_map);
   test_strahlkorper_input(inertial_coords, mesh, domain, id, element_map);
+
+  // Without grid points on the element boundaries the data is interpolated to
+  // the boundaries to check if they bracket a root
+  const auto gauss_mesh = domain::Initialization::create_initial_mesh(
+      extents, id, Spectral::Quadrature::Gauss);
+  const auto gauss_inertial_coords =
+      element_map(logical_coordinates(gauss_mesh));
+  test_radius_contour(gauss_inertial_coords, gauss_mesh, ray_directions,
+                      element_map);
+  test_strahlkorper_input(gauss_inertial_coords, gauss_mesh, domain, id,
+                          element_map);
 }
@@ -15,6 +15,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/Factory.hpp"
 #include "PointwiseFunctions/Hydro/SpecificEnthalpy.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 
 namespace {
@@ -86,6 +87,16 @@ void check_exact_polytrope() {
   const auto p_kappa_over_rho_sq =
       eos.kappa_times_p_over_rho_squared_from_density_and_energy(rho, eps);
   CHECK(get(p_kappa_over_rho_sq) == 4.25);
+
+  Scalar<double> bundled_p{};
+  Scalar<double> bundled_chi{};
+  Scalar<double> bundled_p_kappa_over_rho_sq{};
+  eos.thermodynamic_state_from_density_and_energy(
+      make_not_null(&bundled_p), make_not_null(&bundled_chi),
+      make_not_null(&bundled_p_kappa_over_rho_sq), rho, eps);
+  CHECK(get(bundled_p) == approx(34.0));
+  CHECK(get(bundled_chi) == approx(14.5));
+  CHECK(get(bundled_p_kappa_over_rho_sq) == approx(4.25));
 }
 
 template <bool IsRelativistic>
@@ -18,6 +18,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/PiecewisePolytropicFluid.hpp"
 #include "PointwiseFunctions/Hydro/SpecificEnthalpy.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 
 // parts of PiecewisePolytropicFluid
@@ -248,6 +249,42 @@ void check_edge_cases() {
         get(eos_single_polytrope.chi_from_density(rest_mass_density_high)));
 }
 
+template <bool IsRelativistic>
+void check_thermodynamic_state() {
+  const EquationsOfState::PiecewisePolytropicFluid<IsRelativistic> eos{
+      10.0, 0.5, 1.5, 2.0};
+  const Scalar<DataVector> rho{DataVector{1.0, 9.0, 10.0, 11.0, 20.0}};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> specific_internal_energy{};
+  Scalar<DataVector> chi{};
+  Scalar<DataVector> kappa_times_p_over_rho_squared{};
+  eos.thermodynamic_state_from_density(
+      make_not_null(&pressure), make_not_null(&specific_internal_energy),
+      make_not_null(&chi), make_not_null(&kappa_times_p_over_rho_squared), rho);
+  CHECK_ITERABLE_APPROX(pressure, eos.pressure_from_density(rho));
+  CHECK_ITERABLE_APPROX(specific_internal_energy,
+                        eos.specific_internal_energy_from_density(rho));
+  CHECK_ITERABLE_APPROX(chi, eos.chi_from_density(rho));
+  CHECK_ITERABLE_APPROX(
+      kappa_times_p_over_rho_squared,
+      eos.kappa_times_p_over_rho_squared_from_density(rho));
+
+  const Scalar<double> rho_high{11.0};
+  Scalar<double> pressure_high{};
+  Scalar<double> specific_internal_energy_high{};
+  Scalar<double> chi_high{};
+  Scalar<double> kappa_times_p_over_rho_squared_high{};
+  eos.thermodynamic_state_from_density(
+      make_not_null(&pressure_high),
+      make_not_null(&specific_internal_energy_high), make_not_null(&chi_high),
+      make_not_null(&kappa_times_p_over_rho_squared_high), rho_high);
+  CHECK(get(pressure_high) == approx(get(eos.pressure_from_density(rho_high))));
+  CHECK(get(specific_internal_energy_high) ==
+        approx(get(eos.specific_internal_energy_from_density(rho_high))));
+  CHECK(get(chi_high) == approx(get(eos.chi_from_density(rho_high))));
+  CHECK(get(kappa_times_p_over_rho_squared_high) == 0.0);
+}
+
 void check_dominant_energy_condition_at_bound() {
   MAKE_GENERATOR(generator);
   auto distribution = std::uniform_real_distribution<>{2.0, 3.0};  //[a,b)
@@ -488,4 +525,6 @@ SPECTRE_TEST_CASE(
   check_edge_cases<false>();
   check_exact<true>();
   check_exact<false>();
+  check_thermodynamic_state<true>();
+  check_thermodynamic_state<false>();
 }
@@ -15,6 +15,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/Spectral.hpp"
 #include "PointwiseFunctions/Hydro/SpecificEnthalpy.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 
 namespace {
@@ -69,6 +70,20 @@ void check_exact() {
     const auto rho_from_enthalpy = eos.rest_mass_density_from_enthalpy(
         hydro::relativistic_specific_enthalpy(rho, eps_c, p));
     CHECK_ITERABLE_APPROX(rho, rho_from_enthalpy);
+
+    Scalar<DataVector> bundled_p{};
+    Scalar<DataVector> bundled_eps{};
+    Scalar<DataVector> bundled_chi{};
+    Scalar<DataVector> bundled_p_kappa_over_rho_sq{};
+    eos.thermodynamic_state_from_density(
+        make_not_null(&bundled_p), make_not_null(&bundled_eps),
+        make_not_null(&bundled_chi),
+        make_not_null(&bundled_p_kappa_over_rho_sq), rho);
+    CHECK_ITERABLE_APPROX(bundled_p, p_expected);
+    CHECK_ITERABLE_APPROX(bundled_eps, eps_expected);
+    CHECK_ITERABLE_APPROX(get(bundled_chi), chi_expected);
+    CHECK_ITERABLE_APPROX(bundled_p_kappa_over_rho_sq,
+                          p_c_kappa_c_over_rho_sq_expected);
   }
   // Test double functions
   {
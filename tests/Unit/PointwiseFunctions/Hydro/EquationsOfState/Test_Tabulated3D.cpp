@@ -4,8 +4,10 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <limits>
+#include <memory>
 #include <pup.h>
 #include <random>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -28,6 +30,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/Factory.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 
 SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
@@ -216,6 +219,53 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
                      vector_state[1], eps_interp_vector, vector_state[2]))[0]) <
         1.e-12);
 
+  // The combined interpolation must agree with the individual functions
+  const auto check_thermodynamic_state = [&eos](const auto& rest_mass_density,
+                                                const auto& temperature,
+                                                const auto& electron_fraction) {
+    using ScalarType = std::decay_t<decltype(rest_mass_density)>;
+    ScalarType pressure{};
+    ScalarType specific_internal_energy{};
+    ScalarType sound_speed_squared{};
+    eos.thermodynamic_state_from_density_and_temperature(
+        make_not_null(&pressure), make_not_null(&specific_internal_energy),
+        make_not_null(&sound_speed_squared), rest_mass_density, temperature,
+        electron_fraction);
+    CHECK_ITERABLE_APPROX(pressure,
+                          eos.pressure_from_density_and_temperature(
+                              rest_mass_density, temperature,
+                              electron_fraction));
+    CHECK_ITERABLE_APPROX(
+        specific_internal_energy,
+        eos.specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+    CHECK_ITERABLE_APPROX(
+        sound_speed_squared,
+        eos.sound_speed_squared_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction));
+  };
+  check_thermodynamic_state(state[1], state[0], state[2]);
+  {
+    std::uniform_real_distribution<double> dist_unit(0.0, 1.0);
+    Scalar<DataVector> random_rest_mass_density{DataVector{10}};
+    Scalar<DataVector> random_temperature{DataVector{10}};
+    Scalar<DataVector> random_electron_fraction{DataVector{10}};
+    // Sample slightly beyond the table to also cover the clamping
+    for (size_t s = 0; s < 10; ++s) {
+      const double x = -0.1 + 1.2 * dist_unit(gen);
+      const double y = -0.1 + 1.2 * dist_unit(gen);
+      const double z = -0.1 + 1.2 * dist_unit(gen);
+      get(random_temperature)[s] =
+          std::exp(lower_bounds[0] + x * (upper_bounds[0] - lower_bounds[0]));
+      get(random_rest_mass_density)[s] =
+          std::exp(lower_bounds[1] + y * (upper_bounds[1] - lower_bounds[1]));
+      get(random_electron_fraction)[s] =
+          lower_bounds[2] + z * (upper_bounds[2] - lower_bounds[2]);
+    }
+    check_thermodynamic_state(random_rest_mass_density, random_temperature,
+                              random_electron_fraction);
+  }
+
   auto test_against_reference_values = [&](auto& this_eos) {
     get(state[1]) = 1.e-4;
 
@@ -245,6 +295,20 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
 
   test_against_reference_values(eos);
 
+  // EoS read from the same file share their table, and copies remain valid
+  // after the original is destroyed
+  {
+    auto first = std::make_unique<TEoS>(h5_file_name, "dd2");
+    const TEoS second{h5_file_name, "dd2"};
+    const TEoS copy = *first;
+    first.reset();
+    CHECK(copy == second);
+    CHECK(copy == eos);
+    test_against_reference_values(copy);
+    CHECK(serialize_and_deserialize(copy) == eos);
+  }
+  CHECK(serialize_and_deserialize(eos) == eos);
+
   // Test serialization
 
   register_derived_classes_with_charm<EoS::EquationOfState<true, 3>>();
@@ -29,6 +29,7 @@
 #include "Time/Tags/TimeStepper.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforth.hpp"
 #include "Time/TimeSteppers/Rk3HesthavenSsp.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/Gsl.hpp"
@@ -73,6 +74,66 @@ struct Component {
                  Parallel::PhaseActions<Parallel::Phase::Testing,
                                         tmpl::list<Actions::ChangeSlabSize>>>;
 };
+
+void test_fixed_step_size() {
+  register_classes_with_charm<TimeSteppers::AdamsBashforth>();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {std::make_unique<TimeSteppers::AdamsBashforth>(2)}};
+
+  ActionTesting::emplace_component_and_initialize<Component>(&runner, 0, {});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+
+  auto& box = ActionTesting::get_databox<Component>(make_not_null(&runner), 0);
+
+  const Slab slab(1.5, 2.0);
+  const TimeDelta step = slab.duration() / 2;
+  const auto set_time_step_id = [&box, &step](const TimeStepId& new_id) {
+    db::mutate<Tags::TimeStepId, Tags::Next<Tags::TimeStepId>, Tags::TimeStep,
+               Tags::Next<Tags::TimeStep>>(
+        [&new_id, &step](const gsl::not_null<TimeStepId*> id,
+                         const gsl::not_null<TimeStepId*> next_id,
+                         const gsl::not_null<TimeDelta*> time_step,
+                         const gsl::not_null<TimeDelta*> next_time_step,
+                         const TimeStepper& stepper) {
+          *id = new_id;
+          *time_step = step;
+          *next_time_step = step;
+          *next_id = stepper.next_time_id(*id, *time_step);
+        },
+        make_not_null(&box), db::get<Tags::TimeStepper<>>(box));
+  };
+  db::mutate<Tags::AdaptiveSteppingDiagnostics>(
+      [](const gsl::not_null<AdaptiveSteppingDiagnostics*> diags) {
+        *diags = AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5};
+      },
+      make_not_null(&box));
+
+  using ExpectedMessages = ChangeSlabSize_detail::NumberOfExpectedMessagesInbox;
+  using NewSize = ChangeSlabSize_detail::NewSlabSizeInbox;
+  auto& inboxes = runner.inboxes<Component>().at(0);
+
+  // The step size cannot be changed while self-starting, so the
+  // action should not wait for the new size.
+  set_time_step_id(TimeStepId(true, -1, slab.start()));
+  get<ExpectedMessages>(inboxes)[-1].insert(ExpectedMessages::NoData{});
+  REQUIRE(ActionTesting::next_action_if_ready<Component>(
+      make_not_null(&runner), 0));
+  CHECK(get<ExpectedMessages>(inboxes).empty());
+  CHECK(db::get<Tags::TimeStep>(box) == step);
+  CHECK(db::get<Tags::AdaptiveSteppingDiagnostics>(box) ==
+        AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5});
+
+  // A size arriving after the change was skipped is discarded at the
+  // next slab boundary.
+  get<NewSize>(inboxes)[-1].insert(0.1);
+  set_time_step_id(TimeStepId(true, 0, slab.start()));
+  runner.next_action<Component>(0);
+  CHECK(get<NewSize>(inboxes).empty());
+  CHECK(db::get<Tags::TimeStep>(box) == step);
+  CHECK(db::get<Tags::AdaptiveSteppingDiagnostics>(box) ==
+        AdaptiveSteppingDiagnostics{1, 2, 3, 4, 5});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Time.Actions.ChangeSlabSize", "[Unit][Time][Actions]") {
@@ -263,4 +324,6 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.ChangeSlabSize", "[Unit][Time][Actions]") {
       get<NewSize>(inboxes).clear();
     }
   }
+
+  test_fixed_step_size();
 }
@@ -195,6 +195,36 @@ SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl", "[Unit][Time]") {
           stepper_order);
       CHECK(adjusted_second_result.first < second_result.first);
     }
+    {
+      INFO("Test error control lookahead");
+      const LtsErrorControl error_control{5.0e-4, 0.0, 2.0, 0.5, 0.95};
+      const LtsErrorControl lookahead_error_control{
+          5.0e-4, 0.0, 2.0, 0.5, 0.95, true};
+      const double expected_linf_error = max(flattened_step_errors) / 5.0e-4;
+      const decltype(step_errors) error{2.4 * step_errors};
+      const decltype(step_errors) previous_error{1.2 * step_errors};
+      const auto result = get_suggestion(error_control, step_values, error,
+                                         previous_error, 1.0, stepper_order);
+      const auto lookahead_result =
+          get_suggestion(lookahead_error_control, step_values, error,
+                         previous_error, 1.0, stepper_order);
+      const double pi_step =
+          0.95 * pow(2.4 * expected_linf_error, -0.7 / stepper_order) *
+          pow(1.2 * expected_linf_error, 0.4 / stepper_order);
+      // The error is predicted to grow by another factor of 2.
+      const double lookahead_step =
+          0.95 * pow(4.8 * expected_linf_error, -1.0 / stepper_order);
+      CHECK(approx(result.first) == pi_step);
+      CHECK(approx(lookahead_result.first) ==
+            std::min(pi_step, lookahead_step));
+      CHECK(lookahead_result.second == result.second);
+
+      // No lookahead if the error is decreasing.
+      CHECK(get_suggestion(lookahead_error_control, step_values,
+                           previous_error, error, 1.0, stepper_order) ==
+            get_suggestion(error_control, step_values, previous_error, error,
+                           1.0, stepper_order));
+    }
     {
       INFO("Test error control step fixed by relative tolerance");
       const LtsErrorControl error_control{0.0, 3.0e-4, 2.0, 0.5, 0.95};
@@ -264,7 +294,8 @@ SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl", "[Unit][Time]") {
       "  AbsoluteTolerance: 1.0e-5\n"
       "  RelativeTolerance: 1.0e-4\n"
       "  MaxFactor: 2.1\n"
-      "  MinFactor: 0.5");
+      "  MinFactor: 0.5\n"
+      "  Lookahead: true");
   TestHelpers::test_factory_creation<
       StepChooser<StepChooserUse::LtsStep>,
       StepChoosers::ErrorControl<StepChooserUse::LtsStep, EvolvedVariablesTag,
@@ -274,7 +305,8 @@ SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl", "[Unit][Time]") {
       "  AbsoluteTolerance: 1.0e-5\n"
       "  RelativeTolerance: 1.0e-4\n"
       "  MaxFactor: 2.1\n"
-      "  MinFactor: 0.5");
+      "  MinFactor: 0.5\n"
+      "  Lookahead: true");
 
   CHECK(StepChoosers::ErrorControl<StepChooserUse::LtsStep, EvolvedVariablesTag,
                                    ErrorControlSelecter>{}
@@ -298,6 +330,7 @@ SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl", "[Unit][Time]") {
                   "    RelativeTolerance: 1.0e-4\n"
                   "    MaxFactor: 2.1\n"
                   "    MinFactor: 0.5\n"
+                  "    Lookahead: false\n"
                   "- Increase:\n"
                   "    Factor: 2\n"
                   "- Constant: 0.5");
@@ -352,6 +385,7 @@ SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorControl", "[Unit][Time]") {
               "              RelativeTolerance: 1.0e-4\n"
               "              MaxFactor: 2.1\n"
               "              MinFactor: 0.5\n"
+              "              Lookahead: false\n"
               "          - Constant: 0.5");
         },
         make_not_null(&box));
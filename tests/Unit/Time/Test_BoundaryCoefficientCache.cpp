@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "Time/BoundaryCoefficientCache.hpp"
+
+namespace {
+SPECTRE_TEST_CASE("Unit.Time.BoundaryCoefficientCache", "[Unit][Time]") {
+  TimeSteppers::BoundaryCoefficientCache cache{};
+  const std::vector<double> local_times{-2.0, -1.0, 0.0};
+  const std::vector<double> remote_times{-1.5, -1.0, -0.5, 0.0};
+  CHECK(cache.find(local_times, remote_times) == nullptr);
+  cache.insert(local_times, remote_times, {{0.25, 1, 2}, {0.75, 2, 3}});
+  CHECK(cache.size() == 1);
+
+  {
+    const std::vector<double> perturbed_local_times{-2.0 + 1.0e-15, -1.0,
+                                                    0.0};
+    const auto* const terms = cache.find(perturbed_local_times, remote_times);
+    REQUIRE(terms != nullptr);
+    REQUIRE(terms->size() == 2);
+    CHECK((*terms)[0].coefficient == 0.25);
+    CHECK((*terms)[0].local_index == 1);
+    CHECK((*terms)[0].remote_index == 2);
+    CHECK((*terms)[1].coefficient == 0.75);
+  }
+
+  // Different times
+  CHECK(cache.find(local_times, std::vector<double>{-1.5, -1.0, 0.0}) ==
+        nullptr);
+  CHECK(cache.find(local_times, std::vector<double>{-1.25, -1.0, -0.5, 0.0}) ==
+        nullptr);
+  // Same times to roundoff, but a local and a remote time no longer
+  // coincide.
+  CHECK(cache.find(local_times,
+                   std::vector<double>{-1.5, -1.0 + 1.0e-15, -0.5, 0.0}) ==
+        nullptr);
+  CHECK(cache.hits() == 1);
+  CHECK(cache.misses() == 4);
+
+  // The oldest entry is replaced when the cache is full.
+  for (size_t i = 0; i < TimeSteppers::BoundaryCoefficientCache::maximum_size;
+       ++i) {
+    const std::vector<double> times{static_cast<double>(i + 1)};
+    cache.insert(times, times, {});
+  }
+  CHECK(cache.size() == TimeSteppers::BoundaryCoefficientCache::maximum_size);
+  CHECK(cache.find(local_times, remote_times) == nullptr);
+  CHECK(cache.find(std::vector<double>{2.0}, std::vector<double>{2.0}) !=
+        nullptr);
+
+  cache.clear();
+  CHECK(cache.size() == 0);
+  CHECK(cache.hits() == 2);
+  CHECK(cache.misses() == 5);
+}
+}  // namespace
@@ -359,9 +359,68 @@ void test_boundary_history() {
               mapping_history.remote_begin() + 1) == 31.0);
   }
 }
+
+void test_recycled_cache_entries() {
+  INFO("Recycled cache entries");
+  BoundaryHistoryType history{2};
+  size_t coupling_calls = 0;
+  const auto coupling = [&coupling_calls](const std::string& local,
+                                          const std::vector<int>& remote) {
+    ++coupling_calls;
+    return 100.0 * std::stod(local) + remote[0];
+  };
+  const auto evaluator = history.evaluator(coupling);
+  const auto cleaner = history.cleaner();
+
+  history.local_insert(make_time_id(1.), get_output(1));
+  history.remote_insert(make_time_id(1.), std::vector<int>{1});
+  CHECK(*evaluator(history.local_begin(), history.remote_begin()) == 101.0);
+  // Inserting at the front must not change which entries the cached
+  // values belong to.
+  history.local_insert_initial(make_time_id(0.), get_output(0));
+  history.remote_insert_initial(make_time_id(0.), std::vector<int>{0});
+  CHECK(coupling_calls == 1);
+  CHECK(*evaluator(history.local_begin() + 1, history.remote_begin() + 1) ==
+        101.0);
+  CHECK(coupling_calls == 1);
+  CHECK(*evaluator(history.local_begin(), history.remote_begin() + 1) == 1.0);
+  CHECK(coupling_calls == 2);
+
+  // Steady state: each step adds and removes one entry on each side and
+  // evaluates every remaining coupling once.
+  size_t expected_calls = coupling_calls;
+  for (int step = 2; step < 20; ++step) {
+    history.local_insert(make_time_id(step), get_output(step));
+    history.remote_insert(make_time_id(step), std::vector<int>{step});
+    cleaner.local_mark_unneeded(history.local_end() - 2);
+    cleaner.remote_mark_unneeded(history.remote_end() - 2);
+    REQUIRE(history.local_size() == 2);
+    REQUIRE(history.remote_size() == 2);
+    for (size_t local = 0; local < 2; ++local) {
+      for (size_t remote = 0; remote < 2; ++remote) {
+        const auto local_it =
+            history.local_begin() + static_cast<std::ptrdiff_t>(local);
+        const auto remote_it =
+            history.remote_begin() + static_cast<std::ptrdiff_t>(remote);
+        CHECK(*evaluator(local_it, remote_it) ==
+              100.0 * local_it->value() + remote_it->value());
+      }
+    }
+    // Only the couplings involving the new entries are evaluated.
+    expected_calls += 3;
+    CHECK(coupling_calls == expected_calls);
+  }
+
+  const auto copy = serialize_and_deserialize(history);
+  const auto copy_evaluator = copy.evaluator(coupling);
+  CHECK(*copy_evaluator(copy.local_begin(), copy.remote_begin() + 1) ==
+        1819.0);
+  CHECK(coupling_calls == expected_calls);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Time.BoundaryHistory", "[Unit][Time]") {
   test_boundary_history<true>();
   test_boundary_history<false>();
+  test_recycled_cache_entries();
 }
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cmath>
 #include <memory>
 #include <random>
 #include <utility>
@@ -25,6 +26,7 @@
 #include "Time/StepChoosers/StepChooser.hpp"
 #include "Time/Tags/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
+#include "Time/Tags/ImplicitHistory.hpp"
 #include "Time/Tags/IsUsingTimeSteppingErrorControl.hpp"
 #include "Time/Tags/PreviousStepperError.hpp"
 #include "Time/Tags/StepChoosers.hpp"
@@ -37,6 +39,8 @@
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/AdamsBashforth.hpp"
+#include "Time/TimeSteppers/Heun2.hpp"
+#include "Time/TimeSteppers/ImexTimeStepper.hpp"
 #include "Time/TimeSteppers/LtsTimeStepper.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
@@ -79,6 +83,81 @@ struct Metavariables {
   using component_list = tmpl::list<>;
 };
 
+struct StiffDecayRate : db::SimpleTag {
+  using type = double;
+};
+
+struct ImexSystem {
+  using variables_tag = EvolvedVariable;
+
+  struct implicit_sector {
+    using argument_tags = tmpl::list<StiffDecayRate>;
+
+    static void source(const gsl::not_null<DataVector*> source,
+                       const DataVector& vars, const double rate) {
+      *source = -rate * vars;
+    }
+
+    static void solve(const gsl::not_null<DataVector*> vars,
+                      const double weight, const double rate) {
+      *vars /= 1.0 + weight * rate;
+    }
+  };
+};
+
+void test_imex() {
+  static_assert(has_implicit_sector_v<ImexSystem>);
+  static_assert(not has_implicit_sector_v<Metavariables::system>);
+
+  const Slab slab{0.0, 1.0};
+  const TimeDelta time_step = slab.duration();
+  const double dt = time_step.value();
+  const double explicit_rate = 0.5;
+  // Much too stiff for the explicit stepper with this step size.
+  const double implicit_rate = 100.0;
+  const auto update_rhs = [&explicit_rate](
+                              const gsl::not_null<DataVector*> dt_y,
+                              const DataVector& y) {
+    *dt_y = -explicit_rate * y;
+  };
+
+  const TimeSteppers::Heun2 stepper{};
+  auto box = db::create<db::AddSimpleTags<
+      Tags::TimeStepId, Tags::TimeStep, EvolvedVariable,
+      Tags::dt<EvolvedVariable>,
+      Tags::HistoryEvolvedVariables<EvolvedVariable>,
+      Tags::ImplicitHistory<EvolvedVariable>,
+      Tags::TimeStepper<ImexTimeStepper>, StiffDecayRate>>(
+      TimeStepId{true, 0_st, slab.start()}, time_step, DataVector{3, 1.0},
+      DataVector{3, 0.0},
+      typename Tags::HistoryEvolvedVariables<EvolvedVariable>::type{2},
+      typename Tags::ImplicitHistory<EvolvedVariable>::type{2},
+      static_cast<std::unique_ptr<ImexTimeStepper>>(
+          std::make_unique<TimeSteppers::Heun2>()),
+      implicit_rate);
+
+  for (size_t substep = 0; substep < stepper.number_of_substeps(); ++substep) {
+    db::mutate<Tags::dt<EvolvedVariable>>(update_rhs, make_not_null(&box),
+                                          db::get<EvolvedVariable>(box));
+    take_step<ImexSystem, false>(make_not_null(&box));
+    db::mutate<Tags::TimeStepId>(
+        [&stepper, &time_step](const gsl::not_null<TimeStepId*> id) {
+          *id = stepper.next_time_id(*id, time_step);
+        },
+        make_not_null(&box));
+  }
+
+  // Explicit Heun combined with the implicit trapezoidal rule.
+  const double stage = (1.0 - explicit_rate * dt - 0.5 * implicit_rate * dt) /
+                       (1.0 + 0.5 * implicit_rate * dt);
+  const double expected =
+      1.0 - 0.5 * dt * (explicit_rate + implicit_rate) * (1.0 + stage);
+  CHECK_ITERABLE_APPROX(db::get<EvolvedVariable>(box),
+                        (DataVector{3, expected}));
+  CHECK(std::abs(expected) < 1.0);
+  CHECK(db::get<Tags::TimeStepId>(box).substep_time() == 1.0);
+}
+
 void test_gts() {
   const Slab slab{0.0, 1.00};
   const TimeDelta time_step = slab.duration() / 4;
@@ -246,4 +325,5 @@ void test_lts() {
 SPECTRE_TEST_CASE("Unit.Time.TakeStep", "[Unit][Time]") {
   test_gts();
   test_lts();
+  test_imex();
 }
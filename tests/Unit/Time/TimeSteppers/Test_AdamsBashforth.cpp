@@ -270,6 +270,17 @@ void do_lts_test(const std::array<TimeDelta, 2>& dt) {
       next_check += dt[0];
     }
   }
+
+  // With one step size a multiple of the other, the pattern of history
+  // times repeats every larger step, so only the steps of the first
+  // larger step compute their coefficients.
+  const double step_ratio = dt[1] / dt[0];
+  if (dt[0] != dt[1] and (step_ratio == std::round(step_ratio) or
+                          1.0 / step_ratio == std::round(1.0 / step_ratio))) {
+    const auto& cache = history.coefficient_cache();
+    CHECK(cache.misses() == static_cast<size_t>(std::max(step_ratio, 1.0)));
+    CHECK(cache.hits() > 0);
+  }
 }
 
 void check_lts_vts() {
@@ -160,6 +160,24 @@ void test_unaligned_step() {
                        Time(slab, {1, 3}), Time{slab, 1}),
       (ac::OrderVector<double>{2.0 / 9.0, 4.0 / 9.0}));
 }
+
+void test_memoization() {
+  const auto check_control_times =
+      [](const ac::OrderVector<double>& control_times) {
+        CHECK(ac::normalized_variable_coefficients(control_times) ==
+              ac::variable_coefficients(control_times, 0.0, 1.0));
+      };
+  const ac::OrderVector<double> control_times{-2.5, -1.5, -0.5, 0.0};
+  check_control_times(control_times);
+  // Cached
+  check_control_times(control_times);
+  // Push the first entry out of the cache and recompute it.
+  for (size_t i = 0; i <= ac::memoization_cache_size; ++i) {
+    check_control_times({-1.0 - static_cast<double>(i), 0.0});
+  }
+  check_control_times(control_times);
+  check_control_times({-1.0, 0.0});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsCoefficients", "[Unit][Time]") {
@@ -170,4 +188,5 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsCoefficients", "[Unit][Time]") {
 
   test_rational_computation();
   test_unaligned_step();
+  test_memoization();
 }
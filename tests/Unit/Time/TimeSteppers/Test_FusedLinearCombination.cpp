@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Time/TimeSteppers/FusedLinearCombination.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+template <typename T>
+void test_vector(const T& initial, const T& first, const T& second) {
+  const TimeSteppers::FusedTerms<T> terms{
+      {0.5, 0.25, &first}, {0.0, -2.0, &second}, {3.0, 0.0, &second}};
+  const T expected_result = initial + 0.5 * first + 3.0 * second;
+  const T expected_error = 0.25 * first - 2.0 * second;
+
+  T result(initial.size(), 1.0e10);
+  TimeSteppers::fused_linear_combination(make_not_null(&result), initial,
+                                         terms);
+  CHECK_ITERABLE_APPROX(result, expected_result);
+
+  T error(initial.size(), 1.0e10);
+  result = T(initial.size(), 1.0e10);
+  TimeSteppers::fused_linear_combination(make_not_null(&result),
+                                         make_not_null(&error), initial, terms);
+  CHECK_ITERABLE_APPROX(result, expected_result);
+  CHECK_ITERABLE_APPROX(error, expected_error);
+
+  // Updating in place
+  result = initial;
+  TimeSteppers::fused_linear_combination(make_not_null(&result), result,
+                                         terms);
+  CHECK_ITERABLE_APPROX(result, expected_result);
+}
+
+template <typename T>
+void test_scalar(const T& initial, const T& first, const T& second) {
+  const TimeSteppers::FusedTerms<T> terms{{0.5, 0.25, &first},
+                                          {3.0, -2.0, &second}};
+  T result{};
+  T error{};
+  TimeSteppers::fused_linear_combination(make_not_null(&result),
+                                         make_not_null(&error), initial, terms);
+  CHECK_ITERABLE_APPROX(result, initial + 0.5 * first + 3.0 * second);
+  CHECK_ITERABLE_APPROX(error, 0.25 * first - 2.0 * second);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.FusedLinearCombination",
+                  "[Unit][Time]") {
+  test_scalar(1.0, 2.0, 3.0);
+  test_scalar(std::complex<double>(1.0, 2.0), std::complex<double>(3.0, 4.0),
+              std::complex<double>(5.0, 6.0));
+
+  // Sizes smaller than, equal to, and not a multiple of the block size.
+  for (const size_t size : {1_st, 256_st, 1000_st}) {
+    DataVector initial(size);
+    DataVector first(size);
+    DataVector second(size);
+    ComplexDataVector complex_initial(size);
+    ComplexDataVector complex_first(size);
+    ComplexDataVector complex_second(size);
+    for (size_t i = 0; i < size; ++i) {
+      const auto x = static_cast<double>(i);
+      initial[i] = 1.0 + x;
+      first[i] = 2.0 - 0.5 * x;
+      second[i] = 0.25 * x * x;
+      complex_initial[i] = std::complex<double>(initial[i], first[i]);
+      complex_first[i] = std::complex<double>(first[i], second[i]);
+      complex_second[i] = std::complex<double>(second[i], initial[i]);
+    }
+    test_vector(initial, first, second);
+    test_vector(complex_initial, complex_first, complex_second);
+  }
+}
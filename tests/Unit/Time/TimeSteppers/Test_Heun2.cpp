@@ -8,6 +8,7 @@
 #include "Helpers/Time/TimeSteppers/RungeKutta.hpp"
 #include "Helpers/Time/TimeSteppers/TimeStepperTestUtils.hpp"
 #include "Time/TimeSteppers/Heun2.hpp"
+#include "Time/TimeSteppers/ImexTimeStepper.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.Heun2", "[Unit][Time]") {
@@ -17,7 +18,9 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.Heun2", "[Unit][Time]") {
   CHECK(stepper.error_estimate_order() == 1);
   CHECK(stepper.number_of_substeps() == 2);
   CHECK(stepper.number_of_substeps_for_error() == 2);
+  CHECK(stepper.imex_order() == 2);
   TestHelpers::RungeKutta::check_tableau(stepper);
+  TestHelpers::RungeKutta::check_implicit_tableau(stepper);
 
   TimeStepperTestUtils::check_substep_properties(stepper);
   TimeStepperTestUtils::integrate_test(stepper, 2, 0, 1.0, 1.0e-6);
@@ -32,10 +35,12 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.Heun2", "[Unit][Time]") {
   TimeStepperTestUtils::stability_test(stepper);
   TimeStepperTestUtils::check_convergence_order(stepper, {10, 50});
   TimeStepperTestUtils::check_dense_output(stepper, 2_st);
+  TimeStepperTestUtils::check_imex_convergence_order(stepper, {10, 50});
 
   TestHelpers::test_factory_creation<TimeStepper, TimeSteppers::Heun2>("Heun2");
   test_serialization(stepper);
   test_serialization_via_base<TimeStepper, TimeSteppers::Heun2>();
+  test_serialization_via_base<ImexTimeStepper, TimeSteppers::Heun2>();
   // test operator !=
   CHECK_FALSE(stepper != stepper);
 }
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <initializer_list>
+#include <limits>
 #include <memory>
 #include <pup.h>
 
@@ -70,4 +71,20 @@ SPECTRE_TEST_CASE("Unit.Time.Triggers.Slabs", "[Unit][Time]") {
         },
         make_not_null(&box));
   }
+
+  const auto check_bound = [&sent_trigger](const std::int64_t slab_number,
+                                           const std::int64_t expected) {
+    CAPTURE(slab_number);
+    const auto bound = sent_trigger->next_firing_bound(slab_number, 0.0);
+    REQUIRE(bound.has_value());
+    CHECK(bound->slab_number == expected);
+    CHECK(bound->time == -std::numeric_limits<double>::infinity());
+  };
+  check_bound(0, 3);
+  check_bound(2, 3);
+  check_bound(3, 6);
+  check_bound(7, 8);
+  check_bound(8, std::numeric_limits<std::int64_t>::max());
+  check_bound(100, std::numeric_limits<std::int64_t>::max());
+  CHECK_FALSE(sent_trigger->next_firing_bound(-1, 0.0).has_value());
 }
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cmath>
+#include <cstdint>
 #include <initializer_list>
 #include <limits>
 #include <memory>
@@ -84,8 +85,24 @@ SPECTRE_TEST_CASE("Unit.Time.Triggers.Times", "[Unit][Time]") {
   check(inaccurate_1, 1.0, {1.0}, false);
   check(inaccurate_1, 1.0e5, {1.0}, true);
 
-  TestHelpers::test_creation<std::unique_ptr<Trigger>, Metavariables>(
-      "Times:\n"
-      "  Specified:\n"
-      "    Values: [2.0, 1.0, 3.0, 2.0]");
+  const auto trigger =
+      TestHelpers::test_creation<std::unique_ptr<Trigger>, Metavariables>(
+          "Times:\n"
+          "  Specified:\n"
+          "    Values: [2.0, 1.0, 3.0, 2.0]");
+
+  const auto check_bound = [&trigger](const double time,
+                                      const double expected) {
+    CAPTURE(time);
+    const auto bound = trigger->next_firing_bound(5, time);
+    REQUIRE(bound.has_value());
+    CHECK(bound->time == expected);
+    CHECK(bound->slab_number == std::numeric_limits<std::int64_t>::min());
+  };
+  check_bound(0.0, 1.0);
+  check_bound(1.0, 2.0);
+  check_bound(1.6, 2.0);
+  check_bound(2.2, 3.0);
+  check_bound(3.0, infinity);
+  check_bound(4.0, infinity);
 }
@@ -21,6 +21,14 @@ SPECTRE_TEST_CASE("Unit.Utilities.System.Prefetch", "[Unit][Utilities]") {
   sys::prefetch<sys::PrefetchTo::WriteL1Cache>(vector.data());
   sys::prefetch<sys::PrefetchTo::WriteL2Cache>(vector.data());
 
+  sys::prefetch<sys::PrefetchTo::L2Cache>(vector.data(),
+                                          vector.size() * sizeof(double));
+  sys::prefetch<sys::PrefetchTo::L2Cache>(vector.data(), 0);
+  sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(vector);
+  const std::vector<double> large_vector(10000);
+  sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(large_vector);
+  sys::prefetch_start_of<sys::PrefetchTo::L2Cache>(std::vector<double>{});
+
   CHECK(get_output(sys::PrefetchTo::L1Cache) == "L1Cache");
   CHECK(get_output(sys::PrefetchTo::L2Cache) == "L2Cache");
   CHECK(get_output(sys::PrefetchTo::L3Cache) == "L3Cache");
@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Utilities/System/TaskPool.hpp"
+
+SPECTRE_TEST_CASE("Unit.Utilities.System.TaskPool", "[Unit][Utilities]") {
+  sys::TaskPool pool{};
+  std::vector<size_t> visits(1000, 0);
+  std::atomic<size_t> number_of_calls{0};
+  const auto visit = [&visits, &number_of_calls](const size_t begin,
+                                                 const size_t end) {
+    ++number_of_calls;
+    for (size_t i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+  };
+  const auto check_visits = [&visits]() {
+    for (size_t i = 0; i < visits.size(); ++i) {
+      CAPTURE(i);
+      CHECK(visits[i] == 1);
+      visits[i] = 0;
+    }
+  };
+
+  {
+    INFO("Not split");
+    pool.set_max_chunks(1);
+    pool.parallel_for(visits.size(), 1, visit);
+    CHECK(number_of_calls == 1);
+    check_visits();
+    CHECK_FALSE(pool.run_pending_chunk());
+  }
+  {
+    INFO("Split on the calling thread");
+    number_of_calls = 0;
+    pool.set_max_chunks(8);
+    pool.parallel_for(visits.size(), 1, visit);
+    CHECK(number_of_calls == 8);
+    check_visits();
+    number_of_calls = 0;
+    pool.parallel_for(visits.size(), 400, visit);
+    CHECK(number_of_calls == 3);
+    check_visits();
+  }
+  {
+    INFO("Split with helper threads");
+    number_of_calls = 0;
+    pool.set_max_chunks(100);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> helpers{};
+    for (size_t i = 0; i < 3; ++i) {
+      helpers.emplace_back([&pool, &done]() {
+        while (not done.load()) {
+          pool.run_pending_chunk();
+        }
+      });
+    }
+    for (size_t i = 0; i < 10; ++i) {
+      pool.parallel_for(visits.size(), 1, visit);
+      check_visits();
+    }
+    done = true;
+    for (auto& helper : helpers) {
+      helper.join();
+    }
+    CHECK(number_of_calls == 1000);
+  }
+  {
+    INFO("Exceptions");
+    pool.set_max_chunks(4);
+    CHECK_THROWS_WITH(pool.parallel_for(visits.size(), 1,
+                                        [](const size_t begin, const size_t) {
+                                          if (begin > 0) {
+                                            throw std::runtime_error("Chunk");
+                                          }
+                                        }),
+                      Catch::Matchers::ContainsSubstring("Chunk"));
+    CHECK_FALSE(pool.run_pending_chunk());
+  }
+}
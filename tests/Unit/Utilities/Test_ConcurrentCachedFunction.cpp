@@ -0,0 +1,149 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Utilities/ConcurrentCachedFunction.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.Utilities.ConcurrentCachedFunction",
+                  "[Unit][Utilities]") {
+  std::atomic<size_t> call_count{0};
+  const auto func = [&call_count](const size_t n) {
+    ++call_count;
+    return std::vector<double>(n, 1.0);
+  };
+
+  // [make_concurrent_cached_function]
+  const auto cached = make_concurrent_cached_function<size_t>(func);
+  // [make_concurrent_cached_function]
+  static_assert(std::is_same_v<decltype(cached)::input, size_t>,
+                "Wrong input type");
+  static_assert(std::is_same_v<decltype(cached)::output, std::vector<double>>,
+                "Wrong output type");
+
+  CHECK(call_count == 0);
+  const std::vector<double>& two = cached(2);
+  CHECK(two == std::vector<double>{1.0, 1.0});
+  CHECK(call_count == 1);
+  CHECK(&cached(2) == &two);
+  CHECK(call_count == 1);
+
+  auto statistics = cached.statistics();
+  CHECK(statistics.hits == 1);
+  CHECK(statistics.misses == 1);
+  CHECK(statistics.number_of_entries == 1);
+  CHECK(statistics.size_in_bytes >= 2 * sizeof(double));
+  CHECK(get_output(statistics) ==
+        "hits: 1, misses: 1, evictions: 0, entries: 1, bytes: " +
+            std::to_string(statistics.size_in_bytes));
+
+  // Request the same values from several threads. Every value has to be
+  // computed at least once, and all threads must see the same object.
+  constexpr size_t number_of_threads = 4;
+  constexpr size_t number_of_values = 50;
+  std::vector<std::vector<const std::vector<double>*>> addresses(
+      number_of_threads);
+  std::vector<std::thread> threads{};
+  for (size_t t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&cached, &addresses, t]() {
+      for (size_t n = 0; n < number_of_values; ++n) {
+        addresses[t].push_back(&cached(n));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t t = 1; t < number_of_threads; ++t) {
+    CHECK(addresses[t] == addresses[0]);
+  }
+  CHECK(&cached(2) == &two);
+  for (size_t n = 0; n < number_of_values; ++n) {
+    CHECK(cached(n).size() == n);
+  }
+
+  statistics = cached.statistics();
+  CHECK(statistics.number_of_entries == number_of_values);
+  CHECK(statistics.hits + statistics.misses ==
+        2 + (number_of_threads + 1) * number_of_values + 1);
+  CHECK(call_count >= number_of_values);
+}
+
+SPECTRE_TEST_CASE("Unit.Utilities.LruCachedFunction", "[Unit][Utilities]") {
+  std::atomic<size_t> call_count{0};
+  const auto func = [&call_count](const size_t n) {
+    ++call_count;
+    return std::vector<double>(n, 1.0);
+  };
+
+  // [make_lru_cached_function]
+  auto cached = make_lru_cached_function<size_t>(func, 2);
+  // [make_lru_cached_function]
+  static_assert(std::is_same_v<decltype(cached)::input, size_t>,
+                "Wrong input type");
+  static_assert(std::is_same_v<decltype(cached)::output, std::vector<double>>,
+                "Wrong output type");
+  CHECK(cached.capacity() == 2);
+
+  const std::shared_ptr<const std::vector<double>> two = cached(2);
+  CHECK(*two == std::vector<double>{1.0, 1.0});
+  CHECK(cached(3)->size() == 3);
+  CHECK(call_count == 2);
+  // Requesting 2 again makes 3 the least recently used value
+  CHECK(cached(2) == two);
+  CHECK(cached(4)->size() == 4);
+  CHECK(call_count == 3);
+  CHECK(cached(2) == two);
+  CHECK(call_count == 3);
+  CHECK(cached(3)->size() == 3);
+  CHECK(cached(4)->size() == 4);
+  CHECK(call_count == 5);
+  // 2 was evicted, but the value stays alive while it is used
+  CHECK(*two == std::vector<double>{1.0, 1.0});
+  CHECK(cached(2) != two);
+  CHECK(call_count == 6);
+
+  auto statistics = cached.statistics();
+  CHECK(statistics.hits == 2);
+  CHECK(statistics.misses == 6);
+  CHECK(statistics.evictions == 4);
+  CHECK(statistics.number_of_entries == 2);
+  CHECK(statistics.size_in_bytes >= 6 * sizeof(double));
+
+  cached.clear();
+  CHECK(cached.statistics().number_of_entries == 0);
+
+  // Request values from several threads. The cache never holds more than its
+  // capacity, and all values are correct.
+  constexpr size_t number_of_threads = 4;
+  constexpr size_t number_of_values = 50;
+  std::vector<std::thread> threads{};
+  std::vector<size_t> wrong_sizes(number_of_threads, 0);
+  for (size_t t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&cached, &wrong_sizes, t]() {
+      for (size_t n = 0; n < number_of_values; ++n) {
+        const size_t input = (n + t) % 5;
+        if (cached(input)->size() != input) {
+          ++wrong_sizes[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  CHECK(wrong_sizes == std::vector<size_t>(number_of_threads, 0));
+  statistics = cached.statistics();
+  CHECK(statistics.number_of_entries <= 2);
+  CHECK(statistics.hits + statistics.misses ==
+        8 + number_of_threads * number_of_values);
+}
@@ -71,6 +71,87 @@ class TestGenerateXdmf(unittest.TestCase):
             ),
         )
 
+    def test_incremental(self):
+        data_files = glob.glob(os.path.join(self.data_dir, "VolTestData*.h5"))
+        full_output_filename = os.path.join(self.test_dir, "Full.xmf")
+        generate_xdmf(
+            h5files=data_files,
+            output=full_output_filename,
+            subfile_name="element_data",
+        )
+        # Remove the last timestep from the XDMF file, as if it was generated
+        # before the run wrote the last observation
+        output_filename = os.path.join(self.test_dir, "Incremental.xmf")
+        xmf_tree = ET.parse(full_output_filename)
+        xmf_timesteps = xmf_tree.getroot().find("Domain/Grid")
+        xmf_timesteps.remove(xmf_timesteps[-1])
+        xmf_tree.write(output_filename)
+        # Updating the XDMF file adds the missing timestep
+        for _ in range(2):
+            generate_xdmf(
+                h5files=data_files,
+                output=output_filename,
+                subfile_name="element_data",
+                incremental=True,
+            )
+            self.assertEqual(
+                ET.canonicalize(from_file=output_filename, strip_text=True),
+                ET.canonicalize(
+                    from_file=full_output_filename, strip_text=True
+                ),
+            )
+        with self.assertRaisesRegex(ValueError, "'output' file"):
+            generate_xdmf(
+                h5files=data_files,
+                output=None,
+                subfile_name="element_data",
+                incremental=True,
+            )
+
+    def test_generate_missing_connectivity(self):
+        # Remove the connectivity from a copy of the data and check that it is
+        # generated again, so the XDMF file is the same
+        original_file = os.path.join(self.data_dir, "VolTestData0.h5")
+        data_file = os.path.join(self.test_dir, "VolTestData0.h5")
+        shutil.copy(original_file, data_file)
+        with h5py.File(data_file, "r+") as open_file:
+            for observation in open_file["element_data.vol"].values():
+                del observation["connectivity"]
+        with h5py.File(original_file, "r") as open_file:
+            expected_connectivity = {
+                key: observation["connectivity"][()]
+                for key, observation in open_file["element_data.vol"].items()
+            }
+        for data_files, output_name in [
+            ([original_file], "expected"),
+            ([data_file], "generated"),
+        ]:
+            generate_xdmf(
+                h5files=data_files,
+                output=os.path.join(self.test_dir, output_name),
+                subfile_name="element_data",
+                relative_paths=False,
+                num_jobs=2,
+            )
+        with h5py.File(data_file, "r") as open_file:
+            for key, observation in open_file["element_data.vol"].items():
+                self.assertEqual(
+                    list(observation["connectivity"][()]),
+                    list(expected_connectivity[key]),
+                )
+        self.assertEqual(
+            ET.canonicalize(
+                from_file=os.path.join(self.test_dir, "generated.xmf"),
+                strip_text=True,
+            ),
+            ET.canonicalize(
+                from_file=os.path.join(self.test_dir, "expected.xmf"),
+                strip_text=True,
+            ).replace(
+                os.path.abspath(original_file), os.path.abspath(data_file)
+            ),
+        )
+
     def test_surface_generate_xdmf(self):
         data_files = [os.path.join(self.data_dir, "SurfaceTestData.h5")]
         output_filename = os.path.join(
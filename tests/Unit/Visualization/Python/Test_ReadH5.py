@@ -12,6 +12,7 @@ import pandas.testing as pdt
 import spectre.Informer as spectre_informer
 import spectre.IO.H5 as spectre_h5
 from spectre.Visualization.ReadH5 import (
+    LazyVolumeData,
     available_subfiles,
     select_observation,
     to_dataframe,
@@ -108,6 +109,59 @@ class TestReadH5(unittest.TestCase):
                 (expected_obs_id, expected_time),
             )
 
+    def test_lazy_volume_data(self):
+        volfile_names = [self.data_dir / "VolTestData0.h5"]
+        expected = {}
+        for volfile_name in volfile_names:
+            with spectre_h5.H5File(str(volfile_name), "r") as open_file:
+                open_volfile = open_file.get_vol("/element_data")
+                for obs_id in open_volfile.list_observation_ids():
+                    expected_obs = expected.setdefault(
+                        open_volfile.get_observation_value(obs_id),
+                        dict(grid_names=[], extents=[], psi=[], components=[]),
+                    )
+                    expected_obs["grid_names"] += open_volfile.get_grid_names(
+                        obs_id
+                    )
+                    expected_obs["extents"] += open_volfile.get_extents(obs_id)
+                    expected_obs["psi"].append(
+                        np.asarray(
+                            open_volfile.get_tensor_component(
+                                obs_id, "Psi"
+                            ).data
+                        )
+                    )
+                    expected_obs["components"] = sorted(
+                        open_volfile.list_tensor_components(obs_id)
+                    )
+        with LazyVolumeData(volfile_names, "element_data") as volume_data:
+            self.assertEqual(volume_data.dim, 3)
+            self.assertEqual(len(volume_data), len(expected))
+            np.testing.assert_equal(volume_data.times, sorted(expected))
+            for step, time in enumerate(sorted(expected)):
+                expected_obs = expected[time]
+                self.assertEqual(
+                    volume_data.tensor_components(step),
+                    expected_obs["components"],
+                )
+                self.assertEqual(
+                    volume_data.grid_names(step), expected_obs["grid_names"]
+                )
+                np.testing.assert_equal(
+                    volume_data.extents(step), expected_obs["extents"]
+                )
+                expected_psi = np.concatenate(expected_obs["psi"])
+                np.testing.assert_equal(
+                    volume_data.tensor_component("Psi", step), expected_psi
+                )
+                grid_names, element_data = zip(
+                    *volume_data.iter_elements("Psi", step)
+                )
+                self.assertEqual(list(grid_names), expected_obs["grid_names"])
+                np.testing.assert_equal(
+                    np.concatenate(element_data), expected_psi
+                )
+
 
 if __name__ == "__main__":
     unittest.main(verbosity=2)
@@ -289,6 +289,39 @@ class TestTransformVolumeData(unittest.TestCase):
                 rtol=1e-2,
             )
 
+        # Test processing files in parallel. The integrals are summed over the
+        # files.
+        other_h5_filename = os.path.join(self.test_dir, "Test1.h5")
+        shutil.copyfile(self.h5_filename, other_h5_filename)
+        result = runner.invoke(
+            transform_volume_data_command,
+            [other_h5_filename]
+            + cli_flags
+            + [
+                "-k",
+                "sinusoid",
+                "--integrate",
+                "--output",
+                output_filename,
+                "--output-subfile",
+                "integrals_parallel",
+                "-j",
+                "2",
+            ],
+            catch_exceptions=False,
+        )
+        self.assertEqual(result.exit_code, 0)
+        with spectre_h5.H5File(output_filename, "r") as open_h5_file:
+            datfile = open_h5_file.get_dat("/integrals_parallel")
+            self.assertEqual(
+                datfile.get_legend(), ["Time", "Volume", "Sinusoid"]
+            )
+            npt.assert_allclose(
+                datfile.get_data(),
+                [[0.04, 2.0 * (2.0 * np.pi) ** 3, 128.0]],
+                rtol=1e-2,
+            )
+
 
 if __name__ == "__main__":
     unittest.main(verbosity=2)
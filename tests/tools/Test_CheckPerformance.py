@@ -0,0 +1,169 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import json
+import os
+import shutil
+import unittest
+
+import yaml
+from click.testing import CliRunner
+
+import spectre.IO.H5 as spectre_h5
+from spectre.Informer import unit_test_build_path
+from spectre.tools.CheckPerformance import (
+    OUTPUT_SIZE_METRIC,
+    PerformanceRegressionError,
+    check_performance,
+    check_performance_command,
+)
+
+
+class TestCheckPerformance(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = os.path.join(
+            unit_test_build_path(), "tools", "CheckPerformance"
+        )
+        self.run_dir = os.path.join(self.test_dir, "Run")
+        self.baselines_dir = os.path.join(self.test_dir, "Baselines")
+        self.input_file_path = os.path.join(self.test_dir, "Input.yaml")
+        shutil.rmtree(self.test_dir, ignore_errors=True)
+        os.makedirs(self.run_dir, exist_ok=True)
+        with open(self.input_file_path, "w") as open_file:
+            yaml.safe_dump_all(
+                [
+                    {
+                        "Executable": "EvolveSomething",
+                        "ExpectedOutput": ["Reductions.h5"],
+                        "PerformanceChecks": {
+                            "Metrics": [
+                                {
+                                    "Subfile": "/ActionProfile.dat",
+                                    "FileGlob": "Reductions.h5",
+                                    "Columns": "* time",
+                                    "RelativeTolerance": 0.5,
+                                    "AbsoluteTolerance": 0.1,
+                                },
+                                {
+                                    "Subfile": "/MemoryMonitors/*.dat",
+                                    "FileGlob": "Reductions.h5",
+                                    "Columns": "Maximum total size (MB)",
+                                },
+                            ],
+                            "OutputSize": {"RelativeTolerance": 0.5},
+                        },
+                    },
+                    {},
+                ],
+                open_file,
+            )
+        self.write_reductions(action_time=1.0, memory=10.0)
+        self.baselines_file = os.path.join(
+            self.baselines_dir, "EvolveSomething.Input.json"
+        )
+
+    def tearDown(self):
+        shutil.rmtree(self.test_dir)
+
+    def write_reductions(self, action_time, memory):
+        with spectre_h5.H5File(
+            os.path.join(self.run_dir, "Reductions.h5"), "w"
+        ) as open_h5_file:
+            action_subfile = open_h5_file.insert_dat(
+                "/ActionProfile",
+                legend=[
+                    "Time",
+                    "Evolve/Step invocations",
+                    "Evolve/Step time",
+                ],
+                version=0,
+            )
+            action_subfile.append([0.0, 1.0, 0.5 * action_time])
+            action_subfile.append([1.0, 2.0, action_time])
+            open_h5_file.close_current_object()
+            memory_subfile = open_h5_file.insert_dat(
+                "/MemoryMonitors/Elements",
+                legend=[
+                    "Time",
+                    "Size on node 0 (MB)",
+                    "Maximum total size (MB)",
+                    "Change in total size (MB)",
+                ],
+                version=0,
+            )
+            memory_subfile.append([0.0, memory, memory, 0.0])
+            open_h5_file.close_current_object()
+
+    def check(self, **kwargs):
+        check_performance(
+            input_file=self.input_file_path,
+            run_directory=self.run_dir,
+            baselines_dir=self.baselines_dir,
+            **kwargs,
+        )
+
+    def test_check_performance(self):
+        # The first run records the baselines
+        self.check()
+        with open(self.baselines_file, "r") as open_file:
+            baselines = json.load(open_file)
+        self.assertEqual(
+            set(baselines.keys()),
+            {
+                "ActionProfile.dat/Evolve/Step time",
+                "MemoryMonitors/Elements.dat/Maximum total size (MB)",
+                OUTPUT_SIZE_METRIC,
+            },
+        )
+        self.assertEqual(baselines["ActionProfile.dat/Evolve/Step time"], 1.0)
+        self.assertGreater(baselines[OUTPUT_SIZE_METRIC], 0.0)
+        # Within the tolerances, and faster runs always pass
+        self.write_reductions(action_time=1.55, memory=10.0)
+        self.check()
+        self.write_reductions(action_time=0.1, memory=9.0)
+        self.check()
+        # Regressions
+        self.write_reductions(action_time=1.7, memory=10.0)
+        with self.assertRaisesRegex(PerformanceRegressionError, "Step time"):
+            self.check()
+        self.write_reductions(action_time=1.0, memory=11.0)
+        with self.assertRaisesRegex(
+            PerformanceRegressionError, "Maximum total size"
+        ):
+            self.check()
+        # Passing checks don't move the baselines
+        with open(self.baselines_file, "r") as open_file:
+            self.assertEqual(json.load(open_file), baselines)
+        # Update the baselines
+        self.check(update_baselines=True)
+        self.check()
+        with open(self.baselines_file, "r") as open_file:
+            self.assertEqual(
+                json.load(open_file)[
+                    "MemoryMonitors/Elements.dat/Maximum total size (MB)"
+                ],
+                11.0,
+            )
+
+    def test_cli(self):
+        runner = CliRunner()
+        args = [
+            self.input_file_path,
+            "-d",
+            self.run_dir,
+            "-b",
+            self.baselines_dir,
+        ]
+        result = runner.invoke(check_performance_command, args)
+        self.assertEqual(result.exit_code, 0, result.output)
+        self.write_reductions(action_time=2.0, memory=10.0)
+        result = runner.invoke(check_performance_command, args)
+        self.assertNotEqual(result.exit_code, 0)
+        result = runner.invoke(
+            check_performance_command, args + ["--update-baselines"]
+        )
+        self.assertEqual(result.exit_code, 0, result.output)
+
+
+if __name__ == "__main__":
+    unittest.main(verbosity=2)
@@ -83,6 +83,28 @@ class TestExecutableStatus(unittest.TestCase):
             )
             ahb_subfile.append([-1.0, 0.0, 0.0])
             open_h5_file.close_current_object()
+            # Memory monitors
+            array_memory_subfile = open_h5_file.insert_dat(
+                "/MemoryMonitors/DgElementArray",
+                legend=[
+                    "Time",
+                    "Size on node 0 (MB)",
+                    "Size on node 1 (MB)",
+                    "Proc of max size",
+                    "Size on proc of max size (MB)",
+                    "Average size per node (MB)",
+                ],
+                version=0,
+            )
+            array_memory_subfile.append([2.0, 1000.0, 500.0, 0, 400.0, 750.0])
+            open_h5_file.close_current_object()
+            singleton_memory_subfile = open_h5_file.insert_dat(
+                "/MemoryMonitors/ObserverWriter",
+                legend=["Time", "Proc", "Size (MB)"],
+                version=0,
+            )
+            singleton_memory_subfile.append([2.0, 0, 500.0])
+            open_h5_file.close_current_object()
             # Constraints
             constraints_subfile = open_h5_file.insert_dat(
                 "/Norms", legend=["L2Norm(ConstraintEnergy)"], version=0
@@ -95,15 +117,19 @@ class TestExecutableStatus(unittest.TestCase):
     def test_evolution_status(self):
         executable_status = match_executable_status("EvolveSomething")
         status = executable_status.status(self.input_file, self.work_dir)
-        self.assertEqual(status, {"Time": 2.0, "Speed": 2640.0})
+        self.assertEqual(
+            status, {"Time": 2.0, "Speed": 2640.0, "Memory": 2.0}
+        )
         self.assertEqual(executable_status.format("Time", 1.5), "1.5")
         self.assertEqual(executable_status.format("Speed", 1.2), "1.2")
+        self.assertEqual(executable_status.format("Memory", 2.5), "2.5")
 
     def test_evolve_bbh_status(self):
         executable_status = match_executable_status("EvolveGhBinaryBlackHole")
         status = executable_status.status(self.input_file, self.work_dir)
         self.assertEqual(status["Time"], 2.0)
         self.assertEqual(status["Speed"], 2640.0)
+        self.assertEqual(status["Memory"], 2.0)
         self.assertEqual(status["Orbits"], 0.5)
         self.assertEqual(status["Separation"], 2.0)
         self.assertEqual(status["Constraint Energy"], 1.0e-3)
@@ -0,0 +1,222 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import fnmatch
+import glob
+import json
+import logging
+import os
+
+import click
+import h5py
+import yaml
+
+from spectre.Visualization.ReadH5 import available_subfiles, to_dataframe
+
+logger = logging.getLogger(__name__)
+
+# Name of the metric that measures the total size of the expected output files
+OUTPUT_SIZE_METRIC = "Output size (MB)"
+
+
+class PerformanceRegressionError(Exception):
+    def __init__(self, regressions):
+        self.regressions = regressions
+
+    def __str__(self):
+        return "Performance regressions:\n" + "\n".join(
+            f"  {regression}" for regression in self.regressions
+        )
+
+
+def _directory_size(path):
+    if os.path.isfile(path):
+        return os.path.getsize(path)
+    return sum(
+        os.path.getsize(os.path.join(root, filename))
+        for root, _, filenames in os.walk(path)
+        for filename in filenames
+    )
+
+
+def collect_metrics(metadata, run_directory):
+    """Collect the performance metrics of a run.
+
+    Returns a dictionary from the name of each metric to a tuple of its value,
+    its relative tolerance and its absolute tolerance. See `check_performance`
+    for the metrics that are collected.
+    """
+    checks = metadata["PerformanceChecks"]
+    metrics = {}
+    for check in checks.get("Metrics", []):
+        tolerances = (
+            float(check.get("RelativeTolerance", 0.0)),
+            float(check.get("AbsoluteTolerance", 0.0)),
+        )
+        subfile_pattern = check["Subfile"].lstrip("/")
+        column_pattern = check["Columns"]
+        h5_files = sorted(
+            glob.glob(os.path.join(run_directory, check["FileGlob"]))
+        )
+        found_columns = False
+        for h5_file in h5_files:
+            with h5py.File(h5_file, "r") as open_h5_file:
+                for subfile_name in available_subfiles(open_h5_file, ".dat"):
+                    if not fnmatch.fnmatch(subfile_name, subfile_pattern):
+                        continue
+                    # All metrics are cumulative, so the last row is the total
+                    # over the run
+                    last_row = to_dataframe(open_h5_file[subfile_name]).iloc[-1]
+                    for column in last_row.index:
+                        if not fnmatch.fnmatch(column, column_pattern):
+                            continue
+                        found_columns = True
+                        name = f"{subfile_name}/{column}"
+                        # Take the maximum over files, e.g. over nodes
+                        value = float(last_row[column])
+                        if name in metrics:
+                            value = max(value, metrics[name][0])
+                        metrics[name] = (value,) + tolerances
+        if not found_columns:
+            raise ValueError(
+                f"No columns matching '{column_pattern}' in subfiles matching "
+                f"'{subfile_pattern}' of the files {h5_files}."
+            )
+    if "OutputSize" in checks:
+        output_size = sum(
+            _directory_size(os.path.join(run_directory, expected_output))
+            for expected_output in metadata.get("ExpectedOutput", [])
+            if os.path.exists(os.path.join(run_directory, expected_output))
+        )
+        metrics[OUTPUT_SIZE_METRIC] = (
+            output_size / 1.0e6,
+            float(checks["OutputSize"].get("RelativeTolerance", 0.0)),
+            float(checks["OutputSize"].get("AbsoluteTolerance", 0.0)),
+        )
+    return metrics
+
+
+def check_performance(
+    input_file, run_directory, baselines_dir, update_baselines=False
+):
+    """
+    Compare the performance of a run to stored baselines.
+
+    Collects performance metrics from the output of the run of the
+    `input_file` in the `run_directory` and compares them to the baselines in
+    the `baselines_dir`. Raises an error if a metric exceeds its baseline by
+    more than the tolerances. The metrics are defined by the
+    `PerformanceChecks` in the input file metadata:
+
+    \b
+    ```yaml
+    PerformanceChecks:
+      Metrics:
+        - Subfile: "/ActionProfile.dat"
+          FileGlob: "Reductions.h5"
+          Columns: "* time"
+          RelativeTolerance: 0.5
+          AbsoluteTolerance: 0.1
+        - Subfile: "/MemoryMonitors/*.dat"
+          FileGlob: "Reductions.h5"
+          Columns: "Maximum total size (MB)"
+          RelativeTolerance: 0.2
+      OutputSize:
+        RelativeTolerance: 0.1
+    ```
+
+    Each entry in `Metrics` selects the columns matching the `Columns` glob in
+    the '.dat' subfiles matching the `Subfile` glob. The metric is the value in
+    the last row, so the columns should be cumulative over the run, like the
+    wall times written by the 'ObserveActionProfile' event and the memory
+    high-water marks written by the 'MonitorMemory' event. `OutputSize`
+    measures the total size of the `ExpectedOutput` files, i.e. the bytes
+    written to disk. Regression thresholds are
+    `AbsoluteTolerance + RelativeTolerance * baseline`. Both default to zero.
+
+    Wall times depend on the machine, so baselines are not stored in the
+    repository. Metrics that have no baseline yet are added to the baselines
+    file, so the first run on a machine records the baselines. Pass
+    `update_baselines` to replace the baselines with the current values, e.g.
+    after an intended change in performance.
+    """
+    with open(input_file, "r") as open_input_file:
+        metadata = next(yaml.safe_load_all(open_input_file))
+    metrics = collect_metrics(metadata, run_directory)
+
+    input_file_name = os.path.splitext(os.path.basename(input_file))[0]
+    baselines_file = os.path.join(
+        baselines_dir, f"{metadata['Executable']}.{input_file_name}.json"
+    )
+    baselines = {}
+    if os.path.exists(baselines_file) and not update_baselines:
+        with open(baselines_file, "r") as open_baselines_file:
+            baselines = json.load(open_baselines_file)
+
+    regressions = []
+    for name in sorted(set(baselines) - set(metrics)):
+        regressions.append(f"{name}: not measured in this run")
+    new_baselines = dict(baselines)
+    for name, (value, relative_tolerance, absolute_tolerance) in sorted(
+        metrics.items()
+    ):
+        if name not in baselines:
+            logger.info(f"Recording baseline {name}: {value}")
+            new_baselines[name] = value
+            continue
+        baseline = baselines[name]
+        threshold = absolute_tolerance + relative_tolerance * abs(baseline)
+        if value - baseline > threshold:
+            regressions.append(
+                f"{name}: {value} exceeds baseline {baseline} by more than"
+                f" {threshold}"
+            )
+        elif baseline - value > threshold:
+            logger.info(
+                f"{name}: {value} is below baseline {baseline}. Consider"
+                " updating the baselines."
+            )
+        else:
+            logger.debug(f"{name}: {value} (baseline {baseline})")
+
+    if new_baselines != baselines:
+        os.makedirs(baselines_dir, exist_ok=True)
+        with open(baselines_file, "w") as open_baselines_file:
+            json.dump(new_baselines, open_baselines_file, indent=2)
+        logger.info(f"Wrote baselines to {baselines_file}")
+    if len(regressions) > 0:
+        raise PerformanceRegressionError(regressions)
+
+
+@click.command(name="check-performance", help=check_performance.__doc__)
+@click.argument(
+    "input_file",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, readable=True),
+)
+@click.option(
+    "--run-directory",
+    "-d",
+    type=click.Path(exists=True, file_okay=False, dir_okay=True, readable=True),
+    required=True,
+    help="Directory of the run to check",
+)
+@click.option(
+    "--baselines-dir",
+    "-b",
+    type=click.Path(file_okay=False, dir_okay=True, writable=True),
+    required=True,
+    help="Directory where the baselines are stored",
+)
+@click.option(
+    "--update-baselines",
+    is_flag=True,
+    help="Replace the stored baselines with the metrics of this run",
+)
+def check_performance_command(**kwargs):
+    _rich_traceback_guard = True  # Hide traceback until here
+    check_performance(**kwargs)
+
+
+if __name__ == "__main__":
+    logging.basicConfig(level=logging.INFO)
+    check_performance_command(help_option_names=["-h", "--help"])
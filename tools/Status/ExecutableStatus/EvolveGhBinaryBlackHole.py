@@ -19,6 +19,7 @@ class EvolveGhBinaryBlackHole(EvolutionStatus):
     fields = {
         "Time": "M",
         "Speed": "M/h",
+        "Memory": "GB",
         "Orbits": None,
         "Separation": "M",
         "Constraint Energy": None,
@@ -35,6 +36,7 @@ class EvolveGhBinaryBlackHole(EvolutionStatus):
             return {}
         with open_reductions_file:
             result = self.time_status(input_file, open_reductions_file)
+            result.update(self.memory_status(open_reductions_file))
             # Number of orbits. We use the rotation control system for this.
             try:
                 rotation_z = to_dataframe(
@@ -19,6 +19,7 @@ class EvolveGhSingleBlackHole(EvolutionStatus):
     fields = {
         "Time": "M",
         "Speed": "M/h",
+        "Memory": "GB",
         "Constraint Energy": None,
     }
 
@@ -33,6 +34,7 @@ class EvolveGhSingleBlackHole(EvolutionStatus):
             return {}
         with open_reductions_file:
             result = self.time_status(input_file, open_reductions_file)
+            result.update(self.memory_status(open_reductions_file))
             # Norms
             try:
                 norms = to_dataframe(
@@ -71,14 +71,16 @@ class EvolutionStatus(ExecutableStatus):
     """An 'ExecutableStatus' subclass that matches all evolution executables.
 
     This is a fallback if no more specialized subclass is implemented. It just
-    determines the current time and run speed. This class can be subclassed
-    further to use the 'time_status' function in subclasses.
+    determines the current time, run speed, and memory usage. This class can be
+    subclassed further to use the 'time_status' and 'memory_status' functions
+    in subclasses.
     """
 
     executable_name_patterns = [r"^Evolve"]
     fields = {
         "Time": None,
         "Speed": "1/h",
+        "Memory": "GB",
     }
 
     def time_status(
@@ -154,6 +156,42 @@ class EvolutionStatus(ExecutableStatus):
             logger.debug("Unable to estimate simulation speed.", exc_info=True)
         return result
 
+    def memory_status(self, open_reductions_file) -> dict:
+        """Report the total memory usage of the parallel components.
+
+        Uses the 'MonitorMemory' event, so the status information is only as
+        current as the output frequency of the event. The reported memory is
+        the sum over the most recent output of all parallel components that
+        are monitored, on all nodes.
+
+        Arguments:
+          open_reductions_file: The open h5py reductions data file.
+
+        Returns: Status field "Memory" in GB.
+        """
+        if "MemoryMonitors" not in open_reductions_file:
+            return {}
+        total_memory = 0.0
+        for subfile_name, subfile in open_reductions_file[
+            "MemoryMonitors"
+        ].items():
+            try:
+                memory = to_dataframe(subfile, slice=np.s_[-1:]).iloc[-1]
+            except:
+                logger.debug(
+                    f"Unable to read memory from subfile: '{subfile_name}'",
+                    exc_info=True,
+                )
+                continue
+            # Singletons write "Size (MB)", all other components write
+            # "Size on node N (MB)" for every node
+            total_memory += sum(
+                memory[column]
+                for column in memory.index
+                if column == "Size (MB)" or column.startswith("Size on node")
+            )
+        return {"Memory": total_memory / 1.0e3}
+
     def status(self, input_file, work_dir):
         try:
             reductions_file = input_file["Observers"]["ReductionFileName"]
@@ -164,9 +202,11 @@ class EvolutionStatus(ExecutableStatus):
             logger.debug("Unable to open reductions file.", exc_info=True)
             return {}
         with open_reductions_file:
-            return self.time_status(input_file, open_reductions_file)
+            result = self.time_status(input_file, open_reductions_file)
+            result.update(self.memory_status(open_reductions_file))
+            return result
 
     def format(self, field, value):
-        if field in ["Time", "Speed"]:
+        if field in ["Time", "Speed", "Memory"]:
             return f"{value:g}"
         raise ValueError